@@ -1,26 +0,0 @@
-size_t mVertexCount = 6223;
-size_t mIndexCount = 29328;
-
-float mPositions[] = {
--0, 0.165247, 0.793669, -0.077793, 0.01524, 0.789847, -0.077793, 0.165247, 0.789847, -0, 0.01524, 0.793669, -0.154837, 0.01524, 0.778419, -0.154837, 0.165247, 0.778419, -0.23039, 0.165247, 0.759494, -0.23039, 0.01524, 0.759494, -0.303724, 0.165247, 0.733254, -0.303724, 0.01524, 0.733254, -0.374133, 0.165247, 0.699953, -0.374133, 0.01524, 0.699953, -0.440939, 0.01524, 0.659911, -0.440939, 0.165247, 0.659911, -0.503498, 0.165247, 0.613514, -0.503498, 0.01524, 0.613514, -0.561209, 0.165247, 0.561209, -0.561209, 0.01524, 0.561209, -0.613514, 0.165247, 0.503498, -0.613514, 0.01524, 0.503498, -0.659911, 0.165247, 0.440939, -0.659911, 0.01524, 0.440939, -0.699953, 0.01524, 0.374133, -0.699953, 0.165247, 0.374133, -0.733254, 0.165247, 0.303724, -0.733254, 0.01524, 0.303724, -0.759494, 0.165247, 0.23039, -0.759494, 0.01524, 0.23039, -0.778419, 0.165247, 0.154837, -0.778419, 0.01524, 0.154837, -0.789847, 0.165247, 0.077793, -0.789847, 0.01524, 0.077793, -0.793669, 0.165247, -0, -0.793669, 0.01524, -0, -0.793669, 0.165247, -0, -0.793669, 0.01524, -0, -0.789847, 0.165247, -0.077793, -0.789847, 0.01524, -0.077793, -0.778419, 0.01524, -0.154837, -0.778419, 0.165247, -0.154837, -0.759494, 0.165247, -0.23039, -0.759494, 0.01524, -0.23039, -0.733254, 0.165247, -0.303724, -0.733254, 0.01524, -0.303724, -0.699953, 0.165247, -0.374133, -0.699953, 0.01524, -0.374133, -0.659911, 0.165247, -0.440939, -0.659911, 0.01524, -0.440939, -0.613514, 0.01524, -0.503498, -0.613514, 0.165247, -0.503498, -0.561208, 0.165247, -0.561209, -0.561208, 0.01524, -0.561209, -0.503498, 0.165247, -0.613514, -0.503498, 0.01524, -0.613514, -0.440938, 0.165247, -0.659912, -0.440938, 0.01524, -0.659912, -0.374132, 0.165247, -0.699954, -0.374132, 0.01524, -0.699954, -0.303723, 0.01524, -0.733254, -0.303723, 0.165247, -0.733254, -0.230389, 0.01524, -0.759494, -0.230389, 0.165247, -0.759494, -0.154836, 0.01524, -0.778419, -0.154836, 0.165247, -0.778419, -0.077793, 0.165247, -0.789847, -0.077793, 0.01524, -0.789847, 1e-06, 0.165247, -0.793669, 1e-06, 0.01524, -0.793669, 0.077794, 0.165247, -0.789847, 0.077794, 0.01524, -0.789847, 0.154838, 0.165247, -0.778419, 0.154838, 0.01524, -0.778419, 0.230391, 0.01524, -0.759493, 0.230391, 0.165247, -0.759493, 0.303725, 0.01524, -0.733254, 0.303725, 0.165247, -0.733254, 0.374134, 0.01524, -0.699953, 0.374134, 0.165247, -0.699953, 0.440939, 0.165247, -0.659911, 0.440939, 0.01524, -0.659911, 0.503499, 0.165247, -0.613514, 0.503499, 0.01524, -0.613514, 0.561209, 0.165247, -0.561208, 0.561209, 0.01524, -0.561208, 0.613515, 0.165247, -0.503497, 0.613515, 0.01524, -0.503497, 0.659912, 0.01524, -0.440938, 0.659912, 0.165247, -0.440938, 0.699954, 0.165247, -0.374132, 0.699954, 0.01524, -0.374132, 0.733254, 0.165247, -0.303724, 0.733254, 0.01524, -0.303724, 0.759494, 0.165247, -0.23039, 0.759494, 0.01524, -0.23039, 0.778419, 0.165247, -0.154837, 0.778419, 0.01524, -0.154837, 0.789847, 0.01524, -0.077793, 0.789847, 0.165247, -0.077793, 0.793669, 0.165247, -0, 0.793669, 0.01524, -0, 0.789847, 0.165247, 0.077793, 0.789847, 0.01524, 0.077793, 0.778419, 0.165247, 0.154836, 0.778419, 0.01524, 0.154836, 0.759494, 0.165247, 0.230389, 0.759494, 0.01524, 0.230389, 0.733255, 0.165247, 0.303723, 0.733255, 0.01524, 0.303723, 0.699954, 0.165247, 0.374132, 0.699954, 0.01524, 0.374132, 0.659912, 0.01524, 0.440938, 0.659912, 0.165247, 0.440938, 0.613515, 0.165247, 0.503497, 0.613515, 0.01524, 0.503497, 0.56121, 0.165247, 0.561207, 0.56121, 0.01524, 0.561207, 0.503499, 0.165247, 0.613513, 0.503499, 0.01524, 0.613513, 0.44094, 0.165247, 0.65991, 0.44094, 0.01524, 0.65991, 0.374135, 0.01524, 0.699952, 0.374135, 0.165247, 0.699952, 0.303726, 0.165247, 0.733253, 0.303726, 0.01524, 0.733253, 0.230392, 0.165247, 0.759493, 0.230392, 0.01524, 0.759493, 0.15484, 0.165247, 0.778418, 0.15484, 0.01524, 0.778418, 0.077796, 0.01524, 0.789847, 0.077796, 0.165247, 0.789847, -0.072976, 0.180487, 0.740941, -0, 0.180487, 0.779238, -0.076379, 0.180487, 0.775486, 0, 0.180487, 0.744526, -0.14525, 0.180487, 0.73022, -0.152022, 0.180487, 0.764266, -0.216124, 0.180487, 0.712467, -0.226201, 0.180487, 0.745685, -0.298202, 0.180487, 0.719922, -0.284918, 0.180487, 0.687852, -0.36733, 0.180487, 0.687227, -0.350967, 0.180487, 0.656613, -0.413637, 0.180487, 0.619051, -0.432922, 0.180487, 0.647913, -0.472322, 0.180487, 0.575526, -0.494344, 0.180487, 0.602359, -0.551005, 0.180487, 0.551005, -0.526459, 0.180487, 0.526459, -0.602359, 0.180487, 0.494344, -0.575526, 0.180487, 0.472322, -0.619051, 0.180487, 0.413636, -0.647913, 0.180487, 0.432922, -0.656613, 0.180487, 0.350967, -0.687227, 0.180487, 0.36733, -0.687852, 0.180487, 0.284918, -0.719922, 0.180487, 0.298202, -0.712467, 0.180487, 0.216124, -0.745685, 0.180487, 0.226201, -0.73022, 0.180487, 0.14525, -0.764266, 0.180487, 0.152022, -0.775486, 0.180487, 0.076379, -0.740941, 0.180487, 0.072976, -0.744526, 0.180487, -0, -0.779238, 0.180487, -0, -0.744526, 0.180487, -0, -0.775486, 0.180487, -0.076379, -0.740941, 0.180487, -0.072976, -0.779238, 0.180487, -0, -0.764266, 0.180487, -0.152022, -0.73022, 0.180487, -0.14525, -0.745685, 0.180487, -0.226201, -0.712467, 0.180487, -0.216125, -0.719922, 0.180487, -0.298202, -0.687852, 0.180487, -0.284918, -0.687227, 0.180487, -0.367331, -0.656613, 0.180487, -0.350967, -0.647913, 0.180487, -0.432922, -0.619051, 0.180487, -0.413637, -0.575526, 0.180487, -0.472323, -0.602359, 0.180487, -0.494344, -0.551004, 0.180487, -0.551005, -0.526459, 0.180487, -0.52646, -0.494343, 0.180487, -0.60236, -0.472322, 0.180487, -0.575527, -0.432921, 0.180487, -0.647913, -0.413636, 0.180487, -0.619051, -0.36733, 0.180487, -0.687227, -0.350967, 0.180487, -0.656613, -0.284917, 0.180487, -0.687853, -0.298201, 0.180487, -0.719923, -0.2262, 0.180487, -0.745685, -0.216124, 0.180487, -0.712467, -0.152021, 0.180487, -0.764266, -0.145249, 0.180487, -0.73022, -0.076378, 0.180487, -0.775486, -0.072976, 0.180487, -0.740941, 1e-06, 0.180487, -0.779238, 1e-06, 0.180487, -0.744526, 0.076379, 0.180487, -0.775486, 0.072977, 0.180487, -0.740941, 0.152023, 0.180487, -0.764265, 0.145251, 0.180487, -0.73022, 0.226202, 0.180487, -0.745684, 0.216125, 0.180487, -0.712467, 0.298202, 0.180487, -0.719922, 0.284919, 0.180487, -0.687852, 0.367331, 0.180487, -0.687227, 0.350968, 0.180487, -0.656613, 0.413637, 0.180487, -0.61905, 0.432922, 0.180487, -0.647913, 0.494344, 0.180487, -0.602359, 0.472323, 0.180487, -0.575526, 0.551005, 0.180487, -0.551004, 0.52646, 0.180487, -0.526459, 0.60236, 0.180487, -0.494343, 0.575527, 0.180487, -0.472322, 0.647913, 0.180487, -0.432921, 0.619051, 0.180487, -0.413636, 0.687227, 0.180487, -0.36733, 0.656614, 0.180487, -0.350967, 0.687853, 0.180487, -0.284918, 0.719923, 0.180487, -0.298201, 0.745685, 0.180487, -0.226201, 0.712467, 0.180487, -0.216124, 0.73022, 0.180487, -0.14525, 0.764266, 0.180487, -0.152022, 0.740941, 0.180487, -0.072976, 0.775486, 0.180487, -0.076379, 0.744526, 0.180487, -0, 0.779238, 0.180487, -0, 0.740941, 0.180487, 0.072976, 0.775486, 0.180487, 0.076378, 0.73022, 0.180487, 0.145249, 0.764266, 0.180487, 0.152021, 0.745685, 0.180487, 0.2262, 0.712467, 0.180487, 0.216124, 0.687853, 0.180487, 0.284917, 0.719923, 0.180487, 0.298201, 0.656614, 0.180487, 0.350966, 0.687227, 0.180487, 0.367329, 0.619052, 0.180487, 0.413635, 0.647914, 0.180487, 0.432921, 0.575527, 0.180487, 0.472321, 0.60236, 0.180487, 0.494343, 0.526461, 0.180487, 0.526458, 0.551006, 0.180487, 0.551004, 0.494345, 0.180487, 0.602358, 0.472324, 0.180487, 0.575525, 0.413638, 0.180487, 0.61905, 0.432923, 0.180487, 0.647912, 0.350969, 0.180487, 0.656612, 0.367332, 0.180487, 0.687226, 0.28492, 0.180487, 0.687851, 0.298204, 0.180487, 0.719922, 0.226203, 0.180487, 0.745684, 0.216127, 0.180487, 0.712466, 0.152024, 0.180487, 0.764265, 0.145252, 0.180487, 0.73022, 0.076381, 0.180487, 0.775486, 0.072979, 0.180487, 0.740941, 0, 0.165247, 0.730096, -0.071562, 0.165247, 0.72658, -0.071562, 0.138475, 0.72658, 0, 0.138475, 0.730096, -0.142435, 0.165247, 0.716067, -0.142435, 0.138475, 0.716067, -0.211936, 0.165247, 0.698658, -0.211936, 0.138475, 0.698658, -0.279396, 0.165247, 0.67452, -0.279396, 0.138475, 0.67452, -0.344165, 0.138475, 0.643887, -0.344165, 0.165247, 0.643887, -0.405619, 0.165247, 0.607052, -0.405619, 0.138475, 0.607052, -0.463168, 0.165247, 0.564372, -0.463168, 0.138475, 0.564372, -0.516256, 0.165247, 0.516256, -0.516256, 0.138475, 0.516256, -0.564372, 0.138475, 0.463168, -0.564372, 0.165247, 0.463168, -0.607052, 0.165247, 0.405619, -0.607052, 0.138475, 0.405619, -0.643887, 0.165247, 0.344165, -0.643887, 0.138475, 0.344165, -0.67452, 0.165247, 0.279395, -0.67452, 0.138475, 0.279395, -0.698658, 0.138475, 0.211936, -0.698658, 0.165247, 0.211936, -0.716067, 0.138475, 0.142434, -0.716067, 0.165247, 0.142434, -0.72658, 0.165247, 0.071562, -0.72658, 0.138475, 0.071562, -0.730096, 0.165247, -0, -0.730096, 0.138475, -0, -0.730096, 0.165247, -0, -0.72658, 0.165247, -0.071562, -0.72658, 0.138475, -0.071562, -0.730096, 0.138475, -0, -0.716067, 0.165247, -0.142435, -0.716067, 0.138475, -0.142435, -0.698658, 0.138475, -0.211936, -0.698658, 0.165247, -0.211936, -0.67452, 0.138475, -0.279396, -0.67452, 0.165247, -0.279396, -0.643887, 0.165247, -0.344165, -0.643887, 0.138475, -0.344165, -0.607052, 0.165247, -0.40562, -0.607052, 0.138475, -0.40562, -0.564371, 0.165247, -0.463168, -0.564371, 0.138475, -0.463168, -0.516255, 0.165247, -0.516256, -0.516255, 0.138475, -0.516256, -0.463167, 0.138475, -0.564372, -0.463167, 0.165247, -0.564372, -0.405619, 0.138475, -0.607053, -0.405619, 0.165247, -0.607053, -0.344164, 0.165247, -0.643887, -0.344164, 0.138475, -0.643887, -0.279395, 0.165247, -0.674521, -0.279395, 0.138475, -0.674521, -0.211935, 0.165247, -0.698658, -0.211935, 0.138475, -0.698658, -0.142434, 0.165247, -0.716067, -0.142434, 0.138475, -0.716067, -0.071561, 0.165247, -0.72658, -0.071561, 0.138475, -0.72658, 1e-06, 0.165247, -0.730096, 1e-06, 0.138475, -0.730096, 0.071563, 0.138475, -0.72658, 0.071563, 0.165247, -0.72658, 0.142435, 0.165247, -0.716067, 0.142435, 0.138475, -0.716067, 0.211936, 0.165247, -0.698658, 0.211936, 0.138475, -0.698658, 0.279396, 0.165247, -0.67452, 0.279396, 0.138475, -0.67452, 0.344165, 0.165247, -0.643887, 0.344165, 0.138475, -0.643887, 0.40562, 0.165247, -0.607052, 0.40562, 0.138475, -0.607052, 0.463168, 0.165247, -0.564371, 0.463168, 0.138475, -0.564371, 0.516256, 0.165247, -0.516255, 0.516256, 0.138475, -0.516255, 0.564372, 0.165247, -0.463167, 0.564372, 0.138475, -0.463167, 0.607053, 0.165247, -0.405619, 0.607053, 0.138475, -0.405619, 0.643887, 0.165247, -0.344164, 0.643887, 0.138475, -0.344164, 0.674521, 0.165247, -0.279395, 0.674521, 0.138475, -0.279395, 0.698658, 0.138475, -0.211935, 0.698658, 0.165247, -0.211935, 0.716067, 0.138475, -0.142435, 0.716067, 0.165247, -0.142435, 0.72658, 0.165247, -0.071562, 0.72658, 0.138475, -0.071562, 0.730096, 0.165247, -0, 0.730096, 0.138475, -0, 0.72658, 0.165247, 0.071561, 0.72658, 0.138475, 0.071561, 0.716067, 0.165247, 0.142434, 0.716067, 0.138475, 0.142434, 0.698658, 0.138475, 0.211935, 0.698658, 0.165247, 0.211935, 0.674521, 0.165247, 0.279395, 0.674521, 0.138475, 0.279395, 0.643887, 0.138475, 0.344164, 0.643887, 0.165247, 0.344164, 0.607053, 0.165247, 0.405618, 0.607053, 0.138475, 0.405618, 0.564373, 0.165247, 0.463167, 0.564373, 0.138475, 0.463167, 0.516257, 0.165247, 0.516255, 0.516257, 0.138475, 0.516255, 0.463169, 0.138475, 0.564371, 0.463169, 0.165247, 0.564371, 0.405621, 0.165247, 0.607051, 0.405621, 0.138475, 0.607051, 0.344166, 0.165247, 0.643886, 0.344166, 0.138475, 0.643886, 0.279397, 0.138475, 0.67452, 0.279397, 0.165247, 0.67452, 0.211938, 0.165247, 0.698657, 0.211938, 0.138475, 0.698657, 0.142437, 0.138475, 0.716067, 0.142437, 0.165247, 0.716067, 0.071564, 0.165247, 0.72658, 0.071564, 0.138475, 0.72658, -0, -0, 0.779238, -0.076379, -0, 0.775486, -0.152022, -0, 0.764266, -0.226201, -0, 0.745685, -0.298202, -0, 0.719922, -0.36733, -0, 0.687227, -0.432922, -0, 0.647913, -0.494344, -0, 0.602359, -0.551005, -0, 0.551005, -0.602359, -0, 0.494344, -0.647913, -0, 0.432922, -0.687227, -0, 0.36733, -0.719922, -0, 0.298202, -0.745685, -0, 0.226201, -0.764266, -0, 0.152022, -0.775486, -0, 0.076379, -0.779238, 0, -0, -0.779238, 0, -0, -0.775486, 0, -0.076379, -0.764266, 0, -0.152022, -0.745685, 0, -0.226201, -0.719922, 0, -0.298202, -0.687227, 0, -0.367331, -0.647913, 0, -0.432922, -0.602359, 0, -0.494344, -0.551004, 0, -0.551005, -0.494343, 0, -0.60236, -0.432921, 0, -0.647913, -0.36733, 0, -0.687227, -0.298201, 0, -0.719923, -0.2262, 0, -0.745685, -0.152021, 0, -0.764266, -0.076378, 0, -0.775486, 1e-06, 0, -0.779238, 0.076379, 0, -0.775486, 0.152023, 0, -0.764265, 0.226202, 0, -0.745684, 0.298202, 0, -0.719922, 0.367331, 0, -0.687227, 0.432922, 0, -0.647913, 0.494344, 0, -0.602359, 0.551005, 0, -0.551004, 0.60236, 0, -0.494343, 0.647913, 0, -0.432921, 0.687227, 0, -0.36733, 0.719923, 0, -0.298201, 0.745685, 0, -0.226201, 0.764266, 0, -0.152022, 0.775486, 0, -0.076379, 0.779238, 0, -0, 0.775486, -0, 0.076378, 0.764266, -0, 0.152021, 0.745685, -0, 0.2262, 0.719923, -0, 0.298201, 0.687227, -0, 0.367329, 0.647914, -0, 0.432921, 0.60236, -0, 0.494343, 0.551006, -0, 0.551004, 0.494345, -0, 0.602358, 0.432923, -0, 0.647912, 0.367332, -0, 0.687226, 0.298204, -0, 0.719922, 0.226203, -0, 0.745684, 0.152024, -0, 0.764265, 0.076381, -0, 0.775486, -0.067845, -0, 0.688847, 0, -0, 0.69218, -0.135037, -0, 0.678879, -0.200929, -0, 0.662374, -0.264886, -0, 0.63949, -0.326291, -0, 0.610448, -0.384554, -0, 0.575526, -0.439114, -0, 0.535062, -0.489445, -0, 0.489445, -0.535062, -0, 0.439114, -0.575526, -0, 0.384554, -0.610448, -0, 0.326291, -0.63949, -0, 0.264886, -0.662374, -0, 0.200929, -0.678879, -0, 0.135037, -0.688846, -0, 0.067845, -0.69218, 0, -0, -0.688846, 0, -0.067846, -0.69218, 0, -0, -0.678879, 0, -0.135038, -0.662374, 0, -0.200929, -0.63949, 0, -0.264886, -0.610448, 0, -0.326291, -0.575526, 0, -0.384555, -0.535062, 0, -0.439114, -0.489445, 0, -0.489445, -0.439114, 0, -0.535062, -0.384554, 0, -0.575526, -0.326291, 0, -0.610448, -0.264885, 0, -0.639491, -0.200929, 0, -0.662375, -0.135037, 0, -0.67888, -0.067845, 0, -0.688847, 1e-06, 0, -0.69218, 0.067846, 0, -0.688847, 0.135038, 0, -0.678879, 0.20093, 0, -0.662374, 0.264886, 0, -0.63949, 0.326292, 0, -0.610448, 0.384555, 0, -0.575526, 0.439115, 0, -0.535062, 0.489445, 0, -0.489444, 0.535062, 0, -0.439114, 0.575527, 0, -0.384554, 0.610448, 0, -0.326291, 0.639491, 0, -0.264885, 0.662375, 0, -0.200929, 0.67888, 0, -0.135038, 0.688847, 0, -0.067846, 0.69218, 0, -0, 0.688847, -0, 0.067845, 0.67888, -0, 0.135037, 0.662375, -0, 0.200928, 0.639491, -0, 0.264885, 0.610448, -0, 0.32629, 0.575527, -0, 0.384553, 0.535063, -0, 0.439113, 0.489446, -0, 0.489444, 0.439115, -0, 0.535061, 0.384556, -0, 0.575525, 0.326293, -0, 0.610447, 0.264887, -0, 0.63949, 0.200931, -0, 0.662374, 0.13504, -0, 0.678879, 0.067848, -0, 0.688846, 0.564372, 0.173483, -0.463167, 0.524785, 0.173483, -0.506845, 0.524785, 0.101548, -0.506845, 0.564372, 0.101548, -0.463167, 0.607053, 0.101548, -0.405619, 0.607053, 0.173483, -0.405619, 0.643887, 0.173483, -0.344164, 0.643887, 0.173483, -0.344164, 0.643887, 0.101548, -0.344164, 0.674521, 0.173483, -0.279395, 0.643887, 0.173483, -0.344164, 0.674521, 0.101548, -0.279395, 0.698658, 0.173483, -0.211935, 0.698658, 0.101548, -0.211935, 0.716067, 0.173483, -0.142435, 0.716067, 0.101548, -0.142435, 0.72658, 0.101548, -0.071562, 0.72658, 0.173483, -0.071562, 0.729473, 0.101548, -0.012685, 0.729473, 0.173483, -0.012685, 0.51752, 0.200243, -0.49958, 0.55643, 0.200243, -0.456649, 0.59851, 0.200243, -0.399911, 0.643887, 0.173483, -0.344164, 0.634826, 0.200243, -0.339321, 0.643887, 0.173483, -0.344164, 0.665029, 0.200243, -0.275464, 0.643887, 0.173483, -0.344164, 0.688827, 0.200243, -0.208953, 0.705991, 0.200243, -0.14043, 0.716356, 0.200243, -0.070555, 0.719199, 0.200243, -0.012685, 0.50283, 0.220079, -0.48489, 0.540371, 0.220079, -0.44347, 0.581236, 0.220079, -0.388369, 0.616504, 0.220079, -0.329528, 0.645835, 0.220079, -0.267513, 0.668946, 0.220079, -0.202922, 0.685614, 0.220079, -0.136377, 0.69568, 0.220079, -0.068519, 0.698423, 0.220079, -0.012685, 0.481081, 0.239572, -0.463141, 0.516594, 0.239572, -0.423957, 0.555662, 0.239572, -0.371281, 0.589378, 0.239572, -0.315029, 0.617418, 0.239572, -0.255743, 0.639512, 0.239572, -0.193994, 0.655447, 0.239572, -0.130377, 0.66507, 0.239572, -0.065504, 0.698423, 0.220079, -0.012685, 0.698423, 0.220079, -0.012685, 0.667665, 0.239572, -0.012685, 0.447057, 0.259465, -0.429117, 0.515654, 0.259465, -0.344548, 0.572964, 0.259465, -0.237329, 0.608255, 0.259465, -0.120989, 0.619549, 0.259465, -0.012685, 0.375955, 0.288001, -0.358015, 0.432047, 0.288001, -0.288684, 0.480065, 0.288001, -0.198849, 0.509634, 0.288001, -0.101372, 0.518995, 0.288001, -0.012685, 0.269204, 0.314284, -0.251265, 0.306522, 0.314284, -0.204811, 0.340589, 0.314284, -0.141076, 0.361567, 0.314284, -0.07192, 0.368027, 0.314284, -0.012685, 0.216096, 0.322078, -0.198156, 0.244073, 0.322078, -0.163084, 0.271199, 0.322078, -0.112334, 0.287904, 0.322078, -0.057268, 0.292921, 0.322078, -0.012685, 0.207164, 0.120187, -0.189224, 0.207164, 0.310689, -0.189224, 0.23357, 0.310689, -0.156066, 0.23357, 0.120187, -0.156066, 0.259529, 0.310689, -0.1075, 0.259529, 0.120187, -0.1075, 0.275514, 0.310689, -0.054803, 0.275514, 0.120187, -0.054803, 0.280289, 0.310689, -0.012685, 0.280289, 0.120187, -0.012685, 0.492194, 0.167505, -0.494447, 0.506846, 0.101548, -0.507726, 0.507002, 0.171184, -0.507867, 0.49179, 0.101548, -0.49408, 0.69766, 0.167505, 0.001593, 0.717411, 0.101548, 0.000623, 0.697116, 0.101548, 0.00162, 0.69766, 0.167505, 0.001593, 0.717621, 0.171184, 0.000613, 0.501137, 0.193249, -0.501871, 0.48857, 0.182058, -0.490481, 0.692294, 0.182058, 0.001352, 0.69766, 0.167505, 0.001593, 0.709234, 0.193249, 0.00052, 0.479174, 0.194127, -0.480589, 0.488483, 0.210097, -0.489027, 0.691204, 0.210097, 0.000385, 0.678655, 0.194127, 0.001001, 0.461225, 0.210304, -0.462284, 0.468195, 0.228315, -0.468602, 0.662416, 0.228315, 0.000288, 0.65302, 0.210304, 0.00075, 0.430453, 0.228295, -0.431208, 0.435423, 0.247477, -0.435712, 0.615985, 0.247477, 0.000205, 0.609287, 0.228295, 0.000534, 0.361937, 0.255822, -0.36245, 0.365315, 0.275624, -0.365511, 0.516772, 0.275624, 0.00014, 0.512218, 0.255822, 0.000363, 0.257283, 0.281583, -0.2576, 0.259371, 0.301706, -0.259492, 0.366891, 0.301706, 8.6e-05, 0.364077, 0.281583, 0.000224, 0.204816, 0.313814, -0.204236, 0.214706, 0.298492, -0.2132, 0.302575, 0.298492, -0.001065, 0.289244, 0.313814, -0.00041, 0.208045, 0.120187, -0.207163, 0.214706, 0.298492, -0.2132, 0.204816, 0.313814, -0.204236, 0.223101, 0.120187, -0.220809, 0.293597, 0.120187, -0.000623, 0.289244, 0.313814, -0.00041, 0.302575, 0.298492, -0.001065, 0.313892, 0.120187, -0.00162, 0.698423, 0.220079, -0.012685, 0.698423, 0.220079, -0.012685, 0.698423, 0.220079, -0.012685, 0.698423, 0.220079, -0.012685, 0.071562, 0.173483, -0.72658, 0.012685, 0.173483, -0.729473, 0.012685, 0.101548, -0.729473, 0.071562, 0.101548, -0.72658, 0.142435, 0.101548, -0.716067, 0.142435, 0.173483, -0.716067, 0.211936, 0.173483, -0.698658, 0.211936, 0.101548, -0.698658, 0.279395, 0.173483, -0.674521, 0.279395, 0.101548, -0.674521, 0.344164, 0.173483, -0.643887, 0.344164, 0.173483, -0.643887, 0.344164, 0.101548, -0.643887, 0.405619, 0.173483, -0.607053, 0.344164, 0.173483, -0.643887, 0.405619, 0.101548, -0.607053, 0.463167, 0.101548, -0.564372, 0.463167, 0.173483, -0.564372, 0.506845, 0.173483, -0.524785, 0.506845, 0.101548, -0.524785, 0.070555, 0.200243, -0.716356, 0.012685, 0.200243, -0.719199, 0.140431, 0.200243, -0.705991, 0.208953, 0.200243, -0.688827, 0.275464, 0.200243, -0.665029, 0.339321, 0.200243, -0.634826, 0.344164, 0.173483, -0.643887, 0.399911, 0.200243, -0.59851, 0.344164, 0.173483, -0.643887, 0.344164, 0.173483, -0.643887, 0.45665, 0.200243, -0.55643, 0.49958, 0.200243, -0.51752, 0.012685, 0.220079, -0.698423, 0.068519, 0.220079, -0.69568, 0.136377, 0.220079, -0.685614, 0.202923, 0.220079, -0.668946, 0.267513, 0.220079, -0.645835, 0.267513, 0.220079, -0.645835, 0.329528, 0.220079, -0.616504, 0.267513, 0.220079, -0.645835, 0.388369, 0.220079, -0.581236, 0.44347, 0.220079, -0.540371, 0.48489, 0.220079, -0.50283, 0.065504, 0.239572, -0.66507, 0.012685, 0.239572, -0.667665, 0.130377, 0.239572, -0.655447, 0.193994, 0.239572, -0.639512, 0.255743, 0.239572, -0.617418, 0.267513, 0.220079, -0.645835, 0.315029, 0.239572, -0.589378, 0.267513, 0.220079, -0.645835, 0.267513, 0.220079, -0.645835, 0.371281, 0.239572, -0.555662, 0.423957, 0.239572, -0.516594, 0.463141, 0.239572, -0.481081, 0.012685, 0.259465, -0.619549, 0.12099, 0.259465, -0.608255, 0.237329, 0.259465, -0.572964, 0.344549, 0.259465, -0.515654, 0.429117, 0.259465, -0.447057, 0.012685, 0.288001, -0.518995, 0.101373, 0.288001, -0.509634, 0.198849, 0.288001, -0.480064, 0.288684, 0.288001, -0.432047, 0.358015, 0.288001, -0.375955, 0.012685, 0.314284, -0.368027, 0.07192, 0.314284, -0.361567, 0.141076, 0.314284, -0.340589, 0.204811, 0.314284, -0.306522, 0.251265, 0.314284, -0.269204, 0.012685, 0.322078, -0.292921, 0.057268, 0.322078, -0.287904, 0.112334, 0.322078, -0.271199, 0.163084, 0.322078, -0.244073, 0.198157, 0.322078, -0.216096, 0.012685, 0.120187, -0.280289, 0.012685, 0.310689, -0.280289, 0.054803, 0.310689, -0.275514, 0.054803, 0.120187, -0.275514, 0.1075, 0.120187, -0.259529, 0.1075, 0.310689, -0.259529, 0.156066, 0.120187, -0.23357, 0.156066, 0.310689, -0.23357, 0.189224, 0.120187, -0.207164, 0.189224, 0.310689, -0.207164, -0.001593, 0.167505, -0.697661, -0.000623, 0.101548, -0.717411, -0.000612, 0.171184, -0.717621, -0.00162, 0.101548, -0.697115, 0.494447, 0.167505, -0.492194, 0.507726, 0.101548, -0.506846, 0.49408, 0.101548, -0.49179, 0.507867, 0.171184, -0.507002, -0.001352, 0.182058, -0.692294, -0.00052, 0.193249, -0.709234, 0.490481, 0.182058, -0.48857, 0.501872, 0.193249, -0.501137, -0.000385, 0.210097, -0.691204, -0.001001, 0.194127, -0.678655, 0.480589, 0.194127, -0.479174, 0.489027, 0.210097, -0.488483, -0.000288, 0.228315, -0.662416, -0.00075, 0.210304, -0.65302, 0.462285, 0.210304, -0.461225, 0.468602, 0.228315, -0.468195, -0.000205, 0.247477, -0.615985, -0.000534, 0.228295, -0.609287, 0.431208, 0.228295, -0.430453, 0.435712, 0.247477, -0.435422, -0.000139, 0.275624, -0.516772, -0.000363, 0.255822, -0.512218, 0.36245, 0.255822, -0.361937, 0.365511, 0.275624, -0.365315, -8.6e-05, 0.301706, -0.366891, -0.000224, 0.281583, -0.364077, 0.2576, 0.281583, -0.257283, 0.259492, 0.301706, -0.259371, 0.00041, 0.313814, -0.289244, 0.001065, 0.298492, -0.302575, 0.2132, 0.298492, -0.214706, 0.204237, 0.313814, -0.204816, 0.000624, 0.120187, -0.293596, 0.001065, 0.298492, -0.302575, 0.00041, 0.313814, -0.289244, 0.001621, 0.120187, -0.313892, 0.207163, 0.120187, -0.208045, 0.204237, 0.313814, -0.204816, 0.2132, 0.298492, -0.214706, 0.220809, 0.120187, -0.223101, -0.463167, 0.173483, -0.564372, -0.506845, 0.173483, -0.524785, -0.506845, 0.101548, -0.524785, -0.463167, 0.101548, -0.564372, -0.405619, 0.101548, -0.607053, -0.405619, 0.173483, -0.607053, -0.344165, 0.173483, -0.643887, -0.344165, 0.101548, -0.643887, -0.279396, 0.173483, -0.67452, -0.279396, 0.101548, -0.67452, -0.211936, 0.173483, -0.698658, -0.211936, 0.101548, -0.698658, -0.142435, 0.173483, -0.716067, -0.142435, 0.101548, -0.716067, -0.071562, 0.101548, -0.72658, -0.071562, 0.173483, -0.72658, -0.012685, 0.101548, -0.729473, -0.012685, 0.173483, -0.729473, -0.49958, 0.200243, -0.51752, -0.45665, 0.200243, -0.55643, -0.399911, 0.200243, -0.59851, -0.339322, 0.200243, -0.634826, -0.275464, 0.200243, -0.665029, -0.208953, 0.200243, -0.688827, -0.140431, 0.200243, -0.705991, -0.070555, 0.200243, -0.716356, -0.012685, 0.200243, -0.719199, -0.48489, 0.220079, -0.50283, -0.44347, 0.220079, -0.540371, -0.388369, 0.220079, -0.581236, -0.329528, 0.220079, -0.616504, -0.267514, 0.220079, -0.645835, -0.202923, 0.220079, -0.668946, -0.136377, 0.220079, -0.685614, -0.068519, 0.220079, -0.69568, -0.012685, 0.220079, -0.698423, -0.463141, 0.239572, -0.481081, -0.423957, 0.239572, -0.516594, -0.371281, 0.239572, -0.555662, -0.315029, 0.239572, -0.589378, -0.255743, 0.239572, -0.617418, -0.193994, 0.239572, -0.639512, -0.130377, 0.239572, -0.655447, -0.065504, 0.239572, -0.66507, -0.012685, 0.239572, -0.667665, -0.429117, 0.259465, -0.447057, -0.344549, 0.259465, -0.515654, -0.237329, 0.259465, -0.572964, -0.12099, 0.259465, -0.608255, -0.012685, 0.259465, -0.619549, -0.358015, 0.288001, -0.375955, -0.288684, 0.288001, -0.432047, -0.198849, 0.288001, -0.480064, -0.101373, 0.288001, -0.509634, -0.012685, 0.288001, -0.518995, -0.251265, 0.314284, -0.269204, -0.204811, 0.314284, -0.306522, -0.141076, 0.314284, -0.340589, -0.07192, 0.314284, -0.361567, -0.012685, 0.314284, -0.368027, -0.198156, 0.322078, -0.216096, -0.163084, 0.322078, -0.244073, -0.112334, 0.322078, -0.271199, -0.057268, 0.322078, -0.287904, -0.012685, 0.322078, -0.292921, -0.189224, 0.120187, -0.207164, -0.189224, 0.310689, -0.207164, -0.156066, 0.310689, -0.23357, -0.156066, 0.120187, -0.23357, -0.1075, 0.310689, -0.259529, -0.1075, 0.120187, -0.259529, -0.054803, 0.310689, -0.275514, -0.054803, 0.120187, -0.275514, -0.012685, 0.310689, -0.280289, -0.012685, 0.120187, -0.280289, -0.494447, 0.167505, -0.492194, -0.507726, 0.101548, -0.506846, -0.507867, 0.171184, -0.507001, -0.49408, 0.101548, -0.49179, 0.001593, 0.167505, -0.69766, 0.000622, 0.101548, -0.717411, 0.00162, 0.101548, -0.697116, 0.001593, 0.167505, -0.69766, 0.000612, 0.171184, -0.717621, -0.501872, 0.193249, -0.501137, -0.490481, 0.182058, -0.48857, 0.001352, 0.182058, -0.692294, 0.001593, 0.167505, -0.69766, 0.000519, 0.193249, -0.709234, -0.480589, 0.194127, -0.479174, -0.489027, 0.210097, -0.488483, 0.000385, 0.210097, -0.691204, 0.001001, 0.194127, -0.678655, -0.462285, 0.210304, -0.461225, -0.468602, 0.228315, -0.468195, 0.000288, 0.228315, -0.662416, 0.000749, 0.210304, -0.65302, -0.431208, 0.228295, -0.430453, -0.435712, 0.247477, -0.435422, 0.000205, 0.247477, -0.615985, 0.000534, 0.228295, -0.609287, -0.36245, 0.255822, -0.361936, -0.365511, 0.275624, -0.365315, 0.000139, 0.275624, -0.516772, 0.000363, 0.255822, -0.512218, -0.2576, 0.281583, -0.257283, -0.259492, 0.301706, -0.259371, 8.6e-05, 0.301706, -0.366891, 0.000224, 0.281583, -0.364077, -0.204237, 0.313814, -0.204816, -0.2132, 0.298492, -0.214706, -0.001065, 0.298492, -0.302575, -0.00041, 0.313814, -0.289244, -0.207163, 0.120187, -0.208045, -0.2132, 0.298492, -0.214706, -0.204237, 0.313814, -0.204816, -0.220809, 0.120187, -0.223101, -0.000624, 0.120187, -0.293597, -0.00041, 0.313814, -0.289244, -0.001065, 0.298492, -0.302575, -0.001621, 0.120187, -0.313892, -0.72658, 0.173483, -0.071563, -0.729473, 0.173483, -0.012686, -0.729473, 0.101548, -0.012686, -0.72658, 0.101548, -0.071563, -0.716067, 0.101548, -0.142435, -0.716067, 0.173483, -0.142435, -0.698658, 0.173483, -0.211936, -0.698658, 0.101548, -0.211936, -0.67452, 0.173483, -0.279396, -0.67452, 0.101548, -0.279396, -0.643887, 0.173483, -0.344165, -0.643887, 0.173483, -0.344165, -0.643887, 0.101548, -0.344165, -0.607052, 0.173483, -0.405619, -0.643887, 0.173483, -0.344165, -0.607052, 0.101548, -0.405619, -0.564372, 0.101548, -0.463168, -0.564372, 0.173483, -0.463168, -0.524785, 0.173483, -0.506845, -0.524785, 0.101548, -0.506845, -0.716356, 0.200243, -0.070556, -0.719199, 0.200243, -0.012686, -0.70599, 0.200243, -0.140431, -0.688827, 0.200243, -0.208954, -0.665029, 0.200243, -0.275464, -0.634826, 0.200243, -0.339322, -0.643887, 0.173483, -0.344165, -0.59851, 0.200243, -0.399912, -0.643887, 0.173483, -0.344165, -0.643887, 0.173483, -0.344165, -0.55643, 0.200243, -0.45665, -0.51752, 0.200243, -0.499581, -0.698423, 0.220079, -0.012686, -0.69568, 0.220079, -0.068519, -0.685614, 0.220079, -0.136378, -0.668946, 0.220079, -0.202923, -0.645835, 0.220079, -0.267514, -0.616504, 0.220079, -0.329528, -0.581236, 0.220079, -0.388369, -0.54037, 0.220079, -0.44347, -0.50283, 0.220079, -0.48489, -0.667665, 0.239572, -0.012686, -0.66507, 0.239572, -0.065504, -0.655447, 0.239572, -0.130377, -0.639512, 0.239572, -0.193994, -0.617418, 0.239572, -0.255743, -0.589378, 0.239572, -0.315029, -0.555661, 0.239572, -0.371281, -0.516594, 0.239572, -0.423958, -0.48108, 0.239572, -0.463141, -0.619549, 0.259465, -0.012686, -0.608255, 0.259465, -0.12099, -0.572964, 0.259465, -0.23733, -0.515654, 0.259465, -0.344549, -0.447057, 0.259465, -0.429117, -0.518995, 0.288001, -0.012686, -0.509634, 0.288001, -0.101373, -0.480064, 0.288001, -0.198849, -0.432047, 0.288001, -0.288684, -0.375954, 0.288001, -0.358015, -0.368027, 0.314284, -0.012685, -0.361567, 0.314284, -0.071921, -0.340589, 0.314284, -0.141077, -0.306522, 0.314284, -0.204811, -0.269204, 0.314284, -0.251265, -0.292921, 0.322078, -0.012685, -0.287904, 0.322078, -0.057268, -0.271199, 0.322078, -0.112335, -0.244073, 0.322078, -0.163084, -0.216096, 0.322078, -0.198157, -0.280289, 0.120187, -0.012685, -0.280289, 0.310689, -0.012685, -0.275514, 0.310689, -0.054804, -0.275514, 0.120187, -0.054804, -0.259529, 0.120187, -0.1075, -0.259529, 0.310689, -0.1075, -0.23357, 0.120187, -0.156066, -0.23357, 0.310689, -0.156066, -0.207164, 0.120187, -0.189224, -0.207164, 0.310689, -0.189224, -0.697661, 0.167505, 0.001593, -0.717411, 0.101548, 0.000622, -0.717621, 0.171184, 0.000612, -0.697661, 0.167505, 0.001593, -0.697115, 0.101548, 0.001619, -0.492194, 0.167505, -0.494447, -0.506846, 0.101548, -0.507727, -0.49179, 0.101548, -0.49408, -0.507001, 0.171184, -0.507868, -0.692294, 0.182058, 0.001351, -0.697661, 0.167505, 0.001593, -0.709234, 0.193249, 0.000519, -0.48857, 0.182058, -0.490482, -0.501137, 0.193249, -0.501872, -0.691204, 0.210097, 0.000384, -0.678655, 0.194127, 0.001001, -0.479174, 0.194127, -0.48059, -0.488483, 0.210097, -0.489027, -0.662416, 0.228315, 0.000288, -0.65302, 0.210304, 0.000749, -0.461224, 0.210304, -0.462285, -0.468195, 0.228315, -0.468602, -0.615985, 0.247477, 0.000205, -0.609287, 0.228295, 0.000534, -0.430453, 0.228295, -0.431209, -0.435422, 0.247477, -0.435713, -0.516772, 0.275624, 0.000139, -0.512218, 0.255822, 0.000363, -0.361936, 0.255822, -0.36245, -0.365314, 0.275624, -0.365512, -0.366891, 0.301706, 8.6e-05, -0.364077, 0.281583, 0.000224, -0.257283, 0.281583, -0.2576, -0.259371, 0.301706, -0.259492, -0.289244, 0.313814, -0.00041, -0.302575, 0.298492, -0.001065, -0.214706, 0.298492, -0.2132, -0.204816, 0.313814, -0.204237, -0.293596, 0.120187, -0.000624, -0.302575, 0.298492, -0.001065, -0.289244, 0.313814, -0.00041, -0.313892, 0.120187, -0.001621, -0.208045, 0.120187, -0.207163, -0.204816, 0.313814, -0.204237, -0.214706, 0.298492, -0.2132, -0.223101, 0.120187, -0.220809, -0.564372, 0.173483, 0.463167, -0.524785, 0.173483, 0.506845, -0.524785, 0.101548, 0.506845, -0.564372, 0.101548, 0.463167, -0.607053, 0.101548, 0.405619, -0.607053, 0.173483, 0.405619, -0.643887, 0.173483, 0.344164, -0.643887, 0.173483, 0.344164, -0.643887, 0.101548, 0.344164, -0.674521, 0.173483, 0.279395, -0.643887, 0.173483, 0.344164, -0.674521, 0.101548, 0.279395, -0.698658, 0.173483, 0.211936, -0.698658, 0.101548, 0.211936, -0.716067, 0.173483, 0.142435, -0.716067, 0.101548, 0.142435, -0.72658, 0.101548, 0.071562, -0.72658, 0.173483, 0.071562, -0.729473, 0.101548, 0.012685, -0.729473, 0.173483, 0.012685, -0.51752, 0.200243, 0.49958, -0.55643, 0.200243, 0.45665, -0.59851, 0.200243, 0.399911, -0.643887, 0.173483, 0.344164, -0.634826, 0.200243, 0.339321, -0.643887, 0.173483, 0.344164, -0.665029, 0.200243, 0.275464, -0.643887, 0.173483, 0.344164, -0.688827, 0.200243, 0.208953, -0.705991, 0.200243, 0.14043, -0.716356, 0.200243, 0.070555, -0.719199, 0.200243, 0.012685, -0.50283, 0.220079, 0.48489, -0.540371, 0.220079, 0.44347, -0.581236, 0.220079, 0.388369, -0.616504, 0.220079, 0.329528, -0.645835, 0.220079, 0.267513, -0.668946, 0.220079, 0.202922, -0.685614, 0.220079, 0.136377, -0.69568, 0.220079, 0.068519, -0.698423, 0.220079, 0.012685, -0.481081, 0.239572, 0.463141, -0.516594, 0.239572, 0.423957, -0.555662, 0.239572, 0.371281, -0.589378, 0.239572, 0.315029, -0.617418, 0.239572, 0.255743, -0.639512, 0.239572, 0.193994, -0.655447, 0.239572, 0.130377, -0.66507, 0.239572, 0.065504, -0.698423, 0.220079, 0.012685, -0.667665, 0.239572, 0.012685, -0.698423, 0.220079, 0.012685, -0.447057, 0.259465, 0.429117, -0.515654, 0.259465, 0.344548, -0.572964, 0.259465, 0.237329, -0.608255, 0.259465, 0.12099, -0.619549, 0.259465, 0.012685, -0.375955, 0.288001, 0.358015, -0.432047, 0.288001, 0.288684, -0.480064, 0.288001, 0.198849, -0.509634, 0.288001, 0.101373, -0.518995, 0.288001, 0.012685, -0.269204, 0.314284, 0.251265, -0.306522, 0.314284, 0.204811, -0.340589, 0.314284, 0.141076, -0.361567, 0.314284, 0.07192, -0.368027, 0.314284, 0.012685, -0.216096, 0.322078, 0.198156, -0.244073, 0.322078, 0.163084, -0.271199, 0.322078, 0.112334, -0.287904, 0.322078, 0.057268, -0.292921, 0.322078, 0.012685, -0.207164, 0.120187, 0.189224, -0.207164, 0.310689, 0.189224, -0.23357, 0.310689, 0.156066, -0.23357, 0.120187, 0.156066, -0.259529, 0.310689, 0.1075, -0.259529, 0.120187, 0.1075, -0.275514, 0.310689, 0.054803, -0.275514, 0.120187, 0.054803, -0.280289, 0.310689, 0.012685, -0.280289, 0.120187, 0.012685, -0.492194, 0.167505, 0.494447, -0.506846, 0.101548, 0.507726, -0.507002, 0.171184, 0.507867, -0.49179, 0.101548, 0.49408, -0.69766, 0.167505, -0.001593, -0.717411, 0.101548, -0.000623, -0.697116, 0.101548, -0.00162, -0.69766, 0.167505, -0.001593, -0.717621, 0.171184, -0.000612, -0.501137, 0.193249, 0.501871, -0.48857, 0.182058, 0.490481, -0.692294, 0.182058, -0.001352, -0.69766, 0.167505, -0.001593, -0.709234, 0.193249, -0.00052, -0.479174, 0.194127, 0.480589, -0.488483, 0.210097, 0.489027, -0.691204, 0.210097, -0.000385, -0.678655, 0.194127, -0.001001, -0.461225, 0.210304, 0.462284, -0.468195, 0.228315, 0.468602, -0.662416, 0.228315, -0.000288, -0.65302, 0.210304, -0.00075, -0.430453, 0.228295, 0.431208, -0.435423, 0.247477, 0.435712, -0.615985, 0.247477, -0.000205, -0.609287, 0.228295, -0.000534, -0.361937, 0.255822, 0.36245, -0.365315, 0.275624, 0.365511, -0.516772, 0.275624, -0.000139, -0.512218, 0.255822, -0.000363, -0.257283, 0.281583, 0.2576, -0.259371, 0.301706, 0.259492, -0.366891, 0.301706, -8.6e-05, -0.364077, 0.281583, -0.000224, -0.204816, 0.313814, 0.204236, -0.214706, 0.298492, 0.2132, -0.302575, 0.298492, 0.001065, -0.289244, 0.313814, 0.00041, -0.208045, 0.120187, 0.207163, -0.214706, 0.298492, 0.2132, -0.204816, 0.313814, 0.204236, -0.223101, 0.120187, 0.220809, -0.293597, 0.120187, 0.000623, -0.289244, 0.313814, 0.00041, -0.302575, 0.298492, 0.001065, -0.313892, 0.120187, 0.001621, -0.698423, 0.220079, 0.012685, -0.698423, 0.220079, 0.012685, -0.698423, 0.220079, 0.012685, -0.698423, 0.220079, 0.012685, -0.071563, 0.173483, 0.72658, -0.012686, 0.173483, 0.729473, -0.012686, 0.101548, 0.729473, -0.071563, 0.101548, 0.72658, -0.142435, 0.101548, 0.716067, -0.142435, 0.173483, 0.716067, -0.211936, 0.173483, 0.698658, -0.211936, 0.101548, 0.698658, -0.279396, 0.173483, 0.67452, -0.279396, 0.101548, 0.67452, -0.344165, 0.173483, 0.643887, -0.344165, 0.101548, 0.643887, -0.405619, 0.173483, 0.607052, -0.405619, 0.101548, 0.607052, -0.463168, 0.101548, 0.564372, -0.463168, 0.173483, 0.564372, -0.506845, 0.173483, 0.524785, -0.506845, 0.101548, 0.524785, -0.070556, 0.200243, 0.716356, -0.012686, 0.200243, 0.719199, -0.140431, 0.200243, 0.70599, -0.208954, 0.200243, 0.688826, -0.275464, 0.200243, 0.665029, -0.339322, 0.200243, 0.634826, -0.399912, 0.200243, 0.59851, -0.45665, 0.200243, 0.55643, -0.499581, 0.200243, 0.51752, -0.012686, 0.220079, 0.698423, -0.068519, 0.220079, 0.69568, -0.136378, 0.220079, 0.685614, -0.202923, 0.220079, 0.668946, -0.267514, 0.220079, 0.645835, -0.329528, 0.220079, 0.616504, -0.388369, 0.220079, 0.581236, -0.44347, 0.220079, 0.54037, -0.48489, 0.220079, 0.50283, -0.012686, 0.239572, 0.667665, -0.065505, 0.239572, 0.66507, -0.130377, 0.239572, 0.655447, -0.193994, 0.239572, 0.639512, -0.255743, 0.239572, 0.617418, -0.315029, 0.239572, 0.589378, -0.371281, 0.239572, 0.555661, -0.423958, 0.239572, 0.516594, -0.463141, 0.239572, 0.48108, -0.012686, 0.259465, 0.619549, -0.12099, 0.259465, 0.608255, -0.23733, 0.259465, 0.572964, -0.344549, 0.259465, 0.515654, -0.429117, 0.259465, 0.447057, -0.012686, 0.288001, 0.518995, -0.101373, 0.288, 0.509634, -0.198849, 0.288, 0.480064, -0.288684, 0.288, 0.432047, -0.358015, 0.288, 0.375954, -0.012685, 0.314284, 0.368027, -0.071921, 0.314284, 0.361567, -0.141077, 0.314284, 0.340589, -0.204811, 0.314284, 0.306522, -0.251265, 0.314284, 0.269204, -0.012685, 0.322078, 0.292921, -0.057268, 0.322078, 0.287903, -0.112335, 0.322078, 0.271199, -0.163084, 0.322078, 0.244073, -0.198157, 0.322078, 0.216096, -0.012685, 0.120187, 0.280289, -0.012685, 0.310689, 0.280289, -0.054804, 0.310689, 0.275514, -0.054804, 0.120187, 0.275514, -0.1075, 0.120187, 0.259529, -0.1075, 0.310689, 0.259529, -0.156066, 0.120187, 0.23357, -0.156066, 0.310689, 0.23357, -0.189224, 0.120187, 0.207164, -0.189224, 0.310689, 0.207164, 0.001593, 0.167505, 0.697661, 0.000622, 0.101548, 0.717411, 0.000612, 0.171184, 0.717621, 0.001593, 0.167505, 0.697661, 0.001619, 0.101548, 0.697115, -0.494447, 0.167505, 0.492194, -0.507727, 0.101548, 0.506846, -0.494081, 0.101548, 0.49179, -0.507868, 0.171184, 0.507001, 0.001351, 0.182058, 0.692294, 0.001593, 0.167505, 0.697661, 0.000519, 0.193249, 0.709234, -0.490482, 0.182058, 0.48857, -0.501872, 0.193249, 0.501137, 0.000384, 0.210097, 0.691204, 0.001001, 0.194127, 0.678655, -0.48059, 0.194127, 0.479173, -0.489027, 0.210097, 0.488483, 0.000288, 0.228315, 0.662416, 0.000749, 0.210304, 0.65302, -0.462285, 0.210304, 0.461224, -0.468602, 0.228315, 0.468195, 0.000205, 0.247477, 0.615985, 0.000534, 0.228295, 0.609287, -0.431209, 0.228295, 0.430453, -0.435713, 0.247477, 0.435422, 0.000139, 0.275624, 0.516772, 0.000363, 0.255822, 0.512218, -0.36245, 0.255822, 0.361936, -0.365512, 0.275624, 0.365314, 8.6e-05, 0.301706, 0.366891, 0.000224, 0.281583, 0.364077, -0.2576, 0.281583, 0.257283, -0.259492, 0.301706, 0.259371, -0.00041, 0.313814, 0.289244, -0.001065, 0.298492, 0.302575, -0.2132, 0.298492, 0.214706, -0.204237, 0.313814, 0.204816, -0.000624, 0.120187, 0.293596, -0.001065, 0.298492, 0.302575, -0.00041, 0.313814, 0.289244, -0.001621, 0.120187, 0.313892, -0.207163, 0.120187, 0.208045, -0.204237, 0.313814, 0.204816, -0.2132, 0.298492, 0.214706, -0.220809, 0.120187, 0.223101, 0.463167, 0.173483, 0.564372, 0.506845, 0.173483, 0.524785, 0.506845, 0.101548, 0.524785, 0.463167, 0.101548, 0.564372, 0.405619, 0.101548, 0.607053, 0.405619, 0.173483, 0.607053, 0.344164, 0.173483, 0.643887, 0.344164, 0.173483, 0.643887, 0.344164, 0.101548, 0.643887, 0.279395, 0.173483, 0.674521, 0.344164, 0.173483, 0.643887, 0.279395, 0.101548, 0.674521, 0.211936, 0.173483, 0.698658, 0.211936, 0.101548, 0.698658, 0.142435, 0.173483, 0.716067, 0.142435, 0.101548, 0.716067, 0.071562, 0.101548, 0.72658, 0.071562, 0.173483, 0.72658, 0.012685, 0.101548, 0.729473, 0.012685, 0.173483, 0.729473, 0.49958, 0.200243, 0.51752, 0.45665, 0.200243, 0.55643, 0.399911, 0.200243, 0.59851, 0.344164, 0.173483, 0.643887, 0.339321, 0.200243, 0.634826, 0.344164, 0.173483, 0.643887, 0.275464, 0.200243, 0.665029, 0.344164, 0.173483, 0.643887, 0.208953, 0.200243, 0.688827, 0.14043, 0.200243, 0.705991, 0.070555, 0.200243, 0.716356, 0.012685, 0.200243, 0.719199, 0.48489, 0.220079, 0.50283, 0.44347, 0.220079, 0.540371, 0.388369, 0.220079, 0.581236, 0.329528, 0.220079, 0.616504, 0.267513, 0.220079, 0.645835, 0.202922, 0.220079, 0.668946, 0.136377, 0.220079, 0.685614, 0.068519, 0.220079, 0.69568, 0.012685, 0.220079, 0.698423, 0.463141, 0.239572, 0.481081, 0.423957, 0.239572, 0.516594, 0.371281, 0.239572, 0.555662, 0.315029, 0.239572, 0.589378, 0.255743, 0.239572, 0.617418, 0.193994, 0.239572, 0.639512, 0.130377, 0.239572, 0.655447, 0.065504, 0.239572, 0.66507, 0.012685, 0.239572, 0.667665, 0.429117, 0.259465, 0.447057, 0.344548, 0.259465, 0.515654, 0.237329, 0.259465, 0.572964, 0.12099, 0.259465, 0.608255, 0.012685, 0.259465, 0.619549, 0.358015, 0.288001, 0.375955, 0.288684, 0.288, 0.432047, 0.198849, 0.288, 0.480065, 0.101372, 0.288, 0.509634, 0.012685, 0.288, 0.518995, 0.251265, 0.314284, 0.269204, 0.204811, 0.314284, 0.306522, 0.141076, 0.314284, 0.340589, 0.07192, 0.314284, 0.361567, 0.012685, 0.314284, 0.368027, 0.198156, 0.322078, 0.216096, 0.163084, 0.322078, 0.244073, 0.112334, 0.322078, 0.271199, 0.057268, 0.322078, 0.287904, 0.012685, 0.322078, 0.292921, 0.189224, 0.120187, 0.207164, 0.189224, 0.310689, 0.207164, 0.156066, 0.310689, 0.23357, 0.156066, 0.120187, 0.23357, 0.1075, 0.310689, 0.259529, 0.1075, 0.120187, 0.259529, 0.054803, 0.310689, 0.275514, 0.054803, 0.120187, 0.275514, 0.012685, 0.310689, 0.280289, 0.012685, 0.120187, 0.280289, 0.494447, 0.167505, 0.492194, 0.507726, 0.101548, 0.506846, 0.507867, 0.171184, 0.507002, 0.49408, 0.101548, 0.49179, -0.001593, 0.167505, 0.69766, -0.000623, 0.101548, 0.717411, -0.00162, 0.101548, 0.697116, -0.001593, 0.167505, 0.69766, -0.000612, 0.171184, 0.717621, 0.501871, 0.193249, 0.501137, 0.490481, 0.182058, 0.48857, -0.001352, 0.182058, 0.692294, -0.001593, 0.167505, 0.69766, -0.00052, 0.193249, 0.709234, 0.480589, 0.194127, 0.479174, 0.489027, 0.210097, 0.488483, -0.000385, 0.210097, 0.691204, -0.001001, 0.194127, 0.678655, 0.462284, 0.210304, 0.461225, 0.468602, 0.228315, 0.468195, -0.000288, 0.228315, 0.662416, -0.00075, 0.210304, 0.65302, 0.431208, 0.228295, 0.430453, 0.435712, 0.247477, 0.435423, -0.000205, 0.247477, 0.615985, -0.000534, 0.228295, 0.609287, 0.36245, 0.255822, 0.361937, 0.365511, 0.275624, 0.365315, -0.000139, 0.275624, 0.516772, -0.000363, 0.255822, 0.512218, 0.2576, 0.281583, 0.257283, 0.259492, 0.301706, 0.259371, -8.6e-05, 0.301706, 0.366891, -0.000224, 0.281583, 0.364077, 0.204236, 0.313814, 0.204816, 0.2132, 0.298492, 0.214706, 0.001065, 0.298492, 0.302575, 0.00041, 0.313814, 0.289244, 0.207163, 0.120187, 0.208045, 0.2132, 0.298492, 0.214706, 0.204236, 0.313814, 0.204816, 0.220809, 0.120187, 0.223101, 0.000623, 0.120187, 0.293597, 0.00041, 0.313814, 0.289244, 0.001065, 0.298492, 0.302575, 0.001621, 0.120187, 0.313892, 0.72658, 0.173483, 0.071563, 0.729473, 0.173483, 0.012686, 0.729473, 0.101548, 0.012686, 0.72658, 0.101548, 0.071563, 0.716067, 0.101548, 0.142435, 0.716067, 0.173483, 0.142435, 0.698658, 0.173483, 0.211936, 0.698658, 0.101548, 0.211936, 0.67452, 0.173483, 0.279396, 0.67452, 0.101548, 0.279396, 0.643887, 0.173483, 0.344165, 0.643887, 0.101548, 0.344165, 0.607052, 0.173483, 0.405619, 0.607052, 0.101548, 0.405619, 0.564372, 0.101548, 0.463168, 0.564372, 0.173483, 0.463168, 0.524785, 0.173483, 0.506845, 0.524785, 0.101548, 0.506845, 0.716356, 0.200243, 0.070556, 0.719199, 0.200243, 0.012686, 0.70599, 0.200243, 0.140431, 0.688827, 0.200243, 0.208954, 0.665029, 0.200243, 0.275464, 0.634826, 0.200243, 0.339322, 0.59851, 0.200243, 0.399912, 0.55643, 0.200243, 0.45665, 0.51752, 0.200243, 0.499581, 0.698423, 0.220079, 0.012686, 0.69568, 0.220079, 0.068519, 0.685614, 0.220079, 0.136378, 0.668946, 0.220079, 0.202923, 0.645835, 0.220079, 0.267514, 0.616504, 0.220079, 0.329528, 0.581236, 0.220079, 0.388369, 0.54037, 0.220079, 0.44347, 0.50283, 0.220079, 0.48489, 0.667665, 0.239572, 0.012686, 0.66507, 0.239572, 0.065504, 0.655447, 0.239572, 0.130377, 0.639512, 0.239572, 0.193994, 0.617418, 0.239572, 0.255743, 0.589378, 0.239572, 0.315029, 0.555661, 0.239572, 0.371281, 0.516594, 0.239572, 0.423958, 0.48108, 0.239572, 0.463141, 0.619549, 0.259465, 0.012686, 0.608255, 0.259465, 0.12099, 0.572964, 0.259465, 0.23733, 0.515654, 0.259465, 0.344549, 0.447057, 0.259465, 0.429117, 0.518995, 0.288001, 0.012686, 0.509634, 0.288001, 0.101373, 0.480064, 0.288001, 0.198849, 0.432047, 0.288001, 0.288684, 0.375954, 0.288, 0.358015, 0.368027, 0.314284, 0.012685, 0.361567, 0.314284, 0.071921, 0.340589, 0.314284, 0.141077, 0.306522, 0.314284, 0.204811, 0.269204, 0.314284, 0.251265, 0.292921, 0.322078, 0.012685, 0.287903, 0.322078, 0.057268, 0.271199, 0.322078, 0.112335, 0.244073, 0.322078, 0.163084, 0.216096, 0.322078, 0.198157, 0.280289, 0.120187, 0.012685, 0.280289, 0.310689, 0.012685, 0.275514, 0.310689, 0.054804, 0.275514, 0.120187, 0.054804, 0.259529, 0.120187, 0.1075, 0.259529, 0.310689, 0.1075, 0.23357, 0.120187, 0.156066, 0.23357, 0.310689, 0.156066, 0.207164, 0.120187, 0.189224, 0.207164, 0.310689, 0.189224, 0.697661, 0.167505, -0.001593, 0.717411, 0.101548, -0.000622, 0.717621, 0.171184, -0.000612, 0.697115, 0.101548, -0.001619, 0.492194, 0.167505, 0.494447, 0.506846, 0.101548, 0.507727, 0.49179, 0.101548, 0.49408, 0.507001, 0.171184, 0.507868, 0.692294, 0.182058, -0.001352, 0.709234, 0.193249, -0.000519, 0.48857, 0.182058, 0.490482, 0.501137, 0.193249, 0.501872, 0.691204, 0.210097, -0.000384, 0.678655, 0.194127, -0.001001, 0.479174, 0.194127, 0.48059, 0.488483, 0.210097, 0.489027, 0.662416, 0.228315, -0.000288, 0.65302, 0.210304, -0.000749, 0.461224, 0.210304, 0.462285, 0.468195, 0.228315, 0.468602, 0.615985, 0.247477, -0.000205, 0.609287, 0.228295, -0.000534, 0.430453, 0.228295, 0.431209, 0.435422, 0.247477, 0.435712, 0.516772, 0.275624, -0.000139, 0.512218, 0.255822, -0.000363, 0.361936, 0.255822, 0.36245, 0.365314, 0.275624, 0.365512, 0.366891, 0.301706, -8.6e-05, 0.364077, 0.281583, -0.000224, 0.257283, 0.281583, 0.2576, 0.259371, 0.301706, 0.259492, 0.289244, 0.313814, 0.00041, 0.302575, 0.298492, 0.001065, 0.214706, 0.298492, 0.2132, 0.204816, 0.313814, 0.204237, 0.293596, 0.120187, 0.000624, 0.302575, 0.298492, 0.001065, 0.289244, 0.313814, 0.00041, 0.313892, 0.120187, 0.001621, 0.208045, 0.120187, 0.207163, 0.204816, 0.313814, 0.204237, 0.214706, 0.298492, 0.2132, 0.223101, 0.120187, 0.220809, 0, 0.335858, 0.280911, 0, 0.120187, 0.280911, -0.054803, 0.335858, 0.275513, -0.054803, 0.120187, 0.275513, -0.1075, 0.335858, 0.259528, -0.1075, 0.120187, 0.259528, -0.156065, 0.335858, 0.233569, -0.156065, 0.120187, 0.233569, -0.198634, 0.335858, 0.198634, -0.198634, 0.120187, 0.198634, -0.233568, 0.335858, 0.156066, -0.233568, 0.120187, 0.156066, -0.259528, 0.335858, 0.1075, -0.259528, 0.120187, 0.1075, -0.275513, 0.335858, 0.054803, -0.275513, 0.120187, 0.054803, -0.280911, 0.335858, -0, -0.280911, 0.120187, -0, -0.280911, 0.335858, -0, -0.280911, 0.120187, -0, -0.275513, 0.335858, -0.054803, -0.275513, 0.120187, -0.054803, -0.259528, 0.335858, -0.1075, -0.259528, 0.120187, -0.1075, -0.233568, 0.335858, -0.156066, -0.233568, 0.120187, -0.156066, -0.198634, 0.335858, -0.198634, -0.198634, 0.120187, -0.198634, -0.156065, 0.120187, -0.233569, -0.156065, 0.335858, -0.233569, -0.107499, 0.120187, -0.259528, -0.107499, 0.335858, -0.259528, -0.054802, 0.120187, -0.275514, -0.054802, 0.335858, -0.275514, 1e-06, 0.120187, -0.280911, 1e-06, 0.335858, -0.280911, 0.054804, 0.120187, -0.275514, 0.054804, 0.335858, -0.275514, 0.107501, 0.120187, -0.259528, 0.107501, 0.335858, -0.259528, 0.156067, 0.120187, -0.233569, 0.156067, 0.335858, -0.233569, 0.198635, 0.120187, -0.198634, 0.198635, 0.335858, -0.198634, 0.23357, 0.335858, -0.156066, 0.23357, 0.120187, -0.156066, 0.259529, 0.335858, -0.1075, 0.259529, 0.120187, -0.1075, 0.275514, 0.335858, -0.054803, 0.275514, 0.120187, -0.054803, 0.280912, 0.120187, -0, 0.280912, 0.335858, -0, 0.275514, 0.120187, 0.054803, 0.275514, 0.335858, 0.054803, 0.259529, 0.335858, 0.1075, 0.259529, 0.120187, 0.1075, 0.23357, 0.335858, 0.156065, 0.23357, 0.120187, 0.156065, 0.198635, 0.120187, 0.198634, 0.198635, 0.335858, 0.198634, 0.156067, 0.335858, 0.233569, 0.156067, 0.120187, 0.233569, 0.107501, 0.335858, 0.259528, 0.107501, 0.120187, 0.259528, 0.054804, 0.335858, 0.275513, 0.054804, 0.120187, 0.275513, -0.058097, 0.363729, 0.292074, 0, 0.40714, 0.380895, 0, 0.363729, 0.297796, -0.058097, 0.363729, 0.292074, -0.074309, 0.40714, 0.373577, -0.113961, 0.363729, 0.275128, -0.058097, 0.363729, 0.292074, -0.145762, 0.40714, 0.351901, -0.165446, 0.363729, 0.247608, -0.211614, 0.40714, 0.316703, -0.210573, 0.363729, 0.210574, -0.269333, 0.40714, 0.269334, -0.316702, 0.40714, 0.211614, -0.247608, 0.363729, 0.165446, -0.275127, 0.363729, 0.113961, -0.351901, 0.40714, 0.145762, -0.292073, 0.363729, 0.058097, -0.373576, 0.40714, 0.074309, -0.297796, 0.363729, -0, -0.297796, 0.363729, -0, -0.380895, 0.40714, -0, -0.373576, 0.40714, -0.074309, -0.297796, 0.363729, -0, -0.292073, 0.363729, -0.058097, -0.297796, 0.363729, -0, -0.380895, 0.40714, -0, -0.351901, 0.40714, -0.145763, -0.275127, 0.363729, -0.113962, -0.316702, 0.40714, -0.211614, -0.247608, 0.363729, -0.165447, -0.210573, 0.363729, -0.210574, -0.269333, 0.40714, -0.269334, -0.165446, 0.363729, -0.247609, -0.211614, 0.40714, -0.316703, -0.145762, 0.40714, -0.351902, -0.113961, 0.363729, -0.275128, -0.074308, 0.40714, -0.373577, -0.058096, 0.363729, -0.292074, 1e-06, 0.40714, -0.380896, 1e-06, 0.363729, -0.297796, 0.07431, 0.40714, -0.373577, 0.058098, 0.363729, -0.292074, 0.145763, 0.40714, -0.351902, 0.113962, 0.363729, -0.275128, 0.211615, 0.40714, -0.316703, 0.165447, 0.363729, -0.247608, 0.210574, 0.363729, -0.210574, 0.269335, 0.40714, -0.269334, 0.316704, 0.40714, -0.211614, 0.247609, 0.363729, -0.165447, 0.275128, 0.363729, -0.113962, 0.351902, 0.40714, -0.145762, 0.292075, 0.363729, -0.058097, 0.373577, 0.40714, -0.074309, 0.297797, 0.363729, -0, 0.380896, 0.40714, -0, 0.292075, 0.363729, -0.058097, 0.292075, 0.363729, 0.058097, 0.373577, 0.40714, 0.074309, 0.351902, 0.40714, 0.145762, 0.275128, 0.363729, 0.113961, 0.247609, 0.363729, 0.165446, 0.316704, 0.40714, 0.211614, 0.210575, 0.363729, 0.210573, 0.269335, 0.40714, 0.269333, 0.211615, 0.40714, 0.316702, 0.165448, 0.363729, 0.247608, 0.113963, 0.363729, 0.275127, 0.145764, 0.40714, 0.351901, 0.058098, 0.363729, 0.292074, 0.074311, 0.40714, 0.373576, -0.076505, 0.452776, 0.384617, 0, 0.452776, 0.392152, 0, 0.42572, 0.392152, -0.076505, 0.42572, 0.384617, -0.15007, 0.452776, 0.362301, -0.15007, 0.42572, 0.362301, -0.217868, 0.452776, 0.326062, -0.217868, 0.42572, 0.326062, -0.277293, 0.452776, 0.277293, -0.277293, 0.42572, 0.277293, -0.326062, 0.452776, 0.217868, -0.326062, 0.42572, 0.217868, -0.362301, 0.452776, 0.15007, -0.362301, 0.42572, 0.15007, -0.384616, 0.452776, 0.076505, -0.384616, 0.42572, 0.076505, -0.392152, 0.452776, -0, -0.392152, 0.42572, -0, -0.392152, 0.452776, -0, -0.384616, 0.42572, -0.076505, -0.384616, 0.452776, -0.076505, -0.392152, 0.42572, -0, -0.362301, 0.452776, -0.15007, -0.362301, 0.42572, -0.15007, -0.326062, 0.452776, -0.217868, -0.326062, 0.42572, -0.217868, -0.277293, 0.452776, -0.277294, -0.277293, 0.42572, -0.277294, -0.217867, 0.452776, -0.326063, -0.217867, 0.42572, -0.326063, -0.150069, 0.452776, -0.362301, -0.150069, 0.42572, -0.362301, -0.076504, 0.452776, -0.384617, -0.076504, 0.42572, -0.384617, 1e-06, 0.42572, -0.392152, 1e-06, 0.452776, -0.392152, 0.076506, 0.42572, -0.384617, 0.076506, 0.452776, -0.384617, 0.150071, 0.452776, -0.362301, 0.150071, 0.42572, -0.362301, 0.217869, 0.452776, -0.326062, 0.217869, 0.42572, -0.326062, 0.277294, 0.42572, -0.277293, 0.277294, 0.452776, -0.277293, 0.326063, 0.452776, -0.217868, 0.326063, 0.42572, -0.217868, 0.362302, 0.452776, -0.15007, 0.362302, 0.42572, -0.15007, 0.384618, 0.452776, -0.076505, 0.384618, 0.42572, -0.076505, 0.392153, 0.42572, -0, 0.392153, 0.452776, -0, 0.384618, 0.452776, 0.076505, 0.384618, 0.42572, 0.076505, 0.362302, 0.452776, 0.15007, 0.362302, 0.42572, 0.15007, 0.326063, 0.452776, 0.217867, 0.326063, 0.42572, 0.217867, 0.277294, 0.42572, 0.277293, 0.277294, 0.452776, 0.277293, 0.217869, 0.452776, 0.326062, 0.217869, 0.42572, 0.326062, 0.150072, 0.452776, 0.362301, 0.150072, 0.42572, 0.362301, 0.076507, 0.42572, 0.384617, 0.076507, 0.452776, 0.384617, 1e-06, 0.744556, 0.048813, 0, 0.465254, 0.386282, -0.07536, 0.465254, 0.378859, -0.009522, 0.744556, 0.047875, -0.018679, 0.744556, 0.045097, -0.147823, 0.465254, 0.356878, -0.027118, 0.744556, 0.040587, -0.214606, 0.465254, 0.321181, -0.273142, 0.465254, 0.273142, -0.034515, 0.744556, 0.034516, -0.321181, 0.465254, 0.214607, -0.040586, 0.744556, 0.027119, -0.045097, 0.744556, 0.01868, -0.356877, 0.465254, 0.147823, -0.047875, 0.744556, 0.009523, -0.378859, 0.465254, 0.07536, -0.386281, 0.465254, -0, -0.386281, 0.465254, -0, -0.048813, 0.744556, -0, -0.386281, 0.465254, -0, -0.047875, 0.744556, -0.009523, -0.048813, 0.744556, -0, -0.386281, 0.465254, -0, -0.378859, 0.465254, -0.07536, -0.356877, 0.465254, -0.147824, -0.045097, 0.744556, -0.01868, -0.321181, 0.465254, -0.214607, -0.040586, 0.744556, -0.027119, -0.273142, 0.465254, -0.273143, -0.034515, 0.744556, -0.034516, -0.027118, 0.744556, -0.040587, -0.214606, 0.465254, -0.321182, -0.147823, 0.465254, -0.356878, -0.018679, 0.744556, -0.045098, -0.075359, 0.465254, -0.37886, -0.009522, 0.744556, -0.047876, 1e-06, 0.465254, -0.386282, 1e-06, 0.744556, -0.048813, 0.075361, 0.465254, -0.37886, 0.009524, 0.744556, -0.047875, 0.147824, 0.465254, -0.356878, 0.018681, 0.744556, -0.045098, 0.214607, 0.465254, -0.321181, 0.02712, 0.744556, -0.040587, 0.034517, 0.744556, -0.034516, 0.273143, 0.465254, -0.273142, 0.321182, 0.465254, -0.214607, 0.040587, 0.744556, -0.027119, 0.045098, 0.744556, -0.01868, 0.356878, 0.465254, -0.147824, 0.047876, 0.744556, -0.009523, 0.37886, 0.465254, -0.07536, 0.386282, 0.465254, -0, 0.048814, 0.744556, -0, 0.386282, 0.465254, -0, 0.047876, 0.744556, 0.009523, 0.386282, 0.465254, -0, 0.37886, 0.465254, 0.075359, 0.386282, 0.465254, -0, 0.356879, 0.465254, 0.147823, 0.045098, 0.744556, 0.01868, 0.040587, 0.744556, 0.027119, 0.321182, 0.465254, 0.214606, 0.273144, 0.465254, 0.273142, 0.034517, 0.744556, 0.034516, 0.214608, 0.465254, 0.321181, 0.02712, 0.744556, 0.040586, 0.018681, 0.744556, 0.045097, 0.147825, 0.465254, 0.356877, 0.009524, 0.744556, 0.047875, 0.075361, 0.465254, 0.378859, -0.058097, 0.363729, 0.292074, -0.058097, 0.363729, 0.292074, -0.058097, 0.363729, 0.292074, -0.297796, 0.363729, -0, -0.297796, 0.363729, -0, -0.297796, 0.363729, -0, -0.297796, 0.363729, -0, 0.292075, 0.363729, -0.058097, 0.292075, 0.363729, -0.058097, 0.292075, 0.363729, -0.058097, -0.386281, 0.465254, -0, -0.386281, 0.465254, -0, 0.386282, 0.465254, -0, 0.386282, 0.465254, -0, -0.131951, 0.059284, 1.33972, -0, 0.059284, 1.3462, -0, 0.01016, 1.3462, -0.131951, 0.01016, 1.33972, -0.262631, 0.059284, 1.32033, -0.262631, 0.01016, 1.32033, -0.390781, 0.059284, 1.28823, -0.390781, 0.01016, 1.28823, -0.515168, 0.059284, 1.24373, -0.515168, 0.01016, 1.24373, -0.634594, 0.059284, 1.18724, -0.634594, 0.01016, 1.18724, -0.747909, 0.059284, 1.11932, -0.747909, 0.01016, 1.11932, -0.85402, 0.059284, 1.04063, -0.85402, 0.01016, 1.04063, -0.951907, 0.059284, 0.951907, -0.951907, 0.01016, 0.951907, -1.04063, 0.059284, 0.85402, -1.04063, 0.01016, 0.85402, -1.11932, 0.059284, 0.747908, -1.11932, 0.01016, 0.747908, -1.18724, 0.059284, 0.634594, -1.18724, 0.01016, 0.634594, -1.24373, 0.059284, 0.515168, -1.24373, 0.01016, 0.515168, -1.28823, 0.059284, 0.390781, -1.28823, 0.01016, 0.390781, -1.32033, 0.059284, 0.26263, -1.32033, 0.01016, 0.26263, -1.33972, 0.059284, 0.13195, -1.33972, 0.01016, 0.13195, -1.3462, 0.059284, -1e-06, -1.3462, 0.01016, -1e-06, -1.33972, 0.059284, -0.131951, -1.33972, 0.01016, -0.131951, -1.32033, 0.059284, -0.262631, -1.32033, 0.01016, -0.262631, -1.28823, 0.059284, -0.390782, -1.28823, 0.01016, -0.390782, -1.24373, 0.059284, -0.515169, -1.24373, 0.01016, -0.515169, -1.18724, 0.059284, -0.634595, -1.18724, 0.01016, -0.634595, -1.11932, 0.059284, -0.747909, -1.11932, 0.01016, -0.747909, -1.04063, 0.059284, -0.85402, -1.04063, 0.01016, -0.85402, -0.951907, 0.059284, -0.951907, -0.951907, 0.01016, -0.951907, -0.854021, 0.059284, -1.04063, -0.854021, 0.01016, -1.04063, -0.747909, 0.059284, -1.11932, -0.747909, 0.01016, -1.11932, -0.634595, 0.059284, -1.18724, -0.634595, 0.01016, -1.18724, -0.51517, 0.059284, -1.24373, -0.51517, 0.01016, -1.24373, -0.390783, 0.059284, -1.28823, -0.390783, 0.01016, -1.28823, -0.262632, 0.059284, -1.32033, -0.262632, 0.01016, -1.32033, -0.131953, 0.059284, -1.33972, -0.131953, 0.01016, -1.33972, -2e-06, 0.059284, -1.3462, -2e-06, 0.01016, -1.3462, 0.131948, 0.059284, -1.33972, 0.131948, 0.01016, -1.33972, 0.262628, 0.059284, -1.32033, 0.262628, 0.01016, -1.32033, 0.390778, 0.059284, -1.28823, 0.390778, 0.01016, -1.28823, 0.515165, 0.059284, -1.24373, 0.515165, 0.01016, -1.24373, 0.634591, 0.059284, -1.18724, 0.634591, 0.01016, -1.18724, 0.747905, 0.059284, -1.11933, 0.747905, 0.01016, -1.11933, 0.854017, 0.059284, -1.04063, 0.854017, 0.01016, -1.04063, 0.944546, 0.059284, -0.958916, 0.944546, 0.01016, -0.958916, 0.854019, 0.059284, 1.04063, 0.944548, 0.059284, 0.958914, 0.944548, 0.01016, 0.958914, 0.854019, 0.01016, 1.04063, 0.747907, 0.059284, 1.11933, 0.747907, 0.01016, 1.11933, 0.634592, 0.059284, 1.18724, 0.634592, 0.01016, 1.18724, 0.515166, 0.059284, 1.24373, 0.515166, 0.01016, 1.24373, 0.390778, 0.059284, 1.28823, 0.390778, 0.01016, 1.28823, 0.262627, 0.059284, 1.32033, 0.262627, 0.01016, 1.32033, 0.131947, 0.059284, 1.33972, 0.131947, 0.01016, 1.33972, -0.130729, 0.079439, 1.32731, -0, 0.096794, 1.29896, -0, 0.079439, 1.33373, -0.12732, 0.096794, 1.29271, -0.260198, 0.079439, 1.30811, -0.12732, 0.096794, 1.29271, -0.12732, 0.096794, 1.29271, -0.253414, 0.096794, 1.274, -0.377068, 0.096794, 1.24303, -0.387162, 0.079439, 1.2763, -0.49709, 0.096794, 1.20008, -0.510397, 0.079439, 1.23221, -0.628717, 0.079439, 1.17625, -0.612325, 0.096794, 1.14558, -0.721663, 0.096794, 1.08004, -0.740982, 0.079439, 1.10896, -0.846111, 0.079439, 1.03099, -0.824051, 0.096794, 1.00411, -0.943092, 0.079439, 0.943091, -0.918503, 0.096794, 0.918503, -1.03099, 0.079439, 0.846111, -1.00411, 0.096794, 0.824051, -1.10896, 0.079439, 0.740982, -1.08004, 0.096794, 0.721663, -1.14558, 0.096794, 0.612325, -1.17625, 0.079439, 0.628717, -1.20008, 0.096794, 0.49709, -1.23221, 0.079439, 0.510397, -1.24303, 0.096794, 0.377068, -1.2763, 0.079439, 0.387162, -1.274, 0.096794, 0.253414, -1.30811, 0.079439, 0.260198, -1.32731, 0.079439, 0.130728, -1.29271, 0.096794, 0.12732, -1.32731, 0.079439, 0.130728, -1.29896, 0.096794, -1e-06, -1.29271, 0.096794, 0.12732, -1.32731, 0.079439, 0.130728, -1.32731, 0.079439, 0.130728, -1.33373, 0.079439, -1e-06, -1.32731, 0.079439, -0.130729, -1.2927, 0.096794, -0.127321, -1.32731, 0.079439, -0.130729, -1.274, 0.096794, -0.253415, -1.2927, 0.096794, -0.127321, -1.32731, 0.079439, -0.130729, -1.32731, 0.079439, -0.130729, -1.30811, 0.079439, -0.260199, -1.2763, 0.079439, -0.387163, -1.24303, 0.096794, -0.377069, -1.23221, 0.079439, -0.510398, -1.20008, 0.096794, -0.497091, -1.17625, 0.079439, -0.628718, -1.14558, 0.096794, -0.612326, -1.08004, 0.096794, -0.721663, -1.10896, 0.079439, -0.740983, -1.03099, 0.079439, -0.846111, -1.00411, 0.096794, -0.824051, -0.918503, 0.096794, -0.918503, -0.943092, 0.079439, -0.943091, -0.824052, 0.096794, -1.00411, -0.846112, 0.079439, -1.03099, -0.740983, 0.079439, -1.10896, -0.721664, 0.096794, -1.08004, -0.612326, 0.096794, -1.14558, -0.628718, 0.079439, -1.17625, -0.497091, 0.096794, -1.20008, -0.510399, 0.079439, -1.23221, -0.37707, 0.096794, -1.24303, -0.387164, 0.079439, -1.2763, -0.253416, 0.096794, -1.274, -0.2602, 0.079439, -1.3081, -0.130731, 0.079439, -1.32731, -0.127322, 0.096794, -1.2927, -0.130731, 0.079439, -1.32731, -2e-06, 0.096794, -1.29896, -0.127322, 0.096794, -1.2927, -0.130731, 0.079439, -1.32731, -0.130731, 0.079439, -1.32731, -2e-06, 0.079439, -1.33373, 0.130726, 0.079439, -1.32731, 0.127318, 0.096794, -1.29271, 0.130726, 0.079439, -1.32731, 0.253412, 0.096794, -1.274, 0.127318, 0.096794, -1.29271, 0.130726, 0.079439, -1.32731, 0.130726, 0.079439, -1.32731, 0.260196, 0.079439, -1.30811, 0.387159, 0.079439, -1.2763, 0.377065, 0.096794, -1.24303, 0.510394, 0.079439, -1.23221, 0.497087, 0.096794, -1.20008, 0.612322, 0.096794, -1.14558, 0.628714, 0.079439, -1.17625, 0.72166, 0.096794, -1.08005, 0.740979, 0.079439, -1.10896, 0.824048, 0.096794, -1.00411, 0.846108, 0.079439, -1.03099, 0.911142, 0.096794, -0.925512, 0.93573, 0.079439, -0.950101, 0.911144, 0.096794, 0.92551, 0.84611, 0.079439, 1.03099, 0.82405, 0.096794, 1.00411, 0.935732, 0.079439, 0.950098, 0.721662, 0.096794, 1.08005, 0.740981, 0.079439, 1.10896, 0.612323, 0.096794, 1.14558, 0.628715, 0.079439, 1.17625, 0.497088, 0.096794, 1.20008, 0.510395, 0.079439, 1.23221, 0.387159, 0.079439, 1.2763, 0.377065, 0.096794, 1.24303, 0.260195, 0.079439, 1.30811, 0.253411, 0.096794, 1.274, 0.130725, 0.079439, 1.32731, 0.130725, 0.079439, 1.32731, 0.127317, 0.096794, 1.29271, 0.130725, 0.079439, 1.32731, 0.130725, 0.079439, 1.32731, 0.127317, 0.096794, 1.29271, -0.122406, 0.328196, 1.24281, -0, 0.328196, 1.24882, -0, 0.145794, 1.26547, -0.124038, 0.145794, 1.25938, -0.243632, 0.328196, 1.22482, -0.246882, 0.145794, 1.24116, -0.362513, 0.328196, 1.19504, -0.367348, 0.145794, 1.21098, -0.477902, 0.328196, 1.15376, -0.484276, 0.145794, 1.16914, -0.588689, 0.328196, 1.10136, -0.59654, 0.145794, 1.11605, -0.693806, 0.328196, 1.03835, -0.693806, 0.328196, 1.03835, -0.70306, 0.145794, 1.0522, -0.693806, 0.328196, 1.03835, -0.792242, 0.328196, 0.965349, -0.802808, 0.145794, 0.978224, -0.883048, 0.328196, 0.883048, -0.894825, 0.145794, 0.894825, -0.978225, 0.145794, 0.802808, -0.96535, 0.328196, 0.792242, -0.978225, 0.145794, 0.802808, -1.0522, 0.145794, 0.703059, -1.03835, 0.328196, 0.693806, -0.978225, 0.145794, 0.802808, -1.03835, 0.328196, 0.693806, -1.11605, 0.145794, 0.59654, -1.10136, 0.328196, 0.588688, -1.03835, 0.328196, 0.693806, -1.16915, 0.145794, 0.484276, -1.15376, 0.328196, 0.477902, -1.21098, 0.145794, 0.367347, -1.19504, 0.328196, 0.362512, -1.24116, 0.145794, 0.246881, -1.22482, 0.328196, 0.243632, -1.25938, 0.145794, 0.124038, -1.24281, 0.328196, 0.122405, -1.26547, 0.145794, -1e-06, -1.24882, 0.328196, -1e-06, -1.24281, 0.328196, -0.122406, -1.25938, 0.145794, -0.124039, -1.22482, 0.328196, -0.243633, -1.24116, 0.145794, -0.246882, -1.19504, 0.328196, -0.362513, -1.21098, 0.145794, -0.367348, -1.15376, 0.328196, -0.477903, -1.16914, 0.145794, -0.484277, -1.10136, 0.328196, -0.588689, -1.11605, 0.145794, -0.596541, -1.03835, 0.328196, -0.693806, -1.03835, 0.328196, -0.693806, -1.0522, 0.145794, -0.70306, -1.03835, 0.328196, -0.693806, -0.96535, 0.328196, -0.792242, -0.978225, 0.145794, -0.802808, -0.883048, 0.328196, -0.883048, -0.894826, 0.145794, -0.894825, -0.802809, 0.145794, -0.978224, -0.792242, 0.328196, -0.965349, -0.802809, 0.145794, -0.978224, -0.70306, 0.145794, -1.0522, -0.693807, 0.328196, -1.03835, -0.802809, 0.145794, -0.978224, -0.693807, 0.328196, -1.03835, -0.596541, 0.145794, -1.11605, -0.58869, 0.328196, -1.10136, -0.693807, 0.328196, -1.03835, -0.484277, 0.145794, -1.16914, -0.477903, 0.328196, -1.15376, -0.367349, 0.145794, -1.21098, -0.362514, 0.328196, -1.19504, -0.246883, 0.145794, -1.24116, -0.243634, 0.328196, -1.22482, -0.12404, 0.145794, -1.25938, -0.122408, 0.328196, -1.2428, -2e-06, 0.145794, -1.26547, -2e-06, 0.328196, -1.24882, 0.122403, 0.328196, -1.24281, 0.124036, 0.145794, -1.25938, 0.24363, 0.328196, -1.22482, 0.246879, 0.145794, -1.24116, 0.36251, 0.328196, -1.19504, 0.367345, 0.145794, -1.21098, 0.477899, 0.328196, -1.15376, 0.484273, 0.145794, -1.16915, 0.588686, 0.328196, -1.10136, 0.596537, 0.145794, -1.11605, 0.693803, 0.328196, -1.03836, 0.693803, 0.328196, -1.03836, 0.703057, 0.145794, -1.0522, 0.693803, 0.328196, -1.03836, 0.792239, 0.328196, -0.965352, 0.802805, 0.145794, -0.978227, 0.875686, 0.328196, -0.890056, 0.887464, 0.145794, -0.901834, 0.875689, 0.328196, 0.890054, 0.802807, 0.145794, 0.978225, 0.792241, 0.328196, 0.96535, 0.887466, 0.145794, 0.901832, 0.703058, 0.145794, 1.0522, 0.693805, 0.328196, 1.03835, 0.693805, 0.328196, 1.03835, 0.596538, 0.145794, 1.11605, 0.588687, 0.328196, 1.10136, 0.693805, 0.328196, 1.03835, 0.484274, 0.145794, 1.16915, 0.4779, 0.328196, 1.15376, 0.367345, 0.145794, 1.21098, 0.36251, 0.328196, 1.19504, 0.246879, 0.145794, 1.24116, 0.243629, 0.328196, 1.22482, 0.124035, 0.145794, 1.25938, 0.122402, 0.328196, 1.24281, -0.118773, 0.362026, 1.20592, 0, 0.362026, 1.09799, -0, 0.362026, 1.21176, -0.107622, 0.362026, 1.0927, -0.214207, 0.362026, 1.07689, -0.236402, 0.362026, 1.18847, -0.318729, 0.362026, 1.05071, -0.351755, 0.362026, 1.15958, -0.46372, 0.362026, 1.11952, -0.420181, 0.362027, 1.01441, -0.571219, 0.362026, 1.06868, -0.517587, 0.362027, 0.968338, -0.610009, 0.362027, 0.912943, -0.673216, 0.362027, 1.00754, -0.768731, 0.362027, 0.936701, -0.696555, 0.362027, 0.848755, -0.856842, 0.362027, 0.856842, -0.776394, 0.362027, 0.776393, -0.936701, 0.362027, 0.768731, -0.848755, 0.362027, 0.696555, -1.00754, 0.362027, 0.673216, -0.912943, 0.362027, 0.610008, -0.968338, 0.362027, 0.517587, -1.06868, 0.362027, 0.571218, -1.11952, 0.362027, 0.463719, -1.01441, 0.362027, 0.420181, -1.15958, 0.362027, 0.351754, -1.05071, 0.362027, 0.318728, -1.07689, 0.362027, 0.214206, -1.18847, 0.362027, 0.236402, -1.20592, 0.362027, 0.118773, -1.0927, 0.362027, 0.107621, -1.21176, 0.362027, -1e-06, -1.09799, 0.362027, -1e-06, -1.20592, 0.362027, -0.118774, -1.0927, 0.362027, -0.107622, -1.07689, 0.362027, -0.214207, -1.18847, 0.362027, -0.236403, -1.15958, 0.362027, -0.351755, -1.05071, 0.362027, -0.318729, -1.11952, 0.362027, -0.46372, -1.01441, 0.362027, -0.420182, -1.06867, 0.362027, -0.571219, -0.968337, 0.362027, -0.517588, -0.912943, 0.362027, -0.610009, -1.00754, 0.362027, -0.673217, -0.936701, 0.362027, -0.768731, -0.848755, 0.362027, -0.696555, -0.856842, 0.362027, -0.856842, -0.776394, 0.362027, -0.776394, -0.768731, 0.362027, -0.936701, -0.696556, 0.362027, -0.848755, -0.673217, 0.362027, -1.00754, -0.610009, 0.362027, -0.912942, -0.517588, 0.362027, -0.968337, -0.571219, 0.362027, -1.06867, -0.463721, 0.362027, -1.11952, -0.420182, 0.362027, -1.01441, -0.31873, 0.362027, -1.05071, -0.351756, 0.362027, -1.15958, -0.214208, 0.362027, -1.07689, -0.236404, 0.362027, -1.18847, -0.118775, 0.362027, -1.20592, -0.107623, 0.362027, -1.0927, -2e-06, 0.362027, -1.09799, -2e-06, 0.362027, -1.21176, 0.107619, 0.362027, -1.0927, 0.118771, 0.362027, -1.20592, 0.214204, 0.362027, -1.07689, 0.2364, 0.362027, -1.18847, 0.351752, 0.362027, -1.15958, 0.318726, 0.362027, -1.05071, 0.420179, 0.362027, -1.01441, 0.463717, 0.362027, -1.11952, 0.517585, 0.362027, -0.968339, 0.571215, 0.362027, -1.06868, 0.610006, 0.362027, -0.912944, 0.673213, 0.362027, -1.00754, 0.768728, 0.362027, -0.936704, 0.696553, 0.362027, -0.848757, 0.849481, 0.362027, -0.86385, 0.769033, 0.362027, -0.783402, 0.769035, 0.362027, 0.7834, 0.76873, 0.362027, 0.936702, 0.696554, 0.362027, 0.848756, 0.849483, 0.362027, 0.863848, 0.610007, 0.362027, 0.912943, 0.673215, 0.362027, 1.00754, 0.517586, 0.362027, 0.968339, 0.571217, 0.362026, 1.06868, 0.420179, 0.362027, 1.01441, 0.463717, 0.362026, 1.11952, 0.351752, 0.362026, 1.15958, 0.318726, 0.362026, 1.05071, 0.236399, 0.362026, 1.18847, 0.214204, 0.362026, 1.07689, 0.11877, 0.362026, 1.20592, 0.107618, 0.362026, 1.0927, -0.104077, 0.328126, 1.05671, -0.102965, 0.152793, 1.04543, 0, 0.328126, 1.06182, 0, 0.152793, 1.05048, -0.207151, 0.328126, 1.04142, -0.204939, 0.152793, 1.0303, -0.308231, 0.328126, 1.0161, -0.304939, 0.152793, 1.00525, -0.406342, 0.328126, 0.980996, -0.402003, 0.152793, 0.97052, -0.50054, 0.328126, 0.936444, -0.495194, 0.152793, 0.926443, -0.589917, 0.328126, 0.882873, -0.583617, 0.152793, 0.873445, -0.673613, 0.328126, 0.8208, -0.66642, 0.152793, 0.812034, -0.750822, 0.328126, 0.750822, -0.742804, 0.152793, 0.742804, -0.8208, 0.328126, 0.673613, -0.812035, 0.152793, 0.666419, -0.882873, 0.328126, 0.589917, -0.873445, 0.152793, 0.583617, -0.936444, 0.328126, 0.500539, -0.926444, 0.152793, 0.495194, -0.980996, 0.328126, 0.406342, -0.97052, 0.152793, 0.402002, -1.0161, 0.328126, 0.30823, -1.00525, 0.152793, 0.304939, -1.04142, 0.328126, 0.207151, -1.0303, 0.152793, 0.204939, -1.05671, 0.328126, 0.104076, -1.04543, 0.152793, 0.102965, -1.06182, 0.328126, -1e-06, -1.05048, 0.152793, -1e-06, -1.05671, 0.328126, -0.104077, -1.04543, 0.152793, -0.102966, -1.04142, 0.328126, -0.207152, -1.0303, 0.152793, -0.20494, -1.0161, 0.328126, -0.308231, -1.00525, 0.152793, -0.30494, -0.980996, 0.328126, -0.406343, -0.97052, 0.152793, -0.402003, -0.936444, 0.328126, -0.50054, -0.926443, 0.152793, -0.495195, -0.882873, 0.328126, -0.589917, -0.873445, 0.152793, -0.583618, -0.8208, 0.328126, -0.673613, -0.812035, 0.152793, -0.66642, -0.750822, 0.328126, -0.750822, -0.742804, 0.152793, -0.742804, -0.673614, 0.328126, -0.8208, -0.66642, 0.152793, -0.812034, -0.589918, 0.328126, -0.882873, -0.583618, 0.152793, -0.873445, -0.500541, 0.328126, -0.936444, -0.495195, 0.152793, -0.926443, -0.406343, 0.328126, -0.980996, -0.402004, 0.152793, -0.970519, -0.308232, 0.328126, -1.0161, -0.304941, 0.152793, -1.00525, -0.207153, 0.328126, -1.04142, -0.204941, 0.152793, -1.0303, -0.104078, 0.328126, -1.05671, -0.102967, 0.152793, -1.04543, -2e-06, 0.328126, -1.06182, -2e-06, 0.152793, -1.05048, 0.102963, 0.152793, -1.04543, 0.104075, 0.328126, -1.05671, 0.207149, 0.328126, -1.04142, 0.204937, 0.152793, -1.0303, 0.308228, 0.328126, -1.0161, 0.304937, 0.152793, -1.00525, 0.406339, 0.328126, -0.980997, 0.402, 0.152793, -0.970521, 0.500537, 0.328126, -0.936445, 0.495192, 0.152793, -0.926445, 0.589914, 0.328126, -0.882875, 0.583615, 0.152793, -0.873447, 0.673611, 0.328126, -0.820802, 0.666417, 0.152793, -0.812037, 0.743461, 0.328126, -0.75783, 0.735443, 0.152793, -0.749812, 0.673612, 0.328126, 0.820801, 0.735445, 0.152793, 0.74981, 0.743463, 0.328126, 0.757828, 0.666419, 0.152793, 0.812035, 0.589916, 0.328126, 0.882874, 0.583616, 0.152793, 0.873446, 0.500538, 0.328126, 0.936445, 0.495193, 0.152793, 0.926444, 0.40634, 0.328126, 0.980997, 0.402001, 0.152793, 0.970521, 0.308229, 0.328126, 1.0161, 0.304937, 0.152793, 1.00525, 0.207149, 0.328126, 1.04142, 0.204937, 0.152793, 1.0303, 0.104074, 0.328126, 1.05671, 0.102962, 0.152793, 1.04543, -0.099421, 0.118892, 1.00944, -0, 0.118892, 0.808529, 0, 0.118892, 1.01432, -0.07925, 0.118892, 0.804636, -0.157737, 0.118892, 0.792994, -0.197884, 0.118892, 0.994829, -0.294441, 0.118892, 0.970643, -0.234704, 0.118892, 0.773714, -0.388163, 0.118892, 0.937109, -0.309411, 0.118892, 0.746984, -0.478147, 0.118892, 0.89455, -0.381138, 0.118892, 0.713059, -0.449195, 0.118892, 0.672268, -0.563526, 0.118892, 0.843376, -0.643477, 0.118892, 0.784079, -0.512926, 0.118892, 0.625002, -0.717232, 0.118892, 0.717232, -0.571717, 0.118892, 0.571716, -0.78408, 0.118892, 0.643477, -0.625002, 0.118892, 0.512925, -0.843376, 0.118892, 0.563525, -0.672268, 0.118892, 0.449195, -0.89455, 0.118892, 0.478146, -0.71306, 0.118892, 0.381138, -0.937109, 0.118892, 0.388163, -0.746984, 0.118892, 0.309411, -0.970643, 0.118892, 0.294441, -0.773715, 0.118892, 0.234703, -0.792994, 0.118892, 0.157736, -0.99483, 0.118892, 0.197883, -1.00944, 0.118892, 0.09942, -0.804636, 0.118892, 0.079249, -1.01432, 0.118892, -1e-06, -0.80853, 0.118892, -1e-06, -1.00944, 0.118892, -0.099421, -0.804636, 0.118892, -0.07925, -0.994829, 0.118892, -0.197884, -0.792994, 0.118892, -0.157737, -0.970643, 0.118892, -0.294442, -0.773715, 0.118892, -0.234704, -0.937109, 0.118892, -0.388164, -0.746984, 0.118892, -0.309412, -0.89455, 0.118892, -0.478147, -0.713059, 0.118892, -0.381139, -0.672268, 0.118892, -0.449195, -0.843376, 0.118892, -0.563526, -0.625002, 0.118892, -0.512926, -0.78408, 0.118892, -0.643477, -0.717232, 0.118892, -0.717232, -0.571717, 0.118892, -0.571717, -0.512926, 0.118892, -0.625002, -0.643478, 0.118892, -0.784079, -0.563526, 0.118892, -0.843375, -0.449196, 0.118892, -0.672268, -0.381139, 0.118892, -0.713059, -0.478148, 0.118892, -0.894549, -0.309412, 0.118892, -0.746984, -0.388164, 0.118892, -0.937108, -0.234705, 0.118892, -0.773714, -0.294443, 0.118892, -0.970643, -0.157738, 0.118892, -0.792994, -0.197885, 0.118892, -0.994829, -0.099422, 0.118892, -1.00944, -0.079251, 0.118892, -0.804636, -2e-06, 0.118892, -0.80853, -2e-06, 0.118892, -1.01432, 0.099419, 0.118892, -1.00944, 0.079248, 0.118892, -0.804636, 0.157734, 0.118892, -0.792994, 0.197882, 0.118892, -0.99483, 0.294439, 0.118892, -0.970644, 0.234702, 0.118892, -0.773715, 0.309409, 0.118892, -0.746985, 0.388161, 0.118892, -0.93711, 0.478144, 0.118892, -0.894551, 0.381136, 0.118892, -0.71306, 0.563523, 0.118892, -0.843377, 0.449193, 0.118892, -0.672269, 0.643475, 0.118892, -0.784081, 0.512924, 0.118892, -0.625003, 0.709871, 0.118892, -0.72424, 0.564356, 0.118892, -0.578724, 0.564358, 0.118892, 0.578723, 0.643476, 0.118892, 0.78408, 0.512925, 0.118892, 0.625002, 0.709873, 0.118892, 0.724238, 0.563524, 0.118892, 0.843376, 0.449194, 0.118892, 0.672268, 0.478145, 0.118892, 0.894551, 0.381137, 0.118892, 0.71306, 0.388161, 0.118892, 0.93711, 0.309409, 0.118892, 0.746984, 0.294439, 0.118892, 0.970644, 0.234702, 0.118892, 0.773715, 0.197881, 0.118892, 0.99483, 0.157734, 0.118892, 0.792994, 0.099418, 0.118892, 1.00944, 0.079247, 0.118892, 0.804636, -0.077884, 0.104959, 0.79077, -0.077884, 0.01016, 0.79077, -0, 0.104959, 0.794596, -0, 0.01016, 0.794596, -0.155018, 0.01016, 0.779328, -0.155018, 0.104959, 0.779328, -0.230659, 0.104959, 0.760381, -0.230659, 0.01016, 0.760381, -0.304079, 0.104959, 0.734111, -0.304079, 0.01016, 0.734111, -0.37457, 0.01016, 0.700771, -0.37457, 0.104959, 0.700771, -0.441454, 0.104959, 0.660682, -0.441454, 0.01016, 0.660682, -0.504087, 0.01016, 0.614231, -0.504087, 0.104959, 0.614231, -0.561865, 0.104959, 0.561864, -0.561865, 0.01016, 0.561864, -0.614231, 0.104959, 0.504086, -0.614231, 0.01016, 0.504086, -0.660683, 0.104959, 0.441454, -0.660683, 0.01016, 0.441454, -0.700772, 0.104959, 0.37457, -0.700772, 0.01016, 0.37457, -0.734111, 0.104959, 0.304078, -0.734111, 0.01016, 0.304078, -0.760381, 0.01016, 0.230659, -0.760381, 0.104959, 0.230659, -0.779329, 0.104959, 0.155018, -0.779329, 0.01016, 0.155018, -0.79077, 0.01016, 0.077884, -0.79077, 0.104959, 0.077884, -0.794596, 0.104959, -1e-06, -0.794596, 0.01016, -1e-06, -0.79077, 0.104959, -0.077885, -0.79077, 0.01016, -0.077885, -0.779328, 0.01016, -0.155019, -0.779328, 0.104959, -0.155019, -0.760381, 0.104959, -0.230659, -0.760381, 0.01016, -0.230659, -0.734111, 0.104959, -0.304079, -0.734111, 0.01016, -0.304079, -0.700771, 0.104959, -0.374571, -0.700771, 0.01016, -0.374571, -0.660683, 0.104959, -0.441454, -0.660683, 0.01016, -0.441454, -0.614231, 0.104959, -0.504087, -0.614231, 0.01016, -0.504087, -0.561865, 0.104959, -0.561864, -0.561865, 0.01016, -0.561864, -0.504087, 0.104959, -0.614231, -0.504087, 0.01016, -0.614231, -0.441455, 0.104959, -0.660682, -0.441455, 0.01016, -0.660682, -0.374571, 0.104959, -0.700771, -0.374571, 0.01016, -0.700771, -0.30408, 0.104959, -0.734111, -0.30408, 0.01016, -0.734111, -0.23066, 0.104959, -0.760381, -0.23066, 0.01016, -0.760381, -0.155019, 0.01016, -0.779328, -0.155019, 0.104959, -0.779328, -0.077885, 0.104959, -0.79077, -0.077885, 0.01016, -0.79077, -2e-06, 0.104959, -0.794596, -2e-06, 0.01016, -0.794596, 0.077882, 0.104959, -0.79077, 0.077882, 0.01016, -0.79077, 0.155016, 0.104959, -0.779329, 0.155016, 0.01016, -0.779329, 0.230657, 0.104959, -0.760382, 0.230657, 0.01016, -0.760382, 0.304077, 0.01016, -0.734112, 0.304077, 0.104959, -0.734112, 0.374568, 0.104959, -0.700772, 0.374568, 0.01016, -0.700772, 0.441452, 0.104959, -0.660684, 0.441452, 0.01016, -0.660684, 0.504084, 0.104959, -0.614233, 0.504084, 0.01016, -0.614233, 0.554504, 0.104959, -0.568872, 0.554504, 0.01016, -0.568872, 0.504085, 0.104959, 0.614231, 0.504085, 0.01016, 0.614231, 0.554505, 0.104959, 0.56887, 0.554505, 0.01016, 0.56887, 0.441453, 0.104959, 0.660683, 0.441453, 0.01016, 0.660683, 0.374569, 0.01016, 0.700772, 0.374569, 0.104959, 0.700772, 0.304077, 0.104959, 0.734112, 0.304077, 0.01016, 0.734112, 0.230657, 0.104959, 0.760381, 0.230657, 0.01016, 0.760381, 0.155016, 0.01016, 0.779329, 0.155016, 0.104959, 0.779329, 0.077882, 0.104959, 0.79077, 0.077882, 0.01016, 0.79077, 0.847571, 0, -1.03278, 0.51053, -0, -0.622087, 0.561688, -0, -0.576056, 0.937361, 0, -0.951732, 0.447096, -0, -0.669132, 0.742261, 0, -1.11088, 0.629802, 0, -1.17828, 0.379357, -0, -0.709733, 0.511277, 0, -1.23434, 0.307965, -0, -0.743499, 0.387829, 0, -1.27851, 0.233606, -0, -0.770104, 0.156998, -0, -0.789293, 0.260646, 0, -1.31037, 0.130952, 0, -1.32961, 0.078878, -0, -0.800881, -2e-06, -0, -0.804756, -2e-06, 0, -1.33604, -0.130957, 0, -1.32961, -0.078881, -0, -0.800881, -0.157001, -0, -0.789293, -0.26065, 0, -1.31037, -0.387833, 0, -1.27851, -0.23361, -0, -0.770103, -0.511282, 0, -1.23434, -0.307968, -0, -0.743497, -0.629806, 0, -1.17828, -0.37936, -0, -0.709731, -0.447099, -0, -0.66913, -0.742265, 0, -1.11088, -0.510532, -0, -0.622085, -0.847575, 0, -1.03277, -0.944723, 0, -0.944723, -0.569049, -0, -0.569049, -0.622085, -0, -0.510532, -1.03277, 0, -0.847575, -0.669131, -0, -0.447099, -1.11088, 0, -0.742264, -1.17828, 0, -0.629805, -0.709732, -0, -0.37936, -0.743498, -0, -0.307968, -1.23434, 0, -0.511281, -0.770104, -0, -0.233609, -1.27851, 0, -0.387833, -0.789293, -0, -0.157001, -1.31037, 0, -0.260649, -1.32961, 0, -0.130955, -0.800881, -0, -0.07888, -0.804756, -0, -1e-06, -1.33604, -0, -1e-06, -0.800881, -0, 0.07888, -1.32961, -0, 0.130954, -0.789293, -0, 0.157, -1.31037, -0, 0.260648, -1.27851, -0, 0.387832, -0.770104, -0, 0.233608, -0.743498, -0, 0.307967, -1.23434, -0, 0.51128, -0.709732, -0, 0.379359, -1.17828, -0, 0.629805, -0.669131, -0, 0.447098, -1.11088, -0, 0.742264, -0.622085, -0, 0.510532, -1.03277, -0, 0.847575, -0.569049, -0, 0.569048, -0.944723, -0, 0.944723, -0.510532, -0, 0.622085, -0.847575, -0, 1.03277, -0.447099, -0, 0.66913, -0.742264, -0, 1.11088, -0.629805, -0, 1.17828, -0.37936, -0, 0.709731, -0.307967, -0, 0.743498, -0.51128, -0, 1.23434, -0.233609, -0, 0.770104, -0.387832, -0, 1.27851, -0.260649, -0, 1.31037, -0.157, -0, 0.789293, -0.130955, -0, 1.32961, -0.07888, -0, 0.800881, -0, -0, 0.804756, -0, -0, 1.33604, 0.130951, -0, 1.32961, 0.078877, -0, 0.800881, 0.156998, -0, 0.789293, 0.260645, -0, 1.31037, 0.387829, -0, 1.27851, 0.233606, -0, 0.770104, 0.307965, -0, 0.743498, 0.511278, -0, 1.23434, 0.379358, -0, 0.709732, 0.629803, -0, 1.17828, 0.742263, -0, 1.11088, 0.447097, -0, 0.669131, 0.847574, -0, 1.03277, 0.510531, -0, 0.622085, 0.561689, -0, 0.576055, 0.937364, -0, 0.951729, 0.876144, 0.323348, -0.87615, 0.749787, 0.148128, -0.749792, 0.757805, 0.323461, -0.757811, 0.887838, 0.142242, -0.887844, 0.854055, 0.351867, 0.854057, 0.779234, 0.351867, 0.779235, 0.757807, 0.323461, 0.757809, 0.876146, 0.323348, 0.876147, -0.693806, 0.328196, 1.03835, -0.693806, 0.328196, 1.03835, -1.03835, 0.328196, 0.693806, -1.03835, 0.328196, 0.693806, -1.03835, 0.328196, 0.693806, -1.03835, 0.328196, -0.693806, -1.03835, 0.328196, -0.693806, -1.03835, 0.328196, -0.693806, -0.693807, 0.328196, -1.03835, -0.693807, 0.328196, -1.03835, -0.693807, 0.328196, -1.03835, 0.693803, 0.328196, -1.03836, 0.693803, 0.328196, -1.03836, 0.693805, 0.328196, 1.03835, 0.693805, 0.328196, 1.03835, -0.12732, 0.096794, 1.29271, -0.12732, 0.096794, 1.29271, -0.12732, 0.096794, 1.29271, -0.978225, 0.145794, 0.802808, -0.978225, 0.145794, 0.802808, -0.978225, 0.145794, 0.802808, -1.29271, 0.096794, 0.12732, -1.29271, 0.096794, 0.12732, -1.29271, 0.096794, 0.12732, -1.2927, 0.096794, -0.127321, -1.2927, 0.096794, -0.127321, -1.2927, 0.096794, -0.127321, -0.802809, 0.145794, -0.978224, -0.802809, 0.145794, -0.978224, -0.802809, 0.145794, -0.978224, -0.127322, 0.096794, -1.2927, -0.127322, 0.096794, -1.2927, -0.127322, 0.096794, -1.2927, 0.127318, 0.096794, -1.29271, 0.127318, 0.096794, -1.29271, 0.127318, 0.096794, -1.29271, 0.127317, 0.096794, 1.29271, 0.127317, 0.096794, 1.29271, 0.127317, 0.096794, 1.29271, -1.32731, 0.079439, 0.130728, -1.32731, 0.079439, 0.130728, -1.32731, 0.079439, 0.130728, -1.32731, 0.079439, -0.130729, -1.32731, 0.079439, -0.130729, -1.32731, 0.079439, -0.130729, -0.130731, 0.079439, -1.32731, -0.130731, 0.079439, -1.32731, -0.130731, 0.079439, -1.32731, 0.130726, 0.079439, -1.32731, 0.130726, 0.079439, -1.32731, 0.130726, 0.079439, -1.32731, 0.130725, 0.079439, 1.32731, 0.130725, 0.079439, 1.32731, 0.130725, 0.079439, 1.32731, -0.07888, -0, 0.800881, -0, -0, 0.804756, -0.157, -0, 0.789293, -0.233609, -0, 0.770104, -0.307967, -0, 0.743498, -0.37936, -0, 0.709731, -0.447099, -0, 0.66913, -0.510532, -0, 0.622085, -0.569049, -0, 0.569048, -0.622085, -0, 0.510532, -0.669131, -0, 0.447098, -0.709732, -0, 0.379359, -0.743498, -0, 0.307967, -0.770104, -0, 0.233608, -0.789293, -0, 0.157, -0.800881, -0, 0.07888, -0.804756, -0, -1e-06, -0.800881, -0, -0.07888, -0.789293, -0, -0.157001, -0.770104, -0, -0.233609, -0.743498, -0, -0.307968, -0.709732, -0, -0.37936, -0.669131, -0, -0.447099, -0.622085, -0, -0.510532, -0.569049, -0, -0.569049, -0.510532, -0, -0.622085, -0.447099, -0, -0.66913, -0.37936, -0, -0.709731, -0.307968, -0, -0.743497, -0.23361, -0, -0.770103, -0.157001, -0, -0.789293, -0.078881, -0, -0.800881, -2e-06, -0, -0.804756, 0.078878, -0, -0.800881, 0.156998, -0, -0.789293, 0.233606, -0, -0.770104, 0.307965, -0, -0.743499, 0.379357, -0, -0.709733, 0.447096, -0, -0.669132, 0.51053, -0, -0.622087, 0.561688, -0, -0.576056, 0.510531, -0, 0.622085, 0.561689, -0, 0.576055, 0.447097, -0, 0.669131, 0.379358, -0, 0.709732, 0.307965, -0, 0.743498, 0.233606, -0, 0.770104, 0.156998, -0, 0.789293, 0.078877, -0, 0.800881, 0.94472, 0.056396, -0.944726, 0.94472, 0.056396, -0.944726, 0.943232, 0.012264, -0.943238, 0.938053, 0.071638, -0.938059, 0.913622, 0.088882, -0.913628, 0.876144, 0.323348, -0.87615, 0.887838, 0.142242, -0.887844, 0.779232, 0.351867, -0.779237, 0.854053, 0.351867, -0.854059, 0.757805, 0.323461, -0.757811, 0.749787, 0.148128, -0.749792, 0.72007, 0.108732, -0.720075, 0.571868, 0.109163, -0.571872, 0.571868, 0.109163, -0.571872, 0.570534, 0.012264, -0.570538, 0.570534, 0.012264, -0.570538, 0.937361, 0, -0.951732, 0.570534, 0.012264, -0.570538, 0.943232, 0.012264, -0.943238, 0.849481, 0.362027, -0.86385, 0.757805, 0.323461, -0.757811, 0.749787, 0.148128, -0.749792, 0.564356, 0.118892, -0.578724, 0.570534, 0.012264, -0.570538, 0.561688, -0, -0.576056, 0.854053, 0.351867, -0.854059, 0.779232, 0.351867, -0.779237, 0.943232, 0.012264, -0.943238, 0.570534, 0.012264, -0.570538, 0.72007, 0.108732, -0.720075, 0.913622, 0.088882, -0.913628, 0.94472, 0.056396, -0.944726, 0.938053, 0.071638, -0.938059, 0.944722, 0.056396, 0.944724, 0.944722, 0.056396, 0.944724, 0.943234, 0.012264, 0.943236, 0.938055, 0.071638, 0.938057, 0.913624, 0.088882, 0.913626, 0.876146, 0.323348, 0.876147, 0.88784, 0.142241, 0.887841, 0.779234, 0.351867, 0.779235, 0.854055, 0.351867, 0.854057, 0.757807, 0.323461, 0.757809, 0.749789, 0.148128, 0.74979, 0.57187, 0.109163, 0.571871, 0.720072, 0.108732, 0.720073, 0.570536, 0.012264, 0.570537, 0.57187, 0.109163, 0.571871, 0.943234, 0.012264, 0.943236, 0.570536, 0.012264, 0.570537, 0.937364, -0, 0.951729, 0.570536, 0.012264, 0.570537, 0.849483, 0.362027, 0.863848, 0.757807, 0.323461, 0.757809, 0.564358, 0.118892, 0.578723, 0.561689, -0, 0.576055, 0.570536, 0.012264, 0.570537, 0.571868, 0.109163, -0.571872, 0.749789, 0.148128, 0.74979, 0.88784, 0.142241, 0.887841, 0.720072, 0.108732, 0.720073, 0.913624, 0.088882, 0.913626, 0.943234, 0.012264, 0.943236, 0.944722, 0.056396, 0.944724, 0.938055, 0.071638, 0.938057, 0.570536, 0.012264, 0.570537, 0.57187, 0.109163, 0.571871, 0.66129, 2.04799, -0.820795, 0.705763, 1.98083, -0.820796, 0.722923, 2.09331, -0.736391, 0.771541, 2.01989, -0.736391, 0.610449, 2.11047, -0.820795, 0.667344, 2.16161, -0.736391, 0.553729, 2.16766, -0.820795, 0.605337, 2.22413, -0.736391, 0.537501, 2.28028, -0.736391, 0.491676, 2.21902, -0.820795, 0.424888, 2.26405, -0.820795, 0.464488, 2.3295, -0.736391, 0.387002, 2.37133, -0.736391, 0.354008, 2.30231, -0.820795, 0.305789, 2.40537, -0.736391, 0.279718, 2.33345, -0.820795, 0.221631, 2.43128, -0.736391, 0.202735, 2.35715, -0.820795, 0.135338, 2.44881, -0.736391, 0.1238, 2.37319, -0.820795, 0.047742, 2.45781, -0.736391, 0.043672, 2.38142, -0.820795, -0.040313, 2.45817, -0.736391, -0.036876, 2.38175, -0.820795, -0.11707, 2.37419, -0.820795, -0.127981, 2.4499, -0.736391, -0.196136, 2.3588, -0.820795, -0.214416, 2.43308, -0.736391, -0.273312, 2.33574, -0.820795, -0.298786, 2.40787, -0.736391, -0.347857, 2.30522, -0.820795, -0.380278, 2.37451, -0.736391, -0.458108, 2.33332, -0.736391, -0.419052, 2.26755, -0.820795, -0.486211, 2.22307, -0.820795, -0.531527, 2.28471, -0.736391, -0.599826, 2.22913, -0.736391, -0.548687, 2.17223, -0.820795, -0.60588, 2.11551, -0.820795, -0.662349, 2.16712, -0.736391, -0.657237, 2.05346, -0.820795, -0.718493, 2.09928, -0.736391, -0.702265, 1.98667, -0.820795, -0.767717, 2.02627, -0.736391, -0.74053, 1.91579, -0.820795, -0.809548, 1.94879, -0.736391, -0.843583, 1.86757, -0.736391, -0.771663, 1.8415, -0.820795, -0.869493, 1.78341, -0.736391, -0.795364, 1.76452, -0.820795, -0.88703, 1.69712, -0.736391, -0.811406, 1.68558, -0.820795, -0.896024, 1.60953, -0.736391, -0.819633, 1.60545, -0.820795, -0.896389, 1.52147, -0.736391, -0.819967, 1.52491, -0.820795, -0.812404, 1.44471, -0.820795, -0.888121, 1.4338, -0.736391, -0.797017, 1.36565, -0.820795, -0.871301, 1.34737, -0.736391, -0.773955, 1.28847, -0.820795, -0.846089, 1.263, -0.736391, -0.743439, 1.21393, -0.820795, -0.812729, 1.18151, -0.736391, -0.705763, 1.14273, -0.820795, -0.771541, 1.10368, -0.736391, 0.829889, 2.05454, -0.644895, 0.777595, 2.13351, -0.644895, 0.717812, 2.20697, -0.644895, 0.651116, 2.27422, -0.644895, 0.578149, 2.33461, -0.644895, 0.499615, 2.38756, -0.644895, 0.416269, 2.43255, -0.644895, 0.328914, 2.46916, -0.644895, 0.238392, 2.49703, -0.644895, 0.145573, 2.51589, -0.644895, 0.051353, 2.52557, -0.644895, -0.043362, 2.52596, -0.644895, -0.137659, 2.51707, -0.644895, -0.230631, 2.49898, -0.644895, -0.321381, 2.47186, -0.644895, -0.409037, 2.43598, -0.644895, -0.492753, 2.39167, -0.644895, -0.571723, 2.33938, -0.644895, -0.645188, 2.27959, -0.644895, -0.712439, 2.2129, -0.644895, -0.772829, 2.13993, -0.644895, -0.825776, 2.0614, -0.644895, -0.870771, 1.97805, -0.644895, -0.907379, 1.8907, -0.644895, -0.935249, 1.80017, -0.644895, -0.954112, 1.70736, -0.644895, -0.963786, 1.61314, -0.644895, -0.964179, 1.51842, -0.644895, -0.955286, 1.42412, -0.644895, -0.937193, 1.33115, -0.644895, -0.910074, 1.2404, -0.644895, -0.874192, 1.15275, -0.644895, -0.829889, 1.06903, -0.644895, 0.756822, 2.26502, -0.526914, 0.690624, 2.31745, -0.547188, 0.61323, 2.38151, -0.547188, 0.529931, 2.43766, -0.547188, 0.441527, 2.48539, -0.547188, 0.348872, 2.52422, -0.547188, 0.252857, 2.55378, -0.547188, 0.154406, 2.57379, -0.547188, 0.054469, 2.58405, -0.547188, -0.045993, 2.58447, -0.547188, -0.146012, 2.57503, -0.547188, -0.244625, 2.55584, -0.547188, -0.340882, 2.52708, -0.547188, -0.433856, 2.48902, -0.547188, -0.522652, 2.44203, -0.547188, -0.606414, 2.38656, -0.547188, -0.684337, 2.32315, -0.547188, -0.755668, 2.25241, -0.547188, -0.819723, 2.17501, -0.547188, -0.875882, 2.09171, -0.547188, -0.923607, 2.00331, -0.547188, -0.962437, 1.91066, -0.547188, -0.991998, 1.81464, -0.547188, -1.012, 1.71619, -0.547188, -1.02227, 1.61625, -0.547188, -1.02268, 1.51579, -0.547188, -1.01325, 1.41577, -0.547188, -0.99406, 1.31716, -0.547188, -0.965296, 1.2209, -0.547188, -0.927235, 1.12793, -0.547188, -0.880245, 1.03913, -0.547188, 0.555142, 2.47934, -0.444211, 0.662517, 2.4236, -0.403546, 0.462533, 2.52933, -0.444211, 0.36547, 2.57001, -0.444211, 0.264886, 2.60098, -0.444211, 0.161752, 2.62194, -0.444211, 0.05706, 2.63268, -0.444211, -0.048181, 2.63312, -0.444211, -0.152959, 2.62324, -0.444211, -0.256263, 2.60314, -0.444211, -0.3571, 2.573, -0.444211, -0.454497, 2.53313, -0.444211, -0.547518, 2.48391, -0.444211, -0.635265, 2.4258, -0.444211, -0.716895, 2.35937, -0.444211, -0.79162, 2.28526, -0.444211, -0.858722, 2.20419, -0.444211, -0.917553, 2.11693, -0.444211, -0.967549, 2.02432, -0.444211, -1.00823, 1.92725, -0.444211, -1.03919, 1.82667, -0.444211, -1.06015, 1.72354, -0.444211, -1.0709, 1.61884, -0.444211, -1.07134, 1.5136, -0.444211, -1.06146, 1.40883, -0.444211, -1.04135, 1.30552, -0.444211, -1.04135, 1.30552, -0.444211, -1.04135, 1.30552, -0.444211, -1.01122, 1.20468, -0.444211, -0.97135, 1.10729, -0.444211, -0.922124, 1.01427, -0.444211, 0.479085, 2.56396, -0.336957, 0.575008, 2.51217, -0.336957, 0.378548, 2.60609, -0.336957, 0.378548, 2.60609, -0.336957, 0.274365, 2.63816, -0.336957, 0.378548, 2.60609, -0.336957, 0.16754, 2.65987, -0.336957, 0.059102, 2.67101, -0.336957, -0.049905, 2.67146, -0.336957, -0.158432, 2.66122, -0.336957, -0.265434, 2.6404, -0.336956, -0.369878, 2.60919, -0.336956, -0.470761, 2.56789, -0.336956, -0.56711, 2.51691, -0.336956, -0.657998, 2.45672, -0.336956, -0.742548, 2.38791, -0.336956, -0.742548, 2.38791, -0.336956, -0.819948, 2.31115, -0.336956, -0.742548, 2.38791, -0.336956, -0.889451, 2.22718, -0.336956, -0.950388, 2.13679, -0.336956, -1.00217, 2.04087, -0.336956, -1.0443, 1.94033, -0.336956, -1.07638, 1.83615, -0.336956, -1.09809, 1.72932, -0.336956, -1.10922, 1.62089, -0.336956, -1.10968, 1.51188, -0.336956, -1.09944, 1.40335, -0.336956, -1.04135, 1.30552, -0.444211, -1.04135, 1.30552, -0.444211, -1.07862, 1.29635, -0.336956, -1.04135, 1.30552, -0.444211, -1.04741, 1.19191, -0.336956, -1.00611, 1.09102, -0.336956, -0.955122, 0.994674, -0.336956, 0.491023, 2.58893, -0.226457, 0.599514, 2.53059, -0.218386, 0.387981, 2.63211, -0.226457, 0.378548, 2.60609, -0.336957, 0.281202, 2.66498, -0.226457, 0.378548, 2.60609, -0.336957, 0.378548, 2.60609, -0.336957, 0.171715, 2.68723, -0.226457, 0.060575, 2.69865, -0.226457, -0.051149, 2.69911, -0.226457, -0.16238, 2.68862, -0.226457, -0.272048, 2.66728, -0.226457, -0.379095, 2.63529, -0.226457, -0.482492, 2.59296, -0.226457, -0.581241, 2.5407, -0.226457, -0.674394, 2.47902, -0.226457, -0.742548, 2.38791, -0.336956, -0.761051, 2.4085, -0.226457, -0.742548, 2.38791, -0.336956, -0.761051, 2.4085, -0.226457, -0.840379, 2.32983, -0.226457, -0.761051, 2.4085, -0.226457, -0.742548, 2.38791, -0.336956, -0.911614, 2.24376, -0.226457, -0.974069, 2.15112, -0.226457, -1.02714, 2.05281, -0.226457, -1.07033, 1.94976, -0.226457, -1.1032, 1.84298, -0.226457, -1.12545, 1.7335, -0.226457, -1.13686, 1.62236, -0.226457, -1.13733, 1.51063, -0.226457, -1.12684, 1.3994, -0.226457, -1.10549, 1.28974, -0.226457, -1.07351, 1.18269, -0.226457, -1.03118, 1.07929, -0.226457, -0.978921, 0.980543, -0.226457, 0.393677, 2.64782, -0.113776, 0.498232, 2.60401, -0.113776, 0.285331, 2.68118, -0.113776, 0.174236, 2.70376, -0.113776, 0.061464, 2.71534, -0.113776, -0.0519, 2.71581, -0.113776, -0.164764, 2.70516, -0.113776, -0.276042, 2.68351, -0.113776, -0.384661, 2.65105, -0.113776, -0.489575, 2.6081, -0.113776, -0.589775, 2.55508, -0.113776, -0.684295, 2.49249, -0.113776, -0.761051, 2.4085, -0.226457, -0.772224, 2.42093, -0.113776, -0.852717, 2.3411, -0.113776, -0.924998, 2.25377, -0.113776, -0.98837, 2.15977, -0.113776, -1.04222, 2.06001, -0.113776, -1.08604, 1.95546, -0.113776, -1.1194, 1.84711, -0.113776, -1.14198, 1.73602, -0.113776, -1.15355, 1.62325, -0.113776, -1.15402, 1.50988, -0.113776, -1.14338, 1.39702, -0.113776, -1.12172, 1.28574, -0.113776, -1.08927, 1.17712, -0.113776, -1.04632, 1.07221, -0.113776, -0.993293, 0.972009, -0.113776, 0.395582, 2.65308, 0, 0.500643, 2.60905, 0, 0.286711, 2.6866, 0, 0.175079, 2.70928, 0, 0.061762, 2.72092, 0, -0.052151, 2.72139, 0, -0.165561, 2.7107, 0, -0.277377, 2.68894, 0, -0.386522, 2.65632, 0, -0.491944, 2.61316, 0, -0.592629, 2.55988, 0, -0.687606, 2.49699, 0, -0.775961, 2.42509, 0, -0.856843, 2.34487, 0, -0.929474, 2.25712, 0, -0.993153, 2.16266, 0, -1.04727, 2.06242, 0, -1.0913, 1.95737, 0, -1.12481, 1.84849, 0, -1.1475, 1.73686, 0, -1.15914, 1.62354, 0, -1.15961, 1.50963, 0, -1.14891, 1.39622, 0, -1.12715, 1.28441, 0, -1.09454, 1.17526, 0, -1.05138, 1.06984, 0, -0.998099, 0.969155, 0, 0.577082, 2.56802, -0, 0.583648, 2.55806, -0.111958, 0.626098, 2.48483, -0.31657, 0.70673, 2.34973, -0.473934, 0.811234, 2.1739, -0.559173, 0.868332, 2.07736, -0.570708, 0.596325, 2.52328, -0.103891, 0.550168, 2.4166, -0, 0.591101, 2.53208, -0, 0.554623, 2.4091, -0.088597, 0.611797, 2.49723, -0.20379, 0.567817, 2.38688, -0.17379, 0.636921, 2.45491, -0.295858, 0.589242, 2.3508, -0.252304, 0.670733, 2.39797, -0.376555, 0.618077, 2.30223, -0.321122, 0.711933, 2.32858, -0.442782, 0.653211, 2.24306, -0.3776, 0.758937, 2.24941, -0.491993, 0.693296, 2.17555, -0.419567, 0.80994, 2.16352, -0.522297, 0.736791, 2.10229, -0.445409, 0.86298, 2.07418, -0.53253, 0.782023, 2.02611, -0.454136, 0.527609, 2.38401, -0.087049, 0.53536, 2.39858, 0, 0.539737, 2.39121, -0.087049, 0.523232, 2.39138, 0, 0.540573, 2.36218, -0.170753, 0.5527, 2.36938, -0.170753, 0.561624, 2.32672, -0.247895, 0.573751, 2.33392, -0.247895, 0.589954, 2.27901, -0.315511, 0.602082, 2.28621, -0.315511, 0.636602, 2.22807, -0.371001, 0.624475, 2.22087, -0.371001, 0.675987, 2.16174, -0.412235, 0.663859, 2.15454, -0.412235, 0.718721, 2.08977, -0.437626, 0.706594, 2.08257, -0.437626, 0.763163, 2.01492, -0.4462, 0.751036, 2.00772, -0.4462, 0.506483, 2.38399, -0.089191, 0.389684, 2.4605, 0, 0.501998, 2.39154, 0, 0.395314, 2.45102, -0.111945, 0.519765, 2.36162, -0.174954, 0.411984, 2.42294, -0.219589, 0.541335, 2.32529, -0.253993, 0.411984, 2.42294, -0.219589, 0.411984, 2.42294, -0.219589, 0.439056, 2.37735, -0.318793, 0.570362, 2.2764, -0.323272, 0.475489, 2.31599, -0.405747, 0.605732, 2.21683, -0.380128, 0.519883, 2.24122, -0.477108, 0.646085, 2.14887, -0.422375, 0.570531, 2.15592, -0.530134, 0.689871, 2.07513, -0.448391, 0.625488, 2.06336, -0.562787, 0.735406, 1.99844, -0.457176, 0.68264, 1.96711, -0.573813, 0.23639, 2.5203, 0, 0.243291, 2.50868, -0.137245, 0.411984, 2.42294, -0.219589, 0.411984, 2.42294, -0.219589, 0.26373, 2.47425, -0.269216, 0.411984, 2.42294, -0.219589, 0.29692, 2.41835, -0.390841, 0.341587, 2.34313, -0.497446, 0.396013, 2.25146, -0.584934, 0.458108, 2.14688, -0.649944, 0.525485, 2.03341, -0.689977, 0.595554, 1.9154, -0.703494, 0.06202, 2.54849, 0, 0.070032, 2.535, -0.159342, 0.093761, 2.49503, -0.31256, 0.132295, 2.43013, -0.453766, 0.184153, 2.34279, -0.577535, 0.247343, 2.23637, -0.679109, 0.319435, 2.11495, -0.754585, 0.397659, 1.98321, -0.801063, 0.47901, 1.8462, -0.816757, -0.083659, 2.52852, -0.173842, -0.0924, 2.54324, 0, -0.057771, 2.48492, -0.341003, -0.01573, 2.41411, -0.495059, 0.040847, 2.31883, -0.63009, 0.109787, 2.20272, -0.740908, 0.188439, 2.07025, -0.823253, 0.273782, 1.92652, -0.87396, 0.362535, 1.77704, -0.891082, -0.240525, 2.49738, -0.184446, -0.2498, 2.513, 0, -0.213057, 2.45112, -0.361804, -0.168452, 2.37599, -0.525257, -0.108424, 2.27489, -0.668526, -0.035279, 2.15171, -0.786103, 0.048171, 2.01116, -0.873471, 0.13872, 1.85866, -0.927272, 0.232887, 1.70006, -0.945438, -0.401336, 2.43533, -0.190164, -0.410898, 2.45143, 0, -0.373016, 2.38763, -0.37302, -0.327029, 2.31018, -0.54154, -0.265139, 2.20595, -0.68925, -0.189727, 2.07894, -0.810472, -0.10369, 1.93404, -0.900549, -0.010334, 1.77681, -0.956017, 0.086752, 1.61329, -0.974747, -0.544542, 2.35919, -0.191685, -0.55418, 2.37543, 0, -0.515996, 2.31112, -0.376004, -0.46964, 2.23304, -0.545873, -0.407256, 2.12798, -0.694764, -0.33124, 1.99995, -0.816956, -0.244515, 1.85389, -0.907753, -0.150412, 1.6954, -0.963665, -0.052549, 1.53058, -0.982544, 0.506483, 2.38399, -0.089191, 0.501998, 2.39154, 0, 0.519765, 2.36162, -0.174954, 0.541335, 2.32529, -0.253993, 0.570362, 2.2764, -0.323272, 0.605732, 2.21683, -0.380128, 0.605732, 2.21683, -0.380128, 0.646085, 2.14887, -0.422375, 0.689871, 2.07513, -0.448391, 0.735406, 1.99844, -0.457176, 0.743438, 1.90964, -0.820796, 0.812728, 1.94206, -0.736391, 0.846088, 1.86057, -0.736391, 0.773955, 1.83509, -0.820796, 0.8713, 1.7762, -0.736391, 0.797017, 1.75792, -0.820796, 0.888121, 1.68976, -0.736391, 0.812404, 1.67885, -0.820796, 0.896389, 1.6021, -0.736391, 0.819966, 1.59866, -0.820796, 0.819633, 1.51811, -0.820796, 0.896024, 1.51404, -0.736391, 0.811405, 1.43798, -0.820796, 0.88703, 1.42645, -0.736391, 0.795364, 1.35905, -0.820796, 0.869493, 1.34015, -0.736391, 0.771662, 1.28207, -0.820796, 0.843582, 1.25599, -0.736391, 0.740529, 1.20777, -0.820795, 0.809548, 1.17478, -0.736391, 0.767717, 1.0973, -0.736391, 0.702264, 1.1369, -0.820795, 0.657236, 1.07011, -0.820795, 0.718492, 1.02428, -0.736391, 0.605879, 1.00805, -0.820795, 0.662348, 0.956446, -0.736391, 0.599825, 0.894439, -0.736391, 0.548686, 0.951334, -0.820795, 0.48621, 0.900493, -0.820795, 0.531526, 0.83886, -0.736391, 0.458107, 0.790242, -0.736391, 0.419051, 0.85602, -0.820795, 0.380277, 0.749055, -0.736391, 0.347856, 0.818345, -0.820795, 0.273311, 0.787829, -0.820795, 0.298784, 0.715695, -0.736391, 0.196134, 0.764766, -0.820795, 0.214414, 0.690483, -0.736391, 0.117068, 0.74938, -0.820795, 0.12798, 0.673662, -0.736391, 0.036875, 0.741817, -0.820795, 0.040312, 0.665394, -0.736391, -0.043673, 0.742151, -0.820795, -0.047743, 0.66576, -0.736391, -0.123801, 0.750378, -0.820795, -0.135339, 0.674754, -0.736391, -0.202736, 0.76642, -0.820795, -0.221632, 0.692291, -0.736391, -0.27972, 0.790122, -0.820795, -0.30579, 0.718201, -0.736391, -0.354008, 0.821255, -0.820795, -0.387003, 0.752236, -0.736391, -0.424888, 0.859519, -0.820795, -0.464489, 0.794067, -0.736391, -0.424888, 0.859519, -0.820795, -0.424888, 0.859519, -0.820795, -0.537501, 0.843291, -0.736391, -0.424888, 0.859519, -0.820795, -0.491676, 0.904547, -0.820795, -0.553729, 0.955904, -0.820795, -0.605337, 0.899435, -0.736391, -0.667344, 0.961958, -0.736391, -0.610449, 1.0131, -0.820795, -0.722924, 1.03026, -0.736391, -0.66129, 1.07557, -0.820795, -0.771541, 1.10368, -0.736391, -0.705763, 1.14273, -0.820795, 0.874191, 1.97082, -0.644895, 0.910074, 1.88316, -0.644895, 0.937193, 1.79241, -0.644895, 0.955286, 1.69944, -0.644895, 0.964179, 1.60514, -0.644895, 0.963786, 1.51043, -0.644895, 0.954112, 1.41621, -0.644895, 0.935249, 1.32339, -0.644895, 0.907379, 1.23287, -0.644895, 0.87077, 1.14551, -0.644895, 0.825775, 1.06217, -0.644895, 0.772828, 0.983634, -0.644895, 0.712438, 0.910667, -0.644895, 0.645187, 0.843971, -0.644895, 0.571722, 0.784188, -0.644895, 0.492752, 0.731894, -0.644895, 0.409036, 0.687592, -0.644895, 0.32138, 0.651709, -0.644895, 0.23063, 0.624591, -0.644895, 0.137658, 0.606498, -0.644895, 0.043361, 0.597605, -0.644895, -0.051354, 0.597997, -0.644895, -0.145574, 0.607672, -0.644895, -0.145574, 0.607672, -0.644895, -0.145574, 0.607672, -0.644895, -0.238393, 0.626535, -0.644895, -0.328915, 0.654405, -0.644895, -0.41627, 0.691014, -0.644895, -0.499616, 0.736008, -0.644895, -0.57815, 0.788955, -0.644895, -0.651116, 0.849345, -0.644895, -0.717812, 0.916596, -0.644895, -0.777595, 0.990061, -0.644895, -0.829889, 1.06903, -0.644895, 0.979712, 1.88963, -0.526915, 0.99406, 1.80641, -0.547188, 1.01325, 1.7078, -0.547188, 1.02268, 1.60778, -0.547188, 1.02227, 1.50731, -0.547188, 1.012, 1.40738, -0.547188, 1.012, 1.40738, -0.547188, 0.991997, 1.30893, -0.547188, 1.012, 1.40738, -0.547188, 0.962436, 1.21291, -0.547188, 0.923606, 1.12026, -0.547188, 0.875882, 1.03185, -0.547188, 0.819722, 0.948553, -0.547188, 0.755667, 0.871159, -0.547188, 0.684336, 0.800416, -0.547188, 0.606413, 0.737006, -0.547188, 0.522651, 0.681538, -0.547188, 0.433855, 0.634548, -0.547188, 0.340881, 0.596488, -0.547188, 0.244624, 0.567724, -0.547188, 0.146011, 0.548533, -0.547188, 0.045992, 0.539101, -0.547188, -0.05447, 0.539517, -0.547188, -0.145574, 0.607672, -0.644895, -0.145574, 0.607672, -0.644895, -0.154408, 0.549779, -0.547188, -0.145574, 0.607672, -0.644895, -0.252858, 0.569786, -0.547188, -0.348873, 0.599347, -0.547188, -0.441528, 0.638177, -0.547188, -0.529931, 0.685902, -0.547188, -0.613231, 0.742062, -0.547188, -0.690624, 0.806116, -0.547188, -0.761367, 0.877447, -0.547188, -0.824778, 0.95537, -0.547188, -0.880245, 1.03913, -0.547188, 1.0738, 1.73092, -0.403546, 1.07134, 1.60996, -0.444211, 1.0709, 1.50472, -0.444211, 1.012, 1.40738, -0.547188, 1.06015, 1.40003, -0.444211, 1.012, 1.40738, -0.547188, 1.03919, 1.2969, -0.444211, 1.012, 1.40738, -0.547188, 1.00822, 1.19631, -0.444211, 0.967548, 1.09925, -0.444211, 0.917553, 1.00664, -0.444211, 0.858721, 0.919378, -0.444211, 0.791619, 0.838302, -0.444211, 0.716893, 0.764193, -0.444211, 0.791619, 0.838302, -0.444211, 0.635264, 0.697766, -0.444211, 0.547516, 0.63966, -0.444211, 0.454496, 0.590434, -0.444211, 0.357098, 0.550563, -0.444211, 0.256262, 0.52043, -0.444211, 0.152957, 0.500327, -0.444211, 0.04818, 0.490445, -0.444211, -0.057062, 0.490882, -0.444211, -0.161754, 0.501631, -0.444211, -0.264888, 0.522591, -0.444211, -0.365471, 0.553559, -0.444211, -0.462534, 0.594236, -0.444211, -0.555143, 0.644231, -0.444211, -0.642406, 0.703063, -0.444211, -0.723482, 0.770164, -0.444211, -0.79759, 0.84489, -0.444211, -0.864017, 0.926519, -0.444211, -0.922124, 1.01427, -0.444211, 1.10968, 1.61169, -0.336957, 1.10922, 1.50268, -0.336957, 1.09809, 1.39424, -0.336957, 1.07638, 1.28742, -0.336957, 1.0443, 1.18324, -0.336957, 1.00217, 1.0827, -0.336957, 0.950387, 0.986775, -0.336957, 0.88945, 0.896389, -0.336957, 0.791619, 0.838302, -0.444211, 0.819947, 0.812412, -0.336957, 0.791619, 0.838302, -0.444211, 0.742547, 0.735652, -0.336957, 0.791619, 0.838302, -0.444211, 0.791619, 0.838302, -0.444211, 0.657997, 0.666847, -0.336957, 0.567109, 0.606662, -0.336957, 0.47076, 0.555674, -0.336957, 0.369877, 0.514377, -0.336957, 0.265432, 0.483166, -0.336957, 0.158431, 0.462343, -0.336957, 0.049904, 0.452108, -0.336957, -0.059104, 0.45256, -0.336957, -0.167542, 0.463694, -0.336957, -0.274367, 0.485404, -0.336957, -0.378549, 0.517479, -0.336957, -0.479086, 0.559612, -0.336956, -0.575009, 0.611397, -0.336956, -0.665394, 0.672333, -0.336956, -0.749371, 0.741836, -0.336956, -0.826132, 0.819236, -0.336956, -0.826132, 0.819236, -0.336956, -0.894936, 0.903786, -0.336956, -0.826132, 0.819236, -0.336956, -0.955122, 0.994674, -0.336956, 1.13758, 1.62439, -0.218386, 1.13686, 1.50121, -0.226457, 1.12545, 1.39007, -0.226457, 1.1032, 1.28058, -0.226457, 1.07033, 1.1738, -0.226457, 1.02714, 1.07076, -0.226457, 0.974069, 0.972447, -0.226457, 0.911613, 0.879809, -0.226457, 0.840378, 0.793739, -0.226457, 0.76105, 0.715066, -0.226457, 0.674393, 0.644547, -0.226457, 0.58124, 0.582862, -0.226457, 0.48249, 0.530604, -0.226457, 0.379094, 0.488277, -0.226457, 0.272046, 0.456289, -0.226457, 0.162379, 0.434947, -0.226457, 0.051148, 0.424457, -0.226457, -0.060576, 0.42492, -0.226457, -0.171717, 0.436332, -0.226457, -0.171717, 0.436332, -0.226457, -0.171717, 0.436332, -0.226457, -0.281203, 0.458583, -0.226457, -0.387982, 0.491458, -0.226457, -0.491024, 0.53464, -0.226457, -0.589337, 0.587715, -0.226457, -0.681974, 0.65017, -0.226457, -0.768044, 0.721405, -0.226457, -0.846717, 0.800733, -0.226457, -0.826132, 0.819236, -0.336956, -0.917236, 0.88739, -0.226457, -0.826132, 0.819236, -0.336956, -0.826132, 0.819236, -0.336956, -0.978921, 0.980543, -0.226457, 1.15355, 1.50032, -0.113776, 1.14198, 1.38755, -0.113776, 1.1194, 1.27645, -0.113776, 1.08604, 1.16811, -0.113776, 1.04222, 1.06355, -0.113776, 0.98837, 0.963795, -0.113776, 0.924997, 0.869797, -0.113776, 0.852716, 0.782463, -0.113776, 0.772224, 0.702635, -0.113776, 0.684294, 0.631081, -0.113776, 0.589774, 0.56849, -0.113776, 0.489574, 0.515465, -0.113776, 0.384659, 0.472517, -0.113776, 0.27604, 0.440059, -0.113776, 0.164763, 0.418403, -0.113776, 0.051899, 0.407759, -0.113776, -0.061466, 0.408229, -0.113776, -0.171717, 0.436332, -0.226457, -0.171717, 0.436332, -0.226457, -0.174238, 0.419809, -0.113776, -0.171717, 0.436332, -0.226457, -0.285332, 0.442386, -0.113776, -0.393678, 0.475744, -0.113776, -0.498233, 0.51956, -0.113776, -0.597989, 0.573414, -0.113776, -0.691987, 0.636786, -0.113776, -0.77932, 0.709067, -0.113776, -0.859148, 0.789559, -0.113776, -0.930702, 0.877489, -0.113776, -0.993293, 0.972009, -0.113776, 1.15914, 1.50002, -0, 1.1475, 1.3867, -0, 1.12481, 1.27507, -0, 1.0913, 1.1662, -0, 1.04727, 1.06114, -0, 0.993152, 0.960901, -0, 0.929473, 0.866449, -0, 0.856842, 0.778692, -0, 0.77596, 0.698478, -0, 0.687605, 0.626578, -0, 0.592628, 0.563684, -0, 0.491943, 0.510402, -0, 0.386521, 0.467246, -0, 0.277376, 0.434631, 0, 0.16556, 0.412871, 0, 0.05215, 0.402175, 0, -0.061763, 0.402648, 0, -0.175081, 0.414283, 0, -0.286712, 0.43697, 0, -0.395583, 0.470489, 0, -0.500643, 0.514517, 0, -0.600883, 0.568632, 0, -0.695335, 0.632311, 0, -0.783091, 0.704941, 0, -0.863305, 0.785823, 0, -0.935205, 0.874178, 0, -0.998099, 0.969155, 0, 1.1597, 1.58678, -0, 1.15411, 1.5973, -0.111958, 1.11012, 1.66963, -0.31657, 1.11012, 1.66963, -0.31657, 1.03011, 1.8051, -0.473934, 0.925759, 1.98102, -0.559173, 0.925759, 1.98102, -0.559173, 0.925759, 1.98102, -0.559173, 0.925759, 1.98102, -0.559173, 1.00942, 1.64313, -0.088598, 1.13486, 1.61629, -0, 1.01388, 1.63563, -0, 1.12964, 1.62509, -0.103892, 0.99623, 1.66535, -0.17379, 1.11416, 1.65114, -0.20379, 0.974804, 1.70144, -0.252304, 1.08904, 1.69346, -0.295858, 1.05523, 1.7504, -0.376555, 0.94597, 1.75, -0.321122, 1.01403, 1.81979, -0.442782, 0.910835, 1.80917, -0.3776, 0.967024, 1.89895, -0.491993, 0.870751, 1.87668, -0.419567, 0.916021, 1.98485, -0.522297, 0.827256, 1.94993, -0.44541, 0.97884, 1.62405, -0, 0.98659, 1.63862, -0.087049, 0.990968, 1.63125, -0, 0.974463, 1.63142, -0.087049, 0.973627, 1.66046, -0.170753, 0.9615, 1.65325, -0.170753, 0.952575, 1.69591, -0.247895, 0.940448, 1.68871, -0.247895, 0.924245, 1.74362, -0.315511, 0.912118, 1.73642, -0.315511, 0.877597, 1.79456, -0.371001, 0.889724, 1.80176, -0.371001, 0.838213, 1.86089, -0.412235, 0.85034, 1.86809, -0.412235, 0.795478, 1.93287, -0.437626, 0.807606, 1.94007, -0.437626, 1.11012, 1.66963, -0.31657, 1.11012, 1.66963, -0.31657, 1.11012, 1.66963, -0.31657, 0.925759, 1.98102, -0.559173, 0.925759, 1.98102, -0.559173, 0.925759, 1.98102, -0.559173, 0.975597, 1.47371, -0, 0.964329, 1.61289, -0.089191, 0.968814, 1.60533, -0, 0.969968, 1.48319, -0.111946, 0.951047, 1.63526, -0.174954, 0.953297, 1.51127, -0.219589, 0.926224, 1.55686, -0.318793, 0.929477, 1.67158, -0.253993, 0.889791, 1.61822, -0.405747, 0.90045, 1.72047, -0.323272, 0.845398, 1.69299, -0.477108, 0.86508, 1.78004, -0.380128, 0.79475, 1.77829, -0.530134, 0.824727, 1.848, -0.422375, 0.739793, 1.87085, -0.562787, 0.780941, 1.92175, -0.448391, 0.954718, 1.3105, -0, 0.947817, 1.32212, -0.137245, 0.927378, 1.35654, -0.269216, 0.894188, 1.41244, -0.390841, 0.849521, 1.48767, -0.497446, 0.795095, 1.57933, -0.584934, 0.733, 1.68391, -0.649944, 0.665623, 1.79739, -0.689977, 0.887987, 1.1574, -0.159342, 0.895999, 1.14391, -0, 0.864258, 1.19737, -0.31256, 0.825724, 1.26226, -0.453766, 0.773866, 1.3496, -0.577535, 0.710676, 1.45603, -0.679109, 0.638584, 1.57744, -0.754585, 0.56036, 1.70919, -0.801063, 0.80873, 1.02557, -0.173842, 0.817471, 1.01084, -0, 0.782841, 1.06917, -0.341003, 0.7408, 1.13997, -0.495059, 0.684223, 1.23526, -0.63009, 0.615284, 1.35136, -0.740908, 0.536632, 1.48383, -0.823253, 0.451289, 1.62756, -0.87396, 0.7063, 0.902745, -0.184446, 0.715574, 0.887125, -0, 0.678832, 0.949006, -0.361804, 0.634227, 1.02413, -0.525258, 0.574198, 1.12523, -0.668526, 0.501054, 1.24842, -0.786103, 0.417603, 1.38896, -0.873471, 0.327055, 1.54147, -0.927272, 0.584403, 0.775155, -0, 0.57484, 0.791259, -0.190164, 0.546521, 0.838955, -0.37302, 0.500533, 0.916407, -0.541541, 0.438644, 1.02064, -0.68925, 0.363232, 1.14765, -0.810472, 0.277195, 1.29255, -0.900549, 0.183839, 1.44978, -0.956017, 0.449082, 0.685739, -0, 0.439444, 0.701972, -0.191685, 0.410898, 0.750049, -0.376004, 0.364542, 0.828121, -0.545873, 0.302158, 0.933188, -0.694764, 0.226142, 1.06121, -0.816956, 0.139417, 1.20728, -0.907753, 0.045314, 1.36576, -0.963665, 0.964329, 1.61289, -0.089191, 0.968814, 1.60533, -0, 0.951047, 1.63526, -0.174954, 0.929477, 1.67158, -0.253993, 0.90045, 1.72047, -0.323272, 0.86508, 1.78004, -0.380128, 0.824727, 1.848, -0.422375, 0.780941, 1.92175, -0.448391, 0.735406, 1.99844, -0.457176, 0.685856, 1.96902, -0.799197, 0.66129, 2.04799, -0.820795, 0.642637, 2.03428, -0.799197, 0.705763, 1.98083, -0.820796, 0.610449, 2.11047, -0.820795, 0.59323, 2.09499, -0.799197, 0.553729, 2.16766, -0.820795, 0.53811, 2.15057, -0.799197, 0.491676, 2.21902, -0.820795, 0.477807, 2.20048, -0.799197, 0.491676, 2.21902, -0.820795, 0.424888, 2.26405, -0.820795, 0.412903, 2.24424, -0.799197, 0.424888, 2.26405, -0.820795, 0.344022, 2.28142, -0.799197, 0.424888, 2.26405, -0.820795, 0.354008, 2.30231, -0.820795, 0.271828, 2.31168, -0.799197, 0.354008, 2.30231, -0.820795, 0.279718, 2.33345, -0.820795, 0.202735, 2.35715, -0.820795, 0.197017, 2.33471, -0.799197, 0.202735, 2.35715, -0.820795, 0.1238, 2.37319, -0.820795, 0.1238, 2.37319, -0.820795, 0.120308, 2.3503, -0.799197, 0.043672, 2.38142, -0.820795, 0.043672, 2.38142, -0.820795, 0.04244, 2.3583, -0.799197, 0.043672, 2.38142, -0.820795, -0.036876, 2.38175, -0.820795, -0.035836, 2.35862, -0.799197, -0.11707, 2.37419, -0.820795, -0.11707, 2.37419, -0.820795, -0.113768, 2.35127, -0.799197, -0.190603, 2.33632, -0.799197, -0.11707, 2.37419, -0.820795, -0.196136, 2.3588, -0.820795, -0.273312, 2.33574, -0.820795, -0.273312, 2.33574, -0.820795, -0.265603, 2.31391, -0.799197, -0.338045, 2.28425, -0.799197, -0.273312, 2.33574, -0.820795, -0.347857, 2.30522, -0.820795, -0.419052, 2.26755, -0.820795, -0.419052, 2.26755, -0.820795, -0.407232, 2.24764, -0.799197, -0.486211, 2.22307, -0.820795, -0.472497, 2.20442, -0.799197, -0.486211, 2.22307, -0.820795, -0.548687, 2.17223, -0.820795, -0.533211, 2.15501, -0.799197, -0.548687, 2.17223, -0.820795, -0.60588, 2.11551, -0.820795, -0.58879, 2.09989, -0.799197, -0.60588, 2.11551, -0.820795, -0.638699, 2.03959, -0.799197, -0.60588, 2.11551, -0.820795, -0.657237, 2.05346, -0.820795, -0.682457, 1.97469, -0.799197, -0.657237, 2.05346, -0.820795, -0.702265, 1.98667, -0.820795, -0.719642, 1.90581, -0.799197, -0.702265, 1.98667, -0.820795, -0.74053, 1.91579, -0.820795, -0.771663, 1.8415, -0.820795, -0.749897, 1.83361, -0.799197, -0.771663, 1.8415, -0.820795, -0.795364, 1.76452, -0.820795, -0.77293, 1.7588, -0.799197, -0.795364, 1.76452, -0.820795, -0.811406, 1.68558, -0.820795, -0.788519, 1.68209, -0.799197, -0.811406, 1.68558, -0.820795, -0.819633, 1.60545, -0.820795, -0.796514, 1.60422, -0.799197, -0.819633, 1.60545, -0.820795, -0.796839, 1.52595, -0.799197, -0.819633, 1.60545, -0.820795, -0.819967, 1.52491, -0.820795, -0.789489, 1.44802, -0.799197, -0.819967, 1.52491, -0.820795, -0.812404, 1.44471, -0.820795, -0.774536, 1.37118, -0.799197, -0.812404, 1.44471, -0.820795, -0.797017, 1.36565, -0.820795, -0.773955, 1.28847, -0.820795, -0.773955, 1.28847, -0.820795, -0.752124, 1.29618, -0.799197, -0.743439, 1.21393, -0.820795, -0.743439, 1.21393, -0.820795, -0.722469, 1.22374, -0.799197, -0.705763, 1.14273, -0.820795, -0.705763, 1.14273, -0.820795, -0.685856, 1.15455, -0.799197, 0.722469, 1.89983, -0.799197, 0.743438, 1.90964, -0.820796, 0.752124, 1.82739, -0.799197, 0.743438, 1.90964, -0.820796, 0.773955, 1.83509, -0.820796, 0.797017, 1.75792, -0.820796, 0.774536, 1.75239, -0.799197, 0.797017, 1.75792, -0.820796, 0.812404, 1.67885, -0.820796, 0.789489, 1.67555, -0.799197, 0.812404, 1.67885, -0.820796, 0.819966, 1.59866, -0.820796, 0.796838, 1.59762, -0.799197, 0.819966, 1.59866, -0.820796, 0.819966, 1.59866, -0.820796, 0.796514, 1.51934, -0.799197, 0.819633, 1.51811, -0.820796, 0.819633, 1.51811, -0.820796, 0.788519, 1.44148, -0.799197, 0.811405, 1.43798, -0.820796, 0.811405, 1.43798, -0.820796, 0.772929, 1.36477, -0.799197, 0.795364, 1.35905, -0.820796, 0.771662, 1.28207, -0.820796, 0.771662, 1.28207, -0.820796, 0.749896, 1.28995, -0.799197, 0.740529, 1.20777, -0.820795, 0.740529, 1.20777, -0.820795, 0.719641, 1.21776, -0.799197, 0.740529, 1.20777, -0.820795, 0.682456, 1.14888, -0.799197, 0.702264, 1.1369, -0.820795, 0.702264, 1.1369, -0.820795, 0.638698, 1.08398, -0.799197, 0.657236, 1.07011, -0.820795, 0.657236, 1.07011, -0.820795, 0.588789, 1.02367, -0.799197, 0.605879, 1.00805, -0.820795, 0.605879, 1.00805, -0.820795, 0.53321, 0.968553, -0.799197, 0.548686, 0.951334, -0.820795, 0.472496, 0.919146, -0.799197, 0.548686, 0.951334, -0.820795, 0.48621, 0.900493, -0.820795, 0.407231, 0.875928, -0.799197, 0.48621, 0.900493, -0.820795, 0.419051, 0.85602, -0.820795, 0.338044, 0.839314, -0.799197, 0.347856, 0.818345, -0.820795, 0.347856, 0.818345, -0.820795, 0.265602, 0.809659, -0.799197, 0.273311, 0.787829, -0.820795, 0.273311, 0.787829, -0.820795, 0.190602, 0.787247, -0.799197, 0.273311, 0.787829, -0.820795, 0.196134, 0.764766, -0.820795, 0.113766, 0.772295, -0.799197, 0.196134, 0.764766, -0.820795, 0.117068, 0.74938, -0.820795, 0.035835, 0.764945, -0.799197, 0.117068, 0.74938, -0.820795, 0.036875, 0.741817, -0.820795, -0.042441, 0.76527, -0.799197, -0.043673, 0.742151, -0.820795, -0.043673, 0.742151, -0.820795, -0.120309, 0.773265, -0.799197, -0.123801, 0.750378, -0.820795, -0.123801, 0.750378, -0.820795, -0.197018, 0.788854, -0.799197, -0.123801, 0.750378, -0.820795, -0.202736, 0.76642, -0.820795, -0.27972, 0.790122, -0.820795, -0.27183, 0.811887, -0.799197, -0.27972, 0.790122, -0.820795, -0.354008, 0.821255, -0.820795, -0.344023, 0.842142, -0.799197, -0.354008, 0.821255, -0.820795, -0.424888, 0.859519, -0.820795, -0.424888, 0.859519, -0.820795, -0.412904, 0.879327, -0.799197, -0.491676, 0.904547, -0.820795, -0.424888, 0.859519, -0.820795, -0.491676, 0.904547, -0.820795, -0.477808, 0.923085, -0.799197, -0.491676, 0.904547, -0.820795, -0.53811, 0.972994, -0.799197, -0.553729, 0.955904, -0.820795, -0.610449, 1.0131, -0.820795, -0.610449, 1.0131, -0.820795, -0.59323, 1.02857, -0.799197, -0.610449, 1.0131, -0.820795, -0.642638, 1.08929, -0.799197, -0.66129, 1.07557, -0.820795, -0.66129, 1.07557, -0.820795, -0.685856, 1.15455, -0.799197, -0.705763, 1.14273, -0.820795, 0.642637, 2.03428, -0.768625, 0.685856, 1.96902, -0.768625, 0.59323, 2.09499, -0.768625, 0.53811, 2.15057, -0.768625, 0.477807, 2.20048, -0.768625, 0.412903, 2.24424, -0.768625, 0.344022, 2.28142, -0.768625, 0.271828, 2.31168, -0.768625, 0.197017, 2.33471, -0.768625, 0.120308, 2.3503, -0.768625, 0.04244, 2.3583, -0.768625, -0.035836, 2.35862, -0.768625, -0.113768, 2.35127, -0.768625, -0.190603, 2.33632, -0.768625, -0.265603, 2.31391, -0.768625, -0.338045, 2.28425, -0.768625, -0.407232, 2.24764, -0.768625, -0.472497, 2.20442, -0.768625, -0.533211, 2.15501, -0.768625, -0.58879, 2.09989, -0.768625, -0.638699, 2.03959, -0.768625, -0.682457, 1.97469, -0.768625, -0.719642, 1.90581, -0.768625, -0.749897, 1.83361, -0.768625, -0.77293, 1.7588, -0.768625, -0.788519, 1.68209, -0.768625, -0.796514, 1.60422, -0.768625, -0.796839, 1.52595, -0.768625, -0.789489, 1.44802, -0.768625, -0.774536, 1.37118, -0.768625, -0.752124, 1.29618, -0.768625, -0.722469, 1.22374, -0.768625, -0.685856, 1.15455, -0.768625, 0.722469, 1.89983, -0.768625, 0.752124, 1.82739, -0.768626, 0.774536, 1.75239, -0.768626, 0.789489, 1.67555, -0.768625, 0.796838, 1.59762, -0.768625, 0.796514, 1.51934, -0.768625, 0.788518, 1.44148, -0.768625, 0.772929, 1.36477, -0.768625, 0.749896, 1.28995, -0.768625, 0.719641, 1.21776, -0.768625, 0.682456, 1.14888, -0.768625, 0.638698, 1.08398, -0.768625, 0.588789, 1.02367, -0.768625, 0.53321, 0.968553, -0.768625, 0.472496, 0.919146, -0.768625, 0.407231, 0.875928, -0.768625, 0.338044, 0.839314, -0.768625, 0.265602, 0.809659, -0.768625, 0.190602, 0.787247, -0.768625, 0.113766, 0.772295, -0.768625, 0.035835, 0.764945, -0.768625, -0.042441, 0.76527, -0.768625, -0.120309, 0.773265, -0.768625, -0.197018, 0.788854, -0.768625, -0.27183, 0.811887, -0.768625, -0.344023, 0.842142, -0.768625, -0.412904, 0.879327, -0.768625, -0.477808, 0.923085, -0.768625, -0.53811, 0.972994, -0.768625, -0.59323, 1.02857, -0.768625, -0.642638, 1.08929, -0.768625, -0.685856, 1.15455, -0.768625, 0.66129, 2.04799, 0.820795, 0.722924, 2.09331, 0.736391, 0.705763, 1.98083, 0.820795, 0.771541, 2.01989, 0.736391, 0.610449, 2.11047, 0.820795, 0.667344, 2.16161, 0.736391, 0.553729, 2.16766, 0.820795, 0.605337, 2.22413, 0.736391, 0.491676, 2.21902, 0.820795, 0.537501, 2.28028, 0.736391, 0.424888, 2.26405, 0.820795, 0.464488, 2.3295, 0.736391, 0.354008, 2.30231, 0.820795, 0.387002, 2.37133, 0.736391, 0.279719, 2.33345, 0.820795, 0.305789, 2.40537, 0.736391, 0.202736, 2.35715, 0.820795, 0.221631, 2.43128, 0.736391, 0.1238, 2.37319, 0.820796, 0.135338, 2.44881, 0.736391, 0.043672, 2.38142, 0.820796, 0.047743, 2.45781, 0.736391, -0.036876, 2.38175, 0.820796, -0.040313, 2.45817, 0.736391, -0.117069, 2.37419, 0.820796, -0.127981, 2.4499, 0.736391, -0.196135, 2.3588, 0.820796, -0.214415, 2.43308, 0.736391, -0.273312, 2.33574, 0.820796, -0.298785, 2.40787, 0.736391, -0.347857, 2.30522, 0.820796, -0.380278, 2.37451, 0.736391, -0.419052, 2.26755, 0.820796, -0.458108, 2.33332, 0.736391, -0.486211, 2.22307, 0.820796, -0.531526, 2.28471, 0.736391, -0.599826, 2.22913, 0.736391, -0.548687, 2.17223, 0.820796, -0.60588, 2.11551, 0.820796, -0.662349, 2.16712, 0.736391, -0.657237, 2.05346, 0.820796, -0.718493, 2.09928, 0.736391, -0.702265, 1.98667, 0.820796, -0.767717, 2.02627, 0.736391, -0.740529, 1.91579, 0.820796, -0.809548, 1.94879, 0.736391, -0.843583, 1.86757, 0.736391, -0.771662, 1.8415, 0.820796, -0.869493, 1.78341, 0.736391, -0.795364, 1.76452, 0.820796, -0.88703, 1.69712, 0.736391, -0.811405, 1.68558, 0.820796, -0.896024, 1.60953, 0.736391, -0.819633, 1.60545, 0.820796, -0.896389, 1.52147, 0.736391, -0.819966, 1.52491, 0.820796, -0.812404, 1.44471, 0.820796, -0.888121, 1.4338, 0.736391, -0.797017, 1.36565, 0.820796, -0.8713, 1.34737, 0.736391, -0.773955, 1.28847, 0.820796, -0.846088, 1.263, 0.736391, -0.743439, 1.21393, 0.820796, -0.812728, 1.18151, 0.736391, -0.771541, 1.10368, 0.736391, -0.705763, 1.14273, 0.820796, 0.829889, 2.05454, 0.644895, 0.777595, 2.13351, 0.644895, 0.717812, 2.20697, 0.644895, 0.651116, 2.27422, 0.644895, 0.578149, 2.33461, 0.644895, 0.499615, 2.38756, 0.644895, 0.416269, 2.43255, 0.644895, 0.328914, 2.46916, 0.644895, 0.238392, 2.49703, 0.644895, 0.145573, 2.51589, 0.644895, 0.051353, 2.52557, 0.644895, -0.043362, 2.52596, 0.644895, -0.137659, 2.51707, 0.644895, -0.230631, 2.49898, 0.644895, -0.321381, 2.47186, 0.644895, -0.409037, 2.43598, 0.644895, -0.492753, 2.39167, 0.644895, -0.571723, 2.33938, 0.644895, -0.645188, 2.27959, 0.644895, -0.712439, 2.2129, 0.644895, -0.772829, 2.13993, 0.644895, -0.825776, 2.0614, 0.644895, -0.87077, 1.97805, 0.644895, -0.907379, 1.8907, 0.644895, -0.907379, 1.8907, 0.644895, -0.907379, 1.8907, 0.644895, -0.935249, 1.80017, 0.644895, -0.954112, 1.70736, 0.644895, -0.963786, 1.61314, 0.644895, -0.964179, 1.51842, 0.644895, -0.955286, 1.42412, 0.644895, -0.937193, 1.33115, 0.644895, -0.910074, 1.2404, 0.644895, -0.874191, 1.15275, 0.644895, -0.829889, 1.06903, 0.644895, 0.756822, 2.26502, 0.526914, 0.690624, 2.31745, 0.547188, 0.61323, 2.38151, 0.547188, 0.529931, 2.43766, 0.547188, 0.441527, 2.48539, 0.547188, 0.348872, 2.52422, 0.547188, 0.252857, 2.55378, 0.547188, 0.154406, 2.57379, 0.547188, 0.054469, 2.58405, 0.547188, -0.045993, 2.58447, 0.547188, -0.146012, 2.57503, 0.547188, -0.244625, 2.55584, 0.547188, -0.340882, 2.52708, 0.547188, -0.433856, 2.48902, 0.547188, -0.522652, 2.44203, 0.547188, -0.606414, 2.38656, 0.547188, -0.684336, 2.32315, 0.547188, -0.755668, 2.25241, 0.547188, -0.819722, 2.17501, 0.547188, -0.875882, 2.09171, 0.547188, -0.923607, 2.00331, 0.547188, -0.962437, 1.91066, 0.547188, -0.907379, 1.8907, 0.644895, -0.907379, 1.8907, 0.644895, -0.991998, 1.81464, 0.547188, -0.907379, 1.8907, 0.644895, -1.012, 1.71619, 0.547188, -1.02227, 1.61625, 0.547188, -1.02268, 1.51579, 0.547188, -1.01325, 1.41577, 0.547188, -0.994059, 1.31716, 0.547188, -0.965295, 1.2209, 0.547188, -0.927235, 1.12793, 0.547188, -0.880245, 1.03913, 0.547188, 0.555143, 2.47934, 0.444211, 0.662517, 2.4236, 0.403546, 0.462534, 2.52933, 0.444211, 0.36547, 2.57001, 0.444211, 0.264887, 2.60098, 0.444211, 0.161752, 2.62194, 0.444211, 0.05706, 2.63268, 0.444211, -0.048181, 2.63312, 0.444211, -0.152959, 2.62324, 0.444211, -0.256263, 2.60314, 0.444211, -0.3571, 2.573, 0.444211, -0.454497, 2.53313, 0.444211, -0.547517, 2.48391, 0.444211, -0.635265, 2.4258, 0.444211, -0.716894, 2.35937, 0.444211, -0.79162, 2.28526, 0.444211, -0.858721, 2.20419, 0.444211, -0.917553, 2.11693, 0.444211, -0.967548, 2.02432, 0.444211, -0.967548, 2.02432, 0.444211, -0.967548, 2.02432, 0.444211, -1.00823, 1.92725, 0.444211, -1.03919, 1.82667, 0.444211, -1.06015, 1.72354, 0.444211, -1.0709, 1.61884, 0.444211, -1.07134, 1.5136, 0.444211, -1.06146, 1.40883, 0.444211, -1.04135, 1.30552, 0.444211, -1.01122, 1.20468, 0.444211, -0.971349, 1.10729, 0.444211, -0.922123, 1.01427, 0.444211, 0.479085, 2.56396, 0.336957, 0.575008, 2.51217, 0.336957, 0.378548, 2.60609, 0.336957, 0.378548, 2.60609, 0.336957, 0.274366, 2.63816, 0.336957, 0.378548, 2.60609, 0.336957, 0.167541, 2.65987, 0.336957, 0.059102, 2.67101, 0.336957, -0.049905, 2.67146, 0.336957, -0.158432, 2.66122, 0.336957, -0.265433, 2.6404, 0.336957, -0.369878, 2.60919, 0.336957, -0.470761, 2.56789, 0.336957, -0.56711, 2.51691, 0.336957, -0.657998, 2.45672, 0.336957, -0.742548, 2.38791, 0.336957, -0.742548, 2.38791, 0.336957, -0.742548, 2.38791, 0.336957, -0.819948, 2.31115, 0.336957, -0.889451, 2.22718, 0.336957, -0.950388, 2.13679, 0.336957, -1.00217, 2.04087, 0.336957, -0.967548, 2.02432, 0.444211, -0.967548, 2.02432, 0.444211, -1.0443, 1.94033, 0.336957, -0.967548, 2.02432, 0.444211, -1.07638, 1.83615, 0.336957, -1.09809, 1.72932, 0.336957, -1.10922, 1.62089, 0.336957, -1.10968, 1.51188, 0.336957, -1.09944, 1.40335, 0.336957, -1.07862, 1.29635, 0.336957, -1.04741, 1.19191, 0.336957, -1.00611, 1.09102, 0.336957, -0.955121, 0.994674, 0.336957, 0.491023, 2.58893, 0.226457, 0.491023, 2.58893, 0.226457, 0.599515, 2.53059, 0.218386, 0.378548, 2.60609, 0.336957, 0.387981, 2.63211, 0.226457, 0.491023, 2.58893, 0.226457, 0.281202, 2.66498, 0.226457, 0.378548, 2.60609, 0.336957, 0.378548, 2.60609, 0.336957, 0.171715, 2.68723, 0.226457, 0.060575, 2.69865, 0.226457, -0.051149, 2.69911, 0.226457, -0.16238, 2.68862, 0.226457, -0.272048, 2.66728, 0.226457, -0.379095, 2.63529, 0.226457, -0.482492, 2.59296, 0.226457, -0.581241, 2.5407, 0.226457, -0.674394, 2.47902, 0.226457, -0.742548, 2.38791, 0.336957, -0.742548, 2.38791, 0.336957, -0.761051, 2.4085, 0.226457, -0.742548, 2.38791, 0.336957, -0.840379, 2.32983, 0.226457, -0.911614, 2.24376, 0.226457, -0.974069, 2.15112, 0.226457, -1.02714, 2.05281, 0.226457, -1.07033, 1.94976, 0.226457, -1.1032, 1.84298, 0.226457, -1.12545, 1.7335, 0.226457, -1.13686, 1.62236, 0.226457, -1.13733, 1.51063, 0.226457, -1.12684, 1.3994, 0.226457, -1.10549, 1.28974, 0.226457, -1.07351, 1.18269, 0.226457, -1.03118, 1.07929, 0.226457, -0.978921, 0.980543, 0.226457, 0.393677, 2.64782, 0.113776, 0.491023, 2.58893, 0.226457, 0.491023, 2.58893, 0.226457, 0.498232, 2.60401, 0.113776, 0.285331, 2.68118, 0.113776, 0.174236, 2.70376, 0.113776, 0.061464, 2.71534, 0.113776, -0.0519, 2.71581, 0.113776, -0.164764, 2.70516, 0.113776, -0.276042, 2.68351, 0.113776, -0.384661, 2.65105, 0.113776, -0.489575, 2.6081, 0.113776, -0.589775, 2.55508, 0.113776, -0.684295, 2.49249, 0.113776, -0.772224, 2.42093, 0.113776, -0.852717, 2.3411, 0.113776, -0.924998, 2.25377, 0.113776, -0.98837, 2.15977, 0.113776, -1.04222, 2.06001, 0.113776, -1.08604, 1.95546, 0.113776, -1.1194, 1.84711, 0.113776, -1.14198, 1.73602, 0.113776, -1.15355, 1.62325, 0.113776, -1.15402, 1.50988, 0.113776, -1.14338, 1.39702, 0.113776, -1.12172, 1.28574, 0.113776, -1.08927, 1.17712, 0.113776, -1.04632, 1.07221, 0.113776, -0.993293, 0.972009, 0.113776, 0.583648, 2.55806, 0.111958, 0.491023, 2.58893, 0.226457, 0.626098, 2.48483, 0.31657, 0.626098, 2.48483, 0.31657, 0.706731, 2.34973, 0.473934, 0.811234, 2.1739, 0.559173, 0.868332, 2.07736, 0.570708, 0.596325, 2.52328, 0.103891, 0.554623, 2.4091, 0.088597, 0.611797, 2.49723, 0.20379, 0.567817, 2.38688, 0.17379, 0.636921, 2.45491, 0.295858, 0.589243, 2.3508, 0.252304, 0.670733, 2.39797, 0.376555, 0.618077, 2.30223, 0.321122, 0.711933, 2.32858, 0.442782, 0.653212, 2.24306, 0.3776, 0.758937, 2.24941, 0.491993, 0.693296, 2.17555, 0.419567, 0.80994, 2.16352, 0.522297, 0.736791, 2.10229, 0.445409, 0.862981, 2.07418, 0.53253, 0.782024, 2.02611, 0.454136, 0.527609, 2.38401, 0.087049, 0.539737, 2.39121, 0.087049, 0.540573, 2.36218, 0.170753, 0.5527, 2.36938, 0.170753, 0.561624, 2.32672, 0.247895, 0.573752, 2.33392, 0.247895, 0.589955, 2.27901, 0.315511, 0.602082, 2.28621, 0.315511, 0.636603, 2.22807, 0.371001, 0.624475, 2.22087, 0.371001, 0.675987, 2.16174, 0.412235, 0.66386, 2.15454, 0.412235, 0.718722, 2.08977, 0.437626, 0.706594, 2.08257, 0.437626, 0.763164, 2.01492, 0.4462, 0.751036, 2.00772, 0.4462, 0.626098, 2.48483, 0.31657, 0.626098, 2.48483, 0.31657, 0.626098, 2.48483, 0.31657, 0.506483, 2.38399, 0.089191, 0.395314, 2.45102, 0.111945, 0.519766, 2.36162, 0.174954, 0.411985, 2.42294, 0.219589, 0.411985, 2.42294, 0.219589, 0.541335, 2.32529, 0.253993, 0.411985, 2.42294, 0.219589, 0.439057, 2.37735, 0.318793, 0.570362, 2.2764, 0.323272, 0.47549, 2.31599, 0.405747, 0.605732, 2.21683, 0.380128, 0.519883, 2.24122, 0.477108, 0.646085, 2.14887, 0.422375, 0.570531, 2.15592, 0.530134, 0.689871, 2.07513, 0.448391, 0.625488, 2.06336, 0.562787, 0.735406, 1.99844, 0.457176, 0.682641, 1.96711, 0.573813, 0.243291, 2.50868, 0.137245, 0.411985, 2.42294, 0.219589, 0.411985, 2.42294, 0.219589, 0.26373, 2.47425, 0.269216, 0.411985, 2.42294, 0.219589, 0.29692, 2.41835, 0.390841, 0.341587, 2.34313, 0.497446, 0.396013, 2.25146, 0.584934, 0.458108, 2.14688, 0.649944, 0.525485, 2.03341, 0.689977, 0.595554, 1.9154, 0.703494, 0.070032, 2.535, 0.159342, 0.093761, 2.49503, 0.31256, 0.132295, 2.43013, 0.453766, 0.184154, 2.34279, 0.577535, 0.247343, 2.23637, 0.679109, 0.319435, 2.11495, 0.754585, 0.397659, 1.98321, 0.801063, 0.47901, 1.8462, 0.816757, -0.083659, 2.52852, 0.173842, -0.05777, 2.48492, 0.341003, -0.01573, 2.41411, 0.495059, 0.040847, 2.31883, 0.63009, 0.109787, 2.20272, 0.740908, 0.188439, 2.07025, 0.823253, 0.273782, 1.92652, 0.87396, 0.362536, 1.77704, 0.891082, -0.240525, 2.49738, 0.184446, -0.213057, 2.45112, 0.361804, -0.168452, 2.37599, 0.525258, -0.108424, 2.27489, 0.668526, -0.035279, 2.15171, 0.786103, 0.048171, 2.01116, 0.873471, 0.13872, 1.85866, 0.927272, 0.232888, 1.70006, 0.945438, -0.401336, 2.43533, 0.190164, -0.373016, 2.38763, 0.37302, -0.327028, 2.31018, 0.541541, -0.265139, 2.20595, 0.68925, -0.189727, 2.07894, 0.810472, -0.10369, 1.93404, 0.900549, -0.010334, 1.77681, 0.956017, 0.086753, 1.61329, 0.974747, -0.544542, 2.35919, 0.191686, -0.515996, 2.31112, 0.376004, -0.46964, 2.23304, 0.545873, -0.407256, 2.12798, 0.694764, -0.33124, 1.99995, 0.816956, -0.244515, 1.85389, 0.907753, -0.150412, 1.6954, 0.963665, -0.052549, 1.53058, 0.982545, 0.506483, 2.38399, 0.089191, 0.519766, 2.36162, 0.174954, 0.541335, 2.32529, 0.253993, 0.570362, 2.2764, 0.323272, 0.605732, 2.21683, 0.380128, 0.646085, 2.14887, 0.422375, 0.689871, 2.07513, 0.448391, 0.735406, 1.99844, 0.457176, 0.743439, 1.90964, 0.820795, 0.812728, 1.94206, 0.736391, 0.846089, 1.86057, 0.736391, 0.773955, 1.83509, 0.820795, 0.871301, 1.7762, 0.736391, 0.797017, 1.75792, 0.820795, 0.888121, 1.68976, 0.736391, 0.812404, 1.67885, 0.820795, 0.896389, 1.6021, 0.736391, 0.819967, 1.59866, 0.820795, 0.819633, 1.51811, 0.820795, 0.896024, 1.51404, 0.736391, 0.811405, 1.43798, 0.820795, 0.88703, 1.42645, 0.736391, 0.795364, 1.35905, 0.820795, 0.869493, 1.34015, 0.736391, 0.771662, 1.28207, 0.820795, 0.843583, 1.25599, 0.736391, 0.740529, 1.20777, 0.820795, 0.809548, 1.17478, 0.736391, 0.702264, 1.1369, 0.820795, 0.767717, 1.0973, 0.736391, 0.657237, 1.07011, 0.820795, 0.718492, 1.02428, 0.736391, 0.605879, 1.00805, 0.820795, 0.662348, 0.956446, 0.736391, 0.599825, 0.894439, 0.736391, 0.548687, 0.951334, 0.820795, 0.48621, 0.900493, 0.820795, 0.531526, 0.83886, 0.736391, 0.458107, 0.790242, 0.736391, 0.419051, 0.85602, 0.820795, 0.347856, 0.818345, 0.820795, 0.380277, 0.749055, 0.736391, 0.298785, 0.715695, 0.736391, 0.273312, 0.787829, 0.820795, 0.214415, 0.690483, 0.736391, 0.196135, 0.764766, 0.820795, 0.12798, 0.673662, 0.736391, 0.117069, 0.74938, 0.820795, 0.040312, 0.665394, 0.736391, 0.036876, 0.741817, 0.820795, -0.043673, 0.742151, 0.820795, -0.047743, 0.66576, 0.736391, -0.123801, 0.750378, 0.820795, -0.135339, 0.674754, 0.736391, -0.202736, 0.76642, 0.820796, -0.221632, 0.692291, 0.736391, -0.279719, 0.790121, 0.820796, -0.30579, 0.718201, 0.736391, -0.354008, 0.821254, 0.820796, -0.387002, 0.752236, 0.736391, -0.424888, 0.859519, 0.820796, -0.464488, 0.794067, 0.736391, -0.537501, 0.843291, 0.736391, -0.491676, 0.904547, 0.820796, -0.553729, 0.955904, 0.820796, -0.491676, 0.904547, 0.820796, -0.605337, 0.899435, 0.736391, -0.667344, 0.961958, 0.736391, -0.610449, 1.0131, 0.820796, -0.722923, 1.03026, 0.736391, -0.66129, 1.07557, 0.820796, -0.771541, 1.10368, 0.736391, -0.705763, 1.14273, 0.820796, 0.874191, 1.97082, 0.644895, 0.910074, 1.88316, 0.644895, 0.937193, 1.79241, 0.644895, 0.955286, 1.69944, 0.644895, 0.964179, 1.60514, 0.644895, 0.963786, 1.51043, 0.644895, 0.954112, 1.41621, 0.644895, 0.935249, 1.32339, 0.644895, 0.907379, 1.23287, 0.644895, 0.87077, 1.14551, 0.644895, 0.825776, 1.06217, 0.644895, 0.772828, 0.983634, 0.644895, 0.712438, 0.910667, 0.644895, 0.645187, 0.843971, 0.644895, 0.571723, 0.784188, 0.644895, 0.492752, 0.731894, 0.644895, 0.409036, 0.687592, 0.644895, 0.32138, 0.651709, 0.644895, 0.23063, 0.624591, 0.644895, 0.137658, 0.606498, 0.644895, 0.043361, 0.597605, 0.644895, -0.051354, 0.597997, 0.644895, -0.145574, 0.607672, 0.644895, -0.145574, 0.607672, 0.644895, -0.145574, 0.607672, 0.644895, -0.238393, 0.626535, 0.644895, -0.328915, 0.654405, 0.644895, -0.41627, 0.691014, 0.644895, -0.499616, 0.736008, 0.644895, -0.57815, 0.788955, 0.644895, -0.651116, 0.849345, 0.644895, -0.717812, 0.916596, 0.644895, -0.777595, 0.990061, 0.644895, -0.829889, 1.06903, 0.644895, 0.979712, 1.88963, 0.526914, 0.99406, 1.80641, 0.547188, 1.01325, 1.7078, 0.547188, 1.02268, 1.60778, 0.547188, 1.02227, 1.50731, 0.547188, 1.012, 1.40738, 0.547188, 1.012, 1.40738, 0.547188, 1.012, 1.40738, 0.547188, 0.991997, 1.30893, 0.547188, 0.962436, 1.21291, 0.547188, 0.923607, 1.12026, 0.547188, 0.875882, 1.03185, 0.547188, 0.819722, 0.948553, 0.547188, 0.819722, 0.948553, 0.547188, 0.819722, 0.948553, 0.547188, 0.755668, 0.871159, 0.547188, 0.684336, 0.800416, 0.547188, 0.606413, 0.737006, 0.547188, 0.522651, 0.681538, 0.547188, 0.433855, 0.634548, 0.547188, 0.340881, 0.596488, 0.547188, 0.244624, 0.567724, 0.547188, 0.146011, 0.548533, 0.547188, 0.045992, 0.539101, 0.547188, -0.05447, 0.539517, 0.547188, -0.145574, 0.607672, 0.644895, -0.145574, 0.607672, 0.644895, -0.154407, 0.549779, 0.547188, -0.145574, 0.607672, 0.644895, -0.252858, 0.569786, 0.547188, -0.348873, 0.599347, 0.547188, -0.441528, 0.638177, 0.547188, -0.529931, 0.685902, 0.547188, -0.613231, 0.742062, 0.547188, -0.690624, 0.806116, 0.547188, -0.761367, 0.877447, 0.547188, -0.824777, 0.95537, 0.547188, -0.880245, 1.03913, 0.547188, 1.0738, 1.73092, 0.403546, 1.07134, 1.60996, 0.444211, 1.0709, 1.50472, 0.444211, 1.012, 1.40738, 0.547188, 1.012, 1.40738, 0.547188, 1.06015, 1.40003, 0.444211, 1.012, 1.40738, 0.547188, 1.03919, 1.2969, 0.444211, 1.00822, 1.19631, 0.444211, 0.967548, 1.09925, 0.444211, 0.917553, 1.00664, 0.444211, 0.819722, 0.948553, 0.547188, 0.819722, 0.948553, 0.547188, 0.858721, 0.919378, 0.444211, 0.819722, 0.948553, 0.547188, 0.791619, 0.838302, 0.444211, 0.716894, 0.764193, 0.444211, 0.791619, 0.838302, 0.444211, 0.635264, 0.697766, 0.444211, 0.547517, 0.63966, 0.444211, 0.454496, 0.590434, 0.444211, 0.357099, 0.550563, 0.444211, 0.256262, 0.52043, 0.444211, 0.152958, 0.500327, 0.444211, 0.04818, 0.490445, 0.444211, -0.057061, 0.490882, 0.444211, -0.161753, 0.501631, 0.444211, -0.264888, 0.522591, 0.444211, -0.365471, 0.553559, 0.444211, -0.462534, 0.594236, 0.444211, -0.555143, 0.644231, 0.444211, -0.642406, 0.703063, 0.444211, -0.723481, 0.770164, 0.444211, -0.79759, 0.84489, 0.444211, -0.864017, 0.926519, 0.444211, -0.922123, 1.01427, 0.444211, 1.10968, 1.61169, 0.336957, 1.10922, 1.50268, 0.336957, 1.09809, 1.39424, 0.336957, 1.07638, 1.28742, 0.336957, 1.0443, 1.18324, 0.336957, 1.00217, 1.0827, 0.336957, 0.950387, 0.986775, 0.336957, 0.88945, 0.896389, 0.336957, 0.791619, 0.838302, 0.444211, 0.791619, 0.838302, 0.444211, 0.819947, 0.812412, 0.336957, 0.742548, 0.735652, 0.336957, 0.791619, 0.838302, 0.444211, 0.791619, 0.838302, 0.444211, 0.742548, 0.735652, 0.336957, 0.657997, 0.666847, 0.336957, 0.742548, 0.735652, 0.336957, 0.567109, 0.606662, 0.336957, 0.47076, 0.555674, 0.336957, 0.369877, 0.514377, 0.336957, 0.265432, 0.483166, 0.336957, 0.158431, 0.462343, 0.336957, 0.049904, 0.452108, 0.336957, -0.059103, 0.45256, 0.336957, -0.167542, 0.463694, 0.336957, -0.274367, 0.485404, 0.336957, -0.378549, 0.517479, 0.336957, -0.479086, 0.559612, 0.336957, -0.575009, 0.611397, 0.336957, -0.665394, 0.672333, 0.336957, -0.749371, 0.741836, 0.336957, -0.826131, 0.819236, 0.336957, -0.826131, 0.819236, 0.336957, -0.894936, 0.903786, 0.336957, -0.826131, 0.819236, 0.336957, -0.955121, 0.994674, 0.336957, 1.13758, 1.62439, 0.218386, 1.13686, 1.50121, 0.226457, 1.12545, 1.39007, 0.226457, 1.1032, 1.28058, 0.226457, 1.07033, 1.1738, 0.226457, 1.02714, 1.07076, 0.226457, 0.974069, 0.972447, 0.226457, 0.911613, 0.879809, 0.226457, 0.840378, 0.793739, 0.226457, 0.76105, 0.715066, 0.226457, 0.742548, 0.735652, 0.336957, 0.674393, 0.644547, 0.226457, 0.742548, 0.735652, 0.336957, 0.742548, 0.735652, 0.336957, 0.58124, 0.582862, 0.226457, 0.48249, 0.530604, 0.226457, 0.379094, 0.488277, 0.226457, 0.272046, 0.456289, 0.226457, 0.162379, 0.434947, 0.226457, 0.051148, 0.424457, 0.226457, -0.060576, 0.42492, 0.226457, -0.171717, 0.436332, 0.226457, -0.281203, 0.458583, 0.226457, -0.387982, 0.491458, 0.226457, -0.491024, 0.53464, 0.226457, -0.589337, 0.587715, 0.226457, -0.681974, 0.65017, 0.226457, -0.768044, 0.721405, 0.226457, -0.846717, 0.800733, 0.226457, -0.826131, 0.819236, 0.336957, -0.917236, 0.88739, 0.226457, -0.826131, 0.819236, 0.336957, -0.826131, 0.819236, 0.336957, -0.978921, 0.980543, 0.226457, 1.15355, 1.50032, 0.113776, 1.14198, 1.38755, 0.113776, 1.1194, 1.27645, 0.113776, 1.08604, 1.16811, 0.113776, 1.04222, 1.06355, 0.113776, 0.98837, 0.963795, 0.113776, 0.924997, 0.869797, 0.113776, 0.852716, 0.782463, 0.113776, 0.772224, 0.702635, 0.113776, 0.684294, 0.631081, 0.113776, 0.589774, 0.56849, 0.113776, 0.489574, 0.515465, 0.113776, 0.38466, 0.472517, 0.113776, 0.27604, 0.440059, 0.113776, 0.164763, 0.418403, 0.113776, 0.051899, 0.407759, 0.113776, -0.061466, 0.408229, 0.113776, -0.174238, 0.419809, 0.113776, -0.285332, 0.442386, 0.113776, -0.393678, 0.475744, 0.113776, -0.498233, 0.51956, 0.113776, -0.597989, 0.573414, 0.113776, -0.691987, 0.636786, 0.113776, -0.77932, 0.709067, 0.113776, -0.859148, 0.789559, 0.113776, -0.930702, 0.877489, 0.113776, -0.993293, 0.972009, 0.113776, 1.15411, 1.5973, 0.111958, 1.11012, 1.66963, 0.31657, 1.03011, 1.8051, 0.473934, 0.92576, 1.98102, 0.559173, 1.00942, 1.64313, 0.088597, 1.12964, 1.62509, 0.103891, 0.99623, 1.66535, 0.17379, 1.12964, 1.62509, 0.103891, 1.11416, 1.65114, 0.20379, 1.12964, 1.62509, 0.103891, 0.974804, 1.70144, 0.252304, 1.08904, 1.69346, 0.295858, 0.94597, 1.75, 0.321122, 1.05523, 1.7504, 0.376555, 1.01403, 1.81979, 0.442782, 0.910836, 1.80917, 0.3776, 0.967024, 1.89895, 0.491993, 0.870751, 1.87668, 0.419567, 0.916021, 1.98485, 0.522297, 0.827256, 1.94993, 0.445409, 0.98659, 1.63862, 0.087049, 0.974463, 1.63142, 0.087049, 0.973627, 1.66046, 0.170753, 0.9615, 1.65325, 0.170753, 0.952576, 1.69591, 0.247895, 0.940448, 1.68871, 0.247895, 0.924245, 1.74362, 0.315511, 0.912118, 1.73642, 0.315511, 0.877597, 1.79456, 0.371001, 0.889725, 1.80176, 0.371001, 0.838213, 1.86089, 0.412235, 0.85034, 1.86809, 0.412235, 0.795478, 1.93287, 0.437626, 0.807606, 1.94007, 0.437626, 1.12964, 1.62509, 0.103891, 1.12964, 1.62509, 0.103891, 1.12964, 1.62509, 0.103891, 0.964329, 1.61289, 0.089191, 0.969968, 1.48319, 0.111945, 0.951047, 1.63526, 0.174954, 0.969968, 1.48319, 0.111945, 0.969968, 1.48319, 0.111945, 0.953297, 1.51127, 0.219589, 0.926225, 1.55686, 0.318793, 0.929478, 1.67158, 0.253993, 0.889792, 1.61822, 0.405747, 0.90045, 1.72047, 0.323272, 0.845398, 1.69299, 0.477108, 0.865081, 1.78004, 0.380128, 0.865081, 1.78004, 0.380128, 0.79475, 1.77829, 0.530134, 0.865081, 1.78004, 0.380128, 0.824727, 1.848, 0.422375, 0.739793, 1.87085, 0.562787, 0.780942, 1.92175, 0.448391, 0.969968, 1.48319, 0.111945, 0.947817, 1.32212, 0.137245, 0.927378, 1.35654, 0.269216, 0.969968, 1.48319, 0.111945, 0.969968, 1.48319, 0.111945, 0.894188, 1.41244, 0.390841, 0.849521, 1.48767, 0.497446, 0.795095, 1.57933, 0.584934, 0.733, 1.68391, 0.649944, 0.665623, 1.79739, 0.689977, 0.887987, 1.1574, 0.159342, 0.864258, 1.19737, 0.31256, 0.825724, 1.26226, 0.453766, 0.773866, 1.3496, 0.577535, 0.710677, 1.45603, 0.679109, 0.638585, 1.57744, 0.754585, 0.56036, 1.70919, 0.801063, 0.80873, 1.02557, 0.173842, 0.782841, 1.06917, 0.341003, 0.740801, 1.13997, 0.495059, 0.684224, 1.23526, 0.63009, 0.615284, 1.35136, 0.740908, 0.536632, 1.48383, 0.823253, 0.451289, 1.62756, 0.87396, 0.7063, 0.902745, 0.184446, 0.678832, 0.949006, 0.361804, 0.634227, 1.02413, 0.525258, 0.574198, 1.12523, 0.668526, 0.501054, 1.24842, 0.786103, 0.417604, 1.38897, 0.873471, 0.327055, 1.54147, 0.927272, 0.574841, 0.791259, 0.190164, 0.546521, 0.838955, 0.37302, 0.500534, 0.916407, 0.541541, 0.438644, 1.02064, 0.68925, 0.363232, 1.14765, 0.810472, 0.277195, 1.29255, 0.900549, 0.183839, 1.44978, 0.956017, 0.439444, 0.701972, 0.191685, 0.410898, 0.750049, 0.376004, 0.364542, 0.828121, 0.545873, 0.302158, 0.933188, 0.694764, 0.226143, 1.06121, 0.816956, 0.139417, 1.20728, 0.907753, 0.045314, 1.36576, 0.963665, 0.964329, 1.61289, 0.089191, 0.951047, 1.63526, 0.174954, 0.929478, 1.67158, 0.253993, 0.90045, 1.72047, 0.323272, 0.865081, 1.78004, 0.380128, 0.865081, 1.78004, 0.380128, 0.824727, 1.848, 0.422375, 0.865081, 1.78004, 0.380128, 0.780942, 1.92175, 0.448391, 0.735406, 1.99844, 0.457176, 0.685856, 1.96902, 0.799197, 0.66129, 2.04799, 0.820795, 0.705763, 1.98083, 0.820795, 0.66129, 2.04799, 0.820795, 0.642638, 2.03428, 0.799197, 0.610449, 2.11047, 0.820795, 0.610449, 2.11047, 0.820795, 0.59323, 2.09499, 0.799197, 0.553729, 2.16766, 0.820795, 0.553729, 2.16766, 0.820795, 0.53811, 2.15057, 0.799197, 0.491676, 2.21902, 0.820795, 0.491676, 2.21902, 0.820795, 0.477807, 2.20048, 0.799197, 0.424888, 2.26405, 0.820795, 0.424888, 2.26405, 0.820795, 0.412903, 2.24424, 0.799197, 0.344023, 2.28142, 0.799197, 0.424888, 2.26405, 0.820795, 0.354008, 2.30231, 0.820795, 0.271829, 2.31168, 0.799197, 0.354008, 2.30231, 0.820795, 0.279719, 2.33345, 0.820795, 0.202736, 2.35715, 0.820795, 0.202736, 2.35715, 0.820795, 0.197017, 2.33471, 0.799197, 0.1238, 2.37319, 0.820796, 0.1238, 2.37319, 0.820796, 0.120308, 2.3503, 0.799197, 0.043672, 2.38142, 0.820796, 0.043672, 2.38142, 0.820796, 0.04244, 2.3583, 0.799197, -0.035836, 2.35862, 0.799197, -0.036876, 2.38175, 0.820796, 0.043672, 2.38142, 0.820796, -0.117069, 2.37419, 0.820796, -0.117069, 2.37419, 0.820796, -0.113767, 2.35127, 0.799197, -0.190603, 2.33632, 0.799197, -0.196135, 2.3588, 0.820796, -0.117069, 2.37419, 0.820796, -0.273312, 2.33574, 0.820796, -0.265603, 2.31391, 0.799197, -0.273312, 2.33574, 0.820796, -0.347857, 2.30522, 0.820796, -0.273312, 2.33574, 0.820796, -0.338045, 2.28425, 0.799197, -0.338045, 2.28425, 0.799197, -0.419052, 2.26755, 0.820796, -0.338045, 2.28425, 0.799197, -0.407232, 2.24764, 0.799197, -0.338045, 2.28425, 0.799197, -0.419052, 2.26755, 0.820796, -0.486211, 2.22307, 0.820796, -0.472496, 2.20442, 0.799197, -0.486211, 2.22307, 0.820796, -0.548687, 2.17223, 0.820796, -0.533211, 2.15501, 0.799197, -0.548687, 2.17223, 0.820796, -0.60588, 2.11551, 0.820796, -0.58879, 2.09989, 0.799197, -0.60588, 2.11551, 0.820796, -0.60588, 2.11551, 0.820796, -0.638699, 2.03959, 0.799197, -0.657237, 2.05346, 0.820796, -0.682456, 1.97469, 0.799197, -0.657237, 2.05346, 0.820796, -0.702265, 1.98667, 0.820796, -0.719642, 1.90581, 0.799197, -0.702265, 1.98667, 0.820796, -0.740529, 1.91579, 0.820796, -0.771662, 1.8415, 0.820796, -0.771662, 1.8415, 0.820796, -0.749897, 1.83361, 0.799197, -0.795364, 1.76452, 0.820796, -0.795364, 1.76452, 0.820796, -0.77293, 1.7588, 0.799197, -0.811405, 1.68558, 0.820796, -0.811405, 1.68558, 0.820796, -0.788519, 1.68209, 0.799197, -0.819633, 1.60545, 0.820796, -0.819633, 1.60545, 0.820796, -0.796514, 1.60422, 0.799197, -0.796838, 1.52595, 0.799197, -0.819633, 1.60545, 0.820796, -0.819966, 1.52491, 0.820796, -0.789489, 1.44802, 0.799197, -0.819966, 1.52491, 0.820796, -0.812404, 1.44471, 0.820796, -0.774536, 1.37118, 0.799197, -0.812404, 1.44471, 0.820796, -0.797017, 1.36565, 0.820796, -0.773955, 1.28847, 0.820796, -0.773955, 1.28847, 0.820796, -0.752124, 1.29618, 0.799197, -0.752124, 1.29618, 0.799197, -0.722469, 1.22374, 0.799197, -0.743439, 1.21393, 0.820796, -0.773955, 1.28847, 0.820796, -0.685856, 1.15455, 0.799197, -0.705763, 1.14273, 0.820796, -0.743439, 1.21393, 0.820796, 0.743439, 1.90964, 0.820795, 0.722469, 1.89983, 0.799197, 0.743439, 1.90964, 0.820795, 0.752124, 1.82739, 0.799197, 0.743439, 1.90964, 0.820795, 0.773955, 1.83509, 0.820795, 0.774536, 1.75239, 0.799197, 0.773955, 1.83509, 0.820795, 0.797017, 1.75792, 0.820795, 0.812404, 1.67885, 0.820795, 0.789489, 1.67555, 0.799197, 0.796839, 1.59762, 0.799197, 0.812404, 1.67885, 0.820795, 0.819967, 1.59866, 0.820795, 0.819633, 1.51811, 0.820795, 0.819633, 1.51811, 0.820795, 0.796514, 1.51934, 0.799197, 0.811405, 1.43798, 0.820795, 0.811405, 1.43798, 0.820795, 0.788519, 1.44148, 0.799197, 0.795364, 1.35905, 0.820795, 0.795364, 1.35905, 0.820795, 0.772929, 1.36477, 0.799197, 0.749897, 1.28995, 0.799197, 0.795364, 1.35905, 0.820795, 0.771662, 1.28207, 0.820795, 0.719642, 1.21776, 0.799197, 0.740529, 1.20777, 0.820795, 0.740529, 1.20777, 0.820795, 0.682456, 1.14888, 0.799197, 0.740529, 1.20777, 0.820795, 0.702264, 1.1369, 0.820795, 0.638698, 1.08398, 0.799197, 0.702264, 1.1369, 0.820795, 0.657237, 1.07011, 0.820795, 0.58879, 1.02367, 0.799197, 0.657237, 1.07011, 0.820795, 0.605879, 1.00805, 0.820795, 0.53321, 0.968553, 0.799197, 0.605879, 1.00805, 0.820795, 0.548687, 0.951334, 0.820795, 0.472496, 0.919146, 0.799197, 0.548687, 0.951334, 0.820795, 0.48621, 0.900493, 0.820795, 0.407231, 0.875927, 0.799197, 0.48621, 0.900493, 0.820795, 0.419051, 0.85602, 0.820795, 0.338045, 0.839314, 0.799197, 0.419051, 0.85602, 0.820795, 0.347856, 0.818345, 0.820795, 0.273312, 0.787829, 0.820795, 0.265602, 0.809659, 0.799197, 0.273312, 0.787829, 0.820795, 0.196135, 0.764766, 0.820795, 0.190602, 0.787247, 0.799197, 0.196135, 0.764766, 0.820795, 0.117069, 0.74938, 0.820795, 0.113767, 0.772294, 0.799197, 0.117069, 0.74938, 0.820795, 0.035835, 0.764945, 0.799197, 0.117069, 0.74938, 0.820795, 0.036876, 0.741817, 0.820795, -0.043673, 0.742151, 0.820795, -0.042441, 0.76527, 0.799197, -0.043673, 0.742151, 0.820795, -0.123801, 0.750378, 0.820795, -0.120309, 0.773265, 0.799197, -0.123801, 0.750378, 0.820795, -0.202736, 0.76642, 0.820796, -0.202736, 0.76642, 0.820796, -0.197018, 0.788854, 0.799197, -0.279719, 0.790121, 0.820796, -0.279719, 0.790121, 0.820796, -0.271829, 0.811887, 0.799197, -0.354008, 0.821254, 0.820796, -0.354008, 0.821254, 0.820796, -0.344023, 0.842142, 0.799197, -0.424888, 0.859519, 0.820796, -0.424888, 0.859519, 0.820796, -0.412904, 0.879327, 0.799197, -0.491676, 0.904547, 0.820796, -0.491676, 0.904547, 0.820796, -0.477808, 0.923085, 0.799197, -0.491676, 0.904547, 0.820796, -0.53811, 0.972994, 0.799197, -0.491676, 0.904547, 0.820796, -0.553729, 0.955904, 0.820796, -0.610449, 1.0131, 0.820796, -0.610449, 1.0131, 0.820796, -0.59323, 1.02857, 0.799197, -0.642637, 1.08929, 0.799197, -0.610449, 1.0131, 0.820796, -0.66129, 1.07557, 0.820796, -0.685856, 1.15455, 0.799197, -0.66129, 1.07557, 0.820796, -0.705763, 1.14273, 0.820796, 0.642638, 2.03428, 0.768625, 0.685856, 1.96902, 0.768625, 0.59323, 2.09499, 0.768625, 0.53811, 2.15057, 0.768625, 0.477807, 2.20048, 0.768625, 0.412903, 2.24424, 0.768626, 0.344023, 2.28142, 0.768626, 0.271829, 2.31168, 0.768625, 0.197017, 2.33471, 0.768625, 0.120308, 2.3503, 0.768626, 0.04244, 2.3583, 0.768626, -0.035836, 2.35862, 0.768626, -0.113767, 2.35127, 0.768626, -0.190603, 2.33632, 0.768626, -0.265603, 2.31391, 0.768626, -0.338045, 2.28425, 0.799197, -0.338045, 2.28425, 0.768626, -0.338045, 2.28425, 0.799197, -0.407232, 2.24764, 0.768626, -0.472496, 2.20442, 0.768626, -0.533211, 2.15501, 0.768626, -0.58879, 2.09989, 0.768626, -0.638699, 2.03959, 0.768626, -0.682456, 1.97469, 0.768626, -0.719642, 1.90581, 0.768626, -0.749897, 1.83361, 0.768626, -0.77293, 1.7588, 0.768626, -0.788519, 1.68209, 0.768626, -0.796514, 1.60422, 0.768626, -0.796838, 1.52595, 0.768626, -0.789489, 1.44802, 0.768626, -0.774536, 1.37118, 0.768626, -0.752124, 1.29618, 0.768626, -0.752124, 1.29618, 0.799197, -0.722469, 1.22374, 0.768626, -0.752124, 1.29618, 0.799197, -0.685856, 1.15455, 0.768626, 0.722469, 1.89983, 0.768625, 0.752124, 1.82739, 0.768625, 0.774536, 1.75239, 0.768625, 0.789489, 1.67555, 0.768625, 0.796839, 1.59762, 0.768625, 0.796514, 1.51934, 0.768625, 0.788519, 1.44148, 0.768625, 0.772929, 1.36477, 0.768625, 0.749897, 1.28995, 0.768625, 0.719642, 1.21776, 0.768625, 0.682456, 1.14888, 0.768625, 0.638698, 1.08398, 0.768625, 0.58879, 1.02367, 0.768625, 0.53321, 0.968553, 0.768625, 0.472496, 0.919146, 0.768625, 0.407231, 0.875927, 0.768625, 0.338045, 0.839314, 0.768625, 0.265602, 0.809659, 0.768625, 0.190602, 0.787247, 0.768625, 0.113767, 0.772294, 0.768625, 0.035835, 0.764945, 0.768625, -0.042441, 0.76527, 0.768626, -0.120309, 0.773265, 0.768626, -0.197018, 0.788854, 0.768626, -0.271829, 0.811887, 0.768626, -0.344023, 0.842142, 0.768626, -0.412904, 0.879327, 0.768626, -0.477808, 0.923085, 0.768626, -0.53811, 0.972994, 0.768626, -0.59323, 1.02857, 0.768626, -0.642637, 1.08929, 0.768626, -0.685856, 1.15455, 0.768626, -0, 1.56178, -1.16078, -0.005442, 1.67257, -1.15519, -0.082186, 1.63627, -1.15519, -0.110786, 1.55634, -1.15519, -0.074489, 1.4796, -1.15519, 0.005442, 1.451, -1.15519, 0.082185, 1.48729, -1.15519, 0.110785, 1.56722, -1.15519, 0.074489, 1.64397, -1.15519, 0.033029, 1.78444, -1.13848, -0.054694, 1.78013, -1.13848, -0.134089, 1.74258, -1.13848, -0.193071, 1.67751, -1.13848, -0.222659, 1.59481, -1.13848, -0.218349, 1.50709, -1.13848, -0.180798, 1.42769, -1.13848, -0.115722, 1.36871, -1.13848, -0.033028, 1.33913, -1.13848, 0.054693, 1.34343, -1.13848, 0.134089, 1.38099, -1.13848, 0.19307, 1.44606, -1.13848, 0.222658, 1.52875, -1.13848, 0.218349, 1.61648, -1.13848, 0.180799, 1.69587, -1.13848, 0.115723, 1.75485, -1.13848, 0.049146, 1.89309, -1.1108, -0.081382, 1.88668, -1.1108, -0.199518, 1.8308, -1.1108, -0.287279, 1.73397, -1.1108, -0.331305, 1.61093, -1.1108, -0.324893, 1.4804, -1.1108, -0.269018, 1.36226, -1.1108, -0.172188, 1.2745, -1.1108, -0.049145, 1.23048, -1.1108, 0.081381, 1.23689, -1.1108, 0.199517, 1.29277, -1.1108, 0.287279, 1.38959, -1.1108, 0.331305, 1.51264, -1.1108, 0.324893, 1.64316, -1.1108, 0.269019, 1.7613, -1.1108, 0.17219, 1.84906, -1.1108, 0.021771, 2.00493, -1.07242, -0.065101, 2.00066, -1.07242, -0.14947, 1.97952, -1.07242, -0.228095, 1.94234, -1.07242, -0.297955, 1.89053, -1.07242, -0.356364, 1.82608, -1.07242, -0.401079, 1.75148, -1.07242, -0.43038, 1.66959, -1.07242, -0.443142, 1.58355, -1.07242, -0.438874, 1.49668, -1.07242, -0.417741, 1.41231, -1.07242, -0.380554, 1.33369, -1.07242, -0.328742, 1.26383, -1.07242, -0.264297, 1.20542, -1.07242, -0.189696, 1.1607, -1.07242, -0.107805, 1.1314, -1.07242, -0.02177, 1.11864, -1.07242, 0.0651, 1.12291, -1.07242, 0.149469, 1.14404, -1.07242, 0.228094, 1.18123, -1.07242, 0.297954, 1.23304, -1.07242, 0.356363, 1.29748, -1.07242, 0.401078, 1.37209, -1.07242, 0.430379, 1.45398, -1.07242, 0.443142, 1.54001, -1.07242, 0.438874, 1.62688, -1.07242, 0.417741, 1.71125, -1.07242, 0.380555, 1.78988, -1.07242, 0.328744, 1.85974, -1.07242, 0.328744, 1.85974, -1.07242, 0.264299, 1.91815, -1.07242, 0.328744, 1.85974, -1.07242, 0.189698, 1.96286, -1.07242, 0.107807, 1.99216, -1.07242, 0.026819, 2.10765, -1.02372, 0.026819, 2.10765, -1.02372, -0.080193, 2.1024, -1.02372, -0.18412, 2.07636, -1.02372, -0.280972, 2.03056, -1.02372, -0.367027, 1.96673, -1.02372, -0.438976, 1.88735, -1.02372, -0.494056, 1.79545, -1.02372, -0.53015, 1.69458, -1.02372, -0.545871, 1.5886, -1.02372, -0.540614, 1.48159, -1.02372, -0.514581, 1.37766, -1.02372, -0.468773, 1.28081, -1.02372, -0.404951, 1.19476, -1.02372, -0.325567, 1.12281, -1.02372, -0.233671, 1.06773, -1.02372, -0.132796, 1.03163, -1.02372, -0.026817, 1.01591, -1.02372, 0.080192, 1.02117, -1.02372, 0.184119, 1.0472, -1.02372, 0.280971, 1.09301, -1.02372, 0.367025, 1.15683, -1.02372, 0.438975, 1.23621, -1.02372, 0.494055, 1.32811, -1.02372, 0.53015, 1.42899, -1.02372, 0.54587, 1.53497, -1.02372, 0.540614, 1.64197, -1.02372, 0.54587, 1.53497, -1.02372, 0.514582, 1.7459, -1.02372, 0.468775, 1.84275, -1.02372, 0.404953, 1.92881, -1.02372, 0.328744, 1.85974, -1.07242, 0.328744, 1.85974, -1.07242, 0.325569, 2.00076, -1.02372, 0.233674, 2.05584, -1.02372, 0.132799, 2.09193, -1.02372, 0.026819, 2.10765, -1.02372, 0.026819, 2.10765, -1.02372, 0.031607, 2.20513, -0.965153, 0.026819, 2.10765, -1.02372, -0.094512, 2.19893, -0.965153, -0.216997, 2.16825, -0.965153, -0.331143, 2.11426, -0.965153, -0.432563, 2.03904, -0.965153, -0.517361, 1.94548, -0.965153, -0.582276, 1.83718, -0.965153, -0.624815, 1.71829, -0.965153, -0.643342, 1.59339, -0.965153, -0.637146, 1.46727, -0.965153, -0.606465, 1.34479, -0.965153, -0.552478, 1.23064, -0.965153, -0.47726, 1.12922, -0.965153, -0.552478, 1.23064, -0.965153, -0.3837, 1.04442, -0.965153, -0.275396, 0.979508, -0.965153, -0.156508, 0.936969, -0.965153, -0.031606, 0.918441, -0.965153, 0.094511, 0.924637, -0.965153, 0.216996, 0.955318, -0.965153, 0.331142, 1.00931, -0.965153, 0.432562, 1.08452, -0.965153, 0.517359, 1.17808, -0.965153, 0.582275, 1.28639, -0.965153, 0.624814, 1.40527, -0.965153, 0.643342, 1.53018, -0.965153, 0.54587, 1.53497, -1.02372, 0.624814, 1.40527, -0.965153, 0.637147, 1.65629, -0.965153, 0.54587, 1.53497, -1.02372, 0.606466, 1.77878, -0.965153, 0.55248, 1.89292, -0.965153, 0.477262, 1.99434, -0.965153, 0.383703, 2.07914, -0.965153, 0.275399, 2.14406, -0.965153, 0.156512, 2.1866, -0.965153, 0.026819, 2.10765, -1.02372, -0, 2.27601, -0.911264, -0.070007, 2.27257, -0.911264, -0.139339, 2.26228, -0.911264, -0.207329, 2.24525, -0.911264, -0.273323, 2.22164, -0.911264, -0.336684, 2.19167, -0.911264, -0.396803, 2.15564, -0.911264, -0.4531, 2.11389, -0.911264, -0.505034, 2.06682, -0.911264, -0.552104, 2.01488, -0.911264, -0.593857, 1.95859, -0.911264, -0.629891, 1.89847, -0.911264, -0.659859, 1.8351, -0.911264, -0.683472, 1.76911, -0.911264, -0.700502, 1.70112, -0.911264, -0.710787, 1.63179, -0.911264, -0.714226, 1.56178, -0.911264, -0.710787, 1.49178, -0.911264, -0.700502, 1.42244, -0.911264, -0.683471, 1.35445, -0.911264, -0.659858, 1.28846, -0.911264, -0.629891, 1.2251, -0.911264, -0.552478, 1.23064, -0.965153, -0.552478, 1.23064, -0.965153, -0.593857, 1.16498, -0.911264, -0.552104, 1.10868, -0.911264, -0.552478, 1.23064, -0.965153, -0.505033, 1.05675, -0.911264, -0.505033, 1.05675, -0.911264, -0.4531, 1.00968, -0.911264, -0.505033, 1.05675, -0.911264, -0.396802, 0.967926, -0.911264, -0.336683, 0.931892, -0.911264, -0.273322, 0.901925, -0.911264, -0.207329, 0.878312, -0.911264, -0.139339, 0.861281, -0.911264, -0.139339, 0.861281, -0.911264, -0.070007, 0.850997, -0.911264, -0.139339, 0.861281, -0.911264, -0, 0.847558, -0.911264, 0.070006, 0.850997, -0.911264, 0.139338, 0.861281, -0.911264, 0.207328, 0.878312, -0.911264, 0.273321, 0.901924, -0.911264, 0.336683, 0.931892, -0.911264, 0.396802, 0.967926, -0.911264, 0.453099, 1.00968, -0.911264, 0.505033, 1.05675, -0.911264, 0.552103, 1.10868, -0.911264, 0.593856, 1.16498, -0.911264, 0.62989, 1.2251, -0.911264, 0.659858, 1.28846, -0.911264, 0.624814, 1.40527, -0.965153, 0.683471, 1.35445, -0.911264, 0.624814, 1.40527, -0.965153, 0.624814, 1.40527, -0.965153, 0.700502, 1.42244, -0.911264, 0.710786, 1.49178, -0.911264, 0.624814, 1.40527, -0.965153, 0.714226, 1.56178, -0.911264, 0.710787, 1.63179, -0.911264, 0.700503, 1.70112, -0.911264, 0.683472, 1.76911, -0.911264, 0.65986, 1.8351, -0.911264, 0.629892, 1.89846, -0.911264, 0.593859, 1.95858, -0.911264, 0.552106, 2.01488, -0.911264, 0.505037, 2.06681, -0.911264, 0.453103, 2.11388, -0.911264, 0.396806, 2.15564, -0.911264, 0.336687, 2.19167, -0.911264, 0.273326, 2.22164, -0.911264, 0.207333, 2.24525, -0.911264, 0.139343, 2.26228, -0.911264, 0.070011, 2.27257, -0.911264, -0.069263, 2.26502, -0.888568, -0, 2.26842, -0.888568, -0.030646, 2.1856, -0.888568, -0.151759, 2.16764, -0.888568, -0.137859, 2.25484, -0.888568, -0.205127, 2.23799, -0.888568, -0.270419, 2.21463, -0.888568, -0.26704, 2.12639, -0.888568, -0.333107, 2.18498, -0.888568, -0.372058, 2.06345, -0.888568, -0.392587, 2.14933, -0.888568, -0.448287, 2.10802, -0.888568, -0.462778, 1.98122, -0.888568, -0.499669, 2.06145, -0.888568, -0.546239, 2.01007, -0.888568, -0.535715, 1.88288, -0.888568, -0.587549, 1.95437, -0.888568, -0.6232, 1.89489, -0.888568, -0.588063, 1.77219, -0.888568, -0.652849, 1.8322, -0.888568, -0.676211, 1.76691, -0.888568, -0.617813, 1.65343, -0.888568, -0.693061, 1.69964, -0.888568, -0.703236, 1.63105, -0.888568, -0.706638, 1.56178, -0.888568, -0.623821, 1.53114, -0.888568, -0.703236, 1.49252, -0.888568, -0.69306, 1.42393, -0.888568, -0.605855, 1.41002, -0.888568, -0.676211, 1.35666, -0.888568, -0.652849, 1.29136, -0.888568, -0.564607, 1.29474, -0.888568, -0.623199, 1.22868, -0.888568, -0.587548, 1.1692, -0.888568, -0.501662, 1.18973, -0.888568, -0.546238, 1.1135, -0.888568, -0.499668, 1.06211, -0.888568, -0.419437, 1.099, -0.888568, -0.448286, 1.01554, -0.888568, -0.392587, 0.974235, -0.888568, -0.321094, 1.02607, -0.888568, -0.333107, 0.938584, -0.888568, -0.210412, 0.97372, -0.888568, -0.270419, 0.908935, -0.888568, -0.205126, 0.885573, -0.888568, -0.091644, 0.94397, -0.888568, -0.137858, 0.868723, -0.888568, -0.069263, 0.858548, -0.888568, 0.030646, 0.937962, -0.888568, -0, 0.855145, -0.888568, 0.069262, 0.858548, -0.888568, 0.151758, 0.955928, -0.888568, 0.137858, 0.868723, -0.888568, 0.205125, 0.885573, -0.888568, 0.267039, 0.997175, -0.888568, 0.270418, 0.908934, -0.888568, 0.333106, 0.938584, -0.888568, 0.372057, 1.06012, -0.888568, 0.392586, 0.974234, -0.888568, 0.448286, 1.01554, -0.888568, 0.499668, 1.06211, -0.888568, 0.462777, 1.14234, -0.888568, 0.546238, 1.11349, -0.888568, 0.535713, 1.24069, -0.888568, 0.587547, 1.16919, -0.888568, 0.623198, 1.22868, -0.888568, 0.588062, 1.35137, -0.888568, 0.652848, 1.29136, -0.888568, 0.67621, 1.35666, -0.888568, 0.617813, 1.47014, -0.888568, 0.69306, 1.42392, -0.888568, 0.703235, 1.49252, -0.888568, 0.623821, 1.59243, -0.888568, 0.706638, 1.56178, -0.888568, 0.703236, 1.63104, -0.888568, 0.605856, 1.71354, -0.888568, 0.693061, 1.69964, -0.888568, 0.676212, 1.76691, -0.888568, 0.564609, 1.82882, -0.888568, 0.65285, 1.8322, -0.888568, 0.623201, 1.89489, -0.888568, 0.501664, 1.93384, -0.888568, 0.58755, 1.95437, -0.888568, 0.546241, 2.01007, -0.888568, 0.41944, 2.02456, -0.888568, 0.499671, 2.06145, -0.888568, 0.44829, 2.10802, -0.888568, 0.321098, 2.0975, -0.888568, 0.39259, 2.14933, -0.888568, 0.333111, 2.18498, -0.888568, 0.210416, 2.14985, -0.888568, 0.270423, 2.21463, -0.888568, 0.20513, 2.23799, -0.888568, 0.091648, 2.1796, -0.888568, 0.137863, 2.25484, -0.888568, 0.069267, 2.26502, -0.888568, -0.270419, 2.21463, -0.888568, -0.652849, 1.29136, -0.888568, -0.587548, 1.1692, -0.888568, -0.505033, 1.05675, -0.911264, -0.505033, 1.05675, -0.911264, -0.499668, 1.06211, -0.888568, -0.139339, 0.861281, -0.911264, -0.139339, 0.861281, -0.911264, -0.139339, 0.861281, -0.911264, 0.499668, 1.06211, -0.888568, 0, 1.56178, 1.16078, -0.082185, 1.63627, 1.15519, -0.005442, 1.67257, 1.15519, -0.110785, 1.55634, 1.15519, -0.074488, 1.4796, 1.15519, 0.005443, 1.451, 1.15519, 0.082186, 1.4873, 1.15519, 0.110786, 1.56723, 1.15519, 0.074489, 1.64397, 1.15519, -0.054694, 1.78013, 1.13848, 0.03303, 1.78444, 1.13848, -0.134089, 1.74258, 1.13848, -0.19307, 1.67751, 1.13848, -0.222659, 1.59481, 1.13848, -0.218349, 1.50709, 1.13848, -0.180798, 1.4277, 1.13848, -0.115722, 1.36871, 1.13848, -0.033028, 1.33913, 1.13848, 0.054694, 1.34343, 1.13848, 0.134089, 1.38099, 1.13848, 0.19307, 1.44606, 1.13848, 0.222659, 1.52875, 1.13848, 0.21835, 1.61648, 1.13848, 0.180799, 1.69587, 1.13848, 0.115723, 1.75485, 1.13848, 0.049146, 1.89309, 1.1108, -0.081381, 1.88668, 1.1108, -0.199518, 1.8308, 1.1108, -0.287279, 1.73397, 1.1108, -0.331305, 1.61093, 1.1108, -0.324893, 1.4804, 1.1108, -0.269018, 1.36227, 1.1108, -0.172188, 1.2745, 1.1108, -0.049144, 1.23048, 1.1108, 0.081381, 1.23689, 1.1108, 0.199517, 1.29277, 1.1108, 0.287279, 1.38959, 1.1108, 0.331305, 1.51264, 1.1108, 0.324893, 1.64316, 1.1108, 0.26902, 1.7613, 1.1108, 0.17219, 1.84906, 1.1108, 0.021772, 2.00493, 1.07242, -0.065101, 2.00066, 1.07242, -0.14947, 1.97952, 1.07242, -0.228095, 1.94234, 1.07242, -0.297955, 1.89053, 1.07242, -0.356364, 1.82608, 1.07242, -0.401079, 1.75148, 1.07242, -0.43038, 1.66959, 1.07242, -0.443142, 1.58355, 1.07242, -0.438874, 1.49668, 1.07242, -0.41774, 1.41231, 1.07242, -0.380553, 1.33369, 1.07242, -0.328742, 1.26383, 1.07242, -0.264297, 1.20542, 1.07242, -0.189696, 1.1607, 1.07242, -0.107804, 1.1314, 1.07242, -0.02177, 1.11864, 1.07242, 0.065101, 1.12291, 1.07242, 0.14947, 1.14404, 1.07242, 0.228095, 1.18123, 1.07242, 0.297954, 1.23304, 1.07242, 0.356364, 1.29748, 1.07242, 0.401078, 1.37209, 1.07242, 0.43038, 1.45398, 1.07242, 0.443142, 1.54001, 1.07242, 0.438875, 1.62688, 1.07242, 0.417742, 1.71125, 1.07242, 0.380555, 1.78988, 1.07242, 0.328744, 1.85974, 1.07242, 0.2643, 1.91815, 1.07242, 0.189699, 1.96286, 1.07242, 0.107807, 1.99216, 1.07242, 0.026819, 2.10765, 1.02372, -0.080192, 2.1024, 1.02372, 0.026819, 2.10765, 1.02372, -0.18412, 2.07636, 1.02372, -0.280972, 2.03056, 1.02372, -0.367026, 1.96674, 1.02372, -0.438976, 1.88735, 1.02372, -0.494056, 1.79545, 1.02372, -0.53015, 1.69458, 1.02372, -0.54587, 1.5886, 1.02372, -0.540613, 1.48159, 1.02372, -0.514581, 1.37766, 1.02372, -0.468773, 1.28081, 1.02372, -0.404951, 1.19476, 1.02372, -0.325566, 1.12281, 1.02372, -0.233671, 1.06773, 1.02372, -0.132796, 1.03163, 1.02372, -0.026817, 1.01591, 1.02372, -0.026817, 1.01591, 1.02372, -0.026817, 1.01591, 1.02372, 0.080192, 1.02117, 1.02372, 0.18412, 1.0472, 1.02372, 0.280971, 1.09301, 1.02372, 0.367026, 1.15683, 1.02372, 0.438975, 1.23622, 1.02372, 0.494056, 1.32811, 1.02372, 0.53015, 1.42899, 1.02372, 0.54587, 1.53497, 1.02372, 0.54587, 1.53497, 1.02372, 0.540614, 1.64197, 1.02372, 0.54587, 1.53497, 1.02372, 0.514582, 1.7459, 1.02372, 0.468775, 1.84275, 1.02372, 0.404953, 1.92881, 1.02372, 0.325569, 2.00076, 1.02372, 0.233674, 2.05584, 1.02372, 0.132799, 2.09193, 1.02372, 0.026819, 2.10765, 1.02372, 0.026819, 2.10765, 1.02372, 0.031608, 2.20513, 0.965153, -0.094512, 2.19893, 0.965153, 0.026819, 2.10765, 1.02372, -0.216997, 2.16825, 0.965153, -0.331143, 2.11426, 0.965153, -0.432563, 2.03904, 0.965153, -0.51736, 1.94548, 0.965153, -0.582276, 1.83718, 0.965153, -0.624815, 1.71829, 0.965153, -0.643342, 1.59339, 0.965153, -0.637146, 1.46727, 0.965153, -0.606465, 1.34479, 0.965153, -0.552478, 1.23064, 0.965153, -0.47726, 1.12922, 0.965154, -0.552478, 1.23064, 0.965153, -0.3837, 1.04442, 0.965154, -0.275396, 0.979508, 0.965153, -0.156508, 0.936969, 0.965153, -0.026817, 1.01591, 1.02372, -0.026817, 1.01591, 1.02372, -0.031605, 0.918441, 0.965153, 0.094511, 0.924637, 0.965153, -0.026817, 1.01591, 1.02372, -0.026817, 1.01591, 1.02372, 0.216996, 0.955318, 0.965153, 0.331142, 1.00931, 0.965153, 0.432562, 1.08452, 0.965153, 0.51736, 1.17808, 0.965153, 0.582275, 1.28639, 0.965153, 0.624814, 1.40527, 0.965153, 0.643342, 1.53018, 0.965153, 0.624814, 1.40527, 0.965153, 0.54587, 1.53497, 1.02372, 0.54587, 1.53497, 1.02372, 0.637147, 1.65629, 0.965153, 0.606467, 1.77878, 0.965153, 0.55248, 1.89292, 0.965153, 0.477262, 1.99434, 0.965153, 0.383704, 2.07914, 0.965153, 0.275399, 2.14406, 0.965153, 0.156512, 2.1866, 0.965153, 0.026819, 2.10765, 1.02372, 0, 2.27601, 0.911264, -0.070006, 2.27257, 0.911264, -0.139339, 2.26229, 0.911264, -0.207329, 2.24525, 0.911264, -0.273322, 2.22164, 0.911264, -0.336684, 2.19167, 0.911264, -0.396803, 2.15564, 0.911264, -0.4531, 2.11389, 0.911264, -0.505034, 2.06682, 0.911264, -0.552104, 2.01488, 0.911264, -0.593857, 1.95859, 0.911264, -0.629891, 1.89847, 0.911264, -0.659859, 1.83511, 0.911264, -0.683471, 1.76911, 0.911264, -0.700502, 1.70112, 0.911264, -0.710786, 1.63179, 0.911264, -0.714226, 1.56178, 0.911264, -0.710786, 1.49178, 0.911264, -0.700502, 1.42245, 0.911264, -0.683471, 1.35445, 0.911264, -0.659858, 1.28846, 0.911265, -0.552478, 1.23064, 0.965153, -0.629891, 1.2251, 0.911265, -0.552478, 1.23064, 0.965153, -0.593857, 1.16498, 0.911265, -0.552478, 1.23064, 0.965153, -0.552103, 1.10868, 0.911265, -0.552478, 1.23064, 0.965153, -0.505033, 1.05675, 0.911265, -0.453099, 1.00968, 0.911265, -0.396802, 0.967926, 0.911265, -0.336683, 0.931892, 0.911265, -0.273322, 0.901925, 0.911265, -0.207329, 0.878312, 0.911264, -0.139338, 0.861281, 0.911264, -0.070006, 0.850997, 0.911264, -0, 0.847558, 0.911264, 0.070006, 0.850997, 0.911264, 0.139338, 0.861281, 0.911264, 0.207328, 0.878312, 0.911264, 0.273322, 0.901925, 0.911264, 0.336683, 0.931892, 0.911264, 0.396802, 0.967926, 0.911264, 0.453099, 1.00968, 0.911264, 0.505033, 1.05675, 0.911264, 0.552103, 1.10868, 0.911264, 0.593856, 1.16498, 0.911264, 0.593856, 1.16498, 0.911264, 0.593856, 1.16498, 0.911264, 0.62989, 1.2251, 0.911264, 0.659858, 1.28846, 0.911264, 0.624814, 1.40527, 0.965153, 0.624814, 1.40527, 0.965153, 0.683471, 1.35445, 0.911264, 0.624814, 1.40527, 0.965153, 0.700502, 1.42244, 0.911264, 0.710787, 1.49178, 0.911264, 0.624814, 1.40527, 0.965153, 0.714226, 1.56178, 0.911264, 0.710787, 1.63179, 0.911264, 0.700503, 1.70112, 0.911264, 0.683472, 1.76911, 0.911264, 0.65986, 1.8351, 0.911264, 0.629893, 1.89846, 0.911264, 0.593859, 1.95858, 0.911264, 0.552106, 2.01488, 0.911264, 0.505037, 2.06681, 0.911264, 0.453103, 2.11388, 0.911264, 0.396806, 2.15564, 0.911264, 0.336687, 2.19167, 0.911264, 0.273326, 2.22164, 0.911264, 0.207333, 2.24525, 0.911264, 0.139343, 2.26228, 0.911264, 0.070011, 2.27257, 0.911264, -0.069263, 2.26502, 0.888568, -0.030646, 2.1856, 0.888568, 0, 2.26842, 0.888568, -0.137858, 2.25484, 0.888568, -0.151759, 2.16764, 0.888568, -0.205126, 2.23799, 0.888568, -0.267039, 2.12639, 0.888568, -0.270419, 2.21463, 0.888568, -0.333107, 2.18498, 0.888568, -0.372058, 2.06345, 0.888568, -0.392587, 2.14933, 0.888568, -0.448287, 2.10802, 0.888568, -0.462778, 1.98122, 0.888568, -0.499669, 2.06145, 0.888568, -0.546239, 2.01007, 0.888568, -0.587548, 1.95437, 0.888568, -0.535714, 1.88288, 0.888568, -0.623199, 1.89489, 0.888568, -0.652849, 1.8322, 0.888568, -0.588063, 1.7722, 0.888568, -0.676211, 1.76691, 0.888568, -0.69306, 1.69964, 0.888568, -0.617813, 1.65343, 0.888568, -0.703236, 1.63105, 0.888568, -0.706638, 1.56178, 0.888568, -0.623821, 1.53114, 0.888568, -0.703236, 1.49252, 0.888568, -0.69306, 1.42393, 0.888568, -0.605855, 1.41002, 0.888568, -0.67621, 1.35666, 0.888568, -0.652848, 1.29136, 0.888568, -0.564607, 1.29474, 0.888568, -0.623199, 1.22868, 0.888568, -0.587548, 1.1692, 0.888568, -0.501661, 1.18973, 0.888568, -0.546238, 1.1135, 0.888568, -0.419437, 1.099, 0.888568, -0.499668, 1.06211, 0.888568, -0.448286, 1.01554, 0.888568, -0.321094, 1.02607, 0.888568, -0.392587, 0.974235, 0.888568, -0.333107, 0.938584, 0.888568, -0.210412, 0.97372, 0.888568, -0.270418, 0.908935, 0.888568, -0.205126, 0.885573, 0.888568, -0.091644, 0.94397, 0.888568, -0.137858, 0.868723, 0.888568, -0.069263, 0.858548, 0.888568, -0, 0.855145, 0.888568, 0.030646, 0.937963, 0.888568, 0.069262, 0.858548, 0.888568, 0.151758, 0.955928, 0.888568, 0.137858, 0.868723, 0.888568, 0.205126, 0.885573, 0.888568, 0.270418, 0.908935, 0.888568, 0.267039, 0.997176, 0.888568, 0.333106, 0.938584, 0.888568, 0.372057, 1.06012, 0.888568, 0.392586, 0.974235, 0.888568, 0.448286, 1.01554, 0.888568, 0.462777, 1.14234, 0.888568, 0.499668, 1.06211, 0.888568, 0.546238, 1.1135, 0.888568, 0.535714, 1.24069, 0.888568, 0.587547, 1.16919, 0.888568, 0.623199, 1.22868, 0.888568, 0.588063, 1.35137, 0.888568, 0.652848, 1.29136, 0.888568, 0.67621, 1.35666, 0.888568, 0.617813, 1.47014, 0.888568, 0.69306, 1.42392, 0.888568, 0.703236, 1.49252, 0.888568, 0.623821, 1.59243, 0.888568, 0.706639, 1.56178, 0.888568, 0.703236, 1.63104, 0.888568, 0.605856, 1.71354, 0.888568, 0.693061, 1.69964, 0.888568, 0.676212, 1.76691, 0.888568, 0.564609, 1.82882, 0.888568, 0.65285, 1.8322, 0.888568, 0.623201, 1.89489, 0.888568, 0.58755, 1.95437, 0.888568, 0.501664, 1.93384, 0.888568, 0.546241, 2.01007, 0.888568, 0.499672, 2.06145, 0.888568, 0.41944, 2.02456, 0.888568, 0.44829, 2.10802, 0.888568, 0.392591, 2.14933, 0.888568, 0.321098, 2.0975, 0.888568, 0.333111, 2.18498, 0.888568, 0.270423, 2.21463, 0.888568, 0.210416, 2.14985, 0.888568, 0.205131, 2.23799, 0.888568, 0.091648, 2.1796, 0.888568, 0.137863, 2.25484, 0.888568, 0.069267, 2.26502, 0.888568, -0.706638, 1.56178, 0.888568, 0.593856, 1.16498, 0.911264, 0.593856, 1.16498, 0.911264, 0.593856, 1.16498, 0.911264, 0.270423, 2.21463, 0.888568, 0.76466, 2.01335, -0.000179, 0.807808, 1.9139, -0.09896, 0.813915, 1.91387, -0.000331, 0.758192, 2.00953, -0.115117, 0.7517, 1.9036, -0.32675, 0.735187, 1.99595, -0.244466, 0.707131, 1.9794, -0.338307, 0.784324, 1.91071, -0.224054, 0.722045, 1.85583, -0.425444, 0.66424, 1.95409, -0.440541, 0.793027, 1.8329, -0.292866, 0.775865, 1.7643, -0.381359, 0.826405, 1.83577, -0.173074, 0.828591, 1.77214, -0.239094, 0.821927, 1.68572, -0.311267, 0.855795, 1.72387, -0.17067, 0.852094, 1.78419, -0.105421, 0.855795, 1.72387, -0.17067, 0.855795, 1.72387, -0.17067, 0.857313, 1.62546, -0.220055, 0.855795, 1.72387, -0.17067, 0.855795, 1.72387, -0.17067, 0.872595, 1.69718, -0.088341, 0.855795, 1.72387, -0.17067, 0.879584, 1.58759, -0.113899, 0.855795, 1.72387, -0.17067, 0.860709, 1.77867, -3.3e-05, 0.878458, 1.68729, -3e-06, 0.887082, 1.57468, 0, 0.852135, 1.78407, 0.105336, 0.872599, 1.69716, 0.088328, 0.879584, 1.58759, 0.113899, 0.855798, 1.72386, 0.170665, 0.857313, 1.62546, 0.220055, 0.826506, 1.83557, 0.172923, 0.8286, 1.77212, 0.239079, 0.821927, 1.68572, 0.311267, 0.793042, 1.83288, 0.292841, 0.784456, 1.91057, 0.223795, 0.775865, 1.7643, 0.381358, 0.751714, 1.90359, 0.326725, 0.722045, 1.85583, 0.425444, 0.735192, 1.99596, 0.244446, 0.707131, 1.9794, 0.338306, 0.66424, 1.95409, 0.44054, 0.679941, 1.80195, -0.518767, 0.609441, 1.92175, -0.537195, 0.544097, 1.88319, -0.625031, 0.626112, 1.74381, -0.603539, 0.745446, 1.69034, -0.464908, 0.70237, 1.61401, -0.540862, 0.801735, 1.59458, -0.379493, 0.70237, 1.61401, -0.540862, 0.767694, 1.50265, -0.441372, 0.70237, 1.61401, -0.540862, 0.844714, 1.52115, -0.268224, 0.817738, 1.41728, -0.311955, 0.871877, 1.47501, -0.138831, 0.84921, 1.36365, -0.161441, 0.881034, 1.45928, 0, 0.859987, 1.34536, 0, 0.871877, 1.47501, 0.138831, 0.84921, 1.36365, 0.16144, 0.844714, 1.52115, 0.268224, 0.817738, 1.41728, 0.311955, 0.801736, 1.59458, 0.379493, 0.767694, 1.50265, 0.441372, 0.745446, 1.69034, 0.464908, 0.702371, 1.61401, 0.540862, 0.679942, 1.80195, 0.518767, 0.626112, 1.74381, 0.603539, 0.609441, 1.92175, 0.537195, 0.544097, 1.88319, 0.625031, 0.469219, 1.839, -0.702467, 0.561346, 1.68237, -0.678197, 0.38595, 1.78987, -0.767929, 0.486736, 1.61867, -0.741417, 0.38595, 1.78987, -0.767929, 0.647137, 1.53654, -0.607798, 0.70237, 1.61401, -0.540862, 0.70237, 1.61401, -0.540862, 0.5805, 1.4593, -0.664367, 0.720529, 1.41146, -0.495933, 0.70237, 1.61401, -0.540862, 0.66084, 1.32261, -0.542118, 0.77678, 1.3156, -0.350498, 0.722282, 1.21791, -0.383079, 0.811979, 1.25544, -0.181343, 0.760798, 1.15221, -0.198196, 0.824184, 1.23485, 0, 0.774021, 1.12976, 0, 0.811979, 1.25544, 0.181343, 0.760798, 1.15221, 0.198196, 0.77678, 1.3156, 0.350497, 0.722282, 1.21791, 0.383079, 0.720529, 1.41146, 0.495932, 0.66084, 1.32261, 0.542117, 0.647137, 1.53654, 0.607798, 0.5805, 1.4593, 0.664367, 0.561346, 1.68237, 0.678197, 0.486736, 1.61867, 0.741417, 0.469219, 1.839, 0.702467, 0.38595, 1.78987, 0.767929, 0.295769, 1.73665, -0.820241, 0.403522, 1.55382, -0.792016, 0.38595, 1.78987, -0.767929, 0.200313, 1.68032, -0.858367, 0.313088, 1.48902, -0.828774, 0.503648, 1.38365, -0.709565, 0.417937, 1.31099, -0.742499, 0.589454, 1.23774, -0.578929, 0.507776, 1.15838, -0.605772, 0.655096, 1.12601, -0.409062, 0.576547, 1.0415, -0.428036, 0.696316, 1.05586, -0.211649, 0.619676, 0.968164, -0.221449, 0.710371, 1.03194, 0, 0.619676, 0.968164, -0.221449, 0.619676, 0.968164, -0.221449, 0.634349, 0.943194, 0, 0.696316, 1.05586, 0.211648, 0.619676, 0.968164, 0.221448, 0.619676, 0.968164, 0.221448, 0.655097, 1.12601, 0.409062, 0.576547, 1.0415, 0.428035, 0.619676, 0.968164, 0.221448, 0.589454, 1.23774, 0.578929, 0.507777, 1.15838, 0.605771, 0.503648, 1.38364, 0.709564, 0.417938, 1.31099, 0.742499, 0.403522, 1.55382, 0.792016, 0.313088, 1.48902, 0.828774, 0.295769, 1.73665, 0.820241, 0.200313, 1.68032, 0.858367, 0.1014, 1.62195, -0.881898, 0.217176, 1.42548, -0.851097, 0.000321, 1.56231, -0.891164, 0.11695, 1.364, -0.858588, 0.324917, 1.24267, -0.762528, 0.225657, 1.1796, -0.769235, 0.417205, 1.08601, -0.622071, 0.318802, 1.02155, -0.627574, 0.487825, 0.966073, -0.439509, 0.390032, 0.900611, -0.443364, 0.53211, 0.890835, -0.22737, 0.619676, 0.968164, -0.221449, 0.434746, 0.824695, -0.229374, 0.619676, 0.968164, -0.221449, 0.547265, 0.865122, 0, 0.619676, 0.968164, -0.221449, 0.450034, 0.798759, 0, 0.450034, 0.798759, 0, 0.619676, 0.968164, 0.221448, 0.532111, 0.890835, 0.227369, 0.619676, 0.968164, 0.221448, 0.450034, 0.798759, 0, 0.450034, 0.798759, 0, 0.434746, 0.824695, 0.229373, 0.619676, 0.968164, 0.221448, 0.487825, 0.966072, 0.439508, 0.390032, 0.90061, 0.443364, 0.417206, 1.08601, 0.62207, 0.318802, 1.02155, 0.627573, 0.324917, 1.24267, 0.762527, 0.225658, 1.1796, 0.769234, 0.217177, 1.42548, 0.851097, 0.11695, 1.364, 0.858588, 0.101399, 1.62195, 0.881894, 0.000321, 1.56231, 0.891164, 0.808244, 1.91323, 0.097755, 0.808244, 1.91323, 0.097755, 0.808244, 1.91323, 0.097755, 0.758244, 2.00956, 0.114697, 0.808244, 1.91323, 0.097755, 0.808244, 1.91323, 0.097755, 0.808244, 1.91323, 0.097755, 0.808244, 1.91323, 0.097755, 0.698667, 2.09936, -0.098993, 0.701587, 2.10472, -0.00033, 0.662469, 2.05517, -0.326831, 0.684497, 2.08033, -0.224127, 0.606364, 2.05235, -0.425582, 0.620687, 2.12567, -0.293011, 0.552399, 2.1439, -0.381596, 0.639369, 2.15356, -0.173184, 0.58476, 2.18631, -0.239255, 0.505946, 2.2224, -0.311526, 0.555711, 2.23359, -0.170814, 0.606706, 2.20113, -0.105508, 0.470374, 2.28272, -0.220289, 0.540497, 2.26128, -0.088423, 0.447997, 2.32061, -0.114027, 0.534704, 2.27125, -3e-06, 0.606015, 2.21132, -3.3e-05, 0.440346, 2.33349, 0, 0.540483, 2.26129, 0.08841, 0.606623, 2.20122, 0.105424, 0.447997, 2.32061, 0.114027, 0.555706, 2.2336, 0.170809, 0.470374, 2.28272, 0.220289, 0.639243, 2.15375, 0.173034, 0.584747, 2.18633, 0.23924, 0.505946, 2.2224, 0.311526, 0.684443, 2.08051, 0.223867, 0.620678, 2.12569, 0.292986, 0.552399, 2.14391, 0.381596, 0.662469, 2.05519, 0.326806, 0.606364, 2.05235, 0.425582, 0.538846, 2.04155, -0.518955, 0.461938, 2.02257, -0.603808, 0.472957, 2.1531, -0.465247, 0.385293, 2.15237, -0.541324, 0.416423, 2.24895, -0.379885, 0.319435, 2.26372, -0.441896, 0.372957, 2.32232, -0.268562, 0.268915, 2.34911, -0.312411, 0.345695, 2.36855, -0.139022, 0.23717, 2.40278, -0.1617, 0.336376, 2.38427, 0, 0.226369, 2.42119, 0, 0.345694, 2.36855, 0.139021, 0.23717, 2.40278, 0.161699, 0.372957, 2.32232, 0.268562, 0.268915, 2.34911, 0.31241, 0.416423, 2.24895, 0.379884, 0.319435, 2.26372, 0.441895, 0.472956, 2.1531, 0.465246, 0.385293, 2.15237, 0.541324, 0.538845, 2.04155, 0.518955, 0.461938, 2.02257, 0.603808, 0.376817, 1.99558, -0.678526, 0.38595, 1.78987, -0.767929, 0.284956, 1.96107, -0.741808, 0.38595, 1.78987, -0.767929, 0.290726, 2.14152, -0.608373, 0.190817, 2.12056, -0.665061, 0.216727, 2.26663, -0.4966, 0.109963, 2.25738, -0.542899, 0.159977, 2.36259, -0.351081, 0.047938, 2.36217, -0.383746, 0.124288, 2.42272, -0.181673, 0.008971, 2.428, -0.198594, 0.112147, 2.44344, 0, -0.004317, 2.45048, 0, 0.124288, 2.42272, 0.181672, 0.008971, 2.428, 0.198593, 0.159977, 2.36259, 0.351081, 0.047938, 2.36217, 0.383745, 0.216727, 2.26663, 0.4966, 0.109963, 2.25738, 0.542898, 0.290724, 2.14152, 0.608373, 0.190815, 2.12056, 0.66506, 0.376817, 1.99558, 0.678526, 0.284956, 1.96107, 0.741808, 0.187922, 1.91957, -0.792479, 0.38595, 1.78987, -0.767929, 0.087422, 1.87171, -0.829253, 0.08734, 2.08986, -0.710347, -0.017804, 2.04993, -0.743342, 0.001006, 2.23596, -0.579826, -0.108118, 2.20284, -0.606757, -0.065194, 2.34789, -0.409843, -0.177355, 2.31999, -0.428878, -0.108118, 2.20284, -0.606757, -0.108118, 2.20284, -0.606757, -0.106784, 2.4182, -0.212097, -0.220834, 2.39352, -0.221931, -0.120964, 2.44217, 0, -0.235659, 2.41859, 0, -0.120964, 2.44217, 0, -0.120964, 2.44217, 0, -0.106784, 2.4182, 0.212097, -0.120964, 2.44217, 0, -0.220834, 2.39352, 0.22193, -0.120964, 2.44217, 0, -0.120964, 2.44217, 0, -0.065195, 2.34789, 0.409842, -0.177356, 2.31999, 0.428877, 0.001006, 2.23596, 0.579826, -0.108119, 2.20284, 0.606757, 0.087339, 2.08986, 0.710347, -0.017805, 2.04993, 0.743342, 0.187922, 1.91957, 0.792478, 0.087422, 1.87171, 0.829253, -0.014608, 1.81846, -0.851622, -0.116892, 1.76043, -0.859122, -0.122664, 2.00153, -0.76344, -0.22589, 1.9451, -0.77013, -0.108118, 2.20284, -0.606757, -0.215378, 2.15851, -0.623087, -0.108118, 2.20284, -0.606757, -0.319432, 2.10354, -0.628632, -0.286429, 2.27876, -0.440382, -0.108118, 2.20284, -0.606757, -0.391083, 2.22482, -0.444268, -0.331053, 2.35428, -0.227886, -0.436086, 2.30099, -0.229892, -0.346303, 2.38013, 0, -0.451461, 2.32704, 0, -0.331053, 2.35428, 0.227886, -0.436086, 2.30099, 0.229892, -0.28643, 2.27876, 0.440381, -0.391083, 2.22482, 0.444267, -0.215378, 2.15851, 0.623086, -0.319433, 2.10354, 0.628632, -0.122665, 2.00153, 0.763439, -0.225891, 1.9451, 0.77013, -0.014609, 1.81846, 0.851621, -0.116892, 1.76043, 0.859121, 0.698288, 2.10007, 0.097787, -0.034011, 2.25409, -0.853367, -0.16842, 2.23415, -0.853367, -0.168084, 2.23281, -0.888568, -0.033943, 2.25271, -0.888568, -0.296357, 2.18838, -0.853367, -0.295765, 2.18713, -0.888568, -0.412905, 2.11852, -0.853367, -0.412081, 2.11741, -0.888568, -0.513585, 2.02727, -0.853367, -0.51256, 2.02634, -0.888568, -0.594529, 1.91813, -0.853367, -0.593342, 1.91742, -0.888568, -0.652625, 1.7953, -0.853367, -0.651322, 1.79483, -0.888568, -0.685641, 1.66349, -0.853367, -0.684272, 1.66329, -0.888568, -0.692308, 1.52777, -0.853367, -0.690926, 1.52784, -0.888568, -0.671028, 1.3937, -0.888568, -0.67237, 1.39336, -0.853367, -0.625343, 1.26602, -0.888568, -0.626594, 1.26543, -0.853367, -0.555626, 1.1497, -0.888568, -0.556737, 1.14888, -0.853367, -0.464557, 1.04922, -0.888568, -0.465486, 1.0482, -0.853367, -0.356346, 0.967255, -0.853367, -0.355635, 0.968441, -0.888568, -0.233513, 0.909159, -0.853367, -0.233047, 0.910461, -0.888568, -0.101705, 0.876143, -0.853367, -0.101502, 0.877511, -0.888568, 0.03401, 0.869475, -0.853367, 0.033943, 0.870857, -0.888568, 0.168083, 0.890755, -0.888568, 0.168419, 0.889413, -0.853367, 0.295764, 0.93644, -0.888568, 0.296356, 0.935189, -0.853367, 0.41208, 1.00616, -0.888568, 0.412904, 1.00505, -0.853367, 0.512559, 1.09722, -0.888568, 0.513584, 1.0963, -0.853367, 0.594528, 1.20544, -0.853367, 0.593341, 1.20615, -0.888568, 0.652624, 1.32827, -0.853367, 0.651321, 1.32873, -0.888568, 0.68564, 1.46008, -0.853367, 0.684272, 1.46028, -0.888568, 0.692308, 1.59579, -0.853367, 0.690926, 1.59572, -0.888568, 0.672371, 1.7302, -0.853367, 0.671029, 1.72986, -0.888568, 0.626595, 1.85814, -0.853367, 0.625344, 1.85755, -0.888568, 0.55674, 1.97468, -0.853367, 0.555628, 1.97386, -0.888568, 0.465489, 2.07537, -0.853367, 0.46456, 2.07434, -0.888568, 0.35635, 2.15631, -0.853367, 0.355639, 2.15512, -0.888568, 0.233517, 2.21441, -0.853367, 0.233051, 2.2131, -0.888568, 0.10171, 2.24742, -0.853367, 0.101507, 2.24606, -0.888568, -0.0349, 2.27218, -0.822435, -0.172821, 2.25172, -0.822435, -0.304102, 2.20475, -0.822435, -0.423695, 2.13307, -0.822435, -0.527007, 2.03943, -0.822435, -0.610066, 1.92744, -0.822435, -0.66968, 1.8014, -0.822435, -0.703559, 1.66615, -0.822435, -0.7104, 1.52688, -0.822435, -0.689941, 1.38896, -0.822435, -0.642968, 1.25768, -0.822435, -0.571287, 1.13809, -0.822435, -0.477651, 1.03478, -0.822435, -0.365659, 0.951718, -0.822435, -0.239615, 0.892104, -0.822435, -0.104363, 0.858225, -0.822435, 0.034899, 0.851383, -0.822435, 0.172821, 0.871842, -0.822435, 0.3041, 0.918814, -0.822435, 0.423694, 0.990496, -0.822435, 0.527005, 1.08413, -0.822435, 0.610064, 1.19612, -0.822435, 0.669679, 1.32217, -0.822436, 0.703558, 1.45742, -0.822436, 0.7104, 1.59668, -0.822436, 0.689942, 1.7346, -0.822436, 0.64297, 1.86588, -0.822436, 0.571289, 1.98548, -0.822436, 0.477654, 2.08879, -0.822436, 0.365662, 2.17185, -0.822436, 0.239619, 2.23146, -0.822436, 0.104368, 2.26534, -0.822435, -0.181915, 2.28803, -0.800446, -0.036736, 2.30956, -0.800446, -0.320103, 2.23858, -0.800446, -0.44599, 2.16313, -0.800446, -0.554738, 2.06457, -0.800446, -0.642167, 1.94668, -0.800446, -0.704918, 1.81401, -0.800446, -0.74058, 1.67164, -0.800446, -0.747781, 1.52505, -0.800446, -0.726246, 1.37987, -0.800446, -0.676801, 1.24168, -0.800446, -0.601347, 1.11579, -0.800446, -0.502784, 1.00705, -0.800446, -0.3849, 0.919617, -0.800446, -0.252224, 0.856866, -0.800446, -0.109855, 0.821204, -0.800446, 0.036736, 0.814003, -0.800446, 0.181914, 0.835538, -0.800446, 0.320102, 0.884982, -0.800446, 0.445989, 0.960435, -0.800446, 0.554736, 1.059, -0.800446, 0.642166, 1.17688, -0.800446, 0.704917, 1.30956, -0.800446, 0.740579, 1.45193, -0.800446, 0.747781, 1.59852, -0.800446, 0.726246, 1.7437, -0.800446, 0.676803, 1.88188, -0.800446, 0.60135, 2.00777, -0.800446, 0.502788, 2.11652, -0.800446, 0.384903, 2.20395, -0.800446, 0.252228, 2.2667, -0.800446, 0.109859, 2.30236, -0.800446, -0.039278, 2.3613, -0.784662, -0.194501, 2.33828, -0.784662, -0.34225, 2.28541, -0.784662, -0.476847, 2.20474, -0.784662, -0.593118, 2.09935, -0.784662, -0.686596, 1.97331, -0.784662, -0.753689, 1.83146, -0.784662, -0.791818, 1.67924, -0.784662, -0.799518, 1.52251, -0.784662, -0.776492, 1.36728, -0.784662, -0.723627, 1.21953, -0.784661, -0.642953, 1.08494, -0.784661, -0.53757, 0.968665, -0.784661, -0.41153, 0.875187, -0.784661, -0.269674, 0.808095, -0.784661, -0.117455, 0.769966, -0.784662, 0.039277, 0.762266, -0.784662, 0.1945, 0.785291, -0.784662, 0.342249, 0.838156, -0.784662, 0.476845, 0.91883, -0.784662, 0.593116, 1.02421, -0.784662, 0.686595, 1.15025, -0.784662, 0.753688, 1.29211, -0.784662, 0.791817, 1.44433, -0.784662, 0.799518, 1.60106, -0.784662, 0.776493, 1.75628, -0.784662, 0.723628, 1.90403, -0.784662, 0.642955, 2.03863, -0.784662, 0.537574, 2.1549, -0.784662, 0.411534, 2.24838, -0.784662, 0.269679, 2.31547, -0.784662, 0.11746, 2.3536, -0.784662, -0.16842, 2.23415, 0.853367, -0.034011, 2.25409, 0.853367, -0.168084, 2.23281, 0.888568, -0.033943, 2.25271, 0.888568, -0.296357, 2.18838, 0.853367, -0.295765, 2.18713, 0.888568, -0.412905, 2.11852, 0.853367, -0.41208, 2.11741, 0.888568, -0.513585, 2.02727, 0.853367, -0.51256, 2.02634, 0.888568, -0.594529, 1.91813, 0.853367, -0.593342, 1.91742, 0.888568, -0.652625, 1.7953, 0.853367, -0.651322, 1.79483, 0.888568, -0.685641, 1.66349, 0.853367, -0.684272, 1.66329, 0.888568, -0.692308, 1.52777, 0.853367, -0.690926, 1.52784, 0.888568, -0.671028, 1.3937, 0.888568, -0.67237, 1.39336, 0.853367, -0.625343, 1.26602, 0.888568, -0.626593, 1.26543, 0.853367, -0.555626, 1.1497, 0.888568, -0.556737, 1.14888, 0.853367, -0.464557, 1.04922, 0.888568, -0.465486, 1.0482, 0.853367, -0.356346, 0.967255, 0.853367, -0.355635, 0.968441, 0.888568, -0.233513, 0.909159, 0.853367, -0.233046, 0.910462, 0.888568, -0.101705, 0.876143, 0.853367, -0.101502, 0.877512, 0.888568, 0.034011, 0.869476, 0.853367, 0.033943, 0.870857, 0.888568, 0.168083, 0.890755, 0.888568, 0.168419, 0.889413, 0.853367, 0.295765, 0.93644, 0.888568, 0.296356, 0.935189, 0.853367, 0.41208, 1.00616, 0.888568, 0.412904, 1.00505, 0.853367, 0.512559, 1.09722, 0.888568, 0.513584, 1.0963, 0.853367, 0.594528, 1.20544, 0.853367, 0.593341, 1.20615, 0.888568, 0.652624, 1.32827, 0.853367, 0.651321, 1.32873, 0.888568, 0.685641, 1.46008, 0.853367, 0.684272, 1.46028, 0.888568, 0.692308, 1.59579, 0.853367, 0.690926, 1.59572, 0.888568, 0.672371, 1.7302, 0.853367, 0.671029, 1.72987, 0.888568, 0.626595, 1.85814, 0.853367, 0.625345, 1.85755, 0.888568, 0.55674, 1.97469, 0.853367, 0.555629, 1.97386, 0.888568, 0.465489, 2.07537, 0.853367, 0.46456, 2.07434, 0.888568, 0.35635, 2.15631, 0.853367, 0.355639, 2.15512, 0.888568, 0.233517, 2.21441, 0.853367, 0.233051, 2.2131, 0.888568, 0.10171, 2.24742, 0.853367, 0.101507, 2.24606, 0.888568, -0.172821, 2.25172, 0.822436, -0.0349, 2.27218, 0.822436, -0.304101, 2.20475, 0.822436, -0.423695, 2.13307, 0.822436, -0.527006, 2.03943, 0.822436, -0.610065, 1.92744, 0.822436, -0.66968, 1.8014, 0.822436, -0.703558, 1.66615, 0.822436, -0.7104, 1.52688, 0.822436, -0.689941, 1.38896, 0.822436, -0.642968, 1.25768, 0.822436, -0.571286, 1.13809, 0.822436, -0.47765, 1.03478, 0.822436, -0.365659, 0.951718, 0.822436, -0.239615, 0.892104, 0.822436, -0.104363, 0.858225, 0.822436, 0.034899, 0.851384, 0.822436, 0.172821, 0.871842, 0.822436, 0.304101, 0.918815, 0.822436, 0.423694, 0.990496, 0.822436, 0.527006, 1.08413, 0.822436, 0.610064, 1.19612, 0.822436, 0.669679, 1.32217, 0.822435, 0.703558, 1.45742, 0.822435, 0.7104, 1.59668, 0.822435, 0.689942, 1.7346, 0.822435, 0.64297, 1.86588, 0.822435, 0.571289, 1.98548, 0.822435, 0.477654, 2.08879, 0.822435, 0.365663, 2.17185, 0.822435, 0.239619, 2.23146, 0.822435, 0.104368, 2.26534, 0.822436, -0.181915, 2.28803, 0.800446, -0.036736, 2.30957, 0.800446, -0.320103, 2.23858, 0.800446, -0.44599, 2.16313, 0.800446, -0.554737, 2.06457, 0.800446, -0.642167, 1.94668, 0.800446, -0.704918, 1.81401, 0.800446, -0.740579, 1.67164, 0.800446, -0.747781, 1.52505, 0.800446, -0.726245, 1.37987, 0.800447, -0.676801, 1.24168, 0.800446, -0.601347, 1.11579, 0.800446, -0.502784, 1.00705, 0.800446, -0.384899, 0.919617, 0.800446, -0.252223, 0.856866, 0.800446, -0.109855, 0.821204, 0.800447, 0.036736, 0.814003, 0.800446, 0.181914, 0.835538, 0.800446, 0.320102, 0.884982, 0.800446, 0.445989, 0.960435, 0.800446, 0.554736, 1.059, 0.800446, 0.642166, 1.17688, 0.800446, 0.704917, 1.30956, 0.800446, 0.740579, 1.45193, 0.800446, 0.747781, 1.59852, 0.800446, 0.726247, 1.7437, 0.800446, 0.676803, 1.88188, 0.800446, 0.60135, 2.00777, 0.800446, 0.502788, 2.11652, 0.800446, 0.384904, 2.20395, 0.800446, 0.252228, 2.2667, 0.800446, 0.109859, 2.30236, 0.800446, -0.194501, 2.33828, 0.784662, -0.039278, 2.3613, 0.784662, -0.34225, 2.28541, 0.784662, -0.476847, 2.20474, 0.784662, -0.593118, 2.09935, 0.784662, -0.686596, 1.97331, 0.784662, -0.753689, 1.83146, 0.784662, -0.791818, 1.67924, 0.784662, -0.799517, 1.52251, 0.784662, -0.776492, 1.36728, 0.784662, -0.723627, 1.21953, 0.784662, -0.642953, 1.08494, 0.784662, -0.53757, 0.968665, 0.784662, -0.411529, 0.875187, 0.784662, -0.269674, 0.808095, 0.784662, -0.117455, 0.769966, 0.784662, 0.039277, 0.762266, 0.784662, 0.1945, 0.785291, 0.784662, 0.342249, 0.838156, 0.784662, 0.476845, 0.91883, 0.784662, 0.593117, 1.02421, 0.784662, 0.686595, 1.15025, 0.784662, 0.753688, 1.29211, 0.784662, 0.791817, 1.44433, 0.784662, 0.799518, 1.60106, 0.784662, 0.776493, 1.75628, 0.784662, 0.723629, 1.90403, 0.784662, 0.642955, 2.03863, 0.784662, 0.537574, 2.1549, 0.784662, 0.411534, 2.24838, 0.784662, 0.269679, 2.31547, 0.784662, 0.11746, 2.3536, 0.784662
-};
-
-float mUVs[] = {
-0.75, 0.877191, 0.765625, 0.907026, 0.765625, 0.877191, 0.75, 0.907026, 0.78125, 0.907026, 0.78125, 0.877191, 0.796875, 0.877191, 0.796875, 0.907026, 0.8125, 0.877191, 0.8125, 0.907026, 0.828125, 0.877191, 0.828125, 0.907026, 0.84375, 0.907026, 0.84375, 0.877191, 0.859375, 0.877191, 0.859375, 0.907026, 0.875, 0.877191, 0.875, 0.907026, 0.890625, 0.877191, 0.890625, 0.907026, 0.90625, 0.877191, 0.90625, 0.907026, 0.921875, 0.907026, 0.921875, 0.877191, 0.9375, 0.877191, 0.9375, 0.907026, 0.953125, 0.877191, 0.953125, 0.907026, 0.96875, 0.877191, 0.96875, 0.907026, 0.984375, 0.877191, 0.984375, 0.907026, 1, 0.877191, 1, 0.907026, 0, 0.877191, -0, 0.907026, 0.015688, 0.877191, 0.015688, 0.907026, 0.03125, 0.907026, 0.03125, 0.877191, 0.046875, 0.877191, 0.046875, 0.907026, 0.0625, 0.877191, 0.0625, 0.907026, 0.078125, 0.877191, 0.078125, 0.907026, 0.09375, 0.877191, 0.09375, 0.907026, 0.109375, 0.907026, 0.109375, 0.877191, 0.125, 0.877191, 0.125, 0.907026, 0.140625, 0.877191, 0.140625, 0.907026, 0.15625, 0.877191, 0.15625, 0.907026, 0.171875, 0.877191, 0.171875, 0.907026, 0.1875, 0.907026, 0.1875, 0.877191, 0.203125, 0.907026, 0.203125, 0.877191, 0.21875, 0.907026, 0.21875, 0.877191, 0.234375, 0.877191, 0.234375, 0.907026, 0.25, 0.877191, 0.25, 0.907026, 0.265625, 0.877191, 0.265625, 0.907026, 0.28125, 0.877191, 0.28125, 0.907026, 0.296875, 0.907026, 0.296875, 0.877191, 0.3125, 0.907026, 0.3125, 0.877191, 0.328125, 0.907026, 0.328125, 0.877191, 0.34375, 0.877191, 0.34375, 0.907026, 0.359375, 0.877191, 0.359375, 0.907026, 0.375, 0.877191, 0.375, 0.907026, 0.390625, 0.877191, 0.390625, 0.907026, 0.40625, 0.907026, 0.40625, 0.877191, 0.421875, 0.877191, 0.421875, 0.907026, 0.4375, 0.877191, 0.4375, 0.907026, 0.453125, 0.877191, 0.453125, 0.907026, 0.46875, 0.877191, 0.46875, 0.907026, 0.484375, 0.907026, 0.484375, 0.877191, 0.5, 0.877191, 0.5, 0.907026, 0.515625, 0.877191, 0.515625, 0.907026, 0.53125, 0.877191, 0.53125, 0.907026, 0.546875, 0.877191, 0.546875, 0.907026, 0.5625, 0.877191, 0.5625, 0.907026, 0.578125, 0.877191, 0.578125, 0.907026, 0.59375, 0.907026, 0.59375, 0.877191, 0.609375, 0.877191, 0.609375, 0.907026, 0.625, 0.877191, 0.625, 0.907026, 0.640625, 0.877191, 0.640625, 0.907026, 0.65625, 0.877191, 0.65625, 0.907026, 0.671875, 0.907026, 0.671875, 0.877191, 0.6875, 0.877191, 0.6875, 0.907026, 0.703124, 0.877191, 0.703124, 0.907026, 0.718749, 0.877191, 0.718749, 0.907026, 0.734374, 0.907026, 0.734374, 0.877191, 0.765625, 0.863765, 0.75, 0.870331, 0.765625, 0.870331, 0.75, 0.863765, 0.78125, 0.863765, 0.78125, 0.870331, 0.796875, 0.863765, 0.796875, 0.870331, 0.8125, 0.870331, 0.8125, 0.863765, 0.828125, 0.870331, 0.828125, 0.863765, 0.84375, 0.863765, 0.84375, 0.870331, 0.859375, 0.863765, 0.859375, 0.870331, 0.875, 0.870331, 0.875, 0.863765, 0.890625, 0.870331, 0.890625, 0.863765, 0.90625, 0.863765, 0.90625, 0.870331, 0.921875, 0.863765, 0.921875, 0.870331, 0.9375, 0.863765, 0.9375, 0.870331, 0.953125, 0.863765, 0.953125, 0.870331, 0.96875, 0.863765, 0.96875, 0.870331, 0.984375, 0.870331, 0.984375, 0.863765, 1, 0.863765, 1, 0.870331, 0, 0.863765, 0.015688, 0.870331, 0.015688, 0.863765, 0, 0.870331, 0.03125, 0.870331, 0.03125, 0.863765, 0.046875, 0.870331, 0.046875, 0.863765, 0.0625, 0.870331, 0.0625, 0.863765, 0.078125, 0.870331, 0.078125, 0.863765, 0.09375, 0.870331, 0.09375, 0.863765, 0.109375, 0.863765, 0.109375, 0.870331, 0.125, 0.870331, 0.125, 0.863765, 0.140625, 0.870331, 0.140625, 0.863765, 0.15625, 0.870331, 0.15625, 0.863765, 0.171875, 0.870331, 0.171875, 0.863765, 0.1875, 0.863765, 0.1875, 0.870331, 0.203125, 0.870331, 0.203125, 0.863765, 0.21875, 0.870331, 0.21875, 0.863765, 0.234375, 0.870331, 0.234375, 0.863765, 0.25, 0.870331, 0.25, 0.863765, 0.265625, 0.870331, 0.265625, 0.863765, 0.28125, 0.870331, 0.28125, 0.863765, 0.296875, 0.870331, 0.296875, 0.863765, 0.3125, 0.870331, 0.3125, 0.863765, 0.328125, 0.870331, 0.328125, 0.863765, 0.34375, 0.863765, 0.34375, 0.870331, 0.359375, 0.870331, 0.359375, 0.863765, 0.375, 0.870331, 0.375, 0.863765, 0.390625, 0.870331, 0.390625, 0.863765, 0.40625, 0.870331, 0.40625, 0.863765, 0.421875, 0.870331, 0.421875, 0.863765, 0.4375, 0.863765, 0.4375, 0.870331, 0.453125, 0.870331, 0.453125, 0.863765, 0.46875, 0.863765, 0.46875, 0.870331, 0.484375, 0.863765, 0.484375, 0.870331, 0.5, 0.863765, 0.5, 0.870331, 0.515625, 0.863765, 0.515625, 0.870331, 0.53125, 0.863765, 0.53125, 0.870331, 0.546875, 0.870331, 0.546875, 0.863765, 0.5625, 0.863765, 0.5625, 0.870331, 0.578125, 0.863765, 0.578125, 0.870331, 0.59375, 0.863765, 0.59375, 0.870331, 0.609375, 0.863765, 0.609375, 0.870331, 0.625, 0.863765, 0.625, 0.870331, 0.640625, 0.870331, 0.640625, 0.863765, 0.65625, 0.863765, 0.65625, 0.870331, 0.671875, 0.863765, 0.671875, 0.870331, 0.6875, 0.863765, 0.6875, 0.870331, 0.703124, 0.870331, 0.703124, 0.863765, 0.718749, 0.870331, 0.718749, 0.863765, 0.734374, 0.870331, 0.734374, 0.863765, 0.75, 0.85611, 0.765625, 0.85611, 0.765625, 0.848969, 0.75, 0.848969, 0.78125, 0.85611, 0.78125, 0.848969, 0.796875, 0.85611, 0.796875, 0.848969, 0.8125, 0.85611, 0.8125, 0.848969, 0.828125, 0.848969, 0.828125, 0.85611, 0.84375, 0.85611, 0.84375, 0.848969, 0.859375, 0.85611, 0.859375, 0.848969, 0.875, 0.85611, 0.875, 0.848969, 0.890625, 0.848969, 0.890625, 0.85611, 0.90625, 0.85611, 0.90625, 0.848969, 0.921875, 0.85611, 0.921875, 0.848969, 0.9375, 0.85611, 0.9375, 0.848969, 0.953125, 0.848969, 0.953125, 0.85611, 0.96875, 0.848969, 0.96875, 0.85611, 0.984375, 0.85611, 0.984375, 0.848969, 1, 0.85611, 1, 0.848969, 0, 0.85611, 0.015688, 0.85611, 0.015688, 0.848969, 0, 0.848969, 0.03125, 0.85611, 0.03125, 0.848969, 0.046875, 0.848969, 0.046875, 0.85611, 0.0625, 0.848969, 0.0625, 0.85611, 0.078125, 0.85611, 0.078125, 0.848969, 0.09375, 0.85611, 0.09375, 0.848969, 0.109375, 0.85611, 0.109375, 0.848969, 0.125, 0.85611, 0.125, 0.848969, 0.140625, 0.848969, 0.140625, 0.85611, 0.15625, 0.848969, 0.15625, 0.85611, 0.171875, 0.85611, 0.171875, 0.848969, 0.1875, 0.85611, 0.1875, 0.848969, 0.203125, 0.85611, 0.203125, 0.848969, 0.21875, 0.85611, 0.21875, 0.848969, 0.234375, 0.85611, 0.234375, 0.848969, 0.25, 0.85611, 0.25, 0.848969, 0.265625, 0.848969, 0.265625, 0.85611, 0.28125, 0.85611, 0.28125, 0.848969, 0.296875, 0.85611, 0.296875, 0.848969, 0.3125, 0.85611, 0.3125, 0.848969, 0.328125, 0.85611, 0.328125, 0.848969, 0.34375, 0.85611, 0.34375, 0.848969, 0.359375, 0.85611, 0.359375, 0.848969, 0.375, 0.85611, 0.375, 0.848969, 0.390625, 0.85611, 0.390625, 0.848969, 0.40625, 0.85611, 0.40625, 0.848969, 0.421875, 0.85611, 0.421875, 0.848969, 0.4375, 0.85611, 0.4375, 0.848969, 0.453125, 0.848969, 0.453125, 0.85611, 0.46875, 0.848969, 0.46875, 0.85611, 0.484375, 0.85611, 0.484375, 0.848969, 0.5, 0.85611, 0.5, 0.848969, 0.515625, 0.85611, 0.515625, 0.848969, 0.53125, 0.85611, 0.53125, 0.848969, 0.546875, 0.848969, 0.546875, 0.85611, 0.5625, 0.85611, 0.5625, 0.848969, 0.578125, 0.848969, 0.578125, 0.85611, 0.59375, 0.85611, 0.59375, 0.848969, 0.609375, 0.85611, 0.609375, 0.848969, 0.625, 0.85611, 0.625, 0.848969, 0.640625, 0.848969, 0.640625, 0.85611, 0.65625, 0.85611, 0.65625, 0.848969, 0.671875, 0.85611, 0.671875, 0.848969, 0.6875, 0.848969, 0.6875, 0.85611, 0.703124, 0.85611, 0.703124, 0.848969, 0.718749, 0.848969, 0.718749, 0.85611, 0.734374, 0.85611, 0.734374, 0.848969, 0.75, 0.913072, 0.765625, 0.913072, 0.78125, 0.913072, 0.796875, 0.913072, 0.8125, 0.913072, 0.828125, 0.913072, 0.84375, 0.913072, 0.859375, 0.913072, 0.875, 0.913072, 0.890625, 0.913072, 0.90625, 0.913072, 0.921875, 0.913072, 0.9375, 0.913072, 0.953125, 0.913072, 0.96875, 0.913072, 0.984375, 0.913072, 1, 0.913072, -0, 0.913072, 0.015688, 0.913072, 0.03125, 0.913072, 0.046875, 0.913072, 0.0625, 0.913072, 0.078125, 0.913072, 0.09375, 0.913072, 0.109375, 0.913072, 0.125, 0.913072, 0.140625, 0.913072, 0.15625, 0.913072, 0.171875, 0.913072, 0.1875, 0.913072, 0.203125, 0.913072, 0.21875, 0.913072, 0.234375, 0.913072, 0.25, 0.913072, 0.265625, 0.913072, 0.28125, 0.913072, 0.296875, 0.913072, 0.3125, 0.913072, 0.328125, 0.913072, 0.34375, 0.913072, 0.359375, 0.913072, 0.375, 0.913072, 0.390625, 0.913072, 0.40625, 0.913072, 0.421875, 0.913072, 0.4375, 0.913072, 0.453125, 0.913072, 0.46875, 0.913072, 0.484375, 0.913072, 0.5, 0.913072, 0.515625, 0.913072, 0.53125, 0.913072, 0.546875, 0.913072, 0.5625, 0.913072, 0.578125, 0.913072, 0.59375, 0.913072, 0.609375, 0.913072, 0.625, 0.913072, 0.640625, 0.913072, 0.65625, 0.913072, 0.671875, 0.913072, 0.6875, 0.913072, 0.703124, 0.913072, 0.718749, 0.913072, 0.734374, 0.913072, 0.765625, 0.93524, 0.75, 0.93524, 0.78125, 0.93524, 0.796875, 0.93524, 0.8125, 0.93524, 0.828125, 0.93524, 0.84375, 0.93524, 0.859375, 0.93524, 0.875, 0.93524, 0.890625, 0.93524, 0.90625, 0.93524, 0.921875, 0.93524, 0.9375, 0.93524, 0.953125, 0.93524, 0.96875, 0.93524, 0.984375, 0.93524, 1, 0.93524, 0.015688, 0.93524, -0, 0.93524, 0.03125, 0.93524, 0.046875, 0.93524, 0.0625, 0.93524, 0.078125, 0.93524, 0.09375, 0.93524, 0.109375, 0.93524, 0.125, 0.93524, 0.140625, 0.93524, 0.15625, 0.93524, 0.171875, 0.93524, 0.1875, 0.93524, 0.203125, 0.93524, 0.21875, 0.93524, 0.234375, 0.93524, 0.25, 0.93524, 0.265625, 0.93524, 0.28125, 0.93524, 0.296875, 0.93524, 0.3125, 0.93524, 0.328125, 0.93524, 0.34375, 0.93524, 0.359375, 0.93524, 0.375, 0.93524, 0.390625, 0.93524, 0.40625, 0.93524, 0.421875, 0.93524, 0.4375, 0.93524, 0.453125, 0.93524, 0.46875, 0.93524, 0.484375, 0.93524, 0.5, 0.93524, 0.515625, 0.93524, 0.53125, 0.93524, 0.546875, 0.93524, 0.5625, 0.93524, 0.578125, 0.93524, 0.59375, 0.93524, 0.609375, 0.93524, 0.625, 0.93524, 0.640625, 0.93524, 0.65625, 0.93524, 0.671875, 0.93524, 0.6875, 0.93524, 0.703124, 0.93524, 0.718749, 0.93524, 0.734374, 0.93524, 0.174483, 0.551574, 0.161705, 0.547139, 0.156349, 0.562616, 0.170125, 0.567471, 0.187507, 0.571731, 0.190512, 0.555486, 0.206905, 0.557847, 0.206905, 0.557847, 0.205387, 0.574312, 0.223484, 0.558634, 0.206905, 0.557847, 0.223496, 0.57517, 0.240063, 0.557825, 0.241603, 0.574288, 0.256453, 0.55544, 0.25948, 0.571682, 0.276856, 0.567398, 0.272476, 0.551507, 0.290626, 0.562524, 0.285248, 0.547054, 0.163548, 0.541305, 0.175979, 0.545367, 0.191562, 0.549107, 0.206905, 0.557847, 0.207444, 0.551373, 0.206905, 0.557847, 0.22348, 0.552135, 0.206905, 0.557847, 0.239515, 0.551351, 0.255394, 0.549063, 0.270972, 0.545302, 0.283397, 0.541223, 0.1652, 0.535385, 0.177394, 0.539158, 0.192565, 0.542726, 0.207961, 0.544894, 0.223475, 0.545634, 0.238989, 0.544873, 0.254382, 0.542684, 0.269548, 0.539095, 0.281737, 0.535305, 0.167682, 0.527699, 0.17929, 0.531242, 0.193877, 0.534622, 0.208647, 0.536656, 0.22347, 0.537371, 0.238292, 0.536636, 0.253059, 0.534582, 0.267641, 0.531182, 0.281737, 0.535305, 0.281737, 0.535305, 0.279244, 0.527623, 0.171552, 0.516524, 0.195744, 0.52302, 0.223461, 0.525574, 0.251176, 0.522983, 0.275359, 0.516453, 0.180195, 0.494203, 0.200068, 0.499621, 0.223445, 0.50172, 0.246819, 0.49959, 0.266685, 0.494145, 0.193427, 0.461698, 0.206819, 0.465118, 0.22342, 0.466437, 0.24002, 0.465098, 0.253408, 0.461661, 0.199997, 0.446244, 0.210067, 0.447986, 0.223409, 0.448721, 0.236749, 0.447971, 0.246815, 0.446218, 0.200578, 0.399703, 0.200719, 0.443258, 0.210514, 0.443932, 0.210604, 0.399872, 0.223407, 0.444299, 0.223395, 0.400067, 0.236298, 0.443919, 0.236186, 0.399859, 0.246091, 0.443234, 0.246218, 0.39968, 0.153821, 0.543514, 0.152151, 0.560379, 0.158035, 0.545387, 0.147759, 0.558203, 0.293127, 0.543418, 0.29482, 0.560281, 0.299209, 0.558099, 0.293127, 0.543418, 0.288916, 0.545297, 0.159834, 0.540112, 0.15548, 0.53875, 0.291462, 0.538656, 0.293127, 0.543418, 0.287109, 0.540025, 0.156753, 0.533165, 0.161238, 0.534361, 0.285697, 0.534276, 0.290181, 0.533074, 0.159246, 0.525198, 0.163699, 0.526595, 0.283226, 0.526513, 0.287677, 0.525111, 0.16315, 0.513803, 0.167566, 0.51535, 0.279344, 0.515275, 0.283757, 0.513721, 0.171865, 0.491201, 0.176237, 0.492896, 0.270642, 0.492833, 0.275011, 0.491132, 0.185122, 0.45818, 0.189449, 0.460144, 0.257384, 0.460102, 0.261707, 0.458131, 0.197318, 0.444352, 0.193593, 0.443665, 0.253215, 0.443633, 0.24949, 0.444323, 0.196166, 0.400276, 0.193593, 0.443665, 0.197318, 0.444352, 0.191357, 0.400809, 0.250636, 0.400248, 0.24949, 0.444323, 0.253215, 0.443633, 0.255449, 0.400779, 0.281737, 0.535305, 0.281737, 0.535305, 0.281737, 0.535305, 0.281737, 0.535305, 0.358332, 0.551574, 0.345554, 0.547139, 0.340197, 0.562616, 0.353974, 0.567471, 0.371356, 0.571731, 0.37436, 0.555486, 0.390753, 0.557847, 0.389236, 0.574312, 0.407333, 0.558634, 0.407344, 0.57517, 0.423912, 0.557825, 0.423912, 0.557825, 0.425452, 0.574288, 0.440302, 0.55544, 0.423912, 0.557825, 0.443328, 0.571682, 0.460705, 0.567398, 0.456325, 0.551507, 0.469097, 0.547054, 0.474474, 0.562524, 0.359828, 0.545367, 0.347396, 0.541305, 0.375411, 0.549107, 0.391292, 0.551373, 0.407329, 0.552135, 0.423364, 0.551351, 0.423912, 0.557825, 0.439243, 0.549063, 0.423912, 0.557825, 0.423912, 0.557825, 0.45482, 0.545302, 0.467246, 0.541223, 0.349049, 0.535385, 0.361243, 0.539158, 0.376414, 0.542726, 0.39181, 0.544894, 0.407324, 0.545634, 0.407324, 0.545634, 0.422838, 0.544873, 0.407324, 0.545634, 0.43823, 0.542684, 0.453397, 0.539095, 0.465585, 0.535305, 0.363139, 0.531242, 0.351531, 0.527699, 0.377725, 0.534622, 0.392496, 0.536656, 0.407318, 0.537371, 0.407324, 0.545634, 0.42214, 0.536636, 0.407324, 0.545634, 0.407324, 0.545634, 0.436908, 0.534582, 0.45149, 0.531182, 0.463093, 0.527623, 0.355401, 0.516524, 0.379592, 0.52302, 0.40731, 0.525574, 0.435025, 0.522983, 0.459207, 0.516453, 0.364044, 0.494203, 0.383917, 0.499621, 0.407294, 0.50172, 0.430668, 0.49959, 0.450534, 0.494145, 0.377275, 0.461698, 0.390667, 0.465118, 0.407269, 0.466437, 0.423869, 0.465098, 0.437257, 0.461661, 0.383846, 0.446244, 0.393916, 0.447986, 0.407258, 0.448721, 0.420598, 0.447971, 0.430664, 0.446218, 0.384427, 0.399703, 0.384568, 0.443258, 0.394363, 0.443932, 0.394453, 0.399872, 0.407243, 0.400067, 0.407255, 0.444299, 0.420035, 0.399859, 0.420147, 0.443919, 0.430066, 0.39968, 0.429939, 0.443234, 0.33767, 0.543514, 0.336, 0.560379, 0.341883, 0.545387, 0.331608, 0.558203, 0.476975, 0.543418, 0.478669, 0.560281, 0.483058, 0.558099, 0.472765, 0.545297, 0.339329, 0.53875, 0.343683, 0.540112, 0.47531, 0.538656, 0.470958, 0.540025, 0.345087, 0.534361, 0.340601, 0.533165, 0.47403, 0.533074, 0.469546, 0.534276, 0.347547, 0.526595, 0.343095, 0.525198, 0.471526, 0.525111, 0.467075, 0.526513, 0.351415, 0.51535, 0.346999, 0.513803, 0.467606, 0.513721, 0.463192, 0.515275, 0.360085, 0.492896, 0.355714, 0.491201, 0.45886, 0.491132, 0.454491, 0.492833, 0.373297, 0.460144, 0.368971, 0.45818, 0.445556, 0.458131, 0.441232, 0.460102, 0.381166, 0.444352, 0.377442, 0.443665, 0.437064, 0.443633, 0.433339, 0.444323, 0.380015, 0.400276, 0.377442, 0.443665, 0.381166, 0.444352, 0.375206, 0.400809, 0.434485, 0.400248, 0.433339, 0.444323, 0.437064, 0.443633, 0.439297, 0.400779, 0.536534, 0.551574, 0.523756, 0.547139, 0.518399, 0.562616, 0.532175, 0.567471, 0.549558, 0.571731, 0.552562, 0.555486, 0.568955, 0.557847, 0.567438, 0.574312, 0.585535, 0.558634, 0.585546, 0.57517, 0.602114, 0.557825, 0.603654, 0.574288, 0.618504, 0.55544, 0.62153, 0.571682, 0.638907, 0.567398, 0.634526, 0.551507, 0.652676, 0.562524, 0.647298, 0.547054, 0.525598, 0.541305, 0.53803, 0.545367, 0.553613, 0.549107, 0.569494, 0.551373, 0.585531, 0.552135, 0.601566, 0.551351, 0.617444, 0.549063, 0.633022, 0.545302, 0.645448, 0.541223, 0.527251, 0.535385, 0.539445, 0.539158, 0.554616, 0.542726, 0.570012, 0.544894, 0.585526, 0.545634, 0.60104, 0.544873, 0.616432, 0.542684, 0.631599, 0.539095, 0.643787, 0.535305, 0.529733, 0.527699, 0.541341, 0.531242, 0.555927, 0.534622, 0.570697, 0.536656, 0.58552, 0.537371, 0.600342, 0.536636, 0.61511, 0.534582, 0.629692, 0.531182, 0.641295, 0.527623, 0.533603, 0.516524, 0.557794, 0.52302, 0.585512, 0.525574, 0.613227, 0.522983, 0.637409, 0.516453, 0.542246, 0.494203, 0.562119, 0.499621, 0.585496, 0.50172, 0.60887, 0.49959, 0.628736, 0.494145, 0.555477, 0.461698, 0.568869, 0.465118, 0.585471, 0.466437, 0.602071, 0.465098, 0.615458, 0.461661, 0.562048, 0.446244, 0.572118, 0.447986, 0.58546, 0.448721, 0.5988, 0.447971, 0.608866, 0.446218, 0.562629, 0.399703, 0.56277, 0.443258, 0.572565, 0.443932, 0.572655, 0.399872, 0.585457, 0.444299, 0.585445, 0.400067, 0.598349, 0.443919, 0.598237, 0.399859, 0.608141, 0.443234, 0.608268, 0.39968, 0.515872, 0.543514, 0.514202, 0.560379, 0.520085, 0.545387, 0.50981, 0.558203, 0.655177, 0.543418, 0.656871, 0.560281, 0.66126, 0.558099, 0.655177, 0.543418, 0.650967, 0.545297, 0.521885, 0.540112, 0.517531, 0.53875, 0.653512, 0.538656, 0.655177, 0.543418, 0.64916, 0.540025, 0.518803, 0.533165, 0.523289, 0.534361, 0.647748, 0.534276, 0.652232, 0.533074, 0.521297, 0.525198, 0.525749, 0.526595, 0.645277, 0.526513, 0.649727, 0.525111, 0.525201, 0.513803, 0.529616, 0.51535, 0.641394, 0.515275, 0.645808, 0.513721, 0.533916, 0.491201, 0.538287, 0.492896, 0.632692, 0.492833, 0.637062, 0.491132, 0.547173, 0.45818, 0.551499, 0.460144, 0.619434, 0.460102, 0.623758, 0.458131, 0.559368, 0.444352, 0.555643, 0.443665, 0.615266, 0.443633, 0.611541, 0.444323, 0.558217, 0.400276, 0.555643, 0.443665, 0.559368, 0.444352, 0.553408, 0.400809, 0.612687, 0.400248, 0.611541, 0.444323, 0.615266, 0.443633, 0.617499, 0.400779, 0.707738, 0.551574, 0.69496, 0.547139, 0.689604, 0.562616, 0.70338, 0.567471, 0.720762, 0.571731, 0.723767, 0.555486, 0.74016, 0.557847, 0.738642, 0.574312, 0.756739, 0.558634, 0.756751, 0.57517, 0.773318, 0.557825, 0.773318, 0.557825, 0.774858, 0.574288, 0.789708, 0.55544, 0.773318, 0.557825, 0.792735, 0.571682, 0.810111, 0.567398, 0.805731, 0.551507, 0.818503, 0.547054, 0.823881, 0.562524, 0.709234, 0.545367, 0.696803, 0.541305, 0.724817, 0.549107, 0.740699, 0.551373, 0.756735, 0.552135, 0.77277, 0.551351, 0.773318, 0.557825, 0.788649, 0.549063, 0.773318, 0.557825, 0.773318, 0.557825, 0.804227, 0.545302, 0.816652, 0.541223, 0.698455, 0.535385, 0.710649, 0.539158, 0.72582, 0.542726, 0.741216, 0.544894, 0.75673, 0.545634, 0.772244, 0.544873, 0.787637, 0.542684, 0.802803, 0.539095, 0.814992, 0.535305, 0.700937, 0.527699, 0.712545, 0.531242, 0.727132, 0.534622, 0.741902, 0.536656, 0.756725, 0.537371, 0.771547, 0.536636, 0.786314, 0.534582, 0.800896, 0.531182, 0.812499, 0.527623, 0.704807, 0.516524, 0.728999, 0.52302, 0.756716, 0.525574, 0.784431, 0.522983, 0.808614, 0.516453, 0.71345, 0.494203, 0.733323, 0.499621, 0.7567, 0.50172, 0.780074, 0.49959, 0.79994, 0.494145, 0.726682, 0.461698, 0.740074, 0.465118, 0.756675, 0.466437, 0.773275, 0.465098, 0.786663, 0.461661, 0.733252, 0.446244, 0.743322, 0.447986, 0.756664, 0.448721, 0.770004, 0.447971, 0.78007, 0.446218, 0.733833, 0.399703, 0.733974, 0.443258, 0.743769, 0.443932, 0.743859, 0.399872, 0.756649, 0.400067, 0.756662, 0.444299, 0.769441, 0.399859, 0.769553, 0.443919, 0.779473, 0.39968, 0.779346, 0.443234, 0.687076, 0.543514, 0.685406, 0.560379, 0.69129, 0.545387, 0.687076, 0.543514, 0.681014, 0.558203, 0.826382, 0.543418, 0.828075, 0.560281, 0.832464, 0.558099, 0.822171, 0.545297, 0.688735, 0.53875, 0.687076, 0.543514, 0.693089, 0.540112, 0.824717, 0.538656, 0.820364, 0.540025, 0.694493, 0.534361, 0.690008, 0.533165, 0.823436, 0.533074, 0.818952, 0.534276, 0.696954, 0.526595, 0.692501, 0.525198, 0.820932, 0.525111, 0.816481, 0.526513, 0.700821, 0.51535, 0.696405, 0.513803, 0.817012, 0.513721, 0.812599, 0.515275, 0.709492, 0.492896, 0.70512, 0.491201, 0.808266, 0.491132, 0.803897, 0.492833, 0.722704, 0.460144, 0.718377, 0.45818, 0.794962, 0.458131, 0.790639, 0.460102, 0.730573, 0.444352, 0.726848, 0.443665, 0.78647, 0.443633, 0.782745, 0.444323, 0.729421, 0.400276, 0.726848, 0.443665, 0.730573, 0.444352, 0.724612, 0.400809, 0.783891, 0.400248, 0.782745, 0.444323, 0.78647, 0.443633, 0.788704, 0.400779, 0.891862, 0.551574, 0.879084, 0.547139, 0.873728, 0.562616, 0.887504, 0.567471, 0.904886, 0.571731, 0.90789, 0.555486, 0.924284, 0.557847, 0.924284, 0.557847, 0.922766, 0.574312, 0.940863, 0.558634, 0.924284, 0.557847, 0.940875, 0.57517, 0.957442, 0.557825, 0.958982, 0.574288, 0.973832, 0.55544, 0.976858, 0.571682, 0.994235, 0.567398, 0.989855, 0.551507, 1.00801, 0.562524, 1.00263, 0.547054, 0.880927, 0.541305, 0.893358, 0.545367, 0.908941, 0.549107, 0.924284, 0.557847, 0.924823, 0.551373, 0.924284, 0.557847, 0.940859, 0.552135, 0.924284, 0.557847, 0.956894, 0.551351, 0.972773, 0.549063, 0.988351, 0.545302, 1.00078, 0.541223, 0.882579, 0.535385, 0.894773, 0.539158, 0.909944, 0.542726, 0.92534, 0.544894, 0.940854, 0.545634, 0.956368, 0.544873, 0.971761, 0.542684, 0.986927, 0.539095, 0.999116, 0.535305, 0.885061, 0.527699, 0.896669, 0.531242, 0.911256, 0.534622, 0.926026, 0.536656, 0.940849, 0.537371, 0.955671, 0.536636, 0.970438, 0.534582, 0.98502, 0.531182, 0.999116, 0.535305, 0.996623, 0.527623, 0.999116, 0.535305, 0.888931, 0.516524, 0.913123, 0.52302, 0.94084, 0.525574, 0.968555, 0.522983, 0.992738, 0.516453, 0.897574, 0.494203, 0.917447, 0.499621, 0.940824, 0.50172, 0.964198, 0.49959, 0.984064, 0.494145, 0.910806, 0.461698, 0.924198, 0.465118, 0.940799, 0.466437, 0.957399, 0.465098, 0.970787, 0.461661, 0.917376, 0.446244, 0.927446, 0.447986, 0.940788, 0.448721, 0.954128, 0.447971, 0.964194, 0.446218, 0.917957, 0.399703, 0.918098, 0.443258, 0.927893, 0.443932, 0.927983, 0.399872, 0.940786, 0.444299, 0.940773, 0.400067, 0.953677, 0.443919, 0.953565, 0.399859, 0.96347, 0.443234, 0.963596, 0.39968, 0.8712, 0.543514, 0.86953, 0.560379, 0.875414, 0.545387, 0.865138, 0.558203, 1.01051, 0.543418, 1.0122, 0.560281, 1.01659, 0.558099, 1.01051, 0.543418, 1.00629, 0.545297, 0.877213, 0.540112, 0.872859, 0.53875, 1.00884, 0.538656, 1.01051, 0.543418, 1.00449, 0.540025, 0.874132, 0.533165, 0.878617, 0.534361, 1.00308, 0.534276, 1.00756, 0.533074, 0.876625, 0.525198, 0.881077, 0.526595, 1.0006, 0.526513, 1.00506, 0.525111, 0.880529, 0.513803, 0.884945, 0.51535, 0.996723, 0.515275, 1.00114, 0.513721, 0.889244, 0.491201, 0.893616, 0.492896, 0.988021, 0.492833, 0.99239, 0.491132, 0.902501, 0.45818, 0.906828, 0.460144, 0.974763, 0.460102, 0.979086, 0.458131, 0.914697, 0.444352, 0.910972, 0.443665, 0.970594, 0.443633, 0.966869, 0.444323, 0.913545, 0.400276, 0.910972, 0.443665, 0.914697, 0.444352, 0.908736, 0.400809, 0.968015, 0.400248, 0.966869, 0.444323, 0.970594, 0.443633, 0.972828, 0.400779, 0.999116, 0.535305, 0.999116, 0.535305, 0.999116, 0.535305, 0.999116, 0.535305, 1.09011, 0.551574, 1.07733, 0.547139, 1.07198, 0.562616, 1.08575, 0.567471, 1.10313, 0.571731, 1.10614, 0.555486, 1.12253, 0.557847, 1.12101, 0.574312, 1.13911, 0.558634, 1.13912, 0.57517, 1.15569, 0.557825, 1.15723, 0.574288, 1.17208, 0.55544, 1.17511, 0.571682, 1.19248, 0.567398, 1.1881, 0.551507, 1.20088, 0.547054, 1.20625, 0.562524, 1.09161, 0.545367, 1.07917, 0.541305, 1.10719, 0.549107, 1.12307, 0.551373, 1.13911, 0.552135, 1.15514, 0.551351, 1.17102, 0.549063, 1.1866, 0.545302, 1.19903, 0.541223, 1.08083, 0.535385, 1.09302, 0.539158, 1.10819, 0.542726, 1.12359, 0.544894, 1.1391, 0.545634, 1.15462, 0.544873, 1.17001, 0.542684, 1.18517, 0.539095, 1.19736, 0.535305, 1.08331, 0.527699, 1.09492, 0.531242, 1.1095, 0.534622, 1.12427, 0.536656, 1.1391, 0.537371, 1.15392, 0.536636, 1.16869, 0.534582, 1.18327, 0.531182, 1.19487, 0.527623, 1.08718, 0.516524, 1.11137, 0.52302, 1.13909, 0.525574, 1.1668, 0.522983, 1.19099, 0.516453, 1.09582, 0.494203, 1.1157, 0.499621, 1.13907, 0.50172, 1.16245, 0.49959, 1.18231, 0.494145, 1.10905, 0.461698, 1.12245, 0.465118, 1.13905, 0.466437, 1.15565, 0.465098, 1.16903, 0.461661, 1.11563, 0.446244, 1.12569, 0.447986, 1.13904, 0.448721, 1.15238, 0.447971, 1.16244, 0.446218, 1.1162, 0.399703, 1.11635, 0.443258, 1.12614, 0.443932, 1.12623, 0.399872, 1.13902, 0.400067, 1.13903, 0.444299, 1.15181, 0.399859, 1.15193, 0.443919, 1.16184, 0.39968, 1.16172, 0.443234, 1.06945, 0.543514, 1.06778, 0.560379, 1.07366, 0.545387, 1.06945, 0.543514, 1.06339, 0.558203, 1.20875, 0.543418, 1.21045, 0.560281, 1.21484, 0.558099, 1.20454, 0.545297, 1.07111, 0.53875, 1.06945, 0.543514, 1.07546, 0.540112, 1.20709, 0.538656, 1.20274, 0.540025, 1.07687, 0.534361, 1.07238, 0.533165, 1.20581, 0.533074, 1.20132, 0.534276, 1.07933, 0.526595, 1.07487, 0.525198, 1.2033, 0.525111, 1.19885, 0.526513, 1.08319, 0.51535, 1.07878, 0.513803, 1.19938, 0.513721, 1.19497, 0.515275, 1.09186, 0.492896, 1.08749, 0.491201, 1.19064, 0.491132, 1.18627, 0.492833, 1.10508, 0.460144, 1.10075, 0.45818, 1.17734, 0.458131, 1.17301, 0.460102, 1.11294, 0.444352, 1.10922, 0.443665, 1.16884, 0.443633, 1.16512, 0.444323, 1.11179, 0.400276, 1.10922, 0.443665, 1.11294, 0.444352, 1.10698, 0.400809, 1.16626, 0.400248, 1.16512, 0.444323, 1.16884, 0.443633, 1.17108, 0.400779, -0.019008, 0.551574, -0.031787, 0.547139, -0.037143, 0.562616, -0.023367, 0.567471, -0.005985, 0.571731, -0.00298, 0.555486, 0.013413, 0.557847, 0.013413, 0.557847, 0.011896, 0.574312, 0.029993, 0.558634, 0.013413, 0.557847, 0.030004, 0.57517, 0.046571, 0.557825, 0.048111, 0.574288, 0.062961, 0.55544, 0.065988, 0.571682, 0.083364, 0.567398, 0.078984, 0.551507, 0.097134, 0.562524, 0.091756, 0.547054, -0.029944, 0.541305, -0.017513, 0.545367, -0.00193, 0.549107, 0.013413, 0.557847, 0.013952, 0.551373, 0.013413, 0.557847, 0.029988, 0.552135, 0.013413, 0.557847, 0.046023, 0.551351, 0.061902, 0.549063, 0.07748, 0.545302, 0.089905, 0.541223, -0.028291, 0.535385, -0.016098, 0.539158, -0.000927, 0.542726, 0.014469, 0.544894, 0.029984, 0.545634, 0.045497, 0.544873, 0.06089, 0.542684, 0.076056, 0.539095, 0.088245, 0.535305, -0.025809, 0.527699, -0.014202, 0.531242, 0.000385, 0.534622, 0.015155, 0.536656, 0.029978, 0.537371, 0.0448, 0.536636, 0.059567, 0.534582, 0.074149, 0.531182, 0.085752, 0.527623, -0.02194, 0.516524, 0.002252, 0.52302, 0.02997, 0.525574, 0.057684, 0.522983, 0.081867, 0.516453, -0.013297, 0.494203, 0.006576, 0.499621, 0.029953, 0.50172, 0.053327, 0.49959, 0.073193, 0.494145, -6.5e-05, 0.461698, 0.013327, 0.465118, 0.029929, 0.466437, 0.046528, 0.465098, 0.059916, 0.461661, 0.006506, 0.446244, 0.016575, 0.447986, 0.029917, 0.448721, 0.043257, 0.447971, 0.053323, 0.446218, 0.007086, 0.399703, 0.007227, 0.443258, 0.017022, 0.443932, 0.017113, 0.399872, 0.029915, 0.444299, 0.029903, 0.400067, 0.042806, 0.443919, 0.042695, 0.399859, 0.052599, 0.443234, 0.052726, 0.39968, -0.03967, 0.543514, -0.04134, 0.560379, -0.035457, 0.545387, -0.045732, 0.558203, 0.099635, 0.543418, 0.101328, 0.560281, 0.105717, 0.558099, 0.099635, 0.543418, 0.095424, 0.545297, -0.033658, 0.540112, -0.038012, 0.53875, 0.09797, 0.538656, 0.099635, 0.543418, 0.093618, 0.540025, -0.036739, 0.533165, -0.032253, 0.534361, 0.092205, 0.534276, 0.09669, 0.533074, -0.034246, 0.525198, -0.029793, 0.526595, 0.089735, 0.526513, 0.094185, 0.525111, -0.030342, 0.513803, -0.025926, 0.51535, 0.085852, 0.515275, 0.090265, 0.513721, -0.021627, 0.491201, -0.017255, 0.492896, 0.07715, 0.492833, 0.081519, 0.491132, -0.00837, 0.45818, -0.004043, 0.460144, 0.063892, 0.460102, 0.068216, 0.458131, 0.003826, 0.444352, 0.000101, 0.443665, 0.059723, 0.443633, 0.055998, 0.444323, 0.002674, 0.400276, 0.000101, 0.443665, 0.003826, 0.444352, -0.002134, 0.400809, 0.057144, 0.400248, 0.055998, 0.444323, 0.059723, 0.443633, 0.061957, 0.400779, 1.26961, 0.551574, 1.25683, 0.547139, 1.25147, 0.562616, 1.26525, 0.567471, 1.28263, 0.571731, 1.28563, 0.555486, 1.30203, 0.557847, 1.30051, 0.574312, 1.31861, 0.558634, 1.31862, 0.57517, 1.33519, 0.557825, 1.33672, 0.574288, 1.35158, 0.55544, 1.3546, 0.571682, 1.37198, 0.567398, 1.3676, 0.551507, 1.38037, 0.547054, 1.38575, 0.562524, 1.2711, 0.545367, 1.25867, 0.541305, 1.28668, 0.549107, 1.30257, 0.551373, 1.3186, 0.552135, 1.33464, 0.551351, 1.35052, 0.549063, 1.36609, 0.545302, 1.37852, 0.541223, 1.26032, 0.535385, 1.27252, 0.539158, 1.28769, 0.542726, 1.30308, 0.544894, 1.3186, 0.545634, 1.33411, 0.544873, 1.3495, 0.542684, 1.36467, 0.539095, 1.37686, 0.535305, 1.2628, 0.527699, 1.27441, 0.531242, 1.289, 0.534622, 1.30377, 0.536656, 1.31859, 0.537371, 1.33341, 0.536636, 1.34818, 0.534582, 1.36276, 0.531182, 1.37437, 0.527623, 1.26667, 0.516524, 1.29087, 0.52302, 1.31858, 0.525574, 1.3463, 0.522983, 1.37048, 0.516453, 1.27532, 0.494203, 1.29519, 0.499621, 1.31857, 0.50172, 1.34194, 0.49959, 1.36181, 0.494145, 1.28855, 0.461698, 1.30194, 0.465118, 1.31854, 0.466437, 1.33514, 0.465098, 1.34853, 0.461661, 1.29512, 0.446244, 1.30519, 0.447986, 1.31853, 0.448721, 1.33187, 0.447971, 1.34194, 0.446218, 1.2957, 0.399703, 1.29584, 0.443258, 1.30564, 0.443932, 1.30573, 0.399872, 1.31852, 0.400067, 1.31853, 0.444299, 1.33131, 0.399859, 1.33142, 0.443919, 1.34134, 0.39968, 1.34121, 0.443234, 1.24894, 0.543514, 1.24727, 0.560379, 1.25316, 0.545387, 1.24288, 0.558203, 1.38825, 0.543418, 1.38994, 0.560281, 1.39433, 0.558099, 1.38404, 0.545297, 1.2506, 0.53875, 1.25496, 0.540112, 1.38658, 0.538656, 1.38223, 0.540025, 1.25636, 0.534361, 1.25188, 0.533165, 1.3853, 0.533074, 1.38082, 0.534276, 1.25882, 0.526595, 1.25437, 0.525198, 1.3828, 0.525111, 1.37835, 0.526513, 1.26269, 0.51535, 1.25827, 0.513803, 1.37888, 0.513721, 1.37447, 0.515275, 1.27136, 0.492896, 1.26699, 0.491201, 1.37013, 0.491132, 1.36576, 0.492833, 1.28457, 0.460144, 1.28024, 0.45818, 1.35683, 0.458131, 1.35251, 0.460102, 1.29244, 0.444352, 1.28872, 0.443665, 1.34834, 0.443633, 1.34461, 0.444323, 1.29129, 0.400276, 1.28872, 0.443665, 1.29244, 0.444352, 1.28648, 0.400809, 1.34576, 0.400248, 1.34461, 0.444323, 1.34834, 0.443633, 1.35057, 0.400779, 0.665887, 0.505773, 0.683021, 0.56902, 0.685589, 0.499302, 0.704102, 0.562151, 0.704947, 0.492229, 0.724416, 0.55479, 0.723929, 0.484681, 0.743837, 0.54713, 0.7425, 0.476862, 0.762272, 0.539433, 0.760623, 0.4691, 0.779719, 0.532046, 0.77826, 0.461891, 0.796341, 0.525396, 0.795382, 0.455902, 0.812508, 0.519873, 0.812057, 0.45177, 0.828657, 0.515333, 0.190996, 0.44408, 0.172844, 0.507251, 0.207581, 0.448678, 0.18888, 0.512203, 0.22459, 0.455132, 0.204917, 0.518157, 0.242071, 0.462806, 0.221392, 0.525246, 0.260016, 0.47103, 0.23868, 0.533082, 0.256949, 0.541242, 0.278403, 0.479308, 0.276203, 0.549377, 0.297204, 0.487315, 0.296351, 0.557226, 0.31639, 0.494847, 0.317271, 0.564595, 0.335931, 0.50178, 0.338837, 0.571343, 0.35579, 0.508036, 0.360931, 0.577372, 0.375931, 0.513565, 0.383454, 0.582609, 0.396316, 0.51833, 0.406318, 0.587004, 0.416907, 0.522307, 0.437664, 0.525477, 0.429445, 0.590521, 0.458549, 0.527828, 0.452768, 0.593135, 0.479525, 0.529348, 0.476225, 0.594828, 0.499756, 0.59559, 0.500554, 0.530032, 0.523302, 0.595415, 0.521596, 0.529876, 0.542611, 0.528878, 0.546805, 0.594304, 0.56356, 0.527043, 0.570201, 0.592264, 0.593425, 0.589309, 0.584402, 0.524379, 0.605096, 0.520896, 0.616405, 0.585464, 0.625602, 0.516615, 0.639061, 0.580763, 0.645878, 0.511562, 0.661301, 0.575257, 0.682966, 0.490201, 0.656303, 0.469683, 0.663452, 0.496599, 0.682966, 0.490201, 0.67524, 0.463483, 0.702196, 0.483169, 0.682966, 0.490201, 0.694067, 0.456595, 0.72112, 0.475588, 0.712817, 0.449044, 0.739717, 0.467595, 0.731545, 0.440866, 0.750355, 0.432147, 0.757972, 0.459428, 0.7759, 0.451538, 0.769466, 0.423155, 0.793577, 0.444833, 0.789378, 0.414746, 0.811278, 0.441318, 0.811278, 0.441318, 0.810923, 0.409449, 0.214876, 0.407761, 0.192017, 0.433529, 0.209658, 0.437681, 0.192017, 0.433529, 0.193585, 0.40167, 0.234486, 0.416674, 0.227233, 0.444857, 0.253336, 0.426157, 0.244977, 0.453215, 0.263037, 0.461843, 0.271908, 0.435341, 0.28144, 0.470292, 0.290419, 0.443971, 0.308971, 0.451965, 0.30018, 0.478326, 0.32762, 0.459291, 0.319236, 0.485812, 0.346396, 0.465928, 0.338589, 0.492666, 0.365311, 0.471856, 0.358214, 0.498832, 0.384369, 0.477061, 0.378082, 0.50427, 0.403563, 0.481527, 0.398166, 0.508954, 0.418432, 0.51286, 0.42288, 0.485245, 0.442301, 0.488205, 0.438848, 0.515975, 0.459383, 0.518283, 0.461809, 0.4904, 0.48, 0.519777, 0.481382, 0.491817, 0.500667, 0.520452, 0.500995, 0.492467, 0.48, 0.519777, 0.521348, 0.5203, 0.520625, 0.492324, 0.540241, 0.4914, 0.542006, 0.519323, 0.562604, 0.517523, 0.559817, 0.489693, 0.583106, 0.514906, 0.579325, 0.487207, 0.598743, 0.48395, 0.603476, 0.511486, 0.623678, 0.507278, 0.618053, 0.479934, 0.64368, 0.502305, 0.637241, 0.475173, 0.671494, 0.450447, 0.652804, 0.456397, 0.65485, 0.463858, 0.673706, 0.45776, 0.690151, 0.443801, 0.692497, 0.450964, 0.708795, 0.436434, 0.711253, 0.443468, 0.727437, 0.42828, 0.730016, 0.435249, 0.746067, 0.419206, 0.748848, 0.42627, 0.764648, 0.40901, 0.767865, 0.416551, 0.783149, 0.397453, 0.787386, 0.406466, 0.801726, 0.384442, 0.808263, 0.397383, 0.20335, 0.377053, 0.217073, 0.399498, 0.22154, 0.390589, 0.196502, 0.389768, 0.239698, 0.402645, 0.236279, 0.410108, 0.25798, 0.413322, 0.255008, 0.420319, 0.276353, 0.422857, 0.273589, 0.429764, 0.294771, 0.431459, 0.292131, 0.438435, 0.313217, 0.439264, 0.310688, 0.446372, 0.331697, 0.446339, 0.329301, 0.453603, 0.347997, 0.460133, 0.35023, 0.452715, 0.366796, 0.465959, 0.368832, 0.458397, 0.387514, 0.463382, 0.385704, 0.47107, 0.406281, 0.467661, 0.404722, 0.475457, 0.423841, 0.479108, 0.425129, 0.471224, 0.444049, 0.474064, 0.44305, 0.482018, 0.463026, 0.476178, 0.462333, 0.484179, 0.482056, 0.477539, 0.481675, 0.48557, 0.501058, 0.486226, 0.501134, 0.478199, 0.520243, 0.478066, 0.520462, 0.486085, 0.539344, 0.477191, 0.539857, 0.485184, 0.55841, 0.475557, 0.559215, 0.483509, 0.578514, 0.481067, 0.577424, 0.473175, 0.596374, 0.470056, 0.597737, 0.47787, 0.615254, 0.466211, 0.61687, 0.473926, 0.635907, 0.469251, 0.634061, 0.461654, 0.604035, 0.328443, 0.651746, 0.452734, 0.67036, 0.446922, 0.61534, 0.325733, 0.626159, 0.323116, 0.688958, 0.440418, 0.63642, 0.320759, 0.707549, 0.433175, 0.726106, 0.425085, 0.646051, 0.318825, 0.744533, 0.415939, 0.654961, 0.317428, 0.662967, 0.316535, 0.762575, 0.405364, 0.669549, 0.315774, 0.779664, 0.392672, 0.794619, 0.376463, 0.794619, 0.376463, 0.673055, 0.314051, 0.210642, 0.369287, 0.337263, 0.311959, 0.333812, 0.310142, 0.210642, 0.369287, 0.225143, 0.3859, 0.241869, 0.399046, 0.343809, 0.312896, 0.259607, 0.410085, 0.351781, 0.313993, 0.277774, 0.419687, 0.360656, 0.315606, 0.370253, 0.317764, 0.296108, 0.428223, 0.314502, 0.435902, 0.380487, 0.320354, 0.332927, 0.442833, 0.391293, 0.323213, 0.351387, 0.449068, 0.402607, 0.326176, 0.369895, 0.454624, 0.414364, 0.329093, 0.388465, 0.4595, 0.426503, 0.331843, 0.407104, 0.463688, 0.438964, 0.334327, 0.451691, 0.336473, 0.425812, 0.46718, 0.44458, 0.469964, 0.464636, 0.338227, 0.477751, 0.339547, 0.463393, 0.472037, 0.490996, 0.340413, 0.482217, 0.473383, 0.501133, 0.474049, 0.504078, 0.340807, 0.501133, 0.474049, 0.516951, 0.340707, 0.501133, 0.474049, 0.520125, 0.473932, 0.501133, 0.474049, 0.539076, 0.473073, 0.529822, 0.340135, 0.542641, 0.339105, 0.557987, 0.47147, 0.576851, 0.469136, 0.555355, 0.337642, 0.595659, 0.466082, 0.567912, 0.335781, 0.580253, 0.333576, 0.614408, 0.462321, 0.592316, 0.331098, 0.6331, 0.457868, 0.682966, 0.490201, 0.682966, 0.490201, 0.682966, 0.490201, 0.811278, 0.441318, 0.811278, 0.441318, 0.192017, 0.433529, 0.192017, 0.433529, 0.48, 0.519777, 0.48, 0.519777, 0.48, 0.519777, 0.794619, 0.376463, 0.210642, 0.369287, 0.501133, 0.474049, 0.501133, 0.474049, 1.0565, 0.340138, 1.08929, 0.340138, 1.08929, 0.326668, 1.0565, 0.326668, 1.02309, 0.340138, 1.02309, 0.326668, 0.989112, 0.340138, 0.989112, 0.326668, 0.954611, 0.340138, 0.954611, 0.326668, 0.919616, 0.340138, 0.919616, 0.326668, 0.884156, 0.340138, 0.884156, 0.326668, 0.848263, 0.340138, 0.848263, 0.326668, 0.81197, 0.340138, 0.81197, 0.326668, 0.775312, 0.340138, 0.775312, 0.326668, 0.738325, 0.340138, 0.738325, 0.326668, 0.701046, 0.340138, 0.701046, 0.326668, 0.663511, 0.340138, 0.663511, 0.326668, 0.625759, 0.340138, 0.625759, 0.326668, 0.587826, 0.340138, 0.587826, 0.326668, 0.549749, 0.340138, 0.549749, 0.326668, 0.511565, 0.340138, 0.511565, 0.326668, 0.473309, 0.340138, 0.473309, 0.326668, 0.435017, 0.340138, 0.435017, 0.326668, 0.396721, 0.340138, 0.396721, 0.326668, 0.358453, 0.340138, 0.358453, 0.326668, 0.320246, 0.340138, 0.320246, 0.326668, 0.282131, 0.340138, 0.282131, 0.326668, 0.244133, 0.340138, 0.244133, 0.326668, 0.206282, 0.340138, 0.206282, 0.326668, 0.168601, 0.340138, 0.168601, 0.326668, 0.131114, 0.340138, 0.131114, 0.326668, 0.093843, 0.340138, 0.093843, 0.326668, 0.056807, 0.340138, 0.056807, 0.326668, 0.020024, 0.340138, 0.020024, 0.326668, -0.016491, 0.340138, -0.016491, 0.326668, -0.052723, 0.340138, -0.052723, 0.326668, -0.088661, 0.340138, -0.088661, 0.326668, -0.124291, 0.340138, -0.124291, 0.326668, -0.1596, 0.340138, -0.1596, 0.326668, -0.194577, 0.340138, -0.194577, 0.326668, -0.229217, 0.340138, -0.229217, 0.326668, -0.263541, 0.340138, -0.263541, 0.326668, -0.297616, 0.340138, -0.297616, 0.326668, -0.331584, 0.340138, -0.331584, 0.326668, -0.362397, 0.340138, -0.362397, 0.326668, 1.30176, 0.340138, 1.32692, 0.340138, 1.32692, 0.326668, 1.30176, 0.326668, 1.27317, 0.340138, 1.27317, 0.326668, 1.24409, 0.340138, 1.24409, 0.326668, 1.21441, 0.340138, 1.21441, 0.326668, 1.18407, 0.340138, 1.18407, 0.326668, 1.15309, 0.340138, 1.15309, 0.326668, 1.12148, 0.340138, 1.12148, 0.326668, 1.0565, 0.347988, 1.08929, 0.360997, 1.08929, 0.347988, 1.0565, 0.360997, 1.02309, 0.347988, 1.0565, 0.360997, 1.0565, 0.360997, 1.02309, 0.360997, 0.989112, 0.360997, 0.989112, 0.347988, 0.954611, 0.360997, 0.954611, 0.347988, 0.919616, 0.347988, 0.919616, 0.360997, 0.884156, 0.360997, 0.884156, 0.347988, 0.848263, 0.347988, 0.848263, 0.360997, 0.81197, 0.347988, 0.81197, 0.360997, 0.775312, 0.347988, 0.775312, 0.360997, 0.738325, 0.347988, 0.738325, 0.360997, 0.701046, 0.360997, 0.701046, 0.347988, 0.663511, 0.360997, 0.663511, 0.347988, 0.625759, 0.360997, 0.625759, 0.347988, 0.587826, 0.360997, 0.587826, 0.347988, 0.549749, 0.347988, 0.549749, 0.360997, 0.549749, 0.347988, 0.511565, 0.360997, 0.549749, 0.360997, 0.549749, 0.347988, 0.549749, 0.347988, 0.511565, 0.347988, 0.473309, 0.347988, 0.473309, 0.360997, 0.473309, 0.347988, 0.435017, 0.360997, 0.473309, 0.360997, 0.473309, 0.347988, 0.473309, 0.347988, 0.435017, 0.347988, 0.396721, 0.347988, 0.396721, 0.360997, 0.358453, 0.347988, 0.358453, 0.360997, 0.320246, 0.347988, 0.320246, 0.360997, 0.282131, 0.360997, 0.282131, 0.347988, 0.244133, 0.347988, 0.244133, 0.360997, 0.206282, 0.360997, 0.206282, 0.347988, 0.168601, 0.360997, 0.168601, 0.347988, 0.131114, 0.347988, 0.131114, 0.360997, 0.093843, 0.360997, 0.093843, 0.347988, 0.056807, 0.360997, 0.056807, 0.347988, 0.020024, 0.360997, 0.020024, 0.347988, -0.016491, 0.360997, -0.016491, 0.347988, -0.052723, 0.347988, -0.052723, 0.360997, -0.052723, 0.347988, -0.088661, 0.360997, -0.052723, 0.360997, -0.052723, 0.347988, -0.052723, 0.347988, -0.088661, 0.347988, -0.124291, 0.347988, -0.124291, 0.360997, -0.124291, 0.347988, -0.1596, 0.360997, -0.124291, 0.360997, -0.124291, 0.347988, -0.124291, 0.347988, -0.1596, 0.347988, -0.194577, 0.347988, -0.194577, 0.360997, -0.229217, 0.347988, -0.229217, 0.360997, -0.263541, 0.360997, -0.263541, 0.347988, -0.297616, 0.360997, -0.297616, 0.347988, -0.331584, 0.360997, -0.331584, 0.347988, -0.362397, 0.360997, -0.362397, 0.347988, 1.32692, 0.360997, 1.30176, 0.347988, 1.30176, 0.360997, 1.32692, 0.347988, 1.27317, 0.360997, 1.27317, 0.347988, 1.24409, 0.360997, 1.24409, 0.347988, 1.21441, 0.360997, 1.21441, 0.347988, 1.18407, 0.347988, 1.18407, 0.360997, 1.15309, 0.347988, 1.15309, 0.360997, 1.12148, 0.347988, 1.12148, 0.347988, 1.12148, 0.360997, 1.12148, 0.347988, 1.12148, 0.347988, 1.12148, 0.360997, 1.0565, 0.439252, 1.08929, 0.439252, 1.08929, 0.380547, 1.0565, 0.380547, 1.02309, 0.439252, 1.02309, 0.380547, 0.989112, 0.439252, 0.989112, 0.380547, 0.954611, 0.439252, 0.954611, 0.380547, 0.919616, 0.439252, 0.919616, 0.380547, 0.884156, 0.439252, 0.884156, 0.439252, 0.884156, 0.380547, 0.884156, 0.439252, 0.848263, 0.439252, 0.848263, 0.380547, 0.81197, 0.439252, 0.81197, 0.380547, 0.775312, 0.380547, 0.775312, 0.439252, 0.775312, 0.380547, 0.738325, 0.380547, 0.738325, 0.439252, 0.775312, 0.380547, 0.738325, 0.439252, 0.701046, 0.380547, 0.701046, 0.439252, 0.738325, 0.439252, 0.663511, 0.380547, 0.663511, 0.439252, 0.625759, 0.380547, 0.625759, 0.439252, 0.587826, 0.380547, 0.587826, 0.439252, 0.549749, 0.380547, 0.549749, 0.439252, 0.511565, 0.380547, 0.511565, 0.439252, 0.473309, 0.439252, 0.473309, 0.380547, 0.435017, 0.439252, 0.435017, 0.380547, 0.396721, 0.439252, 0.396721, 0.380547, 0.358453, 0.439252, 0.358453, 0.380547, 0.320246, 0.439252, 0.320246, 0.380547, 0.282131, 0.439252, 0.282131, 0.439252, 0.282131, 0.380547, 0.282131, 0.439252, 0.244133, 0.439252, 0.244133, 0.380547, 0.206282, 0.439252, 0.206282, 0.380547, 0.168601, 0.380547, 0.168601, 0.439252, 0.168601, 0.380547, 0.131114, 0.380547, 0.131114, 0.439252, 0.168601, 0.380547, 0.131114, 0.439252, 0.093843, 0.380547, 0.093843, 0.439252, 0.131114, 0.439252, 0.056807, 0.380547, 0.056807, 0.439252, 0.020024, 0.380547, 0.020024, 0.439252, -0.016491, 0.380547, -0.016491, 0.439252, -0.052723, 0.380547, -0.052723, 0.439252, -0.088661, 0.380547, -0.088661, 0.439252, -0.124291, 0.439252, -0.124291, 0.380547, -0.1596, 0.439252, -0.1596, 0.380547, -0.194577, 0.439252, -0.194577, 0.380547, -0.229217, 0.439252, -0.229217, 0.380547, -0.263541, 0.439252, -0.263541, 0.380547, -0.297616, 0.439252, -0.297616, 0.439252, -0.297616, 0.380547, -0.297616, 0.439252, -0.331584, 0.439252, -0.331584, 0.380547, -0.362397, 0.439252, -0.362397, 0.380547, 1.32692, 0.439252, 1.30176, 0.380547, 1.30176, 0.439252, 1.32692, 0.380547, 1.27317, 0.380547, 1.27317, 0.439252, 1.27317, 0.439252, 1.24409, 0.380547, 1.24409, 0.439252, 1.27317, 0.439252, 1.21441, 0.380547, 1.21441, 0.439252, 1.18407, 0.380547, 1.18407, 0.439252, 1.15309, 0.380547, 1.15309, 0.439252, 1.12148, 0.380547, 1.12148, 0.439252, 1.0565, 0.455248, 1.08929, 0.491518, 1.08929, 0.455248, 1.0565, 0.491518, 1.02309, 0.491518, 1.02309, 0.455248, 0.989112, 0.491518, 0.989112, 0.455248, 0.954611, 0.455248, 0.954611, 0.491518, 0.919616, 0.455248, 0.919616, 0.491518, 0.884156, 0.491518, 0.884156, 0.455248, 0.848263, 0.455248, 0.848263, 0.491518, 0.81197, 0.455248, 0.81197, 0.491518, 0.775312, 0.455248, 0.775312, 0.491518, 0.738325, 0.455248, 0.738325, 0.491518, 0.701046, 0.491518, 0.701046, 0.455248, 0.663511, 0.455248, 0.663511, 0.491518, 0.625759, 0.455248, 0.625759, 0.491518, 0.587826, 0.491518, 0.587826, 0.455248, 0.549749, 0.455248, 0.549749, 0.491518, 0.511565, 0.455248, 0.511565, 0.491518, 0.473309, 0.455248, 0.473309, 0.491518, 0.435017, 0.491518, 0.435017, 0.455248, 0.396721, 0.455248, 0.396721, 0.491518, 0.358453, 0.455248, 0.358453, 0.491518, 0.320246, 0.455248, 0.320246, 0.491518, 0.282131, 0.491518, 0.282131, 0.455248, 0.244133, 0.455248, 0.244133, 0.491518, 0.206282, 0.455248, 0.206282, 0.491518, 0.168601, 0.455248, 0.168601, 0.491518, 0.131114, 0.455248, 0.131114, 0.491518, 0.093843, 0.491518, 0.093843, 0.455248, 0.056807, 0.455248, 0.056807, 0.491518, 0.020024, 0.491518, 0.020024, 0.455248, -0.016491, 0.491518, -0.016491, 0.455248, -0.052723, 0.455248, -0.052723, 0.491518, -0.088661, 0.491518, -0.088661, 0.455248, -0.124291, 0.491518, -0.124291, 0.455248, -0.1596, 0.491518, -0.1596, 0.455248, -0.194577, 0.455248, -0.194577, 0.491518, -0.229217, 0.491518, -0.229217, 0.455248, -0.263541, 0.491518, -0.263541, 0.455248, -0.297616, 0.491518, -0.297616, 0.455248, -0.331584, 0.455248, -0.331584, 0.491518, -0.362397, 0.455248, -0.362397, 0.491518, 1.32692, 0.491518, 1.30176, 0.455248, 1.30176, 0.491518, 1.32692, 0.455248, 1.27317, 0.491518, 1.27317, 0.455248, 1.24409, 0.491518, 1.24409, 0.455248, 1.21441, 0.491518, 1.21441, 0.455248, 1.18407, 0.455248, 1.18407, 0.491518, 1.15309, 0.455248, 1.15309, 0.491518, 1.12148, 0.455248, 1.12148, 0.491518, 1.0565, 0.507304, 1.0565, 0.564466, 1.08929, 0.507304, 1.08929, 0.564466, 1.02309, 0.507304, 1.02309, 0.564466, 0.989112, 0.507304, 0.989112, 0.564466, 0.954611, 0.507304, 0.954611, 0.564466, 0.919616, 0.507304, 0.919616, 0.564466, 0.884156, 0.507304, 0.884156, 0.564466, 0.848263, 0.507304, 0.848263, 0.564466, 0.81197, 0.507304, 0.81197, 0.564466, 0.775312, 0.507304, 0.775312, 0.564466, 0.738325, 0.507304, 0.738325, 0.564466, 0.701046, 0.507304, 0.701046, 0.564466, 0.663511, 0.507304, 0.663511, 0.564466, 0.625759, 0.507304, 0.625759, 0.564466, 0.587826, 0.507304, 0.587826, 0.564466, 0.549749, 0.507304, 0.549749, 0.564466, 0.511565, 0.507304, 0.511565, 0.564466, 0.473309, 0.507304, 0.473309, 0.564466, 0.435017, 0.507304, 0.435017, 0.564466, 0.396721, 0.507304, 0.396721, 0.564466, 0.358453, 0.507304, 0.358453, 0.564466, 0.320246, 0.507304, 0.320246, 0.564466, 0.282131, 0.507304, 0.282131, 0.564466, 0.244133, 0.507304, 0.244133, 0.564466, 0.206282, 0.507304, 0.206282, 0.564466, 0.168601, 0.507304, 0.168601, 0.564466, 0.131114, 0.507304, 0.131114, 0.564466, 0.093843, 0.507304, 0.093843, 0.564466, 0.056807, 0.507304, 0.056807, 0.564466, 0.020024, 0.507304, 0.020024, 0.564466, -0.016491, 0.507304, -0.016491, 0.564466, -0.052723, 0.507304, -0.052723, 0.564466, -0.088661, 0.507304, -0.088661, 0.564466, -0.124291, 0.564466, -0.124291, 0.507304, -0.1596, 0.507304, -0.1596, 0.564466, -0.194577, 0.507304, -0.194577, 0.564466, -0.229217, 0.507304, -0.229217, 0.564466, -0.263541, 0.507304, -0.263541, 0.564466, -0.297616, 0.507304, -0.297616, 0.564466, -0.331584, 0.507304, -0.331584, 0.564466, -0.362397, 0.507304, -0.362397, 0.564466, 1.30176, 0.507304, 1.32692, 0.564466, 1.32692, 0.507304, 1.30176, 0.564466, 1.27317, 0.507304, 1.27317, 0.564466, 1.24409, 0.507304, 1.24409, 0.564466, 1.21441, 0.507304, 1.21441, 0.564466, 1.18407, 0.507304, 1.18407, 0.564466, 1.15309, 0.507304, 1.15309, 0.564466, 1.12148, 0.507304, 1.12148, 0.564466, 1.0565, 0.580322, 1.08929, 0.660649, 1.08929, 0.580322, 1.0565, 0.660649, 1.02309, 0.660649, 1.02309, 0.580322, 0.989112, 0.580322, 0.989112, 0.660649, 0.954611, 0.580322, 0.954611, 0.660649, 0.919616, 0.580322, 0.919616, 0.660649, 0.884156, 0.660649, 0.884156, 0.580322, 0.848263, 0.580322, 0.848263, 0.660649, 0.81197, 0.580322, 0.81197, 0.660649, 0.775312, 0.580322, 0.775312, 0.660649, 0.738325, 0.580322, 0.738325, 0.660649, 0.701046, 0.580322, 0.701046, 0.660649, 0.663511, 0.580322, 0.663511, 0.660649, 0.625759, 0.580322, 0.625759, 0.660649, 0.587826, 0.660649, 0.587826, 0.580322, 0.549749, 0.580322, 0.549749, 0.660649, 0.511565, 0.580322, 0.511565, 0.660649, 0.473309, 0.580322, 0.473309, 0.660649, 0.435017, 0.580322, 0.435017, 0.660649, 0.396721, 0.580322, 0.396721, 0.660649, 0.358453, 0.580322, 0.358453, 0.660649, 0.320246, 0.580322, 0.320246, 0.660649, 0.282131, 0.660649, 0.282131, 0.580322, 0.244133, 0.660649, 0.244133, 0.580322, 0.206282, 0.580322, 0.206282, 0.660649, 0.168601, 0.660649, 0.168601, 0.580322, 0.131114, 0.580322, 0.131114, 0.660649, 0.093843, 0.660649, 0.093843, 0.580322, 0.056807, 0.660649, 0.056807, 0.580322, 0.020024, 0.660649, 0.020024, 0.580322, -0.016491, 0.660649, -0.016491, 0.580322, -0.052723, 0.580322, -0.052723, 0.660649, -0.088661, 0.660649, -0.088661, 0.580322, -0.124291, 0.580322, -0.124291, 0.660649, -0.1596, 0.660649, -0.1596, 0.580322, -0.194577, 0.580322, -0.194577, 0.660649, -0.229217, 0.660649, -0.229217, 0.580322, -0.263541, 0.580322, -0.263541, 0.660649, -0.297616, 0.580322, -0.297616, 0.660649, -0.331584, 0.580322, -0.331584, 0.660649, -0.362397, 0.580322, -0.362397, 0.660649, 1.32692, 0.660649, 1.30176, 0.580322, 1.30176, 0.660649, 1.32692, 0.580322, 1.27317, 0.580322, 1.27317, 0.660649, 1.24409, 0.580322, 1.24409, 0.660649, 1.21441, 0.580322, 1.21441, 0.660649, 1.18407, 0.580322, 1.18407, 0.660649, 1.15309, 0.580322, 1.15309, 0.660649, 1.12148, 0.580322, 1.12148, 0.660649, 1.0565, 0.663314, 1.0565, 0.697325, 1.08929, 0.663314, 1.08929, 0.697325, 1.02309, 0.697325, 1.02309, 0.663314, 0.989112, 0.663314, 0.989112, 0.697325, 0.954611, 0.663314, 0.954611, 0.697325, 0.919616, 0.697325, 0.919616, 0.663314, 0.884156, 0.663314, 0.884156, 0.697325, 0.848263, 0.697325, 0.848263, 0.663314, 0.81197, 0.663314, 0.81197, 0.697325, 0.775312, 0.663314, 0.775312, 0.697325, 0.738325, 0.663314, 0.738325, 0.697325, 0.701046, 0.663314, 0.701046, 0.697325, 0.663511, 0.663314, 0.663511, 0.697325, 0.625759, 0.697325, 0.625759, 0.663314, 0.587826, 0.663314, 0.587826, 0.697325, 0.549749, 0.697325, 0.549749, 0.663314, 0.511565, 0.663314, 0.511565, 0.697325, 0.473309, 0.663314, 0.473309, 0.697325, 0.435017, 0.697325, 0.435017, 0.663314, 0.396721, 0.663314, 0.396721, 0.697325, 0.358453, 0.663314, 0.358453, 0.697325, 0.320246, 0.663314, 0.320246, 0.697325, 0.282131, 0.663314, 0.282131, 0.697325, 0.244133, 0.663314, 0.244133, 0.697325, 0.206282, 0.663314, 0.206282, 0.697325, 0.168601, 0.663314, 0.168601, 0.697325, 0.131114, 0.663314, 0.131114, 0.697325, 0.093843, 0.663314, 0.093843, 0.697325, 0.056807, 0.663314, 0.056807, 0.697325, 0.020024, 0.663314, 0.020024, 0.697325, -0.016491, 0.697325, -0.016491, 0.663314, -0.052723, 0.663314, -0.052723, 0.697325, -0.088661, 0.663314, -0.088661, 0.697325, -0.124291, 0.663314, -0.124291, 0.697325, -0.1596, 0.663314, -0.1596, 0.697325, -0.194577, 0.663314, -0.194577, 0.697325, -0.229217, 0.697325, -0.229217, 0.663314, -0.263541, 0.663314, -0.263541, 0.697325, -0.297616, 0.663314, -0.297616, 0.697325, -0.331584, 0.663314, -0.331584, 0.697325, -0.362397, 0.663314, -0.362397, 0.697325, 1.30176, 0.663314, 1.30176, 0.697325, 1.32692, 0.663314, 1.32692, 0.697325, 1.27317, 0.663314, 1.27317, 0.697325, 1.24409, 0.697325, 1.24409, 0.663314, 1.21441, 0.663314, 1.21441, 0.697325, 1.18407, 0.663314, 1.18407, 0.697325, 1.15309, 0.697325, 1.15309, 0.663314, 1.12148, 0.663314, 1.12148, 0.697325, -0.331584, 0.321168, -0.331584, 0.151029, -0.362397, 0.151029, -0.362397, 0.321168, -0.297616, 0.151029, -0.297616, 0.321168, -0.264085, 0.321168, -0.263541, 0.151029, -0.229761, 0.321168, -0.229217, 0.151029, -0.194577, 0.321168, -0.194577, 0.151029, -0.1596, 0.151029, -0.1596, 0.321168, -0.124291, 0.321168, -0.124291, 0.151029, -0.088661, 0.151029, -0.088661, 0.321168, -0.052723, 0.321168, -0.052723, 0.151029, -0.016491, 0.151029, -0.016491, 0.321168, 0.020024, 0.321168, 0.020024, 0.151029, 0.056807, 0.321168, 0.056807, 0.151029, 0.093843, 0.321168, 0.093843, 0.151029, 0.131114, 0.151029, 0.131114, 0.321168, 0.168601, 0.151029, 0.168601, 0.321168, 0.206282, 0.321168, 0.206282, 0.151029, 0.244133, 0.151029, 0.244133, 0.321168, 0.282131, 0.151029, 0.282131, 0.321168, 0.320246, 0.321168, 0.320246, 0.151029, 0.358453, 0.151029, 0.358453, 0.321168, 0.396721, 0.151029, 0.396721, 0.321168, 0.435017, 0.151029, 0.435017, 0.321168, 0.473309, 0.321168, 0.473309, 0.151029, 0.511565, 0.151029, 0.511565, 0.321168, 0.549749, 0.151029, 0.549749, 0.321168, 0.587826, 0.151029, 0.587826, 0.321168, 0.625759, 0.321168, 0.625759, 0.151029, 0.663511, 0.151029, 0.663511, 0.321168, 0.701046, 0.151029, 0.701046, 0.321168, 0.738325, 0.151029, 0.738325, 0.321168, 0.775312, 0.151029, 0.775312, 0.321168, 0.81197, 0.151029, 0.81197, 0.321168, 0.848263, 0.151029, 0.848263, 0.321168, 0.884156, 0.151029, 0.884156, 0.321168, 0.919616, 0.321168, 0.919616, 0.151029, 0.954611, 0.151029, 0.954611, 0.321168, 0.989112, 0.151029, 0.989112, 0.321168, 1.02309, 0.321168, 1.02309, 0.151029, 1.0565, 0.321168, 1.0565, 0.151029, 1.08929, 0.151029, 1.08929, 0.321168, 1.12148, 0.321168, 1.12148, 0.151029, 1.15309, 0.151029, 1.15309, 0.321168, 1.18407, 0.321168, 1.18407, 0.151029, 1.21441, 0.151029, 1.21441, 0.321168, 1.24409, 0.151029, 1.24409, 0.321168, 1.27317, 0.321168, 1.27317, 0.151029, 1.30176, 0.321168, 1.30176, 0.151029, 1.32692, 0.151029, 1.32692, 0.321168, 0.179033, 0.866556, 0.237794, 0.924403, 0.234172, 0.866628, 0.173466, 0.926215, 0.811077, 0.857349, 0.776214, 0.857299, 0.766217, 0.866644, 0.821356, 0.86676, 0.884156, 0.439252, 0.884156, 0.439252, 0.738325, 0.439252, 0.738325, 0.439252, 0.738325, 0.439252, 0.282131, 0.439252, 0.282131, 0.439252, 0.282131, 0.439252, 0.131114, 0.439252, 0.131114, 0.439252, 0.131114, 0.439252, -0.297616, 0.439252, -0.297616, 0.439252, 1.27317, 0.439252, 1.27317, 0.439252, 1.0565, 0.360997, 1.0565, 0.360997, 1.0565, 0.360997, 0.775312, 0.380547, 0.775312, 0.380547, 0.775312, 0.380547, 0.549749, 0.360997, 0.549749, 0.360997, 0.549749, 0.360997, 0.473309, 0.360997, 0.473309, 0.360997, 0.473309, 0.360997, 0.168601, 0.380547, 0.168601, 0.380547, 0.168601, 0.380547, -0.052723, 0.360997, -0.052723, 0.360997, -0.052723, 0.360997, -0.124291, 0.360997, -0.124291, 0.360997, -0.124291, 0.360997, 1.12148, 0.360997, 1.12148, 0.360997, 1.12148, 0.360997, 0.549749, 0.347988, 0.549749, 0.347988, 0.549749, 0.347988, 0.473309, 0.347988, 0.473309, 0.347988, 0.473309, 0.347988, -0.052723, 0.347988, -0.052723, 0.347988, -0.052723, 0.347988, -0.124291, 0.347988, -0.124291, 0.347988, -0.124291, 0.347988, 1.12148, 0.347988, 1.12148, 0.347988, 1.12148, 0.347988, 1.0565, 0.700924, 1.08929, 0.700924, 1.02309, 0.700924, 0.989112, 0.700924, 0.954611, 0.700924, 0.919616, 0.700924, 0.884156, 0.700924, 0.848263, 0.700924, 0.81197, 0.700924, 0.775312, 0.700924, 0.738325, 0.700924, 0.701046, 0.700924, 0.663511, 0.700924, 0.625759, 0.700924, 0.587826, 0.700924, 0.549749, 0.700924, 0.511565, 0.700924, 0.473309, 0.700924, 0.435017, 0.700924, 0.396721, 0.700924, 0.358453, 0.700924, 0.320246, 0.700924, 0.282131, 0.700924, 0.244133, 0.700924, 0.206282, 0.700924, 0.168601, 0.700924, 0.131114, 0.700924, 0.093843, 0.700924, 0.056807, 0.700924, 0.020024, 0.700924, -0.016491, 0.700924, -0.052723, 0.700924, -0.088661, 0.700924, -0.124291, 0.700924, -0.1596, 0.700924, -0.194577, 0.700924, -0.229217, 0.700924, -0.263541, 0.700924, -0.297616, 0.700924, -0.331584, 0.700924, -0.362397, 0.700924, 1.30176, 0.700924, 1.32692, 0.700924, 1.27317, 0.700924, 1.24409, 0.700924, 1.21441, 0.700924, 1.18407, 0.700924, 1.15309, 0.700924, 1.12148, 0.700924, -0.381031, 0.340138, -0.381031, 0.340138, -0.381031, 0.324306, -0.381031, 0.347988, -0.381031, 0.360997, -0.381031, 0.439252, -0.381031, 0.380547, -0.381031, 0.491518, -0.381031, 0.455248, -0.381031, 0.507304, -0.381031, 0.564466, -0.381031, 0.580322, -0.381031, 0.663314, -0.381031, 0.663314, -0.381031, 0.697325, -0.381031, 0.151029, -0.362397, 0.321168, -0.381031, 0.151029, -0.381031, 0.324306, -0.362397, 0.455248, -0.381031, 0.507304, -0.381031, 0.564466, -0.362397, 0.660649, -0.381031, 0.697325, -0.362397, 0.700924, 0.189344, 0.85718, 0.224207, 0.857249, 0.14757, 0.968987, 0.321227, 0.969332, 0.251614, 0.93741, 0.161417, 0.943771, 0.146906, 0.954446, 0.150022, 0.94943, 1.34785, 0.340138, 1.34785, 0.340138, 1.34785, 0.324306, 1.34785, 0.347988, 1.34785, 0.360997, 1.34785, 0.439252, 1.34785, 0.380547, 1.34785, 0.491518, 1.34785, 0.455248, 1.34785, 0.507304, 1.34785, 0.564466, 1.34785, 0.663314, 1.34785, 0.580322, 1.34785, 0.697325, 1.34785, 0.663314, 1.34785, 0.324306, 1.34785, 0.151029, 1.32692, 0.321168, 1.34785, 0.151029, 1.32692, 0.455248, 1.34785, 0.507304, 1.32692, 0.660649, 1.32692, 0.700924, 1.34785, 0.697325, 0.320669, 0.937405, 0.762398, 0.924406, 0.826719, 0.926438, 0.748533, 0.937365, 0.838708, 0.944036, 0.852469, 0.969299, 0.853183, 0.95476, 0.850084, 0.949734, 0.678811, 0.969048, 0.679479, 0.937123, 0.971518, 1.04981, 1.00289, 1.04981, 0.971016, 1.01994, 1.00263, 1.01994, 0.940176, 1.04981, 0.939581, 1.01994, 0.908929, 1.04981, 0.908377, 1.01994, 0.877235, 1.01994, 0.877756, 1.04981, 0.846641, 1.04981, 0.846165, 1.01994, 0.811461, 1.01994, 0.811461, 1.04981, 0.779997, 1.01994, 0.779997, 1.04981, 0.748539, 1.01994, 0.748539, 1.04981, 0.717089, 1.01994, 0.717089, 1.04981, 0.685647, 1.01994, 0.685647, 1.04981, 0.654214, 1.01994, 0.654214, 1.04981, 0.62279, 1.04981, 0.62279, 1.01994, 0.591377, 1.04981, 0.591377, 1.01994, 0.559975, 1.04981, 0.559975, 1.01994, 0.528586, 1.04981, 0.528586, 1.01994, 0.49721, 1.01994, 0.49721, 1.04981, 0.465849, 1.04981, 0.465849, 1.01994, 0.434504, 1.01994, 0.434504, 1.04981, 0.403176, 1.04981, 0.403176, 1.01994, 0.371866, 1.04981, 0.371866, 1.01994, 0.340576, 1.04981, 0.340576, 1.01994, 0.309306, 1.04981, 0.309306, 1.01994, 0.278061, 1.01994, 0.278061, 1.04981, 0.246845, 1.01994, 0.246845, 1.04981, 0.215663, 1.01994, 0.215663, 1.04981, 0.184525, 1.01994, 0.184525, 1.04981, 0.153444, 1.01994, 0.153444, 1.04981, 0.122445, 1.04981, 0.122445, 1.01994, 0.091564, 1.04981, 0.091564, 1.01994, 0.06086, 1.04981, 0.06086, 1.01994, 0.030417, 1.04981, 0.030417, 1.01994, 0, 1.04981, 0, 1.01994, 1.00212, 0.990052, 0.970427, 0.990052, 0.938881, 0.990052, 0.907532, 0.990052, 0.876332, 0.990052, 0.845333, 0.990052, 0.811461, 0.990052, 0.779997, 0.990052, 0.748539, 0.990052, 0.717089, 0.990052, 0.685647, 0.990052, 0.654214, 0.990052, 0.62279, 0.990052, 0.591377, 0.990052, 0.559975, 0.990052, 0.528586, 0.990052, 0.49721, 0.990052, 0.465849, 0.990052, 0.434504, 0.990052, 0.403176, 0.990052, 0.371866, 0.990052, 0.340576, 0.990052, 0.309306, 0.990052, 0.278061, 0.990052, 0.246845, 0.990052, 0.215663, 0.990052, 0.184525, 0.990052, 0.153444, 0.990052, 0.122445, 0.990052, 0.091564, 0.990052, 0.06086, 0.990052, 0.030417, 0.990052, 0, 0.990052, 0.933596, 0.956226, 0.907211, 0.959936, 0.87578, 0.959936, 0.844698, 0.959936, 0.811461, 0.959936, 0.779997, 0.959936, 0.748539, 0.959936, 0.717089, 0.959936, 0.685647, 0.959936, 0.654214, 0.959936, 0.62279, 0.959936, 0.591377, 0.959936, 0.559975, 0.959936, 0.528586, 0.959936, 0.49721, 0.959936, 0.465849, 0.959936, 0.434504, 0.959936, 0.403176, 0.959936, 0.371866, 0.959936, 0.340576, 0.959936, 0.309306, 0.959936, 0.278061, 0.959936, 0.246845, 0.959936, 0.215663, 0.959936, 0.184525, 0.959936, 0.153444, 0.959936, 0.122445, 0.959936, 0.091564, 0.959936, 0.06086, 0.959936, 0.030417, 0.959936, 0, 0.959936, 0.844396, 0.929881, 0.880526, 0.919357, 0.811461, 0.929881, 0.779997, 0.929881, 0.748539, 0.929881, 0.717089, 0.929881, 0.685647, 0.929881, 0.654214, 0.929881, 0.62279, 0.929881, 0.591377, 0.929881, 0.559975, 0.929881, 0.528586, 0.929881, 0.49721, 0.929881, 0.465849, 0.929881, 0.434504, 0.929881, 0.403176, 0.929881, 0.371866, 0.929881, 0.340576, 0.929881, 0.309306, 0.929881, 0.278061, 0.929881, 0.246845, 0.929881, 0.215663, 0.929881, 0.184525, 0.929881, 0.153444, 0.929881, 0.122445, 0.929881, 0.091564, 0.929881, 0.091564, 0.929881, 0.091564, 0.929881, 0.06086, 0.929881, 0.030417, 0.929881, 0, 0.929881, 0.811461, 0.89982, 0.844543, 0.89982, 0.779997, 0.89982, 0.779997, 0.89982, 0.748539, 0.89982, 0.779997, 0.89982, 0.717089, 0.89982, 0.685647, 0.89982, 0.654214, 0.89982, 0.62279, 0.89982, 0.591377, 0.89982, 0.559975, 0.89982, 0.528586, 0.89982, 0.49721, 0.89982, 0.465849, 0.89982, 0.434504, 0.89982, 0.434504, 0.89982, 0.403176, 0.89982, 0.434504, 0.89982, 0.371866, 0.89982, 0.340576, 0.89982, 0.309306, 0.89982, 0.278061, 0.89982, 0.246845, 0.89982, 0.215663, 0.89982, 0.184525, 0.89982, 0.153444, 0.89982, 0.122445, 0.89982, 0.091564, 0.929881, 0.091564, 0.929881, 0.091564, 0.89982, 0.091564, 0.929881, 0.06086, 0.89982, 0.030417, 0.89982, 0, 0.89982, 0.811461, 0.869728, 0.847594, 0.86749, 0.779997, 0.869728, 0.779997, 0.89982, 0.748539, 0.869728, 0.779997, 0.89982, 0.779997, 0.89982, 0.717089, 0.869728, 0.685647, 0.869728, 0.654214, 0.869728, 0.62279, 0.869728, 0.591377, 0.869728, 0.559975, 0.869728, 0.528586, 0.869728, 0.49721, 0.869728, 0.465849, 0.869728, 0.434504, 0.89982, 0.434504, 0.869728, 0.434504, 0.89982, 0.434504, 0.869728, 0.403176, 0.869728, 0.434504, 0.869728, 0.434504, 0.89982, 0.371866, 0.869728, 0.340576, 0.869728, 0.309306, 0.869728, 0.278061, 0.869728, 0.246845, 0.869728, 0.215663, 0.869728, 0.184525, 0.869728, 0.153444, 0.869728, 0.122445, 0.869728, 0.091564, 0.869728, 0.06086, 0.869728, 0.030417, 0.869728, 0, 0.869728, 0.779997, 0.839562, 0.811461, 0.839562, 0.748539, 0.839562, 0.717089, 0.839562, 0.685647, 0.839562, 0.654214, 0.839562, 0.62279, 0.839562, 0.591377, 0.839562, 0.559975, 0.839562, 0.528586, 0.839562, 0.49721, 0.839562, 0.465849, 0.839562, 0.434504, 0.869728, 0.434504, 0.839562, 0.403176, 0.839562, 0.371866, 0.839562, 0.340576, 0.839562, 0.309306, 0.839562, 0.278061, 0.839562, 0.246845, 0.839562, 0.215663, 0.839562, 0.184525, 0.839562, 0.153444, 0.839562, 0.122445, 0.839562, 0.091564, 0.839562, 0.06086, 0.839562, 0.030417, 0.839562, 0, 0.839562, 0.779997, 0.809362, 0.811461, 0.809362, 0.748539, 0.809362, 0.717089, 0.809362, 0.685647, 0.809362, 0.654214, 0.809362, 0.62279, 0.809362, 0.591377, 0.809362, 0.559975, 0.809362, 0.528586, 0.809362, 0.49721, 0.809362, 0.465849, 0.809362, 0.434504, 0.809362, 0.403176, 0.809362, 0.371866, 0.809362, 0.340576, 0.809362, 0.309306, 0.809362, 0.278061, 0.809362, 0.246845, 0.809362, 0.215663, 0.809362, 0.184525, 0.809362, 0.153444, 0.809362, 0.122445, 0.809362, 0.091564, 0.809362, 0.06086, 0.809362, 0.030417, 0.809362, 0, 0.809362, 0.835232, 0.808145, 0.83888, 0.838477, 0.860915, 0.894677, 0.904228, 0.9401, 0.96622, 0.966534, 1.00166, 0.970349, 0.846194, 0.83676, 0.878643, 0.807919, 0.843174, 0.80809, 0.881049, 0.8308, 0.854897, 0.864382, 0.887913, 0.853, 0.868511, 0.890079, 0.899049, 0.873711, 0.887225, 0.913077, 0.91406, 0.892069, 0.910358, 0.932553, 0.93245, 0.907539, 0.937814, 0.947691, 0.953582, 0.919428, 0.968589, 0.957459, 0.976813, 0.927127, 1.00136, 0.961021, 1.0012, 0.929937, 0.887905, 0.830146, 0.883179, 0.808142, 0.885245, 0.830192, 0.885717, 0.808695, 0.894462, 0.850835, 0.891796, 0.851538, 0.905356, 0.869977, 0.902908, 0.871273, 0.919956, 0.886945, 0.917812, 0.888666, 0.935757, 0.903231, 0.937573, 0.901253, 0.956127, 0.914467, 0.957647, 0.912374, 0.9783, 0.921874, 0.979579, 0.919639, 1.00154, 0.924909, 1.00253, 0.92219, 0.945316, 0.054078, 0.903863, 0.041834, 0.933327, 0.066049, 0.921142, 0.024581, 0.959411, 0.044675, 0.941454, 0.011029, 0.975068, 0.0382, 0.941454, 0.011029, 0.941454, 0.011029, 0.96402, 0.00169802, 0.991687, 0.034904, 0.987971, -0.00305295, 1.00863, 0.034911, 1.01239, -0.00304103, 1.02524, 0.038224, 1.03633, 0.00173497, 1.04088, 0.044715, 1.05888, 0.011092, 1.05496, 0.054134, 1.07917, 0.02467, 0.868226, 0.012549, 0.891902, -0.011093, 0.941454, 0.011029, 0.941454, 0.011029, 0.919736, -0.029664, 0.941454, 0.011029, 0.950658, -0.042449, 0.98348, -0.0489579, 1.01694, -0.048942, 1.04975, -0.042397, 1.08065, -0.029574, 1.10846, -0.010967, 0.830907, -0.018118, 0.861283, -0.0484509, 0.896993, -0.072275, 0.936666, -0.088677, 0.978779, -0.097025, 1.02171, -0.097014, 1.0638, -0.088612, 1.10345, -0.0721591, 1.13912, -0.048286, 0.83537, -0.0800641, 0.799325, -0.0440691, 0.877746, -0.108335, 0.924822, -0.127797, 0.974792, -0.1377, 1.02573, -0.137695, 1.07569, -0.127723, 1.12274, -0.108197, 1.16507, -0.079867, 0.808456, -0.1129, 0.766522, -0.0710239, 0.857754, -0.14579, 0.91252, -0.168431, 0.970652, -0.179953, 1.02991, -0.179946, 1.08803, -0.168345, 1.14277, -0.145628, 1.19202, -0.112669, 0.778685, -0.149223, 0.730236, -0.100841, 0.83564, -0.187222, 0.898912, -0.21338, 0.966071, -0.226694, 1.03454, -0.226682, 1.10169, -0.213279, 1.16493, -0.187033, 1.22184, -0.148953, 0.749361, -0.185002, 0.694496, -0.130213, 0.813859, -0.228034, 0.885509, -0.257657, 0.961554, -0.272734, 1.03909, -0.272717, 1.11514, -0.25754, 1.18677, -0.227817, 1.25121, -0.184693, 0.894, 0.829468, 0.891841, 0.809096, 0.90031, 0.84911, 0.910585, 0.867383, 0.924326, 0.883774, 0.941016, 0.897781, 0.941016, 0.897781, 0.960218, 0.908727, 0.981324, 0.915687, 1.0033, 0.91778, 1.03444, 1.04981, 1.03439, 1.01994, 1.06598, 1.01994, 1.06608, 1.04981, 1.09743, 1.01994, 1.0976, 1.04981, 1.12886, 1.01994, 1.12908, 1.04981, 1.16028, 1.01994, 1.16052, 1.04981, 1.18858, 1.04981, 1.18858, 1.01994, 1.22004, 1.04981, 1.22004, 1.01994, 1.2515, 1.04981, 1.2515, 1.01994, 1.28296, 1.04981, 1.28296, 1.01994, 1.3144, 1.04981, 1.3144, 1.01994, 1.34584, 1.01994, 1.34584, 1.04981, 1.37727, 1.04981, 1.37727, 1.01994, 1.40868, 1.04981, 1.40868, 1.01994, 1.44009, 1.01994, 1.44009, 1.04981, 1.47148, 1.04981, 1.47148, 1.01994, 1.50286, 1.01994, 1.50286, 1.04981, 1.53423, 1.01994, 1.53423, 1.04981, 1.56558, 1.04981, 1.56558, 1.01994, 1.59695, 1.04981, 1.59695, 1.01994, 1.62827, 1.04981, 1.62827, 1.01994, 1.65954, 1.04981, 1.65954, 1.01994, 1.69082, 1.04981, 1.69082, 1.01994, 1.72207, 1.04981, 1.72207, 1.01994, 1.7533, 1.04981, 1.7533, 1.01994, 1.78449, 1.04981, 1.78449, 1.01994, 1.81564, 1.04981, 1.81564, 1.01994, 1.84674, 1.04981, 1.84674, 1.01994, 1.84674, 1.04981, 1.84674, 1.04981, 1.87775, 1.01994, 1.84674, 1.04981, 1.87775, 1.04981, 1.90865, 1.04981, 1.90865, 1.01994, 1.93937, 1.01994, 1.93937, 1.04981, 1.96982, 1.01994, 1.96982, 1.04981, 2, 1.01994, 2, 1.04981, 1.03376, 0.990052, 1.06519, 0.990052, 1.09668, 0.990052, 1.12811, 0.990052, 1.15955, 0.990052, 1.18858, 0.990052, 1.22004, 0.990052, 1.2515, 0.990052, 1.28296, 0.990052, 1.3144, 0.990052, 1.34584, 0.990052, 1.37727, 0.990052, 1.40868, 0.990052, 1.44009, 0.990052, 1.47148, 0.990052, 1.50286, 0.990052, 1.53423, 0.990052, 1.56558, 0.990052, 1.59695, 0.990052, 1.62827, 0.990052, 1.65954, 0.990052, 1.69082, 0.990052, 1.72207, 0.990052, 1.72207, 0.990052, 1.72207, 0.990052, 1.7533, 0.990052, 1.78449, 0.990052, 1.81564, 0.990052, 1.84674, 0.990052, 1.87775, 0.990052, 1.90865, 0.990052, 1.93937, 0.990052, 1.96982, 0.990052, 2, 0.990052, 1.06923, 0.955933, 1.09565, 0.959936, 1.12707, 0.959936, 1.15869, 0.959936, 1.18858, 0.959936, 1.22004, 0.959936, 1.22004, 0.959936, 1.2515, 0.959936, 1.22004, 0.959936, 1.28296, 0.959936, 1.3144, 0.959936, 1.34584, 0.959936, 1.37727, 0.959936, 1.40868, 0.959936, 1.44009, 0.959936, 1.47148, 0.959936, 1.50286, 0.959936, 1.53423, 0.959936, 1.56558, 0.959936, 1.59695, 0.959936, 1.62827, 0.959936, 1.65954, 0.959936, 1.69082, 0.959936, 1.72207, 0.990052, 1.72207, 0.990052, 1.72207, 0.959936, 1.72207, 0.990052, 1.7533, 0.959936, 1.78449, 0.959936, 1.81564, 0.959936, 1.84674, 0.959936, 1.87775, 0.959936, 1.90865, 0.959936, 1.93937, 0.959936, 1.96982, 0.959936, 2, 0.959936, 1.1215, 0.918468, 1.15772, 0.929881, 1.18858, 0.929881, 1.22004, 0.959936, 1.22004, 0.929881, 1.22004, 0.959936, 1.2515, 0.929881, 1.22004, 0.959936, 1.28296, 0.929881, 1.3144, 0.929881, 1.34584, 0.929881, 1.37727, 0.929881, 1.40868, 0.929881, 1.44009, 0.929881, 1.40868, 0.929881, 1.47148, 0.929881, 1.50286, 0.929881, 1.53423, 0.929881, 1.56558, 0.929881, 1.59695, 0.929881, 1.62827, 0.929881, 1.65954, 0.929881, 1.69082, 0.929881, 1.72207, 0.929881, 1.7533, 0.929881, 1.78449, 0.929881, 1.81564, 0.929881, 1.84674, 0.929881, 1.87775, 0.929881, 1.90865, 0.929881, 1.93937, 0.929881, 1.96982, 0.929881, 2, 0.929881, 1.15665, 0.89982, 1.18858, 0.89982, 1.22004, 0.89982, 1.2515, 0.89982, 1.28296, 0.89982, 1.3144, 0.89982, 1.34584, 0.89982, 1.37727, 0.89982, 1.40868, 0.929881, 1.40868, 0.89982, 1.40868, 0.929881, 1.44009, 0.89982, 1.40868, 0.929881, 1.40868, 0.929881, 1.47148, 0.89982, 1.50286, 0.89982, 1.53423, 0.89982, 1.56558, 0.89982, 1.59695, 0.89982, 1.62827, 0.89982, 1.65954, 0.89982, 1.69082, 0.89982, 1.72207, 0.89982, 1.7533, 0.89982, 1.78449, 0.89982, 1.81564, 0.89982, 1.84674, 0.89982, 1.87775, 0.89982, 1.90865, 0.89982, 1.93937, 0.89982, 1.93937, 0.89982, 1.96982, 0.89982, 1.93937, 0.89982, 2, 0.89982, 1.15364, 0.866256, 1.18858, 0.869728, 1.22004, 0.869728, 1.2515, 0.869728, 1.28296, 0.869728, 1.3144, 0.869728, 1.34584, 0.869728, 1.37727, 0.869728, 1.40868, 0.869728, 1.44009, 0.869728, 1.47148, 0.869728, 1.50286, 0.869728, 1.53423, 0.869728, 1.56558, 0.869728, 1.59695, 0.869728, 1.62827, 0.869728, 1.65954, 0.869728, 1.69082, 0.869728, 1.72207, 0.869728, 1.72207, 0.869728, 1.72207, 0.869728, 1.7533, 0.869728, 1.78449, 0.869728, 1.81564, 0.869728, 1.84674, 0.869728, 1.87775, 0.869728, 1.90865, 0.869728, 1.93937, 0.869728, 1.93937, 0.89982, 1.96982, 0.869728, 1.93937, 0.89982, 1.93937, 0.89982, 2, 0.869728, 1.18858, 0.839562, 1.22004, 0.839562, 1.2515, 0.839562, 1.28296, 0.839562, 1.3144, 0.839562, 1.34584, 0.839562, 1.37727, 0.839562, 1.40868, 0.839562, 1.44009, 0.839562, 1.47148, 0.839562, 1.50286, 0.839562, 1.53423, 0.839562, 1.56558, 0.839562, 1.59695, 0.839562, 1.62827, 0.839562, 1.65954, 0.839562, 1.69082, 0.839562, 1.72207, 0.869728, 1.72207, 0.869728, 1.72207, 0.839562, 1.72207, 0.869728, 1.7533, 0.839562, 1.78449, 0.839562, 1.81564, 0.839562, 1.84674, 0.839562, 1.87775, 0.839562, 1.90865, 0.839562, 1.93937, 0.839562, 1.96982, 0.839562, 2, 0.839562, 1.18858, 0.809362, 1.22004, 0.809362, 1.2515, 0.809362, 1.28296, 0.809362, 1.3144, 0.809362, 1.34584, 0.809362, 1.37727, 0.809362, 1.40868, 0.809362, 1.44009, 0.809362, 1.47148, 0.809362, 1.50286, 0.809362, 1.53423, 0.809362, 1.56558, 0.809362, 1.59695, 0.809362, 1.62827, 0.809362, 1.65954, 0.809362, 1.69082, 0.809362, 1.72207, 0.809362, 1.7533, 0.809362, 1.78449, 0.809362, 1.81564, 0.809362, 1.84674, 0.809362, 1.87775, 0.809362, 1.90865, 0.809362, 1.93937, 0.809362, 1.96982, 0.809362, 2, 0.809362, 1.1649, 0.806825, 1.16183, 0.837127, 1.14048, 0.893551, 1.14048, 0.893551, 1.09817, 0.939508, 1.03691, 0.966518, 1.03691, 0.966518, 1.03691, 0.966518, 1.03691, 0.966518, 1.11886, 0.829867, 1.1569, 0.80689, 1.12135, 0.807004, 1.15389, 0.835497, 1.11211, 0.852047, 1.14566, 0.86312, 1.10151, 0.872827, 1.13261, 0.88898, 1.11458, 0.91234, 1.08721, 0.891505, 1.09191, 0.932277, 1.06949, 0.907341, 1.06474, 0.947739, 1.0487, 0.919532, 1.0341, 0.95768, 1.02559, 0.927326, 1.1143, 0.806066, 1.11393, 0.82861, 1.11679, 0.806694, 1.11159, 0.827472, 1.10744, 0.849821, 1.10511, 0.848135, 1.0973, 0.869718, 1.0952, 0.867517, 1.08368, 0.88768, 1.08204, 0.88506, 1.06579, 0.900099, 1.06679, 0.903, 1.04668, 0.911851, 1.04697, 0.914895, 1.02528, 0.919484, 1.02485, 0.922577, 1.14048, 0.893551, 1.14048, 0.893551, 1.14048, 0.893551, 1.03691, 0.966518, 1.03691, 0.966518, 1.03691, 0.966518, 1.0963, 0.199976, 1.07626, 0.161681, 1.06684, 0.17576, 1.10988, 0.179684, 1.08276, 0.146035, 1.11925, 0.157133, 1.12403, 0.133189, 1.08607, 0.129423, 1.12405, 0.108773, 1.08609, 0.112483, 1.1193, 0.084822, 1.0828, 0.095866, 1.10997, 0.062257, 1.07633, 0.080211, 1.09642, 0.041946, 1.06693, 0.06612, 1.13194, 0.229261, 1.15055, 0.201455, 1.16338, 0.170553, 1.16993, 0.137743, 1.16995, 0.104284, 1.16345, 0.071463, 1.15067, 0.040542, 1.1321, 0.012708, 1.19314, 0.224252, 1.16926, 0.259927, 1.20959, 0.184606, 1.21799, 0.142511, 1.21802, 0.099584, 1.20968, 0.057474, 1.19328, 0.017801, 1.16945, -0.01791, 1.22917, 0.243545, 1.20084, 0.285879, 1.2487, 0.196498, 1.25867, 0.146547, 1.2587, 0.095607, 1.2488, 0.045634, 1.22934, -0.00144398, 1.20107, -0.043821, 1.26661, 0.263582, 1.23364, 0.312834, 1.28932, 0.208848, 1.30093, 0.15074, 1.30094, 0.091477, 1.28943, 0.033336, 1.26679, -0.0214339, 1.2339, -0.070734, 1.26993, 0.342651, 1.30801, 0.285747, 1.33426, 0.222505, 1.34767, 0.155351, 1.34768, 0.086882, 1.33438, 0.019727, 1.30822, -0.043547, 1.27022, -0.100504, 1.30567, 0.372023, 1.34879, 0.307581, 1.37852, 0.235962, 1.3937, 0.159915, 1.39373, 0.082377, 1.37865, 0.00632602, 1.34904, -0.065327, 1.306, -0.129827, 1.1058, 0.825981, 1.10826, 0.80557, 1.09962, 0.845747, 1.09022, 0.864309, 1.07787, 0.881134, 1.0627, 0.895629, 1.0449, 0.907098, 1.02486, 0.914752, 1.0033, 0.91778, 1.00303, 1.05811, 0.971518, 1.04981, 0.971644, 1.05811, 1.00289, 1.04981, 0.940176, 1.04981, 0.940316, 1.05811, 0.908929, 1.04981, 0.909058, 1.05811, 0.877756, 1.04981, 0.877866, 1.05811, 0.877756, 1.04981, 0.846641, 1.04981, 0.84673, 1.05811, 0.846641, 1.04981, 0.811461, 1.05811, 0.846641, 1.04981, 0.811461, 1.04981, 0.779997, 1.05811, 0.811461, 1.04981, 0.779997, 1.04981, 0.748539, 1.04981, 0.748539, 1.05811, 0.748539, 1.04981, 0.717089, 1.04981, 0.717089, 1.04981, 0.717089, 1.05811, 0.685647, 1.04981, 0.685647, 1.04981, 0.685647, 1.05811, 0.685647, 1.04981, 0.654214, 1.04981, 0.654214, 1.05811, 0.62279, 1.04981, 0.62279, 1.04981, 0.62279, 1.05811, 0.591377, 1.05811, 0.62279, 1.04981, 0.591377, 1.04981, 0.559975, 1.04981, 0.559975, 1.04981, 0.559975, 1.05811, 0.528586, 1.05811, 0.559975, 1.04981, 0.528586, 1.04981, 0.49721, 1.04981, 0.49721, 1.04981, 0.49721, 1.05811, 0.465849, 1.04981, 0.465849, 1.05811, 0.465849, 1.04981, 0.434504, 1.04981, 0.434504, 1.05811, 0.434504, 1.04981, 0.403176, 1.04981, 0.403176, 1.05811, 0.403176, 1.04981, 0.371866, 1.05811, 0.403176, 1.04981, 0.371866, 1.04981, 0.340576, 1.05811, 0.371866, 1.04981, 0.340576, 1.04981, 0.309306, 1.05811, 0.340576, 1.04981, 0.309306, 1.04981, 0.278061, 1.04981, 0.278061, 1.05811, 0.278061, 1.04981, 0.246845, 1.04981, 0.246845, 1.05811, 0.246845, 1.04981, 0.215663, 1.04981, 0.215663, 1.05811, 0.215663, 1.04981, 0.184525, 1.04981, 0.184525, 1.05811, 0.184525, 1.04981, 0.153444, 1.05811, 0.184525, 1.04981, 0.153444, 1.04981, 0.122445, 1.05811, 0.153444, 1.04981, 0.122445, 1.04981, 0.091564, 1.05811, 0.122445, 1.04981, 0.091564, 1.04981, 0.06086, 1.04981, 0.06086, 1.04981, 0.06086, 1.05811, 0.030417, 1.04981, 0.030417, 1.04981, 0.030417, 1.05811, 0, 1.04981, 0, 1.04981, 0, 1.05811, 1.0345, 1.05811, 1.03444, 1.04981, 1.06603, 1.05811, 1.03444, 1.04981, 1.06608, 1.04981, 1.0976, 1.04981, 1.09754, 1.05811, 1.0976, 1.04981, 1.12908, 1.04981, 1.12902, 1.05811, 1.12908, 1.04981, 1.16052, 1.04981, 1.16048, 1.05811, 1.16052, 1.04981, 1.16052, 1.04981, 1.18858, 1.05811, 1.18858, 1.04981, 1.18858, 1.04981, 1.22004, 1.05811, 1.22004, 1.04981, 1.22004, 1.04981, 1.2515, 1.05811, 1.2515, 1.04981, 1.28296, 1.04981, 1.28296, 1.04981, 1.28296, 1.05811, 1.3144, 1.04981, 1.3144, 1.04981, 1.3144, 1.05811, 1.3144, 1.04981, 1.34584, 1.05811, 1.34584, 1.04981, 1.34584, 1.04981, 1.37727, 1.05811, 1.37727, 1.04981, 1.37727, 1.04981, 1.40868, 1.05811, 1.40868, 1.04981, 1.40868, 1.04981, 1.44009, 1.05811, 1.44009, 1.04981, 1.47148, 1.05811, 1.44009, 1.04981, 1.47148, 1.04981, 1.50286, 1.05811, 1.47148, 1.04981, 1.50286, 1.04981, 1.53423, 1.05811, 1.53423, 1.04981, 1.53423, 1.04981, 1.56558, 1.05811, 1.56558, 1.04981, 1.56558, 1.04981, 1.59695, 1.05811, 1.56558, 1.04981, 1.59695, 1.04981, 1.62827, 1.05811, 1.59695, 1.04981, 1.62827, 1.04981, 1.65954, 1.05811, 1.62827, 1.04981, 1.65954, 1.04981, 1.69082, 1.05811, 1.69082, 1.04981, 1.69082, 1.04981, 1.72207, 1.05811, 1.72207, 1.04981, 1.72207, 1.04981, 1.7533, 1.05811, 1.72207, 1.04981, 1.7533, 1.04981, 1.78449, 1.04981, 1.78449, 1.05811, 1.78449, 1.04981, 1.81564, 1.04981, 1.81564, 1.05811, 1.81564, 1.04981, 1.84674, 1.04981, 1.84674, 1.04981, 1.84674, 1.05811, 1.87775, 1.04981, 1.84674, 1.04981, 1.87775, 1.04981, 1.87775, 1.05811, 1.87775, 1.04981, 1.90865, 1.05811, 1.90865, 1.04981, 1.93937, 1.04981, 1.93937, 1.04981, 1.93937, 1.05811, 1.93937, 1.04981, 1.96982, 1.05811, 1.96982, 1.04981, 1.96982, 1.04981, 2, 1.05811, 2, 1.04981, 0.971701, 1.06614, 1.00311, 1.06614, 0.940361, 1.06614, 0.909093, 1.06614, 0.877891, 1.06614, 0.846749, 1.06614, 0.811461, 1.06614, 0.779997, 1.06614, 0.748539, 1.06614, 0.717089, 1.06614, 0.685647, 1.06614, 0.654214, 1.06614, 0.62279, 1.06614, 0.591377, 1.06614, 0.559975, 1.06614, 0.528586, 1.06614, 0.49721, 1.06614, 0.465849, 1.06614, 0.434504, 1.06614, 0.403176, 1.06614, 0.371866, 1.06614, 0.340576, 1.06614, 0.309306, 1.06614, 0.278061, 1.06614, 0.246845, 1.06614, 0.215663, 1.06614, 0.184525, 1.06614, 0.153444, 1.06614, 0.122445, 1.06614, 0.091564, 1.06614, 0.06086, 1.06614, 0.030417, 1.06614, 0, 1.06614, 1.03458, 1.06614, 1.06609, 1.06614, 1.09761, 1.06614, 1.12911, 1.06614, 1.16059, 1.06614, 1.18858, 1.06614, 1.22004, 1.06614, 1.2515, 1.06614, 1.28296, 1.06614, 1.3144, 1.06614, 1.34584, 1.06614, 1.37727, 1.06614, 1.40868, 1.06614, 1.44009, 1.06614, 1.47148, 1.06614, 1.50286, 1.06614, 1.53423, 1.06614, 1.56558, 1.06614, 1.59695, 1.06614, 1.62827, 1.06614, 1.65954, 1.06614, 1.69082, 1.06614, 1.72207, 1.06614, 1.7533, 1.06614, 1.78449, 1.06614, 1.81564, 1.06614, 1.84674, 1.06614, 1.87775, 1.06614, 1.90865, 1.06614, 1.93937, 1.06614, 1.96982, 1.06614, 2, 1.06614, 0.965101, 0.568165, 0.965268, 0.598057, 0.996685, 0.568165, 0.997083, 0.598057, 0.933369, 0.568165, 0.933563, 0.598057, 0.901673, 0.568165, 0.901972, 0.598057, 0.870018, 0.568165, 0.870367, 0.598057, 0.838378, 0.568165, 0.838753, 0.598057, 0.811461, 0.568165, 0.811461, 0.598057, 0.779997, 0.568165, 0.779997, 0.598057, 0.748539, 0.568165, 0.748539, 0.598057, 0.717089, 0.568165, 0.717089, 0.598057, 0.685647, 0.568165, 0.685647, 0.598057, 0.654214, 0.568165, 0.654214, 0.598057, 0.62279, 0.568165, 0.62279, 0.598057, 0.591377, 0.568165, 0.591377, 0.598057, 0.559975, 0.568165, 0.559975, 0.598057, 0.528586, 0.568165, 0.528586, 0.598057, 0.49721, 0.568165, 0.49721, 0.598057, 0.465849, 0.568165, 0.465849, 0.598057, 0.434504, 0.598057, 0.434504, 0.568165, 0.403176, 0.568165, 0.403176, 0.598057, 0.371866, 0.568165, 0.371866, 0.598057, 0.340576, 0.568165, 0.340576, 0.598057, 0.309306, 0.568165, 0.309306, 0.598057, 0.278061, 0.598057, 0.278061, 0.568165, 0.246845, 0.598057, 0.246845, 0.568165, 0.215663, 0.598057, 0.215663, 0.568165, 0.184525, 0.598057, 0.184525, 0.568165, 0.153444, 0.598057, 0.153444, 0.568165, 0.122445, 0.568165, 0.122445, 0.598057, 0.091564, 0.568165, 0.091564, 0.598057, 0.06086, 0.568165, 0.06086, 0.598057, 0.030417, 0.568165, 0.030417, 0.598057, 0, 0.598057, 0, 0.568165, 0.997967, 0.627962, 0.966094, 0.627962, 0.934458, 0.627962, 0.902812, 0.627962, 0.871211, 0.627962, 0.839594, 0.627962, 0.811461, 0.627962, 0.779997, 0.627962, 0.748539, 0.627962, 0.717089, 0.627962, 0.685647, 0.627962, 0.654214, 0.627962, 0.62279, 0.627962, 0.591377, 0.627962, 0.559975, 0.627962, 0.528586, 0.627962, 0.49721, 0.627962, 0.465849, 0.627962, 0.434504, 0.627962, 0.403176, 0.627962, 0.371866, 0.627962, 0.340576, 0.627962, 0.309306, 0.627962, 0.278061, 0.627962, 0.278061, 0.627962, 0.278061, 0.627962, 0.246845, 0.627962, 0.215663, 0.627962, 0.184525, 0.627962, 0.153444, 0.627962, 0.122445, 0.627962, 0.091564, 0.627962, 0.06086, 0.627962, 0.030417, 0.627962, 0, 0.627962, 0.930633, 0.659325, 0.903996, 0.65835, 0.872388, 0.65835, 0.840593, 0.65835, 0.811461, 0.65835, 0.779997, 0.65835, 0.748539, 0.65835, 0.717089, 0.65835, 0.685647, 0.65835, 0.654214, 0.65835, 0.62279, 0.65835, 0.591377, 0.65835, 0.559975, 0.65835, 0.528586, 0.65835, 0.49721, 0.65835, 0.465849, 0.65835, 0.434504, 0.65835, 0.403176, 0.65835, 0.371866, 0.65835, 0.340576, 0.65835, 0.309306, 0.65835, 0.278061, 0.65835, 0.278061, 0.627962, 0.278061, 0.627962, 0.246845, 0.65835, 0.278061, 0.627962, 0.215663, 0.65835, 0.184525, 0.65835, 0.153444, 0.65835, 0.122445, 0.65835, 0.091564, 0.65835, 0.06086, 0.65835, 0.030417, 0.65835, 0, 0.65835, 0.841727, 0.688661, 0.878187, 0.696638, 0.811461, 0.688661, 0.779997, 0.688661, 0.748539, 0.688661, 0.717089, 0.688661, 0.685647, 0.688661, 0.654214, 0.688661, 0.62279, 0.688661, 0.591377, 0.688661, 0.559975, 0.688661, 0.528586, 0.688661, 0.49721, 0.688661, 0.465849, 0.688661, 0.434504, 0.688661, 0.403176, 0.688661, 0.371866, 0.688661, 0.340576, 0.688661, 0.309306, 0.688661, 0.309306, 0.688661, 0.309306, 0.688661, 0.278061, 0.688661, 0.246845, 0.688661, 0.215663, 0.688661, 0.184525, 0.688661, 0.153444, 0.688661, 0.122445, 0.688661, 0.091564, 0.688661, 0.06086, 0.688661, 0.030417, 0.688661, 0, 0.688661, 0.811461, 0.718741, 0.842934, 0.718741, 0.779997, 0.718741, 0.779997, 0.718741, 0.748539, 0.718741, 0.779997, 0.718741, 0.717089, 0.718741, 0.685647, 0.718741, 0.654214, 0.718741, 0.62279, 0.718741, 0.591377, 0.718741, 0.559975, 0.718741, 0.528586, 0.718741, 0.49721, 0.718741, 0.465849, 0.718741, 0.434504, 0.718741, 0.434504, 0.718741, 0.434504, 0.718741, 0.403176, 0.718741, 0.371866, 0.718741, 0.340576, 0.718741, 0.309306, 0.718741, 0.309306, 0.688661, 0.309306, 0.688661, 0.278061, 0.718741, 0.309306, 0.688661, 0.246845, 0.718741, 0.215663, 0.718741, 0.184525, 0.718741, 0.153444, 0.718741, 0.122445, 0.718741, 0.091564, 0.718741, 0.06086, 0.718741, 0.030417, 0.718741, 0, 0.718741, 0.811461, 0.748982, 0.811461, 0.748982, 0.846105, 0.748686, 0.779997, 0.718741, 0.779997, 0.748982, 0.811461, 0.748982, 0.748539, 0.748982, 0.779997, 0.718741, 0.779997, 0.718741, 0.717089, 0.748982, 0.685647, 0.748982, 0.654214, 0.748982, 0.62279, 0.748982, 0.591377, 0.748982, 0.559975, 0.748982, 0.528586, 0.748982, 0.49721, 0.748982, 0.465849, 0.748982, 0.434504, 0.718741, 0.434504, 0.718741, 0.434504, 0.748982, 0.434504, 0.718741, 0.403176, 0.748982, 0.371866, 0.748982, 0.340576, 0.748982, 0.309306, 0.748982, 0.278061, 0.748982, 0.246845, 0.748982, 0.215663, 0.748982, 0.184525, 0.748982, 0.153444, 0.748982, 0.122445, 0.748982, 0.091564, 0.748982, 0.06086, 0.748982, 0.030417, 0.748982, 0, 0.748982, 0.779997, 0.779159, 0.811461, 0.748982, 0.811461, 0.748982, 0.811461, 0.779159, 0.748539, 0.779159, 0.717089, 0.779159, 0.685647, 0.779159, 0.654214, 0.779159, 0.62279, 0.779159, 0.591377, 0.779159, 0.559975, 0.779159, 0.528586, 0.779159, 0.49721, 0.779159, 0.465849, 0.779159, 0.434504, 0.779159, 0.403176, 0.779159, 0.371866, 0.779159, 0.340576, 0.779159, 0.309306, 0.779159, 0.278061, 0.779159, 0.246845, 0.779159, 0.215663, 0.779159, 0.184525, 0.779159, 0.153444, 0.779159, 0.122445, 0.779159, 0.091564, 0.779159, 0.06086, 0.779159, 0.030417, 0.779159, 0, 0.779159, 0.838121, 0.777809, 0.811461, 0.748982, 0.859212, 0.721465, 0.859212, 0.721465, 0.901637, 0.675699, 0.963166, 0.648804, 0.998674, 0.644658, 0.84593, 0.779468, 0.880796, 0.785007, 0.854013, 0.75181, 0.887419, 0.762852, 0.867094, 0.725994, 0.898117, 0.742188, 0.885235, 0.702749, 0.912588, 0.723676, 0.908033, 0.682952, 0.930487, 0.707998, 0.935305, 0.667585, 0.951416, 0.695897, 0.966039, 0.657617, 0.974673, 0.688085, 0.998866, 0.65398, 0.999218, 0.685102, 0.887804, 0.787299, 0.885378, 0.786184, 0.894094, 0.76667, 0.89185, 0.765011, 0.904194, 0.74743, 0.902225, 0.745262, 0.917711, 0.730131, 0.91614, 0.727529, 0.933272, 0.712435, 0.934304, 0.715348, 0.953251, 0.7007, 0.953624, 0.70375, 0.975461, 0.69306, 0.975145, 0.696078, 0.998945, 0.690144, 0.99803, 0.69297, 0.859212, 0.721465, 0.859212, 0.721465, 0.859212, 0.721465, 0.923904, 0.080128, 0.890282, 0.062126, 0.917409, 0.095774, 0.880922, 0.084677, 0.880922, 0.084677, 0.914092, 0.112386, 0.880922, 0.084677, 0.876141, 0.108621, 0.91408, 0.129326, 0.876123, 0.133037, 0.917372, 0.145943, 0.880869, 0.156988, 0.923843, 0.161599, 0.890196, 0.179552, 0.933243, 0.17569, 0.903745, 0.199864, 0.945211, 0.187676, 0.920997, 0.21714, 0.849617, 0.040355, 0.880922, 0.084677, 0.880922, 0.084677, 0.836791, 0.071257, 0.880922, 0.084677, 0.83024, 0.104067, 0.830217, 0.137526, 0.836722, 0.170347, 0.849503, 0.201268, 0.868072, 0.229102, 0.891713, 0.252777, 0.807032, 0.017558, 0.790576, 0.057204, 0.782173, 0.099299, 0.782146, 0.142226, 0.790492, 0.184337, 0.806891, 0.224009, 0.830715, 0.25972, 0.861048, 0.290096, 0.770994, -0.00173497, 0.751466, 0.045312, 0.741494, 0.095263, 0.741468, 0.146204, 0.751372, 0.196176, 0.770832, 0.243254, 0.799103, 0.285631, 0.835098, 0.321677, 0.733562, -0.021772, 0.710842, 0.032962, 0.699235, 0.09107, 0.699224, 0.150334, 0.71074, 0.208474, 0.733378, 0.263244, 0.766268, 0.312544, 0.808144, 0.354479, 0.692156, -0.043937, 0.665907, 0.019305, 0.652498, 0.086459, 0.652484, 0.154929, 0.665791, 0.222083, 0.691947, 0.285357, 0.729946, 0.342314, 0.778328, 0.390763, 0.651372, -0.065771, 0.621648, 0.005849, 0.60647, 0.081895, 0.606437, 0.159434, 0.621513, 0.235484, 0.651134, 0.307137, 0.694166, 0.371637, 0.748957, 0.426503, 0.893758, 0.788737, 0.899582, 0.769051, 0.909023, 0.75063, 0.92172, 0.734018, 0.937315, 0.719765, 0.955457, 0.708475, 0.975707, 0.700833, 0.99738, 0.697526, 1.02838, 0.568165, 1.02899, 0.598057, 1.06071, 0.598057, 1.06002, 0.568165, 1.09214, 0.598057, 1.09153, 0.568165, 1.12349, 0.598057, 1.12294, 0.568165, 1.15475, 0.598057, 1.15427, 0.568165, 1.18858, 0.568165, 1.18858, 0.598057, 1.22004, 0.568165, 1.22004, 0.598057, 1.2515, 0.568165, 1.2515, 0.598057, 1.28296, 0.568165, 1.28296, 0.598057, 1.3144, 0.568165, 1.3144, 0.598057, 1.34584, 0.568165, 1.34584, 0.598057, 1.37727, 0.568165, 1.37727, 0.598057, 1.40868, 0.568165, 1.40868, 0.598057, 1.44009, 0.598057, 1.44009, 0.568165, 1.47148, 0.568165, 1.47148, 0.598057, 1.50286, 0.598057, 1.50286, 0.568165, 1.53423, 0.568165, 1.53423, 0.598057, 1.56558, 0.598057, 1.56558, 0.568165, 1.59695, 0.598057, 1.59695, 0.568165, 1.62827, 0.598057, 1.62827, 0.568165, 1.65954, 0.598057, 1.65954, 0.568165, 1.69082, 0.568165, 1.69082, 0.598057, 1.72207, 0.568165, 1.72207, 0.598057, 1.7533, 0.568165, 1.7533, 0.598057, 1.78449, 0.568165, 1.78449, 0.598057, 1.81564, 0.568165, 1.81564, 0.598057, 1.84674, 0.568165, 1.84674, 0.598057, 1.87775, 0.598057, 1.87775, 0.568165, 1.90865, 0.568165, 1.87775, 0.568165, 1.90865, 0.598057, 1.93937, 0.598057, 1.93937, 0.568165, 1.96982, 0.598057, 1.96982, 0.568165, 2, 0.598057, 2, 0.568165, 1.02981, 0.627962, 1.06155, 0.627962, 1.09307, 0.627962, 1.12443, 0.627962, 1.15557, 0.627962, 1.18858, 0.627962, 1.22004, 0.627962, 1.2515, 0.627962, 1.28296, 0.627962, 1.3144, 0.627962, 1.34584, 0.627962, 1.37727, 0.627962, 1.40868, 0.627962, 1.44009, 0.627962, 1.47148, 0.627962, 1.50286, 0.627962, 1.53423, 0.627962, 1.56558, 0.627962, 1.59695, 0.627962, 1.62827, 0.627962, 1.65954, 0.627962, 1.69082, 0.627962, 1.72207, 0.627962, 1.72207, 0.627962, 1.72207, 0.627962, 1.7533, 0.627962, 1.78449, 0.627962, 1.81564, 0.627962, 1.84674, 0.627962, 1.87775, 0.627962, 1.90865, 0.627962, 1.93937, 0.627962, 1.96982, 0.627962, 2, 0.627962, 1.06696, 0.658438, 1.09344, 0.658349, 1.12498, 0.658349, 1.15616, 0.658349, 1.18858, 0.658349, 1.22004, 0.658349, 1.22004, 0.658349, 1.22004, 0.658349, 1.2515, 0.658349, 1.28296, 0.658349, 1.3144, 0.658349, 1.34584, 0.658349, 1.37727, 0.658349, 1.37727, 0.658349, 1.37727, 0.658349, 1.40868, 0.658349, 1.44009, 0.658349, 1.47148, 0.658349, 1.50286, 0.658349, 1.53423, 0.658349, 1.56558, 0.658349, 1.59695, 0.658349, 1.62827, 0.658349, 1.65954, 0.658349, 1.69082, 0.658349, 1.72207, 0.627962, 1.72207, 0.627962, 1.72207, 0.658349, 1.72207, 0.627962, 1.7533, 0.658349, 1.78449, 0.658349, 1.81564, 0.658349, 1.84674, 0.658349, 1.87775, 0.658349, 1.90865, 0.658349, 1.93937, 0.658349, 1.96982, 0.658349, 2, 0.658349, 1.12021, 0.695473, 1.15643, 0.68866, 1.18858, 0.68866, 1.22004, 0.658349, 1.22004, 0.658349, 1.22004, 0.68866, 1.22004, 0.658349, 1.2515, 0.68866, 1.28296, 0.68866, 1.3144, 0.68866, 1.34584, 0.68866, 1.37727, 0.658349, 1.37727, 0.658349, 1.37727, 0.68866, 1.37727, 0.658349, 1.40868, 0.68866, 1.44009, 0.68866, 1.40868, 0.68866, 1.47148, 0.68866, 1.50286, 0.68866, 1.53423, 0.68866, 1.56558, 0.68866, 1.59695, 0.68866, 1.62827, 0.68866, 1.65954, 0.68866, 1.69082, 0.68866, 1.72207, 0.68866, 1.7533, 0.68866, 1.78449, 0.68866, 1.81564, 0.68866, 1.84674, 0.68866, 1.87775, 0.68866, 1.90865, 0.68866, 1.93937, 0.68866, 1.96982, 0.68866, 2, 0.68866, 1.15622, 0.718741, 1.18858, 0.718741, 1.22004, 0.718741, 1.2515, 0.718741, 1.28296, 0.718741, 1.3144, 0.718741, 1.34584, 0.718741, 1.37727, 0.718741, 1.40868, 0.68866, 1.40868, 0.68866, 1.40868, 0.718741, 1.44009, 0.718741, 1.40868, 0.68866, 1.40868, 0.68866, 1.44009, 0.718741, 1.47148, 0.718741, 1.44009, 0.718741, 1.50286, 0.718741, 1.53423, 0.718741, 1.56558, 0.718741, 1.59695, 0.718741, 1.62827, 0.718741, 1.65954, 0.718741, 1.69082, 0.718741, 1.72207, 0.718741, 1.7533, 0.718741, 1.78449, 0.718741, 1.81564, 0.718741, 1.84674, 0.718741, 1.87775, 0.718741, 1.90865, 0.718741, 1.93937, 0.718741, 1.93937, 0.718741, 1.96982, 0.718741, 1.93937, 0.718741, 2, 0.718741, 1.15301, 0.747481, 1.18858, 0.748982, 1.22004, 0.748982, 1.2515, 0.748982, 1.28296, 0.748982, 1.3144, 0.748982, 1.34584, 0.748982, 1.37727, 0.748982, 1.40868, 0.748982, 1.44009, 0.748982, 1.44009, 0.718741, 1.47148, 0.748982, 1.44009, 0.718741, 1.44009, 0.718741, 1.50286, 0.748982, 1.53423, 0.748982, 1.56558, 0.748982, 1.59695, 0.748982, 1.62827, 0.748982, 1.65954, 0.748982, 1.69082, 0.748982, 1.72207, 0.748982, 1.7533, 0.748982, 1.78449, 0.748982, 1.81564, 0.748982, 1.84674, 0.748982, 1.87775, 0.748982, 1.90865, 0.748982, 1.93937, 0.748982, 1.93937, 0.718741, 1.96982, 0.748982, 1.93937, 0.718741, 1.93937, 0.718741, 2, 0.748982, 1.18858, 0.779159, 1.22004, 0.779159, 1.2515, 0.779159, 1.28296, 0.779159, 1.3144, 0.779159, 1.34584, 0.779159, 1.37727, 0.779159, 1.40868, 0.779159, 1.44009, 0.779159, 1.47148, 0.779159, 1.50286, 0.779159, 1.53423, 0.779159, 1.56558, 0.779159, 1.59695, 0.779159, 1.62827, 0.779159, 1.65954, 0.779159, 1.69082, 0.779159, 1.72207, 0.779159, 1.7533, 0.779159, 1.78449, 0.779159, 1.81564, 0.779159, 1.84674, 0.779159, 1.87775, 0.779159, 1.90865, 0.779159, 1.93937, 0.779159, 1.96982, 0.779159, 2, 0.779159, 1.16149, 0.776499, 1.13981, 0.720221, 1.09643, 0.674617, 1.0342, 0.648109, 1.11933, 0.784036, 1.15415, 0.778219, 1.1127, 0.761736, 1.15415, 0.778219, 1.14569, 0.75054, 1.15415, 0.778219, 1.10168, 0.740938, 1.13223, 0.724745, 1.08671, 0.722502, 1.11355, 0.701644, 1.09036, 0.682074, 1.06831, 0.706972, 1.06277, 0.666907, 1.04712, 0.695072, 1.03182, 0.657222, 1.02377, 0.687489, 1.11539, 0.784606, 1.11268, 0.784581, 1.10897, 0.763151, 1.10633, 0.763797, 1.09791, 0.743315, 1.09552, 0.744546, 1.08303, 0.725827, 1.08095, 0.727469, 1.06331, 0.713084, 1.06508, 0.711185, 1.04316, 0.70199, 1.04464, 0.699919, 1.02109, 0.694984, 1.02236, 0.692562, 1.15415, 0.778219, 1.15415, 0.778219, 1.15415, 0.778219, 1.05485, 0.187732, 1.07903, 0.217229, 1.04076, 0.197135, 1.07903, 0.217229, 1.07903, 0.217229, 1.05871, 0.230781, 1.03615, 0.240112, 1.0251, 0.20361, 1.0122, 0.244863, 1.00848, 0.206907, 0.98778, 0.244851, 0.991541, 0.206899, 0.991541, 0.206899, 0.963837, 0.240075, 0.991541, 0.206899, 0.97493, 0.203586, 0.941287, 0.230718, 0.959286, 0.197095, 1.07903, 0.217229, 1.10826, 0.252903, 1.08043, 0.271474, 1.07903, 0.217229, 1.07903, 0.217229, 1.04951, 0.284259, 1.01669, 0.290768, 0.983229, 0.290753, 0.95042, 0.284207, 0.919518, 0.271384, 1.13889, 0.29026, 1.10317, 0.314085, 1.0635, 0.330487, 1.02139, 0.338835, 0.978461, 0.338824, 0.93637, 0.330423, 0.896723, 0.313969, 1.1648, 0.321873, 1.12242, 0.350145, 1.07535, 0.369607, 1.02538, 0.37951, 0.974436, 0.379506, 0.924482, 0.369533, 0.877433, 0.350007, 1.19171, 0.354709, 1.14241, 0.3876, 1.08765, 0.410241, 1.02952, 0.421763, 0.970253, 0.421756, 0.912135, 0.410155, 0.857398, 0.387438, 1.22148, 0.391032, 1.16453, 0.429032, 1.10125, 0.45519, 1.0341, 0.468504, 0.965627, 0.468492, 0.898478, 0.455089, 0.835234, 0.428843, 1.25081, 0.426812, 1.18631, 0.469844, 1.11466, 0.499467, 1.03861, 0.514544, 0.961075, 0.514527, 0.885023, 0.49935, 0.813401, 0.469627, 1.10652, 0.785158, 1.10043, 0.765447, 1.09028, 0.747072, 1.07661, 0.730563, 1.05992, 0.7165, 1.05992, 0.7165, 1.04063, 0.705691, 1.05992, 0.7165, 1.01942, 0.699129, 0.99738, 0.697526, 0.996655, 0.559859, 0.965101, 0.568165, 0.996685, 0.568165, 0.965101, 0.568165, 0.965027, 0.559859, 0.933369, 0.568165, 0.933369, 0.568165, 0.933349, 0.559859, 0.901673, 0.568165, 0.901673, 0.568165, 0.901667, 0.559859, 0.870018, 0.568165, 0.870018, 0.568165, 0.87, 0.559859, 0.838378, 0.568165, 0.838378, 0.568165, 0.838349, 0.559859, 0.811461, 0.559859, 0.838378, 0.568165, 0.811461, 0.568165, 0.779997, 0.559859, 0.811461, 0.568165, 0.779997, 0.568165, 0.748539, 0.568165, 0.748539, 0.568165, 0.748539, 0.559859, 0.717089, 0.568165, 0.717089, 0.568165, 0.717089, 0.559859, 0.685647, 0.568165, 0.685647, 0.568165, 0.685647, 0.559859, 0.654214, 0.559859, 0.654214, 0.568165, 0.685647, 0.568165, 0.62279, 0.568165, 0.62279, 0.568165, 0.62279, 0.559859, 0.591377, 0.559859, 0.591377, 0.568165, 0.62279, 0.568165, 0.559975, 0.568165, 0.559975, 0.559859, 0.559975, 0.568165, 0.528586, 0.568165, 0.559975, 0.568165, 0.528586, 0.559859, 0.528586, 0.559859, 0.49721, 0.568165, 0.528586, 0.559859, 0.49721, 0.559859, 0.528586, 0.559859, 0.49721, 0.568165, 0.465849, 0.568165, 0.465849, 0.559859, 0.465849, 0.568165, 0.434504, 0.568165, 0.434504, 0.559859, 0.434504, 0.568165, 0.403176, 0.568165, 0.403176, 0.559859, 0.403176, 0.568165, 0.403176, 0.568165, 0.371866, 0.559859, 0.371866, 0.568165, 0.340576, 0.559859, 0.371866, 0.568165, 0.340576, 0.568165, 0.309306, 0.559859, 0.340576, 0.568165, 0.309306, 0.568165, 0.278061, 0.568165, 0.278061, 0.568165, 0.278061, 0.559859, 0.246845, 0.568165, 0.246845, 0.568165, 0.246845, 0.559859, 0.215663, 0.568165, 0.215663, 0.568165, 0.215663, 0.559859, 0.184525, 0.568165, 0.184525, 0.568165, 0.184525, 0.559859, 0.153444, 0.559859, 0.184525, 0.568165, 0.153444, 0.568165, 0.122445, 0.559859, 0.153444, 0.568165, 0.122445, 0.568165, 0.091564, 0.559859, 0.122445, 0.568165, 0.091564, 0.568165, 0.06086, 0.568165, 0.06086, 0.568165, 0.06086, 0.559859, 0.06086, 0.559859, 0.030417, 0.559859, 0.030417, 0.568165, 0.06086, 0.568165, 0, 0.559859, 0, 0.568165, 0.030417, 0.568165, 1.02838, 0.568165, 1.02828, 0.559859, 1.02838, 0.568165, 1.05987, 0.559859, 1.02838, 0.568165, 1.06002, 0.568165, 1.09137, 0.559859, 1.06002, 0.568165, 1.09153, 0.568165, 1.12294, 0.568165, 1.1228, 0.559859, 1.15415, 0.559859, 1.12294, 0.568165, 1.15427, 0.568165, 1.18858, 0.568165, 1.18858, 0.568165, 1.18858, 0.559859, 1.22004, 0.568165, 1.22004, 0.568165, 1.22004, 0.559859, 1.2515, 0.568165, 1.2515, 0.568165, 1.2515, 0.559859, 1.28296, 0.559859, 1.2515, 0.568165, 1.28296, 0.568165, 1.3144, 0.559859, 1.3144, 0.568165, 1.3144, 0.568165, 1.34584, 0.559859, 1.3144, 0.568165, 1.34584, 0.568165, 1.37727, 0.559859, 1.34584, 0.568165, 1.37727, 0.568165, 1.40868, 0.559859, 1.37727, 0.568165, 1.40868, 0.568165, 1.44009, 0.559859, 1.40868, 0.568165, 1.44009, 0.568165, 1.47148, 0.559859, 1.44009, 0.568165, 1.47148, 0.568165, 1.50286, 0.559859, 1.47148, 0.568165, 1.50286, 0.568165, 1.53423, 0.559859, 1.50286, 0.568165, 1.53423, 0.568165, 1.56558, 0.568165, 1.56558, 0.559859, 1.56558, 0.568165, 1.59695, 0.568165, 1.59695, 0.559859, 1.59695, 0.568165, 1.62827, 0.568165, 1.62827, 0.559859, 1.62827, 0.568165, 1.65954, 0.559859, 1.62827, 0.568165, 1.65954, 0.568165, 1.69082, 0.568165, 1.69082, 0.559859, 1.69082, 0.568165, 1.72207, 0.568165, 1.72207, 0.559859, 1.72207, 0.568165, 1.7533, 0.568165, 1.7533, 0.568165, 1.7533, 0.559859, 1.78449, 0.568165, 1.78449, 0.568165, 1.78449, 0.559859, 1.81564, 0.568165, 1.81564, 0.568165, 1.81564, 0.559859, 1.84674, 0.568165, 1.84674, 0.568165, 1.84674, 0.559859, 1.87775, 0.568165, 1.87775, 0.568165, 1.87775, 0.559859, 1.87775, 0.568165, 1.90865, 0.559859, 1.87775, 0.568165, 1.90865, 0.568165, 1.93937, 0.568165, 1.93937, 0.568165, 1.93937, 0.559859, 1.96982, 0.559859, 1.93937, 0.568165, 1.96982, 0.568165, 2, 0.559859, 1.96982, 0.568165, 2, 0.568165, 0.964944, 0.551828, 0.996609, 0.551828, 0.933253, 0.551828, 0.901554, 0.551828, 0.869862, 0.551828, 0.83819, 0.551828, 0.811461, 0.551828, 0.779997, 0.551828, 0.748539, 0.551828, 0.717089, 0.551828, 0.685647, 0.551828, 0.654214, 0.551828, 0.62279, 0.551828, 0.591377, 0.551828, 0.559975, 0.551828, 0.528586, 0.559859, 0.528586, 0.551828, 0.528586, 0.559859, 0.49721, 0.551828, 0.465849, 0.551828, 0.434504, 0.551828, 0.403176, 0.551828, 0.371866, 0.551828, 0.340576, 0.551828, 0.309306, 0.551828, 0.278061, 0.551828, 0.246845, 0.551828, 0.215663, 0.551828, 0.184525, 0.551828, 0.153444, 0.551828, 0.122445, 0.551828, 0.091564, 0.551828, 0.06086, 0.551828, 0.06086, 0.559859, 0.030417, 0.551828, 0.06086, 0.559859, 0, 0.551828, 1.02824, 0.551828, 1.05983, 0.551828, 1.09134, 0.551828, 1.12278, 0.551828, 1.15414, 0.551828, 1.18858, 0.551828, 1.22004, 0.551828, 1.2515, 0.551828, 1.28296, 0.551828, 1.3144, 0.551828, 1.34584, 0.551828, 1.37727, 0.551828, 1.40868, 0.551828, 1.44009, 0.551828, 1.47148, 0.551828, 1.50286, 0.551828, 1.53423, 0.551828, 1.56558, 0.551828, 1.59695, 0.551828, 1.62827, 0.551828, 1.65954, 0.551828, 1.69082, 0.551828, 1.72207, 0.551828, 1.7533, 0.551828, 1.78449, 0.551828, 1.81564, 0.551828, 1.84674, 0.551828, 1.87775, 0.551828, 1.90865, 0.551828, 1.93937, 0.551828, 1.96982, 0.551828, 2, 0.551828, 0.500003, 0.499997, 0.498418, 0.466869, 0.475876, 0.477747, 0.467478, 0.501647, 0.47812, 0.524586, 0.501588, 0.533124, 0.52413, 0.522246, 0.532528, 0.498346, 0.521886, 0.475408, 0.509967, 0.432418, 0.483587, 0.433762, 0.459796, 0.44522, 0.442125, 0.465008, 0.43333, 0.490016, 0.434612, 0.516607, 0.445775, 0.540632, 0.465268, 0.558573, 0.49004, 0.567576, 0.516419, 0.566232, 0.54021, 0.554773, 0.557881, 0.534986, 0.566676, 0.509977, 0.565395, 0.483387, 0.554231, 0.459362, 0.534739, 0.44142, 0.51499, 0.398725, 0.475297, 0.400764, 0.439377, 0.418234, 0.412768, 0.447681, 0.399799, 0.485081, 0.401699, 0.524793, 0.418266, 0.560743, 0.447611, 0.587532, 0.485017, 0.601269, 0.524709, 0.599229, 0.560628, 0.581759, 0.587238, 0.552311, 0.600207, 0.514912, 0.598308, 0.475201, 0.581741, 0.439251, 0.552397, 0.412461, 0.506821, 0.362856, 0.479841, 0.364271, 0.453626, 0.371064, 0.429429, 0.382761, 0.407964, 0.398742, 0.389985, 0.41864, 0.376257, 0.441723, 0.367485, 0.466916, 0.363795, 0.493359, 0.364967, 0.520026, 0.37124, 0.545889, 0.382481, 0.570135, 0.398405, 0.591803, 0.418224, 0.6099, 0.441185, 0.623798, 0.466457, 0.633052, 0.493187, 0.637137, 0.520165, 0.635722, 0.54638, 0.628928, 0.570577, 0.617232, 0.592041, 0.601251, 0.61002, 0.581353, 0.623748, 0.55827, 0.632521, 0.533076, 0.636211, 0.506635, 0.635039, 0.479967, 0.628767, 0.454105, 0.617526, 0.42986, 0.601604, 0.408192, 0.601604, 0.408192, 0.581785, 0.390094, 0.601604, 0.408192, 0.558823, 0.376196, 0.533551, 0.366941, 0.508424, 0.328293, 0.508424, 0.328293, 0.47472, 0.330124, 0.442037, 0.338496, 0.411638, 0.352947, 0.384664, 0.373027, 0.362125, 0.397991, 0.344881, 0.426892, 0.333693, 0.458601, 0.329047, 0.491769, 0.330491, 0.525177, 0.338491, 0.557726, 0.3528, 0.588116, 0.372781, 0.615172, 0.397669, 0.637828, 0.426517, 0.655204, 0.458234, 0.666642, 0.491584, 0.6717, 0.525287, 0.669869, 0.55797, 0.661497, 0.588368, 0.647044, 0.615342, 0.626965, 0.63788, 0.602, 0.655125, 0.5731, 0.666313, 0.541391, 0.670959, 0.508224, 0.669516, 0.474818, 0.670959, 0.508224, 0.661517, 0.442269, 0.647209, 0.411879, 0.627228, 0.384823, 0.601604, 0.408192, 0.601604, 0.408192, 0.60234, 0.362166, 0.573492, 0.344791, 0.541775, 0.333352, 0.508424, 0.328293, 0.508424, 0.328293, 0.509969, 0.293717, 0.508424, 0.328293, 0.469593, 0.296017, 0.430363, 0.305942, 0.39385, 0.323266, 0.361426, 0.347387, 0.334339, 0.377368, 0.313629, 0.412048, 0.3001, 0.450068, 0.294404, 0.489938, 0.296138, 0.530244, 0.305886, 0.569415, 0.323138, 0.605959, 0.347183, 0.638452, 0.323138, 0.605959, 0.377117, 0.665644, 0.411806, 0.68648, 0.44994, 0.700141, 0.49004, 0.706276, 0.530414, 0.703976, 0.569644, 0.69405, 0.606156, 0.676726, 0.63858, 0.652605, 0.665666, 0.622623, 0.686376, 0.587944, 0.699906, 0.549925, 0.705602, 0.510056, 0.670959, 0.508224, 0.699906, 0.549925, 0.70387, 0.46975, 0.670959, 0.508224, 0.694122, 0.43058, 0.676872, 0.394037, 0.652827, 0.361544, 0.622894, 0.334351, 0.588205, 0.313515, 0.55007, 0.299852, 0.508424, 0.328293, 0.49986, 0.266389, 0.476907, 0.267745, 0.45428, 0.271177, 0.432085, 0.276786, 0.410535, 0.284533, 0.389852, 0.29435, 0.370228, 0.306146, 0.351861, 0.319808, 0.33492, 0.335204, 0.319577, 0.352184, 0.305969, 0.370584, 0.294237, 0.390225, 0.284482, 0.41092, 0.276812, 0.432469, 0.271287, 0.454677, 0.268003, 0.477303, 0.266988, 0.500056, 0.267923, 0.522848, 0.271259, 0.545502, 0.276783, 0.567703, 0.284476, 0.589256, 0.294244, 0.609952, 0.323138, 0.605959, 0.323138, 0.605959, 0.306001, 0.629596, 0.319622, 0.647997, 0.323138, 0.605959, 0.334992, 0.664978, 0.334992, 0.664978, 0.351948, 0.680376, 0.334992, 0.664978, 0.370343, 0.694037, 0.389987, 0.705832, 0.410704, 0.715641, 0.432274, 0.723371, 0.454487, 0.728947, 0.454487, 0.728947, 0.477147, 0.732363, 0.454487, 0.728947, 0.500148, 0.733604, 0.5231, 0.732247, 0.545727, 0.728815, 0.567922, 0.723206, 0.589471, 0.715459, 0.610154, 0.705641, 0.629779, 0.693844, 0.648144, 0.680182, 0.665086, 0.664787, 0.680428, 0.647807, 0.694036, 0.629407, 0.705768, 0.609766, 0.715523, 0.589072, 0.699906, 0.549925, 0.723194, 0.567524, 0.699906, 0.549925, 0.699906, 0.549925, 0.72872, 0.545316, 0.732004, 0.52269, 0.699906, 0.549925, 0.733019, 0.499938, 0.732085, 0.477146, 0.728749, 0.454493, 0.723226, 0.432293, 0.715533, 0.41074, 0.705765, 0.390044, 0.694009, 0.3704, 0.680388, 0.351999, 0.665019, 0.335018, 0.648063, 0.31962, 0.629668, 0.305959, 0.610024, 0.294163, 0.589307, 0.284354, 0.567737, 0.276624, 0.545524, 0.271047, 0.522863, 0.26763, 0.476296, 0.260913, 0.49986, 0.259645, 0.486752, 0.233866, 0.435063, 0.24167, 0.452944, 0.264449, 0.430108, 0.270221, 0.407902, 0.278208, 0.385924, 0.259348, 0.386632, 0.288306, 0.341181, 0.286249, 0.366412, 0.300462, 0.347525, 0.31451, 0.302553, 0.321352, 0.330069, 0.330373, 0.31429, 0.347831, 0.271523, 0.363307, 0.300269, 0.36679, 0.288202, 0.386986, 0.249285, 0.410495, 0.278153, 0.40831, 0.270263, 0.430466, 0.236687, 0.461084, 0.264574, 0.453333, 0.261168, 0.476583, 0.260055, 0.500083, 0.234148, 0.513109, 0.261128, 0.523548, 0.264552, 0.546861, 0.241723, 0.564691, 0.270236, 0.569685, 0.278159, 0.591893, 0.259256, 0.613838, 0.288204, 0.613174, 0.300318, 0.633415, 0.286063, 0.658631, 0.314328, 0.652335, 0.330163, 0.669831, 0.321107, 0.697346, 0.347603, 0.685661, 0.366555, 0.699736, 0.363046, 0.728491, 0.386756, 0.711862, 0.410273, 0.750859, 0.408098, 0.721969, 0.430281, 0.72992, 0.460984, 0.763586, 0.453189, 0.735672, 0.476515, 0.739156, 0.513256, 0.766126, 0.500148, 0.740348, 0.523711, 0.739079, 0.564945, 0.758322, 0.547063, 0.735543, 0.569899, 0.72977, 0.614083, 0.740642, 0.592104, 0.721783, 0.613374, 0.711685, 0.658825, 0.713741, 0.633594, 0.699529, 0.652481, 0.685481, 0.669936, 0.669618, 0.697453, 0.678638, 0.685715, 0.65216, 0.728481, 0.636684, 0.699736, 0.633201, 0.711802, 0.613006, 0.75072, 0.589498, 0.721852, 0.591682, 0.729742, 0.569526, 0.763319, 0.53891, 0.735433, 0.54666, 0.73884, 0.52341, 0.76586, 0.486886, 0.739953, 0.499911, 0.73888, 0.476447, 0.758286, 0.435305, 0.735457, 0.453134, 0.729773, 0.43031, 0.740754, 0.386159, 0.72185, 0.408103, 0.711805, 0.386822, 0.713948, 0.341366, 0.699693, 0.366582, 0.685683, 0.347661, 0.678905, 0.30265, 0.669848, 0.330165, 0.652409, 0.314335, 0.636966, 0.271505, 0.633456, 0.30026, 0.613255, 0.288134, 0.589738, 0.249136, 0.591913, 0.278026, 0.56973, 0.270075, 0.539027, 0.236408, 0.546822, 0.264321, 0.523495, 0.260838, 0.407902, 0.278208, 0.278159, 0.591893, 0.300318, 0.633415, 0.334992, 0.664978, 0.334992, 0.664978, 0.330163, 0.669831, 0.454487, 0.728947, 0.454487, 0.728947, 0.454487, 0.728947, 0.669936, 0.669618, 0.500047, 0.499959, 0.532676, 0.496005, 0.520322, 0.474093, 0.525916, 0.520233, 0.504003, 0.532586, 0.479772, 0.525826, 0.467419, 0.503914, 0.474179, 0.479685, 0.496092, 0.467333, 0.551535, 0.455758, 0.530666, 0.439403, 0.564521, 0.478791, 0.567712, 0.505111, 0.560607, 0.530579, 0.544251, 0.551446, 0.521217, 0.564431, 0.494895, 0.567621, 0.469426, 0.560515, 0.448558, 0.544159, 0.435573, 0.521127, 0.432382, 0.494807, 0.439487, 0.469339, 0.455843, 0.448472, 0.478876, 0.435488, 0.505197, 0.432297, 0.546022, 0.409092, 0.577297, 0.433604, 0.596812, 0.468217, 0.601596, 0.507662, 0.590919, 0.545935, 0.566406, 0.577209, 0.531791, 0.596722, 0.492343, 0.601503, 0.454069, 0.590824, 0.422795, 0.566312, 0.403281, 0.531699, 0.398498, 0.492253, 0.409176, 0.453982, 0.433688, 0.422709, 0.468302, 0.403197, 0.507748, 0.398415, 0.573522, 0.384471, 0.594632, 0.401016, 0.612126, 0.421381, 0.625299, 0.444743, 0.633669, 0.470253, 0.636899, 0.496877, 0.634869, 0.523647, 0.627662, 0.54948, 0.61554, 0.573436, 0.598995, 0.594545, 0.578628, 0.612038, 0.555264, 0.625209, 0.529753, 0.633577, 0.503127, 0.636804, 0.476356, 0.634773, 0.450523, 0.627566, 0.426567, 0.615444, 0.405458, 0.598899, 0.387964, 0.578533, 0.374793, 0.55517, 0.366424, 0.52966, 0.363195, 0.503036, 0.365226, 0.476267, 0.372434, 0.450435, 0.384555, 0.42648, 0.4011, 0.405373, 0.421466, 0.38788, 0.444829, 0.374709, 0.470339, 0.366341, 0.496963, 0.363114, 0.523733, 0.365144, 0.549566, 0.372351, 0.592135, 0.355197, 0.618608, 0.375944, 0.592135, 0.355197, 0.640524, 0.401457, 0.657044, 0.430756, 0.667532, 0.462715, 0.671583, 0.496103, 0.66904, 0.52964, 0.660001, 0.562038, 0.644815, 0.59205, 0.624066, 0.618522, 0.59855, 0.640438, 0.569249, 0.656956, 0.53729, 0.667439, 0.503899, 0.671486, 0.470361, 0.668942, 0.437963, 0.659903, 0.407952, 0.644717, 0.407952, 0.644717, 0.407952, 0.644717, 0.38148, 0.623969, 0.359564, 0.598454, 0.343046, 0.569154, 0.33256, 0.537196, 0.328511, 0.503807, 0.331055, 0.470271, 0.340095, 0.437875, 0.355281, 0.407865, 0.355281, 0.407865, 0.37603, 0.381394, 0.355281, 0.407865, 0.401544, 0.359479, 0.430843, 0.342962, 0.462801, 0.332479, 0.49619, 0.328431, 0.529728, 0.330975, 0.562124, 0.340012, 0.592135, 0.355197, 0.592135, 0.355197, 0.610708, 0.325999, 0.642519, 0.350931, 0.592135, 0.355197, 0.668855, 0.381589, 0.688704, 0.416797, 0.701311, 0.455204, 0.706182, 0.495322, 0.703125, 0.535625, 0.692262, 0.574557, 0.674013, 0.610623, 0.649078, 0.642435, 0.618416, 0.668772, 0.583206, 0.68862, 0.5448, 0.701218, 0.583206, 0.68862, 0.504675, 0.706082, 0.464373, 0.703024, 0.425442, 0.692162, 0.407952, 0.644717, 0.407952, 0.644717, 0.389378, 0.673914, 0.357567, 0.648981, 0.407952, 0.644717, 0.407952, 0.644717, 0.331232, 0.61832, 0.311385, 0.583111, 0.29878, 0.544703, 0.293911, 0.504585, 0.296971, 0.464284, 0.307835, 0.425353, 0.326084, 0.38929, 0.307835, 0.425353, 0.355281, 0.407865, 0.355281, 0.407865, 0.351018, 0.35748, 0.381678, 0.331145, 0.416886, 0.311298, 0.455289, 0.2987, 0.495413, 0.293836, 0.535714, 0.296892, 0.574644, 0.307752, 0.592135, 0.355197, 0.634773, 0.309497, 0.652791, 0.323618, 0.669341, 0.33944, 0.684258, 0.356804, 0.697403, 0.375551, 0.708644, 0.395492, 0.717878, 0.416444, 0.725005, 0.438202, 0.730017, 0.460544, 0.732762, 0.48327, 0.733275, 0.506162, 0.731543, 0.52899, 0.727581, 0.551543, 0.721428, 0.573595, 0.713142, 0.594942, 0.702806, 0.61537, 0.690514, 0.63469, 0.676391, 0.652708, 0.660567, 0.669259, 0.6432, 0.684176, 0.624451, 0.697321, 0.583206, 0.68862, 0.604508, 0.708563, 0.583206, 0.68862, 0.583555, 0.717799, 0.583206, 0.68862, 0.561802, 0.724934, 0.583206, 0.68862, 0.53945, 0.729904, 0.516723, 0.732659, 0.493832, 0.733173, 0.471004, 0.731441, 0.448453, 0.727479, 0.426402, 0.721327, 0.405056, 0.713041, 0.384629, 0.702706, 0.365311, 0.690415, 0.347293, 0.676293, 0.330743, 0.66047, 0.315828, 0.643104, 0.302683, 0.624356, 0.291443, 0.604413, 0.28221, 0.583461, 0.275084, 0.561703, 0.270074, 0.539361, 0.26733, 0.516635, 0.266819, 0.493743, 0.266819, 0.493743, 0.266819, 0.493743, 0.268553, 0.470915, 0.272516, 0.448363, 0.307835, 0.425353, 0.307835, 0.425353, 0.278669, 0.426313, 0.307835, 0.425353, 0.286955, 0.404967, 0.297292, 0.384541, 0.307835, 0.425353, 0.309583, 0.365223, 0.323705, 0.347206, 0.339529, 0.330656, 0.356895, 0.31574, 0.375642, 0.302596, 0.395584, 0.291354, 0.416536, 0.282119, 0.438288, 0.274984, 0.460638, 0.270014, 0.483364, 0.267259, 0.506255, 0.266744, 0.529081, 0.268476, 0.551632, 0.272436, 0.573682, 0.278588, 0.595027, 0.286872, 0.615454, 0.297207, 0.657265, 0.318435, 0.664324, 0.290347, 0.638736, 0.303914, 0.674317, 0.334737, 0.702059, 0.326423, 0.689656, 0.352594, 0.73203, 0.369167, 0.7032, 0.371909, 0.714759, 0.392416, 0.753083, 0.416935, 0.724272, 0.414003, 0.731601, 0.436372, 0.764444, 0.467892, 0.736766, 0.459392, 0.739592, 0.482766, 0.74012, 0.506354, 0.765615, 0.520093, 0.738338, 0.52983, 0.734255, 0.553068, 0.75658, 0.571518, 0.727928, 0.575745, 0.719391, 0.59774, 0.737687, 0.62019, 0.708761, 0.618746, 0.696097, 0.638653, 0.709661, 0.664241, 0.681573, 0.657182, 0.665268, 0.674235, 0.673581, 0.701978, 0.647409, 0.689574, 0.628092, 0.703119, 0.630832, 0.731951, 0.607583, 0.71468, 0.585995, 0.724195, 0.583058, 0.753007, 0.563625, 0.731533, 0.532094, 0.76434, 0.540595, 0.736654, 0.517224, 0.739486, 0.479899, 0.765511, 0.493638, 0.740016, 0.470164, 0.738235, 0.428478, 0.756478, 0.446927, 0.734153, 0.424252, 0.727826, 0.379808, 0.737586, 0.402258, 0.719289, 0.381253, 0.708661, 0.361347, 0.695997, 0.335759, 0.709563, 0.342819, 0.681475, 0.298025, 0.673484, 0.325768, 0.665171, 0.310429, 0.647313, 0.296886, 0.627997, 0.268056, 0.630737, 0.285328, 0.607489, 0.247005, 0.582968, 0.275816, 0.585901, 0.268488, 0.563532, 0.235647, 0.532011, 0.263324, 0.540512, 0.260501, 0.517138, 0.23448, 0.47981, 0.259975, 0.49355, 0.261758, 0.470075, 0.243517, 0.428388, 0.265842, 0.446838, 0.272169, 0.424162, 0.262411, 0.379719, 0.280707, 0.402169, 0.291337, 0.381164, 0.290435, 0.335671, 0.304001, 0.361259, 0.318523, 0.342732, 0.326514, 0.297937, 0.334827, 0.32568, 0.352685, 0.310341, 0.369261, 0.267966, 0.372002, 0.296798, 0.392509, 0.285238, 0.414096, 0.275723, 0.417032, 0.24691, 0.436465, 0.268385, 0.459493, 0.263264, 0.467994, 0.235578, 0.482863, 0.260431, 0.506449, 0.259901, 0.520186, 0.234405, 0.529922, 0.261681, 0.553157, 0.265762, 0.571605, 0.243436, 0.575832, 0.272088, 0.620274, 0.262326, 0.597825, 0.280624, 0.61883, 0.291251, 0.696097, 0.638653, 0.266819, 0.493743, 0.266819, 0.493743, 0.266819, 0.493743, 0.553157, 0.265762, 0.500209, 0.500047, 0.478309, 0.525914, 0.500109, 0.527247, 0.474809, 0.500047, 0.425309, 0.521647, 0.445309, 0.500047, 0.422609, 0.500047, 0.449859, 0.523447, 0.400109, 0.528647, 0.396409, 0.499947, 0.433309, 0.541747, 0.410709, 0.555247, 0.461609, 0.543947, 0.446009, 0.558747, 0.427509, 0.577847, 0.461909, 0.572047, 0.477159, 0.558147, 0.461909, 0.572047, 0.461909, 0.572047, 0.449109, 0.595047, 0.461909, 0.572047, 0.461909, 0.572047, 0.480509, 0.579947, 0.461909, 0.572047, 0.473809, 0.605947, 0.461909, 0.572047, 0.500209, 0.560647, 0.500209, 0.582847, 0.500209, 0.609847, 0.523259, 0.558147, 0.519909, 0.579947, 0.526609, 0.605947, 0.538609, 0.572047, 0.551309, 0.595047, 0.538809, 0.544047, 0.554509, 0.558747, 0.572909, 0.577847, 0.567209, 0.541647, 0.550459, 0.523447, 0.589709, 0.555247, 0.575109, 0.521647, 0.600309, 0.528647, 0.555109, 0.500047, 0.577909, 0.500047, 0.604009, 0.499947, 0.374509, 0.535647, 0.370009, 0.499947, 0.343709, 0.499947, 0.349109, 0.542447, 0.387709, 0.568747, 0.364709, 0.581947, 0.408609, 0.597047, 0.364709, 0.581947, 0.389609, 0.615847, 0.364709, 0.581947, 0.435609, 0.618647, 0.422009, 0.641947, 0.466809, 0.632347, 0.459709, 0.658347, 0.500209, 0.637047, 0.500209, 0.664047, 0.533709, 0.632347, 0.540709, 0.658347, 0.564909, 0.618647, 0.578409, 0.641947, 0.591809, 0.597047, 0.610809, 0.615847, 0.612709, 0.568747, 0.635709, 0.581947, 0.625909, 0.535647, 0.651409, 0.542447, 0.630409, 0.499947, 0.656709, 0.499947, 0.317409, 0.499947, 0.323609, 0.549147, 0.290909, 0.499947, 0.298009, 0.555847, 0.290909, 0.499947, 0.341709, 0.595047, 0.364709, 0.581947, 0.364709, 0.581947, 0.318709, 0.608147, 0.370709, 0.634547, 0.364709, 0.581947, 0.351709, 0.653247, 0.408509, 0.665047, 0.395009, 0.688047, 0.452709, 0.684247, 0.445709, 0.710047, 0.500209, 0.690847, 0.500209, 0.717547, 0.547709, 0.684247, 0.554809, 0.710047, 0.591909, 0.665047, 0.605409, 0.688047, 0.629709, 0.634547, 0.648709, 0.653247, 0.658709, 0.595047, 0.681809, 0.608147, 0.676909, 0.549147, 0.702409, 0.555847, 0.683009, 0.499947, 0.709509, 0.499947, 0.264309, 0.499947, 0.272209, 0.562647, 0.290909, 0.499947, 0.237209, 0.499947, 0.246009, 0.569547, 0.295409, 0.621247, 0.271809, 0.634547, 0.332609, 0.671947, 0.313109, 0.690847, 0.381409, 0.711047, 0.367509, 0.734447, 0.438609, 0.735947, 0.431409, 0.762047, 0.500209, 0.744447, 0.431409, 0.762047, 0.431409, 0.762047, 0.500209, 0.771547, 0.561909, 0.735947, 0.569109, 0.762047, 0.569109, 0.762047, 0.619109, 0.711047, 0.632909, 0.734447, 0.569109, 0.762047, 0.667909, 0.671947, 0.687309, 0.690847, 0.705009, 0.621247, 0.728709, 0.634547, 0.728209, 0.562647, 0.754509, 0.569547, 0.736209, 0.499947, 0.763309, 0.499947, 0.209409, 0.500047, 0.219109, 0.576447, 0.180509, 0.500047, 0.191009, 0.583747, 0.247509, 0.648147, 0.222209, 0.662147, 0.293209, 0.710147, 0.272409, 0.730247, 0.353309, 0.758247, 0.338409, 0.783047, 0.424009, 0.788847, 0.431409, 0.762047, 0.416209, 0.816647, 0.431409, 0.762047, 0.500209, 0.799247, 0.431409, 0.762047, 0.500209, 0.828247, 0.500209, 0.828247, 0.569109, 0.762047, 0.576509, 0.788847, 0.569109, 0.762047, 0.500209, 0.828247, 0.500209, 0.828247, 0.584209, 0.816647, 0.569109, 0.762047, 0.647109, 0.758247, 0.662009, 0.783047, 0.707209, 0.710147, 0.728009, 0.730247, 0.752909, 0.648147, 0.778209, 0.662147, 0.781409, 0.576447, 0.809409, 0.583747, 0.791009, 0.500047, 0.820009, 0.500047, 0.521776, 0.526147, 0.521776, 0.526147, 0.521776, 0.526147, 0.525509, 0.500047, 0.521776, 0.526147, 0.521776, 0.526147, 0.521776, 0.526147, 0.521776, 0.526147, 0.478309, 0.47418, 0.500143, 0.47288, 0.425309, 0.478347, 0.449859, 0.476647, 0.400109, 0.471247, 0.433309, 0.458347, 0.410709, 0.444647, 0.461609, 0.456047, 0.445909, 0.441347, 0.427509, 0.422147, 0.461909, 0.427947, 0.477159, 0.441897, 0.449109, 0.404947, 0.480509, 0.420147, 0.473809, 0.394047, 0.500109, 0.417147, 0.500109, 0.439447, 0.500209, 0.390247, 0.519909, 0.420147, 0.523259, 0.441847, 0.526609, 0.394047, 0.538609, 0.427947, 0.551309, 0.404947, 0.538809, 0.456047, 0.554509, 0.441347, 0.572909, 0.422147, 0.550509, 0.476597, 0.567209, 0.458347, 0.589709, 0.444747, 0.575109, 0.478347, 0.600309, 0.471247, 0.374509, 0.464347, 0.349009, 0.457547, 0.387709, 0.431147, 0.364709, 0.417947, 0.408609, 0.402947, 0.389609, 0.384047, 0.435509, 0.381247, 0.422009, 0.357947, 0.466709, 0.367647, 0.459709, 0.341447, 0.500209, 0.362947, 0.500209, 0.335847, 0.533709, 0.367647, 0.540709, 0.341447, 0.564909, 0.381347, 0.578409, 0.357947, 0.591809, 0.402947, 0.610809, 0.384047, 0.612709, 0.431247, 0.635709, 0.417947, 0.625909, 0.464347, 0.651409, 0.457547, 0.323509, 0.450747, 0.290909, 0.499947, 0.297909, 0.444047, 0.290909, 0.499947, 0.341709, 0.404847, 0.318609, 0.391747, 0.370609, 0.365247, 0.351609, 0.346647, 0.408509, 0.334847, 0.394909, 0.311747, 0.452709, 0.315547, 0.445609, 0.289747, 0.500209, 0.308947, 0.500209, 0.282147, 0.547809, 0.315547, 0.554809, 0.289747, 0.592009, 0.334847, 0.605509, 0.311747, 0.629809, 0.365247, 0.648809, 0.346647, 0.658709, 0.404847, 0.681809, 0.391747, 0.676909, 0.450747, 0.702509, 0.444047, 0.272109, 0.437247, 0.290909, 0.499947, 0.245909, 0.430447, 0.295309, 0.378647, 0.271609, 0.365347, 0.332409, 0.327847, 0.312909, 0.308947, 0.381209, 0.288647, 0.367409, 0.265247, 0.312909, 0.308947, 0.312909, 0.308947, 0.438509, 0.263747, 0.431309, 0.237647, 0.500209, 0.255247, 0.500209, 0.228047, 0.500209, 0.255247, 0.500209, 0.255247, 0.561909, 0.263747, 0.500209, 0.255247, 0.569109, 0.237647, 0.500209, 0.255247, 0.500209, 0.255247, 0.619209, 0.288647, 0.633109, 0.265247, 0.668009, 0.327847, 0.687509, 0.308947, 0.705109, 0.378647, 0.728809, 0.365347, 0.728309, 0.437247, 0.754609, 0.430447, 0.219009, 0.423447, 0.190909, 0.416247, 0.247309, 0.351747, 0.222009, 0.337747, 0.312909, 0.308947, 0.293009, 0.289647, 0.312909, 0.308947, 0.272109, 0.269547, 0.353109, 0.241347, 0.312909, 0.308947, 0.338209, 0.216547, 0.423909, 0.210847, 0.416109, 0.182947, 0.500209, 0.200347, 0.500209, 0.171347, 0.576609, 0.210847, 0.584309, 0.182947, 0.647309, 0.241347, 0.662209, 0.216547, 0.707509, 0.289647, 0.728309, 0.269547, 0.753109, 0.351747, 0.778409, 0.337747, 0.781509, 0.423447, 0.809509, 0.416247, 0.521809, 0.473947, 0.489601, 0.286905, 0.449145, 0.293706, 0.451854, 0.303928, 0.490169, 0.297455, 0.410683, 0.30805, 0.41536, 0.317544, 0.375878, 0.329851, 0.382347, 0.338231, 0.346056, 0.358121, 0.354045, 0.365078, 0.32225, 0.391642, 0.331433, 0.396928, 0.305229, 0.429087, 0.315275, 0.43248, 0.296304, 0.469277, 0.306823, 0.470708, 0.294489, 0.510438, 0.305098, 0.509956, 0.310147, 0.548828, 0.299823, 0.551277, 0.322819, 0.585826, 0.313165, 0.590209, 0.342254, 0.619745, 0.333622, 0.625894, 0.367804, 0.649265, 0.360534, 0.656967, 0.392982, 0.682157, 0.398586, 0.67318, 0.429772, 0.70037, 0.433468, 0.69046, 0.469456, 0.710789, 0.471082, 0.700347, 0.510403, 0.713104, 0.509834, 0.702555, 0.548149, 0.696081, 0.550858, 0.706303, 0.584643, 0.682464, 0.58932, 0.691959, 0.617655, 0.661777, 0.624125, 0.670157, 0.645958, 0.63493, 0.653947, 0.641887, 0.677754, 0.608366, 0.668571, 0.603081, 0.694776, 0.570921, 0.68473, 0.567528, 0.703702, 0.530732, 0.693182, 0.529301, 0.705516, 0.489572, 0.694908, 0.490053, 0.700183, 0.448733, 0.689858, 0.451182, 0.686841, 0.409801, 0.677187, 0.414184, 0.666383, 0.374117, 0.657751, 0.380266, 0.639471, 0.343044, 0.632202, 0.350745, 0.607023, 0.317854, 0.601419, 0.326831, 0.570233, 0.29964, 0.566537, 0.309551, 0.530549, 0.289221, 0.528923, 0.299663, 0.489045, 0.276266, 0.446468, 0.283439, 0.405989, 0.298482, 0.369387, 0.321396, 0.338029, 0.351094, 0.313012, 0.386311, 0.295083, 0.425611, 0.285723, 0.467784, 0.283809, 0.510953, 0.289396, 0.553792, 0.303447, 0.594642, 0.324944, 0.632113, 0.35324, 0.664746, 0.38737, 0.691209, 0.426078, 0.710348, 0.467853, 0.721279, 0.510958, 0.723744, 0.553536, 0.71657, 0.594014, 0.701526, 0.630616, 0.678612, 0.661974, 0.648914, 0.686991, 0.613698, 0.704922, 0.574398, 0.714283, 0.532225, 0.716197, 0.489057, 0.710609, 0.446217, 0.696558, 0.405368, 0.675061, 0.367898, 0.646766, 0.335264, 0.612636, 0.308802, 0.573927, 0.289662, 0.532153, 0.27873, 0.443117, 0.270756, 0.488346, 0.263376, 0.400239, 0.286756, 0.361436, 0.311044, 0.328203, 0.342498, 0.30172, 0.379788, 0.282817, 0.421463, 0.272646, 0.466012, 0.270608, 0.511562, 0.276731, 0.556814, 0.291566, 0.600066, 0.314325, 0.63972, 0.344308, 0.674267, 0.380493, 0.702294, 0.421551, 0.722574, 0.465867, 0.734162, 0.511658, 0.736633, 0.556886, 0.729253, 0.599764, 0.713252, 0.638567, 0.688964, 0.6718, 0.65751, 0.698283, 0.620221, 0.717188, 0.578547, 0.727359, 0.533998, 0.729398, 0.488447, 0.723275, 0.443196, 0.708439, 0.399944, 0.685681, 0.36029, 0.655698, 0.325743, 0.619512, 0.297716, 0.578454, 0.277436, 0.534139, 0.265848, 0.487528, 0.247052, 0.438949, 0.254691, 0.392939, 0.271955, 0.351346, 0.297993, 0.315755, 0.331675, 0.287428, 0.371576, 0.267366, 0.416122, 0.256181, 0.463626, 0.253977, 0.512364, 0.260768, 0.560675, 0.276545, 0.60688, 0.300882, 0.649285, 0.33298, 0.68626, 0.371756, 0.716283, 0.41579, 0.738026, 0.463356, 0.750476, 0.512476, 0.752957, 0.561054, 0.745318, 0.607064, 0.728053, 0.648657, 0.702015, 0.684248, 0.668333, 0.712575, 0.628433, 0.732638, 0.583887, 0.743823, 0.536383, 0.746029, 0.487645, 0.739237, 0.439335, 0.72346, 0.39313, 0.699123, 0.350725, 0.667025, 0.313751, 0.62825, 0.283728, 0.584215, 0.261984, 0.536649, 0.249534, 0.449145, 0.293706, 0.489601, 0.286905, 0.451854, 0.303928, 0.490169, 0.297455, 0.410683, 0.30805, 0.41536, 0.317544, 0.375878, 0.329851, 0.382347, 0.338231, 0.346056, 0.358121, 0.354045, 0.365078, 0.32225, 0.391642, 0.331433, 0.396928, 0.305229, 0.429087, 0.315275, 0.43248, 0.296304, 0.469277, 0.306823, 0.470708, 0.294489, 0.510438, 0.305098, 0.509956, 0.310147, 0.548828, 0.299823, 0.551277, 0.322819, 0.585826, 0.313165, 0.590209, 0.342254, 0.619745, 0.333622, 0.625894, 0.367804, 0.649265, 0.360534, 0.656967, 0.392982, 0.682157, 0.398586, 0.67318, 0.429772, 0.70037, 0.433468, 0.69046, 0.469456, 0.710789, 0.471082, 0.700347, 0.510403, 0.713104, 0.509834, 0.702555, 0.548149, 0.696081, 0.550858, 0.706303, 0.584643, 0.682464, 0.58932, 0.691959, 0.617655, 0.661777, 0.624125, 0.670157, 0.645958, 0.63493, 0.653947, 0.641887, 0.677754, 0.608366, 0.668571, 0.603081, 0.694776, 0.570921, 0.68473, 0.567528, 0.703702, 0.530732, 0.693182, 0.529301, 0.705516, 0.489572, 0.694908, 0.490053, 0.700183, 0.448733, 0.689858, 0.451182, 0.686841, 0.409801, 0.677187, 0.414184, 0.666383, 0.374117, 0.657751, 0.380266, 0.639471, 0.343044, 0.632202, 0.350745, 0.607023, 0.317854, 0.601419, 0.326831, 0.570233, 0.29964, 0.566537, 0.309551, 0.530549, 0.289221, 0.528923, 0.299663, 0.446468, 0.283439, 0.489045, 0.276266, 0.405989, 0.298482, 0.369387, 0.321396, 0.338029, 0.351094, 0.313012, 0.386311, 0.295083, 0.425611, 0.285723, 0.467784, 0.283809, 0.510953, 0.289396, 0.553792, 0.303447, 0.594642, 0.324944, 0.632113, 0.35324, 0.664746, 0.38737, 0.691209, 0.426078, 0.710348, 0.467853, 0.721279, 0.510958, 0.723744, 0.553536, 0.71657, 0.594014, 0.701526, 0.630616, 0.678612, 0.661974, 0.648914, 0.686991, 0.613698, 0.704922, 0.574398, 0.714283, 0.532225, 0.716197, 0.489057, 0.710609, 0.446217, 0.696558, 0.405368, 0.675061, 0.367898, 0.646766, 0.335264, 0.612636, 0.308802, 0.573927, 0.289662, 0.532153, 0.27873, 0.443117, 0.270756, 0.488346, 0.263376, 0.400239, 0.286756, 0.361436, 0.311044, 0.328203, 0.342498, 0.30172, 0.379788, 0.282817, 0.421463, 0.272646, 0.466012, 0.270608, 0.511562, 0.276731, 0.556814, 0.291566, 0.600066, 0.314325, 0.63972, 0.344308, 0.674267, 0.380493, 0.702294, 0.421551, 0.722574, 0.465867, 0.734162, 0.511658, 0.736633, 0.556886, 0.729253, 0.599764, 0.713252, 0.638567, 0.688964, 0.6718, 0.65751, 0.698283, 0.620221, 0.717188, 0.578547, 0.727359, 0.533998, 0.729398, 0.488447, 0.723275, 0.443196, 0.708439, 0.399944, 0.685681, 0.36029, 0.655698, 0.325743, 0.619512, 0.297716, 0.578454, 0.277436, 0.534139, 0.265848, 0.438949, 0.254691, 0.487528, 0.247052, 0.392939, 0.271955, 0.351346, 0.297993, 0.315755, 0.331675, 0.287428, 0.371576, 0.267366, 0.416122, 0.256181, 0.463626, 0.253977, 0.512364, 0.260768, 0.560675, 0.276545, 0.60688, 0.300882, 0.649285, 0.33298, 0.68626, 0.371756, 0.716283, 0.41579, 0.738026, 0.463356, 0.750476, 0.512476, 0.752957, 0.561054, 0.745318, 0.607064, 0.728053, 0.648657, 0.702015, 0.684248, 0.668333, 0.712575, 0.628433, 0.732638, 0.583887, 0.743823, 0.536383, 0.746029, 0.487645, 0.739237, 0.439335, 0.72346, 0.39313, 0.699123, 0.350725, 0.667025, 0.313751, 0.62825, 0.283728, 0.584215, 0.261984, 0.536649, 0.249534
-};
-
-float mNormals[] = {
-0, -0, 1, -0.098, 0, 0.9952, -0.098, 0, 0.9952, 0, -0, 1, -0.1951, -0, 0.9808, -0.1951, -0, 0.9808, -0.2903, -0, 0.9569, -0.2903, -0, 0.9569, -0.3827, -0, 0.9239, -0.3827, -0, 0.9239, -0.4714, 0, 0.8819, -0.4714, 0, 0.8819, -0.5556, -0, 0.8315, -0.5556, -0, 0.8315, -0.6344, -0, 0.773, -0.6344, -0, 0.773, -0.7071, -0, 0.7071, -0.7071, -0, 0.7071, -0.773, -0, 0.6344, -0.773, -0, 0.6344, -0.8314, 0, 0.5556, -0.8315, 0, 0.5556, -0.8819, -0, 0.4714, -0.8819, -0, 0.4714, -0.9239, -0, 0.3827, -0.9239, -0, 0.3827, -0.9569, -0, 0.2903, -0.9569, -0, 0.2903, -0.9808, -0, 0.1951, -0.9808, -0, 0.1951, -0.9952, -0, 0.098, -0.9952, -0, 0.098, -1, -0, -0, -1, -0, -0, -1, -0, -0, -1, -0, -0, -0.9952, 0, -0.098, -0.9952, 0, -0.098, -0.9808, -0, -0.1951, -0.9808, -0, -0.1951, -0.9569, -0, -0.2903, -0.9569, -0, -0.2903, -0.9239, -0, -0.3827, -0.9239, -0, -0.3827, -0.8819, -0, -0.4714, -0.8819, -0, -0.4714, -0.8315, 0, -0.5556, -0.8315, 0, -0.5556, -0.773, -0, -0.6344, -0.773, -0, -0.6344, -0.7071, -0, -0.7071, -0.7071, -0, -0.7071, -0.6344, -0, -0.773, -0.6344, -0, -0.773, -0.5556, -0, -0.8314, -0.5556, 0, -0.8315, -0.4714, 0, -0.8819, -0.4714, 0, -0.8819, -0.3827, 0, -0.9239, -0.3827, 0, -0.9239, -0.2903, 0, -0.9569, -0.2903, 0, -0.9569, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, -0.098, -0, -0.9952, -0.098, -0, -0.9952, 0, -0, -1, 0, -0, -1, 0.098, -0, -0.9952, 0.098, -0, -0.9952, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.2903, 0, -0.9569, 0.2903, 0, -0.9569, 0.3827, 0, -0.9239, 0.3827, 0, -0.9239, 0.4714, -0, -0.8819, 0.4714, -0, -0.8819, 0.5556, -0, -0.8315, 0.5556, -0, -0.8315, 0.6344, -0, -0.773, 0.6344, -0, -0.773, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.773, 0, -0.6344, 0.773, 0, -0.6344, 0.8315, -0, -0.5556, 0.8314, -0, -0.5556, 0.8819, -0, -0.4714, 0.8819, -0, -0.4714, 0.9239, -0, -0.3827, 0.9239, -0, -0.3827, 0.9569, -0, -0.2903, 0.9569, -0, -0.2903, 0.9808, 0, -0.1951, 0.9808, 0, -0.1951, 0.9952, -0, -0.098, 0.9952, -0, -0.098, 1, -0, 0, 1, -0, 0, 0.9952, -0, 0.098, 0.9952, -0, 0.098, 0.9808, -0, 0.1951, 0.9808, -0, 0.1951, 0.9569, -0, 0.2903, 0.9569, -0, 0.2903, 0.9239, -0, 0.3827, 0.9239, -0, 0.3827, 0.8819, 0, 0.4714, 0.8819, 0, 0.4714, 0.8315, -0, 0.5556, 0.8315, -0, 0.5556, 0.773, -0, 0.6344, 0.773, -0, 0.6344, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.6344, -0, 0.773, 0.6344, -0, 0.773, 0.5556, 0, 0.8314, 0.5556, 0, 0.8315, 0.4714, -0, 0.8819, 0.4714, -0, 0.8819, 0.3827, -0, 0.9239, 0.3827, -0, 0.9239, 0.2903, -0, 0.9569, 0.2903, -0, 0.9569, 0.1951, 0, 0.9808, 0.1951, 0, 0.9808, 0.098, 0, 0.9952, 0.098, 0, 0.9952, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0, -0, -1, 0.098, -0, -0.9952, 0.098, -0, -0.9952, 0, -0, -1, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.2903, 0, -0.9569, 0.2903, 0, -0.9569, 0.3827, 0, -0.9239, 0.3827, 0, -0.9239, 0.4714, -0, -0.8819, 0.4714, -0, -0.8819, 0.5556, -0, -0.8315, 0.5556, -0, -0.8315, 0.6344, -0, -0.773, 0.6344, -0, -0.773, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.773, 0, -0.6344, 0.773, 0, -0.6344, 0.8314, -0, -0.5556, 0.8315, -0, -0.5556, 0.8819, -0, -0.4714, 0.8819, -0, -0.4714, 0.9239, -0, -0.3827, 0.9239, -0, -0.3827, 0.9569, -0, -0.2903, 0.9569, -0, -0.2903, 0.9808, 0, -0.1951, 0.9808, 0, -0.1951, 0.9952, -0, -0.098, 0.9952, -0, -0.098, 1, -0, 0, 1, -0, 0, 1, -0, 0, 0.9952, -0, 0.098, 0.9952, -0, 0.098, 1, -0, 0, 0.9808, -0, 0.1951, 0.9808, -0, 0.1951, 0.9569, -0, 0.2903, 0.9569, -0, 0.2903, 0.9239, -0, 0.3827, 0.9239, -0, 0.3827, 0.8819, 0, 0.4714, 0.8819, 0, 0.4714, 0.8314, -0, 0.5556, 0.8315, -0, 0.5556, 0.773, -0, 0.6344, 0.773, -0, 0.6344, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.6344, -0, 0.773, 0.6344, -0, 0.773, 0.5556, 0, 0.8315, 0.5556, 0, 0.8315, 0.4714, -0, 0.8819, 0.4714, -0, 0.8819, 0.3827, -0, 0.9239, 0.3827, -0, 0.9239, 0.2903, -0, 0.9569, 0.2903, -0, 0.9569, 0.1951, 0, 0.9808, 0.1951, 0, 0.9808, 0.098, 0, 0.9952, 0.098, 0, 0.9952, 0, -0, 1, 0, -0, 1, -0.098, 0, 0.9952, -0.098, 0, 0.9952, -0.1951, -0, 0.9808, -0.1951, -0, 0.9808, -0.2903, -0, 0.9569, -0.2903, -0, 0.9569, -0.3827, -0, 0.9239, -0.3827, -0, 0.9239, -0.4714, 0, 0.8819, -0.4714, 0, 0.8819, -0.5556, -0, 0.8314, -0.5556, -0, 0.8315, -0.6344, -0, 0.773, -0.6344, -0, 0.773, -0.7071, -0, 0.7071, -0.7071, -0, 0.7071, -0.773, -0, 0.6344, -0.773, -0, 0.6344, -0.8315, 0, 0.5556, -0.8315, 0, 0.5556, -0.8819, -0, 0.4714, -0.8819, -0, 0.4714, -0.9239, -0, 0.3827, -0.9239, -0, 0.3827, -0.9569, -0, 0.2903, -0.9569, -0, 0.2903, -0.9808, -0, 0.1951, -0.9808, -0, 0.1951, -0.9952, -0, 0.098, -0.9952, -0, 0.098, -1, -0, -0, -1, -0, -0, -0.9952, 0, -0.098, -0.9952, 0, -0.098, -0.9808, -0, -0.1951, -0.9808, -0, -0.1951, -0.9569, -0, -0.2903, -0.9569, -0, -0.2903, -0.9239, -0, -0.3827, -0.9239, -0, -0.3827, -0.8819, -0, -0.4714, -0.8819, -0, -0.4714, -0.8315, 0, -0.5556, -0.8315, 0, -0.5556, -0.7731, -0, -0.6343, -0.773, -0, -0.6344, -0.7071, -0, -0.7071, -0.7071, -0, -0.7071, -0.6344, -0, -0.773, -0.6344, -0, -0.773, -0.5556, 0, -0.8315, -0.5556, 0, -0.8315, -0.4714, 0, -0.8819, -0.4714, 0, -0.8819, -0.3827, 0, -0.9239, -0.3827, 0, -0.9239, -0.2903, 0, -0.9569, -0.2903, 0, -0.9569, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, -0.098, -0, -0.9952, -0.098, -0, -0.9952, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.0001, -1, 0.0002, 0.0001, -1, 0.0002, 0, -1, 0.0001, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -0.0001, -1, 0.0002, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -0.0002, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -0.0001, -1, -0.0001, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0.0001, 0, -1, 0, 0, -1, 0.0001, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.0002, -1, -0.0001, 0, -1, 0, -0.0001, -1, 0.0001, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.7601, 0.1823, -0.6237, 0.7286, 0.182, -0.6603, 0.741, -0.001, -0.6715, 0.773, 0, -0.6344, 0.8315, -0, -0.5556, 0.8175, 0.1824, -0.5463, 0.8671, 0.1822, -0.4635, 0.8671, 0.1822, -0.4635, 0.8819, -0, -0.4714, 0.9084, 0.1822, -0.3762, 0.8671, 0.1822, -0.4635, 0.9239, -0, -0.3827, 0.9409, 0.1823, -0.2854, 0.9569, -0, -0.2903, 0.9644, 0.1822, -0.1918, 0.9808, 0, -0.1951, 0.9952, -0, -0.098, 0.9785, 0.1823, -0.0964, 0.9988, -0, -0.049, 0.9815, 0.1852, -0.0482, 0.6169, 0.554, -0.5591, 0.6434, 0.5544, -0.528, 0.692, 0.5544, -0.4624, 0.8671, 0.1822, -0.4635, 0.734, 0.5544, -0.3924, 0.8671, 0.1822, -0.4635, 0.7689, 0.5544, -0.3185, 0.8671, 0.1822, -0.4635, 0.7965, 0.5543, -0.2416, 0.8163, 0.5543, -0.1624, 0.8282, 0.5545, -0.0816, 0.8316, 0.5539, -0.0408, 0.4566, 0.7875, -0.4139, 0.4761, 0.7878, -0.3908, 0.5121, 0.7878, -0.3422, 0.5432, 0.7878, -0.2903, 0.569, 0.7878, -0.2358, 0.5894, 0.7878, -0.1788, 0.6041, 0.7878, -0.1202, 0.613, 0.7878, -0.0604, 0.6156, 0.7874, -0.0303, 0.3414, 0.8875, -0.3095, 0.3521, 0.8891, -0.2924, 0.3792, 0.8891, -0.2563, 0.4019, 0.8893, -0.2183, 0.4192, 0.8911, -0.1737, 0.4385, 0.8893, -0.1298, 0.4492, 0.8892, -0.0869, 0.4559, 0.889, -0.0423, 0.6156, 0.7874, -0.0303, 0.6156, 0.7874, -0.0303, 0.4602, 0.8875, -0.0226, 0.2632, 0.9393, -0.2199, 0.2813, 0.9427, -0.1796, 0.2966, 0.9471, -0.1228, 0.3258, 0.9427, -0.0719, 0.3416, 0.9394, -0.0307, 0.1738, 0.9747, -0.1406, 0.1856, 0.9749, -0.123, 0.2056, 0.9749, -0.0852, 0.2182, 0.9749, -0.0442, 0.2224, 0.9747, -0.0235, 0.1076, 0.9904, -0.0866, 0.1148, 0.9905, -0.0758, 0.127, 0.9905, -0.0526, 0.1348, 0.9905, -0.0275, 0.1373, 0.9904, -0.0148, 0.081, 0.9946, -0.0648, 0.0862, 0.9947, -0.0569, 0.0954, 0.9947, -0.0395, 0.1012, 0.9946, -0.0208, 0.1007, 0.9948, -0.0142, -0.7823, -0.0001, 0.6229, -0.7823, -0, 0.6229, -0.8355, 0, 0.5495, -0.8355, 0, 0.5494, -0.9239, 0, 0.3826, -0.9239, -0, 0.3827, -0.9793, -0, 0.2023, -0.9793, -0, 0.2023, -0.9936, 0, 0.1126, -0.9936, 0, 0.1126, -0.6751, 0.012, -0.7376, -0.6715, -0, -0.741, -0.6749, 0.0103, -0.7379, -0.6716, -0, -0.741, 0.0442, 0.0119, 0.9989, 0.049, -0.0012, 0.9988, 0.0491, -0, 0.9988, 0.0442, 0.0119, 0.9989, 0.0443, 0.012, 0.9989, -0.6853, 0.0265, -0.7278, -0.6867, 0.0295, -0.7264, 0.028, 0.0296, 0.9992, 0.0442, 0.0119, 0.9989, 0.028, 0.0295, 0.9992, -0.6974, 0.0303, -0.7161, -0.6969, 0.0298, -0.7165, 0.0131, 0.0303, 0.9995, 0.0131, 0.0303, 0.9995, -0.7019, 0.0224, -0.712, -0.7012, 0.0219, -0.7126, 0.0073, 0.0223, 0.9997, 0.0072, 0.0223, 0.9997, -0.7044, 0.0163, -0.7096, -0.7042, 0.0162, -0.7098, 0.0036, 0.0163, 0.9999, 0.0036, 0.0163, 0.9999, -0.7058, 0.0112, -0.7083, -0.7058, 0.0111, -0.7083, 0.0017, 0.0112, 0.9999, 0.0016, 0.011, 0.9999, -0.7127, -0.0053, -0.7014, -0.7106, -0.0058, -0.7036, -0.008, -0.0053, 1, -0.008, -0.0053, 1, -0.6988, -0.0138, -0.7152, -0.6956, -0.0098, -0.7184, 0.0161, -0.0098, 0.9998, 0.0161, -0.0098, 0.9998, -0.6716, -0.0006, -0.7409, -0.6956, -0.0098, -0.7184, -0.6988, -0.0138, -0.7152, -0.6716, -0, -0.741, 0.0491, -0.0001, 0.9988, 0.0161, -0.0098, 0.9998, 0.0161, -0.0098, 0.9998, 0.0491, -0, 0.9988, 0.6156, 0.7874, -0.0303, 0.6156, 0.7874, -0.0303, 0.6156, 0.7874, -0.0303, 0.6156, 0.7874, -0.0303, 0.0964, 0.1823, -0.9785, 0.0483, 0.1821, -0.9821, 0.0491, -0.001, -0.9988, 0.098, -0, -0.9952, 0.1951, 0, -0.9808, 0.1917, 0.1823, -0.9644, 0.2854, 0.1822, -0.9409, 0.2903, 0, -0.9569, 0.3764, 0.1822, -0.9084, 0.3827, 0, -0.9239, 0.4635, 0.1822, -0.8671, 0.4635, 0.1822, -0.8671, 0.4714, -0, -0.8819, 0.5464, 0.1822, -0.8175, 0.4635, 0.1822, -0.8671, 0.5556, -0, -0.8315, 0.6344, -0, -0.773, 0.6238, 0.1822, -0.76, 0.66, 0.1852, -0.7281, 0.6715, -0.0001, -0.741, 0.0815, 0.5544, -0.8282, 0.0408, 0.5539, -0.8316, 0.1623, 0.5545, -0.8162, 0.2416, 0.5545, -0.7963, 0.3183, 0.5545, -0.7689, 0.3925, 0.5543, -0.7339, 0.4635, 0.1822, -0.8671, 0.4623, 0.5542, -0.6922, 0.4635, 0.1822, -0.8671, 0.4635, 0.1822, -0.8671, 0.528, 0.5544, -0.6434, 0.5592, 0.5537, -0.617, 0.0301, 0.7874, -0.6157, 0.0603, 0.7879, -0.6128, 0.1203, 0.7878, -0.6041, 0.1787, 0.7878, -0.5894, 0.2356, 0.7878, -0.569, 0.2356, 0.7878, -0.569, 0.2903, 0.7878, -0.5432, 0.2356, 0.7878, -0.569, 0.3421, 0.7878, -0.5122, 0.3908, 0.7878, -0.4761, 0.4139, 0.7873, -0.457, 0.0422, 0.889, -0.4559, 0.0225, 0.8875, -0.4603, 0.087, 0.8891, -0.4494, 0.1299, 0.8892, -0.4387, 0.1737, 0.8911, -0.4192, 0.2356, 0.7878, -0.569, 0.2184, 0.8892, -0.4021, 0.2356, 0.7878, -0.569, 0.2356, 0.7878, -0.569, 0.2561, 0.8893, -0.379, 0.2926, 0.889, -0.3523, 0.3096, 0.8875, -0.3414, 0.0306, 0.9394, -0.3415, 0.072, 0.9426, -0.326, 0.1228, 0.9471, -0.2966, 0.1796, 0.9427, -0.2813, 0.2201, 0.9393, -0.2632, 0.0236, 0.9747, -0.2224, 0.0443, 0.9749, -0.2182, 0.0852, 0.9749, -0.2056, 0.123, 0.9749, -0.1856, 0.1406, 0.9747, -0.1739, 0.0148, 0.9904, -0.1373, 0.0276, 0.9905, -0.1348, 0.0525, 0.9905, -0.1268, 0.0758, 0.9905, -0.1147, 0.0866, 0.9904, -0.1076, 0.0143, 0.9948, -0.1007, 0.0207, 0.9946, -0.1013, 0.0395, 0.9947, -0.0954, 0.0568, 0.9946, -0.0863, 0.0611, 0.9948, -0.0812, -0.1127, -0.0001, 0.9936, -0.1127, -0, 0.9936, -0.2023, -0, 0.9793, -0.2023, -0, 0.9793, -0.3827, -0, 0.9239, -0.3827, -0, 0.9239, -0.5494, 0, 0.8355, -0.5493, 0, 0.8356, -0.6229, 0, 0.7823, -0.623, 0, 0.7822, -0.9989, 0.012, -0.0443, -0.9988, -0, -0.0492, -0.999, 0.0103, -0.0446, -0.9988, -0, -0.0494, 0.7377, 0.012, 0.6751, 0.7409, -0.0012, 0.6717, 0.741, 0, 0.6716, 0.7377, 0.012, 0.6751, -0.9992, 0.0299, -0.0281, -0.9992, 0.0254, -0.0309, 0.7263, 0.0295, 0.6868, 0.7262, 0.0295, 0.6868, -0.9994, 0.0308, -0.0127, -0.9995, 0.0303, -0.0129, 0.7159, 0.0303, 0.6976, 0.716, 0.0303, 0.6975, -0.9997, 0.022, -0.0079, -0.9997, 0.0223, -0.007, 0.7121, 0.0224, 0.7018, 0.712, 0.0223, 0.7019, -0.9999, 0.0163, -0.0038, -0.9999, 0.0163, -0.0036, 0.7096, 0.0168, 0.7044, 0.7096, 0.0163, 0.7044, -0.9999, 0.0112, -0.0018, -0.9999, 0.011, -0.0016, 0.7083, 0.0112, 0.7058, 0.7083, 0.0111, 0.7058, -1, -0.0058, 0.0051, -1, -0.0053, 0.008, 0.7014, -0.0054, 0.7127, 0.7014, -0.0054, 0.7127, -0.9998, -0.0138, -0.0115, -0.9998, -0.0098, -0.0161, 0.7184, -0.0098, 0.6956, 0.7184, -0.0098, 0.6956, -0.9988, -0.0006, -0.0491, -0.9998, -0.0098, -0.0161, -0.9998, -0.0138, -0.0115, -0.9988, 0, -0.0491, 0.741, 0.0002, 0.6715, 0.7184, -0.0098, 0.6956, 0.7184, -0.0098, 0.6956, 0.741, 0, 0.6716, -0.6237, 0.1822, -0.7601, -0.6603, 0.182, -0.7286, -0.6715, -0.001, -0.741, -0.6344, -0, -0.773, -0.5556, 0, -0.8315, -0.5463, 0.1823, -0.8175, -0.4635, 0.1823, -0.8671, -0.4714, 0, -0.8819, -0.3762, 0.1821, -0.9085, -0.3827, 0, -0.9239, -0.2854, 0.1823, -0.9409, -0.2903, 0, -0.9569, -0.1918, 0.1822, -0.9644, -0.1951, -0, -0.9808, -0.098, -0, -0.9952, -0.0964, 0.1822, -0.9785, -0.049, -0, -0.9988, -0.0482, 0.1852, -0.9815, -0.5591, 0.554, -0.6169, -0.528, 0.5544, -0.6434, -0.4624, 0.5544, -0.692, -0.3924, 0.5544, -0.734, -0.3185, 0.5544, -0.7689, -0.2416, 0.5543, -0.7965, -0.1624, 0.5543, -0.8163, -0.0816, 0.5544, -0.8282, -0.0408, 0.5539, -0.8316, -0.4139, 0.7875, -0.4566, -0.3908, 0.7878, -0.4761, -0.3422, 0.7878, -0.5121, -0.2903, 0.7878, -0.5432, -0.2358, 0.7878, -0.569, -0.1788, 0.7878, -0.5894, -0.1202, 0.7878, -0.6041, -0.0604, 0.7878, -0.613, -0.0302, 0.7874, -0.6157, -0.3095, 0.8875, -0.3414, -0.2924, 0.8891, -0.3521, -0.2563, 0.8891, -0.3792, -0.2183, 0.8893, -0.4019, -0.1737, 0.8911, -0.4192, -0.1298, 0.8893, -0.4385, -0.0869, 0.8892, -0.4492, -0.0422, 0.889, -0.4559, -0.0226, 0.8875, -0.4602, -0.2199, 0.9393, -0.2632, -0.1796, 0.9427, -0.2813, -0.1228, 0.9471, -0.2966, -0.0719, 0.9427, -0.3258, -0.0307, 0.9394, -0.3416, -0.1406, 0.9747, -0.1738, -0.123, 0.9749, -0.1856, -0.0852, 0.9749, -0.2056, -0.0442, 0.9749, -0.2182, -0.0235, 0.9747, -0.2224, -0.0866, 0.9904, -0.1076, -0.0758, 0.9905, -0.1147, -0.0526, 0.9905, -0.127, -0.0275, 0.9905, -0.1348, -0.0148, 0.9904, -0.1373, -0.0648, 0.9946, -0.081, -0.0569, 0.9947, -0.0862, -0.0395, 0.9947, -0.0954, -0.0208, 0.9946, -0.1012, -0.0114, 0.9946, -0.1031, 0.6229, 0.0001, 0.7823, 0.6229, -0, 0.7823, 0.5495, 0, 0.8355, 0.5494, 0, 0.8355, 0.3826, 0, 0.9239, 0.3827, -0, 0.9239, 0.2023, -0, 0.9793, 0.2023, -0, 0.9793, 0.1126, 0, 0.9936, 0.1126, 0, 0.9936, -0.7377, 0.012, 0.6751, -0.741, -0, 0.6715, -0.7379, 0.0103, 0.6749, -0.7409, -0, 0.6716, 0.9989, 0.0119, -0.0442, 0.9988, -0.0012, -0.049, 0.9988, -0, -0.0491, 0.9989, 0.0119, -0.0442, 0.9989, 0.012, -0.0443, -0.7278, 0.0265, 0.6853, -0.7264, 0.0295, 0.6867, 0.9992, 0.0299, -0.0281, 0.9989, 0.0119, -0.0442, 0.9992, 0.0295, -0.028, -0.7161, 0.0303, 0.6974, -0.7165, 0.0298, 0.6969, 0.9995, 0.0303, -0.0131, 0.9995, 0.0303, -0.0131, -0.712, 0.0223, 0.7019, -0.7126, 0.0219, 0.7012, 0.9997, 0.0223, -0.0073, 0.9997, 0.0223, -0.0072, -0.7096, 0.0168, 0.7044, -0.7098, 0.0162, 0.7042, 0.9999, 0.0163, -0.0036, 0.9999, 0.0163, -0.0036, -0.7083, 0.0112, 0.7059, -0.7083, 0.0111, 0.7058, 0.9999, 0.0112, -0.0017, 0.9999, 0.0112, -0.0017, -0.7014, -0.0054, 0.7127, -0.7036, -0.0058, 0.7106, 1, -0.0053, 0.008, 1, -0.0053, 0.008, -0.7152, -0.0138, 0.6988, -0.7184, -0.0098, 0.6956, 0.9998, -0.0098, -0.0161, 0.9998, -0.0098, -0.0161, -0.7409, -0.0006, 0.6716, -0.7184, -0.0098, 0.6956, -0.7152, -0.0138, 0.6988, -0.741, 0, 0.6716, 0.9988, -0, -0.0491, 0.9998, -0.0098, -0.0161, 0.9998, -0.0098, -0.0161, 0.9988, -0, -0.0491, -0.9785, 0.1822, -0.0964, -0.9821, 0.182, -0.0483, -0.9988, -0.001, -0.0492, -0.9952, 0, -0.098, -0.9808, -0, -0.1951, -0.9644, 0.1822, -0.1919, -0.9409, 0.1823, -0.2854, -0.9569, -0, -0.2903, -0.9084, 0.1822, -0.3763, -0.9239, -0, -0.3827, -0.8671, 0.1822, -0.4635, -0.8671, 0.1822, -0.4635, -0.8819, -0, -0.4714, -0.8175, 0.1823, -0.5463, -0.8671, 0.1822, -0.4635, -0.8315, 0, -0.5556, -0.7733, 0, -0.634, -0.76, 0.1823, -0.6238, -0.7282, 0.1852, -0.6599, -0.741, -0, -0.6715, -0.8284, 0.5542, -0.0815, -0.8316, 0.5539, -0.0409, -0.8162, 0.5545, -0.1624, -0.7963, 0.5545, -0.2416, -0.7689, 0.5544, -0.3186, -0.734, 0.5544, -0.3924, -0.8671, 0.1822, -0.4635, -0.692, 0.5544, -0.4624, -0.8671, 0.1822, -0.4635, -0.8671, 0.1822, -0.4635, -0.6434, 0.5545, -0.5278, -0.6168, 0.5539, -0.5592, -0.6155, 0.7875, -0.0302, -0.613, 0.7878, -0.0603, -0.6041, 0.7878, -0.1203, -0.5895, 0.7877, -0.1788, -0.569, 0.7878, -0.2358, -0.5432, 0.7878, -0.2903, -0.5122, 0.7878, -0.342, -0.4759, 0.7879, -0.3907, -0.4568, 0.7874, -0.4139, -0.4604, 0.8874, -0.0225, -0.4559, 0.889, -0.0423, -0.4492, 0.8892, -0.087, -0.4385, 0.8893, -0.1298, -0.419, 0.8912, -0.1738, -0.4017, 0.8894, -0.2183, -0.3792, 0.8891, -0.2562, -0.3521, 0.8891, -0.2924, -0.3416, 0.8874, -0.3096, -0.3416, 0.9394, -0.0305, -0.326, 0.9426, -0.072, -0.2968, 0.947, -0.123, -0.2811, 0.9427, -0.1796, -0.2634, 0.9393, -0.2197, -0.2222, 0.9747, -0.0235, -0.2182, 0.9749, -0.0443, -0.2056, 0.9749, -0.0852, -0.1854, 0.9749, -0.123, -0.1738, 0.9747, -0.1407, -0.1373, 0.9904, -0.0149, -0.1348, 0.9905, -0.0276, -0.127, 0.9905, -0.0525, -0.1147, 0.9905, -0.0759, -0.1077, 0.9904, -0.0866, -0.1031, 0.9946, -0.0114, -0.1012, 0.9947, -0.0208, -0.0952, 0.9947, -0.0395, -0.0863, 0.9946, -0.0569, -0.0813, 0.9948, -0.0611, 0.9936, 0, 0.1127, 0.9936, 0, 0.1127, 0.9793, -0, 0.2023, 0.9793, -0, 0.2023, 0.9239, -0, 0.3827, 0.9239, -0, 0.3827, 0.8355, 0, 0.5494, 0.8356, 0, 0.5493, 0.7823, 0, 0.6229, 0.7823, 0, 0.6229, -0.0442, 0.0119, 0.9989, -0.0488, -0.0001, 0.9988, -0.0446, 0.0103, 0.999, -0.0442, 0.0119, 0.9989, -0.0494, -0, 0.9988, 0.6751, 0.012, -0.7376, 0.6715, -0.0012, -0.741, 0.6716, 0, -0.741, 0.6751, 0.012, -0.7377, -0.0282, 0.0295, 0.9992, -0.0442, 0.0119, 0.9989, -0.0309, 0.0254, 0.9992, 0.6867, 0.0295, -0.7264, 0.6867, 0.0295, -0.7263, -0.0127, 0.0307, 0.9994, -0.0134, 0.0303, 0.9995, 0.6974, 0.0303, -0.7161, 0.6974, 0.0303, -0.716, -0.0079, 0.022, 0.9997, -0.0072, 0.0223, 0.9997, 0.7018, 0.0224, -0.7121, 0.7017, 0.0223, -0.7121, -0.0038, 0.0163, 0.9999, -0.0036, 0.0163, 0.9999, 0.7045, 0.0165, -0.7095, 0.7044, 0.0163, -0.7096, -0.0018, 0.0111, 0.9999, -0.0018, 0.0111, 0.9999, 0.7059, 0.0112, -0.7083, 0.7059, 0.0112, -0.7083, 0.0051, -0.0057, 1, 0.008, -0.0053, 1, 0.7127, -0.0054, -0.7014, 0.7128, -0.0053, -0.7014, -0.0115, -0.0138, 0.9998, -0.0161, -0.0098, 0.9998, 0.6956, -0.0098, -0.7184, 0.6956, -0.0099, -0.7183, -0.049, -0.0006, 0.9988, -0.0161, -0.0098, 0.9998, -0.0115, -0.0138, 0.9998, -0.0491, 0, 0.9988, 0.6715, 0.0003, -0.741, 0.6956, -0.0099, -0.7183, 0.6956, -0.0098, -0.7184, 0.6716, 0, -0.741, -0.7601, 0.1823, 0.6237, -0.7286, 0.182, 0.6603, -0.741, -0.001, 0.6715, -0.773, -0, 0.6344, -0.8315, 0, 0.5556, -0.8175, 0.1823, 0.5463, -0.8671, 0.1822, 0.4635, -0.8671, 0.1822, 0.4635, -0.8819, -0, 0.4714, -0.9084, 0.1822, 0.3762, -0.8671, 0.1822, 0.4635, -0.9239, -0, 0.3827, -0.9409, 0.1823, 0.2854, -0.9569, -0, 0.2903, -0.9644, 0.1822, 0.1918, -0.9808, -0, 0.1951, -0.9952, -0, 0.098, -0.9785, 0.1823, 0.0964, -0.9988, 0, 0.049, -0.9815, 0.1852, 0.0482, -0.6169, 0.554, 0.5591, -0.6434, 0.5544, 0.528, -0.692, 0.5544, 0.4624, -0.8671, 0.1822, 0.4635, -0.734, 0.5544, 0.3924, -0.8671, 0.1822, 0.4635, -0.7689, 0.5544, 0.3185, -0.8671, 0.1822, 0.4635, -0.7965, 0.5543, 0.2416, -0.8163, 0.5543, 0.1624, -0.8282, 0.5545, 0.0816, -0.8316, 0.5539, 0.0408, -0.4566, 0.7875, 0.4139, -0.4761, 0.7878, 0.3908, -0.5121, 0.7878, 0.3422, -0.5432, 0.7878, 0.2903, -0.569, 0.7878, 0.2358, -0.5894, 0.7878, 0.1788, -0.6041, 0.7878, 0.1202, -0.613, 0.7878, 0.0604, -0.6156, 0.7874, 0.0303, -0.3414, 0.8875, 0.3095, -0.3521, 0.8891, 0.2924, -0.3792, 0.8891, 0.2563, -0.4019, 0.8893, 0.2183, -0.4193, 0.8911, 0.1737, -0.4385, 0.8893, 0.1298, -0.4492, 0.8892, 0.0869, -0.4559, 0.889, 0.0422, -0.6156, 0.7874, 0.0303, -0.4602, 0.8875, 0.0226, -0.6156, 0.7874, 0.0303, -0.2632, 0.9393, 0.2199, -0.2813, 0.9427, 0.1796, -0.2966, 0.9471, 0.1228, -0.3258, 0.9427, 0.0719, -0.3416, 0.9394, 0.0307, -0.1739, 0.9747, 0.1406, -0.1855, 0.9749, 0.123, -0.2056, 0.9749, 0.0852, -0.2182, 0.9749, 0.0442, -0.2224, 0.9747, 0.0235, -0.1076, 0.9904, 0.0866, -0.1147, 0.9905, 0.0758, -0.127, 0.9905, 0.0526, -0.1348, 0.9905, 0.0275, -0.1373, 0.9904, 0.0148, -0.0813, 0.9948, 0.0611, -0.0862, 0.9947, 0.0568, -0.0954, 0.9947, 0.0395, -0.1012, 0.9946, 0.0208, -0.1031, 0.9946, 0.0114, 0.7823, -0.0001, -0.6229, 0.7823, -0, -0.6229, 0.8355, 0, -0.5495, 0.8355, 0, -0.5494, 0.9239, 0, -0.3826, 0.9239, -0, -0.3827, 0.9793, -0, -0.2023, 0.9793, -0, -0.2023, 0.9936, 0, -0.1126, 0.9936, 0, -0.1126, 0.6751, 0.012, 0.7376, 0.6715, 0, 0.741, 0.6749, 0.0103, 0.7379, 0.6716, 0, 0.741, -0.0442, 0.0119, -0.9989, -0.049, -0.0012, -0.9988, -0.0491, -0, -0.9988, -0.0442, 0.0119, -0.9989, -0.0443, 0.012, -0.9989, 0.6853, 0.0265, 0.7278, 0.6867, 0.0295, 0.7264, -0.0281, 0.0299, -0.9992, -0.0442, 0.0119, -0.9989, -0.028, 0.0295, -0.9992, 0.6974, 0.0303, 0.7161, 0.6969, 0.0298, 0.7165, -0.0131, 0.0303, -0.9995, -0.0131, 0.0303, -0.9995, 0.7019, 0.0224, 0.712, 0.7012, 0.0219, 0.7126, -0.0073, 0.0223, -0.9997, -0.0072, 0.0223, -0.9997, 0.7044, 0.0163, 0.7096, 0.7042, 0.0162, 0.7098, -0.0036, 0.0163, -0.9999, -0.0036, 0.0163, -0.9999, 0.7058, 0.0112, 0.7083, 0.7058, 0.0111, 0.7083, -0.0017, 0.0112, -0.9999, -0.0017, 0.0112, -0.9999, 0.7127, -0.0054, 0.7014, 0.7106, -0.0058, 0.7036, 0.008, -0.0053, -1, 0.008, -0.0053, -1, 0.6988, -0.0138, 0.7152, 0.6956, -0.0098, 0.7184, -0.0161, -0.0098, -0.9998, -0.0161, -0.0098, -0.9998, 0.6716, -0.0006, 0.7409, 0.6956, -0.0098, 0.7184, 0.6988, -0.0138, 0.7152, 0.6716, 0, 0.741, -0.0491, -0, -0.9988, -0.0161, -0.0098, -0.9998, -0.0161, -0.0098, -0.9998, -0.0491, -0, -0.9988, -0.6156, 0.7874, 0.0303, -0.6156, 0.7874, 0.0303, -0.6156, 0.7874, 0.0303, -0.6156, 0.7874, 0.0303, -0.0965, 0.1823, 0.9785, -0.0483, 0.182, 0.9821, -0.049, -0.001, 0.9988, -0.098, 0, 0.9952, -0.1951, -0, 0.9808, -0.1919, 0.1822, 0.9644, -0.2853, 0.1824, 0.9409, -0.2903, -0, 0.9569, -0.3763, 0.1822, 0.9084, -0.3827, -0, 0.9239, -0.4634, 0.1823, 0.8672, -0.4714, 0, 0.8819, -0.5464, 0.1822, 0.8175, -0.5556, -0, 0.8315, -0.6344, -0, 0.773, -0.6238, 0.1822, 0.76, -0.6599, 0.1852, 0.7282, -0.6715, 0.0001, 0.741, -0.0815, 0.5545, 0.8282, -0.0409, 0.5539, 0.8316, -0.1623, 0.5543, 0.8163, -0.2416, 0.5543, 0.7965, -0.3184, 0.5545, 0.7689, -0.3923, 0.5542, 0.7341, -0.4624, 0.5544, 0.692, -0.528, 0.5546, 0.6432, -0.5592, 0.5539, 0.6168, -0.0303, 0.7875, 0.6155, -0.0604, 0.7878, 0.613, -0.1203, 0.7878, 0.6041, -0.1789, 0.7878, 0.5894, -0.2356, 0.7879, 0.569, -0.2903, 0.7878, 0.5432, -0.3422, 0.7879, 0.5119, -0.3908, 0.7877, 0.4762, -0.4141, 0.7873, 0.4568, -0.0225, 0.8874, 0.4605, -0.0423, 0.889, 0.4559, -0.087, 0.8891, 0.4494, -0.1298, 0.8893, 0.4385, -0.1737, 0.8911, 0.4193, -0.2183, 0.8892, 0.4021, -0.2561, 0.8893, 0.379, -0.2926, 0.889, 0.3521, -0.3094, 0.8875, 0.3414, -0.0306, 0.9394, 0.3416, -0.0719, 0.9427, 0.3258, -0.1229, 0.9471, 0.2964, -0.1794, 0.9427, 0.2812, -0.2197, 0.9394, 0.2632, -0.0236, 0.9747, 0.2222, -0.0443, 0.9749, 0.2182, -0.0851, 0.975, 0.2054, -0.123, 0.9749, 0.1856, -0.1407, 0.9747, 0.1738, -0.0149, 0.9904, 0.1373, -0.0275, 0.9905, 0.1347, -0.0527, 0.9905, 0.1271, -0.076, 0.9905, 0.1147, -0.0866, 0.9904, 0.1076, -0.0113, 0.9946, 0.103, -0.0207, 0.9946, 0.1013, -0.0396, 0.9947, 0.0953, -0.0569, 0.9946, 0.0863, -0.0648, 0.9946, 0.081, 0.1127, -0.0003, -0.9936, 0.1127, -0, -0.9936, 0.2023, -0, -0.9793, 0.2023, -0, -0.9793, 0.3827, 0, -0.9239, 0.3827, 0, -0.9239, 0.5494, 0, -0.8355, 0.5493, 0, -0.8356, 0.6229, 0, -0.7823, 0.6229, 0, -0.7823, 0.9989, 0.0119, 0.0442, 0.9988, 0, 0.0488, 0.999, 0.0103, 0.0446, 0.9989, 0.0119, 0.0442, 0.9988, -0, 0.0495, -0.7377, 0.012, -0.6751, -0.7408, -0.0012, -0.6717, -0.741, 0, -0.6716, -0.7378, 0.012, -0.6749, 0.9992, 0.0296, 0.028, 0.9989, 0.0119, 0.0442, 0.9992, 0.0253, 0.0308, -0.7264, 0.0295, -0.6867, -0.7263, 0.0295, -0.6867, 0.9994, 0.0307, 0.0127, 0.9995, 0.0303, 0.0132, -0.7161, 0.0303, -0.6974, -0.716, 0.0303, -0.6974, 0.9997, 0.0219, 0.0079, 0.9997, 0.0223, 0.0072, -0.7121, 0.0224, -0.7018, -0.7121, 0.0223, -0.7017, 0.9999, 0.0163, 0.0038, 0.9999, 0.0163, 0.0034, -0.7095, 0.0163, -0.7045, -0.7095, 0.0163, -0.7045, 0.9999, 0.0112, 0.0018, 0.9999, 0.0111, 0.0019, -0.7083, 0.0112, -0.7059, -0.7083, 0.0111, -0.7058, 1, -0.0057, -0.0051, 1, -0.0054, -0.008, -0.7014, -0.0054, -0.7127, -0.7014, -0.0054, -0.7127, 0.9998, -0.0138, 0.0115, 0.9998, -0.0098, 0.0161, -0.7184, -0.0098, -0.6955, -0.7183, -0.0099, -0.6956, 0.9988, -0.0006, 0.049, 0.9998, -0.0098, 0.0161, 0.9998, -0.0138, 0.0115, 0.9988, 0, 0.0491, -0.741, -0, -0.6715, -0.7183, -0.0099, -0.6956, -0.7184, -0.0098, -0.6955, -0.741, 0, -0.6716, 0.6237, 0.1823, 0.7601, 0.6603, 0.182, 0.7286, 0.6715, -0.001, 0.741, 0.6344, -0, 0.773, 0.5556, 0, 0.8315, 0.5463, 0.1823, 0.8175, 0.4635, 0.1822, 0.8671, 0.4635, 0.1822, 0.8671, 0.4714, -0, 0.8819, 0.3762, 0.1822, 0.9084, 0.4635, 0.1822, 0.8671, 0.3827, -0, 0.9239, 0.2854, 0.1823, 0.9409, 0.2903, -0, 0.9569, 0.1918, 0.1822, 0.9644, 0.1951, 0, 0.9808, 0.098, 0, 0.9952, 0.0964, 0.1823, 0.9785, 0.049, -0, 0.9988, 0.0482, 0.1852, 0.9815, 0.5591, 0.554, 0.6169, 0.528, 0.5544, 0.6434, 0.4624, 0.5544, 0.692, 0.4635, 0.1822, 0.8671, 0.3924, 0.5544, 0.734, 0.4635, 0.1822, 0.8671, 0.3185, 0.5544, 0.7689, 0.4635, 0.1822, 0.8671, 0.2416, 0.5543, 0.7965, 0.1624, 0.5543, 0.8163, 0.0816, 0.5545, 0.8282, 0.0408, 0.5539, 0.8316, 0.4139, 0.7875, 0.4566, 0.3908, 0.7878, 0.4761, 0.3422, 0.7878, 0.5121, 0.2903, 0.7878, 0.5432, 0.2358, 0.7878, 0.569, 0.1788, 0.7878, 0.5894, 0.1202, 0.7878, 0.6041, 0.0604, 0.7878, 0.613, 0.0303, 0.7874, 0.6157, 0.3095, 0.8875, 0.3414, 0.2924, 0.8891, 0.3521, 0.2563, 0.8891, 0.3792, 0.2183, 0.8893, 0.4019, 0.1737, 0.8911, 0.4193, 0.1298, 0.8893, 0.4385, 0.0869, 0.8892, 0.4492, 0.0422, 0.889, 0.4559, 0.0226, 0.8875, 0.4602, 0.2199, 0.9393, 0.2632, 0.1796, 0.9427, 0.2813, 0.1228, 0.9471, 0.2966, 0.0719, 0.9427, 0.3258, 0.0307, 0.9394, 0.3416, 0.1406, 0.9747, 0.1739, 0.123, 0.9749, 0.1856, 0.0852, 0.9749, 0.2056, 0.0442, 0.9749, 0.2182, 0.0235, 0.9747, 0.2224, 0.0866, 0.9904, 0.1076, 0.0758, 0.9905, 0.1148, 0.0526, 0.9905, 0.127, 0.0275, 0.9905, 0.1348, 0.0148, 0.9904, 0.1373, 0.0611, 0.9948, 0.0813, 0.0569, 0.9947, 0.0862, 0.0395, 0.9947, 0.0954, 0.0208, 0.9946, 0.1012, 0.0142, 0.9948, 0.1007, -0.6229, 0, -0.7823, -0.6229, 0, -0.7823, -0.5495, 0, -0.8355, -0.5494, 0, -0.8355, -0.3826, -0, -0.9239, -0.3827, 0, -0.9239, -0.2023, -0, -0.9793, -0.2023, -0, -0.9793, -0.1126, 0, -0.9936, -0.1126, 0, -0.9936, 0.7377, 0.012, -0.6751, 0.741, 0, -0.6715, 0.7379, 0.0103, -0.6749, 0.741, 0, -0.6716, -0.9989, 0.0119, 0.0442, -0.9988, -0.0012, 0.049, -0.9988, -0, 0.0491, -0.9989, 0.0119, 0.0442, -0.9989, 0.012, 0.0443, 0.7278, 0.0265, -0.6853, 0.7264, 0.0295, -0.6867, -0.9992, 0.0299, 0.0281, -0.9989, 0.0119, 0.0442, -0.9992, 0.0295, 0.028, 0.7161, 0.0303, -0.6974, 0.7165, 0.0298, -0.6969, -0.9995, 0.0303, 0.0131, -0.9995, 0.0303, 0.0132, 0.712, 0.0223, -0.7019, 0.7126, 0.0219, -0.7012, -0.9997, 0.0223, 0.0073, -0.9997, 0.0223, 0.0072, 0.7096, 0.0163, -0.7044, 0.7098, 0.0162, -0.7042, -0.9999, 0.0163, 0.0036, -0.9999, 0.0163, 0.0036, 0.7083, 0.0112, -0.7058, 0.7083, 0.0111, -0.7058, -0.9999, 0.0112, 0.0017, -0.9999, 0.0112, 0.0017, 0.7014, -0.0054, -0.7127, 0.7036, -0.0058, -0.7106, -1, -0.0053, -0.008, -1, -0.0053, -0.008, 0.7152, -0.0138, -0.6988, 0.7184, -0.0098, -0.6956, -0.9998, -0.0098, 0.0161, -0.9998, -0.0098, 0.0161, 0.7409, -0.0006, -0.6716, 0.7184, -0.0098, -0.6956, 0.7152, -0.0138, -0.6988, 0.741, 0, -0.6716, -0.9988, -0, 0.0491, -0.9998, -0.0098, 0.0161, -0.9998, -0.0098, 0.0161, -0.9988, -0, 0.0491, 0.9785, 0.1822, 0.0964, 0.9821, 0.182, 0.0482, 0.9988, -0.001, 0.049, 0.9952, -0, 0.098, 0.9808, -0, 0.1951, 0.9644, 0.1823, 0.1917, 0.9409, 0.1822, 0.2854, 0.9569, -0, 0.2903, 0.9084, 0.1822, 0.3764, 0.9239, -0, 0.3827, 0.8672, 0.1823, 0.4634, 0.8819, 0, 0.4714, 0.8175, 0.1822, 0.5463, 0.8315, -0, 0.5556, 0.773, -0, 0.6344, 0.76, 0.1822, 0.6238, 0.7282, 0.1852, 0.6599, 0.7409, 0.0001, 0.6716, 0.8282, 0.5544, 0.0815, 0.8316, 0.5539, 0.0408, 0.8164, 0.5543, 0.1623, 0.7963, 0.5545, 0.2416, 0.7689, 0.5545, 0.3184, 0.7341, 0.5542, 0.3923, 0.6922, 0.5542, 0.4623, 0.6432, 0.5546, 0.528, 0.6168, 0.5539, 0.5592, 0.6155, 0.7876, 0.0301, 0.613, 0.7878, 0.0604, 0.6043, 0.7877, 0.12, 0.5894, 0.7878, 0.1788, 0.5688, 0.788, 0.2356, 0.5432, 0.7878, 0.2903, 0.5122, 0.7878, 0.3421, 0.4762, 0.7877, 0.3908, 0.4568, 0.7874, 0.4139, 0.4605, 0.8874, 0.0224, 0.4559, 0.889, 0.0422, 0.4494, 0.8891, 0.087, 0.4385, 0.8893, 0.1299, 0.4194, 0.891, 0.1736, 0.4019, 0.8893, 0.2182, 0.3792, 0.8891, 0.2562, 0.3521, 0.8891, 0.2924, 0.3414, 0.8875, 0.3094, 0.3416, 0.9394, 0.0306, 0.326, 0.9426, 0.072, 0.2964, 0.9471, 0.1228, 0.2813, 0.9427, 0.1794, 0.2632, 0.9393, 0.2199, 0.2222, 0.9747, 0.0236, 0.2182, 0.9749, 0.0443, 0.2056, 0.9749, 0.0851, 0.1855, 0.9749, 0.123, 0.1738, 0.9747, 0.1407, 0.1372, 0.9904, 0.0148, 0.1348, 0.9905, 0.0276, 0.1271, 0.9905, 0.0527, 0.1148, 0.9905, 0.0758, 0.1076, 0.9904, 0.0866, 0.103, 0.9946, 0.0113, 0.1013, 0.9946, 0.0207, 0.0954, 0.9947, 0.0395, 0.0862, 0.9947, 0.0568, 0.0811, 0.9946, 0.0648, -0.9936, -0.0001, -0.1127, -0.9936, -0, -0.1127, -0.9793, -0, -0.2023, -0.9793, -0, -0.2023, -0.9239, -0, -0.3827, -0.9239, -0, -0.3827, -0.8355, 0, -0.5494, -0.8356, 0, -0.5493, -0.7823, 0, -0.6229, -0.7823, 0, -0.6229, 0.0441, 0.012, -0.999, 0.049, -0, -0.9988, 0.0443, 0.0103, -0.999, 0.0495, -0, -0.9988, -0.6751, 0.012, 0.7376, -0.6717, -0.0012, 0.7409, -0.6716, 0, 0.741, -0.6751, 0.012, 0.7377, 0.028, 0.0296, -0.9992, 0.0308, 0.0253, -0.9992, -0.6867, 0.0295, 0.7264, -0.6867, 0.0295, 0.7263, 0.0127, 0.0308, -0.9994, 0.0132, 0.0303, -0.9995, -0.6974, 0.0303, 0.7161, -0.6974, 0.0303, 0.716, 0.0079, 0.0219, -0.9997, 0.0072, 0.0223, -0.9997, -0.7019, 0.0223, 0.712, -0.7019, 0.0223, 0.712, 0.0038, 0.0163, -0.9999, 0.0034, 0.0163, -0.9999, -0.7044, 0.0168, 0.7096, -0.7044, 0.0163, 0.7096, 0.0018, 0.0112, -0.9999, 0.0017, 0.011, -0.9999, -0.7058, 0.0112, 0.7083, -0.7059, 0.0112, 0.7083, -0.0051, -0.0058, -1, -0.008, -0.0053, -1, -0.7127, -0.0053, 0.7014, -0.7127, -0.0054, 0.7014, 0.0115, -0.0138, -0.9998, 0.0161, -0.0098, -0.9998, -0.6956, -0.0098, 0.7184, -0.6956, -0.0098, 0.7184, 0.049, -0.0006, -0.9988, 0.0161, -0.0098, -0.9998, 0.0115, -0.0138, -0.9998, 0.0491, 0, -0.9988, -0.6715, -0, 0.741, -0.6956, -0.0098, 0.7184, -0.6956, -0.0098, 0.7184, -0.6716, 0, 0.741, -0.0001, -0, 1, 0, -0, 1, -0.1951, -0, 0.9808, -0.1951, -0, 0.9808, -0.3826, 0, 0.9239, -0.3827, -0, 0.9239, -0.5556, -0, 0.8315, -0.5556, -0, 0.8315, -0.7071, -0, 0.7071, -0.7071, -0, 0.7071, -0.8315, 0, 0.5555, -0.8315, 0, 0.5556, -0.9239, 0, 0.3826, -0.9239, -0, 0.3827, -0.9808, -0, 0.1951, -0.9808, -0, 0.1951, -1, -0, -0, -1, -0, -0, -1, -0, -0, -1, -0, -0, -0.9808, -0, -0.1951, -0.9808, -0, -0.1951, -0.9239, 0, -0.3826, -0.9239, -0, -0.3827, -0.8315, 0, -0.5556, -0.8315, 0, -0.5556, -0.7071, -0, -0.7071, -0.7071, -0, -0.7071, -0.5556, 0, -0.8315, -0.5555, 0, -0.8315, -0.3827, 0, -0.9239, -0.3826, -0, -0.9239, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, 0, -0, -1, 0, -0, -1, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.3827, 0, -0.9239, 0.3826, 0, -0.9239, 0.5556, -0, -0.8315, 0.5556, -0, -0.8315, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.8315, 0, -0.5555, 0.8315, -0, -0.5556, 0.9239, 0, -0.3826, 0.9239, -0, -0.3827, 0.9808, 0, -0.1951, 0.9808, 0, -0.1951, 1, -0, 0, 1, -0, 0, 0.9808, -0, 0.1951, 0.9808, -0, 0.1951, 0.9239, -0, 0.3827, 0.9239, -0, 0.3827, 0.8315, -0, 0.5556, 0.8315, -0, 0.5556, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.5555, 0, 0.8315, 0.5556, 0, 0.8315, 0.3827, -0, 0.9239, 0.3827, -0, 0.9239, 0.1951, 0, 0.9808, 0.1951, 0, 0.9808, -0.0903, -0.8863, 0.4541, 0, -0.8864, 0.463, 0, -0.8864, 0.463, -0.0903, -0.8863, 0.4541, -0.0903, -0.8864, 0.4541, -0.1772, -0.8863, 0.4278, -0.0903, -0.8863, 0.4541, -0.1772, -0.8863, 0.4278, -0.2573, -0.8863, 0.385, -0.2572, -0.8864, 0.385, -0.3273, -0.8864, 0.3274, -0.3274, -0.8863, 0.3274, -0.385, -0.8864, 0.2572, -0.3849, -0.8863, 0.2574, -0.4278, -0.8863, 0.1772, -0.4278, -0.8863, 0.1772, -0.4541, -0.8863, 0.0904, -0.4541, -0.8864, 0.0903, -0.463, -0.8863, 0, -0.463, -0.8863, 0, -0.463, -0.8864, 0, -0.4541, -0.8864, -0.0903, -0.463, -0.8863, 0, -0.4541, -0.8863, -0.0904, -0.463, -0.8863, 0, -0.463, -0.8864, 0, -0.4278, -0.8863, -0.1772, -0.4278, -0.8863, -0.1772, -0.385, -0.8864, -0.2572, -0.385, -0.8863, -0.2573, -0.3274, -0.8863, -0.3274, -0.3274, -0.8864, -0.3274, -0.2573, -0.8863, -0.385, -0.2572, -0.8864, -0.385, -0.1772, -0.8863, -0.4278, -0.1771, -0.8863, -0.4278, -0.0903, -0.8864, -0.4541, -0.0903, -0.8863, -0.4542, -0, -0.8864, -0.463, -0.0001, -0.8864, -0.463, 0.0903, -0.8864, -0.4541, 0.0904, -0.8863, -0.4541, 0.1772, -0.8863, -0.4278, 0.1771, -0.8863, -0.4278, 0.2572, -0.8864, -0.385, 0.2573, -0.8863, -0.385, 0.3274, -0.8864, -0.3274, 0.3274, -0.8863, -0.3274, 0.385, -0.8864, -0.2572, 0.385, -0.8863, -0.2573, 0.4278, -0.8863, -0.1772, 0.4278, -0.8863, -0.1772, 0.4541, -0.8863, -0.0903, 0.4542, -0.8863, -0.0903, 0.463, -0.8864, 0.0001, 0.463, -0.8864, -0, 0.4541, -0.8863, -0.0903, 0.4541, -0.8863, 0.0904, 0.4542, -0.8863, 0.0903, 0.4278, -0.8863, 0.1772, 0.4278, -0.8863, 0.1772, 0.385, -0.8863, 0.2573, 0.385, -0.8864, 0.2572, 0.3274, -0.8864, 0.3274, 0.3274, -0.8863, 0.3274, 0.2572, -0.8864, 0.385, 0.2573, -0.8863, 0.385, 0.1772, -0.8863, 0.4278, 0.1772, -0.8863, 0.4278, 0.0904, -0.8863, 0.4541, 0.0903, -0.8864, 0.4541, -0.1951, -0, 0.9808, 0, -0, 1, 0, -0, 1, -0.1951, -0, 0.9808, -0.3826, 0, 0.9239, -0.3827, -0, 0.9239, -0.5556, -0, 0.8315, -0.5556, -0, 0.8315, -0.7071, -0, 0.7071, -0.7071, -0, 0.7071, -0.8315, 0, 0.5556, -0.8315, 0, 0.5556, -0.9239, -0, 0.3827, -0.9239, -0, 0.3827, -0.9808, -0, 0.1951, -0.9808, -0, 0.1951, -1, -0, -0, -1, -0, -0, -1, -0, -0, -0.9808, -0, -0.1951, -0.9808, -0, -0.1951, -1, -0, -0, -0.9239, 0, -0.3826, -0.9239, -0, -0.3827, -0.8315, 0, -0.5556, -0.8315, 0, -0.5556, -0.7071, -0, -0.7071, -0.7071, -0, -0.7071, -0.5556, 0, -0.8315, -0.5556, 0, -0.8315, -0.3827, 0, -0.9239, -0.3827, 0, -0.9239, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, 0, -0, -1, 0, -0, -1, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.3826, 0, -0.9239, 0.3827, 0, -0.9239, 0.5556, -0, -0.8315, 0.5556, -0, -0.8315, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.8315, -0, -0.5556, 0.8315, -0, -0.5556, 0.9239, -0, -0.3827, 0.9239, -0, -0.3827, 0.9808, 0, -0.1951, 0.9808, 0, -0.1951, 1, -0, 0, 1, -0, 0, 0.9808, -0, 0.1951, 0.9808, -0, 0.1951, 0.9239, 0, 0.3826, 0.9239, -0, 0.3827, 0.8315, -0, 0.5556, 0.8315, -0, 0.5556, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.5556, 0, 0.8315, 0.5556, 0, 0.8315, 0.3827, -0, 0.9239, 0.3827, -0, 0.9239, 0.1951, 0, 0.9808, 0.1951, 0, 0.9808, 0, 0.7704, 0.6376, 0, 0.7704, 0.6376, -0.1244, 0.7704, 0.6253, -0.1244, 0.7704, 0.6253, -0.244, 0.7704, 0.5891, -0.244, 0.7704, 0.5891, -0.3542, 0.7704, 0.5301, -0.3542, 0.7704, 0.5301, -0.4508, 0.7704, 0.4508, -0.4508, 0.7704, 0.4508, -0.5301, 0.7704, 0.3542, -0.5301, 0.7704, 0.3542, -0.5891, 0.7704, 0.244, -0.5891, 0.7704, 0.244, -0.6253, 0.7704, 0.1244, -0.6253, 0.7704, 0.1244, -0.6376, 0.7703, 0, -0.6376, 0.7703, 0, -0.6376, 0.7704, 0, -0.6376, 0.7703, 0, -0.6253, 0.7704, -0.1244, -0.6376, 0.7704, 0, -0.6376, 0.7703, 0, -0.6253, 0.7704, -0.1244, -0.5891, 0.7704, -0.244, -0.5891, 0.7704, -0.244, -0.5302, 0.7704, -0.3542, -0.5301, 0.7704, -0.3542, -0.4508, 0.7704, -0.4508, -0.4508, 0.7704, -0.4508, -0.3542, 0.7704, -0.5301, -0.3542, 0.7704, -0.5301, -0.244, 0.7704, -0.5891, -0.244, 0.7704, -0.5891, -0.1244, 0.7704, -0.6253, -0.1244, 0.7704, -0.6253, 0, 0.7704, -0.6376, 0, 0.7704, -0.6376, 0.1244, 0.7704, -0.6253, 0.1244, 0.7704, -0.6253, 0.244, 0.7704, -0.5891, 0.244, 0.7704, -0.5891, 0.3542, 0.7704, -0.5302, 0.3542, 0.7704, -0.5301, 0.4508, 0.7704, -0.4508, 0.4508, 0.7704, -0.4508, 0.5302, 0.7704, -0.3542, 0.5301, 0.7704, -0.3542, 0.5891, 0.7704, -0.244, 0.5891, 0.7704, -0.244, 0.6253, 0.7704, -0.1244, 0.6253, 0.7704, -0.1244, 0.6376, 0.7703, -0, 0.6376, 0.7704, -0, 0.6376, 0.7703, -0, 0.6253, 0.7704, 0.1244, 0.6376, 0.7703, -0, 0.6253, 0.7704, 0.1244, 0.6376, 0.7703, -0, 0.5891, 0.7704, 0.244, 0.5891, 0.7704, 0.244, 0.5301, 0.7704, 0.3542, 0.5301, 0.7704, 0.3542, 0.4508, 0.7704, 0.4508, 0.4508, 0.7704, 0.4508, 0.3542, 0.7704, 0.5302, 0.3542, 0.7704, 0.5301, 0.244, 0.7704, 0.5891, 0.244, 0.7704, 0.5891, 0.1244, 0.7704, 0.6253, 0.1244, 0.7704, 0.6253, -0.0903, -0.8863, 0.4541, -0.0903, -0.8863, 0.4541, -0.0903, -0.8863, 0.4541, -0.463, -0.8863, 0, -0.463, -0.8863, 0, -0.463, -0.8863, 0, -0.463, -0.8863, 0, 0.4541, -0.8863, -0.0903, 0.4541, -0.8863, -0.0903, 0.4541, -0.8863, -0.0903, -0.6376, 0.7703, 0, -0.6376, 0.7703, 0, 0.6376, 0.7703, -0, 0.6376, 0.7703, -0, -0.098, 0, 0.9952, 0, -0, 1, 0, -0, 1, -0.098, 0, 0.9952, -0.1951, -0, 0.9808, -0.1951, -0, 0.9808, -0.2903, -0, 0.9569, -0.2903, -0, 0.9569, -0.3826, 0, 0.9239, -0.3827, -0, 0.9239, -0.4713, -0, 0.882, -0.4714, 0, 0.8819, -0.5555, -0, 0.8315, -0.5556, -0, 0.8315, -0.6345, -0, 0.773, -0.6344, -0, 0.773, -0.7071, -0, 0.7071, -0.7071, -0, 0.7071, -0.773, -0, 0.6344, -0.773, -0, 0.6344, -0.8315, 0, 0.5555, -0.8315, 0, 0.5556, -0.882, -0, 0.4713, -0.8819, -0, 0.4714, -0.9239, 0, 0.3826, -0.9239, -0, 0.3827, -0.957, -0, 0.2902, -0.9569, -0, 0.2903, -0.9808, -0, 0.1951, -0.9808, -0, 0.1951, -0.9952, -0, 0.098, -0.9952, -0, 0.098, -1, -0, -0, -1, -0, -0, -0.9952, 0, -0.098, -0.9952, 0, -0.098, -0.9808, -0, -0.1951, -0.9808, -0, -0.1951, -0.9569, -0, -0.2903, -0.9569, -0, -0.2903, -0.9239, 0, -0.3826, -0.9239, -0, -0.3827, -0.882, -0, -0.4713, -0.8819, -0, -0.4714, -0.8315, -0, -0.5555, -0.8315, 0, -0.5556, -0.773, -0, -0.6345, -0.773, -0, -0.6344, -0.7071, -0, -0.7071, -0.7071, -0, -0.7071, -0.6344, -0, -0.773, -0.6344, -0, -0.773, -0.5555, 0, -0.8315, -0.5556, 0, -0.8315, -0.4713, -0, -0.882, -0.4714, 0, -0.8819, -0.3826, -0, -0.9239, -0.3827, 0, -0.9239, -0.2902, -0, -0.957, -0.2903, 0, -0.9569, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, -0.098, -0, -0.9952, -0.098, -0, -0.9952, 0, -0, -1, 0, -0, -1, 0.0981, -0, -0.9952, 0.098, -0, -0.9952, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.2903, 0, -0.9569, 0.2903, 0, -0.9569, 0.3826, 0, -0.9239, 0.3827, 0, -0.9239, 0.4713, -0, -0.882, 0.4714, -0, -0.8819, 0.5555, -0, -0.8315, 0.5556, -0, -0.8315, 0.6337, -0, -0.7736, 0.6336, 0, -0.7737, 0.6699, -0, -0.7424, 0.6699, -0, -0.7424, 0.6336, 0, 0.7736, 0.6699, 0, 0.7424, 0.67, 0, 0.7424, 0.6336, 0, 0.7737, 0.5555, 0, 0.8315, 0.5556, 0, 0.8315, 0.4713, -0, 0.882, 0.4714, -0, 0.8819, 0.3826, 0, 0.9239, 0.3827, -0, 0.9239, 0.2902, -0, 0.957, 0.2903, -0, 0.9569, 0.1952, -0, 0.9808, 0.1951, 0, 0.9808, 0.098, 0, 0.9952, 0.098, 0, 0.9952, -0.0438, 0.8948, 0.4444, 0, 0.8947, 0.4467, 0, 0.8947, 0.4467, -0.0438, 0.8947, 0.4444, -0.0871, 0.8948, 0.4379, -0.0438, 0.8947, 0.4444, -0.0438, 0.8947, 0.4444, -0.0871, 0.8948, 0.4379, -0.1296, 0.8948, 0.4272, -0.1296, 0.8948, 0.4273, -0.1709, 0.8948, 0.4124, -0.1708, 0.8949, 0.4124, -0.2106, 0.8948, 0.3937, -0.2106, 0.8948, 0.3937, -0.2481, 0.8948, 0.3712, -0.2481, 0.8948, 0.3713, -0.2834, 0.8947, 0.3453, -0.2834, 0.8947, 0.3452, -0.3159, 0.8947, 0.3159, -0.3159, 0.8947, 0.3158, -0.3453, 0.8947, 0.2834, -0.3452, 0.8947, 0.2834, -0.3712, 0.8948, 0.2481, -0.3712, 0.8948, 0.2482, -0.3937, 0.8948, 0.2106, -0.3937, 0.8948, 0.2105, -0.4124, 0.8948, 0.1709, -0.4124, 0.8948, 0.1708, -0.4273, 0.8948, 0.1296, -0.4273, 0.8948, 0.1296, -0.4379, 0.8948, 0.087, -0.4379, 0.8948, 0.0871, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4467, 0.8947, -0, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4467, 0.8947, -0, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4379, 0.8948, -0.0871, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4379, 0.8948, -0.0871, -0.4273, 0.8948, -0.1296, -0.4272, 0.8948, -0.1296, -0.4124, 0.8948, -0.1709, -0.4124, 0.8948, -0.1709, -0.3937, 0.8948, -0.2106, -0.3937, 0.8948, -0.2106, -0.3712, 0.8948, -0.2481, -0.3713, 0.8948, -0.2481, -0.3452, 0.8947, -0.2834, -0.3452, 0.8947, -0.2834, -0.3159, 0.8947, -0.3159, -0.3159, 0.8947, -0.3159, -0.2834, 0.8947, -0.3452, -0.2834, 0.8947, -0.3453, -0.2482, 0.8948, -0.3712, -0.2482, 0.8948, -0.3712, -0.2106, 0.8948, -0.3937, -0.2105, 0.8948, -0.3937, -0.1709, 0.8948, -0.4124, -0.1708, 0.8948, -0.4124, -0.1296, 0.8948, -0.4273, -0.1296, 0.8948, -0.4273, -0.0871, 0.8948, -0.4379, -0.0871, 0.8948, -0.4379, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, 0, 0.8947, -0.4467, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, 0, 0.8947, -0.4467, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0871, 0.8948, -0.4379, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0871, 0.8948, -0.4379, 0.1296, 0.8948, -0.4273, 0.1296, 0.8948, -0.4273, 0.1708, 0.8948, -0.4124, 0.1709, 0.8948, -0.4124, 0.2106, 0.8948, -0.3937, 0.2105, 0.8948, -0.3937, 0.2481, 0.8948, -0.3712, 0.2481, 0.8948, -0.3712, 0.2831, 0.8947, -0.3456, 0.2828, 0.8947, -0.3458, 0.2994, 0.8945, -0.3319, 0.2994, 0.8945, -0.3319, 0.2994, 0.8945, 0.3319, 0.2828, 0.8947, 0.3458, 0.2831, 0.8947, 0.3456, 0.2994, 0.8945, 0.3319, 0.2482, 0.8948, 0.3712, 0.2481, 0.8948, 0.3712, 0.2106, 0.8948, 0.3937, 0.2105, 0.8948, 0.3937, 0.1709, 0.8948, 0.4124, 0.1708, 0.8949, 0.4124, 0.1296, 0.8948, 0.4273, 0.1296, 0.8948, 0.4273, 0.0871, 0.8948, 0.4379, 0.0871, 0.8948, 0.4379, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, -0.0976, 0.091, 0.9911, -0, 0.0909, 0.9959, -0, 0.0909, 0.9959, -0.0976, 0.0909, 0.9911, -0.1943, 0.091, 0.9767, -0.1944, 0.091, 0.9767, -0.2891, 0.091, 0.953, -0.2891, 0.091, 0.953, -0.3811, 0.091, 0.9201, -0.3811, 0.0909, 0.92, -0.4695, 0.091, 0.8782, -0.4695, 0.091, 0.8783, -0.5532, 0.091, 0.828, -0.5532, 0.091, 0.828, -0.5533, 0.0909, 0.828, -0.5532, 0.091, 0.828, -0.6317, 0.091, 0.7698, -0.6317, 0.0909, 0.7699, -0.7042, 0.091, 0.7042, -0.7042, 0.0909, 0.7042, -0.7698, 0.0909, 0.6317, -0.7698, 0.091, 0.6317, -0.7698, 0.0909, 0.6317, -0.8281, 0.0909, 0.5532, -0.828, 0.0909, 0.5532, -0.7698, 0.0909, 0.6317, -0.828, 0.0909, 0.5532, -0.8783, 0.091, 0.4694, -0.8782, 0.091, 0.4695, -0.828, 0.0909, 0.5532, -0.9201, 0.0909, 0.3811, -0.9201, 0.091, 0.3811, -0.953, 0.091, 0.289, -0.953, 0.091, 0.2891, -0.9767, 0.091, 0.1943, -0.9767, 0.091, 0.1943, -0.9911, 0.0909, 0.0975, -0.9911, 0.091, 0.0976, -0.9959, 0.0909, -0, -0.9959, 0.0909, -0, -0.9911, 0.091, -0.0976, -0.9911, 0.0909, -0.0975, -0.9767, 0.091, -0.1943, -0.9767, 0.091, -0.1943, -0.953, 0.091, -0.2891, -0.953, 0.091, -0.2891, -0.9201, 0.091, -0.3811, -0.9201, 0.0909, -0.381, -0.8782, 0.091, -0.4695, -0.8783, 0.091, -0.4695, -0.828, 0.0909, -0.5532, -0.828, 0.0909, -0.5532, -0.828, 0.0909, -0.5533, -0.828, 0.0909, -0.5532, -0.7698, 0.091, -0.6317, -0.7698, 0.0909, -0.6318, -0.7042, 0.091, -0.7042, -0.7042, 0.0909, -0.7042, -0.6317, 0.0909, -0.7698, -0.6317, 0.091, -0.7698, -0.6317, 0.0909, -0.7698, -0.5532, 0.0909, -0.8281, -0.5532, 0.0909, -0.828, -0.6317, 0.0909, -0.7698, -0.5532, 0.0909, -0.828, -0.4694, 0.091, -0.8783, -0.4695, 0.091, -0.8782, -0.5532, 0.0909, -0.828, -0.381, 0.0909, -0.9201, -0.3811, 0.091, -0.9201, -0.289, 0.091, -0.953, -0.2891, 0.091, -0.953, -0.1943, 0.091, -0.9767, -0.1943, 0.091, -0.9767, -0.0975, 0.0909, -0.9911, -0.0976, 0.091, -0.9911, 0, 0.0909, -0.9959, 0, 0.091, -0.9959, 0.0976, 0.091, -0.9911, 0.0976, 0.0909, -0.9911, 0.1943, 0.091, -0.9767, 0.1943, 0.091, -0.9767, 0.2891, 0.091, -0.953, 0.2891, 0.091, -0.953, 0.3811, 0.091, -0.9201, 0.3811, 0.0909, -0.92, 0.4695, 0.091, -0.8782, 0.4695, 0.091, -0.8782, 0.5532, 0.091, -0.828, 0.5532, 0.091, -0.828, 0.5533, 0.0909, -0.828, 0.5532, 0.091, -0.828, 0.6309, 0.0909, -0.7705, 0.631, 0.0909, -0.7705, 0.6672, 0.0908, -0.7393, 0.6672, 0.0909, -0.7393, 0.6672, 0.0908, 0.7393, 0.6309, 0.0909, 0.7705, 0.6309, 0.0909, 0.7705, 0.6672, 0.0908, 0.7393, 0.5532, 0.0909, 0.8281, 0.5532, 0.091, 0.828, 0.5532, 0.091, 0.828, 0.4694, 0.091, 0.8783, 0.4695, 0.091, 0.8782, 0.5532, 0.091, 0.828, 0.3811, 0.0909, 0.9201, 0.3811, 0.091, 0.9201, 0.2891, 0.0909, 0.953, 0.289, 0.091, 0.953, 0.1944, 0.091, 0.9767, 0.1943, 0.091, 0.9767, 0.0976, 0.0909, 0.9911, 0.0976, 0.091, 0.9911, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0.0004, 1, -0.0003, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0.0004, 1, 0.0003, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0.0978, 0.0646, -0.9931, 0.0978, 0.0645, -0.9931, -0, 0.0646, -0.9979, 0, 0.0645, -0.9979, 0.1947, 0.0645, -0.9787, 0.1946, 0.0645, -0.9788, 0.2897, 0.0646, -0.9549, 0.2897, 0.0645, -0.9549, 0.3819, 0.0645, -0.922, 0.3819, 0.0645, -0.922, 0.4704, 0.0646, -0.8801, 0.4704, 0.0645, -0.8801, 0.5544, 0.0645, -0.8297, 0.5545, 0.0645, -0.8297, 0.6331, 0.0645, -0.7714, 0.6331, 0.0645, -0.7714, 0.7056, 0.0646, -0.7056, 0.7056, 0.0645, -0.7056, 0.7714, 0.0646, -0.6331, 0.7714, 0.0645, -0.6331, 0.8297, 0.0645, -0.5545, 0.8297, 0.0645, -0.5544, 0.8801, 0.0646, -0.4704, 0.8801, 0.0645, -0.4704, 0.922, 0.0645, -0.3818, 0.922, 0.0645, -0.3819, 0.9549, 0.0646, -0.2897, 0.9549, 0.0645, -0.2898, 0.9788, 0.0645, -0.1946, 0.9787, 0.0645, -0.1947, 0.9931, 0.0646, -0.0978, 0.9931, 0.0645, -0.0978, 0.9979, 0.0646, -0, 0.9979, 0.0645, -0, 0.9931, 0.0646, 0.0978, 0.9931, 0.0645, 0.0978, 0.9787, 0.0645, 0.1947, 0.9788, 0.0645, 0.1946, 0.9549, 0.0646, 0.2897, 0.9549, 0.0645, 0.2897, 0.922, 0.0645, 0.3819, 0.922, 0.0645, 0.3819, 0.8801, 0.0646, 0.4704, 0.8801, 0.0645, 0.4704, 0.8297, 0.0645, 0.5544, 0.8297, 0.0645, 0.5545, 0.7714, 0.0646, 0.6331, 0.7714, 0.0645, 0.6331, 0.7056, 0.0646, 0.7056, 0.7056, 0.0645, 0.7056, 0.6331, 0.0646, 0.7714, 0.6331, 0.0645, 0.7714, 0.5545, 0.0646, 0.8297, 0.5544, 0.0645, 0.8297, 0.4704, 0.0645, 0.8801, 0.4704, 0.0645, 0.8801, 0.3818, 0.0645, 0.922, 0.3819, 0.0645, 0.922, 0.2898, 0.0646, 0.9549, 0.2898, 0.0645, 0.9549, 0.1946, 0.0645, 0.9788, 0.1947, 0.0645, 0.9787, 0.0978, 0.0646, 0.9931, 0.0978, 0.0645, 0.9931, 0, 0.0645, 0.9979, 0, 0.0645, 0.9979, -0.0978, 0.0645, 0.9931, -0.0978, 0.0646, 0.9931, -0.1947, 0.0645, 0.9787, -0.1946, 0.0645, 0.9788, -0.2897, 0.0646, 0.9549, -0.2897, 0.0645, 0.955, -0.3819, 0.0645, 0.922, -0.3819, 0.0645, 0.922, -0.4704, 0.0646, 0.8801, -0.4704, 0.0645, 0.8801, -0.5544, 0.0645, 0.8297, -0.5545, 0.0645, 0.8297, -0.6321, 0.0646, 0.7722, -0.6321, 0.0645, 0.7722, -0.6682, 0.0645, 0.7412, -0.6682, 0.0645, 0.7412, -0.6321, 0.0646, -0.7722, -0.6682, 0.0645, -0.7412, -0.6682, 0.0645, -0.7412, -0.6321, 0.0645, -0.7722, -0.5545, 0.0645, -0.8297, -0.5544, 0.0645, -0.8297, -0.4704, 0.0645, -0.8801, -0.4704, 0.0645, -0.8801, -0.3818, 0.0645, -0.922, -0.3819, 0.0645, -0.922, -0.2897, 0.0646, -0.9549, -0.2896, 0.0645, -0.955, -0.1946, 0.0645, -0.9788, -0.1946, 0.0645, -0.9788, -0.0978, 0.0646, -0.9931, -0.0978, 0.0645, -0.9931, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0.0001, 1, -0.0001, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0.0001, 1, -0.0001, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0.0002, 1, -0.0001, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0.0002, 1, -0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0.0002, 1, -0.0001, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0.0001, 1, -0.0001, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, 0.098, -0, -0.9952, 0.098, -0, -0.9952, 0, -0, -1, 0, -0, -1, 0.1951, 0, -0.9808, 0.1951, 0, -0.9808, 0.2903, 0, -0.9569, 0.2903, 0, -0.9569, 0.3827, 0, -0.9239, 0.3827, 0, -0.9239, 0.4714, -0, -0.8819, 0.4714, -0, -0.8819, 0.5556, -0, -0.8315, 0.5556, -0, -0.8314, 0.6343, 0, -0.7731, 0.6344, -0, -0.773, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.773, 0, -0.6344, 0.773, 0, -0.6344, 0.8315, -0, -0.5556, 0.8314, -0, -0.5556, 0.8819, -0, -0.4714, 0.8819, -0, -0.4714, 0.9239, -0, -0.3827, 0.9239, -0, -0.3827, 0.9569, -0, -0.2903, 0.9569, -0, -0.2903, 0.9808, 0, -0.1951, 0.9808, 0, -0.1951, 0.9952, -0, -0.098, 0.9952, -0, -0.098, 1, -0, 0, 1, -0, 0, 0.9952, -0, 0.098, 0.9952, -0, 0.098, 0.9808, -0, 0.1951, 0.9808, -0, 0.1951, 0.9569, -0, 0.2903, 0.9569, -0, 0.2903, 0.9239, -0, 0.3827, 0.9239, -0, 0.3827, 0.8819, 0, 0.4714, 0.8819, 0, 0.4714, 0.8315, -0, 0.5556, 0.8314, -0, 0.5556, 0.773, -0, 0.6344, 0.7731, -0, 0.6343, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.6344, -0, 0.773, 0.6344, -0, 0.773, 0.5556, 0, 0.8315, 0.5556, 0, 0.8314, 0.4714, -0, 0.8819, 0.4714, -0, 0.8819, 0.3827, -0, 0.9239, 0.3827, -0, 0.9239, 0.2903, -0, 0.9569, 0.2903, -0, 0.9569, 0.1951, 0, 0.9808, 0.1951, 0, 0.9808, 0.098, 0, 0.9952, 0.098, 0, 0.9952, 0, -0, 1, 0, -0, 1, -0.098, 0, 0.9952, -0.098, 0, 0.9952, -0.1951, -0, 0.9808, -0.1951, -0, 0.9808, -0.2903, -0, 0.9569, -0.2903, -0, 0.9569, -0.3827, -0, 0.9239, -0.3827, -0, 0.9239, -0.4714, 0, 0.8819, -0.4714, 0, 0.8819, -0.5556, -0, 0.8315, -0.5556, -0, 0.8314, -0.633, 0, 0.7742, -0.633, 0, 0.7742, -0.6688, -0, 0.7434, -0.6688, -0, 0.7434, -0.633, 0, -0.7742, -0.633, -0, -0.7741, -0.6689, 0, -0.7434, -0.6688, 0, -0.7434, -0.5556, 0, -0.8315, -0.5556, -0, -0.8314, -0.4714, 0, -0.8819, -0.4714, 0, -0.8819, -0.3827, 0, -0.9239, -0.3827, 0, -0.9239, -0.2903, 0, -0.9569, -0.2903, 0, -0.9569, -0.1951, -0, -0.9808, -0.1951, -0, -0.9808, -0.098, -0, -0.9952, -0.098, -0, -0.9952, -0.0004, -1, -0.0003, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, -0.5532, 0.091, 0.828, -0.5532, 0.091, 0.828, -0.828, 0.0909, 0.5532, -0.828, 0.0909, 0.5532, -0.828, 0.0909, 0.5532, -0.828, 0.0909, -0.5532, -0.828, 0.0909, -0.5532, -0.828, 0.0909, -0.5532, -0.5532, 0.0909, -0.828, -0.5532, 0.0909, -0.828, -0.5532, 0.0909, -0.828, 0.5532, 0.091, -0.828, 0.5532, 0.091, -0.828, 0.5532, 0.091, 0.828, 0.5532, 0.091, 0.828, -0.0438, 0.8947, 0.4444, -0.0438, 0.8947, 0.4444, -0.0438, 0.8947, 0.4444, -0.7698, 0.0909, 0.6317, -0.7698, 0.0909, 0.6317, -0.7698, 0.0909, 0.6317, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.6317, 0.0909, -0.7698, -0.6317, 0.0909, -0.7698, -0.6317, 0.0909, -0.7698, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, 0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.4444, 0.8947, -0.0438, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, -0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, -0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0.0438, 0.8947, 0.4444, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0, -1, 0, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, -0, 1, 0, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, -0, 1, 0, 0.7071, -0, 0.7071, 0, -1, 0, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, 0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0, -1, 0, 0.7071, -0, -0.7071, -0, 1, 0, 0.7071, -0, -0.7071, -0, 1, 0, 0, -1, 0, 0.7071, -0, -0.7071, 0.7071, -0, 0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.7071, -0, -0.7071, 0.5969, 0.4394, -0.6713, 0.6368, 0.3784, -0.6718, 0.6228, 0.4578, -0.6344, 0.6647, 0.3945, -0.6345, 0.5512, 0.4953, -0.6715, 0.575, 0.5166, -0.6344, 0.4998, 0.5471, -0.6715, 0.5216, 0.5708, -0.6342, 0.4631, 0.6188, -0.6345, 0.4439, 0.5935, -0.6714, 0.3836, 0.634, -0.6715, 0.4002, 0.6615, -0.6343, 0.3335, 0.6975, -0.6343, 0.3199, 0.6684, -0.6715, 0.2634, 0.727, -0.6341, 0.2526, 0.6967, -0.6715, 0.191, 0.7492, -0.6343, 0.1832, 0.718, -0.6715, 0.1166, 0.7645, -0.634, 0.1117, 0.7325, -0.6715, 0.0411, 0.772, -0.6343, 0.0393, 0.7401, -0.6714, -0.0348, 0.7722, -0.6345, -0.0333, 0.74, -0.6718, -0.1059, 0.7333, -0.6716, -0.1102, 0.7652, -0.6343, -0.1772, 0.7196, -0.6715, -0.1847, 0.7508, -0.6342, -0.2467, 0.6989, -0.6714, -0.2574, 0.7287, -0.6346, -0.3142, 0.6713, -0.6713, -0.3276, 0.7004, -0.6342, -0.3947, 0.6647, -0.6343, -0.3783, 0.637, -0.6717, -0.439, 0.5973, -0.6712, -0.458, 0.6227, -0.6344, -0.5168, 0.5746, -0.6347, -0.4957, 0.5509, -0.6715, -0.5471, 0.4998, -0.6715, -0.5704, 0.5219, -0.6343, -0.5934, 0.4441, -0.6714, -0.6188, 0.4632, -0.6344, -0.634, 0.3837, -0.6714, -0.6613, 0.4005, -0.6343, -0.6687, 0.3197, -0.6713, -0.6975, 0.3334, -0.6343, -0.7269, 0.2633, -0.6343, -0.6967, 0.2526, -0.6715, -0.7492, 0.1908, -0.6343, -0.7182, 0.1831, -0.6714, -0.7641, 0.1167, -0.6344, -0.7327, 0.1114, -0.6714, -0.772, 0.0412, -0.6343, -0.7397, 0.0397, -0.6718, -0.7723, -0.0347, -0.6343, -0.7404, -0.0331, -0.6714, -0.7335, -0.1057, -0.6715, -0.765, -0.1103, -0.6345, -0.7196, -0.1771, -0.6714, -0.7507, -0.1846, -0.6343, -0.6988, -0.2468, -0.6714, -0.7287, -0.2575, -0.6346, -0.6712, -0.3143, -0.6714, -0.7003, -0.3277, -0.6342, -0.6369, -0.3784, -0.6717, -0.6646, -0.3949, -0.6343, 0.7156, 0.4249, -0.5544, 0.6685, 0.4974, -0.5529, 0.6189, 0.5592, -0.5516, 0.5634, 0.6127, -0.5542, 0.498, 0.666, -0.5554, 0.4305, 0.7111, -0.5558, 0.3582, 0.7507, -0.5552, 0.2833, 0.782, -0.5552, 0.2053, 0.8057, -0.5556, 0.1255, 0.8218, -0.5558, 0.0444, 0.8302, -0.5557, -0.0374, 0.8309, -0.5552, -0.1187, 0.8231, -0.5553, -0.1988, 0.8074, -0.5556, -0.2769, 0.7842, -0.5553, -0.3525, 0.753, -0.5556, -0.4246, 0.7149, -0.5556, -0.4925, 0.6699, -0.5556, -0.556, 0.6181, -0.5557, -0.6138, 0.5608, -0.5557, -0.6656, 0.4982, -0.5557, -0.7115, 0.4303, -0.5556, -0.7504, 0.3586, -0.5553, -0.7816, 0.2838, -0.5555, -0.8057, 0.2053, -0.5556, -0.8218, 0.1252, -0.5558, -0.8304, 0.0442, -0.5554, -0.8306, -0.0374, -0.5556, -0.8229, -0.119, -0.5556, -0.8076, -0.1987, -0.5553, -0.784, -0.277, -0.5556, -0.7531, -0.3525, -0.5556, -0.7149, -0.4246, -0.5556, 0.6397, 0.6012, -0.4789, 0.5946, 0.6554, -0.4658, 0.5308, 0.7089, -0.4645, 0.4616, 0.7538, -0.4677, 0.3804, 0.7958, -0.4712, 0.3006, 0.8292, -0.4712, 0.2178, 0.8546, -0.4714, 0.133, 0.872, -0.4711, 0.047, 0.8806, -0.4715, -0.0397, 0.8811, -0.4712, -0.1258, 0.8729, -0.4714, -0.211, 0.8562, -0.4717, -0.2936, 0.8318, -0.4711, -0.3739, 0.7989, -0.4712, -0.4503, 0.7584, -0.4713, -0.5226, 0.7108, -0.4708, -0.59, 0.6555, -0.4715, -0.6509, 0.595, -0.4714, -0.7061, 0.5287, -0.4711, -0.7545, 0.4569, -0.4711, -0.7959, 0.3801, -0.4713, -0.829, 0.3006, -0.4716, -0.8548, 0.2174, -0.4712, -0.8719, 0.1327, -0.4714, -0.8807, 0.0469, -0.4713, -0.8811, -0.0393, -0.4712, -0.8728, -0.1259, -0.4715, -0.8564, -0.2109, -0.4713, -0.8316, -0.2937, -0.4713, -0.7989, -0.3739, -0.4712, -0.7584, -0.4502, -0.4714, 0.4853, 0.7888, -0.3772, 0.5431, 0.7455, -0.3865, 0.3982, 0.8338, -0.3824, 0.3145, 0.8688, -0.3824, 0.2284, 0.8951, -0.3829, 0.1396, 0.9134, -0.3824, 0.049, 0.9225, -0.3828, -0.0415, 0.9232, -0.3821, -0.1318, 0.9147, -0.3821, -0.2207, 0.8972, -0.3826, -0.3076, 0.8712, -0.3826, -0.3916, 0.837, -0.3821, -0.4718, 0.7944, -0.3826, -0.5474, 0.7445, -0.3821, -0.6181, 0.6867, -0.3827, -0.6821, 0.6233, -0.3825, -0.74, 0.5536, -0.3821, -0.7905, 0.4784, -0.3825, -0.8336, 0.3983, -0.3829, -0.8685, 0.315, -0.3828, -0.8953, 0.2281, -0.3826, -0.9133, 0.1397, -0.3827, -0.9226, 0.0492, -0.3827, -0.923, -0.0416, -0.3825, -0.9147, -0.1318, -0.3821, -0.8972, -0.2205, -0.3825, -0.8972, -0.2205, -0.3825, -0.8972, -0.2205, -0.3825, -0.8714, -0.3077, -0.3821, -0.8367, -0.3918, -0.3826, -0.7946, -0.4715, -0.3825, 0.4147, 0.863, -0.2885, 0.4961, 0.8201, -0.2852, 0.3261, 0.8996, -0.2903, 0.3261, 0.8996, -0.2903, 0.2367, 0.9271, -0.2906, 0.3261, 0.8996, -0.2903, 0.1444, 0.946, -0.2903, 0.051, 0.9555, -0.2904, -0.0431, 0.956, -0.2903, -0.1365, 0.9471, -0.2905, -0.2287, 0.9293, -0.2899, -0.3183, 0.9025, -0.2902, -0.4056, 0.8668, -0.2902, -0.4882, 0.8231, -0.2901, -0.5669, 0.7711, -0.2899, -0.6395, 0.7118, -0.2903, -0.6395, 0.7118, -0.2903, -0.7065, 0.6457, -0.2899, -0.6395, 0.7118, -0.2903, -0.766, 0.5736, -0.2901, -0.8188, 0.4953, -0.2903, -0.8635, 0.4128, -0.2899, -0.8998, 0.3258, -0.2902, -0.9274, 0.2364, -0.2899, -0.9461, 0.1444, -0.2899, -0.9555, 0.0507, -0.2905, -0.956, -0.0431, -0.2903, -0.9471, -0.1366, -0.2904, -0.8972, -0.2205, -0.3825, -0.8972, -0.2205, -0.3825, -0.9293, -0.2285, -0.2903, -0.8972, -0.2205, -0.3825, -0.9023, -0.3186, -0.2903, -0.8668, -0.4056, -0.2902, -0.8229, -0.4886, -0.2899, 0.426, 0.8836, -0.1943, 0.492, 0.8455, -0.2077, 0.3339, 0.9222, -0.1951, 0.3261, 0.8996, -0.2903, 0.242, 0.9504, -0.1952, 0.3261, 0.8996, -0.2903, 0.3261, 0.8996, -0.2903, 0.1479, 0.9696, -0.1948, 0.0519, 0.9794, -0.195, -0.0441, 0.9799, -0.1948, -0.1399, 0.9707, -0.1953, -0.2344, 0.9524, -0.1951, -0.3266, 0.9249, -0.1948, -0.4157, 0.8884, -0.1948, -0.5009, 0.8432, -0.1951, -0.581, 0.7902, -0.1948, -0.6395, 0.7118, -0.2903, -0.6556, 0.7294, -0.1951, -0.6395, 0.7118, -0.2903, -0.6556, 0.7294, -0.1951, -0.724, 0.6617, -0.1948, -0.6556, 0.7294, -0.1951, -0.6395, 0.7118, -0.2903, -0.7854, 0.5875, -0.1948, -0.8393, 0.5074, -0.1951, -0.8847, 0.4234, -0.1951, -0.9221, 0.3343, -0.1948, -0.9505, 0.2423, -0.1948, -0.9696, 0.1479, -0.1948, -0.9795, 0.0522, -0.1948, -0.9797, -0.0443, -0.1953, -0.9708, -0.1399, -0.1948, -0.9524, -0.2341, -0.1954, -0.9248, -0.3266, -0.1951, -0.8884, -0.4157, -0.1948, -0.8434, -0.5008, -0.1948, 0.3394, 0.9355, -0.098, 0.43, 0.8974, -0.0992, 0.2459, 0.9643, -0.0982, 0.1501, 0.9838, -0.0979, 0.053, 0.9938, -0.0979, -0.0447, 0.9942, -0.0979, -0.1419, 0.985, -0.0979, -0.2378, 0.9664, -0.0979, -0.3314, 0.9384, -0.0979, -0.4221, 0.9012, -0.0982, -0.5081, 0.8557, -0.0979, -0.5895, 0.8018, -0.0979, -0.6556, 0.7294, -0.1951, -0.6653, 0.7402, -0.0979, -0.7346, 0.6714, -0.0979, -0.7969, 0.5961, -0.0979, -0.8515, 0.5152, -0.0979, -0.8979, 0.4292, -0.0979, -0.9356, 0.3392, -0.0979, -0.9644, 0.2458, -0.0979, -0.9838, 0.1504, -0.0981, -0.9938, 0.053, -0.0979, -0.9942, -0.0447, -0.0979, -0.985, -0.1419, -0.0979, -0.9664, -0.2378, -0.0979, -0.9384, -0.3314, -0.0979, -0.9014, -0.4218, -0.0979, -0.8557, -0.5081, -0.0979, 0.3408, 0.9401, 0, 0.4302, 0.9027, -0, 0.247, 0.969, 0, 0.1508, 0.9886, 0, 0.0532, 0.9986, -0, -0.0449, 0.999, 0, -0.1426, 0.9898, 0, -0.239, 0.971, 0, -0.333, 0.9429, 0, -0.4238, 0.9058, 0, -0.5105, 0.8599, 0, -0.5924, 0.8057, 0, -0.6685, 0.7437, -0, -0.7382, 0.6746, 0, -0.8007, 0.599, 0, -0.8553, 0.5181, 0, -0.9024, 0.4309, 0, -0.9401, 0.3408, 0, -0.969, 0.247, 0, -0.9886, 0.1508, -0, -0.9986, 0.0532, -0, -0.999, -0.0449, -0, -0.9898, -0.1426, -0, -0.971, -0.239, 0, -0.9429, -0.333, 0, -0.906, -0.4232, 0, -0.8599, -0.5105, 0, 0.4742, 0.8804, -0, 0.4746, 0.8745, -0.0999, 0.533, 0.7972, -0.2836, 0.6033, 0.6783, -0.4196, 0.6874, 0.5188, -0.5083, 0.7388, 0.4386, -0.5116, 0.9351, -0.3212, 0.1499, 0.9425, -0.3342, 0, 0.9425, -0.3342, 0, 0.9351, -0.3212, 0.1499, 0.9126, -0.2838, 0.2942, 0.9127, -0.2838, 0.2941, 0.8764, -0.2228, 0.427, 0.8764, -0.2228, 0.427, 0.8276, -0.1404, 0.5435, 0.8276, -0.1404, 0.5434, 0.7678, -0.0399, 0.6394, 0.7681, -0.0404, 0.639, 0.7003, 0.0739, 0.71, 0.7003, 0.074, 0.71, 0.6268, 0.1973, 0.7538, 0.6266, 0.1976, 0.7539, 0.5498, 0.3272, 0.7686, 0.5502, 0.3266, 0.7686, 0.501, -0.8432, 0.1951, 0.5104, -0.8599, -0, 0.501, -0.8432, 0.1951, 0.5104, -0.8599, -0, 0.4717, -0.7943, 0.3829, 0.4717, -0.7944, 0.3827, 0.4246, -0.7148, 0.5556, 0.4246, -0.7149, 0.5556, 0.361, -0.6081, 0.707, 0.361, -0.608, 0.7071, 0.2837, -0.4777, 0.8315, 0.2836, -0.4776, 0.8315, 0.1952, -0.3291, 0.9239, 0.1955, -0.3296, 0.9237, 0.0995, -0.1678, 0.9808, 0.0996, -0.1678, 0.9808, 0, -0, 1, 0, -0, 1, -0.5279, -0.8445, 0.0908, -0.445, -0.8955, 0, -0.5233, -0.8521, -0, -0.4503, -0.8866, 0.1059, -0.5415, -0.8216, 0.1782, -0.4662, -0.8599, 0.2076, -0.5637, -0.7844, 0.2589, -0.4662, -0.8599, 0.2076, -0.4662, -0.8599, 0.2076, -0.4917, -0.817, 0.3013, -0.5931, -0.7348, 0.3292, -0.526, -0.7591, 0.3836, -0.6288, -0.6744, 0.3871, -0.5683, -0.6881, 0.4512, -0.6701, -0.605, 0.4301, -0.6163, -0.6073, 0.5014, -0.7144, -0.5302, 0.4566, -0.6682, -0.5196, 0.5324, -0.761, -0.4518, 0.4656, -0.7222, -0.4288, 0.5427, -0.2628, -0.9648, 0, -0.2701, -0.9532, 0.1358, -0.4662, -0.8599, 0.2076, -0.4662, -0.8599, 0.2076, -0.29, -0.9193, 0.2661, -0.4662, -0.8599, 0.2076, -0.3227, -0.8642, 0.386, -0.3669, -0.7897, 0.4917, -0.4208, -0.6989, 0.5783, -0.4821, -0.5958, 0.6423, -0.5487, -0.4837, 0.6819, -0.618, -0.367, 0.6952, -0.0633, -0.998, 0, -0.0714, -0.9843, 0.1612, -0.0953, -0.9439, 0.3162, -0.1343, -0.8782, 0.459, -0.1865, -0.7903, 0.5836, -0.2504, -0.6828, 0.6864, -0.3234, -0.56, 0.7628, -0.4025, -0.4264, 0.81, -0.4849, -0.2876, 0.8259, 0.1027, -0.9787, 0.1777, 0.1115, -0.9938, -0, 0.0763, -0.934, 0.3491, 0.0331, -0.8615, 0.5067, -0.0247, -0.7644, 0.6443, -0.0952, -0.6455, 0.7578, -0.1757, -0.5104, 0.8418, -0.2629, -0.3631, 0.8939, -0.354, -0.2098, 0.9114, 0.2642, -0.9459, 0.1885, 0.2735, -0.9619, -0, 0.2361, -0.8986, 0.3698, 0.1907, -0.8217, 0.5371, 0.1294, -0.7179, 0.684, 0.0544, -0.5928, 0.8035, -0.0308, -0.4487, 0.8931, -0.1233, -0.2922, 0.9484, -0.2196, -0.1304, 0.9668, 0.4038, -0.8941, 0.1939, 0.414, -0.9103, 0, 0.3753, -0.8452, 0.3804, 0.3282, -0.7661, 0.5526, 0.2653, -0.6599, 0.7029, 0.1884, -0.5304, 0.8265, 0.1003, -0.383, 0.9183, 0.0052, -0.2226, 0.9749, -0.0939, -0.0557, 0.994, 0.4588, -0.8669, 0.1949, 0.4686, -0.8834, 0, 0.4298, -0.818, 0.3822, 0.3827, -0.7387, 0.5549, 0.3193, -0.6318, 0.7063, 0.242, -0.5017, 0.8305, 0.1538, -0.3532, 0.9228, 0.0581, -0.1921, 0.9797, -0.0414, -0.024, 0.9989, -0.5279, -0.8445, 0.0908, -0.5233, -0.8521, -0, -0.5415, -0.8216, 0.1782, -0.5637, -0.7844, 0.2589, -0.5931, -0.7348, 0.3292, -0.6288, -0.6744, 0.3871, -0.6288, -0.6744, 0.3871, -0.6701, -0.605, 0.4301, -0.7144, -0.5302, 0.4566, -0.761, -0.4518, 0.4656, 0.6713, 0.3141, -0.6714, 0.7001, 0.3273, -0.6346, 0.7286, 0.2579, -0.6345, 0.6988, 0.2468, -0.6714, 0.7508, 0.1847, -0.6343, 0.7196, 0.1771, -0.6714, 0.7653, 0.1099, -0.6343, 0.7335, 0.1057, -0.6714, 0.7723, 0.0347, -0.6343, 0.7402, 0.0333, -0.6715, 0.7401, -0.0394, -0.6714, 0.7721, -0.0412, -0.6342, 0.7326, -0.1118, -0.6714, 0.7645, -0.1167, -0.634, 0.7181, -0.183, -0.6714, 0.7491, -0.1911, -0.6343, 0.6968, -0.2526, -0.6714, 0.7267, -0.2636, -0.6344, 0.6686, -0.3196, -0.6714, 0.6976, -0.3331, -0.6344, 0.6614, -0.4002, -0.6343, 0.6341, -0.3836, -0.6714, 0.5934, -0.4439, -0.6714, 0.619, -0.4631, -0.6343, 0.5471, -0.5, -0.6713, 0.5707, -0.5215, -0.6343, 0.5167, -0.5749, -0.6345, 0.4954, -0.5512, -0.6714, 0.439, -0.597, -0.6715, 0.4578, -0.623, -0.6343, 0.3947, -0.6647, -0.6343, 0.3782, -0.637, -0.6717, 0.3276, -0.7002, -0.6343, 0.3141, -0.6713, -0.6713, 0.2468, -0.6987, -0.6715, 0.2573, -0.729, -0.6343, 0.1771, -0.7197, -0.6714, 0.1846, -0.7508, -0.6342, 0.1057, -0.7335, -0.6715, 0.1102, -0.7649, -0.6346, 0.0333, -0.7403, -0.6715, 0.0348, -0.7722, -0.6344, -0.0394, -0.7401, -0.6714, -0.0413, -0.772, -0.6343, -0.1118, -0.7326, -0.6714, -0.1166, -0.7642, -0.6343, -0.1831, -0.7181, -0.6714, -0.1911, -0.7491, -0.6343, -0.2527, -0.6966, -0.6715, -0.2634, -0.7267, -0.6344, -0.3198, -0.6686, -0.6713, -0.3335, -0.6974, -0.6344, -0.3836, -0.634, -0.6714, -0.4002, -0.6613, -0.6344, -0.3836, -0.634, -0.6714, -0.3836, -0.634, -0.6714, -0.4631, -0.6188, -0.6346, -0.3836, -0.634, -0.6714, -0.4439, -0.5934, -0.6714, -0.4999, -0.547, -0.6715, -0.5217, -0.5703, -0.6345, -0.5747, -0.5169, -0.6345, -0.5512, -0.4954, -0.6714, -0.6228, -0.4581, -0.6342, -0.5971, -0.439, -0.6714, -0.6646, -0.3949, -0.6343, -0.6369, -0.3784, -0.6717, 0.7569, 0.3487, -0.5528, 0.787, 0.2763, -0.5516, 0.8079, 0.2007, -0.5541, 0.8229, 0.119, -0.5556, 0.8306, 0.0374, -0.5556, 0.8305, -0.0443, -0.5553, 0.8222, -0.1255, -0.5552, 0.8057, -0.2052, -0.5557, 0.7816, -0.2834, -0.5556, 0.7501, -0.3587, -0.5556, 0.7114, -0.4303, -0.5557, 0.6659, -0.4979, -0.5555, 0.6139, -0.5608, -0.5556, 0.5559, -0.6182, -0.5557, 0.4925, -0.6699, -0.5555, 0.4246, -0.7149, -0.5556, 0.3525, -0.7531, -0.5556, 0.277, -0.784, -0.5556, 0.1986, -0.8074, -0.5556, 0.1185, -0.8232, -0.5553, 0.0374, -0.8307, -0.5554, -0.0441, -0.8303, -0.5556, -0.1254, -0.822, -0.5554, -0.1254, -0.822, -0.5554, -0.1254, -0.822, -0.5554, -0.2054, -0.8058, -0.5554, -0.2836, -0.7814, -0.5558, -0.3585, -0.7504, -0.5553, -0.4305, -0.7111, -0.5558, -0.4982, -0.6657, -0.5556, -0.5609, -0.6138, -0.5556, -0.6184, -0.5558, -0.5556, -0.6699, -0.4925, -0.5555, -0.7149, -0.4246, -0.5556, 0.8337, 0.2746, -0.479, 0.8602, 0.2075, -0.4659, 0.8764, 0.1266, -0.4646, 0.8828, 0.0447, -0.4677, 0.8806, -0.0469, -0.4715, 0.8717, -0.1331, -0.4715, 0.8717, -0.1331, -0.4715, 0.8547, -0.2178, -0.4712, 0.8717, -0.1331, -0.4715, 0.829, -0.3006, -0.4716, 0.7958, -0.3804, -0.4712, 0.7546, -0.4566, -0.4713, 0.7064, -0.528, -0.4714, 0.6512, -0.5952, -0.4708, 0.5894, -0.6561, -0.4713, 0.5224, -0.7107, -0.4712, 0.4503, -0.7584, -0.4712, 0.3739, -0.7989, -0.4712, 0.2936, -0.8316, -0.4714, 0.2106, -0.8564, -0.4714, 0.126, -0.873, -0.4713, 0.0397, -0.8811, -0.4712, -0.0469, -0.8806, -0.4715, -0.1254, -0.822, -0.5554, -0.1254, -0.822, -0.5554, -0.1331, -0.872, -0.4711, -0.1254, -0.822, -0.5554, -0.2179, -0.8546, -0.4714, -0.3006, -0.829, -0.4716, -0.3804, -0.7959, -0.4711, -0.4562, -0.7549, -0.4712, -0.5282, -0.7063, -0.4713, -0.5949, -0.6511, -0.4714, -0.6557, -0.5897, -0.4714, -0.7105, -0.5225, -0.4714, -0.7584, -0.4502, -0.4714, 0.9145, 0.1198, -0.3864, 0.9247, 0.0488, -0.3775, 0.9226, -0.0492, -0.3826, 0.8717, -0.1331, -0.4715, 0.9133, -0.1397, -0.3827, 0.8717, -0.1331, -0.4715, 0.8953, -0.2281, -0.3827, 0.8717, -0.1331, -0.4715, 0.8687, -0.3146, -0.3827, 0.8337, -0.3986, -0.3821, 0.7905, -0.4784, -0.3825, 0.74, -0.5533, -0.3824, 0.6821, -0.6234, -0.3821, 0.6178, -0.687, -0.3826, 0.6821, -0.6234, -0.3821, 0.5474, -0.7443, -0.3826, 0.4718, -0.7946, -0.3821, 0.3916, -0.837, -0.3821, 0.3078, -0.8712, -0.3826, 0.2208, -0.8972, -0.3825, 0.1318, -0.9147, -0.3821, 0.0416, -0.923, -0.3826, -0.0492, -0.9226, -0.3827, -0.1394, -0.9133, -0.3827, -0.2283, -0.8951, -0.3829, -0.3149, -0.8688, -0.3821, -0.3986, -0.8337, -0.3821, -0.4784, -0.7905, -0.3825, -0.5534, -0.7399, -0.3826, -0.6235, -0.6819, -0.3826, -0.6871, -0.6177, -0.3826, -0.7442, -0.5474, -0.3828, -0.7946, -0.4715, -0.3825, 0.9574, 0.0431, -0.2855, 0.9562, -0.0488, -0.2885, 0.9459, -0.1446, -0.2904, 0.9273, -0.2361, -0.2904, 0.8996, -0.3262, -0.2905, 0.8632, -0.4131, -0.2902, 0.8187, -0.4955, -0.2902, 0.7664, -0.5733, -0.2899, 0.6821, -0.6234, -0.3821, 0.7065, -0.6457, -0.2899, 0.6821, -0.6234, -0.3821, 0.6397, -0.7118, -0.2902, 0.6821, -0.6234, -0.3821, 0.6821, -0.6234, -0.3821, 0.567, -0.7709, -0.2903, 0.4886, -0.8229, -0.2899, 0.4057, -0.8666, -0.2906, 0.3187, -0.9025, -0.2899, 0.2287, -0.9293, -0.2899, 0.1365, -0.9472, -0.2902, 0.0428, -0.956, -0.2902, -0.0507, -0.9556, -0.2903, -0.1444, -0.946, -0.2903, -0.2364, -0.9274, -0.2899, -0.3262, -0.8998, -0.2899, -0.4128, -0.8635, -0.2899, -0.4954, -0.8187, -0.2903, -0.5733, -0.7664, -0.2899, -0.6457, -0.7065, -0.2899, -0.7117, -0.6396, -0.2903, -0.7117, -0.6396, -0.2903, -0.7709, -0.5668, -0.2905, -0.7117, -0.6396, -0.2903, -0.8229, -0.4886, -0.2899, 0.9779, 0.0267, -0.2075, 0.9796, -0.0491, -0.1948, 0.9696, -0.1479, -0.1948, 0.9505, -0.2423, -0.1948, 0.9221, -0.3343, -0.1948, 0.8847, -0.4234, -0.1951, 0.8392, -0.5077, -0.1948, 0.7851, -0.5879, -0.195, 0.724, -0.6617, -0.1948, 0.6553, -0.7297, -0.1952, 0.581, -0.7902, -0.1948, 0.5008, -0.8434, -0.1948, 0.4157, -0.8884, -0.1948, 0.3266, -0.9249, -0.1948, 0.2344, -0.9524, -0.1948, 0.1399, -0.9708, -0.1948, 0.0441, -0.9799, -0.1948, -0.0519, -0.9794, -0.1953, -0.148, -0.9695, -0.1951, -0.148, -0.9695, -0.1951, -0.148, -0.9695, -0.1951, -0.2423, -0.9505, -0.1948, -0.334, -0.9221, -0.1952, -0.423, -0.8849, -0.1948, -0.5077, -0.8392, -0.1948, -0.5875, -0.7854, -0.1948, -0.6617, -0.724, -0.1948, -0.7295, -0.6557, -0.1948, -0.7117, -0.6396, -0.2903, -0.7902, -0.581, -0.1948, -0.7117, -0.6396, -0.2903, -0.7117, -0.6396, -0.2903, -0.8434, -0.5008, -0.1948, 0.9937, -0.0522, -0.0991, 0.9838, -0.1501, -0.0979, 0.9644, -0.2458, -0.0979, 0.9356, -0.3392, -0.0979, 0.8979, -0.4292, -0.0979, 0.8515, -0.5152, -0.0979, 0.7972, -0.5958, -0.098, 0.7346, -0.6714, -0.0979, 0.6653, -0.7402, -0.0979, 0.5895, -0.8018, -0.0979, 0.5081, -0.8557, -0.0979, 0.4218, -0.9014, -0.0979, 0.3312, -0.9384, -0.0982, 0.2378, -0.9664, -0.0979, 0.1419, -0.985, -0.0979, 0.0447, -0.9942, -0.0979, -0.053, -0.9938, -0.0979, -0.148, -0.9695, -0.1951, -0.148, -0.9695, -0.1951, -0.1501, -0.9838, -0.0979, -0.148, -0.9695, -0.1951, -0.2458, -0.9644, -0.0979, -0.3392, -0.9356, -0.0979, -0.4292, -0.8979, -0.0979, -0.5152, -0.8515, -0.0979, -0.5961, -0.7969, -0.0979, -0.6714, -0.7346, -0.0979, -0.7402, -0.6653, -0.0979, -0.8018, -0.5895, -0.0979, -0.8557, -0.5081, -0.0979, 0.9986, -0.0537, -0, 0.9886, -0.1508, -0, 0.969, -0.247, -0, 0.9403, -0.3405, 0, 0.9022, -0.4313, 0, 0.8556, -0.5177, 0, 0.8007, -0.599, -0, 0.7382, -0.6746, -0, 0.6685, -0.7437, -0, 0.5924, -0.8057, 0, 0.5105, -0.8599, 0, 0.4238, -0.9058, 0, 0.333, -0.9429, 0, 0.239, -0.971, 0, 0.1426, -0.9898, 0, 0.0449, -0.999, 0, -0.0532, -0.9986, -0, -0.1508, -0.9886, 0, -0.247, -0.969, 0, -0.3408, -0.9401, -0, -0.4313, -0.9022, 0, -0.5177, -0.8556, 0, -0.599, -0.8007, -0, -0.6746, -0.7382, -0, -0.7437, -0.6685, 0, -0.8057, -0.5924, 0, -0.8599, -0.5105, 0, 1, -0.0057, 0, 0.995, -0.0027, -0.0998, 0.9549, 0.087, -0.2837, 0.9549, 0.087, -0.2837, 0.8841, 0.2052, -0.4198, 0.7843, 0.3555, -0.5083, 0.7843, 0.3555, -0.5083, 0.7843, 0.3555, -0.5083, 0.7843, 0.3555, -0.5083, 0.1651, 0.9748, 0.1499, 0.1579, 0.9875, 0, 0.158, 0.9874, 0, 0.1652, 0.9748, 0.15, 0.1877, 0.9371, 0.2943, 0.1877, 0.9371, 0.2944, 0.2239, 0.8759, 0.4273, 0.2239, 0.876, 0.4272, 0.2724, 0.7942, 0.5433, 0.2725, 0.7939, 0.5435, 0.3323, 0.6936, 0.6392, 0.3318, 0.6937, 0.6393, 0.3998, 0.5798, 0.7099, 0.4003, 0.5796, 0.7098, 0.4738, 0.4555, 0.7537, 0.4735, 0.4555, 0.7539, -0.5105, 0.8599, 0, -0.501, 0.8432, 0.1952, -0.5105, 0.8599, 0, -0.501, 0.8432, 0.1951, -0.4716, 0.7944, 0.3829, -0.4716, 0.7944, 0.3827, -0.4246, 0.7149, 0.5556, -0.4246, 0.7149, 0.5556, -0.3609, 0.6081, 0.7071, -0.3609, 0.6081, 0.7071, -0.2834, 0.4776, 0.8316, -0.2834, 0.4776, 0.8316, -0.1953, 0.3288, 0.924, -0.1953, 0.3288, 0.924, -0.0996, 0.1679, 0.9808, -0.0996, 0.1678, 0.9808, 0.9549, 0.087, -0.2837, 0.9549, 0.087, -0.2837, 0.9549, 0.087, -0.2837, 0.7843, 0.3555, -0.5083, 0.7843, 0.3555, -0.5083, 0.7843, 0.3555, -0.5083, -0.9993, 0.0377, -0, -0.9941, -0.0592, 0.0908, -0.9987, -0.0511, 0, -0.994, 0.029, 0.1058, -0.9806, -0.0816, 0.1781, -0.9782, 0.0023, 0.2077, -0.9526, -0.0408, 0.3016, -0.9586, -0.119, 0.2586, -0.9181, -0.0988, 0.3838, -0.929, -0.1686, 0.3294, -0.8762, -0.1693, 0.4513, -0.893, -0.2296, 0.3872, -0.8282, -0.2502, 0.5015, -0.852, -0.2984, 0.4302, -0.7761, -0.338, 0.5323, -0.8074, -0.3739, 0.4565, -0.973, 0.2308, 0, -0.9662, 0.2193, 0.1357, -0.9459, 0.1854, 0.2661, -0.9132, 0.13, 0.3863, -0.869, 0.0561, 0.4917, -0.8152, -0.0347, 0.5781, -0.7538, -0.1381, 0.6424, -0.6873, -0.2502, 0.682, -0.8984, 0.4086, 0.1612, -0.9064, 0.4224, 0, -0.8744, 0.3682, 0.3161, -0.8354, 0.3025, 0.4589, -0.7829, 0.2144, 0.584, -0.7191, 0.1068, 0.6867, -0.6462, -0.0164, 0.763, -0.567, -0.1495, 0.81, -0.81, 0.5588, 0.1778, -0.8193, 0.5733, 0, -0.7837, 0.5139, 0.3489, -0.7405, 0.4418, 0.5064, -0.6827, 0.3441, 0.6446, -0.6124, 0.2255, 0.7577, -0.532, 0.0897, 0.842, -0.4446, -0.0572, 0.8939, -0.7039, 0.6848, 0.1886, -0.7133, 0.7008, -0, -0.6758, 0.6375, 0.3701, -0.63, 0.5609, 0.5372, -0.5688, 0.4574, 0.6836, -0.494, 0.3315, 0.8038, -0.4086, 0.1881, 0.8931, -0.3159, 0.0317, 0.9483, -0.6011, 0.7992, 0, -0.5913, 0.7828, 0.1939, -0.5624, 0.7341, 0.3804, -0.5159, 0.6548, 0.5524, -0.4524, 0.5488, 0.7029, -0.3755, 0.4193, 0.8265, -0.2878, 0.2715, 0.9184, -0.1926, 0.1112, 0.975, -0.5513, 0.8343, 0, -0.5415, 0.8178, 0.1949, -0.5125, 0.7689, 0.3822, -0.4651, 0.6898, 0.5549, -0.4019, 0.5828, 0.7063, -0.3247, 0.4526, 0.8305, -0.2365, 0.3041, 0.9228, -0.1408, 0.143, 0.9797, -0.9941, -0.0592, 0.0908, -0.9987, -0.0511, 0, -0.9806, -0.0816, 0.1781, -0.9586, -0.119, 0.2586, -0.929, -0.1686, 0.3294, -0.893, -0.2296, 0.3872, -0.852, -0.2984, 0.4302, -0.8074, -0.3739, 0.4565, -0.761, -0.4518, 0.4656, -0.8599, -0.5104, -0, 0.5969, 0.4394, -0.6713, -0.8059, -0.5921, -0, 0.6368, 0.3784, -0.6718, 0.5512, 0.4953, -0.6715, -0.7439, -0.6683, -0, 0.4998, 0.5471, -0.6715, -0.6743, -0.7385, -0, 0.4439, 0.5935, -0.6714, -0.5987, -0.801, -0, 0.4439, 0.5935, -0.6714, 0.3836, 0.634, -0.6715, -0.5181, -0.8553, 0, 0.3836, 0.634, -0.6715, -0.431, -0.9024, 0, 0.3836, 0.634, -0.6715, 0.3199, 0.6684, -0.6715, -0.341, -0.9401, 0, 0.3199, 0.6684, -0.6715, 0.2526, 0.6967, -0.6715, 0.1832, 0.718, -0.6715, -0.247, -0.969, 0, 0.1832, 0.718, -0.6715, 0.1117, 0.7325, -0.6715, 0.1117, 0.7325, -0.6715, -0.1507, -0.9886, -0, 0.0393, 0.7401, -0.6714, 0.0393, 0.7401, -0.6714, -0.0532, -0.9986, -0, 0.0393, 0.7401, -0.6714, -0.0333, 0.74, -0.6718, 0.045, -0.999, -0, -0.1059, 0.7333, -0.6716, -0.1059, 0.7333, -0.6716, 0.1427, -0.9898, -0, 0.2389, -0.9711, -0, -0.1059, 0.7333, -0.6716, -0.1772, 0.7196, -0.6715, -0.2467, 0.6989, -0.6714, -0.2467, 0.6989, -0.6714, 0.333, -0.9429, 0, 0.4239, -0.9057, 0, -0.2467, 0.6989, -0.6714, -0.3142, 0.6713, -0.6713, -0.3783, 0.637, -0.6717, -0.3783, 0.637, -0.6717, 0.5106, -0.8598, 0, -0.439, 0.5973, -0.6712, 0.5924, -0.8056, 0, -0.439, 0.5973, -0.6712, -0.4957, 0.5509, -0.6715, 0.6685, -0.7438, -0, -0.4957, 0.5509, -0.6715, -0.5471, 0.4998, -0.6715, 0.7383, -0.6744, 0, -0.5471, 0.4998, -0.6715, 0.8008, -0.5989, 0, -0.5471, 0.4998, -0.6715, -0.5934, 0.4441, -0.6714, 0.8558, -0.5173, 0, -0.5934, 0.4441, -0.6714, -0.634, 0.3837, -0.6714, 0.9023, -0.4311, -0, -0.634, 0.3837, -0.6714, -0.6687, 0.3197, -0.6713, -0.6967, 0.2526, -0.6715, 0.9401, -0.341, -0, -0.6967, 0.2526, -0.6715, -0.7182, 0.1831, -0.6714, 0.969, -0.2472, 0, -0.7182, 0.1831, -0.6714, -0.7327, 0.1114, -0.6714, 0.9885, -0.151, -0, -0.7327, 0.1114, -0.6714, -0.7397, 0.0397, -0.6718, 0.9986, -0.0534, -0, -0.7397, 0.0397, -0.6718, 0.999, 0.045, -0, -0.7397, 0.0397, -0.6718, -0.7404, -0.0331, -0.6714, 0.9898, 0.1427, -0, -0.7404, -0.0331, -0.6714, -0.7335, -0.1057, -0.6715, 0.9711, 0.2388, -0, -0.7335, -0.1057, -0.6715, -0.7196, -0.1771, -0.6714, -0.6988, -0.2468, -0.6714, -0.6988, -0.2468, -0.6714, 0.9429, 0.333, -0, -0.6712, -0.3143, -0.6714, -0.6712, -0.3143, -0.6714, 0.9058, 0.4238, -0, -0.6369, -0.3784, -0.6717, -0.6369, -0.3784, -0.6717, 0.8599, 0.5104, 0, -0.9056, -0.4242, 0, 0.6713, 0.3141, -0.6714, -0.9428, -0.3334, -0, 0.6713, 0.3141, -0.6714, 0.6988, 0.2468, -0.6714, 0.7196, 0.1771, -0.6714, -0.971, -0.239, 0, 0.7196, 0.1771, -0.6714, 0.7335, 0.1057, -0.6714, -0.9898, -0.1427, -0, 0.7335, 0.1057, -0.6714, 0.7402, 0.0333, -0.6715, -0.999, -0.045, -0, 0.7402, 0.0333, -0.6715, 0.7402, 0.0333, -0.6715, -0.9986, 0.0532, -0, 0.7401, -0.0394, -0.6714, 0.7401, -0.0394, -0.6714, -0.9886, 0.1506, -0, 0.7326, -0.1118, -0.6714, 0.7326, -0.1118, -0.6714, -0.969, 0.2472, 0, 0.7181, -0.183, -0.6714, 0.6968, -0.2526, -0.6714, 0.6968, -0.2526, -0.6714, -0.9402, 0.3408, -0, 0.6686, -0.3196, -0.6714, 0.6686, -0.3196, -0.6714, -0.9023, 0.4311, -0, 0.6686, -0.3196, -0.6714, -0.8554, 0.518, -0, 0.6341, -0.3836, -0.6714, 0.6341, -0.3836, -0.6714, -0.8008, 0.5989, -0, 0.5934, -0.4439, -0.6714, 0.5934, -0.4439, -0.6714, -0.7382, 0.6746, 0, 0.5471, -0.5, -0.6713, 0.5471, -0.5, -0.6713, -0.6683, 0.7439, 0, 0.4954, -0.5512, -0.6714, -0.5923, 0.8058, -0, 0.4954, -0.5512, -0.6714, 0.439, -0.597, -0.6715, -0.5106, 0.8598, -0, 0.439, -0.597, -0.6715, 0.3782, -0.637, -0.6717, -0.424, 0.9057, -0, 0.3141, -0.6713, -0.6713, 0.3141, -0.6713, -0.6713, -0.333, 0.9429, 0, 0.2468, -0.6987, -0.6715, 0.2468, -0.6987, -0.6715, -0.2389, 0.971, -0, 0.2468, -0.6987, -0.6715, 0.1771, -0.7197, -0.6714, -0.1426, 0.9898, 0, 0.1771, -0.7197, -0.6714, 0.1057, -0.7335, -0.6715, -0.0449, 0.999, 0, 0.1057, -0.7335, -0.6715, 0.0333, -0.7403, -0.6715, 0.0534, 0.9986, -0, -0.0394, -0.7401, -0.6714, -0.0394, -0.7401, -0.6714, 0.1508, 0.9886, 0, -0.1118, -0.7326, -0.6714, -0.1118, -0.7326, -0.6714, 0.2471, 0.969, 0, -0.1118, -0.7326, -0.6714, -0.1831, -0.7181, -0.6714, -0.2527, -0.6966, -0.6715, 0.3408, 0.9402, 0, -0.2527, -0.6966, -0.6715, -0.3198, -0.6686, -0.6713, 0.4312, 0.9023, 0, -0.3198, -0.6686, -0.6713, -0.3836, -0.634, -0.6714, -0.3836, -0.634, -0.6714, 0.5176, 0.8556, -0, -0.4439, -0.5934, -0.6714, -0.3836, -0.634, -0.6714, -0.4439, -0.5934, -0.6714, 0.599, 0.8008, -0, -0.4439, -0.5934, -0.6714, 0.6746, 0.7382, 0, -0.4999, -0.547, -0.6715, -0.5512, -0.4954, -0.6714, -0.5512, -0.4954, -0.6714, 0.7435, 0.6687, -0, -0.5512, -0.4954, -0.6714, 0.8056, 0.5925, 0, -0.5971, -0.439, -0.6714, -0.5971, -0.439, -0.6714, 0.8599, 0.5104, 0, -0.6369, -0.3784, -0.6717, -0.8057, -0.5924, 0, -0.8599, -0.5105, 0, -0.7437, -0.6685, 0, -0.6743, -0.7385, -0, -0.599, -0.8007, -0, -0.5177, -0.8556, 0, -0.431, -0.9024, 0, -0.3408, -0.9401, -0, -0.247, -0.969, 0, -0.1508, -0.9886, 0, -0.0532, -0.9986, -0, 0.0449, -0.999, 0, 0.1426, -0.9898, 0, 0.239, -0.971, 0, 0.333, -0.9429, 0, 0.4238, -0.9058, 0, 0.5105, -0.8599, 0, 0.5924, -0.8057, 0, 0.6685, -0.7437, -0, 0.7382, -0.6746, -0, 0.8007, -0.599, -0, 0.8558, -0.5173, 0, 0.9022, -0.4313, 0, 0.9401, -0.3408, 0, 0.969, -0.247, -0, 0.9886, -0.1508, -0, 0.9986, -0.0532, -0, 0.999, 0.0449, -0, 0.9898, 0.1426, -0, 0.971, 0.239, -0, 0.9429, 0.333, -0, 0.9058, 0.4238, -0, 0.8599, 0.5105, -0, -0.9061, -0.4232, -0, -0.9429, -0.333, 0, -0.9711, -0.2386, 0, -0.9898, -0.1426, -0, -0.999, -0.0449, -0, -0.9986, 0.0532, -0, -0.9886, 0.1508, -0, -0.969, 0.247, 0, -0.9401, 0.3408, 0, -0.9022, 0.4313, -0, -0.8553, 0.5181, 0, -0.8007, 0.599, 0, -0.7382, 0.6746, 0, -0.6685, 0.7437, -0, -0.5924, 0.8057, 0, -0.5105, 0.8599, 0, -0.4238, 0.9058, 0, -0.333, 0.9429, 0, -0.239, 0.971, 0, -0.1426, 0.9898, 0, -0.0449, 0.999, 0, 0.0532, 0.9986, -0, 0.1508, 0.9886, 0, 0.247, 0.969, 0, 0.3408, 0.9401, 0, 0.4313, 0.9022, -0, 0.5177, 0.8556, -0, 0.599, 0.8007, -0, 0.6746, 0.7382, 0, 0.7437, 0.6685, -0, 0.8057, 0.5924, -0, 0.8599, 0.5105, -0, 0.5972, 0.4391, 0.6713, 0.6228, 0.4578, 0.6344, 0.6368, 0.3785, 0.6717, 0.6647, 0.3945, 0.6344, 0.5513, 0.4952, 0.6715, 0.575, 0.5166, 0.6344, 0.4998, 0.5471, 0.6715, 0.5216, 0.5708, 0.6342, 0.444, 0.5934, 0.6714, 0.4631, 0.6188, 0.6345, 0.3836, 0.6341, 0.6714, 0.4002, 0.6615, 0.6343, 0.3196, 0.6686, 0.6715, 0.3334, 0.6974, 0.6344, 0.2525, 0.6967, 0.6715, 0.2634, 0.727, 0.6341, 0.183, 0.7181, 0.6715, 0.191, 0.7492, 0.6343, 0.1118, 0.7325, 0.6715, 0.1166, 0.7644, 0.6342, 0.0394, 0.7401, 0.6714, 0.0411, 0.7721, 0.6342, -0.0333, 0.74, 0.6718, -0.0348, 0.7722, 0.6344, -0.1058, 0.7334, 0.6716, -0.1102, 0.7652, 0.6343, -0.1772, 0.7195, 0.6715, -0.1847, 0.7508, 0.6342, -0.2467, 0.6989, 0.6714, -0.2574, 0.7287, 0.6346, -0.3143, 0.6713, 0.6713, -0.3276, 0.7004, 0.6341, -0.3784, 0.637, 0.6716, -0.3947, 0.6647, 0.6343, -0.439, 0.5973, 0.6712, -0.458, 0.6227, 0.6344, -0.5168, 0.5746, 0.6347, -0.4954, 0.5511, 0.6715, -0.5471, 0.4998, 0.6715, -0.5703, 0.5219, 0.6343, -0.5934, 0.4441, 0.6714, -0.6189, 0.4632, 0.6344, -0.634, 0.3837, 0.6714, -0.6612, 0.4005, 0.6343, -0.6687, 0.3197, 0.6713, -0.6975, 0.3334, 0.6343, -0.7269, 0.2633, 0.6343, -0.6967, 0.2525, 0.6715, -0.7492, 0.1907, 0.6343, -0.7182, 0.1831, 0.6714, -0.7641, 0.1167, 0.6344, -0.7326, 0.1118, 0.6714, -0.772, 0.0412, 0.6343, -0.7397, 0.0394, 0.6718, -0.7723, -0.0347, 0.6343, -0.7404, -0.0333, 0.6714, -0.7335, -0.1057, 0.6715, -0.765, -0.1103, 0.6346, -0.7196, -0.1771, 0.6714, -0.7508, -0.1847, 0.6342, -0.6988, -0.2468, 0.6714, -0.7287, -0.2575, 0.6346, -0.6713, -0.3141, 0.6714, -0.7001, -0.3277, 0.6344, -0.6646, -0.3949, 0.6343, -0.637, -0.3782, 0.6717, 0.7156, 0.4249, 0.5544, 0.6685, 0.4974, 0.5529, 0.6189, 0.5592, 0.5516, 0.5634, 0.6127, 0.5542, 0.4981, 0.666, 0.5553, 0.4305, 0.7111, 0.5558, 0.3582, 0.7507, 0.5552, 0.2832, 0.7819, 0.5553, 0.2054, 0.8058, 0.5554, 0.1255, 0.8218, 0.5558, 0.0444, 0.8302, 0.5557, -0.0374, 0.8308, 0.5553, -0.1187, 0.8231, 0.5553, -0.1988, 0.8074, 0.5556, -0.2769, 0.7842, 0.5553, -0.3525, 0.7531, 0.5556, -0.4246, 0.7149, 0.5556, -0.4925, 0.6699, 0.5556, -0.556, 0.6181, 0.5557, -0.6138, 0.5608, 0.5557, -0.6656, 0.4982, 0.5557, -0.7114, 0.4303, 0.5556, -0.7506, 0.3588, 0.5549, -0.7816, 0.2837, 0.5554, -0.7816, 0.2837, 0.5554, -0.7816, 0.2837, 0.5554, -0.8058, 0.2053, 0.5555, -0.8218, 0.1252, 0.5558, -0.8304, 0.0442, 0.5554, -0.8306, -0.0374, 0.5556, -0.8229, -0.119, 0.5556, -0.8075, -0.1987, 0.5554, -0.784, -0.277, 0.5556, -0.753, -0.3525, 0.5556, -0.7149, -0.4246, 0.5556, 0.6397, 0.6012, 0.4789, 0.5946, 0.6554, 0.4658, 0.5308, 0.7089, 0.4645, 0.4616, 0.7538, 0.4677, 0.3804, 0.7958, 0.4712, 0.3006, 0.8292, 0.4712, 0.2178, 0.8547, 0.4713, 0.1329, 0.872, 0.4712, 0.047, 0.8806, 0.4715, -0.0397, 0.8811, 0.4712, -0.1258, 0.8729, 0.4714, -0.211, 0.8562, 0.4717, -0.2936, 0.8317, 0.4712, -0.3739, 0.7989, 0.4711, -0.4503, 0.7584, 0.4712, -0.5223, 0.711, 0.4709, -0.59, 0.6555, 0.4715, -0.6509, 0.595, 0.4714, -0.7061, 0.5287, 0.4711, -0.7545, 0.4569, 0.4712, -0.7959, 0.3801, 0.4712, -0.829, 0.3006, 0.4715, -0.7816, 0.2837, 0.5554, -0.7816, 0.2837, 0.5554, -0.8548, 0.2174, 0.4712, -0.7816, 0.2837, 0.5554, -0.8719, 0.1327, 0.4714, -0.8807, 0.0469, 0.4714, -0.8811, -0.0393, 0.4712, -0.8728, -0.1259, 0.4715, -0.8564, -0.2109, 0.4712, -0.8317, -0.2937, 0.4712, -0.7991, -0.3739, 0.4708, -0.7584, -0.4502, 0.4714, 0.4853, 0.7888, 0.3772, 0.5431, 0.7455, 0.3865, 0.3986, 0.8337, 0.3821, 0.3145, 0.8688, 0.3824, 0.2283, 0.8952, 0.3828, 0.1394, 0.9135, 0.3821, 0.049, 0.9225, 0.3828, -0.0416, 0.923, 0.3825, -0.1318, 0.9147, 0.3821, -0.2208, 0.8973, 0.3821, -0.3075, 0.8712, 0.3827, -0.3916, 0.837, 0.3821, -0.4718, 0.7944, 0.3826, -0.5474, 0.7445, 0.3821, -0.618, 0.6868, 0.3826, -0.682, 0.6233, 0.3826, -0.7397, 0.5538, 0.3823, -0.7904, 0.4784, 0.3826, -0.8335, 0.3982, 0.3829, -0.8335, 0.3982, 0.3829, -0.8335, 0.3982, 0.3829, -0.8685, 0.315, 0.3827, -0.8955, 0.2283, 0.3821, -0.9133, 0.1396, 0.3825, -0.9226, 0.0492, 0.3826, -0.9232, -0.0415, 0.3821, -0.9147, -0.1318, 0.3821, -0.8973, -0.2206, 0.3824, -0.8714, -0.3077, 0.3821, -0.8368, -0.3918, 0.3825, -0.7946, -0.4715, 0.3825, 0.4147, 0.863, 0.2885, 0.4961, 0.8201, 0.2853, 0.3261, 0.8996, 0.2903, 0.3261, 0.8996, 0.2903, 0.2367, 0.9271, 0.2906, 0.3261, 0.8996, 0.2903, 0.1444, 0.946, 0.2903, 0.051, 0.9556, 0.2902, -0.0431, 0.956, 0.2903, -0.1365, 0.9471, 0.2904, -0.2287, 0.9293, 0.2899, -0.3183, 0.9025, 0.2902, -0.4056, 0.8669, 0.2899, -0.4882, 0.8231, 0.2901, -0.5669, 0.7711, 0.2899, -0.6395, 0.7118, 0.2903, -0.6395, 0.7118, 0.2903, -0.6395, 0.7118, 0.2903, -0.7065, 0.6454, 0.2903, -0.7659, 0.5737, 0.2902, -0.8188, 0.4953, 0.2904, -0.8635, 0.4128, 0.2899, -0.8335, 0.3982, 0.3829, -0.8335, 0.3982, 0.3829, -0.8998, 0.3257, 0.2903, -0.8335, 0.3982, 0.3829, -0.9274, 0.2364, 0.2899, -0.9461, 0.1444, 0.2899, -0.9556, 0.0507, 0.2903, -0.956, -0.0431, 0.2902, -0.9472, -0.1366, 0.2902, -0.9293, -0.2285, 0.2902, -0.9023, -0.3186, 0.2903, -0.8669, -0.4056, 0.2899, -0.8229, -0.4886, 0.2899, 0.4259, 0.8836, 0.1943, 0.4259, 0.8836, 0.1943, 0.4919, 0.8455, 0.2077, 0.3261, 0.8996, 0.2903, 0.3339, 0.9222, 0.1951, 0.4259, 0.8836, 0.1943, 0.2423, 0.9505, 0.1948, 0.3261, 0.8996, 0.2903, 0.3261, 0.8996, 0.2903, 0.1479, 0.9696, 0.1948, 0.0518, 0.9794, 0.195, -0.0441, 0.9799, 0.1948, -0.1399, 0.9707, 0.1953, -0.2344, 0.9524, 0.1948, -0.3267, 0.9248, 0.1951, -0.4157, 0.8884, 0.1948, -0.5008, 0.8434, 0.1948, -0.581, 0.7902, 0.1948, -0.6395, 0.7118, 0.2903, -0.6395, 0.7118, 0.2903, -0.6556, 0.7294, 0.1953, -0.6395, 0.7118, 0.2903, -0.724, 0.6617, 0.1948, -0.7854, 0.5874, 0.1953, -0.8392, 0.5077, 0.1948, -0.8846, 0.4235, 0.1952, -0.9221, 0.3343, 0.1948, -0.9503, 0.2426, 0.1951, -0.9695, 0.148, 0.1953, -0.9795, 0.0522, 0.1948, -0.9797, -0.0443, 0.1953, -0.9708, -0.1399, 0.1948, -0.9524, -0.2342, 0.1952, -0.9248, -0.3266, 0.1953, -0.8884, -0.4157, 0.1948, -0.8434, -0.5008, 0.1948, 0.3396, 0.9355, 0.0981, 0.4259, 0.8836, 0.1943, 0.4259, 0.8836, 0.1943, 0.43, 0.8974, 0.0992, 0.2459, 0.9643, 0.0982, 0.1501, 0.9838, 0.0979, 0.053, 0.9938, 0.0979, -0.0447, 0.9942, 0.0979, -0.1419, 0.985, 0.0979, -0.2378, 0.9664, 0.0979, -0.3314, 0.9384, 0.0979, -0.4221, 0.9012, 0.0982, -0.5081, 0.8557, 0.0979, -0.5895, 0.8018, 0.0979, -0.6653, 0.7402, 0.0979, -0.7346, 0.6714, 0.0979, -0.7969, 0.5961, 0.0979, -0.8515, 0.5152, 0.0979, -0.8979, 0.4292, 0.0979, -0.9356, 0.3392, 0.0979, -0.9644, 0.2458, 0.0979, -0.9838, 0.1501, 0.0979, -0.9938, 0.053, 0.0979, -0.9942, -0.0447, 0.0979, -0.985, -0.1419, 0.0979, -0.9664, -0.2378, 0.0979, -0.9384, -0.3314, 0.0979, -0.9014, -0.4218, 0.0979, -0.8557, -0.5081, 0.0979, 0.4746, 0.8745, 0.0998, 0.4259, 0.8836, 0.1943, 0.533, 0.7971, 0.2836, 0.533, 0.7971, 0.2836, 0.6033, 0.6782, 0.4196, 0.6874, 0.5188, 0.5083, 0.7388, 0.4386, 0.5117, 0.9351, -0.3212, -0.1499, 0.9351, -0.3212, -0.1499, 0.9126, -0.2838, -0.2942, 0.9127, -0.2838, -0.2941, 0.8764, -0.2228, -0.427, 0.8764, -0.2228, -0.427, 0.8276, -0.1404, -0.5435, 0.8277, -0.1405, -0.5434, 0.7681, -0.0404, -0.639, 0.7681, -0.0405, -0.639, 0.7003, 0.074, -0.71, 0.7004, 0.0738, -0.71, 0.6266, 0.1976, -0.7539, 0.6266, 0.1977, -0.7539, 0.5501, 0.3266, -0.7686, 0.5501, 0.3266, -0.7686, 0.5009, -0.8432, -0.1951, 0.501, -0.8432, -0.1951, 0.4717, -0.7943, -0.3829, 0.4717, -0.7943, -0.3829, 0.4246, -0.7149, -0.5556, 0.4246, -0.7149, -0.5556, 0.361, -0.6081, -0.707, 0.3611, -0.608, -0.707, 0.2836, -0.4776, -0.8315, 0.2837, -0.4777, -0.8315, 0.1955, -0.3296, -0.9237, 0.1952, -0.3291, -0.9239, 0.0996, -0.1678, -0.9808, 0.0995, -0.1678, -0.9808, 0, -0, -1, 0, -0, -1, 0.533, 0.7971, 0.2836, 0.533, 0.7971, 0.2836, 0.533, 0.7971, 0.2836, -0.5279, -0.8445, -0.0908, -0.4503, -0.8866, -0.1059, -0.5415, -0.8216, -0.1782, -0.4662, -0.8599, -0.2076, -0.4662, -0.8599, -0.2076, -0.5637, -0.7844, -0.2588, -0.4662, -0.8599, -0.2076, -0.4917, -0.817, -0.3013, -0.5931, -0.7348, -0.3292, -0.526, -0.7591, -0.3836, -0.6288, -0.6744, -0.3871, -0.5683, -0.6881, -0.4512, -0.67, -0.605, -0.4301, -0.6163, -0.6073, -0.5014, -0.7144, -0.5302, -0.4566, -0.6682, -0.5196, -0.5324, -0.761, -0.4517, -0.4656, -0.7222, -0.4288, -0.5427, -0.2701, -0.9532, -0.1358, -0.4662, -0.8599, -0.2076, -0.4662, -0.8599, -0.2076, -0.29, -0.9193, -0.2661, -0.4662, -0.8599, -0.2076, -0.3226, -0.8642, -0.386, -0.3669, -0.7897, -0.4917, -0.4208, -0.6989, -0.5783, -0.4821, -0.5958, -0.6423, -0.5487, -0.4837, -0.6819, -0.618, -0.367, -0.6953, -0.0714, -0.9843, -0.1612, -0.0953, -0.9439, -0.3162, -0.1343, -0.8782, -0.459, -0.1865, -0.7903, -0.5836, -0.2504, -0.6828, -0.6864, -0.3234, -0.56, -0.7628, -0.4025, -0.4264, -0.81, -0.4849, -0.2876, -0.8259, 0.1027, -0.9787, -0.1777, 0.0763, -0.934, -0.3491, 0.0332, -0.8615, -0.5067, -0.0247, -0.7644, -0.6442, -0.0952, -0.6454, -0.7579, -0.1757, -0.5103, -0.8418, -0.2629, -0.3632, -0.8939, -0.3539, -0.2098, -0.9114, 0.2642, -0.9459, -0.1885, 0.2361, -0.8986, -0.3698, 0.1907, -0.8217, -0.5371, 0.1293, -0.7179, -0.684, 0.0545, -0.5928, -0.8035, -0.0308, -0.4487, -0.8931, -0.1234, -0.2922, -0.9484, -0.2197, -0.1305, -0.9668, 0.4038, -0.8941, -0.1939, 0.3753, -0.8452, -0.3804, 0.3282, -0.7661, -0.5526, 0.2653, -0.6599, -0.7029, 0.1881, -0.5303, -0.8267, 0.1003, -0.383, -0.9183, 0.0055, -0.2223, -0.975, -0.0939, -0.0557, -0.994, 0.4592, -0.8667, -0.1951, 0.4298, -0.818, -0.3822, 0.3827, -0.7387, -0.5549, 0.3192, -0.6318, -0.7063, 0.242, -0.5017, -0.8305, 0.1538, -0.3532, -0.9228, 0.0581, -0.1921, -0.9797, -0.0414, -0.0242, -0.9989, -0.5279, -0.8445, -0.0908, -0.5415, -0.8216, -0.1782, -0.5637, -0.7844, -0.2588, -0.5931, -0.7348, -0.3292, -0.6288, -0.6744, -0.3871, -0.67, -0.605, -0.4301, -0.7144, -0.5302, -0.4566, -0.761, -0.4517, -0.4656, 0.6711, 0.3144, 0.6714, 0.7003, 0.3273, 0.6344, 0.7285, 0.2579, 0.6346, 0.6989, 0.2464, 0.6714, 0.7507, 0.1846, 0.6343, 0.7196, 0.177, 0.6714, 0.7653, 0.1099, 0.6342, 0.7334, 0.1061, 0.6714, 0.7722, 0.0347, 0.6344, 0.7402, 0.0332, 0.6715, 0.7401, -0.0393, 0.6714, 0.7721, -0.0412, 0.6342, 0.7326, -0.1117, 0.6714, 0.7648, -0.1167, 0.6336, 0.7181, -0.1832, 0.6714, 0.7492, -0.1911, 0.6342, 0.6968, -0.2525, 0.6714, 0.7267, -0.2636, 0.6344, 0.6686, -0.3197, 0.6714, 0.6976, -0.3331, 0.6344, 0.6342, -0.3834, 0.6714, 0.6614, -0.4002, 0.6343, 0.5934, -0.444, 0.6714, 0.619, -0.4632, 0.6343, 0.547, -0.5001, 0.6713, 0.5706, -0.5214, 0.6344, 0.5167, -0.5749, 0.6345, 0.4953, -0.5512, 0.6714, 0.439, -0.597, 0.6715, 0.4578, -0.623, 0.6343, 0.3947, -0.6647, 0.6343, 0.3784, -0.6369, 0.6717, 0.3141, -0.6713, 0.6713, 0.3276, -0.7002, 0.6343, 0.2574, -0.7291, 0.6342, 0.2468, -0.6987, 0.6715, 0.1846, -0.7508, 0.6343, 0.177, -0.7197, 0.6714, 0.1102, -0.7649, 0.6346, 0.1057, -0.7335, 0.6715, 0.0348, -0.7722, 0.6344, 0.0335, -0.7403, 0.6715, -0.0395, -0.7401, 0.6714, -0.0413, -0.772, 0.6343, -0.1117, -0.7326, 0.6714, -0.1166, -0.7642, 0.6343, -0.183, -0.7181, 0.6714, -0.1911, -0.7491, 0.6343, -0.2527, -0.6966, 0.6715, -0.2634, -0.7267, 0.6344, -0.3198, -0.6686, 0.6713, -0.3335, -0.6974, 0.6344, -0.3836, -0.6341, 0.6714, -0.4002, -0.6613, 0.6344, -0.4631, -0.6188, 0.6345, -0.4441, -0.5932, 0.6714, -0.4998, -0.5471, 0.6715, -0.4441, -0.5932, 0.6714, -0.5216, -0.5702, 0.6346, -0.5747, -0.5169, 0.6345, -0.5511, -0.4955, 0.6714, -0.6228, -0.4581, 0.6343, -0.597, -0.4391, 0.6714, -0.6646, -0.3949, 0.6343, -0.637, -0.3782, 0.6717, 0.7569, 0.3487, 0.5528, 0.787, 0.2764, 0.5516, 0.8079, 0.2006, 0.5541, 0.8229, 0.119, 0.5556, 0.8306, 0.0374, 0.5556, 0.8305, -0.0443, 0.5553, 0.8221, -0.1255, 0.5554, 0.8057, -0.2053, 0.5556, 0.7817, -0.2834, 0.5555, 0.7501, -0.3586, 0.5557, 0.7115, -0.4303, 0.5556, 0.6659, -0.4978, 0.5557, 0.6139, -0.5608, 0.5556, 0.5559, -0.6182, 0.5557, 0.4925, -0.6699, 0.5556, 0.4246, -0.7149, 0.5556, 0.3525, -0.7531, 0.5556, 0.277, -0.784, 0.5556, 0.1986, -0.8074, 0.5555, 0.1186, -0.8233, 0.5551, 0.0374, -0.8307, 0.5555, -0.0441, -0.8303, 0.5556, -0.1254, -0.822, 0.5554, -0.1254, -0.822, 0.5554, -0.1254, -0.822, 0.5554, -0.2053, -0.8057, 0.5556, -0.2836, -0.7815, 0.5558, -0.3584, -0.7504, 0.5554, -0.4305, -0.7111, 0.5558, -0.4982, -0.6657, 0.5556, -0.5609, -0.6138, 0.5556, -0.6184, -0.5558, 0.5556, -0.6699, -0.4925, 0.5555, -0.7149, -0.4246, 0.5556, 0.8337, 0.2746, 0.479, 0.8602, 0.2075, 0.4659, 0.8764, 0.1266, 0.4646, 0.8828, 0.0447, 0.4677, 0.8807, -0.0469, 0.4713, 0.8717, -0.1331, 0.4715, 0.8717, -0.1331, 0.4715, 0.8717, -0.1331, 0.4715, 0.8547, -0.2178, 0.4712, 0.8289, -0.3006, 0.4717, 0.7958, -0.3804, 0.4712, 0.7545, -0.4566, 0.4714, 0.7064, -0.5279, 0.4714, 0.7064, -0.5279, 0.4714, 0.7064, -0.5279, 0.4714, 0.651, -0.5951, 0.4712, 0.5894, -0.6561, 0.4713, 0.5226, -0.7108, 0.4708, 0.4503, -0.7584, 0.4712, 0.3739, -0.7989, 0.4712, 0.2937, -0.8317, 0.4713, 0.2106, -0.8564, 0.4714, 0.126, -0.873, 0.4713, 0.0397, -0.8811, 0.4713, -0.0469, -0.8806, 0.4715, -0.1254, -0.822, 0.5554, -0.1254, -0.822, 0.5554, -0.133, -0.8719, 0.4712, -0.1254, -0.822, 0.5554, -0.2179, -0.8546, 0.4713, -0.3006, -0.829, 0.4715, -0.3804, -0.7959, 0.4711, -0.4562, -0.7549, 0.4712, -0.5282, -0.7063, 0.4713, -0.5949, -0.6511, 0.4714, -0.6557, -0.5897, 0.4715, -0.7105, -0.5225, 0.4714, -0.7584, -0.4502, 0.4714, 0.9145, 0.1198, 0.3865, 0.9247, 0.0488, 0.3775, 0.9226, -0.0492, 0.3826, 0.8717, -0.1331, 0.4715, 0.8717, -0.1331, 0.4715, 0.9133, -0.1397, 0.3827, 0.8717, -0.1331, 0.4715, 0.8953, -0.2281, 0.3826, 0.8687, -0.3146, 0.3827, 0.8337, -0.3986, 0.3821, 0.7905, -0.4784, 0.3825, 0.7064, -0.5279, 0.4714, 0.7064, -0.5279, 0.4714, 0.74, -0.5532, 0.3825, 0.7064, -0.5279, 0.4714, 0.6821, -0.6234, 0.3821, 0.6178, -0.687, 0.3826, 0.6821, -0.6234, 0.3821, 0.5474, -0.7443, 0.3826, 0.4718, -0.7946, 0.3821, 0.3916, -0.837, 0.3821, 0.3078, -0.8712, 0.3826, 0.2208, -0.8973, 0.3821, 0.1318, -0.9147, 0.3821, 0.0416, -0.923, 0.3826, -0.0492, -0.9226, 0.3826, -0.1394, -0.9133, 0.3826, -0.2283, -0.8952, 0.3828, -0.3147, -0.8687, 0.3826, -0.3986, -0.8337, 0.3821, -0.4784, -0.7904, 0.3826, -0.5534, -0.7399, 0.3826, -0.6235, -0.6819, 0.3826, -0.6871, -0.6177, 0.3826, -0.7443, -0.5474, 0.3826, -0.7946, -0.4715, 0.3825, 0.9574, 0.0431, 0.2854, 0.9562, -0.0488, 0.2885, 0.946, -0.1445, 0.2903, 0.9273, -0.2361, 0.2903, 0.8996, -0.3262, 0.2904, 0.8633, -0.413, 0.2901, 0.8186, -0.4955, 0.2904, 0.7663, -0.5733, 0.2902, 0.6821, -0.6234, 0.3821, 0.6821, -0.6234, 0.3821, 0.7065, -0.6455, 0.2902, 0.6396, -0.7117, 0.2903, 0.6821, -0.6234, 0.3821, 0.6821, -0.6234, 0.3821, 0.6396, -0.7117, 0.2903, 0.567, -0.7709, 0.2902, 0.6396, -0.7117, 0.2903, 0.4885, -0.8229, 0.2902, 0.4057, -0.8666, 0.2905, 0.3187, -0.9025, 0.2899, 0.2288, -0.9292, 0.2902, 0.1365, -0.9473, 0.2899, 0.0428, -0.956, 0.2902, -0.0507, -0.9556, 0.2903, -0.1444, -0.946, 0.2902, -0.2364, -0.9274, 0.2899, -0.3261, -0.8997, 0.2902, -0.4128, -0.8635, 0.2899, -0.4954, -0.8187, 0.2903, -0.5733, -0.7664, 0.2899, -0.6457, -0.7065, 0.2899, -0.7117, -0.6396, 0.2903, -0.7117, -0.6396, 0.2903, -0.7709, -0.5668, 0.2905, -0.7117, -0.6396, 0.2903, -0.8229, -0.4886, 0.2899, 0.9779, 0.0267, 0.2075, 0.9796, -0.0491, 0.1948, 0.9695, -0.148, 0.1953, 0.9505, -0.2423, 0.1948, 0.9221, -0.3343, 0.1948, 0.8847, -0.4234, 0.1951, 0.8392, -0.5077, 0.1948, 0.7851, -0.5879, 0.195, 0.724, -0.6617, 0.1948, 0.6553, -0.7297, 0.1952, 0.6396, -0.7117, 0.2903, 0.581, -0.7902, 0.1948, 0.6396, -0.7117, 0.2903, 0.6396, -0.7117, 0.2903, 0.5008, -0.8434, 0.1948, 0.4157, -0.8884, 0.1948, 0.3266, -0.9249, 0.1948, 0.2344, -0.9524, 0.1948, 0.1399, -0.9708, 0.1948, 0.0441, -0.9799, 0.1948, -0.0519, -0.9794, 0.1953, -0.1481, -0.9695, 0.1953, -0.2423, -0.9504, 0.1951, -0.334, -0.9221, 0.1952, -0.423, -0.8849, 0.1948, -0.5075, -0.8393, 0.1952, -0.5875, -0.7854, 0.1948, -0.6617, -0.724, 0.1948, -0.7295, -0.6557, 0.1948, -0.7117, -0.6396, 0.2903, -0.7902, -0.581, 0.1948, -0.7117, -0.6396, 0.2903, -0.7117, -0.6396, 0.2903, -0.8434, -0.5008, 0.1948, 0.9937, -0.0523, 0.099, 0.9838, -0.1501, 0.0979, 0.9644, -0.2456, 0.0981, 0.9356, -0.3392, 0.0979, 0.8979, -0.4292, 0.0979, 0.8515, -0.5152, 0.0979, 0.7972, -0.5958, 0.098, 0.7346, -0.6714, 0.0979, 0.6653, -0.7402, 0.0979, 0.5895, -0.8018, 0.0979, 0.5081, -0.8557, 0.0979, 0.4218, -0.9014, 0.0979, 0.3312, -0.9384, 0.0983, 0.2378, -0.9664, 0.0979, 0.1419, -0.985, 0.0979, 0.0447, -0.9942, 0.0979, -0.053, -0.9938, 0.0979, -0.1501, -0.9838, 0.0979, -0.2458, -0.9644, 0.0979, -0.3392, -0.9356, 0.0979, -0.4292, -0.8979, 0.0979, -0.5152, -0.8515, 0.0979, -0.5961, -0.7969, 0.0979, -0.6714, -0.7346, 0.0979, -0.7402, -0.6653, 0.0979, -0.8018, -0.5895, 0.0979, -0.8557, -0.5081, 0.0979, 0.995, -0.0027, 0.0998, 0.9549, 0.087, 0.2838, 0.8841, 0.2052, 0.4198, 0.7843, 0.3556, 0.5083, 0.1651, 0.9748, -0.1499, 0.1653, 0.9745, -0.1514, 0.1877, 0.9371, -0.2943, 0.1653, 0.9745, -0.1514, 0.1874, 0.9375, -0.2931, 0.1653, 0.9745, -0.1514, 0.2239, 0.8759, -0.4273, 0.2236, 0.8766, -0.4262, 0.2724, 0.7942, -0.5433, 0.2725, 0.7939, -0.5435, 0.3325, 0.6932, -0.6395, 0.3319, 0.6936, -0.6394, 0.3997, 0.58, -0.7099, 0.4002, 0.5798, -0.7097, 0.4741, 0.455, -0.7538, 0.4735, 0.4555, -0.7539, -0.501, 0.8432, -0.1951, -0.501, 0.8432, -0.1952, -0.4716, 0.7944, -0.3827, -0.4716, 0.7944, -0.3829, -0.4246, 0.7149, -0.5556, -0.4246, 0.7149, -0.5556, -0.3609, 0.6081, -0.7071, -0.3609, 0.6081, -0.7071, -0.2834, 0.4776, -0.8316, -0.2835, 0.4778, -0.8315, -0.1953, 0.3288, -0.924, -0.1954, 0.329, -0.9239, -0.0996, 0.1678, -0.9808, -0.0995, 0.1678, -0.9808, 0.1653, 0.9745, -0.1514, 0.1653, 0.9745, -0.1514, 0.1653, 0.9745, -0.1514, -0.9941, -0.0592, -0.0908, -0.9939, 0.029, -0.1059, -0.9806, -0.0816, -0.1781, -0.9939, 0.029, -0.1059, -0.9939, 0.029, -0.1059, -0.9782, 0.0023, -0.2077, -0.9526, -0.0408, -0.3016, -0.9586, -0.119, -0.2586, -0.9181, -0.0987, -0.3838, -0.929, -0.1686, -0.3294, -0.8762, -0.1693, -0.4513, -0.893, -0.2295, -0.387, -0.893, -0.2295, -0.387, -0.8282, -0.2502, -0.5015, -0.893, -0.2295, -0.387, -0.8519, -0.2986, -0.4303, -0.7761, -0.338, -0.5323, -0.8074, -0.3738, -0.4565, -0.9939, 0.029, -0.1059, -0.9662, 0.2193, -0.1357, -0.9459, 0.1854, -0.2661, -0.9939, 0.029, -0.1059, -0.9939, 0.029, -0.1059, -0.9132, 0.13, -0.3863, -0.869, 0.0561, -0.4917, -0.8152, -0.0347, -0.5782, -0.7538, -0.1381, -0.6424, -0.6873, -0.2503, -0.6819, -0.8984, 0.4086, -0.1612, -0.8744, 0.3682, -0.3161, -0.8354, 0.3025, -0.4589, -0.7829, 0.2144, -0.584, -0.7191, 0.1068, -0.6867, -0.6462, -0.0164, -0.763, -0.567, -0.1495, -0.81, -0.81, 0.5589, -0.1778, -0.7837, 0.5139, -0.3489, -0.7406, 0.4417, -0.5064, -0.6827, 0.3441, -0.6446, -0.6123, 0.2255, -0.7578, -0.532, 0.0897, -0.842, -0.4446, -0.0572, -0.8939, -0.7039, 0.6848, -0.1886, -0.6758, 0.6375, -0.3701, -0.63, 0.5609, -0.5372, -0.5688, 0.4574, -0.6836, -0.494, 0.3315, -0.8038, -0.4086, 0.1881, -0.8931, -0.3159, 0.0316, -0.9483, -0.5913, 0.7828, -0.1939, -0.5628, 0.7338, -0.3804, -0.5155, 0.6551, -0.5523, -0.4528, 0.5486, -0.7029, -0.3755, 0.4193, -0.8265, -0.2878, 0.2715, -0.9184, -0.1929, 0.111, -0.9749, -0.5415, 0.8178, -0.1949, -0.5125, 0.7689, -0.3822, -0.4654, 0.6896, -0.5549, -0.4019, 0.5828, -0.7063, -0.3247, 0.4526, -0.8305, -0.2365, 0.3041, -0.9228, -0.1408, 0.143, -0.9797, -0.9941, -0.0592, -0.0908, -0.9806, -0.0816, -0.1781, -0.9586, -0.119, -0.2586, -0.929, -0.1686, -0.3294, -0.893, -0.2295, -0.387, -0.893, -0.2295, -0.387, -0.8519, -0.2986, -0.4303, -0.893, -0.2295, -0.387, -0.8074, -0.3738, -0.4565, -0.761, -0.4517, -0.4656, -0.8599, -0.5104, -0, 0.5972, 0.4391, 0.6713, 0.6368, 0.3785, 0.6717, 0.5972, 0.4391, 0.6713, -0.8059, -0.592, 0, 0.5513, 0.4952, 0.6715, 0.5513, 0.4952, 0.6715, -0.7439, -0.6683, -0, 0.4998, 0.5471, 0.6715, 0.4998, 0.5471, 0.6715, -0.6743, -0.7385, -0, 0.444, 0.5934, 0.6714, 0.444, 0.5934, 0.6714, -0.5987, -0.801, -0, 0.3836, 0.6341, 0.6714, 0.3836, 0.6341, 0.6714, -0.518, -0.8554, 0, -0.431, -0.9024, 0, 0.3836, 0.6341, 0.6714, 0.3196, 0.6686, 0.6715, -0.341, -0.9401, 0, 0.3196, 0.6686, 0.6715, 0.2525, 0.6967, 0.6715, 0.183, 0.7181, 0.6715, 0.183, 0.7181, 0.6715, -0.247, -0.969, 0, 0.1118, 0.7325, 0.6715, 0.1118, 0.7325, 0.6715, -0.1506, -0.9886, -0, 0.0394, 0.7401, 0.6714, 0.0394, 0.7401, 0.6714, -0.0532, -0.9986, -0, 0.045, -0.999, -0, -0.0333, 0.74, 0.6718, 0.0394, 0.7401, 0.6714, -0.1058, 0.7334, 0.6716, -0.1058, 0.7334, 0.6716, 0.1426, -0.9898, 0, 0.2389, -0.9711, -0, -0.1772, 0.7195, 0.6715, -0.1058, 0.7334, 0.6716, -0.2467, 0.6989, 0.6714, 0.3332, -0.9429, 0, -0.2467, 0.6989, 0.6714, -0.3143, 0.6713, 0.6713, -0.2467, 0.6989, 0.6714, 0.424, -0.9056, -0, 0.424, -0.9056, -0, -0.3784, 0.637, 0.6716, 0.424, -0.9056, -0, 0.5107, -0.8598, -0, 0.424, -0.9056, -0, -0.3784, 0.637, 0.6716, -0.439, 0.5973, 0.6712, 0.5923, -0.8057, 0, -0.439, 0.5973, 0.6712, -0.4954, 0.5511, 0.6715, 0.6684, -0.7438, -0, -0.4954, 0.5511, 0.6715, -0.5471, 0.4998, 0.6715, 0.7383, -0.6744, 0, -0.5471, 0.4998, 0.6715, -0.5471, 0.4998, 0.6715, 0.8007, -0.5991, 0, -0.5934, 0.4441, 0.6714, 0.8558, -0.5173, 0, -0.5934, 0.4441, 0.6714, -0.634, 0.3837, 0.6714, 0.9023, -0.431, -0, -0.634, 0.3837, 0.6714, -0.6687, 0.3197, 0.6713, -0.6967, 0.2525, 0.6715, -0.6967, 0.2525, 0.6715, 0.9401, -0.3408, 0, -0.7182, 0.1831, 0.6714, -0.7182, 0.1831, 0.6714, 0.969, -0.2472, 0, -0.7326, 0.1118, 0.6714, -0.7326, 0.1118, 0.6714, 0.9886, -0.1509, 0, -0.7397, 0.0394, 0.6718, -0.7397, 0.0394, 0.6718, 0.9986, -0.0535, 0, 0.999, 0.045, -0, -0.7397, 0.0394, 0.6718, -0.7404, -0.0333, 0.6714, 0.9898, 0.1427, -0, -0.7404, -0.0333, 0.6714, -0.7335, -0.1057, 0.6715, 0.9711, 0.2388, -0, -0.7335, -0.1057, 0.6715, -0.7196, -0.1771, 0.6714, -0.6988, -0.2468, 0.6714, -0.6988, -0.2468, 0.6714, 0.9429, 0.3329, 0, 0.9429, 0.3329, 0, 0.9058, 0.4238, -0, -0.6713, -0.3141, 0.6714, -0.6988, -0.2468, 0.6714, 0.8599, 0.5105, -0, -0.637, -0.3782, 0.6717, -0.6713, -0.3141, 0.6714, 0.6711, 0.3144, 0.6714, -0.9056, -0.4242, 0, 0.6711, 0.3144, 0.6714, -0.9428, -0.3334, -0, 0.6711, 0.3144, 0.6714, 0.6989, 0.2464, 0.6714, -0.9711, -0.2388, -0, 0.6989, 0.2464, 0.6714, 0.7196, 0.177, 0.6714, 0.7334, 0.1061, 0.6714, -0.9898, -0.1427, -0, -0.999, -0.045, -0, 0.7334, 0.1061, 0.6714, 0.7402, 0.0332, 0.6715, 0.7401, -0.0393, 0.6714, 0.7401, -0.0393, 0.6714, -0.9986, 0.0534, 0, 0.7326, -0.1117, 0.6714, 0.7326, -0.1117, 0.6714, -0.9886, 0.1507, -0, 0.7181, -0.1832, 0.6714, 0.7181, -0.1832, 0.6714, -0.969, 0.2472, 0, -0.9402, 0.3407, -0, 0.7181, -0.1832, 0.6714, 0.6968, -0.2525, 0.6714, -0.9023, 0.4311, -0, 0.6686, -0.3197, 0.6714, 0.6686, -0.3197, 0.6714, -0.8554, 0.518, -0, 0.6686, -0.3197, 0.6714, 0.6342, -0.3834, 0.6714, -0.8008, 0.599, -0, 0.6342, -0.3834, 0.6714, 0.5934, -0.444, 0.6714, -0.7381, 0.6747, 0, 0.5934, -0.444, 0.6714, 0.547, -0.5001, 0.6713, -0.6684, 0.7438, 0, 0.547, -0.5001, 0.6713, 0.4953, -0.5512, 0.6714, -0.5923, 0.8058, -0, 0.4953, -0.5512, 0.6714, 0.439, -0.597, 0.6715, -0.5106, 0.8598, -0, 0.439, -0.597, 0.6715, 0.3784, -0.6369, 0.6717, -0.424, 0.9057, -0, 0.3784, -0.6369, 0.6717, 0.3141, -0.6713, 0.6713, 0.2468, -0.6987, 0.6715, -0.333, 0.9429, 0, 0.2468, -0.6987, 0.6715, 0.177, -0.7197, 0.6714, -0.2389, 0.971, -0, 0.177, -0.7197, 0.6714, 0.1057, -0.7335, 0.6715, -0.1426, 0.9898, 0, 0.1057, -0.7335, 0.6715, -0.0449, 0.999, 0, 0.1057, -0.7335, 0.6715, 0.0335, -0.7403, 0.6715, -0.0395, -0.7401, 0.6714, 0.0533, 0.9986, -0, -0.0395, -0.7401, 0.6714, -0.1117, -0.7326, 0.6714, 0.1508, 0.9886, 0, -0.1117, -0.7326, 0.6714, -0.183, -0.7181, 0.6714, -0.183, -0.7181, 0.6714, 0.247, 0.969, 0, -0.2527, -0.6966, 0.6715, -0.2527, -0.6966, 0.6715, 0.3409, 0.9401, 0, -0.3198, -0.6686, 0.6713, -0.3198, -0.6686, 0.6713, 0.4312, 0.9023, 0, -0.3836, -0.6341, 0.6714, -0.3836, -0.6341, 0.6714, 0.5176, 0.8556, -0, -0.4441, -0.5932, 0.6714, -0.4441, -0.5932, 0.6714, 0.599, 0.8008, -0, -0.4441, -0.5932, 0.6714, 0.6747, 0.7381, -0, -0.4441, -0.5932, 0.6714, -0.4998, -0.5471, 0.6715, -0.5511, -0.4955, 0.6714, -0.5511, -0.4955, 0.6714, 0.7436, 0.6686, -0, 0.8057, 0.5924, -0, -0.5511, -0.4955, 0.6714, -0.597, -0.4391, 0.6714, 0.8599, 0.5105, -0, -0.597, -0.4391, 0.6714, -0.637, -0.3782, 0.6717, -0.8057, -0.5924, 0, -0.8599, -0.5105, 0, -0.7437, -0.6685, 0, -0.6743, -0.7385, -0, -0.5986, -0.801, 0, -0.5181, -0.8553, 0, -0.431, -0.9024, 0, -0.3408, -0.9401, -0, -0.247, -0.969, 0, -0.1508, -0.9886, 0, -0.0532, -0.9986, -0, 0.0449, -0.999, 0, 0.1426, -0.9898, 0, 0.239, -0.971, 0, 0.333, -0.9429, 0, 0.424, -0.9056, -0, 0.4238, -0.9058, 0, 0.424, -0.9056, -0, 0.5105, -0.8599, 0, 0.5924, -0.8057, 0, 0.6685, -0.7437, -0, 0.7382, -0.6746, -0, 0.8007, -0.599, -0, 0.8558, -0.5173, 0, 0.9024, -0.431, 0, 0.9401, -0.3408, 0, 0.969, -0.247, -0, 0.9886, -0.1508, -0, 0.9986, -0.0532, -0, 0.999, 0.0449, -0, 0.9898, 0.1426, -0, 0.971, 0.239, -0, 0.9429, 0.333, -0, 0.9429, 0.3329, 0, 0.9058, 0.4238, -0, 0.9429, 0.3329, 0, 0.8599, 0.5105, -0, -0.906, -0.4234, -0, -0.943, -0.3327, -0, -0.971, -0.239, 0, -0.9898, -0.1426, -0, -0.999, -0.0449, -0, -0.9986, 0.0532, -0, -0.9886, 0.1508, -0, -0.969, 0.247, 0, -0.9401, 0.3408, 0, -0.9022, 0.4313, -0, -0.8556, 0.5177, -0, -0.8007, 0.599, 0, -0.7382, 0.6746, 0, -0.6685, 0.7437, -0, -0.5924, 0.8057, 0, -0.5105, 0.8599, 0, -0.4238, 0.9058, 0, -0.333, 0.9429, 0, -0.239, 0.971, 0, -0.1426, 0.9898, 0, -0.0449, 0.999, 0, 0.0532, 0.9986, -0, 0.1508, 0.9886, 0, 0.247, 0.969, 0, 0.3408, 0.9401, 0, 0.4313, 0.9022, -0, 0.5177, 0.8556, -0, 0.599, 0.8007, -0, 0.6746, 0.7382, 0, 0.7437, 0.6685, -0, 0.8057, 0.5924, -0, 0.8599, 0.5105, -0, 0, -0, -1, -0.005, 0.1022, -0.9948, -0.0758, 0.0687, -0.9948, -0.1022, -0.005, -0.9948, -0.0687, -0.0758, -0.9948, 0.005, -0.1022, -0.9948, 0.0758, -0.0687, -0.9948, 0.1022, 0.005, -0.9948, 0.0687, 0.0758, -0.9948, 0.0279, 0.1915, -0.9811, -0.0466, 0.1877, -0.9811, -0.1158, 0.1549, -0.9811, -0.1659, 0.0999, -0.9811, -0.1916, 0.0279, -0.9811, -0.188, -0.0466, -0.9811, -0.1552, -0.1156, -0.9811, -0.1, -0.166, -0.9811, -0.0279, -0.1915, -0.9811, 0.0465, -0.188, -0.9811, 0.1158, -0.1553, -0.9811, 0.1658, -0.0999, -0.9811, 0.1916, -0.0278, -0.9811, 0.1879, 0.0465, -0.9811, 0.1552, 0.116, -0.9811, 0.1, 0.1656, -0.9811, 0.0429, 0.2891, -0.9563, -0.071, 0.2831, -0.9565, -0.174, 0.235, -0.9563, -0.2505, 0.1503, -0.9564, -0.289, 0.0427, -0.9564, -0.2834, -0.071, -0.9564, -0.2346, -0.174, -0.9564, -0.1502, -0.2506, -0.9564, -0.0429, -0.2891, -0.9563, 0.071, -0.2834, -0.9564, 0.174, -0.2346, -0.9564, 0.2505, -0.1503, -0.9564, 0.289, -0.0427, -0.9564, 0.2833, 0.0709, -0.9564, 0.2346, 0.1739, -0.9564, 0.1502, 0.2503, -0.9565, 0.019, 0.3784, -0.9254, -0.056, 0.3746, -0.9255, -0.1272, 0.357, -0.9254, -0.1951, 0.325, -0.9254, -0.2542, 0.2808, -0.9255, -0.3046, 0.2251, -0.9255, -0.3423, 0.1625, -0.9254, -0.3676, 0.0916, -0.9255, -0.3784, 0.0191, -0.9254, -0.3748, -0.0561, -0.9254, -0.3569, -0.1274, -0.9254, -0.3247, -0.1953, -0.9254, -0.2811, -0.254, -0.9255, -0.2253, -0.3044, -0.9255, -0.1624, -0.3422, -0.9255, -0.0917, -0.3677, -0.9254, -0.019, -0.3784, -0.9254, 0.056, -0.3746, -0.9255, 0.1272, -0.357, -0.9254, 0.1951, -0.3247, -0.9255, 0.2541, -0.2811, -0.9254, 0.3046, -0.2255, -0.9254, 0.3423, -0.1625, -0.9254, 0.3675, -0.0915, -0.9255, 0.3784, -0.019, -0.9254, 0.3748, 0.0557, -0.9254, 0.3569, 0.1274, -0.9254, 0.3247, 0.1953, -0.9254, 0.281, 0.2541, -0.9254, 0.281, 0.2541, -0.9254, 0.2254, 0.3044, -0.9255, 0.281, 0.2541, -0.9254, 0.1624, 0.3425, -0.9254, 0.0917, 0.3677, -0.9254, 0.0232, 0.4715, -0.8815, 0.0232, 0.4715, -0.8815, -0.0693, 0.4669, -0.8816, -0.1591, 0.4441, -0.8817, -0.2426, 0.4051, -0.8815, -0.3169, 0.3495, -0.8817, -0.3791, 0.2808, -0.8817, -0.4266, 0.2015, -0.8817, -0.4578, 0.1145, -0.8817, -0.4714, 0.0233, -0.8816, -0.4668, -0.0694, -0.8816, -0.4443, -0.1591, -0.8816, -0.4048, -0.2426, -0.8816, -0.3496, -0.317, -0.8816, -0.2811, -0.3792, -0.8816, -0.2017, -0.4265, -0.8817, -0.1147, -0.4578, -0.8816, -0.0232, -0.4715, -0.8816, 0.0693, -0.4669, -0.8816, 0.1589, -0.4444, -0.8816, 0.2426, -0.4048, -0.8816, 0.3169, -0.3498, -0.8816, 0.379, -0.2811, -0.8817, 0.4265, -0.2018, -0.8817, 0.4578, -0.1148, -0.8816, 0.4713, -0.0233, -0.8816, 0.4668, 0.0694, -0.8816, 0.4713, -0.0233, -0.8816, 0.4443, 0.1587, -0.8817, 0.4048, 0.2426, -0.8817, 0.3497, 0.3166, -0.8817, 0.281, 0.2541, -0.9254, 0.281, 0.2541, -0.9254, 0.2811, 0.3792, -0.8816, 0.2017, 0.4265, -0.8817, 0.1146, 0.4578, -0.8816, 0.0232, 0.4715, -0.8815, 0.0232, 0.4715, -0.8815, 0.0279, 0.5669, -0.8233, 0.0232, 0.4715, -0.8815, -0.0833, 0.5615, -0.8233, -0.1912, 0.5347, -0.8231, -0.2919, 0.4868, -0.8233, -0.3813, 0.4204, -0.8233, -0.4559, 0.338, -0.8233, -0.5131, 0.2426, -0.8233, -0.5507, 0.1381, -0.8232, -0.5669, 0.0279, -0.8233, -0.5615, -0.0832, -0.8233, -0.5345, -0.1911, -0.8233, -0.4869, -0.2918, -0.8232, -0.4206, -0.3815, -0.8232, -0.4869, -0.2918, -0.8232, -0.3382, -0.4559, -0.8233, -0.2427, -0.5131, -0.8233, -0.1379, -0.5508, -0.8232, -0.0278, -0.5669, -0.8233, 0.0833, -0.5616, -0.8232, 0.1912, -0.5345, -0.8233, 0.2918, -0.4871, -0.8232, 0.3813, -0.4207, -0.8232, 0.4558, -0.3384, -0.8232, 0.5131, -0.2426, -0.8233, 0.5506, -0.1381, -0.8232, 0.5669, -0.0278, -0.8233, 0.4713, -0.0233, -0.8816, 0.5506, -0.1381, -0.8232, 0.5615, 0.0832, -0.8233, 0.4713, -0.0233, -0.8816, 0.5344, 0.1915, -0.8232, 0.4869, 0.2922, -0.8232, 0.4206, 0.3815, -0.8232, 0.3381, 0.4562, -0.8231, 0.2427, 0.5134, -0.8231, 0.1379, 0.5508, -0.8232, 0.0232, 0.4715, -0.8815, 0.0004, 0.605, -0.7962, -0.0598, 0.602, -0.7962, -0.1177, 0.5936, -0.7961, -0.1762, 0.579, -0.796, -0.2312, 0.5592, -0.7961, -0.2857, 0.5333, -0.7962, -0.336, 0.5035, -0.796, -0.3843, 0.4676, -0.796, -0.4278, 0.428, -0.7961, -0.4682, 0.3837, -0.796, -0.5031, 0.3365, -0.7961, -0.5341, 0.2845, -0.7961, -0.559, 0.2319, -0.7961, -0.5792, 0.1754, -0.7961, -0.5935, 0.1182, -0.7961, -0.6023, 0.0587, -0.7961, -0.6052, 0.0004, -0.7961, -0.6023, -0.0599, -0.796, -0.5937, -0.1175, -0.796, -0.579, -0.1763, -0.7961, -0.5594, -0.2312, -0.796, -0.5336, -0.2857, -0.796, -0.4869, -0.2918, -0.8232, -0.4869, -0.2918, -0.8232, -0.5034, -0.3361, -0.796, -0.4676, -0.3841, -0.7961, -0.4869, -0.2918, -0.8232, -0.4283, -0.4276, -0.796, -0.4283, -0.4276, -0.796, -0.3837, -0.468, -0.7961, -0.4283, -0.4276, -0.796, -0.3365, -0.5031, -0.796, -0.2849, -0.534, -0.796, -0.232, -0.5589, -0.7961, -0.1752, -0.5794, -0.796, -0.1184, -0.5935, -0.796, -0.1184, -0.5935, -0.796, -0.0589, -0.6023, -0.7961, -0.1184, -0.5935, -0.796, -0.0004, -0.6053, -0.796, 0.0597, -0.6023, -0.796, 0.1177, -0.5936, -0.7961, 0.1762, -0.579, -0.7961, 0.2312, -0.5592, -0.7961, 0.2857, -0.5336, -0.796, 0.336, -0.5035, -0.796, 0.3843, -0.4676, -0.796, 0.4278, -0.4283, -0.796, 0.4682, -0.3837, -0.796, 0.5031, -0.3365, -0.796, 0.534, -0.2849, -0.796, 0.559, -0.2319, -0.7961, 0.5506, -0.1381, -0.8232, 0.5794, -0.1751, -0.796, 0.5506, -0.1381, -0.8232, 0.5506, -0.1381, -0.8232, 0.5935, -0.1187, -0.796, 0.6023, -0.0587, -0.7961, 0.5506, -0.1381, -0.8232, 0.6052, -0.0004, -0.7961, 0.6023, 0.0595, -0.796, 0.5937, 0.1175, -0.7961, 0.579, 0.1763, -0.796, 0.5594, 0.2312, -0.796, 0.5337, 0.2853, -0.7961, 0.5035, 0.3357, -0.7961, 0.4676, 0.3845, -0.796, 0.4283, 0.4281, -0.7958, 0.3836, 0.4685, -0.7958, 0.3366, 0.5028, -0.7962, 0.2849, 0.534, -0.796, 0.232, 0.5591, -0.796, 0.1753, 0.5791, -0.7962, 0.1184, 0.5935, -0.7961, 0.0589, 0.6027, -0.7958, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, 0, -0, 1, -0.4283, -0.4276, -0.796, -0.4283, -0.4276, -0.796, 0, -0, 1, -0.1184, -0.5935, -0.796, -0.1184, -0.5935, -0.796, -0.1184, -0.5935, -0.796, 0, -0, 1, 0, -0, 1, -0.0758, 0.0687, 0.9948, -0.005, 0.1022, 0.9948, -0.1022, -0.005, 0.9948, -0.0687, -0.0758, 0.9948, 0.005, -0.1022, 0.9948, 0.0758, -0.0687, 0.9948, 0.1022, 0.005, 0.9948, 0.0687, 0.0758, 0.9948, -0.0466, 0.1877, 0.9811, 0.0279, 0.1915, 0.9811, -0.1158, 0.1549, 0.9811, -0.1658, 0.0999, 0.9811, -0.1916, 0.0278, 0.9811, -0.188, -0.0466, 0.9811, -0.1552, -0.1156, 0.9811, -0.1, -0.1659, 0.9811, -0.0279, -0.1915, 0.9811, 0.0466, -0.188, 0.9811, 0.1158, -0.1552, 0.9811, 0.1658, -0.0999, 0.9811, 0.1916, -0.0279, 0.9811, 0.1879, 0.0465, 0.9811, 0.1552, 0.1159, 0.9811, 0.1, 0.1656, 0.9811, 0.0429, 0.2891, 0.9563, -0.071, 0.2831, 0.9565, -0.174, 0.235, 0.9563, -0.2505, 0.1503, 0.9564, -0.289, 0.0427, 0.9564, -0.2834, -0.071, 0.9564, -0.2346, -0.174, 0.9564, -0.1502, -0.2506, 0.9564, -0.0429, -0.2891, 0.9563, 0.071, -0.2834, 0.9564, 0.174, -0.2346, 0.9564, 0.2505, -0.1503, 0.9564, 0.289, -0.0427, 0.9564, 0.2833, 0.0709, 0.9564, 0.2346, 0.174, 0.9564, 0.1502, 0.2503, 0.9565, 0.019, 0.3784, 0.9254, -0.056, 0.3746, 0.9255, -0.1272, 0.357, 0.9254, -0.1951, 0.325, 0.9254, -0.2542, 0.2808, 0.9255, -0.3046, 0.2251, 0.9255, -0.3423, 0.1625, 0.9254, -0.3676, 0.0915, 0.9255, -0.3784, 0.0191, 0.9254, -0.3748, -0.0561, 0.9254, -0.3569, -0.1274, 0.9254, -0.3247, -0.1953, 0.9254, -0.2811, -0.254, 0.9255, -0.2253, -0.3044, 0.9255, -0.1624, -0.3422, 0.9255, -0.0917, -0.3677, 0.9254, -0.019, -0.3784, 0.9254, 0.056, -0.3746, 0.9255, 0.1272, -0.357, 0.9254, 0.1951, -0.3247, 0.9255, 0.2541, -0.2811, 0.9254, 0.3046, -0.2255, 0.9254, 0.3423, -0.1625, 0.9254, 0.3676, -0.0916, 0.9255, 0.3784, -0.0191, 0.9254, 0.3748, 0.0557, 0.9254, 0.3569, 0.1274, 0.9254, 0.3247, 0.1953, 0.9254, 0.2811, 0.254, 0.9255, 0.2253, 0.3044, 0.9255, 0.1624, 0.3425, 0.9254, 0.0917, 0.3677, 0.9254, 0.0232, 0.4715, 0.8815, -0.0692, 0.467, 0.8816, 0.0232, 0.4715, 0.8815, -0.1591, 0.4441, 0.8817, -0.2426, 0.4051, 0.8815, -0.3169, 0.3494, 0.8817, -0.3791, 0.2808, 0.8817, -0.4266, 0.2015, 0.8817, -0.4578, 0.1145, 0.8817, -0.4714, 0.0233, 0.8816, -0.4668, -0.0694, 0.8816, -0.4443, -0.1591, 0.8817, -0.4047, -0.2426, 0.8817, -0.3497, -0.317, 0.8816, -0.2811, -0.3792, 0.8816, -0.2017, -0.4265, 0.8817, -0.1147, -0.4578, 0.8816, -0.0232, -0.4715, 0.8815, -0.0232, -0.4715, 0.8815, -0.0232, -0.4715, 0.8815, 0.0692, -0.4669, 0.8816, 0.1589, -0.4445, 0.8816, 0.2426, -0.4048, 0.8817, 0.3169, -0.3498, 0.8816, 0.379, -0.2811, 0.8817, 0.4266, -0.2018, 0.8817, 0.4578, -0.1148, 0.8816, 0.4713, -0.0233, 0.8816, 0.4713, -0.0233, 0.8816, 0.4668, 0.0694, 0.8816, 0.4713, -0.0233, 0.8816, 0.4443, 0.1587, 0.8817, 0.4048, 0.2426, 0.8816, 0.3497, 0.3166, 0.8817, 0.2811, 0.3792, 0.8816, 0.2017, 0.4265, 0.8817, 0.1147, 0.4578, 0.8816, 0.0232, 0.4715, 0.8815, 0.0232, 0.4715, 0.8815, 0.0279, 0.5669, 0.8233, -0.0833, 0.5615, 0.8233, 0.0232, 0.4715, 0.8815, -0.1912, 0.5347, 0.8231, -0.2919, 0.4868, 0.8233, -0.3813, 0.4204, 0.8233, -0.4559, 0.338, 0.8233, -0.5131, 0.2426, 0.8233, -0.5507, 0.1381, 0.8232, -0.5669, 0.0278, 0.8233, -0.5615, -0.0832, 0.8233, -0.5345, -0.1911, 0.8233, -0.4869, -0.2918, 0.8232, -0.4206, -0.3815, 0.8232, -0.4869, -0.2918, 0.8232, -0.3382, -0.4559, 0.8233, -0.2427, -0.5131, 0.8233, -0.1379, -0.5508, 0.8232, -0.0232, -0.4715, 0.8815, -0.0232, -0.4715, 0.8815, -0.0278, -0.5669, 0.8233, 0.0833, -0.5616, 0.8232, -0.0232, -0.4715, 0.8815, -0.0232, -0.4715, 0.8815, 0.1912, -0.5345, 0.8233, 0.2918, -0.4871, 0.8232, 0.3812, -0.4207, 0.8232, 0.4558, -0.3384, 0.8232, 0.5131, -0.2426, 0.8233, 0.5506, -0.1381, 0.8232, 0.5669, -0.0278, 0.8233, 0.5506, -0.1381, 0.8232, 0.4713, -0.0233, 0.8816, 0.4713, -0.0233, 0.8816, 0.5615, 0.0832, 0.8233, 0.5344, 0.1915, 0.8232, 0.4869, 0.2922, 0.8231, 0.4206, 0.3815, 0.8232, 0.3381, 0.4562, 0.8231, 0.2427, 0.5134, 0.8231, 0.1379, 0.5508, 0.8232, 0.0232, 0.4715, 0.8815, 0.0004, 0.605, 0.7962, -0.0598, 0.602, 0.7962, -0.1177, 0.5936, 0.7961, -0.1761, 0.579, 0.7961, -0.2313, 0.5592, 0.7961, -0.2857, 0.5333, 0.7962, -0.3359, 0.5035, 0.796, -0.3843, 0.4677, 0.796, -0.4278, 0.428, 0.7961, -0.4682, 0.3837, 0.796, -0.5031, 0.3364, 0.7961, -0.5341, 0.2846, 0.7961, -0.559, 0.2319, 0.7961, -0.5792, 0.1755, 0.7961, -0.5935, 0.1183, 0.7961, -0.6023, 0.0588, 0.7961, -0.6052, 0.0003, 0.7961, -0.6022, -0.0599, 0.7961, -0.5937, -0.1175, 0.796, -0.579, -0.1763, 0.7961, -0.5594, -0.2311, 0.796, -0.4869, -0.2918, 0.8232, -0.5336, -0.2857, 0.796, -0.4869, -0.2918, 0.8232, -0.5035, -0.336, 0.796, -0.4869, -0.2918, 0.8232, -0.4677, -0.3841, 0.7961, -0.4869, -0.2918, 0.8232, -0.4284, -0.4276, 0.796, -0.3837, -0.468, 0.7961, -0.3365, -0.5031, 0.796, -0.2849, -0.534, 0.796, -0.2321, -0.5589, 0.7961, -0.1753, -0.5794, 0.796, -0.1185, -0.5935, 0.7961, -0.0589, -0.6023, 0.7961, -0.0004, -0.6053, 0.796, 0.0598, -0.6023, 0.796, 0.1177, -0.5936, 0.7961, 0.1762, -0.579, 0.7961, 0.2313, -0.5592, 0.7961, 0.2857, -0.5336, 0.796, 0.3359, -0.5035, 0.796, 0.3843, -0.4676, 0.796, 0.4277, -0.4283, 0.796, 0.4682, -0.3837, 0.796, 0.5031, -0.3364, 0.796, 0.5031, -0.3364, 0.796, 0.5031, -0.3364, 0.796, 0.534, -0.2849, 0.796, 0.559, -0.2319, 0.7961, 0.5506, -0.1381, 0.8232, 0.5506, -0.1381, 0.8232, 0.5794, -0.1751, 0.796, 0.5506, -0.1381, 0.8232, 0.5935, -0.1186, 0.796, 0.6023, -0.0587, 0.7961, 0.5506, -0.1381, 0.8232, 0.6052, -0.0003, 0.7961, 0.6023, 0.0595, 0.7961, 0.5937, 0.1175, 0.796, 0.579, 0.1763, 0.7961, 0.5594, 0.2311, 0.796, 0.5337, 0.2853, 0.7961, 0.5035, 0.3357, 0.7961, 0.4676, 0.3845, 0.796, 0.4282, 0.4281, 0.7958, 0.3836, 0.4685, 0.7958, 0.3366, 0.5028, 0.7962, 0.2849, 0.534, 0.796, 0.232, 0.5592, 0.796, 0.1753, 0.5791, 0.7962, 0.1185, 0.5935, 0.7961, 0.0589, 0.6027, 0.7958, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0, -0, -1, 0.5031, -0.3364, 0.796, 0.5031, -0.3364, 0.796, 0.5031, -0.3364, 0.796, 0, -0, -1, 0.8618, 0.5072, -0.0002, 0.9147, 0.3861, -0.1198, 0.9218, 0.3876, -0.0003, 0.8548, 0.5035, -0.1254, 0.8496, 0.3792, -0.3666, 0.8341, 0.4906, -0.2524, 0.7982, 0.47, -0.3767, 0.8862, 0.3899, -0.2503, 0.8142, 0.3296, -0.478, 0.7491, 0.4403, -0.495, 0.8927, 0.3052, -0.3317, 0.8749, 0.2258, -0.4284, 0.929, 0.3205, -0.1851, 0.934, 0.2358, -0.2685, 0.9266, 0.1373, -0.3501, 0.9658, 0.1755, -0.1906, 0.9589, 0.2617, -0.1094, 0.9658, 0.1755, -0.1906, 0.9658, 0.1755, -0.1906, 0.9664, 0.069, -0.2477, 0.9658, 0.1755, -0.1906, 0.9658, 0.1755, -0.1906, 0.9837, 0.1465, -0.104, 0.9658, 0.1755, -0.1906, 0.9914, 0.0263, -0.1279, 0.9658, 0.1755, -0.1906, 0.9641, 0.2655, -0.0002, 0.99, 0.1412, -0, 0.9999, 0.0122, -0, 0.959, 0.2617, 0.1093, 0.9837, 0.1465, 0.104, 0.9914, 0.0263, 0.1279, 0.9659, 0.1755, 0.1906, 0.9664, 0.069, 0.2477, 0.9293, 0.3196, 0.185, 0.934, 0.2358, 0.2685, 0.9266, 0.1373, 0.3501, 0.8927, 0.3052, 0.3316, 0.8863, 0.3899, 0.25, 0.8749, 0.2258, 0.4284, 0.8496, 0.3792, 0.3666, 0.8142, 0.3296, 0.478, 0.8341, 0.4906, 0.252, 0.7982, 0.47, 0.3767, 0.7491, 0.4403, 0.495, 0.7671, 0.2693, -0.5823, 0.6876, 0.4043, -0.6031, 0.614, 0.3609, -0.702, 0.7066, 0.2037, -0.6777, 0.8408, 0.1434, -0.5221, 0.7925, 0.0572, -0.6071, 0.9041, 0.0351, -0.426, 0.7925, 0.0572, -0.6071, 0.866, -0.0687, -0.4954, 0.7925, 0.0572, -0.6071, 0.9523, -0.0477, -0.3015, 0.9221, -0.1648, -0.3502, 0.9827, -0.1, -0.1561, 0.9572, -0.2254, -0.1815, 0.9931, -0.1175, 0, 0.9693, -0.2461, 0, 0.9827, -0.1, 0.1561, 0.9572, -0.2255, 0.1816, 0.9523, -0.0477, 0.3015, 0.9221, -0.1648, 0.3502, 0.9041, 0.0351, 0.426, 0.866, -0.0687, 0.4954, 0.8408, 0.1434, 0.5221, 0.7925, 0.0572, 0.6072, 0.7671, 0.2693, 0.5823, 0.7066, 0.2037, 0.6776, 0.6876, 0.4043, 0.6031, 0.614, 0.3609, 0.702, 0.5294, 0.3113, -0.7892, 0.6336, 0.1343, -0.762, 0.4357, 0.2555, -0.863, 0.5495, 0.0626, -0.8331, 0.4357, 0.2555, -0.863, 0.7303, -0.0302, -0.6825, 0.7925, 0.0572, -0.6071, 0.7925, 0.0572, -0.6071, 0.6551, -0.1175, -0.7463, 0.813, -0.1713, -0.5566, 0.7925, 0.0572, -0.6071, 0.7455, -0.2716, -0.6087, 0.8761, -0.2793, -0.3931, 0.8146, -0.3895, -0.4299, 0.9154, -0.3471, -0.2037, 0.8577, -0.4635, -0.2225, 0.9289, -0.3704, 0, 0.8725, -0.4887, -0, 0.9154, -0.3471, 0.2037, 0.8577, -0.4635, 0.2225, 0.8761, -0.2793, 0.3931, 0.8146, -0.3894, 0.4299, 0.8129, -0.1713, 0.5566, 0.7455, -0.2716, 0.6087, 0.7303, -0.0302, 0.6825, 0.6551, -0.1175, 0.7463, 0.6336, 0.1343, 0.762, 0.5495, 0.0626, 0.8331, 0.5294, 0.3113, 0.7892, 0.4358, 0.2556, 0.863, 0.3339, 0.196, -0.922, 0.4556, -0.0107, -0.8901, 0.4357, 0.2555, -0.863, 0.2267, 0.1326, -0.9649, 0.3539, -0.084, -0.9315, 0.5686, -0.2029, -0.7972, 0.4719, -0.285, -0.8343, 0.6649, -0.3674, -0.6503, 0.5729, -0.457, -0.6804, 0.7389, -0.4932, -0.4591, 0.6502, -0.5886, -0.4804, 0.785, -0.5722, -0.2375, 0.6985, -0.671, -0.2485, 0.8008, -0.599, -0, 0.6985, -0.671, -0.2485, 0.6985, -0.671, -0.2485, 0.7149, -0.6992, 0, 0.785, -0.5722, 0.2375, 0.6985, -0.671, 0.2485, 0.6985, -0.671, 0.2485, 0.7388, -0.4933, 0.4591, 0.6502, -0.5886, 0.4804, 0.6985, -0.671, 0.2485, 0.6649, -0.3674, 0.6503, 0.5729, -0.457, 0.6804, 0.5686, -0.2029, 0.7972, 0.472, -0.2849, 0.8343, 0.4556, -0.0107, 0.8901, 0.3539, -0.0839, 0.9315, 0.334, 0.1961, 0.922, 0.2267, 0.1326, 0.9649, 0.1178, 0.0683, -0.9907, 0.2475, -0.156, -0.9563, 0.0629, 0.0359, -0.9974, 0.193, -0.1911, -0.9624, 0.3667, -0.3621, -0.857, 0.3116, -0.3985, -0.8626, 0.4705, -0.5389, -0.6987, 0.4164, -0.5761, -0.7034, 0.5497, -0.6742, -0.4933, 0.4963, -0.7121, -0.4966, 0.5996, -0.7585, -0.2553, 0.6985, -0.671, -0.2485, 0.5466, -0.797, -0.257, 0.6985, -0.671, -0.2485, 0.6169, -0.787, -0, 0.6985, -0.671, -0.2485, 0.5637, -0.8259, -0, 0.5637, -0.8259, -0, 0.6985, -0.671, 0.2485, 0.5997, -0.7584, 0.2553, 0.6985, -0.671, 0.2485, 0.5637, -0.8259, -0, 0.5637, -0.8259, -0, 0.5466, -0.797, 0.257, 0.6985, -0.671, 0.2485, 0.5499, -0.674, 0.4932, 0.4963, -0.7121, 0.4966, 0.4706, -0.5388, 0.6987, 0.4163, -0.5761, 0.7034, 0.3668, -0.362, 0.857, 0.3116, -0.3985, 0.8626, 0.2475, -0.156, 0.9563, 0.193, -0.1911, 0.9624, 0.1178, 0.0683, 0.9907, 0.0629, 0.0358, 0.9974, 0.9147, 0.386, 0.1192, 0.9147, 0.386, 0.1192, 0.9147, 0.386, 0.1192, 0.8549, 0.5036, 0.1249, 0.9147, 0.386, 0.1192, 0.9147, 0.386, 0.1192, 0.9147, 0.386, 0.1192, 0.9147, 0.386, 0.1192, 0.7818, 0.6119, -0.1197, 0.7868, 0.6173, -0.0003, 0.7441, 0.5585, -0.3667, 0.7712, 0.5852, -0.2505, 0.6835, 0.5515, -0.4782, 0.7006, 0.6317, -0.3319, 0.6226, 0.6546, -0.4287, 0.7309, 0.6569, -0.1854, 0.6589, 0.7026, -0.2687, 0.57, 0.7432, -0.3504, 0.6222, 0.7592, -0.1909, 0.6938, 0.7118, -0.1095, 0.529, 0.8116, -0.2478, 0.6056, 0.7889, -0.1042, 0.5044, 0.8539, -0.1282, 0.6035, 0.7974, -0, 0.7001, 0.7141, -0.0002, 0.496, 0.8683, -0, 0.6056, 0.7889, 0.1042, 0.6939, 0.7118, 0.1094, 0.5044, 0.8539, 0.1282, 0.6222, 0.7592, 0.1909, 0.529, 0.8116, 0.2478, 0.7309, 0.6569, 0.1852, 0.6589, 0.7026, 0.2686, 0.57, 0.7432, 0.3504, 0.7714, 0.5852, 0.2501, 0.7006, 0.6317, 0.3318, 0.6226, 0.6547, 0.4287, 0.7441, 0.5585, 0.3667, 0.6835, 0.5515, 0.4781, 0.6079, 0.5394, -0.5827, 0.5213, 0.5181, -0.6781, 0.5333, 0.6653, -0.5225, 0.4347, 0.6646, -0.6077, 0.4697, 0.773, -0.4265, 0.3602, 0.7903, -0.4957, 0.4201, 0.8559, -0.3015, 0.3033, 0.886, -0.3508, 0.3893, 0.9078, -0.1562, 0.2674, 0.9463, -0.1819, 0.379, 0.9254, 0, 0.255, 0.9669, 0, 0.3893, 0.9078, 0.1562, 0.2674, 0.9463, 0.1819, 0.4201, 0.8559, 0.3015, 0.3034, 0.8859, 0.3508, 0.4696, 0.773, 0.4266, 0.3602, 0.7903, 0.4957, 0.5333, 0.6653, 0.5225, 0.4347, 0.6646, 0.6078, 0.6079, 0.5394, 0.5827, 0.5213, 0.5181, 0.6781, 0.425, 0.4883, -0.7622, 0.4357, 0.2555, -0.863, 0.3216, 0.4493, -0.8335, 0.4357, 0.2555, -0.863, 0.3282, 0.6523, -0.6832, 0.2153, 0.6286, -0.7473, 0.2447, 0.7934, -0.5573, 0.1238, 0.7828, -0.6098, 0.1806, 0.9012, -0.394, 0.0539, 0.901, -0.4305, 0.1402, 0.9689, -0.204, 0.0101, 0.9748, -0.2229, 0.1264, 0.992, 0, -0.0049, 1, 0, 0.1401, 0.9689, 0.204, 0.0101, 0.9748, 0.2229, 0.1806, 0.9012, 0.394, 0.0539, 0.901, 0.4305, 0.2447, 0.7934, 0.5573, 0.1238, 0.7828, 0.6098, 0.3282, 0.6523, 0.6832, 0.2153, 0.6286, 0.7473, 0.4251, 0.4883, 0.7622, 0.3217, 0.4493, 0.8334, 0.2121, 0.402, -0.8907, 0.4357, 0.2555, -0.863, 0.0989, 0.3487, -0.932, 0.0984, 0.5944, -0.7981, -0.0202, 0.5493, -0.8354, 0.001, 0.759, -0.6511, -0.122, 0.7216, -0.6814, -0.0735, 0.8849, -0.46, -0.2004, 0.8531, -0.4817, -0.122, 0.7216, -0.6814, -0.122, 0.7216, -0.6814, -0.1204, 0.9638, -0.2381, -0.2489, 0.936, -0.249, -0.1364, 0.9906, -0, -0.2655, 0.9641, 0, -0.1364, 0.9906, -0, -0.1364, 0.9906, -0, -0.1203, 0.9638, 0.2381, -0.1364, 0.9906, -0, -0.249, 0.9359, 0.249, -0.1364, 0.9906, -0, -0.1364, 0.9906, -0, -0.0735, 0.8849, 0.46, -0.2004, 0.8531, 0.4817, 0.001, 0.759, 0.6511, -0.122, 0.7217, 0.6814, 0.0985, 0.5944, 0.7981, -0.0202, 0.5493, 0.8354, 0.2122, 0.4021, 0.8907, 0.0989, 0.3487, 0.932, -0.0157, 0.29, -0.9569, -0.073, 0.2594, -0.963, -0.1386, 0.4944, -0.8581, -0.1974, 0.4639, -0.8636, -0.122, 0.7216, -0.6814, -0.2433, 0.6714, -0.7, -0.122, 0.7216, -0.6814, -0.3019, 0.6423, -0.7045, -0.3233, 0.807, -0.4941, -0.122, 0.7216, -0.6814, -0.3828, 0.7785, -0.4975, -0.3735, 0.8917, -0.2558, -0.4333, 0.8637, -0.2576, -0.3907, 0.9205, 0, -0.4506, 0.8927, 0, -0.3734, 0.8917, 0.2558, -0.4333, 0.8637, 0.2576, -0.3233, 0.8071, 0.4941, -0.3829, 0.7782, 0.4977, -0.2434, 0.6714, 0.7, -0.3018, 0.6423, 0.7045, -0.1388, 0.4944, 0.8581, -0.1969, 0.4639, 0.8637, -0.0157, 0.29, 0.9569, -0.073, 0.2594, 0.963, 0.7819, 0.6119, 0.1192, -0.047, 0.9574, -0.2849, -0.2329, 0.9298, -0.2849, -0.2428, 0.9693, -0.0393, -0.049, 0.998, -0.0393, -0.4098, 0.8665, -0.2849, -0.4272, 0.9033, -0.0393, -0.571, 0.7699, -0.2849, -0.5952, 0.8026, -0.0393, -0.7103, 0.6437, -0.2849, -0.7404, 0.671, -0.0393, -0.8222, 0.4928, -0.2849, -0.8571, 0.5137, -0.0393, -0.9025, 0.3229, -0.2849, -0.9408, 0.3366, -0.0393, -0.9482, 0.1403, -0.285, -0.9884, 0.1466, -0.0393, -0.9574, -0.047, -0.2849, -0.998, -0.049, -0.0393, -0.9693, -0.2428, -0.0393, -0.9298, -0.2329, -0.2849, -0.9033, -0.4272, -0.0393, -0.8665, -0.4098, -0.2849, -0.8026, -0.5952, -0.0393, -0.7699, -0.571, -0.2849, -0.671, -0.7404, -0.0393, -0.6437, -0.7103, -0.2849, -0.4928, -0.8222, -0.2849, -0.5137, -0.8571, -0.0393, -0.3229, -0.9025, -0.2849, -0.3366, -0.9408, -0.0393, -0.1407, -0.9482, -0.2849, -0.1466, -0.9884, -0.0393, 0.047, -0.9574, -0.2849, 0.049, -0.998, -0.0393, 0.2428, -0.9693, -0.0393, 0.2329, -0.9298, -0.2849, 0.4272, -0.9033, -0.0393, 0.4098, -0.8665, -0.2849, 0.5952, -0.8026, -0.0393, 0.571, -0.7699, -0.2849, 0.7404, -0.671, -0.0393, 0.7102, -0.6437, -0.2849, 0.8222, -0.4928, -0.2849, 0.8571, -0.5137, -0.0393, 0.9025, -0.3229, -0.2849, 0.9408, -0.3366, -0.0393, 0.9482, -0.1407, -0.2849, 0.9884, -0.1466, -0.0393, 0.9574, 0.047, -0.2849, 0.998, 0.0494, -0.0393, 0.9298, 0.2329, -0.2849, 0.9693, 0.2428, -0.0393, 0.8665, 0.4098, -0.2849, 0.9033, 0.4272, -0.0393, 0.7699, 0.571, -0.2849, 0.8026, 0.5952, -0.0393, 0.6437, 0.7102, -0.2849, 0.671, 0.7404, -0.0393, 0.4928, 0.8222, -0.2849, 0.5137, 0.8571, -0.0393, 0.3229, 0.9025, -0.2849, 0.3366, 0.9408, -0.0393, 0.1407, 0.9482, -0.2849, 0.1466, 0.9884, -0.0393, -0.0343, 0.6987, -0.7146, -0.17, 0.6786, -0.7146, -0.2991, 0.6324, -0.7146, -0.4167, 0.5619, -0.7146, -0.5184, 0.4698, -0.7146, -0.6, 0.3597, -0.7146, -0.6587, 0.2357, -0.7146, -0.692, 0.1026, -0.7146, -0.6987, -0.0343, -0.7146, -0.6786, -0.17, -0.7146, -0.6324, -0.2991, -0.7146, -0.5619, -0.4167, -0.7146, -0.4698, -0.5184, -0.7146, -0.3597, -0.6, -0.7146, -0.2357, -0.6587, -0.7146, -0.1026, -0.692, -0.7146, 0.0343, -0.6987, -0.7146, 0.17, -0.6786, -0.7146, 0.2991, -0.6324, -0.7146, 0.4167, -0.5619, -0.7146, 0.5184, -0.4698, -0.7146, 0.6, -0.3597, -0.7146, 0.6587, -0.2357, -0.7146, 0.692, -0.1027, -0.7146, 0.6987, 0.0343, -0.7146, 0.6786, 0.17, -0.7146, 0.6324, 0.2991, -0.7146, 0.5619, 0.4167, -0.7146, 0.4698, 0.5183, -0.7146, 0.3597, 0.6, -0.7146, 0.2357, 0.6587, -0.7146, 0.1027, 0.692, -0.7146, -0.0961, 0.3838, -0.9184, -0.0194, 0.3951, -0.9184, -0.1692, 0.3576, -0.9184, -0.2357, 0.3178, -0.9184, -0.2931, 0.2657, -0.9184, -0.3393, 0.2039, -0.9183, -0.3725, 0.1333, -0.9184, -0.3913, 0.0581, -0.9184, -0.3951, -0.0194, -0.9184, -0.3838, -0.0961, -0.9184, -0.3576, -0.1692, -0.9184, -0.3178, -0.2357, -0.9184, -0.2657, -0.2928, -0.9185, -0.2034, -0.3393, -0.9184, -0.1333, -0.3725, -0.9184, -0.0581, -0.3913, -0.9184, 0.0194, -0.3951, -0.9184, 0.0961, -0.3838, -0.9184, 0.1692, -0.3576, -0.9184, 0.2357, -0.3178, -0.9184, 0.2931, -0.2657, -0.9184, 0.3393, -0.2034, -0.9184, 0.3725, -0.1333, -0.9184, 0.3913, -0.0581, -0.9184, 0.3952, 0.0194, -0.9184, 0.3838, 0.0961, -0.9184, 0.3576, 0.1691, -0.9184, 0.3178, 0.2357, -0.9184, 0.2657, 0.2931, -0.9184, 0.2034, 0.3393, -0.9184, 0.1334, 0.3722, -0.9185, 0.0581, 0.3913, -0.9184, -0.0143, 0.2915, -0.9565, -0.0708, 0.2828, -0.9566, -0.1246, 0.2635, -0.9566, -0.1736, 0.2341, -0.9566, -0.216, 0.1958, -0.9566, -0.25, 0.1499, -0.9566, -0.2745, 0.0982, -0.9566, -0.2883, 0.0428, -0.9566, -0.2911, -0.0143, -0.9566, -0.2828, -0.0708, -0.9566, -0.2635, -0.1246, -0.9566, -0.2341, -0.1736, -0.9566, -0.1958, -0.216, -0.9566, -0.1499, -0.25, -0.9566, -0.0982, -0.2745, -0.9566, -0.0428, -0.2883, -0.9566, 0.0143, -0.2911, -0.9566, 0.0708, -0.2828, -0.9566, 0.1246, -0.2635, -0.9566, 0.1736, -0.2341, -0.9566, 0.216, -0.1958, -0.9566, 0.25, -0.1499, -0.9566, 0.2745, -0.0982, -0.9566, 0.2883, -0.0428, -0.9566, 0.2911, 0.0143, -0.9566, 0.2828, 0.0708, -0.9566, 0.2635, 0.1246, -0.9566, 0.2341, 0.1736, -0.9566, 0.1958, 0.216, -0.9566, 0.1499, 0.25, -0.9566, 0.0982, 0.2745, -0.9566, 0.0428, 0.2883, -0.9566, -0.2329, 0.9298, 0.2849, -0.047, 0.9574, 0.2849, -0.2428, 0.9693, 0.0393, -0.049, 0.998, 0.0393, -0.4098, 0.8665, 0.2849, -0.4272, 0.9033, 0.0393, -0.571, 0.7699, 0.2849, -0.5952, 0.8026, 0.0393, -0.7103, 0.6437, 0.2849, -0.7404, 0.671, 0.0393, -0.8222, 0.4928, 0.2849, -0.8571, 0.5137, 0.0393, -0.9025, 0.3229, 0.2849, -0.9408, 0.3366, 0.0393, -0.9482, 0.1407, 0.2849, -0.9884, 0.1466, 0.0393, -0.9574, -0.047, 0.2849, -0.998, -0.049, 0.0393, -0.9693, -0.2428, 0.0393, -0.9298, -0.2329, 0.2849, -0.9033, -0.4272, 0.0393, -0.8665, -0.4098, 0.2849, -0.8026, -0.5952, 0.0393, -0.7699, -0.571, 0.2849, -0.671, -0.7404, 0.0393, -0.6437, -0.7103, 0.2849, -0.4928, -0.8222, 0.2849, -0.5137, -0.8571, 0.0393, -0.3229, -0.9025, 0.2849, -0.3366, -0.9408, 0.0393, -0.1407, -0.9482, 0.2849, -0.1466, -0.9884, 0.0393, 0.047, -0.9574, 0.2849, 0.049, -0.998, 0.0393, 0.2428, -0.9693, 0.0393, 0.2329, -0.9298, 0.2849, 0.4272, -0.9033, 0.0393, 0.4098, -0.8665, 0.2849, 0.5952, -0.8026, 0.0393, 0.571, -0.7699, 0.2849, 0.7404, -0.671, 0.0393, 0.7102, -0.6437, 0.2849, 0.8222, -0.4928, 0.2849, 0.8571, -0.5137, 0.0393, 0.9025, -0.3229, 0.2849, 0.9408, -0.3366, 0.0393, 0.9482, -0.1407, 0.2849, 0.9884, -0.1466, 0.0393, 0.9574, 0.047, 0.2849, 0.998, 0.049, 0.0393, 0.9298, 0.2329, 0.2849, 0.9694, 0.2425, 0.0393, 0.8665, 0.4098, 0.2849, 0.9033, 0.4272, 0.0393, 0.7699, 0.571, 0.2849, 0.8028, 0.595, 0.0393, 0.6437, 0.7102, 0.2849, 0.671, 0.7404, 0.0393, 0.4928, 0.8222, 0.2849, 0.5137, 0.8571, 0.0393, 0.3229, 0.9025, 0.2849, 0.3366, 0.9408, 0.0393, 0.1407, 0.9482, 0.2849, 0.1466, 0.9884, 0.0393, -0.17, 0.6786, 0.7146, -0.0343, 0.6987, 0.7146, -0.2991, 0.6324, 0.7146, -0.4167, 0.5619, 0.7146, -0.5184, 0.4698, 0.7146, -0.6, 0.3597, 0.7146, -0.6587, 0.2357, 0.7146, -0.692, 0.1026, 0.7146, -0.6987, -0.0343, 0.7146, -0.6786, -0.17, 0.7146, -0.6324, -0.2991, 0.7146, -0.5619, -0.4167, 0.7146, -0.4698, -0.5184, 0.7146, -0.3597, -0.6, 0.7146, -0.2357, -0.6587, 0.7146, -0.1026, -0.692, 0.7146, 0.0343, -0.6987, 0.7146, 0.17, -0.6786, 0.7146, 0.2991, -0.6324, 0.7146, 0.4167, -0.5619, 0.7146, 0.5184, -0.4698, 0.7146, 0.6, -0.3597, 0.7146, 0.6587, -0.2357, 0.7146, 0.692, -0.1027, 0.7146, 0.6987, 0.0343, 0.7146, 0.6786, 0.17, 0.7146, 0.6324, 0.2991, 0.7146, 0.5619, 0.4167, 0.7146, 0.4698, 0.5183, 0.7146, 0.3597, 0.6, 0.7146, 0.2357, 0.6587, 0.7146, 0.1027, 0.692, 0.7146, -0.0961, 0.3838, 0.9184, -0.0194, 0.3951, 0.9184, -0.1692, 0.3576, 0.9184, -0.2357, 0.3178, 0.9184, -0.2931, 0.2657, 0.9184, -0.3393, 0.2037, 0.9184, -0.3725, 0.1333, 0.9184, -0.3913, 0.0581, 0.9184, -0.3951, -0.0194, 0.9184, -0.3838, -0.0961, 0.9184, -0.3576, -0.1692, 0.9184, -0.3178, -0.2357, 0.9184, -0.2657, -0.2928, 0.9185, -0.2034, -0.3393, 0.9184, -0.1333, -0.3725, 0.9184, -0.0581, -0.3913, 0.9184, 0.0194, -0.3951, 0.9184, 0.0961, -0.3838, 0.9184, 0.1692, -0.3576, 0.9184, 0.2357, -0.3178, 0.9184, 0.2931, -0.2657, 0.9184, 0.3393, -0.2034, 0.9184, 0.3725, -0.1333, 0.9184, 0.3913, -0.0581, 0.9184, 0.3952, 0.0194, 0.9184, 0.3838, 0.0961, 0.9184, 0.3576, 0.1695, 0.9184, 0.3178, 0.2357, 0.9184, 0.2657, 0.2931, 0.9184, 0.2034, 0.3396, 0.9183, 0.1333, 0.3725, 0.9184, 0.0581, 0.3913, 0.9184, -0.0708, 0.2828, 0.9566, -0.0143, 0.2911, 0.9566, -0.1246, 0.2635, 0.9566, -0.1736, 0.2341, 0.9566, -0.216, 0.1958, 0.9566, -0.2501, 0.1495, 0.9566, -0.2745, 0.0982, 0.9566, -0.2883, 0.0428, 0.9566, -0.2911, -0.0143, 0.9566, -0.2828, -0.0708, 0.9566, -0.2635, -0.1246, 0.9566, -0.2341, -0.1736, 0.9566, -0.1958, -0.216, 0.9566, -0.1499, -0.25, 0.9566, -0.0982, -0.2745, 0.9566, -0.0428, -0.2883, 0.9566, 0.0143, -0.2911, 0.9566, 0.0708, -0.2828, 0.9566, 0.1246, -0.2635, 0.9566, 0.1736, -0.2341, 0.9566, 0.216, -0.1958, 0.9566, 0.25, -0.1499, 0.9566, 0.2745, -0.0982, 0.9566, 0.2883, -0.0428, 0.9566, 0.2911, 0.0143, 0.9566, 0.2828, 0.0708, 0.9566, 0.2635, 0.1246, 0.9566, 0.2341, 0.1736, 0.9566, 0.1958, 0.216, 0.9566, 0.1499, 0.25, 0.9566, 0.0982, 0.2745, 0.9566, 0.0428, 0.2883, 0.9566
-};
-
-float mTangents[] = {
--1, 0, 0, -0.995187, 0, -0.0979989, -0.995187, 0, -0.0979985, -1, 0, 0, -0.980784, 0, -0.195097, -0.980784, 0, -0.195097, -0.956933, 0, -0.290309, -0.956933, 0, -0.29031, -0.923877, 0, -0.382691, -0.923877, 0, -0.38269, -0.881915, 0, -0.471408, -0.881915, 0, -0.471408, -0.831465, 0, -0.555577, -0.831465, 0, -0.555577, -0.773003, 0, -0.634402, -0.773003, 0, -0.634402, -0.707107, 0, -0.707107, -0.707107, 0, -0.707107, -0.634402, 0, -0.773003, -0.634402, 0, -0.773003, -0.555623, 0, -0.831434, -0.555577, 0, -0.831465, -0.471408, 0, -0.881915, -0.471408, 0, -0.881915, -0.382689, 0, -0.923877, -0.38269, 0, -0.923877, -0.290311, 0, -0.956932, -0.29031, 0, -0.956933, -0.195096, 0, -0.980784, -0.195097, 0, -0.980784, -0.0979981, 0, -0.995187, -0.0979985, 0, -0.995187, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0.0979987, 0, -0.995187, 0.0979987, 0, -0.995187, 0.195097, 0, -0.980784, 0.195097, 0, -0.980784, 0.290309, 0, -0.956933, 0.29031, 0, -0.956933, 0.382691, 0, -0.923877, 0.38269, 0, -0.923877, 0.471408, 0, -0.881915, 0.471408, 0, -0.881915, 0.555578, 0, -0.831465, 0.555578, 0, -0.831465, 0.634402, 0, -0.773003, 0.634402, 0, -0.773003, 0.707107, 0, -0.707107, 0.707107, 0, -0.707107, 0.773003, 0, -0.634403, 0.773003, 0, -0.634402, 0.831434, 0, -0.555623, 0.831465, 0, -0.555577, 0.881915, 0, -0.471408, 0.881915, 0, -0.471408, 0.923877, 0, -0.382689, 0.923877, 0, -0.38269, 0.956932, 0, -0.290311, 0.956933, 0, -0.29031, 0.980784, 0, -0.195096, 0.980784, 0, -0.195096, 0.995187, 0, -0.0979981, 0.995187, 0, -0.0979985, 1, 0, 0, 1, 0, 0, 0.995187, 0, 0.0979989, 0.995187, 0, 0.0979985, 0.980784, 0, 0.195097, 0.980784, 0, 0.195097, 0.956933, 0, 0.290309, 0.956933, 0, 0.29031, 0.923876, 0, 0.382691, 0.923877, 0, 0.382691, 0.881915, 0, 0.471408, 0.881916, 0, 0.471408, 0.831464, 0, 0.555578, 0.831465, 0, 0.555577, 0.773003, 0, 0.634402, 0.773003, 0, 0.634403, 0.707107, 0, 0.707107, 0.707107, 0, 0.707107, 0.634402, 0, 0.773003, 0.634402, 0, 0.773003, 0.555577, 0, 0.831465, 0.555623, 0, 0.831434, 0.471409, 0, 0.881915, 0.471408, 0, 0.881915, 0.382689, 0, 0.923877, 0.38269, 0, 0.923877, 0.290311, 0, 0.956932, 0.29031, 0, 0.956933, 0.195096, 0, 0.980784, 0.195096, 0, 0.980784, 0.0979984, 0, 0.995187, 0.0979982, 0, 0.995187, 0, 0, 1, 0, 0, 1, -0.0979989, 0, 0.995187, -0.0979985, 0, 0.995187, -0.195097, 0, 0.980784, -0.195097, 0, 0.980784, -0.290309, 0, 0.956933, -0.29031, 0, 0.956933, -0.382691, 0, 0.923877, -0.38269, 0, 0.923877, -0.471408, 0, 0.881915, -0.471408, 0, 0.881915, -0.555577, 0, 0.831465, -0.555577, 0, 0.831465, -0.634402, 0, 0.773003, -0.634403, 0, 0.773003, -0.707107, 0, 0.707107, -0.707107, 0, 0.707107, -0.773003, 0, 0.634403, -0.773003, 0, 0.634402, -0.831434, 0, 0.555624, -0.831466, 0, 0.555576, -0.881915, 0, 0.471408, -0.881915, 0, 0.471409, -0.923877, 0, 0.38269, -0.923877, 0, 0.38269, -0.956932, 0, 0.290311, -0.956933, 0, 0.29031, -0.980784, 0, 0.195096, -0.980784, 0, 0.195096, -0.995187, 0, 0.0979981, -0.995187, 0, 0.0979985, -0.995848, 0, -0.0910299, -0.999866, 0, -0.0163732, -0.995848, 0, -0.0910276, -1, 0, -1.19959e-06, -0.982131, 0, -0.188201, -0.982131, 0, -0.188199, -0.95694, 0, -0.290287, -0.961564, 0, -0.274581, -0.931729, 0, -0.363155, -0.921171, 0, -0.389158, -0.887645, 0, -0.460528, -0.881922, 0, -0.471396, -0.835349, 0, -0.549719, -0.835347, 0, -0.549723, -0.773007, 0, -0.634397, -0.783294, 0, -0.621651, -0.721835, 0, -0.692065, -0.707106, 0, -0.707108, -0.643838, 0, -0.765162, -0.639802, 0, -0.768539, -0.561394, 0, -0.827548, -0.561392, 0, -0.82755, -0.485772, 0, -0.874085, -0.471396, 0, -0.881922, -0.402046, 0, -0.91562, -0.376193, 0, -0.926541, -0.310366, 0, -0.950617, -0.283565, 0, -0.958953, -0.20712, 0, -0.978316, -0.195088, 0, -0.980786, -0.0980151, 0, -0.995185, -0.1143, 0, -0.993446, -0.0054584, 0, -0.999985, -0.0098242, 0, -0.999952, -0.0054584, 0, -0.999985, 0.0857858, 0, -0.996314, 0.0980174, 0, -0.995185, -0.0098242, 0, -0.999952, 0.179001, 0, -0.983849, 0.195088, 0, -0.980786, 0.278514, 0, -0.960432, 0.296995, 0, -0.954879, 0.367507, 0, -0.930021, 0.389159, 0, -0.921171, 0.460529, 0, -0.887644, 0.471395, 0, -0.881922, 0.555571, 0, -0.831469, 0.541879, 0, -0.840457, 0.624855, 0, -0.780741, 0.626771, 0, -0.779204, 0.692066, 0, -0.721834, 0.702126, 0, -0.712052, 0.759486, 0, -0.650524, 0.773011, 0, -0.634392, 0.819592, 0, -0.572947, 0.831472, 0, -0.555567, 0.879334, 0, -0.476205, 0.874085, 0, -0.485773, 0.919109, 0, -0.394003, 0.923879, 0, -0.382685, 0.95488, 0, -0.296991, 0.954881, 0, -0.296989, 0.979393, 0, -0.201966, 0.979392, 0, -0.201967, 0.994473, 0, -0.104997, 0.994472, 0, -0.105, 0.999866, 0, -0.0163728, 1, 0, -3.40343e-08, 0.997027, 0, 0.0770475, 0.994472, 0, 0.105, 0.984674, 0, 0.174403, 0.979392, 0, 0.201969, 0.960433, 0, 0.278512, 0.954879, 0, 0.296994, 0.926543, 0, 0.376189, 0.923879, 0, 0.382684, 0.881921, 0, 0.471398, 0.885207, 0, 0.465198, 0.835347, 0, 0.549724, 0.82755, 0, 0.561392, 0.779204, 0, 0.626771, 0.77301, 0, 0.634393, 0.721833, 0, 0.692067, 0.707107, 0, 0.707106, 0.650524, 0, 0.759485, 0.634392, 0, 0.773011, 0.565738, 0, 0.824585, 0.555569, 0, 0.83147, 0.471399, 0, 0.88192, 0.477579, 0, 0.878589, 0.389156, 0, 0.921172, 0.382687, 0, 0.923878, 0.290284, 0, 0.956941, 0.305908, 0, 0.952061, 0.215694, 0, 0.976461, 0.188201, 0, 0.982131, 0.118942, 0, 0.992901, 0.0910266, 0, 0.995848, 0.0122798, 0, 0.999925, -6.99334e-07, 0, 1, -0.0910307, 0, 0.995848, -0.0910281, 0, 0.995848, -0.19509, 0, 0.980785, -0.179002, 0, 0.983849, -0.278508, 0, 0.960434, -0.29028, 0, 0.956942, -0.376188, 0, 0.926543, -0.376191, 0, 0.926542, -0.465197, 0, 0.885207, -0.465196, 0, 0.885208, -0.549718, 0, 0.835351, -0.549717, 0, 0.835351, -0.628953, 0, 0.777444, -0.628952, 0, 0.777444, -0.702124, 0, 0.712055, -0.695433, 0, 0.718591, -0.769536, 0, 0.638604, -0.768539, 0, 0.639803, -0.827549, 0, 0.561394, -0.835347, 0, 0.549724, -0.874085, 0, 0.485773, -0.885206, 0, 0.4652, -0.919109, 0, 0.394004, -0.923878, 0, 0.382688, -0.95694, 0, 0.290286, -0.952058, 0, 0.305918, -0.98213, 0, 0.188206, -0.97646, 0, 0.215698, -0.995848, 0, 0.0910313, -0.992901, 0, 0.118946, -1, 0, 0, -0.995187, 0, -0.0979989, -0.995187, 0, -0.0979993, -1, 0, 0, -0.980784, 0, -0.195097, -0.980784, 0, -0.195098, -0.956933, 0, -0.290309, -0.956933, 0, -0.290309, -0.923877, 0, -0.382691, -0.923876, 0, -0.382691, -0.881916, 0, -0.471407, -0.881915, 0, -0.471408, -0.831465, 0, -0.555577, -0.831464, 0, -0.555579, -0.773003, 0, -0.634402, -0.773003, 0, -0.634402, -0.707107, 0, -0.707107, -0.707107, 0, -0.707106, -0.634402, 0, -0.773003, -0.634402, 0, -0.773003, -0.555624, 0, -0.831434, -0.555576, 0, -0.831466, -0.471408, 0, -0.881915, -0.471409, 0, -0.881915, -0.382691, 0, -0.923877, -0.382689, 0, -0.923877, -0.290312, 0, -0.956932, -0.290309, 0, -0.956933, -0.195097, 0, -0.980784, -0.195097, 0, -0.980784, -0.0979987, 0, -0.995187, -0.0979982, 0, -0.995187, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0.0979989, 0, -0.995187, 0.0979993, 0, -0.995187, 0, 0, -1, 0.195097, 0, -0.980784, 0.195098, 0, -0.980784, 0.290308, 0, -0.956933, 0.29031, 0, -0.956933, 0.382691, 0, -0.923876, 0.382691, 0, -0.923877, 0.471408, 0, -0.881915, 0.471408, 0, -0.881915, 0.555623, 0, -0.831434, 0.555578, 0, -0.831464, 0.634403, 0, -0.773003, 0.634402, 0, -0.773003, 0.707107, 0, -0.707107, 0.707106, 0, -0.707107, 0.773003, 0, -0.634403, 0.773003, 0, -0.634402, 0.831466, 0, -0.555576, 0.831466, 0, -0.555576, 0.881915, 0, -0.471408, 0.881915, 0, -0.471409, 0.923877, 0, -0.382691, 0.923877, 0, -0.382689, 0.956933, 0, -0.290309, 0.956932, 0, -0.290312, 0.980784, 0, -0.195097, 0.980784, 0, -0.195097, 0.995187, 0, -0.0979987, 0.995187, 0, -0.0979983, 1, 0, 0, 1, 0, 0, 0.995187, 0, 0.0979989, 0.995187, 0, 0.0979991, 0.980784, 0, 0.195097, 0.980784, 0, 0.195097, 0.956933, 0, 0.290309, 0.956933, 0, 0.290308, 0.923877, 0, 0.38269, 0.923876, 0, 0.382691, 0.881915, 0, 0.471408, 0.881915, 0, 0.471408, 0.831435, 0, 0.555622, 0.831464, 0, 0.555578, 0.773003, 0, 0.634402, 0.773003, 0, 0.634402, 0.707107, 0, 0.707107, 0.707107, 0, 0.707106, 0.634402, 0, 0.773003, 0.634403, 0, 0.773003, 0.555576, 0, 0.831466, 0.555576, 0, 0.831466, 0.471408, 0, 0.881915, 0.471409, 0, 0.881915, 0.38269, 0, 0.923877, 0.382689, 0, 0.923877, 0.290312, 0, 0.956932, 0.290309, 0, 0.956933, 0.195096, 0, 0.980784, 0.195097, 0, 0.980784, 0.0979989, 0, 0.995187, 0.097998, 0, 0.995187, 0, 0, 1, 0, 0, 1, -0.0979991, 0, 0.995187, -0.0979989, 0, 0.995187, -0.195097, 0, 0.980784, -0.195097, 0, 0.980784, -0.290308, 0, 0.956933, -0.290309, 0, 0.956933, -0.382691, 0, 0.923877, -0.382692, 0, 0.923876, -0.471407, 0, 0.881916, -0.471408, 0, 0.881915, -0.555578, 0, 0.831464, -0.555577, 0, 0.831465, -0.634294, 0, 0.773092, -0.634402, 0, 0.773003, -0.707107, 0, 0.707107, -0.707106, 0, 0.707107, -0.773003, 0, 0.634403, -0.773003, 0, 0.634402, -0.831466, 0, 0.555576, -0.831466, 0, 0.555575, -0.881915, 0, 0.471408, -0.881915, 0, 0.471409, -0.923877, 0, 0.38269, -0.923877, 0, 0.38269, -0.956933, 0, 0.29031, -0.956932, 0, 0.290311, -0.980784, 0, 0.195096, -0.980784, 0, 0.195097, -0.995187, 0, 0.0979989, -0.995187, 0, 0.097998, -0.999866, 0, -0.0163732, -0.995848, 0, -0.0910294, -0.982131, 0, -0.188199, -0.958953, 0, -0.283564, -0.93002, 0, -0.367509, -0.887644, 0, -0.460529, -0.835349, 0, -0.54972, -0.777444, 0, -0.628952, -0.712053, 0, -0.702126, -0.6398, 0, -0.768542, -0.561393, 0, -0.827549, -0.471395, 0, -0.881922, -0.376192, -0.000222928, -0.926542, -0.290289, -0.000220417, -0.956939, -0.195088, -9.80785e-05, -0.980786, -0.0910288, 0, -0.995848, -0.0098242, 0, -0.999952, -0.0098242, 0, -0.999952, 0.0857869, 0, -0.996314, 0.179001, 0, -0.983849, 0.28506, 0, -0.95851, 0.382684, -0.000223044, -0.923879, 0.465194, 0, -0.885209, 0.555572, 0, -0.831468, 0.626771, 0, -0.779204, 0.692066, 0, -0.721835, 0.765162, 0, -0.643837, 0.822263, 0, -0.569108, 0.876065, 0, -0.482194, 0.92117, 0, -0.38916, 0.956941, 0, -0.290283, 0.980786, 0, -0.195088, 0.994473, -0.000198895, -0.104995, 0.999866, 0, -0.0163724, 0.997027, 0, 0.0770472, 0.984674, 0, 0.174405, 0.960433, 0, 0.278512, 0.926543, 0, 0.376189, 0.885209, 0, 0.465194, 0.831469, -0.000138704, 0.555571, 0.773007, 0, 0.634398, 0.718588, 0, 0.695436, 0.650524, 0, 0.759486, 0.565738, 0, 0.824585, 0.471399, 0, 0.88192, 0.382687, 0, 0.923878, 0.290285, 9.5694e-05, 0.95694, 0.1882, 0, 0.982131, 0.0910265, 9.95848e-05, 0.995848, -6.98091e-07, 0, 1, -0.0910277, 0, 0.995848, -0.179002, 0, 0.983849, -0.27851, 0, 0.960433, -0.367505, 0, 0.930021, -0.460531, 0, 0.887644, -0.549716, 0, 0.835351, -0.628952, 0, 0.777444, -0.695433, 0, 0.71859, -0.769537, 0, 0.638602, -0.835346, -0.000222042, 0.549725, -0.881919, 0, 0.471401, -0.92117, 0.000131033, 0.389161, -0.95694, 0, 0.290287, -0.980785, 0, 0.195094, -0.995184, 0, 0.0980196, -0.997291, 0, -0.0735522, -1, 0, 2.13437e-06, -0.985279, 0, -0.170952, -0.96378, 0, -0.266698, -0.927595, 0, -0.373587, -0.889522, 0, -0.456892, -0.844862, 0, -0.534984, -0.788356, 0, -0.615219, -0.724259, 0, -0.689528, -0.65318, 0, -0.757202, -0.575822, 0, -0.817575, -0.49291, 0, -0.87008, -0.405252, 0, -0.914205, -0.299675, 0, -0.954041, -0.211122, 0, -0.97746, -0.122427, 0, -0.992477, -0.00982791, 0, -0.999952, 0.0817184, 0, -0.996655, -0.00982791, 0, -0.999952, 0.185444, 0, -0.982655, 0.274578, 0, -0.961565, 0.359881, 0, -0.932998, 0.462706, 0, -0.886512, 0.541882, 0, -0.840455, 0.62677, 0, -0.779205, 0.707105, 0, -0.707108, 0.762523, 0, -0.646962, 0.825972, 0, -0.563711, 0.881919, 0, -0.471401, 0.923879, 0, -0.382684, 0.952059, 0, -0.305915, 0.978821, 0, -0.204716, 0.995185, 0, -0.0980162, 1, 0, -2.07003e-07, 0.995184, 0, 0.0980213, 0.980784, 0, 0.195097, 0.95694, 0, 0.290285, 0.923881, 0, 0.38268, 0.881923, 0, 0.471394, 0.840453, 0, 0.541884, 0.788354, 0, 0.615222, 0.714016, 0, 0.700129, 0.634395, 0, 0.773009, 0.569111, 0, 0.82226, 0.492909, 0, 0.870081, 0.391744, 0, 0.920074, 0.305916, 0, 0.952059, 0.219117, 0, 0.975698, 0.122421, 0, 0.992478, 0.0245541, 0, 0.999698, -0.0735484, 0, 0.997292, -0.185443, 0, 0.982655, -0.274578, 0, 0.961565, -0.373589, 0, 0.927594, -0.456897, 0, 0.88952, -0.534976, 0, 0.844867, -0.615219, 0, 0.788356, -0.700125, 0, 0.714021, -0.762521, 0, 0.646964, -0.817574, 0, 0.575824, -0.877245, 0, 0.480044, -0.917489, 0, 0.397761, -0.949523, 0, 0.313697, -0.978821, 0, 0.204719, -0.993446, 0, 0.114302, 0.564794, 0.289285, 0.772866, 0.538661, 0.443208, 0.716527, 0.595776, 0.462313, 0.656748, 0.601028, 0.320075, 0.732337, 0.543612, 0.206407, 0.813561, 0.513991, 0.196896, 0.834892, 0.445751, 0.131268, 0.88548, 0.443266, 0.142043, 0.885065, 0.468901, 0.102993, 0.877225, 0.379779, 0.0163031, 0.924933, 0.461654, 0.0551701, 0.885343, 0.38269, 0.000320325, 0.923877, 0.303287, -0.0786201, 0.94965, 0.28877, -0.102849, 0.951858, 0.224611, -0.180933, 0.957504, 0.191474, -0.19179, 0.962577, 0.0942803, -0.272825, 0.957433, 0.144872, -0.274996, 0.950468, 0.043424, -0.463323, 0.885125, 0.123932, -0.423284, 0.897481, 0.48989, 0.285676, 0.823649, 0.495769, 0.223804, 0.839121, 0.460064, 0.154933, 0.874264, 0.44658, 0.127596, 0.885599, 0.422916, 0.0790144, 0.902718, 0.445448, 0.132573, 0.885438, 0.383095, -0.000649546, 0.923709, 0.461534, 0.0557894, 0.885366, 0.339105, -0.0786734, 0.937453, 0.291559, -0.152711, 0.944284, 0.244196, -0.225954, 0.943034, 0.235333, -0.284856, 0.929234, 0.472693, 0.179413, 0.86277, 0.450686, 0.163014, 0.877672, 0.425754, 0.113195, 0.897731, 0.404631, 0.057319, 0.912682, 0.382248, 0.000500743, 0.92406, 0.359768, -0.0578065, 0.931249, 0.335211, -0.11436, 0.935176, 0.30558, -0.165891, 0.937604, 0.288794, -0.189677, 0.938414, 0.444203, 0.137844, 0.885258, 0.432516, 0.122486, 0.893268, 0.412447, 0.0855396, 0.906957, 0.397772, 0.0451808, 0.916371, 0.38247, 0.000181637, 0.923968, 0.367364, -0.0455524, 0.928961, 0.350096, -0.0856994, 0.932786, 0.328244, -0.123774, 0.936449, 0.282654, -0.184758, 0.941261, 0.281835, -0.184103, 0.941634, 0.358554, -0.162539, 0.91925, 0.406152, 0.0989043, 0.908437, 0.402138, 0.0541301, 0.913978, 0.382978, -0.000162562, 0.923757, 0.363379, -0.0546507, 0.930037, 0.393553, -0.113253, 0.912299, 0.378265, 0.0657392, 0.92336, 0.401591, 0.038987, 0.914989, 0.381883, 0.000233549, 0.924211, 0.365717, -0.0396952, 0.929879, 0.394609, -0.0679291, 0.916335, 0.346138, 0.0443489, 0.937135, 0.419213, 0.0208723, 0.907648, 0.379663, 0.000448689, 0.925125, 0.353885, -0.0222015, 0.935025, 0.41922, -0.0445807, 0.90679, 0.393287, 0.0278472, 0.918994, 0.483133, 0.00821743, 0.875508, 0.37782, 0.00053054, 0.925879, 0.299069, -0.0104719, 0.954174, 0.37317, -0.0245427, 0.927438, 0.622886, 0.00673797, 0.782284, 0.622874, 0.00916503, 0.782268, 0.549023, -0.0415342, 0.834775, 0.549321, -0.0197105, 0.835379, 0.382583, -0.0110415, 0.923855, 0.382687, 0.00390406, 0.92387, 0.202182, 0.0351821, 0.978716, 0.202212, 0.0303373, 0.978872, 0.112622, -0.00484097, 0.993626, 0.112496, -0.0483017, 0.992478, 0.647849, 0.487901, -0.585016, 0.627914, 0.530981, -0.569019, 0.586419, 0.614426, -0.52782, 0.668259, 0.431963, -0.605672, -0.900217, -0.433111, 0.044993, -0.859768, -0.508991, 0.041567, -0.900249, -0.43312, 0.0442553, -0.848702, -0.527053, 0.0438325, -0.786716, -0.615862, 0.0423213, 0.424811, 0.826244, -0.36994, 0.546196, 0.680313, -0.488717, -0.724829, -0.687727, 0.0406842, -0.883461, -0.466372, 0.0446488, -0.571331, -0.819735, 0.0401828, 0.421885, 0.825026, -0.375959, 0.23509, 0.953428, -0.188966, -0.423844, -0.905135, 0.0329662, -0.387466, -0.921293, 0.0330077, 0.238313, 0.949291, -0.205068, 0.0818512, 0.995393, -0.0499289, -0.227267, -0.973551, 0.0233962, -0.16636, -0.985792, 0.0231878, 0.084225, 0.994592, -0.0607612, -0.0444369, 0.996773, 0.0668488, -0.0299456, -0.999417, 0.0163687, 0.016435, -0.999733, 0.0162382, -0.0401046, 0.99764, 0.0557383, -0.153706, 0.973654, 0.16844, 0.167317, -0.985844, 0.01079, 0.167664, -0.985787, 0.0105764, -0.144004, 0.979777, 0.138921, -0.296229, 0.909497, 0.291656, 0.370098, -0.928991, -0.00199626, 0.259071, -0.965853, -0.00304755, -0.554892, 0.641445, 0.529758, -0.425261, 0.811541, 0.400693, 0.584675, -0.811082, -0.0173652, 0.764899, -0.643882, -0.0185816, -0.683447, 0.386605, 0.619222, -0.620451, 0.512324, 0.593772, -0.612269, 0.52855, 0.588016, -0.736639, 0.107748, 0.667648, 0.921465, -0.385807, -0.0453432, 0.848233, -0.529289, -0.0188265, 0.858824, -0.511924, -0.0188487, 0.993021, -0.107364, -0.0488159, 0.154042, -0.0826912, 0.984598, 0.298895, -0.197903, 0.93354, 0.303306, -0.201426, 0.931361, 0.438861, -0.310786, 0.843097, 0.948755, 0.280414, 0.145712, 0.89776, 0.423078, 0.122604, 0.885674, 0.462305, 0.0430801, 0.942832, 0.320076, 0.0928436, 0.959664, 0.206406, 0.190896, 0.95673, 0.184456, 0.225043, 0.946557, 0.100312, 0.30654, 0.951844, 0.102994, 0.288766, 0.923433, 0.00543483, 0.38372, 0.923877, 0.00032081, 0.38269, 0.885383, -0.0562614, 0.461446, 0.885535, -0.0607549, 0.460583, 0.877238, -0.102848, 0.468908, 0.835267, -0.190306, 0.515861, 0.885495, -0.13082, 0.445853, 0.816029, -0.19179, 0.545264, 0.740985, -0.284823, 0.608126, 0.774352, -0.275905, 0.569435, 0.721209, -0.427631, 0.544967, 0.640149, -0.503588, 0.58018, 0.940692, 0.231793, 0.24773, 0.926147, 0.291352, 0.239511, 0.941475, 0.160639, 0.296344, 0.935778, 0.0840305, 0.34243, 0.922203, 0.0067741, 0.386647, 0.901008, -0.071498, 0.427869, 0.885413, -0.0571025, 0.461283, 0.872926, -0.147269, 0.465093, 0.885559, -0.128898, 0.446285, 0.885387, -0.134012, 0.445118, 0.838359, -0.219222, 0.499095, 0.822996, -0.281183, 0.493573, 0.937058, 0.192155, 0.291546, 0.939027, 0.163426, 0.302523, 0.935828, 0.113079, 0.333826, 0.931807, 0.0568315, 0.358476, 0.921213, 0.00548055, 0.389019, 0.926905, -0.00617984, 0.375244, 0.913207, -0.058441, 0.403284, 0.926909, -0.00618681, 0.375236, 0.898328, -0.114298, 0.424198, 0.879033, -0.165949, 0.446947, 0.862286, -0.178149, 0.474053, 0.937642, 0.122344, 0.32536, 0.919862, 0.161946, 0.357248, 0.932952, 0.0854707, 0.349708, 0.929237, 0.0451739, 0.366712, 0.923588, 0.000323545, 0.383386, 0.921251, 0.00540385, 0.38893, 0.916661, -0.0455948, 0.397056, 0.927016, -0.00641106, 0.374968, 0.926855, -0.00607268, 0.37537, 0.907147, -0.0856529, 0.412004, 0.894239, -0.123879, 0.430104, 0.885722, -0.138507, 0.443072, 0.914102, 0.111893, 0.38974, 0.930757, 0.0539762, 0.361631, 0.924186, -0.000218175, 0.381941, 0.914579, -0.054676, 0.400694, 0.909994, -0.100517, 0.402254, 0.916438, 0.067782, 0.394393, 0.930595, 0.0391713, 0.363948, 0.923402, 0.000248428, 0.383833, 0.916134, -0.0396423, 0.398907, 0.923912, -0.066015, 0.376867, 0.908168, 0.0441512, 0.41627, 0.938232, 0.0208599, 0.345378, 0.923156, 0.000282501, 0.384426, 0.910775, -0.0219522, 0.41232, 0.937644, -0.0445463, 0.34473, 0.932629, 0.0230511, 0.360099, 0.960706, 0.00826025, 0.277446, 0.923072, 0.000232866, 0.384627, 0.884535, -0.0100448, 0.466366, 0.919671, -0.0245046, 0.391925, 0.993605, 0.0067413, 0.112714, 0.993585, 0.00916811, 0.112714, 0.978623, -0.0377813, 0.20216, 0.979187, -0.0166599, 0.202275, 0.923822, -0.0108136, 0.38267, 0.923857, -0.00646874, 0.382683, 0.835373, 0.0202338, 0.549311, 0.835088, 0.0356075, 0.548962, 0.782165, -0.0186274, 0.622792, 0.782194, -0.00795933, 0.622984, 0.044523, 0.487899, -0.871764, 0.0416868, 0.530972, -0.846363, 0.0414755, 0.614415, -0.787892, 0.0445528, 0.431951, -0.900796, -0.593425, -0.465361, 0.656724, -0.578614, -0.508999, 0.637281, -0.605302, -0.43311, 0.667851, -0.526436, -0.615875, 0.586143, 0.0409597, 0.686832, -0.725661, 0.0385507, 0.817533, -0.57459, -0.488186, -0.681233, 0.545524, -0.367247, -0.827901, 0.423921, 0.0333068, 0.904617, -0.424922, 0.0329304, 0.920876, -0.388463, -0.375346, -0.825728, 0.421057, -0.187666, -0.953943, 0.234039, 0.0231724, 0.978639, -0.204277, 0.0231582, 0.985604, -0.167479, -0.204256, -0.949654, 0.237564, -0.0484936, -0.995553, 0.0807631, 0.0163792, 0.999369, -0.0315069, 0.0162437, 0.999755, 0.0150077, -0.0271848, -0.998319, 0.0511954, 0.0680415, -0.996646, -0.0454688, 0.0107243, 0.983566, 0.180233, 0.0105811, 0.986019, 0.166297, 0.0806105, -0.994617, -0.0651129, 0.169459, -0.973315, -0.154734, -0.0034339, 0.924172, 0.381961, -0.00306139, 0.966246, 0.257602, 0.163229, -0.972178, -0.168006, 0.294422, -0.908485, -0.296598, -0.0175945, 0.641431, 0.766979, -0.0173593, 0.811549, 0.584027, 0.401139, -0.811083, -0.425714, 0.52764, -0.643881, -0.554088, -0.0455197, 0.386625, 0.921113, -0.0188488, 0.51234, 0.858576, -0.0170223, 0.528562, 0.848724, -0.0488139, 0.107745, 0.99298, 0.619536, -0.385944, -0.683537, 0.586434, -0.529285, -0.613149, 0.593942, -0.511921, -0.62062, 0.667676, -0.107363, -0.73667, 0.772847, 0.289293, -0.564816, 0.716531, 0.443194, -0.538667, 0.656749, 0.462309, -0.595778, 0.732337, 0.320075, -0.601028, 0.813561, 0.206408, -0.543612, 0.834881, 0.196901, -0.514007, 0.885976, 0.110884, -0.45028, 0.877225, 0.102994, -0.468901, 0.924949, 0.0162993, -0.379743, 0.923877, 0.0003206, -0.38269, 0.94965, -0.0786208, -0.303287, 0.951858, -0.102848, -0.28877, 0.957504, -0.180932, -0.224611, 0.962577, -0.191789, -0.191475, 0.957433, -0.272825, -0.0942803, 0.950471, -0.275, -0.144844, 0.885118, -0.463337, -0.0434236, 0.897474, -0.423298, -0.123934, 0.823649, 0.285675, -0.48989, 0.839121, 0.223804, -0.495769, 0.874264, 0.154933, -0.460064, 0.902718, 0.0790152, -0.422915, 0.924309, 0.0017117, -0.381641, 0.938148, -0.0763631, -0.337708, 0.944284, -0.152711, -0.291558, 0.943036, -0.225966, -0.244177, 0.92923, -0.284864, -0.235339, 0.862771, 0.179416, -0.47269, 0.877673, 0.163015, -0.450685, 0.897731, 0.113194, -0.425755, 0.912682, 0.0573189, -0.404631, 0.923651, -0.00033468, -0.383235, 0.930906, -0.0584678, -0.360548, 0.935177, -0.114359, -0.33521, 0.938003, -0.165199, -0.30473, 0.935262, -0.195076, -0.295348, 0.885258, 0.137844, -0.444203, 0.893267, 0.122486, -0.432517, 0.906957, 0.0855393, -0.412447, 0.916371, 0.0451806, -0.397772, 0.923968, 0.000181676, -0.38247, 0.928938, -0.0455833, -0.367419, 0.932786, -0.0856992, -0.350095, 0.93628, -0.124074, -0.32861, 0.922409, -0.159032, -0.351952, 0.908431, 0.0988983, -0.406168, 0.913978, 0.0541303, -0.402137, 0.923757, -0.000162558, -0.382978, 0.930037, -0.0546509, -0.36338, 0.912298, -0.113254, -0.393556, 0.923356, 0.0657369, -0.378275, 0.91499, 0.0389876, -0.401588, 0.924211, 0.000233468, -0.381883, 0.929877, -0.0396963, -0.365722, 0.915849, -0.0681878, -0.395691, 0.937135, 0.0443489, -0.346138, 0.907645, 0.0209138, -0.419218, 0.925126, 0.000449024, -0.379661, 0.935571, -0.0219914, -0.352453, 0.907541, -0.0443472, -0.417616, 0.918997, 0.0278479, -0.39328, 0.875508, 0.00821744, -0.483133, 0.925879, 0.00053054, -0.37782, 0.955232, -0.0101056, -0.295686, 0.932176, -0.0267407, -0.361017, 0.782283, 0.00669589, -0.622887, 0.782268, 0.00916327, -0.622874, 0.834775, -0.0415342, -0.549023, 0.835379, -0.0197105, -0.549321, 0.923855, -0.0110415, -0.382583, 0.92387, 0.00390407, -0.382687, 0.978716, 0.0351821, -0.202182, 0.978872, 0.0303373, -0.202212, 0.993626, -0.00484262, -0.112622, 0.992477, -0.0483061, -0.112496, -0.584969, 0.487912, -0.647884, -0.569015, 0.53099, -0.62791, -0.527824, 0.614418, -0.586423, -0.605717, 0.431963, -0.668218, 0.044993, -0.433111, 0.900217, 0.041567, -0.50899, 0.859768, 0.0442554, -0.433119, 0.90025, 0.0438325, -0.527052, 0.848702, 0.0423213, -0.615862, 0.786716, -0.369944, 0.82624, -0.424816, -0.488727, 0.680297, -0.546206, 0.0409626, -0.687719, 0.72482, 0.0446488, -0.466372, 0.883461, 0.0401829, -0.819735, 0.571331, -0.375967, 0.825019, -0.421892, -0.188962, 0.95343, -0.235085, 0.0329662, -0.905135, 0.423844, 0.0330077, -0.921293, 0.387466, -0.205125, 0.949298, -0.238236, -0.0499193, 0.995394, -0.0818415, 0.0233962, -0.973551, 0.227267, 0.0231878, -0.985792, 0.16636, -0.0603821, 0.994588, -0.0845489, 0.0668465, 0.996773, 0.0444346, 0.0163687, -0.999418, 0.0299456, 0.0162382, -0.999733, -0.0164349, 0.0557415, 0.99764, 0.0401026, 0.16843, 0.973658, 0.153696, 0.01079, -0.985844, -0.167317, 0.0107568, -0.985786, -0.167664, 0.138841, 0.97978, 0.144062, 0.291659, 0.909495, 0.296232, -0.00199626, -0.928991, -0.370098, -0.00304755, -0.965853, -0.259071, 0.529762, 0.641438, 0.554896, 0.400685, 0.81155, 0.425252, -0.0173652, -0.811082, -0.584675, -0.0185816, -0.643882, -0.764899, 0.61922, 0.386612, 0.683446, 0.593766, 0.512339, 0.620444, 0.58801, 0.528561, 0.612264, 0.667648, 0.107748, 0.736639, -0.0453037, -0.385852, -0.921448, -0.0188265, -0.529289, -0.848232, -0.0188487, -0.511924, -0.858824, -0.0488159, -0.107364, -0.993021, 0.145685, 0.280423, -0.948756, 0.122552, 0.423102, -0.897756, 0.0431713, 0.462316, -0.885664, 0.0928435, 0.320077, -0.942831, 0.190896, 0.206408, -0.959664, 0.22521, 0.184426, -0.956696, 0.30655, 0.100309, -0.946554, 0.288766, 0.102993, -0.951844, 0.383635, 0.00545118, -0.923469, 0.38269, 0.000320197, -0.923877, 0.461445, -0.056264, -0.885383, 0.460583, -0.0607575, -0.885535, 0.468908, -0.102849, -0.877238, 0.515777, -0.190286, -0.835323, 0.445854, -0.130818, -0.885495, 0.545264, -0.19179, -0.816029, 0.607755, -0.284824, -0.741289, 0.569413, -0.275902, -0.774369, 0.544865, -0.427621, -0.721292, 0.580159, -0.503546, -0.640201, 0.247659, 0.231854, -0.940696, 0.239599, 0.291311, -0.926137, 0.296422, 0.160588, -0.941459, 0.342429, 0.084028, -0.935779, 0.386863, 0.00662332, -0.922113, 0.427767, -0.0714242, -0.901063, 0.461283, -0.0571051, -0.885414, 0.465197, -0.147353, -0.872856, 0.446285, -0.128898, -0.885559, 0.445119, -0.134009, -0.885387, 0.498972, -0.219118, -0.83846, 0.493648, -0.281153, -0.822961, 0.293022, 0.193166, -0.936389, 0.301885, 0.163005, -0.939305, 0.333224, 0.112576, -0.936103, 0.359202, 0.0573801, -0.931494, 0.382253, -0.000496517, -0.924058, 0.403286, -0.0584401, -0.913206, 0.424153, -0.114226, -0.898358, 0.446941, -0.165937, -0.879039, 0.474155, -0.178169, -0.862226, 0.350649, 0.158542, -0.92299, 0.324633, 0.12185, -0.937958, 0.350677, 0.085911, -0.932548, 0.3667, 0.0451843, -0.929241, 0.383011, -7.3017e-05, -0.923744, 0.397138, -0.0456139, -0.916625, 0.412014, -0.0856748, -0.907141, 0.430071, -0.123784, -0.894269, 0.442961, -0.138507, -0.885777, 0.389705, 0.111994, -0.914105, 0.361904, 0.0540791, -0.930645, 0.382328, -0.00019054, -0.924027, 0.400721, -0.0547501, -0.914563, 0.402118, -0.100136, -0.910095, 0.394317, 0.0678065, -0.916469, 0.363948, 0.0391714, -0.930595, 0.383706, 0.000217135, -0.923455, 0.397881, -0.0399735, -0.916566, 0.376905, -0.066141, -0.923888, 0.417892, 0.0442946, -0.907416, 0.345375, 0.0208594, -0.938233, 0.385691, 0.000550116, -0.922628, 0.41093, -0.0222526, -0.911395, 0.344692, -0.0445088, -0.93766, 0.371716, 0.0278985, -0.927927, 0.277459, 0.00814318, -0.960703, 0.387543, 0.000483254, -0.921852, 0.463236, -0.0104995, -0.886173, 0.391904, -0.0244642, -0.919681, 0.112713, 0.00672117, -0.993605, 0.112714, 0.00916875, -0.993585, 0.20216, -0.0377808, -0.978623, 0.202275, -0.0166597, -0.979187, 0.38267, -0.0108138, -0.923822, 0.382683, -0.00646886, -0.923857, 0.549311, 0.0202338, -0.835373, 0.548962, 0.0356075, -0.835088, 0.622792, -0.0186274, -0.782165, 0.622881, -0.00795491, -0.782277, -0.84931, 0.526071, -0.0438477, -0.846364, 0.531001, -0.0413024, -0.787892, 0.614415, -0.0414755, -0.900778, 0.431942, -0.0450039, -0.900796, 0.431951, -0.0445528, 0.656686, -0.465355, 0.593471, 0.63743, -0.508978, 0.578467, 0.667855, -0.433098, 0.605306, 0.58614, -0.615881, 0.526433, -0.725668, 0.686836, -0.0407578, -0.883955, 0.465435, -0.0446595, -0.57459, 0.817533, -0.0385507, 0.545587, -0.681242, 0.488103, 0.424004, -0.82787, 0.367222, -0.424931, 0.904616, -0.0332184, -0.388459, 0.920871, -0.0331246, 0.421151, -0.825739, 0.375215, 0.234099, -0.953938, 0.187616, -0.204277, 0.978639, -0.0231723, -0.167479, 0.985603, -0.0231917, 0.237563, -0.949654, 0.204255, 0.0808703, -0.995544, 0.0484948, -0.031507, 0.999369, -0.0163792, 0.0150077, 0.999755, -0.0162437, 0.0509871, -0.998323, 0.027411, -0.0454801, -0.996644, -0.0680527, 0.180244, 0.983565, -0.0106269, 0.166297, 0.986018, -0.0106465, -0.0650926, -0.994619, -0.0805993, -0.154702, -0.973311, -0.169511, 0.381946, 0.924179, 0.00334116, 0.257602, 0.966246, 0.00306139, -0.168, -0.97218, -0.163223, -0.296558, -0.908483, -0.29447, 0.766979, 0.641431, 0.0175945, 0.584027, 0.811549, 0.0173593, -0.425714, -0.811083, -0.401139, -0.55404, -0.643801, -0.527787, 0.921121, 0.386616, 0.0454229, 0.858576, 0.51234, 0.0188488, 0.848724, 0.528562, 0.0170223, 0.99298, 0.107745, 0.0488139, -0.683497, -0.385989, -0.619551, -0.613117, -0.529245, -0.586504, -0.62062, -0.511921, -0.593942, -0.73667, -0.107363, -0.667676, -0.564794, 0.289285, -0.772866, -0.538661, 0.443208, -0.716528, -0.595776, 0.462313, -0.656748, -0.601028, 0.320075, -0.732337, -0.543612, 0.206407, -0.813561, -0.514007, 0.196901, -0.834881, -0.445751, 0.131268, -0.88548, -0.443266, 0.142043, -0.885065, -0.468901, 0.102993, -0.877225, -0.379779, 0.0163027, -0.924933, -0.461654, 0.0551701, -0.885343, -0.38269, 0.000319996, -0.923877, -0.303287, -0.0786204, -0.94965, -0.28877, -0.102849, -0.951858, -0.224611, -0.180932, -0.957504, -0.191475, -0.191789, -0.962577, -0.0942803, -0.272825, -0.957433, -0.144872, -0.274996, -0.950468, -0.0434238, -0.463329, -0.885122, -0.123933, -0.423295, -0.897475, -0.489891, 0.285675, -0.823648, -0.495769, 0.223804, -0.839121, -0.460063, 0.154934, -0.874264, -0.44658, 0.127596, -0.885599, -0.422916, 0.0790144, -0.902718, -0.445448, 0.132573, -0.885438, -0.383095, -0.000649926, -0.923709, -0.461534, 0.0557894, -0.885366, -0.339105, -0.0786731, -0.937453, -0.291559, -0.152711, -0.944284, -0.244196, -0.225954, -0.943034, -0.235333, -0.284856, -0.929234, -0.47467, 0.177865, -0.862005, -0.450685, 0.163015, -0.877673, -0.425754, 0.113195, -0.897731, -0.404631, 0.057319, -0.912682, -0.382248, 0.00050074, -0.92406, -0.359766, -0.0578045, -0.93125, -0.335211, -0.11436, -0.935176, -0.30558, -0.165891, -0.937604, -0.288794, -0.189677, -0.938414, -0.444566, 0.137651, -0.885106, -0.432516, 0.122486, -0.893268, -0.412447, 0.0855396, -0.906957, -0.397968, 0.0450727, -0.916292, -0.382454, 0.000147356, -0.923975, -0.36742, -0.0455835, -0.928938, -0.350095, -0.0856992, -0.932786, -0.327899, -0.123696, -0.93658, -0.281835, -0.184103, -0.941634, -0.358554, -0.162539, -0.91925, -0.282654, -0.184758, -0.941261, -0.406152, 0.0989043, -0.908437, -0.402378, 0.0540392, -0.913877, -0.382995, -0.000168679, -0.923751, -0.363377, -0.0546499, -0.930038, -0.393556, -0.113254, -0.912298, -0.377277, 0.0659189, -0.923752, -0.401596, 0.0390267, -0.914985, -0.382244, 0.000144495, -0.924061, -0.366526, -0.0398909, -0.929552, -0.395691, -0.0681878, -0.915849, -0.347795, 0.0441162, -0.936532, -0.419218, 0.0209138, -0.907645, -0.380934, 0.0002579, -0.924602, -0.352453, -0.0219914, -0.935571, -0.417616, -0.0443472, -0.907541, -0.404839, 0.0230641, -0.914097, -0.483124, 0.00813012, -0.875514, -0.38074, 0.000203032, -0.924682, -0.295686, -0.0101056, -0.955232, -0.361017, -0.0267407, -0.932176, -0.622886, 0.00673797, -0.782284, -0.622874, 0.00916503, -0.782268, -0.549023, -0.0415342, -0.834775, -0.549321, -0.0197105, -0.835379, -0.382583, -0.0110415, -0.923855, -0.382687, 0.00390406, -0.92387, -0.202182, 0.0351821, -0.978716, -0.202212, 0.0303373, -0.978872, -0.112622, -0.00484097, -0.993626, -0.112496, -0.0483017, -0.992478, -0.647849, 0.487901, 0.585016, -0.627914, 0.530981, 0.569019, -0.586419, 0.614426, 0.52782, -0.668259, 0.431963, 0.605672, 0.900217, -0.433111, -0.044993, 0.859768, -0.50899, -0.041567, 0.900249, -0.43312, -0.0442553, 0.848702, -0.527052, -0.0438325, 0.786716, -0.615863, -0.0423213, -0.424811, 0.826244, 0.36994, -0.546196, 0.680313, 0.488717, 0.72482, -0.687719, -0.0409626, 0.883461, -0.466372, -0.0446488, 0.571331, -0.819735, -0.0401828, -0.421885, 0.825026, 0.375959, -0.23509, 0.953428, 0.188966, 0.423844, -0.905135, -0.0329662, 0.387466, -0.921293, -0.0330077, -0.238313, 0.949291, 0.205068, -0.0818512, 0.995393, 0.0499289, 0.227267, -0.973551, -0.0233962, 0.16636, -0.985792, -0.0231878, -0.084225, 0.994592, 0.0607612, 0.0444369, 0.996773, -0.0668488, 0.0299456, -0.999418, -0.0163687, -0.0164349, -0.999733, -0.0162382, 0.0401046, 0.99764, -0.0557383, 0.153706, 0.973654, -0.16844, -0.167317, -0.985844, -0.01079, -0.167664, -0.985786, -0.0107568, 0.144074, 0.979777, -0.138853, 0.296229, 0.909497, -0.291656, -0.370098, -0.928991, 0.00199626, -0.259071, -0.965853, 0.00304755, 0.554892, 0.641445, -0.529758, 0.425261, 0.811541, -0.400693, -0.584675, -0.811082, 0.0173652, -0.764899, -0.643882, 0.0185816, 0.683447, 0.386605, -0.619222, 0.620451, 0.512324, -0.593772, 0.612269, 0.52855, -0.588016, 0.736639, 0.107748, -0.667648, -0.921448, -0.385852, 0.0453037, -0.848233, -0.529289, 0.0188265, -0.858824, -0.511924, 0.0188487, -0.993021, -0.107364, 0.0488159, -0.154042, -0.0826912, -0.984598, -0.298895, -0.197903, -0.93354, -0.303306, -0.201426, -0.931361, -0.438861, -0.310786, -0.843097, -0.948745, 0.2804, -0.145806, -0.897756, 0.423102, -0.122552, -0.88569, 0.462282, -0.0429892, -0.942831, 0.320077, -0.0928435, -0.959664, 0.206408, -0.190896, -0.956696, 0.184427, -0.22521, -0.946579, 0.100323, -0.30647, -0.951844, 0.102993, -0.288766, -0.923469, 0.00545118, -0.383635, -0.923877, 0.000320197, -0.38269, -0.886133, -0.0891962, -0.454767, -0.877238, -0.102849, -0.468908, -0.835267, -0.190305, -0.515861, -0.816029, -0.19179, -0.545264, -0.740985, -0.284824, -0.608125, -0.774352, -0.275907, -0.569434, -0.721292, -0.427621, -0.544865, -0.640246, -0.503521, -0.580131, -0.940689, 0.23178, -0.247753, -0.926137, 0.291311, -0.239599, -0.942593, 0.157593, -0.294421, -0.937108, 0.0798114, -0.339793, -0.922585, 0.00515366, -0.385759, -0.90111, -0.0713545, -0.42768, -0.873329, -0.149856, -0.463508, -0.838577, -0.220719, -0.498068, -0.822961, -0.281153, -0.493648, -0.935574, 0.194446, -0.294776, -0.939285, 0.162957, -0.301975, -0.935595, 0.113504, -0.334333, -0.930447, 0.0592454, -0.361606, -0.923785, 0.000294618, -0.382911, -0.91339, -0.0588338, -0.402813, -0.897822, -0.113507, -0.425479, -0.878894, -0.165601, -0.44735, -0.862162, -0.178345, -0.474204, -0.922809, 0.158744, -0.351032, -0.937472, 0.122472, -0.325801, -0.93295, 0.0854727, -0.349712, -0.929241, 0.0451843, -0.3667, -0.923779, 0.000112141, -0.382925, -0.916486, -0.0452478, -0.3975, -0.907546, -0.0861897, -0.411013, -0.893782, -0.123395, -0.431193, -0.885751, -0.138393, -0.443048, -0.914095, 0.111911, -0.389751, -0.930632, 0.0541063, -0.361935, -0.923994, -0.00022569, -0.382406, -0.914604, -0.0545407, -0.400656, -0.910057, -0.100143, -0.402202, -0.916945, 0.0674603, -0.393268, -0.930961, 0.0389505, -0.363036, -0.923543, 0.00018074, -0.383495, -0.916133, -0.0396416, -0.39891, -0.924253, -0.0663607, -0.375969, -0.907416, 0.0442945, -0.417892, -0.938234, 0.0209183, -0.345368, -0.92262, 0.000405472, -0.38571, -0.911388, -0.0223429, -0.410941, -0.93704, -0.0443121, -0.346399, -0.927936, 0.0279563, -0.371689, -0.960705, 0.00826058, -0.277449, -0.926403, -0.000806683, -0.376532, -0.886532, -0.01058, -0.462546, -0.914436, -0.0266899, -0.40385, -0.993604, 0.00678429, -0.112715, -0.993585, 0.0091688, -0.112714, -0.978623, -0.0377808, -0.20216, -0.979187, -0.0166598, -0.202275, -0.923822, -0.0108138, -0.38267, -0.923876, -0.00125153, -0.38269, -0.835373, 0.0202338, -0.549311, -0.835086, 0.035677, -0.548961, -0.782165, -0.0186274, -0.622792, -0.782277, -0.00795491, -0.622881, -0.0438477, 0.526071, 0.84931, -0.041355, 0.531014, 0.846353, -0.0414755, 0.614415, 0.787892, -0.0450039, 0.431942, 0.900778, -0.0446428, 0.431951, 0.900792, 0.593425, -0.465361, -0.656723, 0.578629, -0.509014, -0.637255, 0.605302, -0.433111, -0.667851, 0.526297, -0.615838, -0.586306, -0.0406815, 0.686839, 0.72567, -0.0446595, 0.465435, 0.883955, -0.0384173, 0.817546, 0.57458, 0.488102, -0.681243, -0.545586, 0.367224, -0.827868, -0.424006, -0.0332183, 0.904616, 0.424931, -0.0330469, 0.920873, 0.38846, 0.375223, -0.825732, -0.421159, 0.187625, -0.953934, -0.234108, -0.0230763, 0.97864, 0.204283, -0.0231917, 0.985603, 0.167479, 0.204267, -0.949649, -0.237575, 0.0484948, -0.995544, -0.0808703, -0.0163792, 0.999369, 0.031507, -0.0162467, 0.999755, -0.0150074, 0.0275527, -0.998326, -0.0508465, -0.0680998, -0.99664, 0.0455111, -0.0107243, 0.983566, -0.180233, -0.0106298, 0.986018, -0.166297, -0.0805993, -0.994619, 0.0650926, -0.169463, -0.973313, 0.154738, 0.00334116, 0.924179, -0.381946, 0.00315802, 0.966246, -0.257603, -0.163223, -0.97218, 0.168, -0.294422, -0.908485, 0.296598, 0.0175945, 0.641431, -0.766979, 0.0173593, 0.811549, -0.584027, -0.401108, -0.811083, 0.425743, -0.527787, -0.643801, 0.55404, 0.0454229, 0.386616, -0.921121, 0.0188488, 0.51234, -0.858576, 0.0170223, 0.528562, -0.848724, 0.0488139, 0.107745, -0.99298, -0.619504, -0.385853, 0.683617, -0.586504, -0.529245, 0.613117, -0.593895, -0.51192, 0.620666, -0.667676, -0.107363, 0.73667, -0.772866, 0.289285, 0.564794, -0.716528, 0.443208, 0.538661, -0.656748, 0.462313, 0.595776, -0.732337, 0.320075, 0.601028, -0.813561, 0.206407, 0.543612, -0.834881, 0.196901, 0.514007, -0.88548, 0.131268, 0.445751, -0.885065, 0.142043, 0.443266, -0.877225, 0.102993, 0.468901, -0.924933, 0.0163027, 0.379779, -0.885343, 0.0551701, 0.461654, -0.923877, 0.000319996, 0.38269, -0.94965, -0.0786204, 0.303287, -0.951858, -0.102849, 0.28877, -0.957504, -0.180932, 0.224611, -0.962577, -0.191789, 0.191475, -0.957433, -0.272825, 0.0942803, -0.950468, -0.274996, 0.144872, -0.885122, -0.463329, 0.0434238, -0.897475, -0.423295, 0.123933, -0.823648, 0.285675, 0.489891, -0.839121, 0.223804, 0.495769, -0.874264, 0.154934, 0.460063, -0.885599, 0.127596, 0.44658, -0.902718, 0.0790144, 0.422916, -0.885438, 0.132573, 0.445448, -0.923709, -0.000649926, 0.383095, -0.885366, 0.0557894, 0.461534, -0.937453, -0.0786731, 0.339105, -0.944284, -0.152711, 0.291559, -0.943034, -0.225954, 0.244196, -0.929234, -0.284856, 0.235333, -0.862005, 0.177865, 0.47467, -0.877673, 0.163015, 0.450685, -0.897731, 0.113195, 0.425754, -0.912682, 0.057319, 0.404631, -0.92406, 0.000500742, 0.382248, -0.93125, -0.0578045, 0.359766, -0.935177, -0.11436, 0.335211, -0.937604, -0.165891, 0.30558, -0.936115, -0.193574, 0.293627, -0.885106, 0.137651, 0.444566, -0.893268, 0.122486, 0.432516, -0.906957, 0.0855396, 0.412447, -0.916292, 0.0450727, 0.397968, -0.923975, 0.00014736, 0.382454, -0.928961, -0.0455525, 0.367364, -0.932786, -0.0856992, 0.350095, -0.936453, -0.123856, 0.328201, -0.91925, -0.162539, 0.358554, -0.908437, 0.0989043, 0.406152, -0.913877, 0.0540387, 0.40238, -0.923671, -0.00023893, 0.383186, -0.930037, -0.0546506, 0.363379, -0.912299, -0.113253, 0.393553, -0.923751, 0.0659186, 0.377278, -0.914989, 0.0389868, 0.401592, -0.924137, 0.000189597, 0.382061, -0.929879, -0.0396953, 0.365718, -0.916333, -0.0679302, 0.394613, -0.936532, 0.0441162, 0.347795, -0.907648, 0.0208723, 0.419213, -0.925125, 0.000448691, 0.379663, -0.935025, -0.0222015, 0.353886, -0.906788, -0.0445811, 0.419223, -0.914097, 0.0230641, 0.404839, -0.873228, 0.00773035, 0.487251, -0.92085, -0.000829093, 0.389916, -0.954174, -0.0104719, 0.299069, -0.927438, -0.0245427, 0.37317, -0.782284, 0.00671694, 0.622886, -0.782268, 0.00916503, 0.622874, -0.834809, -0.0405291, 0.549046, -0.835379, -0.0197105, 0.549321, -0.923888, -0.00712593, 0.382596, -0.92387, 0.00390406, 0.382687, -0.978716, 0.0351821, 0.202182, -0.978872, 0.0303373, 0.202212, -0.993626, -0.00484097, 0.112622, -0.992478, -0.0483017, 0.112496, 0.584973, 0.4879, 0.647889, 0.569019, 0.530981, 0.627914, 0.52782, 0.614426, 0.586419, 0.605672, 0.431963, 0.668259, -0.044993, -0.433111, -0.900217, -0.041567, -0.50899, -0.859768, -0.0442553, -0.43312, -0.900249, -0.0438325, -0.527052, -0.848702, -0.0423213, -0.615863, -0.786716, 0.36994, 0.826244, 0.424811, 0.488717, 0.680313, 0.546196, -0.0409626, -0.687719, -0.72482, -0.0446488, -0.466372, -0.883461, -0.0401828, -0.819735, -0.571331, 0.375959, 0.825026, 0.421885, 0.188966, 0.953428, 0.23509, -0.0329662, -0.905135, -0.423844, -0.0330465, -0.921292, -0.387465, 0.205135, 0.949293, 0.238246, 0.0499289, 0.995393, 0.0818512, -0.0233962, -0.973551, -0.227267, -0.0231878, -0.985792, -0.16636, 0.0607612, 0.994592, 0.084225, -0.0668488, 0.996773, -0.0444369, -0.0163687, -0.999418, -0.0299456, -0.0162382, -0.999733, 0.0164349, -0.0557383, 0.99764, -0.0401046, -0.16844, 0.973654, -0.153706, -0.01079, -0.985843, 0.167322, -0.0107568, -0.985786, 0.167664, -0.138853, 0.979777, -0.144074, -0.291656, 0.909497, -0.296229, 0.00199626, -0.928991, 0.370098, 0.00304755, -0.965853, 0.259071, -0.529758, 0.641445, -0.554892, -0.400693, 0.811541, -0.42526, 0.0173652, -0.811082, 0.584675, 0.0185816, -0.643882, 0.764899, -0.619222, 0.386605, -0.683447, -0.593772, 0.512324, -0.620451, -0.588016, 0.52855, -0.612269, -0.667648, 0.107748, -0.736639, 0.0453037, -0.385852, 0.921448, 0.0188265, -0.529289, 0.848232, 0.0188487, -0.511924, 0.858824, 0.0488159, -0.107364, 0.993021, -0.145685, 0.280423, 0.948757, -0.122458, 0.423102, 0.897769, -0.0429892, 0.462282, 0.88569, -0.0928435, 0.320077, 0.942831, -0.190896, 0.206408, 0.959664, -0.225043, 0.184457, 0.956729, -0.30654, 0.100312, 0.946557, -0.288766, 0.102993, 0.951844, -0.38372, 0.00543446, 0.923433, -0.38269, 0.000320197, 0.923877, -0.454767, -0.0891962, 0.886133, -0.468908, -0.102849, 0.877238, -0.515793, -0.19029, 0.835313, -0.545264, -0.19179, 0.816029, -0.608125, -0.284824, 0.740985, -0.569434, -0.275907, 0.774352, -0.544865, -0.427621, 0.721292, -0.580237, -0.503491, 0.640173, -0.247732, 0.231797, 0.940691, -0.239511, 0.291352, 0.926147, -0.296275, 0.160695, 0.941487, -0.342429, 0.084028, 0.935779, -0.38672, 0.00672326, 0.922173, -0.42768, -0.0713545, 0.90111, -0.463405, -0.14977, 0.873398, -0.498068, -0.220719, 0.838577, -0.493648, -0.281153, 0.822961, -0.294671, 0.194491, 0.935597, -0.301976, 0.162958, 0.939285, -0.333605, 0.113359, 0.935872, -0.358533, 0.0567593, 0.93179, -0.38219, -0.00041149, 0.924084, -0.404041, -0.0578103, 0.912912, -0.425595, -0.113165, 0.89781, -0.446986, -0.165886, 0.879025, -0.474155, -0.178169, 0.862226, -0.350976, 0.158821, 0.922817, -0.32576, 0.122556, 0.937476, -0.349709, 0.0854712, 0.932951, -0.366746, 0.0451044, 0.929227, -0.382641, 0.000102819, 0.923897, -0.396846, -0.0455899, 0.916752, -0.412014, -0.0856748, 0.907141, -0.430371, -0.123625, 0.894146, -0.443048, -0.138393, 0.885751, -0.389752, 0.111912, 0.914095, -0.361699, 0.0540013, 0.93073, -0.382171, -0.000213965, 0.924092, -0.400644, -0.0545031, 0.914611, -0.402234, -0.100372, 0.910018, -0.393269, 0.0674605, 0.916945, -0.363037, 0.0389507, 0.93096, -0.383303, 0.000212172, 0.923623, -0.398917, -0.0396806, 0.916128, -0.375971, -0.0663601, 0.924252, -0.417838, 0.0443479, 0.907439, -0.345376, 0.0208596, 0.938233, -0.384438, 0.000214055, 0.923151, -0.412317, -0.021911, 0.910777, -0.346399, -0.0443122, 0.93704, -0.371689, 0.0279563, 0.927936, -0.277449, 0.00826058, 0.960705, -0.384621, 0.000232153, 0.923075, -0.466371, -0.010097, 0.884532, -0.403829, -0.0266484, 0.914446, -0.112714, 0.00674221, 0.993605, -0.112714, 0.0091688, 0.993585, -0.20216, -0.0377808, 0.978623, -0.202275, -0.0166598, 0.979187, -0.38267, -0.0108138, 0.923822, -0.382683, -0.00646889, 0.923857, -0.549311, 0.0202338, 0.835373, -0.548962, 0.0356075, 0.835088, -0.622792, -0.0186274, 0.782165, -0.622881, -0.00795491, 0.782277, 0.871772, 0.487902, 0.0443442, 0.846358, 0.530993, 0.0415209, 0.787859, 0.614473, 0.0412475, 0.900792, 0.431951, 0.0446428, -0.656686, -0.465355, -0.593471, -0.63728, -0.509, -0.578613, -0.667855, -0.433098, -0.605306, -0.58614, -0.61588, -0.526433, 0.72567, 0.686839, 0.0406815, 0.57458, 0.817546, 0.0384173, -0.545587, -0.681242, -0.488103, -0.424004, -0.82787, -0.367222, 0.424922, 0.904617, 0.0333068, 0.38846, 0.920873, 0.0330469, -0.421151, -0.825739, -0.375215, -0.234099, -0.953938, -0.187616, 0.204283, 0.97864, 0.0230763, 0.167479, 0.985603, 0.0231917, -0.237465, -0.949658, -0.204354, -0.0807607, -0.995553, -0.0484913, 0.031507, 0.999369, 0.0163792, -0.0150074, 0.999755, 0.0162467, -0.051185, -0.998319, -0.0271744, 0.0454825, -0.996644, 0.0680551, -0.180233, 0.983566, 0.0107243, -0.166297, 0.986019, 0.0105645, 0.065102, -0.994618, 0.0805997, 0.154705, -0.97331, 0.169514, -0.381961, 0.924172, -0.00343389, -0.257602, 0.966246, -0.00306139, 0.16793, -0.972181, 0.163291, 0.296598, -0.908485, 0.294422, -0.766979, 0.641431, -0.0175945, -0.584027, 0.811549, -0.0173593, 0.425714, -0.811083, 0.401139, 0.554088, -0.643881, 0.52764, -0.921121, 0.386616, -0.0454229, -0.858576, 0.51234, -0.0188488, -0.848724, 0.528562, -0.0170223, -0.99298, 0.107745, -0.0488139, 0.683617, -0.385853, 0.619504, 0.613149, -0.529285, 0.586434, 0.62062, -0.511921, 0.593942, 0.73667, -0.107363, 0.667676, -0.937404, -0.348243, -9.37413e-05, -0.926617, -0.376008, 0, -0.912791, -0.365847, -0.18157, -0.897239, -0.403867, -0.178478, -0.849477, -0.393241, -0.351782, -0.835848, -0.426011, -0.346227, -0.757726, -0.411719, -0.506299, -0.747955, -0.436792, -0.499776, -0.643758, -0.413702, -0.64376, -0.637593, -0.432377, -0.637593, -0.509181, -0.399785, -0.762172, -0.507311, -0.40768, -0.759232, -0.358234, -0.351184, -0.865065, -0.35732, -0.358044, -0.862628, -0.187879, -0.269505, -0.944494, -0.186697, -0.29026, -0.938559, 0, -0.0802808, -0.996772, 0, 0.00714401, -0.999974, 0, -0.0802808, -0.996772, 0, 0.00714401, -0.999974, 0.187739, 0.272091, -0.94378, 0.184385, 0.326789, -0.926936, 0.3575, 0.35625, -0.863296, 0.353262, 0.384557, -0.852832, 0.50607, 0.412683, -0.757354, 0.501482, 0.430411, -0.750508, 0.63617, 0.436546, -0.636173, 0.631498, 0.449912, -0.631498, 0.737211, 0.462463, -0.492593, 0.748095, 0.436544, -0.499783, 0.823856, 0.452555, -0.341257, 0.838465, 0.420016, -0.347223, 0.884825, 0.4314, -0.176007, 0.901357, 0.394218, -0.179295, 0.915651, 0.401975, 0, 0.927708, 0.373306, 0, 0.912595, 0.366354, 0.181534, 0.924373, 0.334251, 0.183879, 0.873404, 0.326, 0.361786, 0.883071, 0.294037, 0.36569, 0.797749, 0.28187, 0.533053, 0.804773, 0.251331, 0.537749, 0.68888, 0.225585, 0.68888, 0.693001, 0.198749, 0.692999, 0.548174, 0.161971, 0.820531, 0.546679, 0.178256, 0.818149, 0.38005, 0.115395, 0.91774, 0.379642, 0.125969, 0.916517, 0.194682, 0.0651343, 0.978701, 0.194426, 0.0827632, 0.977419, 0, 0.029332, 0.99957, 0, 0.0150352, 0.999887, -0.195003, -0.0311596, 0.980308, -0.195039, -0.0245693, 0.980488, -0.381734, -0.0707073, 0.921564, -0.381091, -0.0913388, 0.920015, -0.551182, -0.125533, 0.824888, -0.550107, -0.140003, 0.823275, -0.694783, -0.185882, 0.694784, -0.697409, -0.165058, 0.697407, -0.811619, -0.217428, 0.542217, -0.805802, -0.246531, 0.538429, -0.891778, -0.2613, 0.369397, -0.883288, -0.293147, 0.365878, -0.934763, -0.302726, 0.185944, -0.923861, -0.33572, 0.183774, -0.900846, -0.121733, -0.416722, -0.949592, -0.145137, -0.277866, -0.950172, -0.144318, -0.276307, -0.925914, -0.0932179, -0.366052, -0.892521, -0.130272, -0.431783, -0.74206, -0.16522, -0.649653, -0.794192, -0.211041, -0.569843, -0.772588, -0.144011, -0.61836, -0.59112, -0.170823, -0.788287, -0.616835, -0.156086, -0.771461, -0.416049, -0.175904, -0.892167, -0.449228, -0.158839, -0.879184, -0.237616, -0.174075, -0.955634, -0.236428, -0.174912, -0.955776, -0.0987173, -0.149069, -0.983887, -0.0734578, -0.161315, -0.984165, 0.0173685, -0.110267, -0.99375, 0.0304998, -0.11675, -0.992693, 0.0840596, -0.0439177, -0.995492, 0.107689, -0.0562619, -0.992591, 0.0129595, -0.00676866, -0.999893, -0.0531357, 0.128107, -0.990336, -0.112777, 0.0589195, -0.991872, -0.0417342, 0.122529, -0.991587, -0.134834, 0.0704419, -0.988361, 0.0129595, -0.00676866, -0.999893, 0.0374253, 0.178518, -0.983225, 0.0605236, 0.167528, -0.984008, 0.187003, 0.197966, -0.962206, 0.212524, 0.186168, -0.959258, 0.348903, 0.208625, -0.913642, 0.389794, 0.188926, -0.901314, 0.53471, 0.201283, -0.820713, 0.603811, 0.163639, -0.780151, 0.740842, 0.166033, -0.650835, 0.707031, 0.187817, -0.681786, 0.869027, 0.152577, -0.47065, 0.842047, 0.175583, -0.510027, 0.946199, 0.149812, -0.286817, 0.942426, 0.154738, -0.296461, 0.988109, 0.136707, -0.0703664, 0.989588, 0.131228, -0.059108, 0.980481, 0.121372, 0.154679, 0.978942, 0.113823, 0.169463, 0.920505, 0.103438, 0.376791, 0.922191, 0.106185, 0.371873, 0.815384, 0.0899337, 0.571892, 0.794771, 0.070937, 0.60275, 0.643516, 0.0580428, 0.763229, 0.680226, 0.0840936, 0.728162, 0.481935, 0.0578215, 0.874297, 0.443703, 0.0351319, 0.895485, 0.340842, 0.0791835, 0.93678, 0.23916, 0.023664, 0.970692, 0.0350413, 0.0184167, 0.999216, 0.00930792, 0.0048617, 0.999945, 0.152876, -0.0223284, 0.987993, -0.219767, -0.0131048, 0.975464, -0.184471, 0.00559798, 0.982822, -0.41132, -0.0163308, 0.911345, -0.442861, -0.0346387, 0.895921, -0.624125, -0.0446621, 0.780047, -0.612607, -0.0369886, 0.789521, -0.783909, -0.0613361, 0.617839, -0.768872, -0.0485115, 0.63756, -0.902818, -0.078307, 0.422833, -0.902947, -0.0786053, 0.422502, -0.971832, -0.0889656, 0.21824, -0.9749, -0.0985529, 0.199643, -0.994225, -0.106804, -0.0105127, -0.993149, -0.114099, -0.0252361, -0.940451, -0.28382, -0.187076, -0.96846, -0.24917, 0, -0.9673, -0.253634, 0, -0.939084, -0.288491, -0.186799, -0.875005, -0.321043, -0.36235, -0.874765, -0.321707, -0.362342, -0.775978, -0.359175, -0.518509, -0.777863, -0.353253, -0.519751, -0.649764, -0.394483, -0.649761, -0.653287, -0.382662, -0.653289, -0.501531, -0.430194, -0.7506, -0.510572, -0.394293, -0.7641, -0.341347, -0.45207, -0.824084, -0.352949, -0.386537, -0.852066, -0.175411, -0.437711, -0.881839, -0.184489, -0.325279, -0.927447, 0, -0.379369, -0.925245, 0, -0.210624, -0.977567, 0, 0.398332, -0.917241, 0.180967, 0.373658, -0.909742, 0.173805, 0.454236, -0.873763, 0, 0.229415, -0.973329, 0.340576, 0.455677, -0.822415, 0.348502, 0.413169, -0.841331, 0.495437, 0.452502, -0.741474, 0.505249, 0.415915, -0.756133, 0.639946, 0.425371, -0.639945, 0.647503, 0.401841, -0.647505, 0.765393, 0.390655, -0.511432, 0.771968, 0.371489, -0.515811, 0.864505, 0.3527, -0.358099, 0.868995, 0.339533, -0.359952, 0.931601, 0.312696, -0.185314, 0.932856, 0.308783, -0.185559, 0.962148, 0.272529, 0, 0.9634, 0.268068, 0, 0.953178, 0.235586, 0.189607, 0.953806, 0.232931, 0.189729, 0.904343, 0.204722, 0.374502, 0.905158, 0.200276, 0.374938, 0.819291, 0.170509, 0.547439, 0.819387, 0.169815, 0.547511, 0.699981, 0.141611, 0.69998, 0.700179, 0.139632, 0.70018, 0.55209, 0.111843, 0.826249, 0.552249, 0.109238, 0.826491, 0.381455, 0.0802374, 0.920898, 0.381553, 0.076987, 0.921135, 0.194885, 0.0464909, 0.979724, 0.194871, 0.0479793, 0.979655, 0, 0.0128142, 0.999918, 0, 0.0135384, 0.999908, -0.195063, -0.0186677, 0.980613, -0.195039, -0.0240965, 0.980499, -0.382118, -0.0503918, 0.922739, -0.382076, -0.0565635, 0.922398, -0.553527, -0.0858519, 0.828395, -0.553488, -0.0865841, 0.828344, -0.702196, -0.117655, 0.702196, -0.702472, -0.114295, 0.702474, -0.822939, -0.142872, 0.549872, -0.822094, -0.149707, 0.549317, -0.908746, -0.180246, 0.37642, -0.909097, -0.178152, 0.376569, -0.958248, -0.213134, 0.190615, -0.95906, -0.209307, 0.190773, -0.900898, -0.276731, 0.33437, -0.972449, -0.148629, 0.17959, -0.956293, -0.261165, 0.131519, -0.788648, -0.459202, 0.408862, -0.88952, -0.419739, 0.180482, -0.966362, -0.244082, -0.0810507, -0.934106, -0.318474, -0.161305, -0.931687, -0.241848, -0.271052, -0.881812, -0.306034, -0.358819, -0.890646, -0.354664, -0.284539, -0.791444, -0.299639, -0.53276, -0.803053, -0.322049, -0.501388, -0.668448, -0.294887, -0.682802, -0.678719, -0.307801, -0.666782, -0.622958, -0.396767, -0.674165, -0.582249, -0.354439, -0.731683, -0.650653, -0.53856, -0.535354, -0.618335, -0.511809, -0.596417, -0.618365, -0.511775, -0.596416, 0.639518, 0.529343, -0.557506, 0.67302, 0.451689, -0.58568, 0.639549, 0.529307, -0.557505, 0.664071, 0.549667, -0.506829, 0.600263, 0.372962, -0.707519, 0.694319, 0.328032, -0.640559, 0.68394, 0.314501, -0.658267, 0.790873, 0.298704, -0.534131, 0.804762, 0.325529, -0.496376, 0.881187, 0.303546, -0.362448, 0.892558, 0.383102, -0.237854, 0.927588, 0.361464, -0.0944727, 0.932328, 0.246773, -0.264325, 0.957023, 0.289465, -0.0178293, 0.889172, 0.42017, 0.181193, 0.948527, 0.277311, 0.152956, 0.831723, 0.424617, 0.357683, 0.903924, 0.272688, 0.329488, 0.75326, 0.419354, 0.506697, 0.897102, 0.181935, 0.402625, 0.661186, 0.40553, 0.631172, 0.819861, 0.160576, 0.549584, 0.560806, 0.383483, 0.733783, 0.682131, 0.174997, 0.709981, 0.372663, 0.403621, 0.835591, 0.436408, 0.250336, 0.864222, 0.634452, 0.0787009, 0.768945, 0.418158, 0.125825, 0.899618, 0.18661, 0.301488, 0.93503, 0.182902, 0.166988, 0.968846, 0.300358, 0.0715684, 0.951138, 0.0851115, 0.0911331, 0.992195, 0.16322, 0.0267718, 0.986226, -0.0462573, 0.038297, 0.998195, -0.0414527, 0.0343058, 0.998551, 0.0360801, -0.0298561, 0.998903, -0.141874, -0.0445262, 0.988883, -0.0543859, 0.0450083, 0.997505, -0.164317, -0.0258562, 0.986069, -0.0318288, 0.0263372, 0.999146, -0.279286, -0.0892397, 0.956052, -0.17951, -0.169643, 0.969019, -0.356357, -0.176628, 0.917503, -0.487011, -0.0653245, 0.87095, -0.603132, -0.109406, 0.790102, -0.437437, -0.249561, 0.863926, -0.691406, -0.166021, 0.703132, -0.423214, -0.373431, 0.825493, -0.585249, -0.367384, 0.722851, -0.823465, -0.156258, 0.545426, -0.677054, -0.39478, 0.621085, -0.900017, -0.177699, 0.397986, -0.909585, -0.112324, -0.400047, -0.810895, -0.199305, -0.550206, -0.808183, -0.201257, -0.553476, 0.100164, -0.052345, -0.993593, 0.055134, -0.0288176, -0.998063, -0.0794559, 0.0415253, -0.995973, -0.11799, 0.0616582, -0.991099, 0.336458, 0.0767612, 0.938565, 0.332442, 0.0745394, 0.940174, 0.148386, -0.0246903, 0.988621, -0.293605, -0.243037, -0.924516, 0.304361, 0.251942, -0.918635, 0.0379335, -0.0313885, 0.998787, -0.0547166, 0.0452818, 0.997475, 0.995187, 0, 0.0979989, 1, 0, 0, 1, 0, 0, 0.995187, 0, 0.0979989, 0.980784, 0, 0.195097, 0.980784, 0, 0.195097, 0.956933, 0, 0.29031, 0.956933, 0, 0.29031, 0.923912, 0, 0.382605, 0.923877, 0, 0.382691, 0.881979, 0, 0.471289, 0.881915, 0, 0.471408, 0.831512, 0, 0.555508, 0.831465, 0, 0.555577, 0.772953, 0, 0.634463, 0.773003, 0, 0.634402, 0.707107, 0, 0.707107, 0.707107, 0, 0.707107, 0.634403, 0, 0.773003, 0.634403, 0, 0.773003, 0.555508, 0, 0.831511, 0.555576, 0, 0.831466, 0.471288, 0, 0.881979, 0.471408, 0, 0.881915, 0.382605, 0, 0.923912, 0.38269, 0, 0.923877, 0.290189, 0, 0.956969, 0.29031, 0, 0.956933, 0.195096, 0, 0.980784, 0.195097, 0, 0.980784, 0.0979981, 0, 0.995187, 0.0979985, 0, 0.995187, 0, 0, 1, 0, 0, 1, -0.0979989, 0, 0.995187, -0.0979987, 0, 0.995187, -0.195097, 0, 0.980784, -0.195097, 0, 0.980784, -0.290309, 0, 0.956933, -0.29031, 0, 0.956933, -0.382605, 0, 0.923912, -0.38269, 0, 0.923877, -0.471289, 0, 0.881979, -0.471408, 0, 0.881915, -0.555507, 0, 0.831512, -0.555576, 0, 0.831466, -0.634463, 0, 0.772953, -0.634402, 0, 0.773003, -0.707107, 0, 0.707107, -0.707107, 0, 0.707107, -0.773003, 0, 0.634403, -0.773003, 0, 0.634402, -0.831511, 0, 0.555508, -0.831466, 0, 0.555576, -0.881979, 0, 0.471288, -0.881915, 0, 0.471408, -0.923912, 0, 0.382605, -0.923877, 0, 0.38269, -0.956969, 0, 0.290189, -0.956933, 0, 0.29031, -0.980784, 0, 0.195096, -0.980784, 0, 0.195097, -0.995187, 0, 0.0979981, -0.995187, 0, 0.0979989, -1, 0, 0, -1, 0, 0, -0.995177, 0, -0.098098, -0.995187, 0, -0.0979985, -0.980784, 0, -0.195097, -0.980784, 0, -0.195097, -0.956933, 0, -0.290309, -0.956933, 0, -0.29031, -0.923912, 0, -0.382605, -0.923877, 0, -0.38269, -0.881979, 0, -0.471289, -0.881915, 0, -0.471408, -0.831512, 0, -0.555507, -0.831466, 0, -0.555576, -0.773587, 0, -0.63369, -0.773677, 0, -0.633581, -0.738938, 0.0966109, -0.666812, -0.731934, -0.167345, -0.660506, 0.773635, 0, -0.633631, 0.737393, -0.116022, -0.665425, 0.734841, 0.142282, -0.663147, 0.773677, 0, -0.633581, 0.831511, 0, -0.555508, 0.831465, 0, -0.555577, 0.881979, 0, -0.471288, 0.881915, 0, -0.471408, 0.923912, 0, -0.382605, 0.923877, 0, -0.38269, 0.956969, 0, -0.290189, 0.956933, 0, -0.290309, 0.980765, 0, -0.195192, 0.980784, 0, -0.195097, 0.995187, 0, -0.0979981, 0.995187, 0, -0.0979985, 0.996659, 0.00843887, 0.0812405, 0.999988, -0.00218158, 0.00436935, 0.999961, -0.00392621, 0.00786356, 0.998075, 0.0196356, 0.0588332, 0.982644, 0.00490262, 0.185434, 0.990372, -0.0195822, 0.13704, 0.990371, -0.0195843, 0.137045, 0.980785, -3.72485e-06, 0.19509, 0.958551, 0.00281232, 0.284906, 0.958555, 0.00278669, 0.284894, 0.923867, 6.4359e-05, 0.382714, 0.928801, 0.00652231, 0.370522, 0.886472, 0.00503403, 0.462755, 0.881891, 0.000128705, 0.471453, 0.831455, 5.35818e-05, 0.555593, 0.838663, 0.00654765, 0.544611, 0.783559, 0.00842742, 0.62126, 0.769409, -0.00273375, 0.63875, 0.714015, 0.00490888, 0.700113, 0.707085, 6.35595e-05, 0.707129, 0.638728, 0.00279107, 0.769427, 0.63875, 0.00273389, 0.769409, 0.555593, -5.32912e-05, 0.831454, 0.566463, 0.00641397, 0.824062, 0.486235, 0.00828225, 0.873789, 0.466453, -0.00285358, 0.884541, 0.398218, 0.00834399, 0.917253, 0.377475, -0.00278542, 0.926015, 0.306353, 0.00842818, 0.951881, 0.284894, -0.00278688, 0.958555, 0.204678, 0.00499736, 0.978816, 0.195089, 3.62199e-06, 0.980785, 0.137038, 0.019581, 0.990372, 0.137038, 0.019581, 0.990372, 0.13704, 0.0195818, 0.990372, 0.00436767, 0.00218074, 0.999988, 0.0588329, -0.0196358, 0.998075, 0.0588329, -0.0196358, 0.998075, 0.0588303, -0.019637, 0.998075, 0.00786391, 0.00392639, 0.999961, -0.0588399, 0.0196322, 0.998074, -0.0588399, 0.0196322, 0.998074, -0.0588306, 0.0196369, 0.998075, -0.195088, -3.12924e-06, 0.980786, -0.137038, -0.019581, 0.990372, -0.137038, -0.019581, 0.990372, -0.13704, -0.0195818, 0.990372, -0.18221, 0.0065379, 0.983238, -0.274099, 0.00839271, 0.961665, -0.295661, -0.00279476, 0.955289, -0.367074, 0.00847245, 0.930153, -0.387896, -0.00273764, 0.921699, -0.462753, 0.00503516, 0.886473, -0.471455, 0.000127894, 0.88189, -0.555593, 5.327e-05, 0.831454, -0.544613, 0.00654679, 0.838662, -0.626782, 0.00497798, 0.779179, -0.63442, 7.08986e-05, 0.772989, -0.697763, 0.00654505, 0.716299, -0.707107, 7.22472e-08, 0.707107, -0.766704, 0.00483761, 0.641982, -0.773005, -1.302e-05, 0.634399, -0.831435, -0.000128348, 0.555623, -0.824063, 0.00641349, 0.566462, -0.873789, 0.0082817, 0.486234, -0.88454, -0.00285261, 0.466455, -0.917252, 0.00834495, 0.39822, -0.926015, -0.00278483, 0.377476, -0.951881, 0.00842789, 0.306353, -0.958555, -0.00278696, 0.284894, -0.978808, 0.00490969, 0.204721, -0.980786, 3.41939e-06, 0.195089, -0.990372, 0.019581, 0.137038, -0.990372, 0.019581, 0.137038, -0.990372, 0.0195819, 0.13704, -0.999988, 0.00218342, 0.00437304, -0.998074, -0.0196322, 0.0588399, -0.998074, -0.0196322, 0.0588399, -0.998075, -0.0196337, 0.0588369, -0.999961, 0.00392835, 0.00786785, -0.998075, 0.0196356, -0.0588332, -0.998075, 0.0196356, -0.0588332, -0.998075, 0.0196369, -0.0588307, -0.980786, -2.32939e-06, -0.195087, -0.990372, -0.019581, -0.137038, -0.990372, -0.019581, -0.137038, -0.990372, -0.0195818, -0.13704, -0.983238, 0.00653906, -0.182208, -0.961666, 0.00839469, -0.274095, -0.955293, -0.0028206, -0.295646, -0.927591, 0.0048877, -0.373566, -0.923867, 6.50159e-05, -0.382713, -0.884524, 0.00293384, -0.466486, -0.884542, 0.00285419, -0.466452, -0.834561, 0.00285835, -0.550908, -0.834562, 0.00285925, -0.550906, -0.777139, 0.00281057, -0.629322, -0.777227, 0.00247779, -0.629216, -0.66172, -0.0558967, -0.747664, -0.619684, -0.0821688, -0.780538, 0.661723, 0.0558947, -0.747662, 0.77376, 0.000265605, -0.633479, 0.76547, 0.00633648, -0.643441, 0.619691, 0.0821649, -0.780533, 0.821924, 0.00828258, -0.569537, 0.83456, -0.00285738, -0.55091, 0.87379, 0.00828107, -0.486233, 0.88454, -0.00285263, -0.466455, 0.920049, 0.00483978, -0.391773, 0.923884, 1.67685e-05, -0.382673, 0.956944, 1.54355e-05, -0.290273, 0.953035, 0.00655824, -0.302788, 0.980786, 1.73145e-06, -0.195086, 0.978808, 0.00490897, -0.20472, 0.990372, 0.0195818, -0.13704, 0.990372, 0.019581, -0.137038, 0.990372, 0.019581, -0.137038, 0.998075, -0.0196364, -0.0588315, 0.998075, -0.0196351, -0.0588341, 0.998075, -0.0196351, -0.0588341, 0.995201, 0.00190665, 0.0978306, 1, -0.000889349, 8.03936e-05, 1, -0.000635463, 5.74437e-05, 0.995192, 0.000633817, 0.0979453, 0.9808, 0.00111507, 0.195012, 0.980773, 0.000647075, 0.195151, 0.956975, 0.00148536, 0.290165, 0.956954, 0.000636963, 0.290239, 0.92395, 0.00190635, 0.382508, 0.923894, 0.000636978, 0.382649, 0.881931, 0.00111913, 0.471378, 0.881932, 0.000639225, 0.471376, 0.831714, 0.00444759, 0.555186, 0.831714, 0.00444815, 0.555186, 0.83148, 0.000638945, 0.555555, 0.831256, -0.0044556, 0.555872, 0.773149, 0.00190384, 0.634221, 0.773115, 0.000625344, 0.634265, 0.707138, 0.000494908, 0.707075, 0.707147, 0.000635508, 0.707066, 0.63467, 0.00445112, 0.772771, 0.634358, 3.88963e-06, 0.773039, 0.63467, 0.00445136, 0.772771, 0.555536, 0.000644206, 0.831492, 0.555871, 0.00445014, 0.831256, 0.634035, -0.0044433, 0.773292, 0.555186, -0.00444309, 0.831714, 0.4714, 0.000641069, 0.881919, 0.471468, -7.33837e-06, 0.881883, 0.555186, -0.00444223, 0.831714, 0.382721, 0.000636938, 0.923864, 0.382668, 1.73189e-06, 0.923886, 0.290259, 0.000643571, 0.956948, 0.290294, -9.89424e-07, 0.956937, 0.195169, 0.000633947, 0.980769, 0.195112, -2.03799e-06, 0.980781, 0.0979612, 0.000645727, 0.99519, 0.0980025, 1.15997e-06, 0.995186, 5.74264e-05, 0.000635275, 1, 8.03976e-05, 0.000889393, 1, -0.0979023, 0.0011117, 0.995195, -0.0978465, 0.000624619, 0.995201, -0.194978, 0.00148572, 0.980806, -0.195054, 0.000638054, 0.980792, -0.290128, 0.00190892, 0.956986, -0.290239, 0.000636964, 0.956954, -0.382508, 0.00190656, 0.92395, -0.38253, 0.000625365, 0.923943, -0.471378, 0.00112045, 0.881931, -0.471376, 0.000639117, 0.881932, -0.555186, 0.00444271, 0.831714, -0.555186, 0.00444288, 0.831714, -0.555555, 0.000638979, 0.83148, -0.555871, -0.00445014, 0.831256, -0.634252, 0.0014801, 0.773125, -0.634373, 0.000638341, 0.773027, -0.707075, 0.000494556, 0.707138, -0.707066, 0.000635416, 0.707147, -0.772771, 0.00445059, 0.63467, -0.773039, 4.06092e-06, 0.634358, -0.772771, 0.00445081, 0.63467, -0.831492, 0.000644379, 0.555536, -0.831256, 0.00445115, 0.555872, -0.773292, -0.00444272, 0.634035, -0.831714, -0.00444273, 0.555186, -0.881919, 0.000641084, 0.4714, -0.881883, -7.42696e-06, 0.471468, -0.831714, -0.00444288, 0.555186, -0.923899, 0.000645263, 0.382637, -0.923908, -0.000634498, 0.382615, -0.956948, 0.000643934, 0.290259, -0.956954, -0.000636902, 0.290239, -0.980769, 0.000633947, 0.195169, -0.980781, -2.00198e-06, 0.195112, -0.99519, 0.000645881, 0.0979612, -0.995186, 1.47674e-06, 0.0980025, -1, 0.00063571, 5.74641e-05, -1, 4.15296e-07, 3.62201e-08, -0.995192, 0.000634882, -0.0979452, -0.995192, 0.000634212, -0.0979452, -0.980806, 0.00148606, -0.194978, -0.980792, 0.000638017, -0.195054, -0.956966, 0.00111418, -0.290198, -0.956954, 0.000637243, -0.290239, -0.923908, 0.000634878, -0.382615, -0.923894, 0.000637383, -0.382649, -0.88191, 0.000643565, -0.471417, -0.88191, 0.000643552, -0.471417, -0.831714, 0.00444754, -0.555186, -0.831714, 0.00444815, -0.555186, -0.83148, 0.00063922, -0.555555, -0.831256, -0.00445496, -0.555871, -0.773778, 0.00108739, -0.633456, -0.773702, 0.000627143, -0.633549, -0.744072, 0.126907, -0.655936, -0.740321, 0.190429, -0.644718, 0.744072, -0.126905, -0.655936, 0.773679, 0.000621805, -0.633577, 0.773716, -6.90466e-07, -0.633533, 0.740297, -0.190491, -0.644727, 0.831492, 0.0006442, -0.555536, 0.831256, 0.0044556, -0.555872, 0.831714, -0.00444798, -0.555186, 0.881919, 0.000640772, -0.4714, 0.881855, 0.000629851, -0.47152, 0.831714, -0.00444815, -0.555186, 0.923864, 0.000636909, -0.382721, 0.923864, 0.000637432, -0.382721, 0.956921, 0.000634162, -0.290349, 0.956965, 7.33546e-06, -0.290203, 0.980751, 0.000624955, -0.195264, 0.980781, -2.13252e-06, -0.195112, 0.99518, 0.000636496, -0.0980597, 0.995186, 1.13471e-06, -0.0980025, 0.995185, 0, 0.0980173, 0.999925, 0, 0.0122801, 1, 0, 1.35158e-06, 0.995185, 0, 0.0980192, 0.983848, 0, 0.179004, 0.980786, 0, 0.195086, 0.958511, 0, 0.285057, 0.958955, 0, 0.28356, 0.926542, 0, 0.376192, 0.923879, 0, 0.382685, 0.885208, 0, 0.465195, 0.885209, 0, 0.465193, 0.831469, 0, 0.555572, 0.835347, 0, 0.549723, 0.777443, 0, 0.628954, 0.773008, 0, 0.634397, 0.71859, 0, 0.695435, 0.712052, 0, 0.702127, 0.643838, 0, 0.765162, 0.639803, 0, 0.768539, 0.555571, 0, 0.831469, 0.569111, 0, 0.822261, 0.476202, 0, 0.879336, 0.480037, 0, 0.877248, 0.394, 0, 0.91911, 0.382683, 0, 0.92388, 0.296994, 0, 0.954879, 0.296994, 0, 0.954879, 0.201968, 0, 0.979392, 0.201966, 0, 0.979392, 0.114299, 0, 0.993446, 0.105001, 0, 0.994472, 0.0122805, 0, 0.999925, 0.00701524, 0, 0.999975, -0.0910312, 0, 0.995848, -0.0910337, 0, 0.995848, -0.1882, 0, 0.982131, -0.188203, 0, 0.98213, -0.283564, 0, 0.958953, -0.290285, 0, 0.95694, -0.376192, 0, 0.926542, -0.382686, 0, 0.923878, -0.465192, 0, 0.88521, -0.465196, 0, 0.885208, -0.555569, 0, 0.831471, -0.54188, 0, 0.840456, -0.624854, 0, 0.780741, -0.639804, 0, 0.768538, -0.695434, 0, 0.718591, -0.707105, 0, 0.707109, -0.765162, 0, 0.643838, -0.76854, 0, 0.639802, -0.83147, 0, 0.55557, -0.827551, 0, 0.56139, -0.881921, 0, 0.471397, -0.877248, 0, 0.480038, -0.91911, 0, 0.394002, -0.923879, 0, 0.382685, -0.954879, 0, 0.296995, -0.954879, 0, 0.296995, -0.979392, 0, 0.20197, -0.979392, 0, 0.201969, -0.994472, 0, 0.105, -0.994472, 0, 0.105, -0.999975, 0, 0.00702166, -0.999975, 0, 0.00702094, -0.995848, 0, -0.0910274, -0.995848, 0, -0.0910272, -0.98213, 0, -0.188202, -0.98213, 0, -0.188203, -0.958954, 0, -0.283561, -0.958953, 0, -0.283563, -0.926544, 0, -0.376186, -0.926544, 0, -0.376187, -0.885209, 0, -0.465193, -0.885209, 0, -0.465194, -0.831472, 0, -0.555567, -0.835351, 0, -0.549716, -0.778086, -0.000499682, -0.628157, -0.773833, 0, -0.63339, -0.69764, 0, -0.716448, -0.861166, 0, -0.508325, 0.861186, 0, -0.50829, 0.769426, 0.000499391, -0.638735, 0.769483, 0, -0.638667, 0.697641, 0, -0.716448, 0.827551, 0, -0.561391, 0.83147, 0, -0.55557, 0.874084, 0, -0.485775, 0.885208, 0, -0.465196, 0.919113, 0, -0.393995, 0.923882, 0, -0.382678, 0.954881, 0, -0.29699, 0.95488, 0, -0.296993, 0.979392, 0, -0.201967, 0.979392, 0, -0.201968, 0.993447, 0, -0.114297, 0.994473, 0, -0.104995, 0.995189, -0.000451608, 0.0979762, 0.995194, -0.00135455, 0.0979176, 1, 0.000452382, 2.94425e-05, 1, -5.14558e-08, -2.80368e-09, 0.980781, -1.45444e-06, 0.195114, 0.980819, -0.00134907, 0.194914, 0.956931, -2.14395e-06, 0.290316, 0.956946, -0.000792658, 0.290266, 0.923881, -7.27978e-07, 0.382679, 0.923906, -0.00105356, 0.382618, 0.881931, 1.26335e-06, 0.471379, 0.881955, -0.000789229, 0.471334, 0.83148, -0.000452324, 0.555554, 0.831455, -0.0010601, 0.555591, 0.772997, -1.42094e-06, 0.63441, 0.773051, -0.0013566, 0.634342, 0.707107, -1.73072e-08, 0.707107, 0.707123, -0.000351403, 0.70709, 0.634433, -0.000450962, 0.772978, 0.63441, 1.53607e-06, 0.772997, 0.555672, -0.000445624, 0.831402, 0.555603, -0.000451002, 0.831447, 0.471438, -0.00105702, 0.881898, 0.471404, -0.000453047, 0.881917, 0.382641, -0.000796786, 0.923897, 0.382706, -0.000451973, 0.92387, 0.290382, -0.00105351, 0.95691, 0.290407, 8.18776e-06, 0.956903, 0.195048, -0.000796682, 0.980793, 0.195114, 1.5018e-06, 0.980781, 0.0980347, -0.00045323, 0.995183, 0.0980347, -0.000452268, 0.995183, -5.00225e-09, 7.82024e-08, 1, 6.86992e-05, -0.00105391, 0.999999, -0.0980055, 8.13747e-07, 0.995186, -0.0979543, -0.000789838, 0.995191, -0.195114, -1.52153e-06, 0.980781, -0.194933, -0.00104796, 0.980816, -0.290316, -2.10418e-06, 0.956931, -0.29023, -0.00135719, 0.956956, -0.382679, 4.06262e-07, 0.923881, -0.382633, -0.000790172, 0.9239, -0.471379, 1.39664e-06, 0.881931, -0.471353, -0.000450414, 0.881945, -0.555554, -0.000452373, 0.83148, -0.555623, -0.000457809, 0.831434, -0.634388, -0.0004538, 0.773015, -0.634358, -0.00105544, 0.773039, -0.707086, -0.000452591, 0.707128, -0.70709, -0.000351269, 0.707123, -0.772978, -0.000451067, 0.634432, -0.772997, 1.39226e-06, 0.63441, -0.83138, -0.00104974, 0.555703, -0.831447, -0.000451124, 0.555603, -0.881889, -0.00135651, 0.471455, -0.881917, -0.0004529, 0.471404, -0.923882, -0.00136147, 0.382674, -0.923881, -4.16012e-07, 0.382679, -0.956877, -0.00134904, 0.290491, -0.956912, 0.000459943, 0.290379, -0.980793, -0.000796544, 0.195048, -0.980786, 0.00045309, 0.195085, -0.995179, -0.00105648, 0.0980737, -0.995189, 0.000450799, 0.0979762, -1, -0.000790811, 5.1548e-05, -1, 5.19991e-09, 2.15854e-10, -0.995189, -0.000451134, -0.0979762, -0.995189, -0.000451792, -0.0979762, -0.980781, -1.6465e-06, -0.195114, -0.980816, -0.00104816, -0.194933, -0.956931, -2.10212e-06, -0.290316, -0.956953, -0.00079089, -0.290241, -0.923892, -0.000451518, -0.382653, -0.923892, -0.0004516, -0.382653, -0.881945, -0.000451363, -0.471353, -0.881944, -0.000450668, -0.471353, -0.83148, -0.000452624, -0.555554, -0.831434, -0.000458011, -0.555623, -0.773828, -0.000444859, -0.633396, -0.773828, -0.000445694, -0.633395, -0.732218, 0.11947, -0.67051, -0.7136, 0.22623, -0.66302, 0.773768, -0.00102265, -0.633469, 0.7136, -0.226231, -0.66302, 0.732218, -0.119469, -0.67051, 0.773792, -0.000433192, -0.633439, 0.831369, -0.00134907, -0.555719, 0.831464, 7.25271e-07, -0.555579, 0.881907, -0.000791726, -0.471424, 0.881931, -1.19e-06, -0.471379, 0.923905, -0.000456508, -0.382621, 0.92387, -0.000451891, -0.382706, 0.95691, -0.00105335, -0.290382, 0.956967, -5.75517e-06, -0.290197, 0.980793, -0.000796691, -0.195048, 0.980803, -5.96084e-06, -0.194999, 0.995183, -0.000452977, -0.0980347, 0.995183, -0.000452276, -0.0980347, 0.995185, 0, 0.0980154, 0.999925, 0, 0.0122793, 0.999975, 0, 0.00701669, 0.995185, 0, 0.098014, 0.98213, 0, 0.188204, 0.980785, 0, 0.195092, 0.961565, 0, 0.274577, 0.958953, 0, 0.283563, 0.92851, 0, 0.371307, 0.926543, 0, 0.376189, 0.885209, 0, 0.465194, 0.885207, 0, 0.465197, 0.835349, 0, 0.54972, 0.835347, 0.000138507, 0.549723, 0.777442, 0, 0.628955, 0.777444, 0, 0.628953, 0.718589, 0, 0.695435, 0.712049, 0, 0.702129, 0.643838, 0, 0.765162, 0.639802, 0, 0.76854, 0.561392, 0, 0.82755, 0.561395, 0, 0.827548, 0.477575, 0, 0.878591, 0.477575, 0, 0.878591, 0.389157, 0, 0.921172, 0.389154, 0, 0.921173, 0.296994, 0, 0.954879, 0.296995, 0, 0.954879, 0.201966, 0, 0.979393, 0.201969, 0, 0.979392, 0.104994, 0, 0.994473, 0.104997, 0, 0.994473, 0.00701908, 0, 0.999975, 1.19913e-06, 0, 1, -0.091031, 0, 0.995848, -0.0980202, 0, 0.995184, -0.188203, 0, 0.98213, -0.188201, 0, 0.982131, -0.283559, 0, 0.958955, -0.283561, 0, 0.958954, -0.376191, 0, 0.926542, -0.367507, 0, 0.930021, -0.465197, 0, 0.885207, -0.460532, 0, 0.887643, -0.549721, 0, 0.835349, -0.54972, 0, 0.835349, -0.628953, 0, 0.777443, -0.628954, 0, 0.777442, -0.702128, 0, 0.712051, -0.695434, 0, 0.71859, -0.76516, 0, 0.64384, -0.768539, 0.000140834, 0.639803, -0.83147, 0, 0.555569, -0.822261, 0, 0.56911, -0.876065, 0, 0.482193, -0.885207, 0.000223561, 0.465197, -0.921171, 0, 0.389157, -0.923879, 0, 0.382684, -0.954879, 0, 0.296997, -0.954878, 0, 0.296998, -0.979391, 0, 0.201971, -0.97746, 0, 0.211122, -0.993906, 0, 0.110232, -0.993446, 0, 0.114299, -0.999985, 0, 0.00545972, -0.999866, 0, 0.0163724, -0.996314, 0, -0.0857869, -0.995185, 0, -0.0980184, -0.982131, 0, -0.188198, -0.982131, -0.000196426, -0.188199, -0.958955, 0, -0.283558, -0.958955, 0, -0.283557, -0.930022, 0, -0.367504, -0.926543, 0, -0.37619, -0.885208, -0.000223561, -0.465195, -0.887644, 0, -0.46053, -0.83535, 0, -0.549719, -0.840457, 0, -0.541879, -0.778269, 0, -0.627931, -0.781593, 0, -0.623789, -0.85029, 0, -0.526315, -0.812699, 0, -0.582683, 0.812798, 0, -0.582546, 0.774025, 0, -0.633155, 0.769864, 0, -0.638208, 0.850289, 0, -0.526316, 0.831469, -0.000138704, -0.555571, 0.82755, 0, -0.561391, 0.87859, 0, -0.477576, 0.881922, 0, -0.471396, 0.921173, 0, -0.389154, 0.923881, 0, -0.38268, 0.95488, 0, -0.296991, 0.95488, 0, -0.296993, 0.979393, 0, -0.201965, 0.979393, 0, -0.201963, 0.994473, 0, -0.104995, 0.994473, 0, -0.104994, 0.995187, 0, 0.0979989, 0.995187, 0, 0.0979992, 1, 0, 0, 1, 0, 0, 0.980784, 0, 0.195097, 0.980784, 0, 0.195097, 0.956933, 0, 0.29031, 0.956933, 0, 0.290309, 0.923877, 0, 0.38269, 0.923877, 0, 0.382691, 0.881916, 0, 0.471408, 0.881915, 0, 0.471408, 0.831465, 0, 0.555577, 0.831435, 0, 0.555622, 0.773092, 0, 0.634294, 0.773003, 0, 0.634403, 0.707107, 0, 0.707107, 0.707107, 0, 0.707107, 0.634402, 0, 0.773003, 0.634402, 0, 0.773003, 0.555577, 0, 0.831465, 0.555623, 0, 0.831434, 0.471408, 0, 0.881915, 0.471408, 0, 0.881915, 0.382691, 0, 0.923877, 0.38269, 0, 0.923877, 0.290311, 0, 0.956932, 0.29031, 0, 0.956933, 0.195097, 0, 0.980784, 0.195096, 0, 0.980784, 0.0979985, 0, 0.995187, 0.0979989, 0, 0.995187, 0, 0, 1, 0, 0, 1, -0.0979989, 0, 0.995187, -0.0979992, 0, 0.995187, -0.195097, 0, 0.980784, -0.195097, 0, 0.980784, -0.29031, 0, 0.956933, -0.290309, 0, 0.956933, -0.38269, 0, 0.923877, -0.382691, 0, 0.923877, -0.471408, 0, 0.881915, -0.471408, 0, 0.881916, -0.555577, 0, 0.831465, -0.555622, 0, 0.831435, -0.634402, 0, 0.773003, -0.634294, 0, 0.773092, -0.707107, 0, 0.707107, -0.707107, 0, 0.707107, -0.773003, 0, 0.634402, -0.773003, 0, 0.634403, -0.831465, 0, 0.555577, -0.831434, 0, 0.555623, -0.881915, 0, 0.471408, -0.881915, 0, 0.471409, -0.923877, 0, 0.38269, -0.923877, 0, 0.382689, -0.956933, 0, 0.29031, -0.956932, 0, 0.290311, -0.980784, 0, 0.195096, -0.980784, 0, 0.195097, -0.995187, 0, 0.0979989, -0.995187, 0, 0.0979985, -1, 0, 0, -1, 0, 0, -0.995187, 0, -0.0979989, -0.995187, 0, -0.0979992, -0.980784, 0, -0.195097, -0.980784, 0, -0.195097, -0.956933, 0, -0.29031, -0.956933, 0, -0.290309, -0.923877, 0, -0.382691, -0.923877, 0, -0.38269, -0.881915, 0, -0.471408, -0.881916, 0, -0.471408, -0.831465, 0, -0.555577, -0.831435, 0, -0.555622, -0.774171, 0, -0.632976, -0.77417, 0, -0.632977, -0.736955, -0.13184, -0.66296, -0.742318, -0.0548273, -0.6678, 0.774171, 0, -0.632976, 0.77413, 0, -0.633026, 0.738396, 0.115287, -0.664439, 0.741915, 0.063986, -0.667433, 0.831466, 0, -0.555576, 0.831433, 0, -0.555624, 0.881915, 0, -0.471408, 0.881915, 0, -0.471408, 0.923877, 0, -0.38269, 0.923877, 0, -0.38269, 0.956933, 0, -0.29031, 0.956932, 0, -0.290311, 0.980784, 0, -0.195096, 0.980784, 0, -0.195097, 0.995187, 0, -0.0979989, 0.995187, 0, -0.0979985, -0.773912, 0.000499553, -0.633294, -0.769868, 0, -0.638203, -0.766066, 0, -0.642762, -0.68578, 0, -0.727809, -0.827553, 0, -0.561388, -0.831471, 0, -0.555568, -0.878593, 0, -0.477571, -0.881922, 0, -0.471395, -0.921173, 0, -0.389154, -0.926544, 0, -0.376187, -0.95488, 0, -0.29699, -0.956943, 0, -0.290277, -0.979392, 0, -0.201967, -0.979392, 0, -0.201968, -0.995185, 0, -0.0980152, -0.993447, 0, -0.114296, -0.999985, 0, -0.00545725, -1, 0, 3.51781e-06, -0.995185, 0, 0.098018, -0.995185, 0, 0.0980171, -0.98213, 0, 0.188204, -0.982655, 0, 0.185445, -0.962838, 0, 0.27008, -0.958953, 0, 0.283565, -0.928509, 0, 0.371309, -0.926542, 0, 0.376191, -0.885208, 0, 0.465196, -0.885208, 0, 0.465196, -0.835348, 0, 0.549722, -0.835347, 0, 0.549723, -0.773012, 0, 0.634392, -0.777444, 0, 0.628953, -0.712052, 0, 0.702126, -0.707107, 0, 0.707106, -0.646966, 0, 0.762519, -0.634395, 0, 0.773009, -0.565741, 0, 0.824583, -0.55557, 0, 0.83147, -0.471396, 0, 0.881922, -0.477574, 0, 0.878592, -0.389158, 0, 0.921171, -0.376191, 0, 0.926542, -0.296991, 0, 0.95488, -0.28356, 0, 0.958954, -0.201967, 0, 0.979392, -0.195091, 0, 0.980785, -0.104999, 0, 0.994472, -0.114298, 0, 0.993447, -0.0122816, 0, 0.999925, -0.00702088, 0, 0.999975, 0.0910277, 0, 0.995848, 0.0910304, 0, 0.995848, 0.188201, 0, 0.98213, 0.179006, 0, 0.983848, 0.278509, 0, 0.960434, 0.274577, 0, 0.961565, 0.371308, 0, 0.92851, 0.376192, 0, 0.926542, 0.465196, 0, 0.885208, 0.465194, 0, 0.885209, 0.549722, 0, 0.835348, 0.549722, 0, 0.835348, 0.628952, 0, 0.777444, 0.628953, 0, 0.777444, 0.702127, 0, 0.712052, 0.702127, 0, 0.712052, 0.768539, 0, 0.639802, 0.768539, 0, 0.639803, 0.827551, 0, 0.561391, 0.822262, 0, 0.569109, 0.876066, 0, 0.482191, 0.87859, 0, 0.477576, 0.92117, 0, 0.38916, 0.921171, 0, 0.389159, 0.95694, 0, 0.290284, 0.954879, 0, 0.296994, 0.97746, 0, 0.211121, 0.980786, 0, 0.195088, 0.993906, 0, 0.110232, 0.993446, 0, 0.114299, 0.999985, 0, 0.0054574, 0.999866, 0, 0.016372, 0.996314, 0, -0.0857868, 0.995185, 0, -0.0980149, 0.982131, 0, -0.1882, 0.982131, 0, -0.188201, 0.956941, 0, -0.290282, 0.958955, 0, -0.28356, 0.926544, 0, -0.376188, 0.923881, 0, -0.38268, 0.885209, 0, -0.465193, 0.885209, 0, -0.465194, 0.840457, 0, -0.541879, 0.835348, 0, -0.549721, 0.781347, 0, -0.624097, 0.778424, 0, -0.627739, 0.766076, 0, -0.64275, 0.68578, 0, -0.727809, -0.707105, 0.00198059, 0.707105, -0.705259, 0.0722919, 0.705254, -0.699773, 0.143695, 0.699764, -0.707106, 0.00197859, 0.707105, 0.707106, 0.00143235, 0.707106, 0.707106, 0.00143437, 0.707106, 0.700004, -0.141419, 0.699996, 0.707106, 0.00143022, 0.707106, 0.831714, 0.00444759, 0.555186, 0.831256, -0.0044556, 0.555871, 0.555871, 0.00445014, 0.831256, 0.555871, 0.00445089, 0.831256, 0.555186, -0.00444309, 0.831714, -0.555186, 0.00444271, 0.831714, -0.555872, -0.00445136, 0.831256, -0.555871, -0.00445013, 0.831256, -0.831256, 0.00445077, 0.555872, -0.831256, 0.00445115, 0.555872, -0.831714, -0.00444273, 0.555186, -0.831714, 0.00444754, -0.555186, -0.831256, -0.00445496, -0.555871, 0.831256, 0.0044556, -0.555871, 0.831714, -0.00444798, -0.555186, 0.998075, 0.0196356, 0.0588332, 0.990372, -0.019581, 0.137038, 0.990371, -0.0195843, 0.137045, 0.63467, 0.00445136, 0.772771, 0.634035, -0.00444329, 0.773292, 0.634035, -0.00444285, 0.773292, 0.137038, 0.019581, 0.990372, 0.137039, 0.0195815, 0.990372, 0.0588329, -0.0196357, 0.998075, -0.0588399, 0.0196322, 0.998074, -0.137039, -0.0195815, 0.990372, -0.137038, -0.019581, 0.990372, -0.772771, 0.00445081, 0.63467, -0.773292, -0.00444273, 0.634035, -0.773292, -0.00444282, 0.634035, -0.990372, 0.019581, 0.137038, -0.990372, 0.0195815, 0.137039, -0.998074, -0.0196322, 0.0588399, -0.998075, 0.0196356, -0.0588332, -0.990372, -0.0195819, -0.13704, -0.990372, -0.019581, -0.137038, 0.990372, 0.019581, -0.137038, 0.990372, 0.0195814, -0.137039, 0.998075, -0.0196351, -0.0588341, 0.13704, 0.0195818, 0.990372, 0.0588307, -0.0196369, 0.998075, 0.0588303, -0.019637, 0.998075, -0.0588306, 0.0196369, 0.998075, -0.058831, 0.0196367, 0.998075, -0.13704, -0.0195818, 0.990372, -0.990372, 0.0195819, 0.13704, -0.998075, -0.019634, 0.0588364, -0.998075, -0.0196337, 0.0588369, -0.998075, 0.0196369, -0.0588306, -0.998075, 0.0196367, -0.058831, -0.990372, -0.0195818, -0.13704, 0.990372, 0.0195818, -0.13704, 0.998075, -0.0196363, -0.0588318, 0.998075, -0.0196364, -0.0588316, 0.993446, 0, 0.114299, 0.999985, 0, 0.0054574, 0.980786, 0, 0.195088, 0.95694, 0, 0.290284, 0.92117, 0, 0.38916, 0.87859, 0, 0.477576, 0.827551, 0, 0.561391, 0.768539, 0, 0.639802, 0.702127, 0, 0.712052, 0.628952, 0, 0.777444, 0.549722, 0, 0.835348, 0.465196, 0, 0.885208, 0.371308, 0, 0.92851, 0.274577, 0, 0.961565, 0.188201, 0, 0.98213, 0.0910277, 0, 0.995848, -0.0122816, 0, 0.999925, -0.114298, 0, 0.993447, -0.201967, 0, 0.979392, -0.296991, 0, 0.95488, -0.389158, 0, 0.921171, -0.477574, 0, 0.878592, -0.565741, 0, 0.824583, -0.646966, 0, 0.762519, -0.707107, 0, 0.707106, -0.773012, 0, 0.634392, -0.835348, 0, 0.549722, -0.885208, 0, 0.465196, -0.926542, 0, 0.376191, -0.958953, 0, 0.283565, -0.98213, 0, 0.188204, -0.995185, 0, 0.0980171, -0.999985, 0, -0.00545725, -0.993447, 0, -0.114296, -0.979392, 0, -0.201967, -0.956943, 0, -0.290277, -0.926544, 0, -0.376187, -0.881922, 0, -0.471395, -0.827553, 0, -0.561388, -0.769868, 0, -0.638203, -0.766066, 0, -0.642762, 0.778424, 0, -0.627739, 0.766076, 0, -0.64275, 0.835348, 0, -0.549721, 0.885209, 0, -0.465193, 0.926544, 0, -0.376188, 0.958955, 0, -0.28356, 0.982131, 0, -0.1882, 0.995185, 0, -0.0980149, 0.645079, 0.409526, -0.645106, 0.567713, -0.59614, -0.567732, 0.558733, -0.612871, -0.558755, 0.464314, 0.754189, -0.46434, 0.520022, 0.677588, -0.52005, 0.587387, 0.556705, -0.587415, 0.663386, 0.346123, -0.663413, -0.0173972, 0.999698, 0.0173701, 0.241395, 0.939917, -0.241421, -0.699773, 0.143695, 0.699764, -0.705259, 0.0722919, 0.705254, -0.385385, 0.838437, 0.385359, -0.32611, 0.887311, 0.326085, -0.691147, -0.21131, 0.691133, -0.69957, -0.145668, 0.699558, -0.133261, -0.982084, 0.133238, 0.0575341, 0, -0.998344, 0.481414, -0.732438, -0.48143, 0.481414, -0.732438, -0.48143, -0.0329177, 0, -0.999458, -0.552709, 0.623743, 0.552683, -0.642271, 0.41834, 0.642246, -0.985401, 0, 0.17025, -0.697329, -0.165818, 0.697307, -0.994643, 0, 0.103374, -0.707105, 0.00198064, 0.707105, -0.707105, 0.00197978, 0.707105, -0.707105, 0.00196844, 0.707105, -0.69957, -0.145668, 0.699558, -0.707105, 0.00198496, 0.707105, -0.707105, 0.00197737, 0.707105, -0.707105, 0.00198434, 0.707105, -0.707105, 0.00201856, 0.707105, -0.645075, -0.409538, -0.645103, -0.567713, 0.59614, -0.567732, -0.558733, 0.612871, -0.558755, -0.461189, -0.758014, -0.461216, -0.520014, -0.6776, -0.520042, -0.587397, -0.556684, -0.587425, -0.66337, -0.346185, -0.663397, 0.15281, -0.976374, 0.152784, -0.241395, -0.939917, -0.241421, 0.700004, -0.141419, 0.699996, 0.695218, -0.182642, 0.695207, 0.376573, -0.846406, 0.376549, 0.385384, -0.838438, 0.385357, 0.69943, 0.147009, 0.699418, 0.691023, 0.212117, 0.691009, -0.481414, 0.732438, -0.48143, -0.481414, 0.732438, -0.48143, -0.0576, 0, -0.99834, 0.1333, 0.982074, 0.133277, 0.0328426, 0, -0.999461, 0.42202, -0.802385, 0.421993, 0.985394, 0, 0.170293, 0.994637, 0, 0.103426, 0.697331, 0.1658, 0.697309, -0.691147, -0.21131, 0.691133, 0.695218, -0.182642, 0.695207, 0.707106, 0.00143571, 0.707106, 0.707106, 0.00145208, 0.707106, 0.707106, 0.00145747, 0.707106, 0.707106, 0.00144835, 0.707106, 0.707106, 0.00146315, 0.707106, 0.707106, 0.00149542, 0.707106, 0.69943, 0.147009, 0.699418, 0.691023, 0.212117, 0.691009, 0.586637, -0.809806, -0.0084388, 0.514504, -0.857475, 0.00471522, 0.588307, -0.808616, -0.00596763, 0.510446, -0.85991, 9.27635e-05, 0.660101, -0.751079, -0.0121564, 0.666278, -0.745696, -0.00333634, 0.735233, -0.677796, -0.0049936, 0.736276, -0.676672, -0.0034737, 0.800666, -0.599111, 9.15327e-05, 0.796297, -0.604851, -0.00819736, 0.853273, -0.521441, -0.00488207, 0.855598, -0.51764, -1.32775e-05, 0.900964, -0.433881, -0.00340696, 0.902102, -0.431523, 0.000227127, 0.939201, -0.343351, -0.00351758, 0.940127, -0.340824, 3.52902e-05, 0.968303, -0.249754, -0.00342182, 0.968984, -0.247125, 0.000122145, 0.98813, -0.153584, -0.00346814, 0.988566, -0.150787, -4.26209e-05, 0.998425, -0.0559997, -0.003463, 0.998589, -0.0531061, -8.83253e-05, 0.999105, 0.0421615, -0.00348657, 0.999261, 0.037557, -0.00816242, 0.991198, 0.13181, -0.0123752, 0.990177, 0.139781, -0.00340118, 0.973524, 0.228255, -0.012299, 0.971706, 0.23617, -0.00340243, 0.946515, 0.322432, -0.0121524, 0.943847, 0.330363, -0.00348365, 0.907583, 0.419844, -0.00494706, 0.90853, 0.417743, -0.00796045, 0.862339, 0.506295, -0.00603835, 0.863546, 0.504203, -0.00819213, 0.808332, 0.588707, -0.00480164, 0.809471, 0.587104, -0.00811385, 0.745065, 0.666986, -0.0028351, 0.74842, 0.663171, -0.00841754, 0.682623, 0.730667, -0.0123247, 0.672785, 0.739829, 0.00372141, 0.60789, 0.793929, -0.012125, 0.596893, 0.802313, 0.00358374, 0.521493, 0.853242, -0.00482238, 0.517877, 0.855455, 0.000216645, 0.431317, 0.9022, 1.7367e-05, 0.433818, 0.900994, -0.00346368, 0.343309, 0.939216, -0.00355668, 0.340823, 0.940127, 3.65682e-05, 0.249609, 0.96834, -0.003544, 0.247022, 0.96901, 2.20736e-05, 0.153709, 0.98811, -0.00336773, 0.150546, 0.988603, -0.000260681, 0.0560765, 0.998421, -0.00339942, 0.0534178, 0.998572, 0.000193762, -0.0420814, 0.999108, -0.00342037, -0.0374056, 0.999268, -0.00801525, -0.131653, 0.991221, -0.0122213, -0.139877, 0.990163, -0.00348093, -0.228184, 0.973541, -0.0122315, -0.236112, 0.97172, -0.00335865, -0.322518, 0.946484, -0.012239, -0.330432, 0.943823, -0.00354306, -0.413868, 0.910253, -0.01237, -0.421262, 0.906932, -0.00345679, -0.501076, 0.865315, -0.0123565, -0.508276, 0.861187, -0.00359841, 0.509941, -0.860209, -0.00106213, 0.595755, -0.803163, -0.00222728, 0.671717, -0.740803, 0.00266282, 0.740591, -0.671881, 0.0100825, 0.799521, -0.600629, -0.00334407, 0.854363, -0.519667, -0.00311575, 0.901486, -0.432794, -0.00357815, 0.93944, -0.342698, -0.00332619, 0.968487, -0.249042, -0.0032806, 0.988211, -0.153063, -0.00317948, 0.998453, -0.0555079, -0.00315172, 0.999079, 0.0427939, -0.00325707, 0.990067, 0.140558, -0.00329058, 0.971519, 0.236938, -0.00330213, 0.943654, 0.330918, -0.00322703, 0.906611, 0.421954, -0.00332765, 0.860906, 0.508753, -0.00329995, 0.806962, 0.590594, -0.00322137, 0.746898, 0.664893, -0.00774609, 0.677332, 0.735655, -0.0057434, 0.600896, 0.799321, -0.00312259, 0.519396, 0.854527, -0.00332506, 0.433162, 0.90131, -0.00330496, 0.343174, 0.939267, -0.0029905, 0.249041, 0.968487, -0.00327925, 0.152821, 0.988248, -0.0033447, 0.0553303, 0.998463, -0.00326636, -0.0428001, 0.999078, -0.00326798, -0.140824, 0.990029, -0.00347234, -0.236824, 0.971547, -0.00321904, -0.331043, 0.94361, -0.00331625, -0.421923, 0.906626, -0.00330437, -0.508753, 0.860906, -0.00330087, 0.696573, -0.716835, 0.030562, 0.755926, -0.653031, 0.0461057, 0.80132, -0.59823, 0.00270053, 0.852617, -0.522536, -0.00068267, 0.901542, -0.432681, -0.00293006, 0.939596, -0.342272, -0.00290572, 0.968632, -0.248481, -0.00293454, 0.988326, -0.152329, -0.00293698, 0.998491, -0.0548342, -0.00287962, 0.999052, 0.0434357, -0.00295162, 0.989992, 0.141095, -0.00292479, 0.971336, 0.23769, -0.00305739, 0.943485, 0.331404, -0.00285521, 0.906377, 0.422458, -0.00295623, 0.860645, 0.509198, -0.00291372, 0.806592, 0.591101, -0.00291022, 0.744407, 0.667718, -0.00320602, 0.675833, 0.73705, -0.00287309, 0.600533, 0.799596, -0.0027385, 0.519247, 0.85462, -0.0027501, 0.432432, 0.901661, -0.00307947, 0.342331, 0.939575, -0.00287531, 0.248105, 0.968728, -0.00313806, 0.152085, 0.988363, -0.00307138, 0.0547412, 0.998496, -0.00292977, -0.043084, 0.999068, -0.00276218, -0.141194, 0.989977, -0.00297753, -0.237568, 0.971366, -0.00298734, -0.331537, 0.943438, -0.00293147, -0.422459, 0.906377, -0.00295552, -0.509131, 0.860684, -0.00287547, 0.853523, -0.520983, 0.008653, 0.803584, -0.594908, -0.0183733, 0.901906, -0.431925, -0.00261626, 0.939914, -0.341403, -0.00263436, 0.968705, -0.248205, -0.00239191, 0.988369, -0.152058, -0.00238987, 0.998533, -0.0540926, -0.00253915, 0.999033, 0.0438862, -0.00247129, 0.98992, 0.141605, -0.00247514, 0.971291, 0.237881, -0.00245001, 0.943286, 0.331971, -0.00246122, 0.906197, 0.422848, -0.00246597, 0.860325, 0.50974, -0.00251987, 0.80627, 0.591543, -0.0024805, 0.74401, 0.668163, -0.00273089, 0.675335, 0.737507, -0.00250492, 0.599847, 0.800111, -0.00247535, 0.518616, 0.855004, -0.00243753, 0.432075, 0.901834, -0.00255322, 0.341901, 0.939733, -0.0024167, 0.247899, 0.968783, -0.00252024, 0.152163, 0.988353, -0.0023468, 0.0542713, 0.998523, -0.00246625, -0.0439845, 0.999029, -0.00251434, -0.141605, 0.98992, -0.00247474, -0.231681, 0.972639, -0.0172492, -0.245647, 0.969202, 0.0174651, -0.245646, 0.969202, 0.0174629, -0.331997, 0.943277, -0.0024702, -0.423104, 0.906078, -0.00258676, -0.509454, 0.860494, -0.00238119, 0.901155, -0.433496, -0.00137882, 0.857567, -0.514204, 0.0131144, 0.93863, -0.344656, -0.0136437, 0.93863, -0.344656, -0.0136439, 0.968779, -0.247919, -0.00184226, 0.941455, -0.336863, 0.0136457, 0.988459, -0.151473, -0.0019308, 0.998545, -0.0538829, -0.00192394, 0.99901, 0.0444381, -0.00198076, 0.989856, 0.142061, -0.00195961, 0.971167, 0.238393, -0.00195417, 0.943249, 0.332081, -0.0018372, 0.905994, 0.423286, -0.00195535, 0.860371, 0.509665, -0.0018178, 0.806039, 0.591859, -0.00193572, 0.746558, 0.665182, -0.0135815, 0.741017, 0.671346, 0.0137048, 0.675064, 0.737757, -0.00194541, 0.741017, 0.671347, 0.0137084, 0.599838, 0.800119, -0.00181789, 0.518092, 0.855322, -0.0019731, 0.431834, 0.901951, -0.00194586, 0.341034, 0.940049, -0.00204864, 0.247578, 0.968866, -0.00194429, 0.151458, 0.988462, -0.00193307, 0.053597, 0.998561, -0.00201219, -0.0444381, 0.99901, -0.0019808, -0.142156, 0.989842, -0.00198494, -0.231681, 0.972639, -0.0172492, -0.23168, 0.972639, -0.0172509, -0.238213, 0.971211, -0.00189665, -0.245646, 0.969202, 0.0174629, -0.332395, 0.943138, -0.00193948, -0.423286, 0.905994, -0.00195487, -0.510033, 0.860153, -0.00194662, 0.900574, -0.434697, -0.00233421, 0.86224, -0.506175, -0.0181517, 0.940169, -0.340705, -0.00141412, 0.93863, -0.344656, -0.0136437, 0.969008, -0.247025, -0.0013913, 0.941455, -0.336863, 0.0136471, 0.941455, -0.336863, 0.0136458, 0.988524, -0.151058, -0.00134784, 0.998583, -0.0531953, -0.00139786, 0.999, 0.0446925, -0.00134707, 0.989811, 0.142383, -0.00134949, 0.971087, 0.238723, -0.00134793, 0.943025, 0.332719, -0.00133771, 0.90586, 0.423575, -0.00134367, 0.859883, 0.51049, -0.00138366, 0.805823, 0.592155, -0.00134241, 0.746558, 0.665181, -0.0135828, 0.744949, 0.667055, -0.00939841, 0.746558, 0.665182, -0.0135815, 0.742443, 0.669844, 0.00939977, 0.67483, 0.737972, -0.0013385, 0.742443, 0.669844, 0.0093988, 0.741017, 0.671346, 0.0137048, 0.599202, 0.800596, -0.00134903, 0.517596, 0.855624, -0.00140921, 0.431916, 0.901913, -0.00126019, 0.341083, 0.940032, -0.00133153, 0.247275, 0.968944, -0.00133645, 0.151058, 0.988524, -0.00134805, 0.0534817, 0.998568, -0.00133853, -0.0448944, 0.998991, -0.00139116, -0.14237, 0.989812, -0.00134195, -0.238445, 0.971155, -0.00129318, -0.332748, 0.943015, -0.00134663, -0.423575, 0.90586, -0.00134332, -0.510333, 0.859976, -0.00134561, 0.940023, -0.34111, -0.000657504, 0.901212, -0.4332, -0.0124275, 0.968974, -0.247161, -0.000675688, 0.98855, -0.150893, -0.000684083, 0.998577, -0.0533215, -0.000679297, 0.998994, 0.0448484, -0.00068227, 0.989791, 0.142522, -0.000679839, 0.97105, 0.238876, -0.000682245, 0.942949, 0.332935, -0.000685412, 0.905619, 0.424091, -0.000723678, 0.859877, 0.510501, -0.000685472, 0.805719, 0.592298, -0.000682181, 0.744949, 0.667055, -0.00939841, 0.743778, 0.668427, -0.000682953, 0.67469, 0.738101, -0.000681745, 0.599041, 0.800718, -0.000688186, 0.517726, 0.855546, -0.000681895, 0.431328, 0.902195, -0.000687374, 0.340902, 0.940099, -0.000678579, 0.247043, 0.969004, -0.000685477, 0.151184, 0.988505, -0.000656293, 0.0533214, 0.998577, -0.000678919, -0.0448484, 0.998994, -0.000682641, -0.142522, 0.989791, -0.000679759, -0.238876, 0.97105, -0.000682327, -0.332935, 0.942949, -0.000685208, -0.42377, 0.905769, -0.000686454, -0.510501, 0.859877, -0.000685787, 0.940131, -0.340813, 0, 0.902526, -0.430116, -0.0211407, 0.969014, -0.247004, 0, 0.988565, -0.150793, 0, 0.998584, -0.0531985, 0, 0.998991, 0.0448997, 0, 0.989781, 0.142597, 0, 0.971018, 0.239005, 0, 0.942924, 0.333009, 0, 0.905764, 0.423782, 0, 0.859884, 0.51049, 0, 0.805664, 0.592373, 0, 0.743707, 0.668506, 0, 0.674592, 0.738191, 0, 0.599025, 0.80073, 0, 0.51811, 0.855314, 0, 0.4309, 0.9024, 0, 0.340813, 0.940131, 0, 0.247004, 0.969014, 0, 0.150793, 0.988565, 0, 0.0531985, 0.998584, 0, -0.0448997, 0.998991, 0, -0.142597, 0.989781, 0, -0.239005, 0.971018, 0, -0.333009, 0.942924, 0, -0.423214, 0.90603, 0, -0.51049, 0.859884, 0, 0.880004, -0.474, -0.0302732, 0.878038, -0.478332, -0.0157575, 0.828171, -0.560178, -0.0182439, 0.745793, -0.666162, -0.00463144, 0.608205, -0.793683, 0.012424, 0.516524, -0.85619, 0.0118896, -0.316708, -0.947004, -0.0536523, -0.334193, -0.942478, 0.00715544, -0.334194, -0.942487, -0.00576935, -0.321583, -0.94662, -0.0222438, -0.266439, -0.958819, -0.0983665, -0.280477, -0.958323, -0.0543087, -0.183812, -0.974183, -0.131075, -0.206474, -0.974769, -0.0848197, -0.074627, -0.987139, -0.141379, -0.098291, -0.989498, -0.105982, 0.0583064, -0.989567, -0.13175, 0.0352604, -0.993823, -0.105229, 0.20318, -0.974123, -0.0990093, 0.184404, -0.979607, -0.0797851, 0.347594, -0.936618, -0.0438819, 0.339749, -0.939825, -0.036046, 0.50747, -0.861661, 0.00381184, 0.500797, -0.865515, 0.00929025, -0.85224, -0.519887, -0.0583396, -0.856746, -0.50854, 0.0858688, -0.846574, -0.524269, -0.091943, -0.852623, -0.506063, 0.130134, -0.763533, -0.585133, -0.273197, -0.773011, -0.58134, -0.253964, -0.622316, -0.676168, -0.39436, -0.63522, -0.672468, -0.379845, -0.451027, -0.777427, -0.438386, -0.459681, -0.775744, -0.432335, -0.276223, -0.871044, -0.406182, -0.24255, -0.874665, -0.419679, -0.057345, -0.944239, -0.324229, -0.0287449, -0.94336, -0.330524, 0.191924, -0.963933, -0.184385, 0.247998, -0.950387, -0.187779, 0.449666, -0.893197, 0, 0.508312, -0.861173, 0, 0.504509, -0.397767, -0.766324, 0.588567, -0.292478, -0.753688, 0.533222, -0.327469, -0.780024, 0.55464, -0.370681, -0.744963, 0.463103, -0.468415, -0.752411, 0.495283, -0.448185, -0.744194, 0.430381, -0.546427, -0.718464, 0.480036, -0.443058, -0.757143, 0.501191, -0.450155, -0.739032, 0.462338, -0.538147, -0.704728, 0.402259, -0.624584, -0.669389, 0.418626, -0.623671, -0.660142, 0.244085, -0.643828, -0.725195, 0.371711, -0.703891, -0.605283, 0.249685, -0.729354, -0.636945, 0.31507, -0.773628, -0.549754, 0.313893, -0.826056, -0.468085, 0.262064, -0.834192, -0.485229, 0.354283, -0.890603, -0.285148, 0.187505, -0.876631, -0.443124, 0.685191, -0.186642, -0.704044, 0.641259, -0.283303, -0.71311, 0.520019, -0.456248, -0.722093, 0.539397, -0.462331, -0.703776, 0.576347, -0.389728, -0.718287, 0.513308, -0.454106, -0.728219, 0.508968, -0.502285, -0.699043, 0.434779, -0.612845, -0.659839, 0.351499, -0.713325, -0.606314, 0.260384, -0.797464, -0.54429, 0.17259, -0.863603, -0.473712, 0.0720851, -0.907067, -0.414768, 0.764324, -0.0484785, -0.643007, 0.693551, -0.165151, -0.701222, 0.621337, -0.304572, -0.721925, 0.538162, -0.453587, -0.71038, 0.447296, -0.597207, -0.665785, 0.340009, -0.725821, -0.597978, 0.217367, -0.828502, -0.516078, 0.085774, -0.898555, -0.430396, -0.0335173, -0.937573, -0.346168, 0.735331, -0.0456088, -0.676172, 0.802264, 0.0900106, -0.590144, 0.663574, -0.213755, -0.716923, 0.57379, -0.39872, -0.715393, 0.463048, -0.579928, -0.670276, 0.330866, -0.738498, -0.587493, 0.179139, -0.857399, -0.482468, 0.0186049, -0.928219, -0.371568, -0.12742, -0.954607, -0.269239, 0.740585, 0.0737533, -0.667902, 0.797158, 0.226658, -0.559611, 0.676486, -0.121199, -0.726414, 0.588955, -0.341952, -0.732257, 0.472223, -0.561946, -0.679133, 0.325339, -0.750264, -0.575551, 0.152586, -0.885202, -0.439471, -0.0299295, -0.954141, -0.297859, -0.193724, -0.965462, -0.174225, 0.727706, 0.185446, -0.660344, 0.771635, 0.350936, -0.530494, 0.674963, -0.0320635, -0.737155, 0.595168, -0.286569, -0.750769, 0.478007, -0.543119, -0.690312, 0.322029, -0.761707, -0.562227, 0.13323, -0.909462, -0.393865, -0.0657929, -0.972873, -0.221786, -0.243491, -0.966827, -0.0771806, 0.741937, 0.253077, -0.620872, 0.757411, 0.401769, -0.514695, 0.700221, 0.0347413, -0.71308, 0.630446, -0.230241, -0.741301, 0.519098, -0.506945, -0.688145, 0.362104, -0.747404, -0.557016, 0.168859, -0.910794, -0.37675, -0.0396054, -0.980985, -0.189999, -0.274166, -0.961065, -0.0344521, -0.816036, 0.474727, -0.329726, -0.852095, 0.523237, 0.0125346, -0.719111, 0.342858, -0.604424, -0.525907, 0.0991655, -0.844742, -0.312174, -0.166982, -0.935235, 0.244085, -0.643828, -0.725195, -0.194423, -0.345625, -0.91801, 0.249685, -0.729354, -0.636945, 0.313893, -0.826056, -0.468085, 0.354283, -0.890603, -0.285148, 0.423801, -0.905755, 1.25797e-08, 0.426182, -0.90463, 0.0035998, 0.336061, -0.941835, 0.00308017, 0.333004, -0.942925, -1.57577e-05, 0.241651, -0.970357, 0.00348062, 0.238968, -0.971027, -1.1099e-05, 0.145134, -0.989405, 0.00368274, 0.14263, -0.989776, -2.87935e-07, 0.0477231, -0.998855, 0.0034625, 0.0523089, -0.998598, 0.00813812, -0.0421207, -0.999038, 0.0121984, -0.0504353, -0.998721, 0.00347919, -0.13988, -0.990093, 0.0122365, -0.148081, -0.988969, 0.00347761, -0.236207, -0.971626, 0.0121925, -0.244375, -0.969674, 0.00353653, -0.33035, -0.943779, 0.012233, -0.338253, -0.941048, 0.00354994, -0.427278, -0.904107, 0.00487713, -0.425087, -0.905119, 0.0078107, -0.513431, -0.85811, 0.00604058, -0.511284, -0.859373, 0.00811775, -0.590066, -0.807263, 0.0122099, -0.596771, -0.802404, 0.00345592, -0.671337, -0.741136, 0.00488433, -0.669692, -0.742596, 0.00799333, -0.742269, -0.670097, 0.00269315, -0.738763, -0.673916, 0.00816185, -0.803008, -0.595949, 0.00485708, -0.805765, -0.592235, 0.000131049, -0.858392, -0.512983, 0.00342522, -0.85986, -0.51053, 1.28276e-05, -0.904556, -0.42634, 0.0034532, -0.905756, -0.4238, -1.68661e-06, -0.942917, -0.333026, -3.95445e-05, -0.942016, -0.335549, 0.00352234, -0.971031, -0.238952, 6.24419e-06, -0.970375, -0.241579, 0.00354247, -0.989776, -0.142628, -2.49404e-06, -0.989366, -0.145407, 0.00345631, -0.998598, -0.0523048, 0.00814408, -0.998851, -0.0478034, 0.00339468, -0.999038, 0.0421221, 0.0121969, -0.998717, 0.050516, 0.00354535, -0.990093, 0.13988, 0.0122368, -0.988976, 0.148038, 0.00344213, -0.971608, 0.236279, 0.0122565, -0.969675, 0.244374, 0.00353846, -0.94374, 0.330458, 0.0123406, -0.941098, 0.338117, 0.00342921, -0.906809, 0.421361, 0.012326, -0.903385, 0.428816, 0.00350413, -0.866581, 0.498438, 0.0244362, -0.858923, 0.512041, 0.00808277, -0.866583, 0.498435, 0.0244405, -0.84366, 0.536322, -0.0244199, -0.803603, 0.595134, 0.00611465, -0.84366, 0.536322, -0.0244207, -0.805112, 0.593066, 0.00813684, -0.74114, 0.671333, 0.00487975, -0.74238, 0.669928, 0.00825885, -0.672286, 0.740268, 0.00586062, -0.668468, 0.743741, 1.53878e-05, -0.594728, 0.80392, 0.00334435, -0.592358, 0.805675, 7.82084e-06, -0.508276, 0.861187, -0.00359841, -0.501076, 0.865315, -0.0123565, 0.424586, -0.905329, 0.0102789, 0.326009, -0.945329, -0.00838599, 0.242528, -0.970142, 0.00222125, 0.145113, -0.989411, 0.00301229, 0.0471289, -0.998884, 0.0032162, -0.0510869, -0.998689, 0.00326769, -0.148732, -0.988872, 0.00327086, -0.244765, -0.969577, 0.00315005, -0.338808, -0.94085, 0.00328266, -0.429421, -0.903099, 0.00329919, -0.515726, -0.856747, 0.00318701, -0.597148, -0.802125, 0.00312713, -0.674507, -0.738269, -0.000105497, -0.743627, -0.668595, -0.000102473, -0.804397, -0.594084, 0.00325958, -0.858695, -0.512477, 0.00318298, -0.90479, -0.425846, 0.0031796, -0.942168, -0.335127, 0.00316671, -0.970522, -0.240988, 0.00329054, -0.989475, -0.144668, 0.00331022, -0.998884, -0.0471246, 0.00321879, -0.998697, 0.0509267, 0.00316471, -0.99048, 0.135781, 0.0226673, -0.985908, 0.165741, -0.022689, -0.985908, 0.165741, -0.0226879, -0.969542, 0.244902, 0.00324428, -0.940777, 0.339007, 0.00342528, -0.903209, 0.42919, 0.00312699, -0.856609, 0.515956, 0.0033701, -0.801946, 0.597388, 0.00332736, -0.738189, 0.674594, -2.80784e-05, -0.668467, 0.743742, 1.39092e-05, -0.594084, 0.804396, 0.00326021, -0.508753, 0.860906, -0.00330087, 0.300936, -0.953372, -0.0227956, 0.221131, -0.9749, -0.0259135, 0.143211, -0.989692, 0.000462143, 0.0508662, -0.998705, 0.000561616, -0.0516306, -0.998662, 0.00290797, -0.140076, -0.989929, 0.0204682, -0.161675, -0.986634, -0.0203741, -0.245438, -0.969408, 0.00288896, -0.161674, -0.986634, -0.0203726, -0.339397, -0.940639, 0.00296074, -0.429869, -0.902887, 0.00290404, -0.516348, -0.856374, 0.00293767, -0.597515, -0.801853, 0.00274534, -0.673497, -0.739184, 0.00293261, -0.742822, -0.669482, 0.00302942, -0.804801, -0.593537, 0.0029689, -0.859054, -0.511877, 0.00291962, -0.905057, -0.42528, 0.0028764, -0.942427, -0.334399, 0.00294762, -0.970683, -0.240347, 0.0029849, -0.989524, -0.144342, 0.00282461, -0.998912, -0.0465498, 0.0028818, -0.998662, 0.0516309, 0.00290757, -0.99048, 0.135781, 0.0226673, -0.99048, 0.13578, 0.0226678, -0.988782, 0.149336, 0.00294197, -0.985908, 0.165741, -0.0226879, -0.969382, 0.24554, 0.00294806, -0.940639, 0.339397, 0.00296081, -0.902902, 0.429836, 0.0028828, -0.8566, 0.515974, 0.00270081, -0.801737, 0.59767, 0.00284863, -0.739278, 0.673395, 0.00286296, -0.669805, 0.742532, 0.002799, -0.59368, 0.804696, 0.00287618, -0.509131, 0.860684, -0.00287547, 0.140401, -0.989769, 0.0254017, 0.0529518, -0.998597, 0.000616175, -0.0522192, -0.998633, 0.0024968, -0.140077, -0.989929, 0.0204657, -0.150132, -0.988662, 0.00261513, -0.140076, -0.989929, 0.0204682, -0.245908, -0.96929, 0.00244128, -0.161675, -0.986634, -0.0203741, -0.339583, -0.940573, 0.00237439, -0.430411, -0.902629, 0.0024965, -0.51686, -0.856066, 0.00252248, -0.598027, -0.801472, 0.00239014, -0.669214, -0.742867, 0.0173451, -0.742898, -0.669401, 0.00239449, -0.679809, -0.733184, -0.0173397, -0.80499, -0.593284, 0.00243068, -0.859325, -0.511423, 0.00247863, -0.905328, -0.424705, 0.00248924, -0.942545, -0.334072, 0.00242771, -0.970779, -0.239963, 0.00247572, -0.989628, -0.143633, 0.00248228, -0.998937, -0.0460361, 0.0024459, -0.998632, 0.0522196, 0.00249637, -0.988704, 0.149861, 0.00250228, -0.969235, 0.246124, 0.00253353, -0.940494, 0.339801, 0.00246652, -0.90263, 0.430411, 0.00249708, -0.856066, 0.51686, 0.0025221, -0.801395, 0.59813, 0.00244593, -0.738716, 0.674012, 0.00256416, -0.669303, 0.742985, 0.00244758, -0.593329, 0.804956, 0.00241102, -0.509454, 0.860494, -0.00238119, 0.0473719, -0.998845, 0.00806957, -0.0511561, -0.99869, -0.00062141, -0.150505, -0.988607, 0.00203062, -0.246186, -0.969221, 0.00187502, -0.340322, -0.940307, 0.00197944, -0.431115, -0.902295, 0.00206701, -0.517263, -0.855824, 0.00199091, -0.598526, -0.801101, 0.00193787, -0.669214, -0.742867, 0.0173451, -0.674194, -0.738551, 0.00194888, -0.669214, -0.742867, 0.0173451, -0.743372, -0.668875, 0.00196752, -0.679809, -0.733184, -0.0173397, -0.67981, -0.733184, -0.017342, -0.805227, -0.592964, 0.00190278, -0.85955, -0.511048, 0.00194718, -0.905421, -0.424509, 0.00189467, -0.942736, -0.333533, 0.00194788, -0.970884, -0.239541, 0.00194415, -0.989689, -0.143219, 0.0019466, -0.99897, -0.0453327, 0.00200547, -0.998624, 0.0524096, 0.00188685, -0.988638, 0.150305, 0.00196774, -0.969157, 0.246435, 0.00194897, -0.940329, 0.340262, 0.00195909, -0.90246, 0.43077, 0.00195222, -0.855867, 0.517193, 0.00196549, -0.801101, 0.598526, 0.00193863, -0.738552, 0.674194, 0.00194945, -0.671447, 0.740927, 0.0136635, -0.671447, 0.740926, 0.0136655, -0.592841, 0.805317, 0.00195079, -0.665281, 0.746469, -0.0136245, -0.510033, 0.860153, -0.00194662, 0.0359571, -0.998509, 0.0410687, -0.045062, -0.998669, 0.0251108, -0.15053, -0.988604, 0.00133429, -0.24676, -0.969076, 0.00134452, -0.340582, -0.940214, 0.00134967, -0.431434, -0.902143, 0.00142616, -0.517398, -0.855744, 0.0013351, -0.599168, -0.800622, 0.00143115, -0.674437, -0.738332, 0.00134352, -0.743828, -0.668369, 0.00142667, -0.805507, -0.592585, 0.00133972, -0.859705, -0.51079, 0.00133593, -0.905634, -0.424058, 0.00133856, -0.942848, -0.33322, 0.00134326, -0.970959, -0.239241, 0.00133564, -0.989736, -0.142898, 0.00133984, -0.998976, -0.0452232, 0.00133497, -0.998612, 0.0526615, 0.00128858, -0.988786, 0.149044, 0.00941437, -0.98822, 0.152751, -0.00938518, -0.98822, 0.152752, -0.00938554, -0.969076, 0.24676, 0.00134454, -0.940309, 0.34032, 0.00129885, -0.902333, 0.431038, 0.00133688, -0.855744, 0.517398, 0.00133445, -0.800916, 0.598775, 0.00133249, -0.738331, 0.674437, 0.00134338, -0.668683, 0.743547, 0.00134008, -0.671448, 0.740926, 0.0136655, -0.592585, 0.805507, 0.00133929, -0.665281, 0.746469, -0.0136245, -0.665281, 0.746469, -0.0136238, -0.510333, 0.859976, -0.00134561, -0.0488461, -0.998158, 0.0359798, -0.15076, -0.98857, 0.000683601, -0.246913, -0.969037, 0.000681538, -0.340775, -0.940144, 0.000688641, -0.431207, -0.902253, 0.000680359, -0.517612, -0.855615, 0.000685698, -0.598599, -0.801049, 0.000638594, -0.674591, -0.738191, 0.000686076, -0.743689, -0.668526, 0.000684557, -0.805639, -0.592406, 0.000685346, -0.859808, -0.510617, 0.000681631, -0.905713, -0.423892, 0.000680712, -0.942967, -0.332886, 0.000702716, -0.971018, -0.239005, 0.000685449, -0.989772, -0.142656, 0.000687976, -0.998988, -0.0449826, 0.000684949, -0.998584, 0.0531876, 0.000688103, -0.988786, 0.149044, 0.00941437, -0.988786, 0.149045, 0.00941344, -0.98857, 0.15076, 0.000683145, -0.98822, 0.152752, -0.00938554, -0.969037, 0.246913, 0.00068148, -0.940144, 0.340775, 0.000688974, -0.902253, 0.431207, 0.000680499, -0.855615, 0.517612, 0.000685506, -0.800799, 0.598933, 0.000679269, -0.738191, 0.674591, 0.000685845, -0.668526, 0.743689, 0.000684564, -0.592406, 0.805639, 0.000685333, -0.510501, 0.859877, -0.000685787, -0.0536695, -0.998066, 0.0313596, -0.150794, -0.988565, 0, -0.247004, -0.969014, 0, -0.340482, -0.940251, 0, -0.431303, -0.902207, 0, -0.517683, -0.855573, 0, -0.599024, -0.800731, 0, -0.674592, -0.738191, 0, -0.743706, -0.668506, 0, -0.805665, -0.592372, 0, -0.859884, -0.510489, 0, -0.905764, -0.423782, 0, -0.942924, -0.333009, 0, -0.971018, -0.239005, 0, -0.989781, -0.142596, 0, -0.998991, -0.0448995, 0, -0.998584, 0.0531989, 0, -0.988565, 0.150794, 0, -0.969014, 0.247004, 0, -0.940131, 0.340812, 0, -0.902207, 0.431303, 0, -0.855573, 0.517683, 0, -0.800731, 0.599024, 0, -0.738191, 0.674592, 0, -0.668506, 0.743707, 0, -0.592372, 0.805665, 0, -0.51049, 0.859884, 0, -0.00570503, -0.998683, 0.0509894, 0.00110785, -0.999275, 0.0380511, 0.098807, -0.994726, 0.0275334, 0.0983544, -0.994813, 0.0259699, 0.227178, -0.97385, 0.00240333, 0.404049, -0.914594, -0.0162081, 0.372149, -0.925305, -0.0729133, 0.410734, -0.911747, -0.00392039, 0.42705, -0.903831, 0.0267893, 0.984185, -0.172727, 0.0393011, 0.987449, -0.15787, -0.004583, 0.987249, -0.157964, 0.0196713, 0.98242, -0.176042, 0.0621244, 0.972202, -0.219946, 0.08029, 0.967617, -0.227893, 0.108548, 0.950156, -0.293785, 0.104373, 0.941107, -0.308267, 0.138882, 0.902899, -0.406076, 0.14098, 0.914593, -0.389155, 0.109903, 0.848767, -0.515419, 0.118061, 0.857793, -0.503866, 0.101539, 0.770868, -0.63172, 0.0818058, 0.780719, -0.621277, 0.0670203, 0.662875, -0.747897, 0.0352908, 0.668136, -0.743452, 0.029549, 0.851304, 0.505385, 0.140954, 0.857308, 0.452618, 0.245275, 0.854854, 0.507514, 0.107959, 0.834463, 0.410809, 0.367298, 0.865973, 0.335243, 0.371084, 0.835903, 0.264584, 0.480896, 0.875674, 0.168344, 0.452608, 0.839958, 0.0819668, 0.536425, 0.874818, -0.0420029, 0.482628, 0.841992, -0.113561, 0.527403, 0.844825, -0.28602, 0.452176, 0.854721, -0.267458, 0.444881, 0.804384, -0.485302, 0.342707, 0.807818, -0.48031, 0.341661, 0.710519, -0.678039, 0.188219, 0.691083, -0.697488, 0.189511, 0.110329, -0.991635, 0.0669899, 0.102296, -0.99398, 0.0392364, 0.10732, -0.992614, 0.0565708, 0.412789, -0.910827, -0.00014529, 0.430078, -0.902204, 0.0325806, 0.429602, -0.902463, 0.0316627, -0.0253451, -0.671813, -0.740287, -0.0311511, -0.646313, -0.762437, 0.0316018, -0.617623, -0.785839, -0.0941653, -0.720287, -0.687256, -0.0656977, -0.719499, -0.691379, -0.134665, -0.768337, -0.625718, -0.148798, -0.802018, -0.578469, -0.056753, -0.810304, -0.583255, -0.120104, -0.853523, -0.507024, -0.0177379, -0.868859, -0.494742, -0.0595439, -0.891098, -0.449888, 0.0478217, -0.903666, -0.42556, 0.0201777, -0.907551, -0.419457, 0.122168, -0.912309, -0.390855, 0.10523, -0.901781, -0.419187, 0.193991, -0.898811, -0.393072, -0.170843, -0.720236, -0.672363, -0.25468, -0.728709, -0.635705, -0.309323, -0.762442, -0.568333, -0.324482, -0.805403, -0.496021, -0.299072, -0.851121, -0.431451, -0.236637, -0.89112, -0.38718, -0.147713, -0.917025, -0.370466, -0.043962, -0.922771, -0.382832, -0.423241, -0.707121, -0.566433, -0.329999, -0.708123, -0.624229, -0.482306, -0.731135, -0.482517, -0.498272, -0.769232, -0.40001, -0.471723, -0.816618, -0.332585, -0.406455, -0.866115, -0.290928, -0.309481, -0.908244, -0.281628, -0.190267, -0.933024, -0.305393, -0.56283, -0.65572, -0.503243, -0.465178, -0.664781, -0.58453, -0.620551, -0.67231, -0.403628, -0.633965, -0.709281, -0.308236, -0.604266, -0.761867, -0.233282, -0.536073, -0.822886, -0.188373, -0.434344, -0.882494, -0.180417, -0.305573, -0.928407, -0.211391, -0.674487, -0.561174, -0.479741, -0.578412, -0.58873, -0.564655, -0.736871, -0.571357, -0.361348, -0.74873, -0.622324, -0.228291, -0.710731, -0.691606, -0.128616, -0.637152, -0.767058, -0.0752338, -0.529254, -0.84605, -0.0639474, -0.391375, -0.914804, -0.0997948, -0.667639, -0.502149, -0.549641, -0.77624, -0.487254, -0.400044, -0.826842, -0.50073, -0.25613, -0.832465, -0.535336, -0.142887, -0.798079, -0.600908, -0.0444909, -0.713184, -0.70028, 0.0312474, -0.600917, -0.797895, 0.0475658, -0.457483, -0.88915, 0.0110388, -0.711464, -0.470131, -0.522298, -0.81958, -0.461873, -0.33906, -0.857901, -0.477457, -0.189842, -0.849309, -0.524491, -0.0598663, -0.814625, -0.579797, 0.0148771, -0.771476, -0.634715, 0.0442791, -0.669193, -0.739571, 0.0722147, -0.534015, -0.844197, 0.0464727, -0.0169676, 0.912382, 0.408989, -0.0507457, 0.991622, 0.118788, 0.0699522, 0.703436, 0.707308, 0.187388, 0.420175, 0.887885, 0.308618, 0.138206, 0.941092, 0.429718, -0.178873, 0.885069, 0.523282, -0.459017, 0.717969, 0.572709, -0.682694, 0.453798, 0.584501, -0.788869, 0.189853, 0.510417, -0.859927, -1.79927e-06, 0.583623, -0.811928, -0.0125082, 0.592083, -0.805877, 0, 0.510701, -0.859758, -0.000175217, 0.660101, -0.751079, -0.0121559, 0.668296, -0.743896, 0, 0.730667, -0.682623, -0.012325, 0.738477, -0.674279, 0, 0.796296, -0.604852, -0.00819867, 0.800983, -0.598687, 0, 0.787075, -0.616371, -0.0244799, 0.851712, -0.523947, -0.00814034, 0.855315, -0.518109, 0, 0.843659, -0.536323, -0.0244256, 0.902362, -0.43098, 0, 0.86658, -0.498439, 0.0244386, 0.898862, -0.43816, -0.00792249, 0.940068, -0.340987, 0, 0.911161, -0.411313, 0.0246601, 0.937555, -0.347742, -0.00811184, 0.967101, -0.254268, -0.00802934, 0.969015, -0.247004, 0, 0.962989, -0.268444, -0.0243086, 0.984689, -0.172595, -0.0244734, 0.987393, -0.158075, -0.00818656, 0.98858, -0.150697, 0, 0.996869, -0.0751759, -0.0245208, 0.998136, -0.0604763, -0.0082405, 0.998584, -0.0531988, 0, 0.999224, -0.0309814, 0.0243412, 0.999261, 0.037557, -0.00816241, 0.998987, 0.0449996, 0, 0.992373, 0.120799, -0.0245836, 0.990746, 0.135477, -0.00830019, 0.989767, 0.142695, 0, 0.971047, 0.238888, 0, 0.986056, 0.164635, 0.0242749, 0.972715, 0.231855, -0.00822592, 0.949812, 0.311871, -0.0243605, 0.945357, 0.325936, -0.00807892, 0.942924, 0.333008, 0, 0.905707, 0.423903, 0, 0.935077, 0.353597, 0.0244997, 0.908799, 0.417154, -0.00820721, 0.870668, 0.491262, -0.0244778, 0.863547, 0.504202, -0.00819389, 0.859814, 0.510608, 0, 0.810049, 0.586307, -0.00806088, 0.805629, 0.592421, 0, 0.818392, 0.574145, -0.0243404, 0.748421, 0.663171, -0.00841835, 0.743752, 0.668456, 0, 0.757922, 0.651878, -0.0247012, 0.679948, 0.733214, -0.00825033, 0.674433, 0.738336, 0, 0.690518, 0.722899, -0.0245394, 0.598912, 0.800815, 0, 0.65783, 0.752773, 0.024331, 0.60498, 0.7962, -0.00804915, 0.517302, 0.855803, 0, 0.581066, 0.813487, 0.0245296, 0.524001, 0.85168, -0.00808231, 0.431102, 0.902303, 0, 0.498497, 0.866545, 0.0244939, 0.437948, 0.898963, -0.00812968, 0.347744, 0.937554, -0.00811358, 0.340988, 0.940068, 0, 0.361448, 0.932073, -0.0243977, 0.254159, 0.967128, -0.00812767, 0.247192, 0.968967, 0, 0.268328, 0.963018, -0.0244093, 0.157832, 0.98743, -0.00840638, 0.151005, 0.988533, 0, 0.172345, 0.984727, -0.0246943, 0.060794, 0.998119, -0.00795563, 0.0533981, 0.998573, 0, 0.0755133, 0.99685, -0.0242393, -0.045, 0.998987, 0, 0.0312644, 0.999208, 0.0246264, -0.0374063, 0.999268, -0.0080145, -0.142697, 0.989766, 0, -0.0668654, 0.99746, 0.0245661, -0.135316, 0.990769, -0.00814773, -0.238793, 0.97107, 0, -0.164462, 0.986081, 0.0244345, -0.231787, 0.972732, -0.0081575, -0.311951, 0.949784, -0.0244501, -0.326022, 0.945327, -0.00816543, -0.333009, 0.942924, 0, -0.403677, 0.914571, -0.0245818, -0.417242, 0.908758, -0.00829722, -0.423782, 0.905764, 0, -0.491347, 0.870617, -0.0245691, -0.504288, 0.863496, -0.00828577, -0.510416, 0.859928, 0, 0.424187, -0.905575, -1.52479e-06, 0.430459, -0.902574, 0.00814638, 0.333395, -0.942787, 0, 0.403532, -0.914639, -0.0244265, 0.339944, -0.940411, 0.00813189, 0.246123, -0.969204, 0.00813773, 0.239005, -0.971018, 0, 0.26033, -0.965211, 0.0244167, 0.149927, -0.988664, 0.0081457, 0.142695, -0.989767, 1.74256e-06, 0.164463, -0.986081, 0.0244321, 0.0523093, -0.998598, 0.00813849, 0.044999, -0.998987, 0, 0.0670283, -0.997452, 0.0244172, 0.0227944, -0.999442, -0.0244318, -0.0531998, -0.998584, 0, -0.0458049, -0.998917, 0.00812936, -0.0752542, -0.996864, -0.0244594, -0.150599, -0.988595, 0, -0.143544, -0.98961, 0.00815897, -0.172642, -0.984682, -0.0244111, -0.247192, -0.968966, 0, -0.239801, -0.970788, 0.00812137, -0.319816, -0.947164, 0.0244413, -0.333841, -0.942594, 0.00816288, -0.34078, -0.940143, 1.79924e-06, -0.411072, -0.911276, 0.024425, -0.424599, -0.905345, 0.00813268, -0.431102, -0.902303, 0, -0.451025, -0.892176, -0.0244476, -0.517992, -0.855385, 0, -0.511285, -0.859373, 0.00811732, -0.536284, -0.843683, -0.0244583, -0.598911, -0.800816, 0, -0.593067, -0.805112, 0.0081363, -0.616409, -0.787047, -0.0244342, -0.674592, -0.738191, 0, -0.66913, -0.743101, 0.00814665, -0.690591, -0.722833, -0.0244371, -0.743896, -0.668296, 0, -0.738763, -0.673916, 0.00816176, -0.805748, -0.592258, 0, -0.758131, -0.651645, -0.0244144, -0.801227, -0.598305, 0.00811597, -0.859813, -0.510608, 0, -0.818324, -0.574237, -0.0244621, -0.856036, -0.516852, 0.008161, -0.905669, -0.423986, 0, -0.902571, -0.430463, 0.00815098, -0.895886, -0.443612, 0.0244254, -0.942924, -0.333009, 0, -0.940402, -0.339967, 0.00810672, -0.935033, -0.35372, 0.0243907, -0.971041, -0.238912, 0, -0.949776, -0.311971, -0.0244685, -0.969209, -0.246103, 0.00815421, -0.989781, -0.142597, 0, -0.975792, -0.21733, -0.0244327, -0.988664, -0.149925, 0.00814579, -0.998992, -0.0448995, 0, -0.992395, -0.120645, -0.0244335, -0.998598, -0.0523048, 0.00814408, -0.998573, 0.053399, 0, -0.998917, 0.0458103, 0.00812339, -0.99922, 0.0310556, 0.0244085, -0.988565, 0.150795, 0, -0.989611, 0.143538, 0.00816499, -0.991359, 0.128881, 0.0244487, -0.968991, 0.247098, 0, -0.984681, 0.172648, -0.0244173, -0.97077, 0.239874, 0.0081834, -0.942553, 0.333953, 0.00826729, -0.940143, 0.340779, 0, -0.947128, 0.319917, 0.0245511, -0.905286, 0.424721, 0.0082543, -0.902265, 0.431183, 0, -0.911211, 0.411208, 0.0245333, -0.866583, 0.498435, 0.0244405, -0.866582, 0.498435, 0.0244394, -0.855616, 0.51761, 0, -0.813563, 0.580964, 0.0244185, -0.84366, 0.536322, -0.0244207, -0.805111, 0.593068, 0.0081343, -0.800767, 0.598976, 0, -0.787045, 0.616412, -0.0244381, -0.738191, 0.674592, 0, -0.743104, 0.669127, 0.00813955, -0.684563, 0.728543, 0.0244438, -0.673918, 0.738761, 0.00816519, -0.668717, 0.743517, 0, -0.651646, 0.75813, -0.024414, -0.592485, 0.805581, 0, -0.598268, 0.801254, 0.00815574, -0.574206, 0.818347, -0.0244218, -0.510416, 0.859928, 0, -0.504288, 0.863496, -0.00828577, 0.592375, -0.805662, 0, 0.51049, -0.859884, 0, 0.668506, -0.743707, 0, 0.738478, -0.674278, 0, 0.80073, -0.599025, 0, 0.855573, -0.517682, 0, 0.902361, -0.430981, 0, 0.940132, -0.340811, 0, 0.969014, -0.247004, 0, 0.988565, -0.150793, 0, 0.998584, -0.0531988, 0, 0.998991, 0.0448999, 0, 0.989781, 0.142598, 0, 0.971018, 0.239004, 0, 0.942924, 0.333008, 0, 0.905763, 0.423785, 0, 0.859883, 0.510491, 0, 0.805663, 0.592375, 0, 0.743707, 0.668506, 0, 0.674591, 0.738191, 0, 0.599024, 0.800731, 0, 0.517302, 0.855803, 0, 0.431303, 0.902207, 0, 0.340811, 0.940132, 0, 0.247004, 0.969014, 0, 0.150793, 0.988565, 0, 0.0531988, 0.998584, 0, -0.0448996, 0.998992, 0, -0.142597, 0.989781, 0, -0.239004, 0.971019, 0, -0.333007, 0.942924, 0, -0.423785, 0.905763, 0, -0.510491, 0.859883, 0, 0.423174, -0.906049, -4.06588e-06, 0.333009, -0.942924, -2.43961e-06, 0.238604, -0.971117, 3.04943e-06, 0.142597, -0.989781, 6.09898e-06, 0.0448996, -0.998992, 0, -0.0531991, -0.998584, 0, -0.150795, -0.988565, 0, -0.247004, -0.969015, 0, -0.340811, -0.940132, 0, -0.431303, -0.902207, 0, -0.518109, -0.855315, 0, -0.599023, -0.800731, 0, -0.674592, -0.738191, 0, -0.743707, -0.668506, 0, -0.805664, -0.592373, 0, -0.859884, -0.51049, 0, -0.905765, -0.423781, 0, -0.942924, -0.333009, 0, -0.971018, -0.239005, 0, -0.989781, -0.142597, 0, -0.998992, -0.0448994, 0, -0.998584, 0.0531991, 0, -0.988565, 0.150796, 0, -0.969015, 0.247003, 0, -0.940132, 0.340811, 0, -0.902207, 0.431303, 0, -0.855572, 0.517685, 0, -0.800732, 0.599023, 0, -0.738191, 0.674592, 0, -0.668506, 0.743707, 0, -0.592372, 0.805664, 0, -0.510491, 0.859883, 0, 0.586392, -0.809986, 0.008153, 0.588308, -0.808615, 0.00596584, 0.51456, -0.857442, -0.00465993, 0.510444, -0.859911, -9.04036e-05, 0.660024, -0.751148, 0.0120605, 0.666279, -0.745695, 0.00333446, 0.735233, -0.677796, 0.0049936, 0.736276, -0.676672, 0.00347371, 0.796234, -0.604934, 0.00810303, 0.800666, -0.599111, -9.20645e-05, 0.849759, -0.527029, 0.0122462, 0.857051, -0.51522, -0.00342823, 0.900285, -0.435273, 0.00490437, 0.902206, -0.431305, -4.83436e-06, 0.94015, -0.34076, 2.91178e-05, 0.9392, -0.343351, 0.00351837, 0.969024, -0.246967, 2.27599e-05, 0.968304, -0.249753, 0.00342095, 0.988556, -0.150856, -2.77741e-05, 0.988128, -0.153595, 0.00345801, 0.998585, -0.0531799, 2.11847e-05, 0.998425, -0.0559939, 0.0034655, 0.999261, 0.0375572, 0.00816223, 0.999105, 0.0421609, 0.0034868, 0.991209, 0.131731, 0.0123001, 0.990177, 0.139781, 0.00340087, 0.97352, 0.228268, 0.0123136, 0.971706, 0.23617, 0.00340222, 0.946514, 0.322432, 0.0121523, 0.943848, 0.330363, 0.00348425, 0.910265, 0.413842, 0.0123419, 0.906976, 0.421169, 0.00337252, 0.865333, 0.501047, 0.0123215, 0.861275, 0.508128, 0.00345627, 0.808331, 0.588708, 0.00480037, 0.80947, 0.587105, 0.0081135, 0.745065, 0.666986, 0.00283584, 0.748598, 0.662974, 0.00817705, 0.682623, 0.730666, 0.0123258, 0.672823, 0.739794, -0.00376393, 0.60789, 0.793929, 0.0121241, 0.596857, 0.80234, -0.00354604, 0.521493, 0.853242, 0.00482201, 0.517911, 0.855434, -0.000250296, 0.431315, 0.902201, -2.01065e-05, 0.433818, 0.900994, 0.00346283, 0.343309, 0.939216, 0.00355667, 0.340759, 0.940151, 2.81436e-05, 0.249537, 0.968358, 0.00360628, 0.247023, 0.96901, -2.06242e-05, 0.153709, 0.988111, 0.00336687, 0.150845, 0.988557, -1.68186e-05, 0.0560772, 0.998421, 0.00340029, 0.0531979, 0.998584, 9.38213e-06, -0.0420814, 0.999108, 0.00342036, -0.0375554, 0.999261, 0.00814769, -0.131652, 0.991221, 0.0122226, -0.139879, 0.990162, 0.00347989, -0.228185, 0.973541, 0.0122301, -0.23617, 0.971706, 0.00340228, -0.322519, 0.946484, 0.0122378, -0.330433, 0.943823, 0.00354297, -0.419782, 0.907612, 0.0048885, -0.417888, 0.908462, 0.00810131, -0.506443, 0.862251, 0.00618064, -0.504147, 0.863579, 0.0081339, 0.5093, -0.860587, 0.00217981, 0.597881, -0.801583, -0.00176573, 0.674172, -0.738534, -0.00771766, 0.746761, -0.664646, -0.0243542, 0.799482, -0.600681, 0.00329948, 0.854363, -0.519667, 0.00311518, 0.901486, -0.432794, 0.00357848, 0.939456, -0.342653, 0.00335962, 0.968473, -0.249099, 0.0032401, 0.988211, -0.153063, 0.00317888, 0.998453, -0.0555082, 0.00315203, 0.999079, 0.0427966, 0.00325951, 0.990067, 0.140558, 0.00329043, 0.971519, 0.236938, 0.00330212, 0.943654, 0.330918, 0.00322731, 0.906626, 0.421923, 0.00330442, 0.860906, 0.508753, 0.00329956, 0.806962, 0.590594, 0.00322183, 0.746898, 0.664894, 0.0077456, 0.677332, 0.735655, 0.00574335, 0.600897, 0.799321, 0.00312315, 0.519433, 0.854505, 0.00329469, 0.43323, 0.901278, 0.00325103, 0.355191, 0.934523, 0.0224826, 0.355191, 0.934523, 0.0224826, 0.326693, 0.944854, -0.0228763, 0.24902, 0.968493, 0.00329278, 0.152821, 0.988248, 0.00334471, 0.0553303, 0.998463, 0.00326637, -0.0428001, 0.999078, 0.00326797, -0.140825, 0.990028, 0.00347159, -0.236843, 0.971543, 0.0032317, -0.331044, 0.94361, 0.00331525, -0.421954, 0.906611, 0.00332813, -0.508752, 0.860907, 0.00330213, 0.706399, -0.705433, -0.058001, 0.773893, -0.623614, -0.110432, 0.805742, -0.592015, -0.0172398, 0.852617, -0.522536, 0.000682934, 0.901543, -0.432681, 0.00293021, 0.939596, -0.342272, 0.00290535, 0.968638, -0.248458, 0.00294584, 0.988339, -0.152243, 0.0029839, 0.998491, -0.0548346, 0.00288036, 0.999052, 0.0434358, 0.00295145, 0.989992, 0.141095, 0.00292479, 0.971336, 0.23769, 0.00305739, 0.943475, 0.331431, 0.00287121, 0.906378, 0.422458, 0.00295561, 0.860645, 0.509198, 0.00291284, 0.80678, 0.590845, 0.00274041, 0.744407, 0.667718, 0.00320537, 0.675833, 0.737049, 0.00287342, 0.600533, 0.799595, 0.00273897, 0.519247, 0.85462, 0.00275141, 0.432432, 0.901661, 0.00307877, 0.342331, 0.939575, 0.00287528, 0.355191, 0.934524, 0.0224826, 0.326693, 0.944854, -0.0228769, 0.248105, 0.968728, 0.00313805, 0.326693, 0.944854, -0.0228763, 0.152085, 0.988363, 0.00307138, 0.0547412, 0.998496, 0.00293039, -0.043084, 0.999068, 0.00276218, -0.141194, 0.989977, 0.00297643, -0.237569, 0.971366, 0.00298505, -0.33151, 0.943447, 0.00291531, -0.422392, 0.906408, 0.00291579, -0.509131, 0.860684, 0.00287448, 0.856861, -0.51491, -0.0256465, 0.816897, -0.575552, -0.0376667, 0.901745, -0.432261, 0.00245939, 0.939914, -0.341403, 0.00263454, 0.968732, -0.248095, 0.00243856, 0.988398, -0.151863, 0.00246928, 0.998533, -0.0540927, 0.00253923, 0.999029, 0.0439842, 0.00251498, 0.98992, 0.141605, 0.00247514, 0.971274, 0.237949, 0.00247394, 0.943315, 0.331888, 0.00242575, 0.906197, 0.422849, 0.00246552, 0.860325, 0.50974, 0.00251972, 0.80627, 0.591543, 0.00248037, 0.744097, 0.668066, 0.00267617, 0.675382, 0.737464, 0.00247983, 0.600099, 0.799922, 0.00234555, 0.518658, 0.854978, 0.00241874, 0.437534, 0.899032, 0.0174599, 0.437535, 0.899032, 0.0174615, 0.424532, 0.905248, -0.0172825, 0.341901, 0.939733, 0.0024174, 0.248025, 0.96875, 0.00246239, 0.152073, 0.988366, 0.00238338, 0.0542713, 0.998523, 0.00246561, -0.0438865, 0.999034, 0.00247054, -0.141605, 0.98992, 0.00247427, -0.237775, 0.971317, 0.00239922, -0.331998, 0.943277, 0.00246969, -0.42307, 0.906093, 0.00257017, -0.509454, 0.860494, 0.00238116, 0.901155, -0.433496, 0.00137881, 0.864455, -0.497268, -0.0737722, 0.93863, -0.344656, 0.0136429, 0.93863, -0.344656, 0.0136437, 0.968779, -0.247919, 0.00184232, 0.941455, -0.336863, -0.013645, 0.988459, -0.151473, 0.00193102, 0.998546, -0.0538764, 0.00192414, 0.99901, 0.0444381, 0.00198062, 0.989856, 0.142062, 0.00195637, 0.971166, 0.238394, 0.00195052, 0.943249, 0.332081, 0.00183751, 0.906011, 0.42325, 0.00194101, 0.860371, 0.509665, 0.00181801, 0.806039, 0.591859, 0.00193548, 0.746558, 0.665182, 0.0135815, 0.741017, 0.671346, -0.0137065, 0.741017, 0.671346, -0.0137048, 0.67491, 0.737898, 0.0020121, 0.599946, 0.800039, 0.00177743, 0.518092, 0.855323, 0.00197408, 0.431834, 0.901951, 0.00194553, 0.437534, 0.899032, 0.0174599, 0.424531, 0.905248, -0.0172854, 0.34095, 0.940079, 0.00207697, 0.424532, 0.905248, -0.0172826, 0.247578, 0.968866, 0.00194443, 0.151458, 0.988462, 0.0019332, 0.0535906, 0.998561, 0.00201246, -0.044438, 0.99901, 0.00198012, -0.142144, 0.989844, 0.00197886, -0.238214, 0.971211, 0.00189521, -0.332395, 0.943138, 0.00194062, -0.423251, 0.906011, 0.00194007, -0.510033, 0.860153, 0.00194658, 0.900027, -0.435747, 0.00874773, 0.904401, -0.421848, -0.0640536, 0.867934, -0.495032, -0.0404156, 0.93863, -0.344656, 0.0136437, 0.940169, -0.340705, 0.00141403, 0.901631, -0.432391, -0.00997642, 0.968944, -0.247275, 0.00133702, 0.941455, -0.336863, -0.013645, 0.941455, -0.336863, -0.0136471, 0.988524, -0.151058, 0.00134784, 0.998588, -0.0530975, 0.00141712, 0.999, 0.0446925, 0.00134715, 0.989811, 0.142383, 0.00134817, 0.971087, 0.238723, 0.00134592, 0.942984, 0.332836, 0.00136464, 0.90586, 0.423575, 0.00134367, 0.859976, 0.510333, 0.00134498, 0.805823, 0.592155, 0.0013424, 0.746558, 0.665182, 0.0135815, 0.746558, 0.665181, 0.0135828, 0.743908, 0.66828, 0.00134365, 0.741017, 0.671346, -0.0137048, 0.67483, 0.737972, 0.0013385, 0.59914, 0.800643, 0.00136808, 0.517855, 0.855468, 0.00134691, 0.432034, 0.901856, 0.00123468, 0.341083, 0.940032, 0.00133153, 0.2476, 0.968862, 0.00127183, 0.151169, 0.988507, 0.00132914, 0.0534817, 0.998568, 0.0013385, -0.0448944, 0.998991, 0.00139117, -0.14237, 0.989812, 0.00134168, -0.238538, 0.971132, 0.00131115, -0.332748, 0.943015, 0.00134801, -0.423575, 0.90586, 0.00134309, -0.510332, 0.859976, 0.00134582, 0.93996, -0.341285, 0.000639744, 0.901631, -0.432391, -0.00997643, 0.901631, -0.432391, -0.00997661, 0.90275, -0.428855, -0.0335501, 0.968974, -0.247161, 0.00067573, 0.98855, -0.150893, 0.000684045, 0.998577, -0.0533215, 0.000679264, 0.998994, 0.0448484, 0.000682373, 0.989791, 0.142522, 0.00067984, 0.97105, 0.238876, 0.000682246, 0.942949, 0.332935, 0.000685412, 0.905619, 0.424091, 0.000723677, 0.859877, 0.510501, 0.000685472, 0.805719, 0.592298, 0.000682182, 0.743778, 0.668427, 0.000682951, 0.67469, 0.738101, 0.000681744, 0.599041, 0.800718, 0.000688186, 0.517726, 0.855546, 0.000681894, 0.431328, 0.902195, 0.000687373, 0.340902, 0.940099, 0.000678577, 0.247043, 0.969004, 0.000685478, 0.150893, 0.98855, 0.000684029, 0.0533214, 0.998577, 0.000678918, -0.0448484, 0.998994, 0.000682641, -0.142522, 0.989791, 0.000679759, -0.238876, 0.97105, 0.000682328, -0.332935, 0.942949, 0.000685208, -0.42377, 0.90577, 0.000686451, -0.510501, 0.859877, 0.000685785, 0.879993, -0.473842, -0.0329617, 0.904385, -0.421974, -0.0634449, 0.846037, -0.506121, -0.167518, 0.845954, -0.508239, -0.161417, 0.757896, -0.651327, -0.0369642, 0.611503, -0.790999, -0.0196227, 0.521624, -0.85289, -0.0220794, -0.317142, -0.947008, 0.0509545, -0.31647, -0.947008, 0.0549726, -0.26599, -0.958802, 0.0997439, -0.267125, -0.958843, 0.0962469, -0.183073, -0.974121, 0.132559, -0.188011, -0.974489, 0.122568, -0.0757521, -0.987291, 0.139705, -0.0844427, -0.988316, 0.126889, 0.0492955, -0.991316, 0.121909, 0.0379715, -0.993359, 0.108613, 0.194871, -0.976653, 0.0904154, 0.177439, -0.981419, 0.0730152, 0.343422, -0.938351, 0.0394909, 0.332141, -0.94279, 0.0288176, 0.503, -0.864256, -0.00724176, 0.496075, -0.868169, -0.013861, -0.801132, -0.537021, 0.264188, -0.790728, -0.537574, 0.292855, -0.669713, -0.60519, 0.430382, -0.67967, -0.604153, 0.41599, -0.514453, -0.695454, 0.501678, -0.528805, -0.693899, 0.488743, -0.329263, -0.792428, 0.513462, -0.367033, -0.78968, 0.491623, -0.195791, -0.877715, 0.437359, -0.114411, -0.877764, 0.465233, 0.0145141, -0.940759, 0.338764, 0.0736494, -0.934442, 0.348416, 0.240799, -0.952315, 0.187381, 0.276864, -0.942086, 0.189263, 0.455781, -0.890092, 0, 0.491722, -0.870752, 0, 0.81883, -0.570443, 0.064127, 0.820835, -0.568516, 0.05495, 0.823968, -0.565235, 0.0398348, 0.58237, -0.282065, -0.76242, 0.666178, -0.254619, -0.700982, 0.642228, -0.267478, -0.71833, 0.726108, -0.237937, -0.6451, 0.697037, -0.212586, -0.684796, 0.70242, -0.290384, -0.649833, 0.764047, -0.273133, -0.584492, 0.778794, -0.257814, -0.57185, 0.746441, -0.348525, -0.566883, 0.809488, -0.308458, -0.499583, 0.762515, -0.437252, -0.476845, 0.811804, -0.379413, -0.443869, 0.740902, -0.509052, -0.4381, 0.787151, -0.455494, -0.415835, 0.698586, -0.57767, -0.422226, 0.739943, -0.538456, -0.403174, 0.633704, -0.671195, -0.384599, 0.680389, -0.581578, -0.445912, 0.761849, -0.125339, -0.635513, 0.691142, -0.207568, -0.692271, 0.748546, -0.25839, -0.610667, 0.818506, -0.0941578, -0.56673, 0.730544, -0.241882, -0.638591, 0.863826, -0.102113, -0.493332, 0.894103, -0.153421, -0.420764, 0.899351, -0.238014, -0.366765, 0.876, -0.316241, -0.364165, 0.830001, -0.412898, -0.374985, 0.76073, -0.502374, -0.410986, 0.83712, 0.028738, -0.546264, 0.886446, 0.0640541, -0.458377, 0.925416, 0.0544845, -0.375016, 0.948537, 0.00988625, -0.31651, 0.954997, -0.057746, -0.29094, 0.945678, -0.162866, -0.281367, 0.91034, -0.279494, -0.30523, 0.842735, -0.406117, -0.353365, 0.843077, 0.180453, -0.506615, 0.887304, 0.223308, -0.403515, 0.926215, 0.217009, -0.308275, 0.958162, 0.165716, -0.233377, 0.979097, 0.0767637, -0.188353, 0.982762, -0.0409959, -0.180271, 0.961449, -0.176065, -0.211229, 0.904309, -0.325459, -0.276229, 0.830761, 0.322458, -0.453714, 0.870966, 0.364452, -0.329534, 0.910205, 0.352915, -0.216745, 0.947419, 0.293064, -0.128494, 0.978472, 0.192125, -0.0753763, 0.996157, 0.059519, -0.0642581, 0.990526, -0.0943008, -0.0998266, 0.947078, -0.266275, -0.179276, 0.796526, 0.447825, -0.4062, 0.832456, 0.487866, -0.262685, 0.872425, 0.470129, -0.133615, 0.9151, 0.401957, -0.0319763, 0.956278, 0.290808, 0.0310401, 0.988227, 0.145518, 0.0472458, 0.999651, -0.0239538, 0.0111011, 0.973014, -0.216514, -0.0797856, 0.7658, 0.497477, -0.407512, 0.792722, 0.544536, -0.273992, 0.832804, 0.535842, -0.138966, 0.878613, 0.476636, -0.0292877, 0.926555, 0.373538, 0.0443371, 0.969666, 0.233518, 0.0722328, 0.996822, 0.0647333, 0.0464208, 0.985037, -0.168377, -0.0367468, -0.763982, 0.425482, 0.485074, -0.684556, 0.307865, 0.660759, -0.487224, 0.062771, 0.871018, -0.265759, -0.207254, 0.941498, -0.0465379, -0.464264, 0.884473, 0.153329, -0.679737, 0.71725, 0.3233, -0.828849, 0.456603, 0.455747, -0.883061, 0.111798, 0.424043, -0.905642, 0.000236509, 0.426124, -0.904658, -0.00365693, 0.336087, -0.941826, -0.00306092, 0.332715, -0.943027, -0.000256888, 0.241596, -0.970371, -0.00352434, 0.238897, -0.971045, -5.27695e-05, 0.145132, -0.989406, -0.00367978, 0.142932, -0.989732, 0.000274553, 0.0477277, -0.998854, -0.00345975, 0.0522369, -0.998601, -0.0082072, -0.0420481, -0.999042, -0.0121296, -0.0504353, -0.998721, -0.00347919, -0.139809, -0.990104, -0.0121686, -0.14805, -0.988974, -0.00344803, -0.236347, -0.971591, -0.0123246, -0.244357, -0.969679, -0.00352227, -0.330283, -0.943803, -0.0121687, -0.338253, -0.941048, -0.00354968, -0.421299, -0.906839, -0.012267, -0.428505, -0.903534, -0.00321894, -0.507945, -0.861305, -0.0120425, -0.515253, -0.857031, -0.00346152, -0.590114, -0.807227, -0.0122663, -0.596822, -0.802366, -0.0035058, -0.671414, -0.741065, -0.00497964, -0.669686, -0.742601, -0.00798908, -0.742269, -0.670097, -0.00269353, -0.738797, -0.673878, -0.00821265, -0.803008, -0.595948, -0.00485635, -0.805766, -0.592235, -0.000130571, -0.859842, -0.51056, 1.67736e-05, -0.855952, -0.516993, -0.00801115, -0.903859, -0.427803, -0.00488904, -0.905761, -0.423788, -1.38598e-05, -0.942001, -0.335593, -0.00348463, -0.942917, -0.333027, 3.83737e-05, -0.970375, -0.241579, -0.00354236, -0.971049, -0.238882, -7.12332e-05, -0.989366, -0.145407, -0.00345679, -0.989776, -0.142628, 2.49497e-06, -0.998851, -0.0478034, -0.00339472, -0.998591, -0.0524524, -0.00800985, -0.999034, 0.0421961, -0.0122641, -0.998717, 0.050516, -0.00354535, -0.990104, 0.139809, -0.0121684, -0.988975, 0.148039, -0.00344105, -0.971625, 0.236211, -0.0121885, -0.969675, 0.244373, -0.003539, -0.943741, 0.330455, -0.0123433, -0.941098, 0.338117, -0.00342898, -0.906809, 0.421362, -0.0123245, -0.903385, 0.428817, -0.00350241, -0.857879, 0.513828, -0.00486205, -0.858924, 0.51204, -0.00808382, -0.803604, 0.595133, -0.00611487, -0.813441, 0.581128, -0.0246052, -0.741211, 0.671255, -0.00478542, -0.786919, 0.61658, 0.0242487, -0.742386, 0.669921, -0.00825461, -0.672285, 0.740269, -0.00585953, -0.668545, 0.743672, 8.06512e-05, -0.594728, 0.80392, -0.00334434, -0.592442, 0.805613, 8.49809e-05, -0.506443, 0.862251, 0.00618064, -0.504147, 0.863579, 0.0081339, 0.424586, -0.905329, -0.010279, 0.311632, -0.949689, 0.031253, 0.24245, -0.970161, -0.00227485, 0.145112, -0.989411, -0.00301155, 0.0471289, -0.998884, -0.00321619, -0.0510865, -0.998689, -0.00326832, -0.148744, -0.98887, -0.00327942, -0.244843, -0.969557, -0.00320424, -0.338783, -0.940859, -0.00326277, -0.429352, -0.903132, -0.00325117, -0.51569, -0.856769, -0.00315803, -0.597095, -0.802165, -0.00308179, -0.674507, -0.738269, 0.000105464, -0.743627, -0.668595, 0.000101431, -0.804396, -0.594084, -0.00326078, -0.858695, -0.512477, -0.0031819, -0.90479, -0.425846, -0.00317971, -0.942168, -0.335127, -0.00316707, -0.970523, -0.240988, -0.00328959, -0.989465, -0.144736, -0.00326199, -0.998884, -0.0471245, -0.00321925, -0.998697, 0.0509267, -0.00316471, -0.99048, 0.135781, -0.0226673, -0.985908, 0.165741, 0.022689, -0.985908, 0.165741, 0.0226879, -0.969558, 0.244842, -0.00320492, -0.940787, 0.338982, -0.00340639, -0.903242, 0.429122, -0.00307718, -0.856609, 0.515956, -0.00337053, -0.801946, 0.597388, -0.00332735, -0.738189, 0.674594, 2.8071e-05, -0.668466, 0.743743, -1.33049e-05, -0.594084, 0.804397, -0.00325963, -0.508752, 0.860907, 0.00330213, 0.26518, -0.960094, 0.0888815, 0.178642, -0.978206, 0.105835, 0.13063, -0.991149, 0.0236682, 0.0508668, -0.998705, -0.000562744, -0.0516269, -0.998662, -0.00290512, -0.140078, -0.989929, -0.0204642, -0.161674, -0.986634, 0.0203726, -0.161675, -0.986634, 0.0203741, -0.245438, -0.969408, -0.00288896, -0.339423, -0.940629, -0.00297826, -0.429869, -0.902887, -0.00290518, -0.516387, -0.85635, -0.00296038, -0.589806, -0.807292, -0.0202074, -0.607292, -0.794211, 0.0206255, -0.607292, -0.794211, 0.0206257, -0.673535, -0.73915, -0.00296414, -0.742822, -0.669481, -0.00302811, -0.804749, -0.593608, -0.00291935, -0.859054, -0.511877, -0.0029194, -0.905057, -0.42528, -0.00287643, -0.94241, -0.334448, -0.00291847, -0.970683, -0.240347, -0.00298522, -0.989524, -0.144342, -0.00282467, -0.998912, -0.0465496, -0.00288205, -0.998662, 0.0516309, -0.00290744, -0.99048, 0.135781, -0.0226673, -0.99048, 0.135781, -0.0226673, -0.988793, 0.149262, -0.00290272, -0.985908, 0.165741, 0.0226879, -0.969382, 0.24554, -0.00294789, -0.940639, 0.339397, -0.00296017, -0.902902, 0.429836, -0.0028828, -0.8566, 0.515974, -0.00270082, -0.801737, 0.59767, -0.00284865, -0.739278, 0.673395, -0.002863, -0.669804, 0.742532, -0.00279867, -0.593679, 0.804696, -0.00287577, -0.509131, 0.860684, 0.00287448, 0.105738, -0.99273, 0.0574961, 0.031961, -0.9982, 0.0507501, -0.0522194, -0.998633, -0.00249632, -0.140078, -0.989929, -0.0204642, -0.140077, -0.989929, -0.0204657, -0.150132, -0.988662, -0.00261562, -0.161675, -0.986634, 0.0203741, -0.245908, -0.96929, -0.00244015, -0.339583, -0.940573, -0.00237486, -0.430411, -0.902629, -0.00249646, -0.51686, -0.856066, -0.00252208, -0.589806, -0.807292, -0.0202074, -0.589806, -0.807292, -0.0202073, -0.597968, -0.801517, -0.0023603, -0.607292, -0.794211, 0.0206257, -0.669214, -0.742867, -0.0173451, -0.742898, -0.6694, -0.00239388, -0.679808, -0.733185, 0.0173375, -0.80499, -0.593284, -0.00243079, -0.859325, -0.511423, -0.00247834, -0.905328, -0.424705, -0.00248923, -0.942544, -0.334072, -0.00242799, -0.970784, -0.23994, -0.0024826, -0.989628, -0.143633, -0.00248197, -0.998937, -0.0460363, -0.00244638, -0.998633, 0.0522196, -0.00249566, -0.988704, 0.149861, -0.00250196, -0.96924, 0.246103, -0.00252394, -0.940543, 0.339665, -0.00241028, -0.902629, 0.430411, -0.00249594, -0.856042, 0.5169, -0.00254238, -0.801395, 0.598131, -0.00244531, -0.738716, 0.674012, -0.00256359, -0.669304, 0.742985, -0.00244864, -0.593284, 0.80499, -0.00243068, -0.509454, 0.860494, 0.00238116, 0.0166662, -0.995394, 0.0944099, -0.0511559, -0.99869, 0.000620507, -0.150398, -0.988623, -0.00199734, -0.246186, -0.969221, -0.00187322, -0.340322, -0.940307, -0.0019794, -0.431, -0.90235, -0.00202797, -0.517305, -0.855799, -0.00200625, -0.598571, -0.801068, -0.00195712, -0.669214, -0.742867, -0.0173451, -0.669214, -0.742867, -0.0173451, -0.674089, -0.738648, -0.00190822, -0.740926, -0.671447, -0.0136654, -0.679809, -0.733184, 0.0173397, -0.679808, -0.733185, 0.0173375, -0.740926, -0.671448, -0.0136671, -0.805227, -0.592964, -0.00190151, -0.746469, -0.665281, 0.013624, -0.859592, -0.510978, -0.00197421, -0.905422, -0.424509, -0.00189393, -0.942736, -0.333533, -0.0019478, -0.970856, -0.239654, -0.00191056, -0.989691, -0.143204, -0.00194927, -0.99897, -0.0453326, -0.00200519, -0.998624, 0.0524095, -0.00188692, -0.988638, 0.150305, -0.00196725, -0.969157, 0.246435, -0.00194897, -0.940348, 0.340207, -0.00194099, -0.902459, 0.430771, -0.00194857, -0.855867, 0.517193, -0.0019655, -0.801101, 0.598526, -0.00193838, -0.738551, 0.674194, -0.00194893, -0.671447, 0.740926, -0.0136654, -0.671447, 0.740927, -0.0136637, -0.592841, 0.805317, -0.00195075, -0.665281, 0.746468, 0.0136224, -0.510033, 0.860153, 0.00194658, 0.0134345, -0.997796, 0.0649827, -0.0608882, -0.996629, 0.0549897, -0.15064, -0.988588, -0.00135964, -0.246761, -0.969076, -0.00134452, -0.340582, -0.940214, -0.00134989, -0.431434, -0.902143, -0.00142595, -0.517398, -0.855744, -0.0013351, -0.599168, -0.800622, -0.00143115, -0.674437, -0.738332, -0.00134352, -0.743828, -0.668369, -0.00142703, -0.740926, -0.671447, -0.0136654, -0.805507, -0.592585, -0.00133944, -0.746469, -0.665281, 0.0136236, -0.746469, -0.665281, 0.013624, -0.859705, -0.51079, -0.00133595, -0.905634, -0.424058, -0.00133853, -0.942848, -0.33322, -0.00134348, -0.970959, -0.239241, -0.00133544, -0.989736, -0.142898, -0.00133988, -0.998976, -0.0452232, -0.00133496, -0.998612, 0.0526615, -0.0012886, -0.988573, 0.150736, -0.00137801, -0.96907, 0.246783, -0.00135131, -0.940309, 0.34032, -0.00129757, -0.902333, 0.431038, -0.00133688, -0.855857, 0.517211, -0.00129355, -0.800916, 0.598775, -0.00133248, -0.738331, 0.674437, -0.00134338, -0.668683, 0.743547, -0.00133971, -0.671447, 0.740927, -0.0136637, -0.592585, 0.805507, -0.00133969, -0.665282, 0.746468, 0.0136225, -0.665281, 0.746469, 0.0136239, -0.510332, 0.859976, 0.00134582, -0.0575442, -0.997046, 0.0508681, -0.15076, -0.98857, -0.000683601, -0.246726, -0.969085, -0.000663838, -0.340775, -0.940144, -0.00068864, -0.431207, -0.902253, -0.000680359, -0.517612, -0.855615, -0.000685699, -0.598599, -0.801049, -0.000638595, -0.674591, -0.738191, -0.000686076, -0.743689, -0.668526, -0.000684609, -0.805639, -0.592406, -0.000685253, -0.859808, -0.510617, -0.000681712, -0.905713, -0.423892, -0.000680768, -0.942967, -0.332886, -0.000703406, -0.971018, -0.239005, -0.000685408, -0.989772, -0.142656, -0.000688062, -0.998987, -0.0449826, -0.000684947, -0.998584, 0.0531876, -0.000688103, -0.98857, 0.15076, -0.000683145, -0.969037, 0.246913, -0.000681479, -0.940144, 0.340775, -0.000688974, -0.902253, 0.431207, -0.000680496, -0.855615, 0.517612, -0.000685504, -0.800799, 0.598933, -0.000679268, -0.738191, 0.674591, -0.000685845, -0.668526, 0.743689, -0.000684564, -0.592406, 0.805639, -0.000685332, -0.510501, 0.859877, 0.000685785, -0.00915122, -0.997891, 0.0642689, 0.0628185, -0.993654, 0.093309, 0.214684, -0.97636, 0.0251356, 0.410722, -0.911751, 0.00411636, 0.985985, -0.166833, 0.00101224, 0.983738, -0.173865, -0.0450543, 0.97808, -0.205823, -0.031569, 0.980162, -0.179363, -0.0843256, 0.967643, -0.227542, -0.109047, 0.982813, -0.175573, -0.0570348, 0.959748, -0.274444, -0.0597012, 0.941096, -0.30794, -0.139684, 0.921547, -0.377684, -0.090027, 0.900458, -0.409483, -0.146627, 0.843403, -0.521981, -0.127309, 0.858671, -0.50275, -0.099635, 0.764319, -0.638353, -0.0912247, 0.773538, -0.628975, -0.0776524, 0.657192, -0.75261, -0.0409436, 0.658946, -0.751128, -0.0399597, 0.862186, 0.505819, -0.0279708, 0.865403, 0.48519, -0.12517, 0.881746, 0.430052, -0.193856, 0.876014, 0.372187, -0.306719, 0.901436, 0.276551, -0.333066, 0.886091, 0.202062, -0.41715, 0.909889, 0.0632633, -0.41, 0.893857, 0.00925119, -0.448257, 0.90345, -0.15788, -0.398563, 0.8918, -0.187441, -0.411775, 0.860072, -0.39534, -0.322464, 0.838078, -0.433257, -0.331533, 0.73284, -0.654378, -0.186371, 0.700169, -0.688553, -0.188833, 0.973457, -0.185943, -0.133442, 0.982141, -0.176716, -0.0645823, 0.982309, -0.176456, -0.0627158, 0.107712, -0.633366, -0.766319, 0.061429, -0.65258, -0.755226, 0.188807, -0.636197, -0.748067, 0.0648894, -0.623001, -0.779525, 0.0618389, -0.649229, -0.758075, 0.154126, -0.662296, -0.733218, 0.252337, -0.659876, -0.707736, 0.273123, -0.640619, -0.717643, 0.34859, -0.661833, -0.663673, 0.355147, -0.656289, -0.665699, 0.441129, -0.658948, -0.609256, 0.435888, -0.65466, -0.617594, 0.432805, -0.673408, -0.599334, 0.528434, -0.64669, -0.550045, 0.430651, -0.68525, -0.587343, 0.520559, -0.573085, -0.632924, 0.608777, -0.621684, -0.492849, 0.573998, -0.676668, -0.461136, 0.059944, -0.664689, -0.744711, -0.0548545, -0.688916, -0.722763, 0.070345, -0.683673, -0.72639, 0.0609748, -0.656343, -0.751994, 0.0548244, -0.704593, -0.707491, 0.199444, -0.68402, -0.701669, 0.330916, -0.672879, -0.661611, 0.457199, -0.651406, -0.605507, 0.573517, -0.61543, -0.54067, 0.676462, -0.562549, -0.475328, -0.189783, -0.692046, -0.696459, -0.0327699, -0.6947, -0.718553, 0.134286, -0.697286, -0.704101, 0.308533, -0.681351, -0.663754, 0.47479, -0.64604, -0.597667, 0.623739, -0.587431, -0.515631, 0.747944, -0.50541, -0.430279, -0.312057, -0.66737, -0.676193, -0.129972, -0.684939, -0.716914, 0.0707804, -0.698138, -0.712456, 0.285762, -0.686182, -0.66895, 0.489959, -0.644014, -0.587526, 0.667274, -0.567749, -0.482086, 0.806112, -0.460652, -0.37146, -0.437543, -0.627203, -0.644339, -0.239042, -0.664467, -0.708055, -0.000610196, -0.692043, -0.721856, 0.264252, -0.685428, -0.678498, 0.503177, -0.644929, -0.575222, 0.704098, -0.557682, -0.439587, 0.851953, -0.430446, -0.298147, -0.51893, -0.553367, -0.651535, -0.30413, -0.611797, -0.730212, -0.0651855, -0.672684, -0.737053, 0.230028, -0.689761, -0.686525, 0.514615, -0.647361, -0.562223, 0.734802, -0.552418, -0.393573, 0.88568, -0.407949, -0.221695, -0.545158, -0.518053, -0.659108, -0.326157, -0.58608, -0.741709, -0.0551053, -0.648268, -0.759416, 0.205435, -0.694272, -0.68977, 0.482873, -0.675693, -0.557022, 0.718829, -0.584241, -0.376758, 0.880251, -0.434822, -0.189971, -0.038725, 0.976391, -0.212512, 0.03989, 0.806987, -0.589221, 0.146863, 0.571557, -0.807313, 0.284876, 0.242335, -0.927426, 0.393391, 0.0194442, -0.919166, 0.40896, -0.0551167, -0.910886, 0.520559, -0.573085, -0.632924, 0.443453, -0.302743, -0.843621, 0.573998, -0.676668, -0.461136, 0.633704, -0.671195, -0.384599, 0.510417, -0.859927, 0, 0.574227, -0.818331, 0.0244367, 0.517083, -0.855899, -0.0079206, 0.586389, -0.809988, 0.00815618, 0.592019, -0.805924, 0, 0.651523, -0.758241, 0.0242717, 0.662821, -0.748736, 0.0079848, 0.668296, -0.743896, 0, 0.722899, -0.690518, 0.0245394, 0.733213, -0.679949, 0.0082508, 0.738477, -0.674279, 0, 0.787012, -0.616455, 0.0243852, 0.796234, -0.604935, 0.00810433, 0.800983, -0.598687, -1.74254e-06, 0.843682, -0.536285, 0.0244596, 0.851732, -0.523914, 0.00817589, 0.855386, -0.517991, 0, 0.902362, -0.43098, 0, 0.866597, -0.498412, -0.024403, 0.898977, -0.43792, 0.0081631, 0.940068, -0.340987, 1.52473e-06, 0.911272, -0.41108, -0.0244196, 0.937578, -0.347679, 0.00817626, 0.963029, -0.268284, 0.0244571, 0.967142, -0.254107, 0.00817281, 0.969015, -0.247004, -3.0991e-06, 0.984679, -0.172659, 0.0243994, 0.987382, -0.158147, 0.00812025, 0.988595, -0.150599, 0, 0.996865, -0.0752492, 0.0244539, 0.998132, -0.06055, 0.00817343, 0.998584, -0.0531989, 0, 0.998987, 0.0449996, 0, 0.999261, 0.0375572, 0.00816222, 0.99922, -0.0310556, -0.0244085, 0.992384, 0.120722, 0.0245097, 0.990757, 0.135396, 0.00822497, 0.989781, 0.142597, 0, 0.971047, 0.238887, 0, 0.972712, 0.23187, 0.00824151, 0.986069, 0.164546, -0.0243538, 0.945357, 0.325936, 0.00807892, 0.942861, 0.333187, 0, 0.949813, 0.311869, 0.0243623, 0.90877, 0.417215, 0.00826854, 0.935077, 0.353597, -0.0244997, 0.905653, 0.424019, 0, 0.905653, 0.424019, 0, 0.863514, 0.504258, 0.00825104, 0.905649, 0.424029, 0, 0.85977, 0.510682, 0, 0.905649, 0.424029, 0, 0.870633, 0.49132, 0.0245336, 0.810048, 0.586308, 0.00805858, 0.805711, 0.592309, 0, 0.818392, 0.574145, 0.0243404, 0.7486, 0.662972, 0.0081805, 0.743801, 0.668401, 0, 0.758101, 0.651679, 0.0244597, 0.679948, 0.733214, 0.00825033, 0.674433, 0.738336, 0, 0.690518, 0.722899, 0.0245394, 0.65783, 0.752773, -0.024331, 0.599087, 0.800684, 0, 0.604979, 0.796201, 0.00804748, 0.517302, 0.855803, 0, 0.581066, 0.813486, -0.0245296, 0.524002, 0.851679, 0.0080841, 0.43102, 0.902342, 0, 0.498492, 0.866548, -0.0244994, 0.437945, 0.898965, 0.00812599, 0.361385, 0.932096, 0.0244597, 0.347681, 0.937577, 0.00817842, 0.340811, 0.940132, 0, 0.268333, 0.963017, 0.0244153, 0.254157, 0.967129, 0.00812562, 0.247192, 0.968967, 0, 0.172642, 0.984682, 0.0244111, 0.158135, 0.987384, 0.00813207, 0.150893, 0.98855, 0, 0.0752989, 0.996861, 0.0244464, 0.0605711, 0.998131, 0.00815482, 0.0534983, 0.998568, 0, -0.0449996, 0.998987, 0, 0.0310366, 0.99922, -0.0244304, -0.0375559, 0.999261, 0.00814713, -0.142696, 0.989767, 0, -0.0670072, 0.997454, -0.0244263, -0.135313, 0.990769, 0.00815165, -0.238793, 0.97107, 0, -0.164462, 0.986081, -0.0244345, -0.231787, 0.972732, 0.0081575, -0.311951, 0.949784, 0.02445, -0.326022, 0.945327, 0.00816553, -0.332914, 0.942957, 0, -0.332925, 0.942953, 0, -0.423784, 0.905764, 0, -0.417091, 0.908828, 0.00814764, -0.353691, 0.935044, -0.0244125, -0.51049, 0.859883, 0, -0.504147, 0.863579, 0.00813391, -0.443616, 0.895884, -0.0244349, 0.4307, -0.90246, -0.00790794, 0.424188, -0.905574, 0, 0.443859, -0.89577, -0.0241939, 0.333395, -0.942787, 0, 0.403763, -0.914531, 0.02467, 0.339656, -0.940512, -0.00840455, 0.238792, -0.971071, 0, 0.31166, -0.949886, 0.0241745, 0.246052, -0.969222, -0.00820068, 0.153873, -0.988018, -0.0119454, 0.142694, -0.989767, 0, 0.0449993, -0.998987, 0, 0.120942, -0.992352, 0.0247041, 0.0522369, -0.998601, -0.0082072, -0.0309811, -0.999224, -0.0243416, -0.0457383, -0.998921, -0.00805411, -0.0533982, -0.998573, 0, -0.128813, -0.991369, -0.0243755, -0.143465, -0.989622, -0.00809941, -0.150697, -0.98858, 0, -0.225525, -0.973928, -0.0245379, -0.239943, -0.970752, -0.00824968, -0.247193, -0.968966, 0, -0.340692, -0.940175, 0, -0.268425, -0.962993, 0.0243312, -0.333779, -0.942617, -0.00809454, -0.431102, -0.902303, 0, -0.424662, -0.905315, -0.00819191, -0.411141, -0.911243, -0.0244801, -0.517992, -0.855386, 0, -0.451083, -0.892149, 0.0243884, -0.511143, -0.859459, -0.00796729, -0.598977, -0.800767, 0, -0.53614, -0.84377, 0.0246023, -0.593112, -0.805078, -0.00819592, -0.674696, -0.738096, 0, -0.616456, -0.787011, 0.0243872, -0.66921, -0.743027, -0.0082368, -0.743801, -0.668401, 0, -0.690666, -0.722764, 0.0243378, -0.738797, -0.673878, -0.0082138, -0.805748, -0.592259, 0, -0.758173, -0.651598, 0.0243659, -0.801228, -0.598305, -0.00811528, -0.859813, -0.510609, 0, -0.818324, -0.574237, 0.0244621, -0.855951, -0.516995, -0.00801331, -0.905669, -0.423985, 0, -0.87062, -0.491342, 0.0245749, -0.902573, -0.430459, -0.00814566, -0.940403, -0.339966, -0.00810598, -0.942924, -0.333008, 0, -0.935032, -0.353722, -0.0243931, -0.969227, -0.246032, -0.00821749, -0.971042, -0.23891, 0, -0.965232, -0.260243, -0.0245063, -0.988663, -0.149928, -0.00814836, -0.989781, -0.142597, 0, -0.986082, -0.164456, -0.0244284, -0.998991, -0.0448995, 1.35534e-06, -0.992395, -0.120645, 0.0244335, -0.998591, -0.0524524, -0.00800986, -0.998913, 0.0458843, -0.00819058, -0.998579, 0.0532989, 0, -0.999216, 0.0311298, -0.0244758, -0.989622, 0.143469, -0.0080948, -0.988565, 0.150795, 1.57436e-06, -0.99137, 0.128808, -0.0243818, -0.973962, 0.225394, -0.024393, -0.970788, 0.2398, -0.00812176, -0.969015, 0.247004, 0, -0.947129, 0.319913, -0.0245548, -0.942553, 0.333954, -0.00826699, -0.9401, 0.3409, 0, -0.911212, 0.411206, -0.024536, -0.905286, 0.424722, -0.00825407, -0.902264, 0.431184, 0, -0.866597, 0.498412, -0.024403, -0.859375, 0.51128, -0.00812278, -0.855617, 0.51761, 0, -0.81344, 0.581128, -0.0246052, -0.81344, 0.581128, -0.0246043, -0.800767, 0.598976, 0, -0.786915, 0.616584, 0.0242545, -0.738096, 0.674696, 0, -0.786919, 0.61658, 0.0242487, -0.743174, 0.669049, -0.00804461, -0.684641, 0.728473, -0.0243487, -0.673995, 0.738692, -0.00806855, -0.668611, 0.743612, 0, -0.592372, 0.805664, 0, -0.651723, 0.758061, 0.0245086, -0.598354, 0.801192, -0.00806333, -0.51049, 0.859883, 0, -0.574288, 0.818286, 0.0245151, -0.504147, 0.863579, 0.00813391, 0.592375, -0.805662, 0, 0.51049, -0.859884, 0, 0.668506, -0.743707, 0, 0.738478, -0.674278, 0, 0.80103, -0.598625, -3.04943e-06, 0.855315, -0.518109, -4.87908e-06, 0.902361, -0.430981, 3.04944e-06, 0.940132, -0.340811, 6.09898e-06, 0.969014, -0.247004, -4.06601e-06, 0.988565, -0.150794, -4.87922e-06, 0.998584, -0.0531986, 0, 0.998991, 0.0448998, 0, 0.989781, 0.142598, 0, 0.971019, 0.239004, 0, 0.942924, 0.333008, 0, 0.905653, 0.424019, 0, 0.905764, 0.423783, 0, 0.905649, 0.424029, 0, 0.859883, 0.510491, 0, 0.805662, 0.592375, 0, 0.743707, 0.668506, 0, 0.674591, 0.738191, 0, 0.599025, 0.80073, 0, 0.517302, 0.855803, 0, 0.430979, 0.902362, 0, 0.340813, 0.940131, 0, 0.247004, 0.969014, 0, 0.150793, 0.988565, 0, 0.0531983, 0.998584, 0, -0.0449, 0.998991, 0, -0.142598, 0.989781, 0, -0.239004, 0.971019, 0, -0.333007, 0.942924, 0, -0.332914, 0.942957, 0, -0.423785, 0.905763, 0, -0.332925, 0.942953, 0, -0.510491, 0.859883, 0, 0.423377, -0.905954, 0, 0.332711, -0.943029, 0, 0.239005, -0.971018, 0, 0.142597, -0.989781, 0, 0.0448993, -0.998991, 0, -0.0531999, -0.998584, 0, -0.150795, -0.988565, 0, -0.247004, -0.969015, 0, -0.340811, -0.940132, 0, -0.431303, -0.902207, 0, -0.517684, -0.855572, 0, -0.599023, -0.800732, 0, -0.674592, -0.738191, 0, -0.743707, -0.668506, 0, -0.805665, -0.592372, 0, -0.859884, -0.51049, 0, -0.905764, -0.423783, 0, -0.942924, -0.333009, 0, -0.971018, -0.239005, 0, -0.989781, -0.142597, 0, -0.998991, -0.0448993, 4.06602e-06, -0.998584, 0.0531995, 2.43961e-06, -0.988565, 0.150796, 0, -0.969015, 0.247003, 0, -0.940132, 0.340811, 0, -0.902207, 0.431303, 0, -0.855572, 0.517684, 0, -0.800732, 0.599023, 0, -0.738191, 0.674592, 0, -0.668506, 0.743707, 0, -0.592372, 0.805664, 0, -0.510491, 0.859883, 0, 1, -0.000790463, 0, 0.999987, -0.000765791, -0.00510445, 0.997121, 0.00303727, -0.0757673, 0.994764, -0.000986653, -0.102192, 0.997637, -0.0038621, -0.0686011, 0.999987, -0.000201417, 0.00504701, 0.997123, 0.00400224, 0.0757014, 0.994764, 0.000210509, 0.102198, 0.997637, -0.00407005, 0.0685856, 0.99961, -0.00385392, 0.0276741, 0.9989, 0.00371788, -0.0467338, 0.993158, 0.0030939, -0.116734, 0.986057, 0.0036598, -0.166365, 0.98147, 0.00258286, -0.191599, 0.982161, -0.00461139, -0.187985, 0.987819, -0.0068501, -0.155456, 0.994937, -0.00666674, -0.100283, 0.999599, -0.000558294, -0.028317, 0.998901, 0.00304002, 0.0467617, 0.993172, 0.00403293, 0.116587, 0.986084, 0.00446552, 0.166188, 0.981463, 0.000756877, 0.19165, 0.982172, -0.00308635, 0.187959, 0.987793, -0.00468726, 0.155704, 0.994904, -0.00384049, 0.100759, 0.999041, -0.00404688, 0.0435933, 0.997281, 0.00115188, -0.0736863, 0.984174, 0.00840624, -0.177006, 0.967745, 0.011441, -0.251674, 0.957296, 0.00437348, -0.289076, 0.958852, -0.00322539, -0.283887, 0.971512, -0.00798618, -0.236854, 0.988145, -0.00694741, -0.153365, 0.998948, 0.00310652, -0.0457535, 0.99731, 0.00267094, 0.073246, 0.984215, 0.00952957, 0.176723, 0.967751, 0.0116825, 0.251638, 0.957283, 0.00292973, 0.289137, 0.958919, -0.00571832, 0.283622, 0.971535, -0.00865407, 0.236739, 0.988118, -0.0060573, 0.153579, 0.999819, -0.00597553, 0.0180834, 0.99829, 0.00544262, -0.0582016, 0.991191, 0.0110452, -0.131982, 0.979903, 0.0246098, -0.197949, 0.966054, 0.028132, -0.256803, 0.951439, 0.0264737, -0.306698, 0.938866, 0.0205833, -0.343667, 0.929756, 0.0139499, -0.367912, 0.925627, 0.00334279, -0.378423, 0.927035, -0.0104273, -0.37483, 0.933775, -0.0209398, -0.357247, 0.945025, -0.02705, -0.325877, 0.958598, -0.0284903, -0.283335, 0.973279, -0.0270825, -0.228023, 0.985928, -0.0185676, -0.166138, 0.995361, -0.00668611, -0.0959761, 0.999802, -0.00168074, -0.0198403, 0.998251, 0.00339743, 0.0590269, 0.991147, 0.00995269, 0.132398, 0.979896, 0.0243942, 0.19801, 0.966074, 0.0280944, 0.256734, 0.951432, 0.0264731, 0.306718, 0.939, 0.0243647, 0.343052, 0.929826, 0.0157355, 0.367662, 0.92562, 0.00198659, 0.37845, 0.92704, -0.0110477, 0.374799, 0.933775, -0.0209473, 0.357246, 0.945025, -0.0270471, 0.325878, 0.957908, -0.0153101, 0.286666, 0.958905, -0.0349773, 0.281562, 0.973136, -0.0245975, 0.228911, 0.958951, -0.0361253, 0.281261, 0.985902, -0.018001, 0.166355, 0.995366, -0.00683537, 0.0959171, 0.999679, -0.0199572, 0.0156302, 0.999646, -0.0224506, 0.0142957, 0.997251, 0.00919586, -0.073521, 0.985926, 0.0250385, -0.165295, 0.967812, 0.0383313, -0.248739, 0.945324, 0.0408928, -0.323558, 0.922676, 0.0422905, -0.383249, 0.902486, 0.0308165, -0.429615, 0.888399, 0.0205271, -0.458614, 0.881834, -0.00124924, -0.471558, 0.884191, -0.0174412, -0.466799, 0.894659, -0.0276213, -0.445896, 0.911966, -0.0368286, -0.408609, 0.933983, -0.0438051, -0.354621, 0.956984, -0.0419571, -0.28709, 0.977559, -0.0317887, -0.208252, 0.992624, -0.0177438, -0.119931, 0.999687, -0.00269937, -0.0248635, 0.997319, 0.0116077, 0.0722491, 0.986028, 0.0262239, 0.164503, 0.968069, 0.0418836, 0.247162, 0.945778, 0.0467056, 0.321438, 0.922777, 0.0431004, 0.382916, 0.902699, 0.0336626, 0.428954, 0.888315, 0.0186844, 0.458854, 0.881908, 0.00145585, 0.471419, 0.884016, -0.00901304, 0.467369, 0.881908, 0.0014817, 0.471419, 0.894632, -0.0267421, 0.446003, 0.91204, -0.0376449, 0.408371, 0.933889, -0.042957, 0.354974, 0.958562, -0.0273473, 0.283568, 0.958912, -0.035193, 0.281514, 0.95701, -0.0422888, 0.286955, 0.977552, -0.0316971, 0.208295, 0.992565, -0.0161457, 0.12064, 0.999395, 0.0119064, 0.0326761, 0.999419, 0.0110826, 0.0322361, 0.999584, -0.00978653, 0.027135, 0.999648, -0.0223347, 0.014357, 0.995781, 0.0149788, -0.0905356, 0.979071, 0.0443311, -0.198632, 0.952082, 0.0657224, -0.298699, 0.918287, 0.0696088, -0.389747, 0.884082, 0.0653031, -0.462747, 0.854671, 0.0560381, -0.516137, 0.833512, 0.0383131, -0.551171, 0.823771, 0.0139346, -0.566752, 0.82664, -0.0115217, -0.562614, 0.842327, -0.0405634, -0.537438, 0.867666, -0.0533787, -0.494274, 0.899858, -0.059764, -0.43207, 0.868684, -0.063504, -0.49128, 0.935003, -0.0635439, -0.348899, 0.966159, -0.0514127, -0.252772, 0.988602, -0.0258377, -0.148319, 0.999537, -0.00555668, -0.0299249, 0.995802, 0.015461, 0.0902179, 0.978964, 0.0429587, 0.199462, 0.951717, 0.0620508, 0.300641, 0.918025, 0.0674735, 0.39074, 0.884176, 0.0658613, 0.462487, 0.85465, 0.0557797, 0.5162, 0.833413, 0.035082, 0.551536, 0.823725, 0.00740823, 0.566942, 0.881948, 0.00823049, 0.471275, 0.833321, 0.0332216, 0.55179, 0.827023, -0.0233063, 0.561684, 0.881948, 0.00832127, 0.471273, 0.842766, -0.0465992, 0.53626, 0.868498, -0.0615136, 0.49186, 0.900376, -0.063972, 0.430384, 0.934494, -0.059263, 0.351011, 0.965428, -0.044652, 0.256816, 0.988601, -0.0258224, 0.148329, 0.999399, 0.0117834, 0.0326123, 0.999979, -0.00535843, -0.00356972, 0.998178, 0.0424304, -0.0428958, 0.992866, 0.0857206, -0.0828764, 0.984221, 0.116739, -0.132968, 0.972756, 0.147028, -0.179245, 0.957271, 0.197595, -0.211159, 0.941434, 0.205119, -0.267634, 0.921059, 0.252847, -0.296173, 0.90301, 0.240708, -0.355855, 0.881135, 0.270513, -0.387845, 0.857609, 0.308601, -0.411427, 0.840836, 0.276589, -0.465288, 0.824449, 0.257953, -0.503731, 0.806953, 0.26189, -0.529378, 0.800624, 0.187643, -0.569027, 0.793989, 0.147023, -0.589886, 0.796114, -0.00352553, -0.605136, 0.793676, -0.151393, -0.589202, 0.800009, -0.191783, -0.568511, 0.806645, -0.26659, -0.527497, 0.820452, -0.29117, -0.492016, 0.841656, -0.271563, -0.466763, 0.867589, -0.0527035, -0.494482, 0.867492, -0.0517839, -0.494749, 0.860798, -0.27492, -0.428305, 0.878822, -0.298657, -0.372124, 0.869597, -0.0736381, -0.48824, 0.892645, -0.0633172, -0.446292, 0.896493, -0.0906141, -0.433692, 0.921279, -0.253251, -0.295141, 0.896457, -0.0903258, -0.433827, 0.940333, -0.224661, -0.255542, 0.958319, -0.176938, -0.224318, 0.972189, -0.160115, -0.170918, 0.98448, -0.111555, -0.135482, 0.990796, -0.0176723, -0.134203, 0.992135, -0.0379339, -0.119285, 0.998243, -0.0406813, -0.0430768, 0.992151, -0.0382571, -0.119047, 0.999999, 0.00107071, -0.00131669, 0.998206, 0.0396175, 0.0448922, 0.993021, 0.0764125, 0.0898395, 0.983977, 0.126065, 0.126082, 0.972214, 0.163554, 0.167482, 0.95795, 0.181953, 0.221865, 0.941435, 0.205102, 0.267644, 0.921058, 0.252855, 0.296168, 0.903847, 0.211309, 0.372033, 0.878781, 0.296541, 0.373909, 0.86115, 0.272652, 0.429048, 0.83776, 0.30501, 0.452909, 0.824445, 0.257995, 0.503716, 0.83314, 0.029749, 0.552261, 0.806753, 0.262023, 0.529616, 0.834223, 0.056062, 0.54857, 0.832949, 0.0262349, 0.552727, 0.800666, 0.187088, 0.56915, 0.793992, 0.146994, 0.58989, 0.832797, 0.023528, 0.553078, 0.796125, -0.000206052, 0.605132, 0.795413, -0.127962, 0.592406, 0.797988, -0.213883, 0.563444, 0.810385, -0.231308, 0.538305, 0.820452, -0.291169, 0.492016, 0.841575, -0.271787, 0.466779, 0.860707, -0.275109, 0.428366, 0.87892, -0.298423, 0.372081, 0.903022, -0.235294, 0.359427, 0.922915, -0.224779, 0.312574, 0.9412, -0.205906, 0.267853, 0.957579, -0.195932, 0.211314, 0.972574, -0.147424, 0.179906, 0.984201, -0.123547, 0.126828, 0.99285, -0.0830459, 0.0857442, 0.998264, -0.0352779, 0.0471661, 0.984537, 0.175175, 0, 0.999997, -0.00229525, 0, 0.993742, 0.111702, 0, 0.874059, 0.485819, 0, 0.950605, 0.310402, 0, 0.888268, 0.459326, 0, 0.775173, 0.631749, 0, 0.550328, 0.834948, 0, 0.688137, 0.725581, 0, 0.202931, 0.979193, 0, 0.49482, 0.868995, 0, 0.323145, 0.946349, 0, -0.16609, 0.986111, 0, 0.206293, 0.97849, 0, 0.0304761, 0.999536, 0, -0.568722, 0.822529, 0, -0.240273, 0.970706, 0, -0.349337, 0.936997, 0, -0.823853, 0.566803, 0, -0.599471, 0.800397, 0, -0.714592, 0.699542, 0, -0.969428, 0.245376, 0, -0.88728, 0.461232, 0, -0.96472, 0.263278, 0, -0.99746, 0.0712363, 0, -0.994594, -0.10384, 0, -0.985169, -0.171588, 0, -0.922922, -0.384987, 0, -0.89748, -0.441055, 0, -0.775606, -0.631218, 0, -0.710408, -0.70379, 0, -0.68585, -0.727743, 0, -0.426128, -0.904663, 0, -0.377479, -0.926018, 0, -0.37844, -0.925626, 0, -0.042803, -0.999084, 0, 0.0691205, -0.997608, 0, -0.00762068, -0.999971, 0, 0.350845, -0.936434, 0, 0.444143, -0.895956, 0, 0.379003, -0.925395, 0, 0.651862, -0.758337, 0, 0.719178, -0.694826, 0, 0.729904, -0.68355, 0, 0.870172, -0.492747, 0, 0.943613, -0.331051, 0, 0.924119, -0.382104, 0, 0.984693, -0.174296, 0, 0.994073, 0.108718, 0, 0.999216, -0.0395953, 0, 0.989587, 0.143933, 0, 0.874321, 0.485349, 0, 0.947118, 0.320886, 0, 0.862391, 0.506242, 0, 0.625808, 0.779977, 0, 0.787362, 0.616491, 0, 0.632605, 0.774474, 0, 0.224073, 0.974572, 0, 0.523135, 0.85225, 0, 0.407667, 0.91313, 0, 0.196728, 0.980458, 0, -0.192632, 0.981271, 0, -0.0658707, 0.997828, 0, -0.501674, 0.865057, 0, -0.232974, 0.972483, 0, -0.439338, 0.898322, 0, -0.784514, 0.620111, 0, -0.611125, 0.791534, 0, -0.773604, 0.633669, 0, -0.954385, 0.298579, 0, -0.906763, 0.421641, 0, -0.980032, 0.198842, 0, -0.999989, -0.00464702, 0, -0.998207, -0.0598608, 0, -0.975224, -0.221218, 0, -0.937292, -0.348546, 0, -0.865407, -0.50107, 0, -0.76077, -0.649022, 0, -0.723587, -0.690233, 0, -0.54661, -0.837387, 0, -0.42613, -0.904662, 0, -0.429169, -0.903224, 0, -0.288868, -0.957369, 0, -0.0516375, -0.998666, 0, -0.113706, -0.993514, 0, 0.237116, -0.971481, 0, 0.332919, -0.942956, 0, 0.325017, -0.945708, 0, 0.532836, -0.846218, 0, 0.63869, -0.769464, 0, 0.673366, -0.739309, 0, 0.779674, -0.626185, 0, 0.866145, -0.499793, 0, 0.936489, -0.350696, 0, 0.941264, -0.33767, 0, 0.984693, -0.174297, 0, 0.817877, 0.575393, 0, -0.29828, -0.954478, 0, 0.13016, -0.991493, 0, 0.851882, -0.484841, -0.198058, 0.86254, -0.456019, -0.219254, 0.49932, -0.866417, 0, 0.987824, -0.151876, -0.0337407, 0.987882, -0.151417, -0.0340919, 0.991032, -0.120627, -0.0574905, 0.310008, 0.950734, 0, -0.816372, 0.577526, 0, -0.813825, 0.572172, -0.101525, -0.818106, 0.571624, -0.0628375, -0.811209, 0.579199, -0.0804274, -0.815748, 0.578277, -0.0122721, -0.817635, 0.572291, 0.0629032, -0.812046, 0.574688, 0.101563, -0.810308, 0.580473, 0.0803293, -0.815741, 0.578287, 0.0122708, -0.812859, 0.563746, -0.146462, -0.818521, 0.567767, -0.0875453, -0.804115, 0.565232, -0.184151, -0.799803, 0.568377, -0.193037, -0.800063, 0.574573, -0.172526, -0.804481, 0.580332, -0.126592, -0.812378, 0.580019, -0.0601678, -0.817243, 0.576121, 0.0141213, -0.819443, 0.566478, 0.0872675, -0.812517, 0.564176, 0.146701, -0.806328, 0.562091, 0.184089, -0.801156, 0.566456, 0.19307, -0.800897, 0.573354, 0.172713, -0.804471, 0.580351, 0.126566, -0.812135, 0.580386, 0.0599083, -0.816766, 0.576797, -0.0141077, -0.816654, 0.561563, -0.133131, -0.805913, 0.548741, -0.222236, -0.790114, 0.546289, -0.278007, -0.779434, 0.554635, -0.291312, -0.780228, 0.568375, -0.261141, -0.791782, 0.579987, -0.191564, -0.807677, 0.582378, -0.0921655, -0.818424, 0.574196, 0.0219225, -0.818238, 0.559422, 0.132412, -0.807023, 0.547181, 0.222052, -0.791873, 0.543992, 0.277506, -0.779805, 0.554106, 0.291325, -0.778752, 0.570555, 0.260793, -0.790808, 0.581452, 0.191145, -0.807711, 0.582327, 0.0921833, -0.8183, 0.574377, -0.0218069, -0.814228, 0.543023, -0.205327, -0.805661, 0.530549, -0.263491, -0.791804, 0.525364, -0.311511, -0.780561, 0.519832, -0.34713, -0.766324, 0.52531, -0.369861, -0.757188, 0.532245, -0.378658, -0.75122, 0.544251, -0.373442, -0.750153, 0.559021, -0.353222, -0.757092, 0.568828, -0.321319, -0.76562, 0.581633, -0.274827, -0.778571, 0.587983, -0.219324, -0.79435, 0.587419, -0.154747, -0.805096, 0.587257, -0.0833603, -0.816409, 0.577407, -0.00883242, -0.820883, 0.567303, 0.0657158, -0.822799, 0.551431, 0.137573, -0.81587, 0.540895, 0.204422, -0.803676, 0.5331, 0.264403, -0.792799, 0.524076, 0.311151, -0.776857, 0.524843, 0.347899, -0.765935, 0.525766, 0.370019, -0.755316, 0.534716, 0.378915, -0.752531, 0.542336, 0.37359, -0.753099, 0.554545, 0.354009, -0.756928, 0.569081, 0.321257, -0.765607, 0.58153, 0.275079, -0.778372, 0.588292, 0.219205, -0.792968, 0.589527, 0.153817, -0.805905, 0.586065, 0.0839325, -0.816745, 0.576928, 0.00907173, -0.820923, 0.567226, -0.0658712, -0.820888, 0.553972, -0.138772, -0.803063, 0.533984, -0.264484, -0.796444, 0.506275, -0.3307, -0.811682, 0.523666, -0.258739, -0.776865, 0.494812, -0.389412, -0.756631, 0.489679, -0.43327, -0.734439, 0.497838, -0.461255, -0.721134, 0.507439, -0.471668, -0.716311, 0.519908, -0.465396, -0.715543, 0.54112, -0.4418, -0.72629, 0.556809, -0.403071, -0.742537, 0.572233, -0.348121, -0.760896, 0.586498, -0.277593, -0.782772, 0.590353, -0.196856, -0.801308, 0.58876, -0.106149, -0.816161, 0.577706, -0.0117474, -0.824827, 0.559419, 0.0819148, -0.823823, 0.539768, 0.173109, -0.817999, 0.5159, 0.25441, -0.81167, 0.523681, 0.258747, -0.80302, 0.534034, 0.264512, -0.793214, 0.510181, 0.332457, -0.775091, 0.496927, 0.390253, -0.751335, 0.496527, 0.434692, -0.734543, 0.497513, 0.461441, -0.718781, 0.510666, 0.471778, -0.714368, 0.522686, 0.465271, -0.715818, 0.540513, 0.442097, -0.721128, 0.565343, 0.400452, -0.730281, 0.550191, 0.404944, -0.740552, 0.575594, 0.346806, -0.721094, 0.565402, 0.400429, -0.758953, 0.589608, 0.276321, -0.781469, 0.592427, 0.195799, -0.802097, 0.5875, 0.10717, -0.815991, 0.577948, 0.0115892, -0.824841, 0.5594, -0.0819025, -0.822307, 0.541691, -0.174305, -0.819609, 0.51389, -0.253293, -0.821814, 0.511118, -0.251752, -0.807827, 0.497896, -0.31546, -0.785183, 0.471744, -0.401179, -0.805387, 0.53123, -0.262958, -0.752937, 0.458088, -0.472484, -0.720224, 0.454524, -0.524105, -0.693154, 0.459259, -0.555535, -0.673011, 0.474411, -0.567442, -0.661109, 0.500045, -0.559365, -0.662371, 0.527831, -0.531658, -0.676303, 0.554934, -0.48442, -0.701002, 0.576486, -0.419834, -0.730381, 0.594592, -0.336162, -0.770867, 0.586752, -0.247963, -0.795122, 0.591924, -0.131934, -0.755207, 0.6142, -0.228957, -0.816871, 0.576591, -0.0162726, -0.825277, 0.555295, 0.10279, -0.821616, 0.527747, 0.215479, -0.820064, 0.513319, 0.252981, -0.812953, 0.522119, 0.257875, -0.807708, 0.497985, 0.315624, -0.788233, 0.468293, 0.399238, -0.800181, 0.53736, 0.266374, -0.799278, 0.538411, 0.26696, -0.758205, 0.45224, 0.469686, -0.72678, 0.446585, 0.521875, -0.696878, 0.454358, 0.554905, -0.676849, 0.46885, 0.567499, -0.665302, 0.493633, 0.560089, -0.6662, 0.521542, 0.533078, -0.679134, 0.549898, 0.486199, -0.663486, 0.526065, 0.532017, -0.725662, 0.557902, 0.40269, -0.721573, 0.564617, 0.400675, -0.702689, 0.573353, 0.421301, -0.73287, 0.590207, 0.338462, -0.76325, 0.600552, 0.2383, -0.792618, 0.595962, 0.128785, -0.814411, 0.580143, 0.0129886, -0.824004, 0.556885, -0.104385, -0.82265, 0.526535, -0.214494, -0.817407, 0.516634, -0.254824, -0.89923, 0.348534, -0.264405, -0.897332, 0.31698, -0.307114, -0.876028, 0.315479, -0.364756, -0.878371, 0.272663, -0.392581, -0.862804, 0.260171, -0.433452, -0.825371, 0.285225, -0.487246, -0.807259, 0.281472, -0.518754, -0.756369, 0.334931, -0.561897, -0.733309, 0.350548, -0.582558, -0.712555, 0.368849, -0.596838, -0.669109, 0.431475, -0.60508, -0.622016, 0.505501, -0.597967, -0.57553, 0.582685, -0.573798, -0.559628, 0.624532, -0.544771, -0.532391, 0.684115, -0.498545, -0.549999, 0.692234, -0.46724, -0.535731, 0.739548, -0.407506, -0.552263, 0.751352, -0.361214, -0.597869, 0.726508, -0.338731, -0.612266, 0.738789, -0.281641, -0.645906, 0.723402, -0.243916, -0.768879, 0.590381, -0.245508, -0.688917, 0.692786, -0.213171, -0.765609, 0.596262, -0.241483, -0.711545, 0.683849, -0.161413, -0.752127, 0.619298, -0.225333, -0.74876, 0.650776, -0.125896, -0.755868, 0.613091, -0.229746, -0.778874, 0.621338, -0.0854103, -0.797405, 0.602697, -0.0300222, -0.820992, 0.570775, 0.0136848, -0.844374, 0.532894, 0.055284, -0.862849, 0.496119, 0.0967365, -0.872814, 0.46551, 0.146615, -0.889561, 0.41967, 0.18044, -0.888276, 0.395521, 0.233514, -0.911617, 0.32741, 0.248511, -0.886165, 0.335032, 0.320101, -0.875976, 0.315562, 0.36481, -0.878323, 0.272691, 0.39267, -0.845825, 0.288725, 0.448573, -0.836498, 0.2664, 0.478854, -0.791787, 0.306732, 0.528194, -0.763781, 0.323243, 0.558706, -0.732978, 0.350986, 0.582712, -0.712447, 0.369024, 0.596858, -0.651958, 0.456888, 0.605148, -0.647386, 0.463481, 0.605042, -0.635589, 0.480085, 0.604603, -0.615255, 0.514734, 0.597085, -0.582502, 0.573488, 0.576023, -0.674733, 0.507005, 0.536359, -0.667091, 0.520036, 0.533434, -0.542846, 0.645573, 0.537171, -0.66722, 0.519819, 0.533484, -0.547036, 0.665971, 0.507183, -0.529151, 0.717334, 0.453244, -0.657692, 0.535549, 0.529744, -0.535677, 0.739609, 0.407465, -0.552007, 0.751446, 0.361409, -0.597849, 0.726533, 0.338712, -0.612238, 0.738822, 0.281614, -0.656947, 0.709219, 0.25579, -0.678001, 0.707002, 0.201155, -0.711413, 0.683959, 0.161531, -0.748925, 0.650633, 0.125648, -0.776947, 0.624164, 0.0822951, -0.79981, 0.599363, 0.0326827, -0.822189, 0.569092, -0.0117948, -0.842659, 0.535364, -0.057554, -0.862909, 0.49598, -0.0969124, -0.872579, 0.465909, -0.146749, -0.889577, 0.419645, -0.180419, -0.888254, 0.395438, -0.233738, -0.835915, -0.548859, 0, -0.665101, -0.746753, 0, -0.857894, -0.513827, 0, -0.664884, -0.746947, 0, -0.362038, -0.932164, 0, -0.509609, -0.860406, 0, -0.00449539, -0.99999, 0, -0.366313, -0.930492, 0, -0.259011, -0.965874, 0, 0.389882, -0.920865, 0, 0.0241014, -0.99971, 0, 0.158675, -0.987331, 0, 0.685334, -0.728229, 0, 0.466003, -0.884783, 0, 0.69287, -0.721063, 0, 0.866696, -0.498837, 0, 0.894242, -0.447585, 0, 0.964061, -0.265679, 0, 0.999021, -0.0442275, 0, 0.99389, -0.110379, 0, 0.978248, 0.207439, 0, 0.930952, 0.36514, 0, 0.969203, 0.246264, 0, 0.811697, 0.584079, 0, 0.850589, 0.525832, 0, 0.814912, 0.579584, 0, 0.570249, 0.821472, 0, 0.477085, 0.878857, 0, 0.539443, 0.842022, 0, 0.236351, 0.971668, 0, 0.127971, 0.991778, 0, 0.170102, 0.985426, 0, -0.11622, 0.993223, 0, -0.228869, 0.973457, 0, -0.182127, 0.983275, 0, -0.444518, 0.89577, 0, -0.568932, 0.822384, 0, -0.610367, 0.792119, 0, -0.743118, 0.669161, 0, -0.885117, 0.465369, 0, -0.838392, 0.545067, 0, -0.918514, 0.395389, 0, -0.99999, 0.00454488, 0, -0.975543, 0.219808, 0, -0.997522, 0.070348, 0, -0.909664, -0.415345, 0, -0.98938, -0.145349, 0, -0.964367, -0.264568, 0, -0.858464, -0.512873, 0, -0.693245, -0.720702, 0, -0.781497, -0.62391, 0, -0.379585, -0.925157, 0, -0.684132, -0.729359, 0, -0.595478, -0.803372, 0, -0.354808, -0.934939, 0, 0.00578841, -0.999983, 0, -0.155346, -0.98786, 0, 0.296559, -0.955014, 0, 0.0320092, -0.999488, 0, 0.254907, -0.966966, 0, 0.610085, -0.792336, 0, 0.496056, -0.86829, 0, 0.736213, -0.67675, 0, 0.872297, -0.488977, 0, 0.905764, -0.423782, 0, 0.972151, -0.234355, 0, 0.98814, -0.153557, 0, 0.997708, 0.0676705, 0, 0.976374, 0.216086, 0, 0.979086, 0.203446, 0, 0.878154, 0.478378, 0, 0.815461, 0.578811, 0, 0.841437, 0.540356, 0, 0.691174, 0.722688, 0, 0.578332, 0.815801, 0, 0.582994, 0.812477, 0, 0.369201, 0.92935, 0, 0.250613, 0.968087, 0, 0.17633, 0.984331, 0, 0.0355782, 0.999367, 0, -0.116228, 0.993222, 0, -0.22887, 0.973457, 0, -0.242924, 0.970045, 0, -0.447075, 0.894497, 0, -0.57979, 0.814766, 0, -0.627338, 0.778747, 0, -0.735994, 0.676988, 0, -0.830465, 0.557071, 0, -0.900918, 0.43399, 0, -0.918495, 0.395432, 0, -0.973865, 0.227128, 0, -0.998681, 0.0513395, 0, -0.999846, 0.0175559, 0, -0.929692, -0.368337, 0, -0.992763, -0.120095, 0, -0.964383, -0.264509, 0, 0.42022, 0.907422, 0, -0.791138, 0.190895, 0.581085, -0.618618, 0.502687, 0.603836, -0.616925, 0.504918, 0.603706, -0.972024, 0.234883, 0, -0.00113887, 0.00233003, 0.999997, 0.0987941, 0.0738672, 0.992363, -0.00327554, 0.00856648, 0.999958, 0.107996, 0.0637462, 0.992105, 0.323008, 0.175398, 0.930001, 0.217042, 0.128803, 0.967627, 0.321823, 0.195881, 0.926315, 0.223664, 0.113105, 0.968081, 0.422698, 0.227901, 0.877147, 0.426514, 0.2512, 0.868898, 0.303053, 0.13833, 0.942881, 0.391914, 0.18951, 0.900272, 0.168847, 0.0780354, 0.982548, 0.25087, 0.102387, 0.962591, 0.33144, 0.141684, 0.932777, 0.179544, 0.0770447, 0.980728, 0.096669, 0.0610873, 0.99344, 0.181618, 0.0661017, 0.981145, 0.177874, 0.0858333, 0.980303, 0.240295, 0.100437, 0.96549, 0.178573, 0.0821889, 0.980488, 0.180188, 0.0736315, 0.980872, 0.0980758, 0.0471316, 0.994062, 0.179797, 0.0757127, 0.980786, 0.1261, 0.0616213, 0.990102, 0.180925, 0.0697632, 0.98102, 0.000699568, -0.00178689, 0.999998, -0.000476821, 0.00334087, 0.999994, -3.23768e-05, 0.00267979, 0.999996, -0.0971967, -0.0587765, 0.993528, -0.0982694, -0.0458567, 0.994103, -0.126289, -0.0559522, 0.990414, -0.179899, -0.0750935, 0.980815, -0.240699, -0.0960298, 0.965838, -0.168055, -0.0800771, 0.98252, -0.250993, -0.10192, 0.962608, -0.332344, -0.136668, 0.933204, -0.303786, -0.13599, 0.942985, -0.223973, -0.111663, 0.968177, -0.393238, -0.185044, 0.900624, -0.325254, -0.17049, 0.93013, -0.424195, -0.224448, 0.877315, -0.216857, -0.128391, 0.967723, -0.32181, -0.195904, 0.926315, -0.426532, -0.251169, 0.868898, 0.517138, 0.277592, 0.809637, 0.522704, 0.300892, 0.797649, 0.606526, 0.353428, 0.71219, 0.606491, 0.319073, 0.728259, 0.484039, 0.23292, 0.843478, 0.57344, 0.268812, 0.773891, 0.41384, 0.177353, 0.892906, 0.582703, 0.222502, 0.781633, 0.498364, 0.201382, 0.843255, 0.580308, 0.235178, 0.779701, 0.305112, 0.120011, 0.944724, 0.372923, 0.136282, 0.917799, 0.163029, 0.0653563, 0.984454, 0.202393, 0.0731295, 0.97657, 0.000650717, 0.00550435, 0.999985, 0.00202864, 0.00799523, 0.999966, -0.162184, -0.0559133, 0.985175, -0.199372, -0.058544, 0.978173, -0.305026, -0.111471, 0.945798, -0.371585, -0.123919, 0.920092, -0.4146, -0.170275, 0.893932, -0.498733, -0.192296, 0.845156, -0.485294, -0.227917, 0.844123, -0.575787, -0.258049, 0.775809, -0.518401, -0.274515, 0.809878, -0.608182, -0.314609, 0.72879, -0.522703, -0.300893, 0.797649, -0.606526, -0.353428, 0.71219, 0.682409, 0.396429, 0.614135, 0.688918, 0.350301, 0.634571, 0.771829, 0.38722, 0.504321, 0.762048, 0.371239, 0.530531, 0.74333, 0.438533, 0.505124, 0.661011, 0.283501, 0.69476, 0.569565, 0.286325, 0.770463, 0.561674, 0.319289, 0.763268, 0.741129, 0.291844, 0.604612, 0.582105, 0.212482, 0.78486, 0.577254, 0.250626, 0.777151, 0.663336, 0.213057, 0.71735, 0.442752, 0.142981, 0.885171, 0.5139, 0.140779, 0.84622, 0.244283, 0.0769533, 0.966646, 0.288469, 0.0756064, 0.954499, 0.00406708, 0.0102014, 0.99994, 0.00687444, 0.0122758, 0.999901, -0.237807, -0.0581613, 0.96957, -0.277219, -0.0524498, 0.959374, -0.439452, -0.126864, 0.889262, -0.508159, -0.121743, 0.852615, -0.581934, -0.201711, 0.787823, -0.662401, -0.200408, 0.721846, -0.662563, -0.274711, 0.69681, -0.742802, -0.280666, 0.607842, -0.691348, -0.343854, 0.635454, -0.765229, -0.362528, 0.531976, -0.682409, -0.396429, 0.614135, -0.74749, -0.431301, 0.50521, 0.799869, 0.458602, 0.387161, 0.824248, 0.382728, 0.417293, 0.743243, 0.438696, 0.50511, 0.83898, 0.476601, 0.262611, 0.873637, 0.385287, 0.297173, 0.812528, 0.289818, 0.50577, 0.873935, 0.276119, 0.399996, 0.7396, 0.202249, 0.64194, 0.808491, 0.178714, 0.560717, 0.583578, 0.127812, 0.801936, 0.643886, 0.0912578, 0.75966, 0.333873, 0.0678061, 0.940176, 0.441455, 0.130781, 0.887702, 0.0105387, 0.0140913, 0.999845, 0.274656, -0.0692419, 0.959046, 0.279779, -0.0635079, 0.957962, 0.0210041, 0.0214745, 0.999549, -0.316569, -0.0409484, 0.947685, -0.274658, 0.0692397, 0.959046, -0.279779, 0.0635074, 0.957962, -0.575026, -0.106233, 0.811209, -0.633423, -0.0708037, 0.77056, -0.441453, -0.130778, 0.887703, -0.737842, -0.187752, 0.648335, -0.805895, -0.16276, 0.569247, -0.814306, -0.276219, 0.510499, -0.875783, -0.260054, 0.406664, -0.828146, -0.371835, 0.419419, -0.878552, -0.371413, 0.300331, -0.799829, -0.458577, 0.387274, -0.838978, -0.476603, 0.262611, 0.862346, 0.487669, 0.136157, 0.909137, 0.378626, 0.173528, 0.874283, 0.479985, 0.0724115, 0.934455, 0.334931, 0.12089, 0.923703, 0.251551, 0.288955, 0.946957, 0.205311, 0.247224, 0.866028, 0.130222, 0.482739, 0.898022, 0.139734, 0.417169, 0.699714, 0.049002, 0.712741, 0.775115, 0.105828, 0.622895, 0.422088, 0.0286838, 0.906101, 0.435177, 0.122663, 0.89195, 0.498773, 0.0633328, 0.864415, 0.276599, -0.0670734, 0.958642, 0.0183775, 0.014404, 0.999727, 0.287111, -0.0552645, 0.956302, 0.143947, 0.0982272, 0.984698, 0.165634, 0.113029, 0.979689, -0.2766, 0.067073, 0.958642, -0.388053, 0.00339762, 0.921631, -0.287109, 0.055267, 0.956302, -0.143944, -0.0982256, 0.984699, -0.165636, -0.113031, 0.979688, -0.43279, -0.00612755, 0.901474, -0.435176, -0.122661, 0.891951, -0.68397, -0.0245214, 0.729098, -0.742943, -0.0524409, 0.667297, -0.861886, -0.111206, 0.494758, -0.8922, -0.109839, 0.43808, -0.925788, -0.232679, 0.297956, -0.949454, -0.166821, 0.265908, -0.915301, -0.361331, 0.177943, -0.945036, -0.300037, 0.129941, -0.862345, -0.48767, 0.136157, -0.874288, -0.479984, 0.0723637, -0.1013, -0.0664654, 0.992633, -0.0975397, -0.0752974, 0.992379, -0.106454, -0.054315, 0.992833, -0.107437, -0.0636883, 0.99217, -0.0984099, -0.0732542, 0.992446, -0.0956516, -0.0797582, 0.992214, -0.0962312, -0.0783995, 0.992267, -0.095917, -0.0791159, 0.99224, 0.111532, 0.0516354, 0.992418, 0.00318287, -0.00357226, 0.999988, 0.300982, 0.209792, 0.930267, 0.204694, 0.144641, 0.96808, 0.401423, 0.263169, 0.877269, 0.263268, 0.203487, 0.943018, 0.349787, 0.257259, 0.900815, 0.150702, 0.109609, 0.982484, 0.206571, 0.174469, 0.962751, 0.280763, 0.224613, 0.933125, 0.150144, 0.123598, 0.980908, 0.0981228, 0.0571984, 0.993529, 0.194629, 0.16819, 0.96635, 0.0874539, 0.0641689, 0.9941, 0.105591, 0.0863586, 0.990653, 0.00332495, -0.00251708, 0.999991, 0.00186652, -0.00155055, 0.999997, 0.0036336, -0.00207526, 0.999991, -0.0864701, -0.0649286, 0.994136, -0.0982753, -0.0568992, 0.993531, -0.100966, -0.0891263, 0.99089, -0.150103, -0.123632, 0.98091, -0.193483, -0.168965, 0.966445, -0.152372, -0.10745, 0.982465, -0.205506, -0.175355, 0.962818, -0.278027, -0.226843, 0.933404, -0.202389, -0.147004, 0.968209, -0.262826, -0.20385, 0.943063, -0.350699, -0.2563, 0.900733, -0.301095, -0.20964, 0.930265, -0.401064, -0.263507, 0.877332, 0.497523, 0.313177, 0.808944, 0.572197, 0.37731, 0.728168, 0.439996, 0.309379, 0.843023, 0.516134, 0.369124, 0.772886, 0.353745, 0.277832, 0.893126, 0.419506, 0.337382, 0.842727, 0.249648, 0.210422, 0.945198, 0.294143, 0.263107, 0.918833, 0.130713, 0.113413, 0.984912, 0.154976, 0.144077, 0.977356, 0.00475988, -0.00194949, 0.999987, 0.00701634, -0.00184945, 0.999974, -0.122675, -0.116968, 0.98553, -0.14361, -0.147525, 0.978577, -0.241886, -0.21461, 0.946274, -0.28567, -0.266657, 0.920482, -0.347543, -0.282327, 0.89415, -0.416305, -0.339343, 0.843526, -0.438579, -0.31071, 0.843272, -0.512051, -0.372786, 0.773844, -0.497315, -0.31344, 0.808971, -0.568669, -0.38157, 0.728711, 0.638906, 0.434665, 0.634717, 0.74333, 0.438533, 0.505124, 0.693443, 0.487637, 0.530422, 0.712304, 0.488279, 0.504189, 0.5678, 0.441788, 0.69457, 0.614306, 0.507701, 0.604043, 0.47887, 0.400899, 0.781001, 0.507629, 0.478078, 0.716766, 0.350029, 0.315469, 0.88202, 0.388051, 0.378333, 0.840405, 0.183678, 0.177004, 0.966919, 0.228419, 0.214765, 0.949579, 0.00975924, -0.00124407, 0.999952, 0.0101801, 4.96049e-05, 0.999948, -0.162951, -0.18066, 0.969953, -0.206522, -0.216069, 0.954287, -0.336037, -0.319944, 0.885841, -0.368323, -0.38278, 0.847241, -0.470063, -0.405647, 0.783895, -0.495902, -0.483489, 0.721332, -0.563243, -0.445488, 0.695915, -0.605653, -0.514352, 0.607146, -0.63471, -0.43953, 0.635576, -0.687334, -0.494571, 0.53195, 0.734112, 0.536085, 0.416764, 0.743243, 0.438696, 0.50511, 0.760491, 0.577556, 0.296788, 0.646862, 0.571257, 0.505208, 0.664261, 0.631853, 0.3994, 0.534292, 0.549966, 0.641927, 0.579469, 0.609195, 0.541384, 0.39357, 0.449536, 0.801885, 0.404383, 0.519871, 0.752468, 0.445503, 0.653324, 0.612123, 0.472549, 0.645981, 0.599505, 0.220433, 0.259798, 0.940167, 0.228924, 0.306651, 0.923883, 0.120967, 0.0166682, 0.992517, 0.0208571, 0.00574412, 0.999766, 0.132581, 0.0182699, 0.991004, 0.123781, 0.0170582, 0.992163, -0.189031, -0.257684, 0.947558, -0.120967, -0.0166682, 0.992517, -0.192118, -0.299734, 0.934479, -0.123781, -0.0170582, 0.992163, -0.132582, -0.01827, 0.991004, -0.370456, -0.452459, 0.811199, -0.378132, -0.520935, 0.765273, -0.520805, -0.55543, 0.648275, -0.532773, -0.626843, 0.568525, -0.635645, -0.579495, 0.51004, -0.651133, -0.64129, 0.405922, -0.726453, -0.544722, 0.418979, -0.750568, -0.588798, 0.299941, 0.77081, 0.613082, 0.173155, 0.746148, 0.654905, 0.119848, 0.667076, 0.687032, 0.288092, 0.637539, 0.729958, 0.246384, 0.597667, 0.601558, 0.53002, 0.546383, 0.691169, 0.473023, 0.65625, 0.573734, 0.490067, 0.51613, 0.731427, 0.445672, 0.402723, 0.589869, 0.699907, 0.490345, 0.64075, 0.590763, 0.376056, 0.623149, 0.685761, 0.229112, 0.355872, 0.906015, 0.205425, 0.372927, 0.904835, 0.0232952, 0.00988808, 0.99968, 0.0582919, 0.0294257, 0.997866, -0.188458, -0.342912, 0.920269, -0.128291, -0.34201, 0.930898, -0.373485, -0.588559, 0.717013, -0.321352, -0.617348, 0.718063, -0.530038, -0.696475, 0.483717, -0.485645, -0.73949, 0.466159, -0.651595, -0.698089, 0.29681, -0.623705, -0.738988, 0.25473, -0.75884, -0.626634, 0.177459, -0.720368, -0.681497, 0.128965, -0.111475, -0.0508899, 0.992463, 0.997566, 0.0302799, -0.0628144, 0.957274, 0.167565, -0.235686, 0.950495, 0.229602, -0.209386, 0.995224, 0.0454637, -0.086383, 0.868652, 0.275416, -0.411813, 0.838376, 0.37947, -0.391317, 0.743003, 0.33709, -0.578202, 0.67478, 0.472654, -0.566807, 0.60343, 0.3484, -0.71728, 0.467239, 0.471769, -0.747744, 0.475672, 0.319915, -0.819384, 0.274522, 0.390822, -0.878576, 0.36728, 0.231783, -0.900768, 0.132124, 0.25753, -0.957195, 0.301004, 0.110102, -0.947246, 0.0525623, 0.0877108, -0.994758, 0.286599, -0.0344335, -0.957432, 0.0415217, -0.0451573, -0.998117, 0.0731114, -0.131862, -0.988568, 0.328061, -0.173895, -0.928513, 0.177917, -0.289685, -0.94044, 0.415861, -0.277144, -0.86617, 0.337097, -0.398233, -0.853098, 0.536932, -0.338386, -0.772787, 0.544155, -0.455761, -0.704399, 0.669954, -0.343061, -0.658385, 0.805235, -0.306808, -0.507411, 0.749131, -0.425719, -0.507509, 0.91532, -0.221263, -0.336499, 0.891675, -0.305053, -0.334452, 0.983063, -0.0996593, -0.153804, 0.979028, -0.139299, -0.148661, 0.998498, 0.0369958, 0.0403986, 0.998673, 0.0483323, 0.0177527, 0.951097, 0.229877, 0.206327, 0.957274, 0.167565, 0.235687, 0.841678, 0.381427, 0.38222, 0.868649, 0.275412, 0.411823, 0.683, 0.479526, 0.550968, 0.742997, 0.33708, 0.578215, 0.478131, 0.484684, 0.732443, 0.603479, 0.348362, 0.717256, 0.480091, 0.331447, 0.812192, 0.274496, 0.390776, 0.878605, 0.371704, 0.250095, 0.894029, 0.132122, 0.257524, 0.957196, 0.303297, 0.133483, 0.943501, 0.0525657, 0.0877345, 0.994756, 0.285614, -0.00909621, 0.958302, 0.0415353, -0.0450631, 0.99812, 0.328065, -0.173916, 0.928508, 0.0831113, -0.17294, 0.98142, 0.41587, -0.277174, 0.866156, 0.192724, -0.322245, 0.926831, 0.536932, -0.338386, 0.772787, 0.35162, -0.418865, 0.837207, 0.669934, -0.343085, 0.658393, 0.552407, -0.463866, 0.692586, 0.800601, -0.300152, 0.518601, 0.749133, -0.425721, 0.507505, 0.91331, -0.218219, 0.343867, 0.89168, -0.305055, 0.334435, 0.982652, -0.0986191, 0.157063, 0.979026, -0.139298, 0.148676, 0.999104, 0.00624581, -0.0418488, 0.981844, 0.0546995, -0.18163, 0.946133, 0.0992192, -0.308202, 0.895024, 0.116053, -0.430655, 0.840635, 0.126594, -0.526599, 0.789023, 0.118544, -0.602818, 0.746455, 0.0851855, -0.659961, 0.720807, 0.0434182, -0.691774, 0.715285, -0.0141429, -0.69869, 0.731715, -0.0714282, -0.677858, 0.766576, -0.108744, -0.632879, 0.814851, -0.130045, -0.564895, 0.868358, -0.125597, -0.47977, 0.921287, -0.107041, -0.373861, 0.965759, -0.0766892, -0.247846, 0.993231, -0.0319304, -0.111683, 0.999219, 0.00994418, 0.0382385, 0.981842, 0.0546799, 0.181649, 0.946129, 0.0991968, 0.308221, 0.89559, 0.118998, 0.428669, 0.841101, 0.129224, 0.525214, 0.790654, 0.130409, 0.598213, 0.747787, 0.0996516, 0.656418, 0.721306, 0.0575139, 0.690225, 0.715039, -0.000920183, 0.699084, 0.731406, -0.0668068, 0.678663, 0.765909, -0.103188, 0.634615, 0.813961, -0.124521, 0.567417, 0.867025, -0.118692, 0.483921, 0.919014, -0.0953686, 0.382516, 0.96427, -0.0669647, 0.256317, 0.992589, -0.0243669, 0.119052, 0.994705, 0.00325263, -0.102725, 0.999746, -0.00289954, -0.022366, 0.984022, 0.00889507, -0.177826, 0.969459, 0.0109732, -0.245007, 0.953557, 0.0115012, -0.300994, 0.938632, 0.00905228, -0.344802, 0.926987, 0.00650988, -0.375038, 0.920039, 0.00290294, -0.391816, 0.918598, 0.000253726, -0.395192, 0.922677, -0.000129214, -0.385574, 0.932089, -0.00392701, -0.362208, 0.945555, -0.00705534, -0.325386, 0.961204, -0.00724702, -0.275744, 0.976767, -0.00568628, -0.214227, 0.989809, -0.00319851, -0.142368, 0.998007, -9.72723e-05, -0.0630955, 0.999797, 0.00267776, 0.0199668, 0.994636, 0.00155174, 0.103429, 0.984021, 0.0088837, 0.177831, 0.969378, 0.00985243, 0.245374, 0.953433, 0.00979628, 0.301447, 0.938495, 0.0067644, 0.345227, 0.926697, 0.000391855, 0.375809, 0.919964, -0.000559755, 0.392003, 0.918582, -0.00275551, 0.39522, 0.922902, -0.00675299, 0.384975, 0.932473, -0.0108898, 0.361076, 0.945902, -0.0120272, 0.32423, 0.961467, -0.0108239, 0.274706, 0.976928, -0.0079595, 0.213422, 0.989859, -0.00439479, 0.141983, 0.99798, 0.000911876, 0.0635233, 0.999792, -0.00976084, -0.0179209, 0.997117, -0.0061762, -0.0756246, 0.991215, -0.0100444, -0.131876, 0.98348, -0.00938267, -0.180774, 0.975029, -0.0085591, -0.221914, 0.967151, -0.0083558, -0.254067, 0.960998, -0.00688222, -0.276469, 0.957451, -0.000870096, -0.288595, 0.956686, -0.000175633, -0.291123, 0.958933, 0.00187854, -0.283628, 0.963852, 0.00658767, -0.266356, 0.970849, 0.0103621, -0.239467, 0.979028, 0.0129444, -0.203313, 0.987285, 0.0139317, -0.158349, 0.994314, 0.0127274, -0.105723, 0.998848, 0.00843459, -0.0472318, 0.999898, 0.00458708, 0.0135518, 0.997098, -0.00684718, 0.075822, 0.991215, -0.010063, 0.131881, 0.983386, -0.0111289, 0.181185, 0.974911, -0.0107571, 0.222336, 0.967111, -0.00920649, 0.25419, 0.96105, -0.00533271, 0.276324, 0.957469, 0.000554841, 0.288537, 0.956683, 0.000328537, 0.29113, 0.958876, 0.00432407, 0.283793, 0.963827, 0.00722707, 0.266432, 0.970918, 0.00902355, 0.239242, 0.979192, 0.0100264, 0.202688, 0.987507, 0.00970539, 0.15728, 0.994521, 0.00755146, 0.10426, 0.998933, 0.00426623, 0.0459798, 0.957275, 0.167566, 0.235684, 0.997566, 0.0302802, 0.0628133, 0.950495, 0.229602, 0.209386, 0.995224, 0.0454637, 0.0863833, 0.868653, 0.275418, 0.411811, 0.838376, 0.37947, 0.391317, 0.743006, 0.337094, 0.578196, 0.674782, 0.472656, 0.566802, 0.603431, 0.348402, 0.717277, 0.46724, 0.47177, 0.747743, 0.480088, 0.331438, 0.812197, 0.274522, 0.390822, 0.878576, 0.371704, 0.250091, 0.894031, 0.132124, 0.25753, 0.957195, 0.303297, 0.133485, 0.9435, 0.0525623, 0.0877108, 0.994758, 0.285615, -0.00912266, 0.958301, 0.0415217, -0.0451573, 0.998117, 0.0731114, -0.131862, 0.988568, 0.328061, -0.173896, 0.928513, 0.177915, -0.28968, 0.940442, 0.415862, -0.277149, 0.866168, 0.33709, -0.398222, 0.853106, 0.536932, -0.338385, 0.772787, 0.544153, -0.455759, 0.704401, 0.669957, -0.343066, 0.658379, 0.805237, -0.30681, 0.507407, 0.749131, -0.425719, 0.507509, 0.915321, -0.221264, 0.336497, 0.891676, -0.305053, 0.33445, 0.983063, -0.0996591, 0.153804, 0.979028, -0.139299, 0.148662, 0.998498, 0.0369957, -0.040399, 0.998674, 0.0483323, -0.0177525, 0.950492, 0.2296, -0.209403, 0.957274, 0.167565, -0.235686, 0.838382, 0.379473, -0.391301, 0.86865, 0.275414, -0.411819, 0.674774, 0.472649, -0.566818, 0.742997, 0.337081, -0.578214, 0.46723, 0.471758, -0.747757, 0.603484, 0.348372, -0.717248, 0.47567, 0.31991, -0.819387, 0.274491, 0.390767, -0.87861, 0.36728, 0.231784, -0.900767, 0.132123, 0.257525, -0.957196, 0.300957, 0.110098, -0.947261, 0.0525661, 0.0877374, -0.994756, 0.286597, -0.0343902, -0.957434, 0.0415173, -0.0450647, -0.998121, 0.328066, -0.17392, -0.928507, 0.0830585, -0.172976, -0.981418, 0.415867, -0.277165, -0.86616, 0.192723, -0.322244, -0.926832, 0.536928, -0.338377, -0.772793, 0.35149, -0.418944, -0.837222, 0.66993, -0.343078, -0.658401, 0.552404, -0.463863, -0.69259, 0.80523, -0.3068, -0.507424, 0.749133, -0.425721, -0.507505, 0.915321, -0.221266, -0.336494, 0.891681, -0.305056, -0.334435, 0.983063, -0.099659, -0.153805, 0.979026, -0.139298, -0.148676, 0.981845, 0.0547011, 0.181629, 0.999104, 0.00624604, 0.0418486, 0.946133, 0.0992228, 0.308199, 0.895024, 0.116053, 0.430655, 0.839853, 0.122307, 0.528855, 0.78979, 0.124004, 0.600712, 0.7473, 0.094151, 0.657783, 0.721209, 0.054543, 0.690567, 0.715096, -0.00345801, 0.699018, 0.731689, -0.0709936, 0.677932, 0.766057, -0.104408, 0.634236, 0.814851, -0.130047, 0.564894, 0.868359, -0.1256, 0.479768, 0.920273, -0.101711, 0.377825, 0.96576, -0.0766904, 0.247845, 0.993231, -0.0319312, 0.111682, 0.999219, 0.00994432, -0.0382384, 0.981842, 0.0546819, -0.181647, 0.94613, 0.0992003, -0.308218, 0.895591, 0.118999, -0.428668, 0.841102, 0.12923, -0.525211, 0.789764, 0.123814, -0.600786, 0.746981, 0.0906875, -0.658632, 0.720927, 0.0463802, -0.691457, 0.715267, -0.0129083, -0.698732, 0.731716, -0.0714438, -0.677855, 0.766578, -0.108759, -0.632874, 0.814673, -0.128925, -0.565408, 0.867698, -0.122163, -0.481846, 0.920556, -0.103173, -0.376739, 0.964752, -0.0699985, -0.25368, 0.992692, -0.0255278, -0.117942, 0.994636, 0.0015678, 0.103422, 0.999725, -0.00441986, 0.0230198, 0.984021, 0.0088908, 0.177828, 0.969459, 0.010966, 0.245009, 0.953653, 0.0128459, 0.300635, 0.938799, 0.011553, 0.344273, 0.926987, 0.00651234, 0.375038, 0.920068, 0.00438824, 0.391734, 0.918589, 0.00137661, 0.395212, 0.922766, -0.00261118, 0.385352, 0.93236, -0.0087419, 0.361425, 0.945712, -0.00925755, 0.324875, 0.961349, -0.00914708, 0.27518, 0.976871, -0.00715443, 0.213708, 0.98986, -0.00415307, 0.141988, 0.998007, -9.66478e-05, 0.0630958, 0.999797, 0.0026786, -0.0199664, 0.994636, 0.00154797, -0.10343, 0.983934, 0.00743168, -0.17838, 0.969205, 0.0074999, -0.246143, 0.953335, 0.00849364, -0.301794, 0.938495, 0.00676329, -0.345227, 0.926697, 0.000396764, -0.375808, 0.919964, -0.000557725, -0.392003, 0.918574, -0.00128998, -0.395247, 0.922769, -0.0026823, -0.385345, 0.932246, -0.006632, -0.361765, 0.945791, -0.0104003, -0.324609, 0.961411, -0.0100642, -0.274931, 0.976788, -0.00603247, -0.214125, 0.989871, -0.00435932, -0.141906, 0.99798, 0.000909473, -0.0635223, 0.997098, -0.00683571, 0.0758186, 0.999824, -0.00747076, 0.0172193, 0.991215, -0.0100544, 0.131878, 0.983479, -0.00939257, 0.180777, 0.975028, -0.00857012, 0.221916, 0.967127, -0.00834778, 0.254157, 0.960998, -0.00689476, 0.27647, 0.957428, -0.00250825, 0.288662, 0.956683, 0.000333422, 0.29113, 0.958933, 0.0018703, 0.283628, 0.963828, 0.00718956, 0.266427, 0.970856, 0.0102381, 0.239446, 0.979059, 0.0124065, 0.203198, 0.987324, 0.0132065, 0.158165, 0.994342, 0.0120736, 0.105538, 0.998848, 0.00843556, 0.0472321, 0.999898, 0.00458618, -0.0135521, 0.997098, -0.00684718, -0.075822, 0.991321, -0.0076757, -0.131237, 0.983585, -0.00734506, -0.180295, 0.974988, -0.0093285, -0.222062, 0.967111, -0.00920658, -0.25419, 0.96105, -0.00533644, -0.276325, 0.957469, 0.000545957, -0.288537, 0.956683, 0.000341558, -0.29113, 0.958876, 0.00432529, -0.283793, 0.963827, 0.00722335, -0.266432, 0.970919, 0.00901635, -0.23924, 0.979094, 0.0117888, -0.203066, 0.987411, 0.0115757, -0.157753, 0.994521, 0.00755408, -0.104261, 0.998933, 0.00426455, -0.0459793
-};
-
-float mBitangents[] = {
--8.09254e-06, 1, 0, -0.0131414, 0.999913, -0.00130507, 0.0131414, 0.999913, 0.00130507, 8.0944e-06, 1, 0, -0.0113276, 0.999933, -0.00226505, 0.0151054, 0.999881, 0.00302044, 0.0126364, 0.999913, 0.0038047, -0.0126364, 0.999913, -0.0038047, 0.0121934, 0.999913, 0.0050729, -0.0121934, 0.999913, -0.0050729, 0.0102049, 0.999933, 0.00544099, -0.0136083, 0.999881, -0.00725558, -0.00958921, 0.999933, -0.00644303, 0.0127872, 0.999881, 0.00859179, 0.0102015, 0.999913, 0.00836836, -0.0102015, 0.999913, -0.00836836, 0.0093487, 0.999913, 0.00933768, -0.00934871, 0.999913, -0.00933769, 0.00838994, 0.999913, 0.0102181, -0.00838995, 0.999913, -0.0102181, 0.00645348, 0.999933, 0.00960429, -0.00852517, 0.999881, -0.0128297, -3.75393e-06, 1, 1.27284e-05, 5.25549e-06, 1, -1.78198e-05, -0.0050729, 0.999913, -0.0121934, 0.0050729, 0.999913, 0.0121934, -0.0038047, 0.999913, -0.0126364, 0.0038047, 0.999913, 0.0126364, -0.00258877, 0.999913, -0.0129466, 0.00258877, 0.999913, 0.0129466, -0.00130507, 0.999913, -0.0131414, 0.00130507, 0.999913, 0.0131414, 0, 1, 0, 0, 1, -1.86464e-09, 0, 1, 0, 0, 1, -1.86464e-09, -0.00114185, 0.999933, 0.0114981, 0.00152267, 0.999881, -0.0153327, 0.00226505, 0.999933, -0.0113276, -0.00302045, 0.999881, 0.0151054, 2.25701e-05, 1, -1.62961e-07, -2.25701e-05, 1, 1.62961e-07, -1.83364e-05, 1, -1.80273e-05, 1.83364e-05, 1, 1.80292e-05, 1.33221e-05, 1, -1.88424e-06, -1.33221e-05, 1, 1.88424e-06, 0.00639675, 0.999933, -0.00962655, -0.00853009, 0.999881, 0.012837, -9.2653e-06, 1, 6.24276e-06, 1.19168e-05, 1, -8.02965e-06, -0.00932842, 0.999913, 0.00933945, 0.00932843, 0.999913, -0.00933946, -0.0102023, 0.999913, 0.00837702, 0.0102023, 0.999913, -0.00837703, -0.0109961, 0.999912, 0.00738863, 0.0110153, 0.999913, -0.0073196, -9.05306e-06, 1, 1.53823e-05, 1.26743e-05, 1, -2.15353e-05, -0.0121897, 0.999913, 0.00507136, 0.0121896, 0.999913, -0.00507135, -0.0126393, 0.999913, 0.00380558, 0.0126393, 0.999913, -0.00380557, -0.0113276, 0.999933, 0.00226505, 0.0151054, 0.999881, -0.00302044, 0.0131599, 0.999913, -0.00130689, -0.0131599, 0.999913, 0.00130689, 0, 1, 0, 0, 1, 0, -0.013159, 0.999913, -0.00130679, 0.013159, 0.999913, 0.00130679, -0.0113245, 0.999933, -0.00226445, 0.0151013, 0.999881, 0.00301965, 2.03701e-07, 1, -2.24479e-05, -2.03701e-07, 1, 2.24479e-05, -0.0122019, 0.999913, -0.00503218, 0.0122019, 0.999913, 0.00503218, -0.0101759, 0.999933, -0.00545311, 0.0135695, 0.999882, 0.00727173, 0.0109959, 0.999913, 0.00730664, -0.0109959, 0.999913, -0.00730665, -2.3352e-06, 1, 2.74803e-06, 2.33639e-06, 1, -2.74708e-06, -0.00934883, 0.999913, -0.00933782, 0.00934884, 0.999913, 0.00933783, -0.00734433, 0.999933, -0.00894462, 0.00979368, 0.999881, 0.0119277, 0.00640429, 0.999933, 0.00963782, -0.00862068, 0.999881, -0.0128297, -1.79461e-05, 1, -1.05619e-05, 1.79461e-05, 1, 1.05619e-05, 0.00507789, 0.999913, 0.0122054, -0.00507789, 0.999913, -0.0122054, 0.0038081, 0.999913, 0.0126476, -0.0038081, 0.999913, -0.0126476, 0.00226505, 0.999933, 0.0113276, -0.00302045, 0.999881, -0.0151054, -0.00114187, 0.999933, -0.0114981, 0.00152269, 0.999881, 0.0153327, 0, 1, -8.09254e-06, 0, 1, 8.0944e-06, 0.00130689, 0.999913, -0.0131599, -0.00130689, 0.999913, 0.0131599, 0.00258877, 0.999913, -0.0129466, -0.00258877, 0.999913, 0.0129466, 0.00380479, 0.999913, -0.0126367, -0.00380479, 0.999913, 0.0126367, 0.00507189, 0.999913, -0.0121909, -0.0050719, 0.999913, 0.0121909, 0.00543771, 0.999933, -0.0101988, -0.0072512, 0.999881, 0.0136001, -0.00644292, 0.999933, 0.00958904, 0.00859164, 0.999881, -0.012787, 0.00836372, 0.999913, -0.0101958, -0.00836373, 0.999913, 0.0101958, 0.00932901, 0.999913, -0.00934003, -0.00932902, 0.999913, 0.00934004, 1.07351e-05, 1, -1.19165e-05, -1.07351e-05, 1, 1.19165e-05, -0.00960491, 0.999933, 0.00638345, 0.0127868, 0.999881, -0.00859149, 0.0102049, 0.999933, -0.005441, -0.0136083, 0.999881, 0.00725557, 5.17158e-06, 1, 2.36702e-05, -5.17251e-06, 1, -2.36693e-05, -2.08801e-07, 1, -2.24588e-05, 2.08801e-07, 1, 2.24588e-05, -0.0113437, 0.999933, 0.00226824, 0.0151269, 0.999881, -0.00302471, 0.0131692, 0.999912, -0.00130779, -0.0131692, 0.999912, 0.00130779, 0.0980141, 0, -0.995185, 0.0327133, 0, -0.999465, 0.0980155, 0, -0.995185, -0.0122806, 0, -0.999925, 0.195078, 0, -0.980788, 0.195082, 0, -0.980787, 0.301995, 0, -0.953309, 0.274608, 0, -0.961556, 0.343489, 0, -0.939157, 0.408425, 0, -0.912792, 0.449605, 0, -0.893228, 0.485746, 0, -0.8741, 0.555578, 0, -0.831465, 0.555581, 0, -0.831463, 0.634398, 0, -0.773007, 0.621671, 0, -0.783279, 0.687005, 0, -0.726653, 0.71857, 0, -0.695455, 0.765166, 0, -0.643833, 0.773007, 0, -0.634398, 0.823592, 0, -0.567183, 0.831466, 0, -0.555576, 0.866031, 0, -0.49999, 0.887637, 0, -0.460543, 0.906964, 0, -0.421208, 0.934245, 0, -0.356633, 0.943887, 0, -0.330268, 0.964701, 0, -0.263349, 0.975697, 0, -0.219125, 0.983846, 0, -0.179019, 0.996313, 0, -0.085794, 0.993449, 0, -0.11428, 0.99994, 0, -0.0109213, 1, 0, 0, 0.99994, 0, -0.0109213, 0.996313, 0, 0.085794, 0.99345, 0, 0.114269, 1, 0, 0, 0.983846, 0, 0.179019, 0.978318, 0, 0.207109, 0.963782, 0, 0.266691, 0.948429, 0, 0.316989, 0.935905, 0, 0.352251, 0.91279, 0, 0.408429, 0.893231, 0, 0.449598, 0.874096, 0, 0.485752, 0.831469, 0, 0.555571, 0.840446, 0, 0.541895, 0.780739, 0, 0.624857, 0.773022, 0, 0.63438, 0.736225, 0, 0.676737, 0.707104, 0, 0.70711, 0.666354, 0, 0.745635, 0.62486, 0, 0.780737, 0.590047, 0, 0.807369, 0.541905, 0, 0.840439, 0.480986, 0, 0.876728, 0.485761, 0, 0.874092, 0.405252, 0, 0.914205, 0.367535, 0, 0.93001, 0.290278, 0, 0.956942, 0.290277, 0, 0.956943, 0.195088, 0, 0.980786, 0.195084, 0, 0.980787, 0.0980228, 0, 0.995184, 0.0980215, 0, 0.995184, 0.0163453, 0, 0.999866, -0.0122634, 0, 0.999925, -0.0700875, 0, 0.997541, -0.125871, 0, 0.992047, -0.167516, 0, 0.985869, -0.222526, 0, 0.974927, -0.278529, 0, 0.960428, -0.317009, 0, 0.948423, -0.382696, 0, 0.923874, -0.397737, 0, 0.9175, -0.482189, 0, 0.876067, -0.471411, 0, 0.881914, -0.543848, 0, 0.839184, -0.578659, 0, 0.81557, -0.634395, 0, 0.773009, -0.643833, 0, 0.765166, -0.676743, 0, 0.73622, -0.718573, 0, 0.695452, -0.745654, 0, 0.666333, -0.780737, 0, 0.62486, -0.817584, 0, 0.57581, -0.840437, 0, 0.541909, -0.887644, 0, 0.46053, -0.881916, 0, 0.471407, -0.923878, 0, 0.382688, -0.930007, 0, 0.367542, -0.956941, 0, 0.290281, -0.952062, 0, 0.305904, -0.974932, 0, 0.222504, -0.98587, 0, 0.167512, -0.992046, 0, 0.125872, -0.997541, 0, 0.0700801, -0.999925, 0, 0.012267, -0.999866, 0, -0.0163453, -0.995184, 0, -0.0980215, -0.995184, 0, -0.0980228, -0.980787, 0, -0.195082, -0.983844, 0, -0.179031, -0.960433, 0, -0.278512, -0.95207, 0, -0.30588, -0.929163, 0, -0.36967, -0.923881, 0, -0.382681, -0.888456, 0, -0.458963, -0.881918, 0, -0.471402, -0.839183, 0, -0.54385, -0.831459, 0, -0.555586, -0.781831, 0, -0.623491, -0.77301, 0, -0.634394, -0.71696, 0, -0.697114, -0.71858, 0, -0.695445, -0.634388, 0, -0.773014, -0.634407, 0, -0.772999, -0.567179, 0, -0.823595, -0.532051, 0, -0.846712, -0.500001, 0, -0.866025, -0.446496, 0, -0.894785, -0.405273, 0, -0.914196, -0.367526, 0, -0.930013, -0.278521, 0, -0.96043, -0.305882, 0, -0.952069, -0.167539, 0, -0.985865, -0.222503, 0, -0.974932, -0.0700874, 0, -0.997541, -0.125881, 0, -0.992045, 0, -1, 0, -0.0131465, -0.999913, -0.00128357, 0, -1, 0, 0, -1, 0, -0.0129679, -0.999913, -0.00256612, 0, -1, 0, -0.0147706, -0.999881, -0.00451473, 0, -1, 0, -0.0106969, -0.999933, -0.00441155, 0, -1, 0, 0, -1, 0, -0.0116521, -0.999913, -0.00624415, -0.0109975, -0.999913, -0.00730773, 0, -1, 0, -0.0102078, -0.999913, -0.00838152, 0, -1, 0, 6.42555e-06, -1, -6.42555e-06, 0, -1, 0, 0, -1, 0, 3.22663e-06, -1, -6.11104e-07, -0.00638126, -0.999934, -0.00960165, 0, -1, 0, 1.74696e-05, -1, -1.75706e-06, 0, -1, 0, 0.00503553, -0.999913, 0.01221, 0, -1, 0, 0, -1, 0, 0.00386694, -0.999913, 0.0126511, 0, -1, 0, 0.00298984, -0.999881, 0.0151093, 0.00112306, -0.999933, 0.0115025, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.00128359, -0.999913, -0.0131465, 0, -1, 0, 0, -1, 0, 0.00256611, -0.999913, -0.0129679, 0, -1, 0, 0, -1, 0, 0.00386429, -0.999913, -0.0126425, 0, -1, 0, 0.00503878, -0.999913, -0.0122179, 2.37474e-05, -1, -5.08006e-06, 0, -1, 0, -0.00638251, -0.999934, 0.00960354, 0, -1, 0, -0.00837763, -0.999913, 0.0102128, 0, -1, 0, -0.00933382, -0.999913, 0.00934484, 0, -1, 0, 0, -1, 0, 2.50552e-06, -1, 1.05925e-06, 0, -1, 0, -1.85237e-05, -1, -4.1844e-05, -0.0101824, -0.999933, 0.00545661, 0, -1, 0, -0.0122179, -0.999913, 0.00503881, 0, -1, 0, -0.0126425, -0.999913, 0.00386429, 0, -1, 0, -0.0151199, -0.999881, 0.00299195, 0, -1, 0, -0.0114863, -0.999933, 0.00112147, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0.0153386, -0.999881, 0.00149761, 0.0113303, -0.999933, 0.00224205, 0, -1, 0, 0.0126339, -0.999913, 0.00386169, 0, -1, 0, -3.18106e-06, -1, -2.71077e-05, 0, -1, 0, -1.84309e-05, -1, 4.93772e-06, 0, -1, 0, 0.00960413, -0.999933, 0.00645336, 0, -1, 0, 0.010207, -0.999913, 0.00838089, 0, -1, 0, -7.03528e-06, -1, 5.81395e-06, 0, -1, 0, -1.05925e-06, -1, 2.50552e-06, 0, -1, 0, 0.00859654, -0.999881, 0.0127943, 0, -1, 0, 0.00543729, -0.999933, 0.010198, 0, -1, 0, 2.59699e-05, -1, 4.16312e-07, 0, -1, 0, 0, -1, 0, -0.00386429, -0.999913, -0.0126425, 0, -1, 0, -0.00256612, -0.999913, -0.0129679, -0.00128357, -0.999913, -0.0131465, 0, -1, 0, 0, -1, 0, 0, -1, 0, -0.00149549, -0.999882, 0.015317, 0, -1, 0, -0.00224368, -0.999933, 0.0113385, 0, -1, 0, 0, -1, 0, -0.00386429, -0.999913, 0.0126425, -0.00503881, -0.999913, 0.0122179, 0, -1, 0, 0, -1, 0, -0.00624837, -0.999913, 0.01166, -0.00854064, -0.999881, 0.0128528, 0, -1, 0, -0.00729736, -0.999934, 0.00890543, 0, -1, 0, -1.88515e-05, -1, 6.00041e-06, 0, -1, 0, 0, -1, 0, -1.37702e-05, -1, 8.18879e-06, -0.0109616, -0.999913, 0.00736509, 0, -1, 0, -1.79477e-05, -1, -8.81903e-06, 0, -1, 0, 0, -1, 0, -1.50825e-05, -1, 2.69628e-05, -4.24508e-06, -1, -2.8641e-05, 0, -1, 0, 0, -1, 0, 0.0129587, -0.999913, -0.00256428, 0.0131278, -0.999913, -0.00128175, 0, -1, 0, -0.0163487, 0, 0.999866, -0.0840398, 0, 0.996462, -0.181299, 0, 0.983428, -0.276827, 0, 0.96092, -0.352256, 0, 0.935904, -0.449604, 0, 0.893228, -0.543866, 0, 0.839172, -0.623482, 0, 0.781838, -0.697109, 0, 0.716966, -0.764039, 0, 0.645171, -0.823596, 0, 0.567177, -0.881916, 0, 0.471407, -0.934199, -2.21072e-05, 0.356752, -0.961515, -4.12301e-05, 0.274751, -0.983098, 1.82981e-05, 0.183082, -0.997542, 0, 0.0700706, -1, 0, 0, -1, 0, 0, -0.997292, 0, -0.0735407, -0.986644, 0, -0.16289, -0.960054, 0, -0.279813, -0.917551, 1.22153e-05, -0.397619, -0.888451, 0, -0.458972, -0.824588, 0, -0.565734, -0.773022, 0, -0.634379, -0.736224, 0, -0.676737, -0.653193, 0, -0.757192, -0.582476, 0, -0.812848, -0.492896, 0, -0.870088, -0.382687, 0, -0.923878, -0.278515, 0, -0.960432, -0.179029, 0, -0.983844, -0.0981522, 1.96099e-05, -0.995171, -0.0163468, 0, -0.999866, 0.0560864, 0, -0.998426, 0.153674, 0, -0.988122, 0.2667, 0, -0.96378, 0.382708, 0, -0.923869, 0.471416, 0, -0.881911, 0.565677, 2.58754e-05, -0.824627, 0.646951, 0, -0.762532, 0.695455, 0, -0.71857, 0.754935, 0, -0.6558, 0.817586, 0, -0.575806, 0.881926, 0, -0.471388, 0.929998, 0, -0.367563, 0.960445, -2.78552e-05, -0.278469, 0.985871, 0, -0.167508, 0.997546, -7.01159e-06, -0.0700077, 0.999866, 0, 0.0163468, 0.996461, 0, 0.0840549, 0.98664, 0, 0.162914, 0.963781, 0, 0.266696, 0.935903, 0, 0.352257, 0.893231, 0, 0.449598, 0.839176, 0, 0.543859, 0.781838, 0, 0.623481, 0.729875, 0, 0.68358, 0.642799, 0, 0.766034, 0.532166, 2.17614e-05, 0.84664, 0.456939, 0, 0.889498, 0.382634, 5.41046e-05, 0.9239, 0.278528, 0, 0.960428, 0.179063, 0, 0.983838, 0.0858087, 0, 0.996312, -0.0490723, 0, 0.998795, 0.0245256, 0, 0.999699, -0.146738, 0, 0.989175, -0.242982, 0, 0.970031, -0.364448, 0, 0.931224, -0.471395, 0, 0.881922, -0.535013, 0, 0.844844, -0.615248, 0, 0.788333, -0.689552, 0, 0.724236, -0.757215, 0, 0.653166, -0.81759, 0, 0.575801, -0.870094, 0, 0.492885, -0.914216, 0, 0.405227, -0.95694, 0, 0.290285, -0.980784, 0, 0.195096, -0.989176, 0, 0.146737, -0.999807, 0, 0.0196603, -0.995185, 0, -0.0980138, -0.999807, 0, 0.0196603, -0.984431, 0, -0.17577, -0.956941, 0, -0.290284, -0.941544, 0, -0.336889, -0.891016, 0, -0.453972, -0.831472, 0, -0.555567, -0.785329, 0, -0.619078, -0.689545, 0, -0.724243, -0.634386, 0, -0.773016, -0.555566, 0, -0.831472, -0.449623, 0, -0.893218, -0.359906, 0, -0.932988, -0.290276, 0, -0.956943, -0.195086, 0, -0.980786, -0.0735776, 0, -0.997289, 0.0245259, 0, -0.999699, 0.122396, 0, -0.992481, 0.219093, 0, -0.975704, 0.313669, 0, -0.949532, 0.405227, 0, -0.914216, 0.492883, 0, -0.870096, 0.555567, 0, -0.831472, 0.595697, 0, -0.803209, 0.693072, 0, -0.720869, 0.788341, 0, -0.615238, 0.831468, 0, -0.555572, 0.857729, 0, -0.514103, 0.916179, 0, -0.400769, 0.95694, 0, -0.290287, 0.970031, 0, -0.242979, 0.992482, 0, -0.122393, 0.999699, 0, -0.0245259, 0.997289, 0, 0.0735776, 0.980786, 0, 0.195088, 0.95694, 0, 0.290287, 0.92388, 0, 0.382683, 0.881922, 0, 0.471395, 0.844844, 0, 0.535013, 0.788333, 0, 0.615249, 0.707107, 0, 0.707107, 0.634399, 0, 0.773006, 0.5957, 0, 0.803207, 0.488641, 0, 0.872485, 0.382693, 0, 0.923876, 0.336896, 0, 0.941542, 0.21433, 0, 0.976761, 0.0980138, 0, 0.995185, -0.300482, 0.949661, -0.088622, -0.313967, 0.945548, -0.0858152, -0.188687, 0.959399, -0.209643, -0.15719, 0.968817, -0.191532, -0.0970478, 0.984625, -0.14524, -0.24907, 0.967205, -0.0497839, -0.243818, 0.96683, -0.0761101, -0.200401, 0.979661, 0.0101545, -0.0304715, 0.997909, -0.0570063, -0.180747, 0.982736, 0.039505, -0.20351, 0.979064, 0.00410321, 0.00826661, 0.999767, 0.0199568, -0.158084, 0.981729, 0.105912, 0.031066, 0.994258, 0.102402, -0.146034, 0.971192, 0.188311, 0.0327088, 0.985846, 0.164433, 0.0232319, 0.971494, 0.235924, -0.150225, 0.950384, 0.272401, 0.0138807, 0.959039, 0.282934, -0.164555, 0.945335, 0.281538, -0.554926, 0.809868, 0.190187, -0.559274, 0.811291, 0.170352, -0.541668, 0.822152, 0.175104, -0.200017, 0.979731, 0.0109873, -0.523663, 0.829808, 0.192863, -0.218722, 0.975449, -0.0256886, -0.509558, 0.832232, 0.218495, -0.198981, 0.979917, 0.0129969, -0.501393, 0.828773, 0.248475, -0.503129, 0.820473, 0.27145, -0.512776, 0.80841, 0.289022, -0.525893, 0.808917, 0.262848, -0.70922, 0.603093, 0.365083, -0.73568, 0.60026, 0.313787, -0.733957, 0.608318, 0.302086, -0.730086, 0.613967, 0.300033, -0.727569, 0.615927, 0.302121, -0.727696, 0.613876, 0.305966, -0.732175, 0.608221, 0.306572, -0.743101, 0.600809, 0.294669, -0.755298, 0.60061, 0.262283, -0.795194, 0.448281, 0.408303, -0.818031, 0.444145, 0.365458, -0.81833, 0.451528, 0.355609, -0.819815, 0.455637, 0.346841, -0.82303, 0.453772, 0.341631, -0.824485, 0.455542, 0.335717, -0.829713, 0.451257, 0.328547, -0.836803, 0.444353, 0.31986, -0.743356, 0.593056, 0.309366, -0.746014, 0.594756, 0.299547, -0.851517, 0.448453, 0.271677, -0.840593, 0.335154, 0.425531, -0.865718, 0.330024, 0.376319, -0.874705, 0.321007, 0.363105, -0.877443, 0.329812, 0.348307, -0.893601, 0.334733, 0.29905, -0.877907, 0.218037, 0.426308, -0.899491, 0.21895, 0.378123, -0.900466, 0.222559, 0.373668, -0.903257, 0.218898, 0.369068, -0.918118, 0.217481, 0.331302, -0.893191, 0.134554, 0.429075, -0.91338, 0.135247, 0.383986, -0.9152, 0.137463, 0.378831, -0.916724, 0.135197, 0.375949, -0.93459, 0.13448, 0.329327, -0.895158, 0.10118, 0.434115, -0.907917, 0.101996, 0.406552, -0.920767, 0.103291, 0.376191, -0.929849, 0.101959, 0.353531, -0.940109, 0.099804, 0.325935, 0.00111699, -0.999999, 0.00124229, -0.0453022, -0.997352, -0.0568933, -0.02879, -0.998626, -0.0437815, -0.000785407, -0.999999, -0.0011944, 0.00260295, -0.999977, 0.00631783, 0.000318225, -1, 0.000768239, 0.015374, -0.9971, 0.0745295, 0.000241264, -0.999999, 0.00116789, 0.00730886, -0.997873, 0.0647775, -0.000287879, -0.999997, -0.00253987, -0.345267, 0.87846, 0.330302, -0.263434, 0.934672, 0.238726, -0.341478, 0.88204, 0.32465, -0.285144, 0.922986, 0.258438, -0.386307, 0.92235, 0.00610687, -0.353844, 0.935122, 0.0184824, -0.385707, 0.922427, 0.018961, -0.396163, 0.918157, 0.0065929, -0.472367, 0.881341, 0.0103716, -0.537332, 0.65615, 0.52985, -0.527649, 0.667092, 0.525904, -0.786355, 0.617763, 0.0037351, -0.710775, 0.70304, 0.0230739, -0.727585, 0.686017, 0.000127802, -0.651558, 0.389415, 0.651021, -0.65637, 0.376034, 0.654046, -0.914646, 0.404257, -0.00027339, -0.949716, 0.313099, 0.00295639, -0.697753, 0.17944, 0.6935, -0.699654, 0.171021, 0.693712, -0.973674, 0.227936, 0.00203041, -0.993134, 0.116895, 0.00454504, -0.709568, 0.00914409, 0.704578, -0.709766, 0.00932763, 0.704376, -0.998515, 0.0544097, 0.00269968, -0.999181, -0.0402463, 0.00425361, -0.703859, -0.124116, 0.699412, -0.704325, -0.118112, 0.699983, -0.996501, -0.083539, 0.00263955, -0.986468, -0.163922, 0.00338177, -0.680419, -0.237771, 0.693177, -0.685475, -0.219838, 0.694115, -0.975944, -0.217836, -0.00897342, -0.966457, -0.256668, -0.0090925, -0.648564, -0.409533, 0.641598, -0.66798, -0.359329, 0.651679, -0.932353, -0.361366, 0.01147, -0.911452, -0.411268, 0.0106513, 0.00317894, -0.999993, -0.00207166, 0.00992709, -0.999943, 0.00402934, 0.0119027, -0.9999, 0.00766377, 0.00782127, -0.999944, -0.00708875, 0.00385854, -0.999993, -0.000289744, 0.00313323, -0.999946, -0.00985179, 0.00427861, -0.999942, -0.00986986, 0.0106372, -0.999943, -0.000522913, -0.769962, 0.609252, 0.18966, -0.771666, 0.61019, 0.179443, -0.763666, 0.605604, 0.223736, -0.764412, 0.606043, 0.219968, -0.268161, 0.95149, 0.150849, -0.280196, 0.946231, 0.161667, -0.281683, 0.959393, -0.0148091, -0.246571, 0.968821, -0.0242806, -0.171282, 0.984633, -0.0340715, -0.198708, 0.969458, 0.143758, -0.15442, 0.977678, 0.142481, -0.0618255, 0.997911, -0.0187563, -0.0873541, 0.983083, 0.160986, 0.0199173, 0.999768, 0.00825012, -0.085294, 0.983263, 0.160993, -0.00990815, 0.979638, 0.200527, 0.0943627, 0.994259, 0.0504395, 0.0381429, 0.969625, 0.241602, -0.00211146, 0.978858, 0.204532, 0.139357, 0.985854, 0.093117, 0.196581, 0.967123, 0.161334, 0.08656, 0.950356, 0.298883, 0.0758357, 0.947768, 0.309814, 0.207652, 0.959958, 0.188048, -0.285811, 0.8091, 0.513486, -0.25706, 0.810085, 0.526956, -0.275003, 0.819815, 0.502272, -0.252643, 0.828284, 0.500117, -0.225793, 0.832091, 0.506599, -0.199769, 0.830307, 0.520271, -0.0117843, 0.979806, 0.199606, -0.179342, 0.822932, 0.539091, -0.00972901, 0.979612, 0.200665, 0.0269308, 0.975275, 0.21935, -0.169288, 0.811052, 0.559942, -0.185768, 0.809019, 0.557655, -0.251712, 0.602101, 0.757704, -0.298792, 0.600033, 0.742081, -0.30536, 0.608369, 0.732559, -0.304538, 0.613928, 0.728251, -0.300786, 0.615887, 0.728156, -0.292191, 0.615857, 0.731673, -0.296598, 0.613778, 0.731647, -0.300789, 0.615887, 0.728155, -0.300912, 0.608226, 0.734515, -0.317151, 0.600792, 0.733801, -0.363008, 0.603122, 0.71026, -0.31713, 0.444642, 0.837689, -0.270534, 0.448639, 0.851783, -0.327119, 0.451586, 0.830098, -0.333263, 0.455861, 0.825304, -0.340726, 0.453773, 0.823405, -0.300812, 0.615871, 0.728158, -0.345647, 0.455804, 0.820226, -0.300812, 0.615871, 0.728159, -0.299766, 0.61587, 0.72859, -0.35448, 0.451136, 0.819036, -0.365532, 0.444413, 0.817853, -0.413454, 0.448957, 0.792145, -0.298052, 0.33469, 0.89395, -0.34264, 0.33034, 0.879473, -0.359374, 0.321006, 0.876245, -0.374158, 0.329905, 0.8667, -0.424561, 0.335163, 0.841079, -0.330377, 0.217565, 0.918431, -0.369043, 0.218935, 0.903258, -0.373517, 0.222559, 0.900529, -0.377724, 0.218933, 0.899663, -0.42525, 0.218068, 0.878413, -0.328363, 0.134512, 0.934925, -0.374347, 0.135278, 0.917368, -0.379187, 0.137244, 0.915085, -0.382326, 0.135111, 0.914096, -0.427968, 0.134515, 0.893728, -0.324634, 0.0998641, 0.940553, -0.354534, 0.101994, 0.929464, -0.383849, 0.103291, 0.917601, -0.406594, 0.101951, 0.907903, -0.434222, 0.0997269, 0.895268, 0.0016682, -0.999999, 8.86081e-05, -0.0722666, -0.997352, -0.00817051, -0.0439334, -0.998993, -0.0090608, -0.00196001, -0.999998, -0.000404888, -0.000811153, -1, -0.000336003, 0.00727299, -0.999969, 0.00298669, 0.00115183, -0.999999, 0.00075741, 0.0634362, -0.997113, 0.0417247, 9.55784e-06, -1, 7.61161e-06, 0.0574554, -0.997298, 0.0457814, -0.0106342, 0.878445, 0.477726, -0.0174904, 0.934666, 0.355097, -0.0119265, 0.882011, 0.471077, -0.0190104, 0.922986, 0.384364, -0.329644, 0.878974, 0.344586, -0.237177, 0.935112, 0.263271, -0.259369, 0.922407, 0.286171, -0.326724, 0.881329, 0.341336, -0.00356467, 0.618986, 0.785394, -0.00500254, 0.687087, 0.726558, -0.526707, 0.665864, 0.528398, -0.533083, 0.654993, 0.535543, 0.000880003, 0.405643, 0.914031, -0.00270662, 0.314825, 0.949146, -0.651576, 0.388058, 0.651813, -0.655014, 0.374831, 0.656094, -0.00287002, 0.220105, 0.975472, -0.00431362, 0.11831, 0.992967, -0.693556, 0.178059, 0.698051, -0.694548, 0.169749, 0.699134, -0.00287995, 0.0555811, 0.99845, -0.00422884, -0.0387131, 0.999241, -0.704577, 0.00843208, 0.709577, -0.70457, 0.00806769, 0.709588, -0.00276385, -0.0857786, 0.99631, -0.0033666, -0.162509, 0.986701, -0.699057, -0.127761, 0.70356, -0.699866, -0.119379, 0.704228, 0.00625352, -0.219022, 0.9757, 0.00908771, -0.255164, 0.966855, -0.692483, -0.241895, 0.679672, -0.695884, -0.221366, 0.683186, -0.00484885, -0.409602, 0.912251, -0.0115001, -0.35949, 0.933078, -0.651172, -0.361267, 0.667429, -0.63697, -0.411223, 0.652046, 0.000783498, -0.999993, -0.00371926, 0.00986823, -0.999943, -0.00417684, 0.0138355, -0.9999, -0.00300817, 0.000518318, -0.999944, -0.0105437, 0.00274631, -0.999992, -0.00273276, -0.00475224, -0.999947, -0.00917998, -0.00395358, -0.999942, -0.0100053, 0.00715863, -0.999943, -0.00789837, -0.0886872, 0.949677, 0.300412, -0.0858128, 0.945549, 0.313965, -0.20967, 0.959389, 0.188711, -0.191569, 0.968805, 0.157221, -0.145212, 0.984631, 0.0970291, -0.0498644, 0.967217, 0.249009, -0.0199139, 0.976216, 0.215884, -0.0569784, 0.997911, 0.0304566, 0.0394771, 0.982757, 0.180639, 0.0199172, 0.999768, -0.00825022, 0.105911, 0.981729, 0.158084, 0.10239, 0.994259, -0.0310625, 0.188344, 0.971186, 0.146027, 0.164385, 0.985854, -0.0326994, 0.235961, 0.971485, -0.0232355, 0.272441, 0.950389, 0.150124, 0.282917, 0.959044, -0.0138798, 0.281466, 0.945355, 0.164562, 0.19017, 0.809864, 0.554937, 0.170318, 0.811283, 0.559295, 0.175049, 0.822144, 0.541699, 0.192837, 0.829806, 0.523676, 0.218091, 0.832235, 0.509727, 0.246005, 0.828973, 0.50228, 0.271511, 0.820464, 0.50311, 0.288949, 0.808471, 0.512722, 0.262782, 0.808931, 0.525906, 0.365039, 0.603086, 0.709248, 0.3138, 0.600262, 0.735673, 0.302112, 0.608321, 0.733944, 0.300011, 0.613966, 0.730095, 0.30325, 0.615926, 0.7271, 0.307585, 0.613787, 0.727087, 0.306553, 0.608223, 0.732181, 0.294924, 0.600773, 0.743029, 0.234335, 0.604392, 0.761444, 0.408327, 0.448284, 0.79518, 0.36547, 0.444146, 0.818026, 0.355662, 0.451533, 0.818305, 0.346895, 0.45564, 0.81979, 0.341681, 0.453772, 0.82301, 0.335614, 0.455546, 0.824525, 0.328466, 0.451264, 0.829742, 0.322919, 0.443965, 0.835834, 0.279021, 0.447633, 0.849571, 0.42555, 0.335155, 0.840582, 0.376301, 0.330023, 0.865727, 0.363054, 0.321007, 0.874726, 0.348285, 0.329814, 0.877451, 0.29908, 0.33473, 0.893592, 0.426331, 0.218038, 0.877896, 0.378123, 0.21895, 0.899491, 0.373664, 0.222559, 0.900468, 0.369077, 0.218897, 0.903253, 0.331584, 0.217466, 0.91802, 0.429083, 0.134554, 0.893187, 0.383983, 0.135156, 0.913395, 0.378837, 0.137463, 0.915198, 0.376014, 0.135196, 0.916698, 0.329521, 0.134474, 0.934523, 0.434109, 0.10118, 0.89516, 0.406573, 0.101997, 0.907907, 0.376281, 0.103291, 0.92073, 0.354521, 0.101942, 0.929475, 0.327136, 0.101139, 0.939549, 0.00136723, -0.999999, -0.000960813, -0.0568891, -0.997352, 0.0452988, -0.0437876, -0.998626, 0.0287941, -0.00119422, -0.999999, 0.000785287, 0.00641154, -0.999976, -0.00264177, 0.000768887, -1, -0.000318493, 0.074584, -0.997096, -0.0153853, 0.00116771, -0.999999, -0.000241226, 0.0648616, -0.997867, -0.00731837, -0.00254015, -0.999997, 0.000287912, 0.330296, 0.878446, 0.345307, 0.238737, 0.934666, 0.263447, 0.324677, 0.882019, 0.341508, 0.258457, 0.922986, 0.285126, 0.00610966, 0.922326, 0.386364, 0.0184843, 0.935108, 0.353881, 0.0189637, 0.922403, 0.385763, 0.00659726, 0.918119, 0.396251, 0.0103726, 0.88133, 0.472386, 0.529862, 0.656129, 0.537346, 0.525927, 0.667052, 0.527676, 0.00362923, 0.617746, 0.78637, 0.0230773, 0.702979, 0.710836, 0.000128362, 0.686007, 0.727595, 0.650997, 0.3895, 0.651531, 0.654038, 0.376064, 0.656361, -0.000276098, 0.404332, 0.914612, 0.00295435, 0.313158, 0.949696, 0.69349, 0.179416, 0.697769, 0.693708, 0.171055, 0.699649, 0.00203129, 0.227898, 0.973683, 0.00454741, 0.116793, 0.993146, 0.704581, 0.00907148, 0.709566, 0.704376, 0.00931136, 0.709766, 0.00270008, 0.0543853, 0.998516, 0.00425169, -0.0401274, 0.999186, 0.699455, -0.124193, 0.703803, 0.69998, -0.118137, 0.704323, 0.00263931, -0.0835165, 0.996503, 0.00351228, -0.163837, 0.986481, 0.693182, -0.237842, 0.68039, 0.694111, -0.219862, 0.685471, -0.00897318, -0.21777, 0.975959, -0.0090922, -0.256574, 0.966482, 0.641605, -0.40951, 0.648571, 0.651675, -0.359346, 0.667975, 0.0114717, -0.361262, 0.932394, 0.0106521, -0.411223, 0.911472, -0.00208068, -0.999993, -0.00318889, 0.00401651, -0.999943, -0.00994033, 0.00765334, -0.9999, -0.0119134, -0.00710442, -0.999944, -0.00783855, -0.000190061, -0.999992, -0.00386744, -0.00985181, -0.999946, -0.00313498, -0.00986994, -0.999942, -0.00428355, -0.000523609, -0.999943, -0.0106513, 0.150758, 0.951515, 0.268125, 0.161578, 0.946244, 0.280206, -0.0148373, 0.959399, 0.281662, -0.0242816, 0.968818, 0.246581, -0.0340792, 0.984626, 0.171321, 0.143634, 0.969489, 0.198644, 0.142563, 0.977656, 0.154479, -0.0187655, 0.997909, 0.0618558, 0.160987, 0.983082, 0.0873693, 0.00826601, 0.999767, -0.0199556, 0.16102, 0.983263, 0.0852427, 0.200529, 0.979638, 0.00990452, 0.0504455, 0.994258, -0.0943738, 0.241673, 0.96961, -0.0380905, 0.204532, 0.978858, 0.00211197, 0.0931448, 0.985846, -0.139398, 0.161246, 0.967119, -0.196675, 0.298925, 0.950352, -0.0864606, 0.309788, 0.947774, -0.0758646, 0.18815, 0.959944, -0.207623, 0.513262, 0.809238, 0.285824, 0.526932, 0.810096, 0.257073, 0.502264, 0.819837, 0.274952, 0.50015, 0.828292, 0.252551, 0.50649, 0.832173, 0.225734, 0.520308, 0.830276, 0.199802, 0.199608, 0.979805, 0.0117798, 0.539238, 0.822798, 0.179514, 0.200667, 0.979611, 0.00972433, 0.219355, 0.975273, -0.0269405, 0.560006, 0.810993, 0.169359, 0.557791, 0.808879, 0.185969, 0.759348, 0.602876, 0.244809, 0.741514, 0.599971, 0.300319, 0.732235, 0.60827, 0.306332, 0.728319, 0.614082, 0.304064, 0.728547, 0.615926, 0.299757, 0.731609, 0.613782, 0.296681, 0.734519, 0.608205, 0.300945, 0.733943, 0.600599, 0.317188, 0.710338, 0.602965, 0.363115, 0.849794, 0.44793, 0.277864, 0.837043, 0.444439, 0.319114, 0.830634, 0.451497, 0.325879, 0.82497, 0.455596, 0.334451, 0.823614, 0.453614, 0.340432, 0.820456, 0.455396, 0.34564, 0.818961, 0.45139, 0.354331, 0.81796, 0.444162, 0.365596, 0.792091, 0.449131, 0.413367, 0.893917, 0.334751, 0.298084, 0.878989, 0.330272, 0.343946, 0.875177, 0.321273, 0.361731, 0.865881, 0.329847, 0.3761, 0.841042, 0.33516, 0.424636, 0.918473, 0.217346, 0.330406, 0.90326, 0.218935, 0.369039, 0.900939, 0.222559, 0.372526, 0.899997, 0.218727, 0.377046, 0.878437, 0.218021, 0.425223, 0.934982, 0.134551, 0.328183, 0.917371, 0.135279, 0.37434, 0.915025, 0.137425, 0.379268, 0.914065, 0.13515, 0.382386, 0.893706, 0.134607, 0.427983, 0.939931, 0.101165, 0.32603, 0.929479, 0.102042, 0.354479, 0.917101, 0.10309, 0.385094, 0.907481, 0.102014, 0.407519, 0.895207, 0.0998247, 0.434327, 0.00018792, -0.999999, -0.00165651, -0.00817013, -0.997352, 0.0722633, -0.00905501, -0.998995, 0.0439053, -0.000404891, -0.999998, 0.00196002, -0.000331656, -1, 0.000800658, 0.00294407, -0.99997, -0.00717013, 0.000763667, -0.999999, -0.00116135, 0.0416869, -0.997119, -0.0633788, 7.32834e-06, -1, -9.2019e-06, 0.0456615, -0.99731, -0.0573446, 0.394655, 0.918806, 0.00651847, 0.355057, 0.934682, 0.0174423, 0.471027, 0.882038, 0.011924, 0.384967, 0.922911, 0.00604089, 0.384361, 0.922987, 0.0190102, 0.344517, 0.879008, 0.329625, 0.263315, 0.935119, 0.237103, 0.286139, 0.922425, 0.25934, 0.34131, 0.881348, 0.3267, 0.785376, 0.619007, 0.00388995, 0.709721, 0.704107, 0.0230145, 0.726502, 0.687146, 0.00499933, 0.528447, 0.665902, 0.526609, 0.535612, 0.655001, 0.533004, 0.914087, 0.405518, -0.000834446, 0.949183, 0.314709, 0.00318557, 0.652014, 0.388007, 0.651405, 0.656157, 0.374805, 0.654965, 0.975464, 0.220141, 0.00286915, 0.992949, 0.118458, 0.00450883, 0.698053, 0.17805, 0.693557, 0.699289, 0.169768, 0.694388, 0.998448, 0.0556128, 0.00287942, 0.999242, -0.0387049, 0.0042287, 0.70948, 0.00841655, 0.704676, 0.709589, 0.00805519, 0.70457, 0.996312, -0.0857639, 0.00275541, 0.986714, -0.162428, 0.00357933, 0.703507, -0.127802, 0.699103, 0.704173, -0.119404, 0.699917, 0.975711, -0.218972, -0.00623125, 0.966879, -0.255073, -0.00908742, 0.679661, -0.241952, 0.692473, 0.683132, -0.22141, 0.695923, 0.912283, -0.409533, 0.00485018, 0.93314, -0.359329, 0.0115026, 0.667402, -0.361362, 0.651147, 0.651974, -0.411254, 0.637024, -0.00371082, -0.999993, -0.000782753, -0.00416875, -0.999943, -0.0098681, -0.00299421, -0.9999, -0.0138353, -0.010544, -0.999944, -0.000518334, -0.00266274, -0.999992, -0.00281781, -0.00924834, -0.999946, 0.00482543, -0.010002, -0.999942, 0.00395681, -0.00788889, -0.999943, -0.00715004, 0.300484, 0.949661, 0.0886246, 0.313968, 0.945547, 0.0858172, 0.188687, 0.959399, 0.209644, 0.157189, 0.968818, 0.191531, 0.0970297, 0.984631, 0.145213, 0.249005, 0.967218, 0.0498593, 0.243788, 0.966842, 0.0760492, 0.200402, 0.979661, -0.0101543, 0.0304717, 0.997909, 0.0570067, 0.180747, 0.982736, -0.0395044, 0.203509, 0.979064, -0.00410343, -0.00826602, 0.999767, -0.0199554, 0.158081, 0.981729, -0.105921, -0.0310629, 0.994259, -0.102391, 0.146036, 0.971193, -0.188303, -0.0326993, 0.985854, -0.164385, -0.0232303, 0.971498, -0.235907, 0.150225, 0.950384, -0.272402, -0.0138804, 0.95904, -0.282929, 0.164555, 0.945335, -0.281537, 0.554931, 0.809866, -0.190179, 0.559289, 0.811286, -0.170329, 0.541697, 0.822144, -0.175051, 0.200018, 0.979731, -0.0109853, 0.523664, 0.829808, -0.192861, 0.218783, 0.975432, 0.0258089, 0.509557, 0.832232, -0.218498, 0.198982, 0.979917, -0.0129951, 0.501388, 0.828772, -0.248489, 0.503128, 0.820473, -0.271451, 0.512775, 0.80841, -0.289023, 0.525894, 0.808917, -0.262847, 0.711301, 0.602596, -0.361842, 0.735675, 0.600262, -0.313797, 0.733958, 0.608318, -0.302085, 0.730086, 0.613967, -0.300032, 0.727569, 0.615927, -0.302122, 0.728144, 0.613939, -0.30477, 0.732175, 0.608221, -0.306574, 0.743101, 0.600809, -0.29467, 0.755296, 0.600609, -0.262291, 0.795687, 0.448175, -0.407456, 0.818031, 0.444145, -0.365459, 0.818331, 0.451528, -0.355608, 0.819469, 0.455671, -0.347614, 0.822996, 0.453844, -0.341618, 0.824537, 0.455548, -0.335582, 0.829716, 0.451258, -0.328539, 0.836475, 0.4442, -0.32093, 0.746013, 0.594756, -0.299551, 0.851517, 0.448453, -0.271677, 0.743356, 0.593056, -0.309366, 0.840592, 0.335154, -0.425531, 0.865204, 0.330086, -0.377446, 0.87432, 0.321007, -0.364031, 0.878188, 0.329919, -0.346324, 0.893603, 0.334733, -0.299044, 0.877997, 0.218114, -0.426084, 0.899507, 0.218862, -0.378135, 0.899633, 0.222558, -0.37567, 0.902636, 0.218829, -0.370625, 0.918027, 0.217467, -0.331564, 0.893276, 0.134548, -0.4289, 0.913391, 0.135156, -0.383992, 0.915166, 0.137463, -0.378914, 0.916698, 0.135196, -0.376015, 0.934526, 0.134474, -0.32951, 0.894626, 0.0998503, -0.435516, 0.907897, 0.10195, -0.406606, 0.920291, 0.103291, -0.377352, 0.929494, 0.101943, -0.354471, 0.939576, 0.10114, -0.327058, -0.0011167, -0.999999, -0.00124193, 0.045301, -0.997352, 0.0568918, 0.0287891, -0.998626, 0.0437801, 0.000782325, -0.999999, 0.00118971, -0.00260448, -0.999977, -0.00632156, -0.000324634, -1, -0.000783712, -0.0153756, -0.9971, -0.0745372, -0.000242345, -0.999999, -0.00117312, -0.0073097, -0.997872, -0.0647849, 0.000285621, -0.999997, 0.00251994, 0.345266, 0.87846, -0.330302, 0.263434, 0.934672, -0.238726, 0.341478, 0.882041, -0.32465, 0.285144, 0.922986, -0.258438, 0.386309, 0.922349, -0.00610693, 0.353845, 0.935122, -0.0184825, 0.385708, 0.922426, -0.018961, 0.396161, 0.918157, -0.00659284, 0.472365, 0.881342, -0.0103716, 0.537331, 0.656152, -0.529849, 0.527648, 0.667095, -0.525902, 0.786358, 0.617761, -0.00362844, 0.710773, 0.703043, -0.0230737, 0.727586, 0.686017, -0.000127853, 0.651557, 0.389418, -0.65102, 0.656361, 0.376064, -0.654038, 0.914647, 0.404254, 0.000273291, 0.949715, 0.313101, -0.00295631, 0.697753, 0.179436, -0.693501, 0.699652, 0.171036, -0.69371, 0.973673, 0.227939, -0.00203031, 0.993134, 0.116898, -0.00454498, 0.709569, 0.00908781, -0.704578, 0.709767, 0.00929382, -0.704375, 0.998515, 0.0544096, -0.00269968, 0.99918, -0.040254, -0.00425374, 0.703859, -0.124117, -0.699412, 0.704325, -0.118113, -0.699983, 0.996501, -0.0835403, -0.00263957, 0.986467, -0.163922, -0.00351321, 0.680403, -0.237769, -0.693194, 0.685475, -0.219838, -0.694115, 0.975944, -0.217836, 0.00897342, 0.966457, -0.256667, 0.0090925, 0.648563, -0.409534, -0.641597, 0.667979, -0.359331, -0.651678, 0.932354, -0.361364, -0.0114701, 0.911453, -0.411267, -0.0106514, -0.00317919, -0.999993, 0.00207189, -0.00992731, -0.999943, -0.00402912, -0.011903, -0.9999, -0.00766347, -0.00782125, -0.999944, 0.00708874, -0.00386667, -0.999993, 0.000190023, -0.00313325, -0.999946, 0.00985179, -0.00427875, -0.999942, 0.00986987, -0.0106377, -0.999943, 0.000522939, 0.76996, 0.609251, -0.189669, 0.771665, 0.610189, -0.179453, 0.763666, 0.605604, -0.223737, 0.764412, 0.606043, -0.21997, 0.26812, 0.951505, -0.150829, 0.280151, 0.946259, -0.161583, 0.281716, 0.959384, 0.0147816, 0.24663, 0.968805, 0.0242864, 0.171289, 0.984632, 0.0340727, 0.198618, 0.969494, -0.143641, 0.154451, 0.977642, -0.142689, 0.0618291, 0.99791, 0.0187574, 0.0873264, 0.983083, -0.161005, -0.0199166, 0.999768, -0.00824983, 0.0253701, 0.980939, -0.192653, -0.0943758, 0.994258, -0.0504465, -0.0381433, 0.969625, -0.241602, -0.139396, 0.985846, -0.093143, -0.196624, 0.967109, -0.161369, -0.0865197, 0.950369, -0.298853, -0.0758358, 0.947784, -0.309764, -0.207566, 0.959941, -0.188228, 0.285797, 0.809058, -0.513561, 0.257046, 0.810102, -0.526937, 0.272766, 0.820263, -0.502759, 0.250644, 0.828594, -0.500609, 0.226711, 0.832088, -0.506193, 0.199698, 0.830387, -0.520171, 0.179053, 0.822732, -0.539492, 0.170368, 0.811109, -0.559533, 0.185974, 0.80888, -0.557788, 0.24155, 0.603321, -0.760038, 0.298376, 0.600277, -0.742051, 0.306232, 0.608281, -0.732268, 0.306294, 0.613881, -0.727554, 0.300887, 0.61583, -0.728162, 0.297293, 0.613816, -0.731332, 0.300297, 0.607953, -0.734993, 0.313211, 0.600283, -0.735907, 0.363007, 0.603062, -0.710311, 0.276884, 0.448123, -0.850012, 0.320033, 0.444332, -0.836748, 0.327134, 0.451585, -0.830093, 0.33444, 0.455596, -0.824974, 0.340349, 0.453844, -0.823522, 0.345056, 0.455748, -0.820506, 0.354612, 0.451146, -0.818974, 0.366639, 0.444402, -0.817364, 0.413488, 0.448875, -0.792174, 0.298046, 0.334782, -0.893918, 0.346074, 0.329932, -0.878281, 0.36181, 0.320878, -0.875289, 0.374179, 0.329752, -0.866749, 0.42467, 0.334978, -0.841098, 0.330121, 0.217394, -0.918564, 0.368666, 0.218951, -0.903408, 0.372525, 0.222324, -0.900998, 0.377731, 0.218933, -0.89966, 0.425007, 0.218009, -0.878545, 0.328188, 0.134551, -0.934981, 0.374346, 0.13515, -0.917387, 0.379243, 0.137591, -0.91501, 0.382378, 0.135188, -0.914063, 0.427814, 0.13451, -0.893802, 0.325957, 0.101032, -0.93997, 0.354437, 0.101995, -0.929501, 0.378645, 0.103224, -0.919768, 0.401901, 0.101904, -0.909995, 0.433167, 0.101156, -0.895619, -0.00168539, -0.999999, 0.000110719, 0.072106, -0.997364, 0.0081523, 0.0438159, -0.998999, 0.0090365, 0.00198324, -0.999998, 0.000409688, 0.000821678, -1, 0.000340363, -0.000714456, -1, -0.000265689, -0.00115295, -0.999999, -0.000758142, -0.0449881, -0.998549, -0.0295923, -1.03072e-05, -1, -8.2083e-06, -0.0572921, -0.997315, -0.0456197, 0.00651979, 0.918795, -0.394682, 0.0173499, 0.934674, -0.355083, 0.0119232, 0.882046, -0.471012, 0.00604117, 0.922908, -0.384973, 0.0190489, 0.922985, -0.384365, 0.3296, 0.87901, -0.344537, 0.237161, 0.935127, -0.263232, 0.259333, 0.922429, -0.286131, 0.32661, 0.881353, -0.341382, 0.00366971, 0.619029, -0.78536, 0.0230096, 0.704195, -0.709634, 0.00499734, 0.687136, -0.726512, 0.526575, 0.665961, -0.528408, 0.532978, 0.655047, -0.535583, -0.000835246, 0.40554, -0.914077, 0.00299479, 0.314732, -0.949176, 0.651397, 0.388038, -0.652004, 0.654966, 0.374802, -0.656158, 0.00289185, 0.220131, -0.975466, 0.0045123, 0.118309, -0.992967, 0.693566, 0.177968, -0.698064, 0.694391, 0.169738, -0.699293, 0.00287965, 0.0555991, -0.998449, 0.00402969, -0.0387585, -0.99924, 0.704674, 0.00836606, -0.709482, 0.70467, 0.00803894, -0.709489, 0.00276368, -0.0857636, -0.996312, 0.00367777, -0.162407, -0.986717, 0.69911, -0.127731, -0.703513, 0.69987, -0.119337, -0.704231, -0.00623124, -0.218968, -0.975712, -0.00911296, -0.255079, -0.966877, 0.692485, -0.241883, -0.679674, 0.695884, -0.221363, -0.683186, 0.00485081, -0.409499, -0.912298, 0.0115025, -0.359339, -0.933136, 0.651087, -0.361425, -0.667427, 0.637016, -0.411279, -0.651966, -0.000782888, -0.999993, 0.00371356, -0.00986817, -0.999943, 0.00417329, -0.0138353, -0.9999, 0.00299508, -0.000518928, -0.999944, 0.0105561, -0.00259245, -0.999993, 0.00286082, 0.00482788, -0.999946, 0.0092458, 0.00396339, -0.999942, 0.00999469, -0.0071411, -0.999943, 0.00787903, 0.0886036, 0.949667, -0.300468, 0.0858067, 0.945551, -0.31396, 0.209647, 0.959398, -0.18869, 0.191572, 0.968804, -0.157223, 0.145243, 0.984625, -0.0970496, 0.0498251, 0.967225, -0.248984, 0.0761102, 0.96683, -0.243818, -0.010209, 0.979666, -0.200373, 0.0569774, 0.997911, -0.030456, -0.0395487, 0.982737, -0.180729, -0.00416249, 0.97907, -0.203479, -0.0199169, 0.999768, 0.00825007, -0.105926, 0.981728, -0.15808, -0.102402, 0.994258, 0.0310661, -0.188316, 0.971191, -0.146033, -0.164435, 0.985845, 0.0327092, -0.235923, 0.971494, 0.0232318, -0.272402, 0.950384, -0.150225, -0.282929, 0.95904, 0.0138804, -0.281509, 0.945343, -0.164558, -0.190188, 0.809869, -0.554924, -0.170382, 0.811298, -0.559255, -0.175106, 0.822153, -0.541667, -0.0109859, 0.979731, -0.200018, -0.192883, 0.829809, -0.523654, 0.0256893, 0.975449, -0.218723, -0.218517, 0.832232, -0.509549, -0.0129999, 0.979917, -0.198979, -0.248491, 0.828772, -0.501387, -0.27145, 0.820473, -0.503129, -0.289023, 0.80841, -0.512775, -0.262829, 0.808921, -0.525897, -0.361789, 0.602588, -0.711335, -0.313788, 0.60026, -0.73568, -0.302086, 0.608318, -0.733957, -0.30001, 0.613966, -0.730096, -0.302094, 0.615927, -0.727581, -0.30473, 0.613941, -0.728159, -0.306572, 0.608222, -0.732175, -0.294668, 0.600809, -0.743101, -0.24354, 0.603234, -0.759472, -0.40746, 0.448176, -0.795685, -0.36546, 0.444145, -0.818031, -0.355609, 0.451528, -0.81833, -0.347615, 0.455671, -0.819468, -0.341653, 0.453844, -0.822982, -0.335715, 0.455542, -0.824486, -0.328539, 0.451258, -0.829716, -0.319857, 0.444325, -0.836819, -0.271668, 0.448454, -0.851519, -0.425558, 0.335156, -0.840578, -0.377447, 0.330086, -0.865204, -0.364989, 0.321006, -0.873921, -0.3483, 0.329813, -0.877446, -0.299044, 0.334733, -0.893603, -0.426084, 0.218114, -0.877997, -0.378121, 0.21895, -0.899492, -0.374553, 0.222559, -0.900099, -0.369073, 0.218898, -0.903255, -0.331298, 0.217481, -0.918119, -0.428888, 0.134547, -0.893282, -0.383985, 0.135247, -0.91338, -0.378837, 0.137463, -0.915197, -0.375947, 0.135197, -0.916725, -0.329325, 0.134481, -0.934591, -0.435613, 0.0998524, -0.894578, -0.413795, 0.102118, -0.904624, -0.383335, 0.103298, -0.917815, -0.353542, 0.101959, -0.929845, -0.325934, 0.099804, -0.94011, -0.00130036, -0.999999, 0.0010354, 0.0568126, -0.997359, -0.0452379, 0.0621265, -0.997232, -0.0408541, 0.00120815, -0.999999, -0.000794449, 0.000276715, -1, -0.000124995, -0.000763069, -1, 0.000316083, -0.0745238, -0.997101, 0.0153728, -0.00115122, -0.999999, 0.000237821, -0.0647717, -0.997873, 0.00730819, 0.00253998, -0.999997, -0.000287893, -0.330268, 0.878468, -0.345277, -0.238736, 0.934666, -0.263446, -0.324645, 0.882044, -0.341473, -0.258438, 0.922986, -0.285144, -0.00610684, 0.92235, -0.386307, -0.0184824, 0.935122, -0.353843, -0.0189609, 0.922427, -0.385706, -0.0065929, 0.918157, -0.396163, -0.0103701, 0.881357, -0.472336, -0.52987, 0.656117, -0.537354, -0.525889, 0.667116, -0.527633, -0.00362688, 0.617791, -0.786334, -0.023074, 0.703039, -0.710776, -0.000127069, 0.686031, -0.727573, -0.651024, 0.389403, -0.651562, -0.654047, 0.376031, -0.656371, 0.000276231, 0.404335, -0.914611, -0.00304672, 0.313235, -0.949671, -0.69348, 0.179505, -0.697756, -0.693704, 0.171094, -0.699644, -0.00202994, 0.227955, -0.97367, -0.00454829, 0.116754, -0.99315, -0.704578, 0.00914384, -0.709568, -0.704376, 0.00932749, -0.709766, -0.00270034, 0.0543692, -0.998517, -0.00425363, -0.0402474, -0.999181, -0.699412, -0.124116, -0.703859, -0.699983, -0.118113, -0.704325, -0.0026395, -0.0835342, -0.996501, -0.00351289, -0.163893, -0.986472, -0.693194, -0.23777, -0.680402, -0.694116, -0.219831, -0.685476, 0.00897334, -0.217815, -0.975949, 0.00909221, -0.256577, -0.966481, -0.641609, -0.409496, -0.648576, -0.651679, -0.35933, -0.66798, -0.0114703, -0.361346, -0.932361, -0.0106514, -0.411267, -0.911453, 0.0020734, -0.999993, 0.00318085, -0.00402635, -0.999943, 0.00993017, -0.00766368, -0.9999, 0.0119028, 0.00709723, -0.999944, 0.00783062, 0.000189881, -0.999992, 0.00386378, 0.00985179, -0.999946, 0.00313357, 0.00986987, -0.999942, 0.00427903, 0.000522942, -0.999943, 0.0106378, -0.15076, 0.951519, -0.26811, -0.161611, 0.946252, -0.280159, 0.0147815, 0.959384, -0.281715, 0.0242866, 0.968805, -0.246631, 0.0340735, 0.984631, -0.171292, -0.143771, 0.969468, -0.198652, -0.142487, 0.97768, -0.154402, 0.0187569, 0.99791, -0.0618276, -0.16099, 0.983083, -0.0873433, -0.0082512, 0.999768, 0.0199199, -0.192634, 0.980942, -0.0254063, -0.0504444, 0.994258, 0.0943718, -0.241597, 0.969626, 0.0381506, -0.093143, 0.985846, 0.139396, -0.161366, 0.96711, 0.19662, -0.298854, 0.950368, 0.0865216, -0.309764, 0.947784, 0.075835, -0.18827, 0.959936, 0.20755, -0.513492, 0.809105, -0.285787, -0.526958, 0.810087, -0.257048, -0.502075, 0.819968, -0.274906, -0.500144, 0.828291, -0.252569, -0.506589, 0.832102, -0.225772, -0.520172, 0.830387, -0.199694, -0.539299, 0.822878, -0.178967, -0.559507, 0.811118, -0.17041, -0.557779, 0.808883, -0.185986, -0.760094, 0.603242, -0.24157, -0.74205, 0.600277, -0.298379, -0.732473, 0.608456, -0.305392, -0.728243, 0.613953, -0.304505, -0.72888, 0.615666, -0.299482, -0.73168, 0.613773, -0.296525, -0.734914, 0.608139, -0.300114, -0.734695, 0.600629, -0.315385, -0.710376, 0.602956, -0.363057, -0.850023, 0.448097, -0.276893, -0.836761, 0.444303, -0.320039, -0.830093, 0.451585, -0.327135, -0.825389, 0.455673, -0.333308, -0.823415, 0.453932, -0.340491, -0.820298, 0.455561, -0.345797, -0.818961, 0.45139, -0.354331, -0.818491, 0.444033, -0.364565, -0.792171, 0.448875, -0.413493, -0.893919, 0.334783, -0.298044, -0.878638, 0.330222, -0.344889, -0.876093, 0.320843, -0.359891, -0.866722, 0.329834, -0.374169, -0.841071, 0.33508, -0.424643, -0.918564, 0.217394, -0.330121, -0.903408, 0.218951, -0.368666, -0.901316, 0.222523, -0.371636, -0.899676, 0.218845, -0.377742, -0.878549, 0.218009, -0.424999, -0.934996, 0.134423, -0.328196, -0.91737, 0.135279, -0.374341, -0.915048, 0.137591, -0.379152, -0.914084, 0.135201, -0.382322, -0.893803, 0.13451, -0.427812, -0.93997, 0.101032, -0.325957, -0.929503, 0.101995, -0.354431, -0.917534, 0.103291, -0.384007, -0.90788, 0.101937, -0.406649, -0.895655, 0.10125, -0.433071, -8.61201e-05, -0.999999, 0.00164627, 0.00815337, -0.997363, -0.0721155, 0.00903791, -0.998998, -0.0438227, 0.000409719, -0.999998, -0.00198339, 0.000340363, -1, -0.000821678, -0.00296194, -0.99997, 0.00721322, -0.000758138, -0.999999, 0.00115294, -0.0416352, -0.997126, 0.0633, -7.47124e-06, -1, 9.38153e-06, -0.0456919, -0.997306, 0.0573827, -0.477683, 0.878469, -0.0105342, -0.35509, 0.93467, -0.0174202, -0.470988, 0.882061, -0.0117835, -0.384362, 0.922986, -0.0190488, -0.344512, 0.879012, -0.32962, -0.263246, 0.935125, -0.237154, -0.286133, 0.922428, -0.259335, -0.341287, 0.881365, -0.326679, -0.785361, 0.619028, -0.00366977, -0.72651, 0.687137, -0.00499728, -0.528403, 0.665969, -0.52657, -0.535579, 0.655052, -0.532974, -0.914084, 0.405524, 0.000875636, -0.94918, 0.314718, -0.00299527, -0.652004, 0.388039, -0.651396, -0.656156, 0.374809, -0.654964, -0.975465, 0.220134, -0.00289176, -0.992966, 0.118317, -0.00451211, -0.697978, 0.177977, -0.693651, -0.699133, 0.169753, -0.694548, -0.998449, 0.0555971, -0.00287968, -0.999241, -0.0387506, -0.00402956, -0.709577, 0.00843158, -0.704577, -0.709589, 0.00805811, -0.70457, -0.996312, -0.0857624, -0.00276367, -0.986717, -0.162409, -0.00346421, -0.703564, -0.127721, -0.699061, -0.704175, -0.119373, -0.699919, -0.975715, -0.218957, 0.00625322, -0.966877, -0.25508, 0.00908744, -0.679691, -0.241884, -0.692468, -0.683185, -0.221374, -0.695882, -0.912298, -0.409499, -0.0048508, -0.933136, -0.359339, -0.0115025, -0.667384, -0.361423, -0.651131, -0.652012, -0.411327, -0.636939, 0.0037169, -0.999993, 0.000783052, 0.00417329, -0.999943, 0.00986817, 0.00299508, -0.9999, 0.0138353, 0.0105561, -0.999944, 0.000518928, 0.00286054, -0.999993, 0.0025922, 0.00917603, -0.999947, -0.00475607, 0.00999543, -0.999942, -0.00396316, 0.00787903, -0.999943, 0.0071411, -0.214876, 0.976641, -2.14977e-05, -0.211482, 0.977382, 0, -0.215508, 0.97556, -0.0428773, -0.222733, 0.973872, -0.0443059, -0.220312, 0.971154, -0.0912269, -0.225779, 0.969679, -0.0935226, -0.20974, 0.967657, -0.140172, -0.214085, 0.966284, -0.143049, -0.195528, 0.96101, -0.19552, -0.187558, 0.96418, -0.187558, -0.158385, 0.958496, -0.237066, -0.148282, 0.963725, -0.221916, -0.103219, 0.962926, -0.249236, -0.100642, 0.9648, -0.242966, -0.0459186, 0.971897, -0.230883, -0.0499984, 0.966604, -0.25135, 0, 0.996913, -0.0785176, 0, 0.999927, 0.0120858, 0, 0.996913, -0.0785176, 0, 0.999927, 0.0120858, -0.0499915, 0.966603, 0.251356, -0.0553576, 0.9589, 0.278292, -0.111097, 0.956919, 0.268259, -0.112327, 0.955953, 0.271176, -0.170346, 0.951825, 0.254972, -0.165012, 0.954874, 0.246953, -0.211278, 0.954319, 0.211272, -0.208122, 0.955704, 0.208122, -0.233949, 0.9596, 0.156321, -0.229761, 0.961068, 0.153488, -0.248201, 0.963238, 0.10281, -0.242619, 0.964906, 0.100465, -0.246573, 0.967882, 0.0490478, -0.239279, 0.969783, 0.0476057, -0.230722, 0.97302, 0, -0.235244, 0.971936, 0, -0.203544, 0.978228, -0.0404892, -0.229764, 0.972173, -0.0456963, -0.168643, 0.983199, -0.0698562, -0.192308, 0.978097, -0.0796443, -0.129917, 0.987717, -0.0868102, -0.149918, 0.983613, -0.100149, -0.0875739, 0.992301, -0.0875738, -0.098627, 0.990224, -0.0986361, -0.0506922, 0.995827, -0.0758913, -0.0475398, 0.996332, -0.0711471, -0.0230276, 0.998186, -0.0556243, -0.0221314, 0.998326, -0.0534289, -0.00503809, 0.999668, -0.0252899, -0.0069626, 0.999363, -0.0350023, 0, 0.999874, -0.0158785, 0, 0.999989, -0.00473601, -0.00384413, 0.999806, 0.0193252, 0.000567076, 0.999996, -0.00290103, -0.00879078, 0.999737, 0.0211883, -0.020412, 0.998576, 0.0492781, -0.0334066, 0.998192, 0.0499617, -0.0400669, 0.997396, 0.059963, -0.0743102, 0.994463, 0.0743103, -0.0836413, 0.992979, 0.0836505, -0.129658, 0.987767, 0.0866292, -0.111467, 0.990973, 0.0744813, -0.169985, 0.982929, 0.0703979, -0.147457, 0.987181, 0.0610799, -0.206207, 0.977649, 0.0410103, -0.180437, 0.982931, 0.0358925, -0.225405, 0.462346, 0.857572, -0.296963, 0.442084, 0.846389, -0.216209, 0.452012, 0.865412, -0.459189, 0.441682, 0.770755, -0.464427, 0.440798, 0.768117, -0.554135, 0.449109, 0.700882, -0.409468, 0.44871, 0.794352, -0.615318, 0.439046, 0.654692, -0.710093, 0.44366, 0.546748, -0.733745, 0.43835, 0.519103, -0.809467, 0.441757, 0.3868, -0.819533, 0.438875, 0.368449, -0.865933, 0.443297, 0.231619, -0.853411, 0.448011, 0.266413, -0.882642, 0.451906, 0.12932, -0.897349, 0.439993, 0.0342282, -0.889104, 0.457364, 0.0176531, -0.889189, 0.444436, -0.108717, -0.886047, 0.462868, 0.0259707, -0.88627, 0.462984, -0.0130438, -0.886286, 0.462923, 0.0140818, -0.886418, 0.4392, 0.146175, -0.886298, 0.462999, 0.0103619, -0.890471, 0.454821, 0.0141447, -0.884855, 0.462245, 0.0579771, -0.886286, 0.462923, 0.0140818, -0.900387, 0.435084, -0.00233972, -0.887523, 0.449048, -0.103241, -0.88682, 0.432437, -0.162938, -0.859195, 0.446019, -0.2507, -0.813082, 0.44083, -0.380218, -0.824612, 0.437164, -0.35903, -0.751708, 0.433958, -0.496604, -0.744818, 0.435627, -0.505445, -0.656169, 0.430392, -0.619842, -0.595458, 0.442627, -0.670456, -0.512285, 0.432326, -0.742063, -0.437977, 0.444945, -0.781153, -0.362, 0.431569, -0.826259, -0.239059, 0.44956, -0.860666, -0.185065, 0.433057, -0.882163, -0.017528, 0.454523, -0.890563, 0.0189123, 0.437693, -0.898926, 0.185238, 0.456965, -0.869982, 0.294591, 0.451319, -0.842335, 0.362649, 0.457882, -0.811683, 0.488475, 0.455339, -0.744351, 0.480636, 0.454593, -0.74989, 0.670808, 0.460111, -0.581649, 0.654586, 0.458793, -0.600855, 0.763527, 0.459312, -0.453937, 0.787496, 0.461745, -0.408217, 0.860438, 0.462614, -0.213624, 0.862753, 0.462871, -0.203492, 0.885777, 0.462645, -0.0368624, 0.886133, 0.462844, 0.023322, 0.86053, 0.462622, -0.213234, 0.859663, 0.462587, 0.216779, 0.868495, 0.463096, 0.176803, 0.810293, 0.462963, 0.359292, 0.784792, 0.461524, 0.413639, 0.684547, 0.461248, 0.564487, 0.665106, 0.45963, 0.588535, 0.525799, 0.458761, 0.716292, 0.505169, 0.457065, 0.732049, 0.337538, 0.455673, 0.823669, 0.383167, 0.459354, 0.80136, 0.235414, 0.46026, 0.856003, 0.0750465, 0.44561, 0.892076, 0.0343633, 0.458514, 0.888022, -0.129538, 0.441606, 0.887808, -0.309163, 0.949019, -0.0614923, -0.306045, 0.952017, 0, -0.296284, 0.9551, 0, -0.326351, 0.943016, -0.0649254, -0.308007, 0.942795, -0.127555, -0.318316, 0.938768, -0.131867, -0.290979, 0.936769, -0.194411, -0.292491, 0.936079, -0.195463, -0.262609, 0.928478, -0.262612, -0.24871, 0.936103, -0.248705, -0.22827, 0.911703, -0.3416, -0.192452, 0.938075, -0.288058, -0.181132, 0.880904, -0.437262, -0.146714, 0.92358, -0.354226, -0.115625, 0.80547, -0.581248, -0.0903377, 0.886316, -0.454184, 0, 0.698344, -0.715762, 0, 0.855416, -0.517941, 0, 0.677854, 0.735197, -0.0965008, 0.869084, 0.48516, -0.128341, 0.753186, 0.645167, 0, 0.835867, 0.548931, -0.207158, 0.840732, 0.500255, -0.149839, 0.920148, 0.361768, -0.254731, 0.888707, 0.381198, -0.20295, 0.930879, 0.303769, -0.290706, 0.91158, 0.29071, -0.263843, 0.92778, 0.263838, -0.320216, 0.92287, 0.213945, -0.311905, 0.926968, 0.208435, -0.341152, 0.929327, 0.141302, -0.339417, 0.930068, 0.140607, -0.342768, 0.936943, 0.0681774, -0.352884, 0.93303, 0.0702043, -0.324283, 0.94596, 0, -0.334111, 0.942534, 0, -0.275194, 0.95983, -0.0547341, -0.313622, 0.947496, -0.0623927, -0.270041, 0.956334, -0.111822, -0.223339, 0.970342, -0.0924982, -0.206141, 0.968777, -0.137759, -0.1723, 0.978297, -0.1151, -0.135703, 0.981411, -0.135707, -0.141644, 0.979732, -0.141639, -0.0902343, 0.986718, -0.135074, -0.092113, 0.986165, -0.137817, -0.0443998, 0.993244, -0.107215, -0.0463502, 0.992642, -0.111864, -0.0111459, 0.998365, -0.0560622, -0.0167063, 0.996331, -0.083936, 0, 0.999925, -0.0122154, 0, 0.999977, -0.00672776, -0.00309764, 0.999873, 0.0156061, -0.0121349, 0.998066, 0.0609614, -0.0235278, 0.998108, 0.0568013, -0.0405527, 0.994373, 0.0978673, -0.0630181, 0.993544, 0.0943382, -0.0816384, 0.98915, 0.122134, -0.114781, 0.986737, 0.114786, -0.119428, 0.985634, 0.119423, -0.170502, 0.978747, 0.113946, -0.15412, 0.982673, 0.102956, -0.227664, 0.969162, 0.0943123, -0.197637, 0.976852, 0.0818493, -0.246881, 0.967801, 0.0491018, -0.285321, 0.95675, 0.0567629, -0.28022, 0.61204, -0.739516, -0.370014, 0.592326, -0.71571, -0.201678, 0.597412, -0.776161, 0.0444626, 0.633893, -0.772142, 0.00971338, 0.609341, -0.792849, -0.0978158, 0.584769, -0.805281, 0.0532543, 0.582553, -0.811046, -0.0244096, 0.55905, -0.828775, 0.207836, 0.581764, -0.786355, 0.344737, 0.616126, -0.708199, 0.340967, 0.576143, -0.742833, 0.501207, 0.621633, -0.601967, 0.46236, 0.568947, -0.68009, 0.323416, 0.501444, -0.802468, 0.491734, 0.512758, -0.703758, 0.301859, 0.385782, -0.87181, 0.410551, 0.339832, -0.846145, 0.601682, 0.498035, -0.624452, 0.601717, 0.497991, -0.624453, 0.594382, 0.491993, 0.636123, 0.474149, 0.501679, 0.723534, 0.594417, 0.49195, 0.636124, 0.396145, 0.327908, 0.857639, 0.288252, 0.376153, 0.880579, 0.313645, 0.496222, 0.809562, 0.467455, 0.57115, 0.67474, 0.252144, 0.542063, 0.801618, 0.377984, 0.588628, 0.714594, 0.175671, 0.571746, 0.801403, 0.397989, 0.625545, 0.671043, 0.148821, 0.606068, 0.781366, -0.042444, 0.553032, 0.832079, -0.0621253, 0.593753, 0.802246, 0.029755, 0.613091, 0.789452, -0.18781, 0.600525, 0.777237, -0.0954515, 0.617984, 0.780375, -0.286482, 0.610854, 0.738095, -0.219291, 0.622065, 0.751629, -0.426193, 0.610591, 0.667486, -0.338128, 0.625392, 0.703245, -0.51572, 0.617477, 0.593932, -0.448398, 0.628216, 0.635833, -0.585858, 0.624662, 0.516302, -0.473124, 0.636585, 0.609026, -0.607385, 0.634849, 0.477546, -0.687955, 0.621688, 0.374461, -0.708808, 0.631918, 0.313481, -0.658815, 0.637194, 0.399933, -0.703681, 0.637467, 0.313798, -0.754587, 0.632423, 0.175041, -0.757934, 0.637509, 0.138269, -0.767735, 0.635886, 0.0789381, -0.770331, 0.637626, -0.00489193, -0.770372, 0.637576, -0.00491964, -0.768415, 0.63604, 0.0706539, -0.759254, 0.637436, -0.131183, -0.764608, 0.63289, -0.12176, -0.763182, 0.636986, -0.108636, -0.770331, 0.637625, -0.00497505, -0.734951, 0.636262, -0.234559, -0.717629, 0.637525, -0.280304, -0.692673, 0.634388, -0.343156, -0.713794, 0.630931, -0.304015, -0.669555, 0.62586, -0.399994, -0.572995, 0.637016, -0.515641, -0.582035, 0.625322, -0.519815, -0.46769, 0.636807, -0.612979, -0.466324, 0.625793, -0.62524, -0.502198, 0.619996, -0.602828, -0.357893, 0.622615, -0.69589, -0.412568, 0.613301, -0.673535, -0.425513, 0.446666, 0.787038, -0.547731, 0.425091, 0.720616, -0.424906, 0.446753, 0.787316, -0.88266, 0.461167, -0.0907566, -0.88246, 0.461063, -0.0931965, -0.879382, 0.459455, 0.124855, -0.880027, 0.459792, 0.118933, 0.859714, 0.462615, -0.216515, 0.81199, 0.453536, -0.367394, 0.859009, 0.46255, -0.219433, 0.202577, 0.167708, -0.964799, 0.189232, 0.156661, 0.969355, -0.770309, 0.637671, 0.000304467, -0.770309, 0.637671, 0.000303231, -0.00861617, -0.999963, -0.000855634, -4.65875e-10, -1, 0, -0.0139457, -0.999903, 0, -0.0138653, -0.999903, -0.00135375, -0.00849022, -0.999963, -0.00169766, -1.00442e-05, -1, 1.45485e-05, -0.00827486, -0.999963, -0.00249151, -5.87403e-06, -1, -2.55739e-05, -0.00801416, -0.999962, -0.00331132, -0.0128997, -0.999903, -0.00532, -0.00765381, -0.999962, -0.00410417, -0.0123031, -0.999903, -0.00659301, -0.00721832, -0.999962, -0.00481358, -0.0115992, -0.999903, -0.00770752, -0.00664291, -0.999963, -0.00549352, -0.0107815, -0.999903, -0.0088526, 5.56875e-06, -1, 1.11837e-05, -0.0098584, -0.999903, -0.00987006, 0.00548639, -0.999963, 0.0066882, -0.00883159, -0.999903, -0.0107662, 0.00481111, -0.999963, 0.00721463, -0.00777054, -0.999903, -0.0115649, 0.00410268, -0.999962, 0.00765104, -0.00654817, -0.999903, -0.0122816, 0.00331133, -0.999962, 0.00801416, -0.00534948, -0.999903, -0.0128581, 0.0025338, -0.999962, 0.00829648, -0.00401511, -0.999903, -0.0133353, 0.00169492, -0.999963, 0.0084764, -0.00273204, -0.999903, -0.0136631, 0.000854941, -0.999963, 0.00860909, -0.00137896, -0.999903, -0.0138858, 0, -1, 0, 0, -0.999903, -0.013946, 0.000854936, -0.999963, -0.00860909, -1.42973e-05, -1, 8.02668e-06, 0.00169491, -0.999963, -0.0084764, -0.00273165, -0.999903, 0.013661, 0.00249163, -0.999963, -0.00827525, -0.00401367, -0.999903, 0.0133306, 0.00331148, -0.999962, -0.00801452, -0.00536003, -0.999903, 0.0128835, 0.00410084, -0.999962, -0.00764759, -0.00657115, -0.999902, 0.0123246, 0.00480693, -0.999963, -0.00720839, -0.0077837, -0.999903, 0.0115846, 0.0054999, -0.999963, -0.00665069, 1.42379e-05, -1, -1.33693e-05, 5.57602e-06, -1, -1.11839e-05, 1.87205e-05, -1, -5.16382e-06, -0.00668043, -0.999963, 0.00548001, 2.18553e-05, -1, -1.46337e-05, -0.00720839, -0.999963, 0.00480694, 0.0115668, -0.999903, -0.00777181, -0.00764759, -0.999962, 0.00410084, -1.17925e-05, -1, 2.57552e-05, -0.0080138, -0.999962, 0.00331118, -1.65374e-05, -1, -1.13828e-05, -0.00829264, -0.999962, 0.00253264, 0.0133523, -0.999903, -0.00402024, -0.00847297, -0.999963, 0.00169423, -8.72407e-07, -1, -1.63945e-05, -0.00860848, -0.999963, 0.000854876, -0.0138657, -0.999903, 0.00135379, -1.39762e-09, -1, 0, -0.0139457, -0.999903, 0, 0.00858167, -0.999963, 0.000858313, -0.0138858, -0.999903, -0.00137897, 0.00847401, -0.999963, 0.00169444, 8.9187e-06, -1, -9.30589e-06, 0.00827525, -0.999963, 0.00249162, -0.0230246, -0.999711, -0.00694983, 0.0080141, -0.999962, 0.0033113, -0.0917885, -0.995052, -0.0380437, 0.00764829, -0.999962, 0.00410122, -0.0637245, -0.997387, -0.034046, 0.00720839, -0.999963, 0.00480694, -0.0115668, -0.999903, -0.00777179, 0.00687493, -0.99996, 0.00564282, -0.0111457, -0.999896, -0.00916091, 0.00786409, -0.999944, 0.00707497, -0.0130112, -0.999847, -0.0117056, 0.00690231, -0.99996, -0.005621, 0.009427, -0.99992, -0.00848103, -0.0110811, -0.999888, 0.0100231, -0.011101, -0.999897, 0.00912438, 0.0072045, -0.999963, -0.00480434, 3.57803e-05, -1, 2.61538e-05, 0.00765422, -0.999962, -0.00410439, 4.23301e-06, -1, -1.52744e-05, 0.00801683, -0.999962, -0.00331243, 2.53103e-05, -1, 1.67567e-05, 0.00829687, -0.999962, -0.00253393, 0.0133586, -0.999902, -0.00408317, 0.00844682, -0.999963, -0.00170041, 8.9199e-06, -1, 9.30507e-06, 0.00860864, -0.999963, -0.000854894, -0.0138858, -0.999903, 0.00137898, -0.0540759, -0.446263, 0.893267, -2.72301e-06, -0.446687, 0.89469, 0, -0.446687, 0.89469, -0.0877159, -0.446576, 0.890436, -0.15633, -0.446397, 0.881074, -0.0877159, -0.446576, 0.890436, -0.174639, -0.444858, 0.878409, -0.184909, -0.446449, 0.875495, -0.256415, -0.446439, 0.857288, -0.263436, -0.446496, 0.855128, -0.349756, -0.446417, 0.82364, -0.33308, -0.446301, 0.830586, -0.405377, -0.446401, 0.797744, -0.43113, -0.446456, 0.784095, -0.503707, -0.446461, 0.739562, -0.488682, -0.446497, 0.749554, -0.551065, -0.44659, 0.7049, -0.584168, -0.446542, 0.677752, -0.624833, -0.446686, 0.640355, -0.642936, -0.446628, 0.622219, -0.689147, -0.446688, 0.570567, -0.693817, -0.446642, 0.564915, -0.748189, -0.446461, 0.490802, -0.738052, -0.446482, 0.505898, -0.772568, -0.446224, 0.451689, -0.798966, -0.446351, 0.403019, -0.813152, -0.446173, 0.373782, -0.834648, -0.44631, 0.322755, -0.845848, -0.44624, 0.292252, -0.862221, -0.446399, 0.239381, -0.873768, -0.44638, 0.193064, -0.879533, -0.44645, 0.164634, -0.890438, -0.446576, 0.0876904, -0.890438, -0.446576, 0.0876904, -0.878408, -0.444858, 0.174644, -0.894648, -0.446666, 0.00976001, -0.890438, -0.446576, 0.0876904, -0.890438, -0.446576, 0.0876904, -0.895604, -0.444853, 8.38542e-05, -0.89469, -0.446687, 0, -0.890438, -0.446576, -0.0876877, -0.890438, -0.446576, -0.0876877, -0.895604, -0.444853, -8.38541e-05, -0.878194, -0.446472, -0.171574, -0.890439, -0.446576, -0.0876877, -0.890439, -0.446576, -0.0876877, -0.878409, -0.444858, -0.17464, -0.879533, -0.44645, -0.164631, -0.862222, -0.446399, -0.239377, -0.849814, -0.446338, -0.280354, -0.839144, -0.446176, -0.31107, -0.818241, -0.446329, -0.362315, -0.797742, -0.446401, -0.405382, -0.784095, -0.446456, -0.43113, -0.739557, -0.446461, -0.503715, -0.749555, -0.446497, -0.488679, -0.703276, -0.446566, -0.553156, -0.684868, -0.446622, -0.575747, -0.642908, -0.446674, -0.622216, -0.624835, -0.446686, -0.640354, -0.573723, -0.44663, -0.686559, -0.559741, -0.446667, -0.697982, -0.499947, -0.446506, -0.742081, -0.505903, -0.446482, -0.738049, -0.440777, -0.446378, -0.778757, -0.403022, -0.446351, -0.798965, -0.373788, -0.446173, -0.813149, -0.322766, -0.44631, -0.834643, -0.292261, -0.446239, -0.845845, -0.239376, -0.446399, -0.862222, -0.193087, -0.446394, -0.873756, -0.164631, -0.44645, -0.879533, -0.0877159, -0.446576, -0.890436, -0.0877159, -0.446576, -0.890436, -0.174643, -0.444858, -0.878408, -0.00976559, -0.446666, -0.894648, -0.0877159, -0.446576, -0.890436, -0.0877159, -0.446576, -0.890436, -8.38541e-05, -0.444853, -0.895604, 0, -0.446687, -0.89469, 0.0876904, -0.446576, -0.890438, 0.0876904, -0.446576, -0.890438, 8.38535e-05, -0.444853, -0.895604, 0.171574, -0.446472, -0.878194, 0.0876904, -0.446576, -0.890438, 0.0876904, -0.446576, -0.890438, 0.174644, -0.444858, -0.878408, 0.164631, -0.446451, -0.879533, 0.23938, -0.446399, -0.862221, 0.280335, -0.446396, -0.84979, 0.335403, -0.446395, -0.8296, 0.352184, -0.446409, -0.822609, 0.407642, -0.446421, -0.796578, 0.425227, -0.446449, -0.787316, 0.483741, -0.446416, -0.7528, 0.500336, -0.446471, -0.741841, 0.555032, -0.446665, -0.701733, 0.570409, -0.446689, -0.689277, 0.611901, -0.446947, -0.652545, 0.620611, -0.446835, -0.644345, 0.611905, -0.446947, 0.652542, 0.561551, -0.446687, 0.696513, 0.575624, -0.446686, 0.68493, 0.620607, -0.446836, 0.644349, 0.525235, -0.446252, 0.72456, 0.479387, -0.446372, 0.755606, 0.451689, -0.446224, 0.772568, 0.403025, -0.446351, 0.798963, 0.359849, -0.446351, 0.819316, 0.333079, -0.446301, 0.830586, 0.252457, -0.446488, 0.858437, 0.269823, -0.446474, 0.853145, 0.164631, -0.44645, 0.879533, 0.182332, -0.44646, 0.87603, 0.174644, -0.444858, 0.878408, 0.0876904, -0.446576, 0.890438, 0.0876904, -0.446576, 0.890438, 8.3853e-05, -0.444853, 0.895604, 0.0876904, -0.446576, 0.890438, 0.0876904, -0.446576, 0.890438, 0.00749552, -0.995719, 0.0921284, 0, -0.995863, 0.0908674, 7.77929e-07, -0.995861, 0.0908838, -0.00118864, -0.995832, 0.0912006, -0.0155576, -0.995847, 0.0897, -0.0101129, -0.995821, 0.090765, -0.0235626, -0.995849, 0.0879217, -0.0189811, -0.995823, 0.0893138, -0.0195631, -0.995719, 0.0903327, -0.027621, -0.995827, 0.0869763, -0.0409095, -0.995846, 0.0813474, -0.0360285, -0.995824, 0.0838842, -0.0431445, -0.995811, 0.0806174, -0.0505612, -0.99585, 0.0756666, -0.0440421, -0.99583, 0.0798977, -0.0505612, -0.99585, 0.0756666, -0.0450085, -0.995713, 0.0808132, -0.0516757, -0.995832, 0.0751588, -0.0636228, -0.995854, 0.0650222, -0.0642598, -0.995862, 0.0642625, -0.0702709, -0.99586, 0.0576684, -0.0713029, -0.995847, 0.0566061, -0.0646134, -0.99582, 0.0645569, -0.0798633, -0.995831, 0.0440638, -0.0755865, -0.99586, 0.0505025, -0.0702709, -0.99586, 0.0576684, -0.0805342, -0.99582, 0.0430905, -0.0838951, -0.995822, 0.0360631, -0.0808202, -0.995848, 0.041896, -0.0755865, -0.99586, 0.0505025, -0.0869229, -0.995832, 0.0276132, -0.0846055, -0.995853, 0.0334455, -0.0893201, -0.995821, 0.019014, -0.0873741, -0.995853, 0.0253333, -0.09077, -0.99582, 0.0101402, -0.0895511, -0.995849, 0.0162887, -0.0912029, -0.995832, 0.00121429, -0.0906282, -0.995854, 0.00780763, -0.0908838, -0.995861, 1.33048e-10, -0.0908675, -0.995863, 0, -0.0907373, -0.995852, -0.00669747, -0.0912028, -0.995832, -0.0012148, -0.0898402, -0.995846, -0.0148337, -0.0907698, -0.99582, -0.0101412, -0.0918318, -0.995718, -0.0106115, -0.0893113, -0.995823, -0.0189892, -0.0903303, -0.99572, -0.019569, -0.0869341, -0.99583, -0.0276405, -0.0813486, -0.995846, -0.0409073, -0.0838832, -0.995824, -0.0360303, -0.0805324, -0.99582, -0.0430932, -0.0755841, -0.99586, -0.0505061, -0.0798977, -0.99583, -0.0440421, -0.0755841, -0.99586, -0.0505061, -0.0722443, -0.995844, -0.0554584, -0.075185, -0.995831, -0.0516577, -0.065026, -0.995854, -0.0636191, -0.0642581, -0.995862, -0.0642642, -0.0576719, -0.99586, -0.070268, -0.056612, -0.995847, -0.071298, -0.0645602, -0.99582, -0.0646107, -0.0440645, -0.995831, -0.0798628, -0.0505023, -0.99586, -0.0755867, -0.0576719, -0.99586, -0.070268, -0.0430896, -0.99582, -0.0805348, -0.0360611, -0.995822, -0.0838961, -0.0418935, -0.995848, -0.0808215, -0.0505023, -0.99586, -0.0755867, -0.0276399, -0.99583, -0.0869344, -0.0207399, -0.99574, -0.0898473, -0.0190156, -0.995821, -0.0893196, -0.0118301, -0.995738, -0.0914641, -0.0101413, -0.99582, -0.0907698, -0.0162872, -0.995849, -0.0895514, -0.00121226, -0.995831, -0.0912031, -0.0078127, -0.995854, -0.0906277, 7.78462e-07, -0.995862, -0.0908838, 0.0162726, -0.995724, -0.0909392, 0.020263, -0.99579, -0.0894013, 0.00119044, -0.995832, -0.0912004, 0.0148318, -0.995846, -0.0898406, 0.0101412, -0.99582, -0.0907698, 0.0242617, -0.995852, -0.087699, 0.0189824, -0.995823, -0.0893134, 0.0453416, -0.99579, -0.0796624, 0.027622, -0.995827, -0.0869758, 0.0529365, -0.995784, -0.0749073, 0.0360435, -0.995819, -0.0839329, 0.0431447, -0.995811, -0.0806173, 0.0505609, -0.995851, -0.0756668, 0.044042, -0.99583, -0.0798978, 0.0505609, -0.995851, -0.0756668, 0.0563388, -0.995857, -0.0713743, 0.0518338, -0.995835, -0.0750056, 0.0735827, -0.995721, -0.0559011, 0.0690196, -0.9958, -0.0601556, 0.0735867, -0.995721, 0.0558975, 0.0518718, -0.995832, 0.0750199, 0.0572018, -0.995858, 0.0706677, 0.0689547, -0.995809, 0.0600874, 0.0440626, -0.995831, 0.0798641, 0.0505573, -0.995851, 0.0756692, 0.0431444, -0.995811, 0.0806175, 0.0360587, -0.995822, 0.0838974, 0.0540548, -0.995769, 0.0743078, 0.0505573, -0.995851, 0.0756692, 0.0276102, -0.995832, 0.0869241, 0.0465241, -0.995775, 0.0791711, 0.0189537, -0.995831, 0.0892229, 0.0253829, -0.995851, 0.087389, 0.0101132, -0.995821, 0.0907649, 0.0162907, -0.995849, 0.0895507, 0.00119125, -0.995832, 0.0912004, 0.00780799, -0.995854, 0.0906282, -0.0980176, 0, 0.995185, -0.0122764, 0, 0.999925, 0.0122709, 0, 0.999925, -0.114277, 0, 0.993449, -0.179035, 0, 0.983843, -0.211094, 0, 0.977466, -0.290287, 0, 0.95694, -0.290281, 0, 0.956941, -0.369681, 0, 0.929159, -0.397736, 0, 0.9175, -0.458979, 0, 0.888447, -0.471393, 0, 0.881923, -0.565732, 0, 0.824589, -0.555573, 0, 0.831468, -0.623486, 0, 0.781835, -0.646945, 0, 0.762536, -0.695451, 0, 0.718573, -0.707108, 0, 0.707105, -0.765165, 0, 0.643834, -0.773011, 0, 0.634392, -0.838223, 0, 0.545328, -0.822281, 0, 0.569082, -0.876723, 0, 0.480996, -0.881922, 0, 0.471396, -0.919113, 0, 0.393994, -0.930013, 0, 0.367526, -0.956941, 0, 0.290283, -0.956941, 0, 0.290283, -0.977952, 0, 0.208832, -0.980786, 0, 0.195086, -0.99345, 0, 0.11427, -0.995184, 0, 0.0980208, -0.999925, 0, 0.012274, -1, 0, 5.21193e-07, -0.995185, 0, -0.0980145, -0.995184, 0, -0.0980212, -0.983426, 0, -0.181311, -0.980786, 0, -0.195088, -0.960918, 0, -0.276832, -0.953306, 0, -0.302008, -0.929157, 0, -0.369685, -0.917501, 0, -0.397732, -0.88845, 0, -0.458974, -0.88192, 0, -0.4714, -0.824588, 0, -0.565733, -0.840442, 0, -0.541901, -0.788357, 0, -0.615218, -0.754922, 0, -0.655814, -0.729855, 0, -0.683602, -0.695453, 0, -0.718572, -0.653184, 0, -0.757199, -0.634392, 0, -0.773012, -0.555571, 0, -0.831469, -0.555568, 0, -0.831471, -0.460536, 0, -0.887641, -0.4714, 0, -0.88192, -0.405254, 0, -0.914204, -0.367533, 0, -0.930011, -0.303686, 0, -0.952772, -0.290282, 0, -0.956941, -0.208832, 0, -0.977952, -0.195091, 0, -0.980785, -0.0980231, 0, -0.995184, -0.0980205, 0, -0.995184, -0.014034, 0, -0.999901, -1.02853e-06, 0, -1, 0.08404, 0, -0.996462, 0.0980154, 0, -0.995185, 0.181312, 0, -0.983426, 0.195088, 0, -0.980786, 0.290284, 0, -0.956941, 0.290289, 0, -0.956939, 0.369689, 0, -0.929155, 0.382676, 0, -0.923883, 0.458977, 0, -0.888448, 0.471393, 0, -0.881923, 0.555568, 0, -0.831472, 0.555573, 0, -0.831468, 0.63429, 2.18422e-05, -0.773096, 0.646941, 0, -0.76254, 0.697128, 0, -0.716947, 0.697132, 0, -0.716943, 0.68701, 0, 0.726648, 0.634295, 2.18553e-05, 0.773091, 0.634393, 0, 0.773011, 0.697133, 0, 0.716942, 0.567181, 0, 0.823593, 0.545325, 0, 0.838225, 0.499992, 0, 0.86603, 0.446489, 0, 0.894789, 0.405253, 0, 0.914205, 0.36753, 0, 0.930012, 0.303679, 0, 0.952774, 0.290276, 0, 0.956943, 0.195084, 0, 0.980787, 0.195088, 0, 0.980786, 0.13051, 0, 0.991447, 0.0980127, 0, 0.995185, 0.00664067, 0.997826, 0.0655672, 0.00845817, 0.997807, 0.0656497, -0.000904142, 0.99791, 0.0646067, 0.0162714, 0.997784, 0.0645091, -0.0133628, 0.997915, 0.0631452, 0.00196123, 0.99781, 0.0661104, -0.0197595, 0.997909, 0.0615367, -0.0179644, 0.997915, 0.0619943, -0.0253948, 0.99792, 0.0592459, -0.0237033, 0.997919, 0.0599619, -0.0313795, 0.997911, 0.0564666, -0.0297126, 0.997918, 0.057247, -0.0249981, 0.997831, 0.0609045, -0.0349253, 0.997918, 0.0542237, -0.0415115, 0.997919, 0.0493506, -0.0294187, 0.997808, 0.059269, -0.0572142, 0.997776, 0.0341912, -0.0456398, 0.997915, 0.0456381, -0.057626, 0.997839, 0.0315732, -0.0505224, 0.997918, 0.0400919, -0.0603835, 0.997844, 0.0256948, -0.0464063, 0.997831, 0.0466958, -0.055966, 0.99791, 0.0323159, -0.0507196, 0.997833, 0.0419152, -0.05896, 0.997917, 0.0261845, -0.0545559, 0.997835, 0.0367192, -0.0612308, 0.997908, 0.0207676, -0.06198, 0.997917, 0.0179126, -0.0629051, 0.997919, 0.0141699, -0.0634929, 0.997915, 0.0115534, -0.0654795, 0.997837, -0.00574266, -0.0629164, 0.997832, 0.0193131, -0.0646044, 0.997846, -0.0114135, -0.0645091, 0.997784, 0.0162759, -0.0641899, 0.99791, -0.00738734, -0.0642797, 0.997917, -0.00554426, -0.0631465, 0.997915, -0.0133561, -0.063433, 0.997919, -0.0115772, -0.0615372, 0.997909, -0.0197579, -0.0660642, 0.997805, -0.00450684, -0.0592436, 0.99792, -0.0254003, -0.0598495, 0.99792, -0.0239375, -0.0564622, 0.997911, -0.0313877, -0.0507183, 0.997833, -0.0419176, -0.0609024, 0.997831, -0.0250013, -0.0463835, 0.997834, -0.0466418, -0.0581979, 0.997828, -0.0308752, -0.0505199, 0.997918, -0.0400949, -0.0457126, 0.997908, -0.0457128, -0.0456375, 0.997915, -0.0456404, -0.0315741, 0.997839, -0.0576253, -0.0400906, 0.997918, -0.0505235, -0.0376077, 0.99791, -0.0525459, -0.0466928, 0.997831, -0.0464083, -0.0443009, 0.997794, -0.0494416, -0.0419073, 0.997833, -0.0507238, -0.0392677, 0.997794, -0.0535348, -0.0239376, 0.99792, -0.0598495, -0.0337777, 0.997788, -0.057254, -0.00446558, 0.997806, -0.066052, -0.0141701, 0.997919, -0.062905, 0.00198194, 0.997805, -0.0661853, -0.00843604, 0.997909, -0.0640866, 0.00845248, 0.997807, -0.0656491, -0.0129953, 0.997833, -0.064508, 0.0162714, 0.997784, -0.0645091, 0.0193039, 0.997832, -0.0629173, -0.00664818, 0.997826, -0.065568, 0.0133524, 0.997915, -0.0631473, 0.0115704, 0.997919, -0.0634343, 0.0197585, 0.997909, -0.061537, 0.017947, 0.997921, -0.0619002, 0.0126215, 0.997836, -0.0645373, 0.0367168, 0.997835, -0.0545568, 0.018952, 0.997827, -0.0631002, 0.0419127, 0.997833, -0.0507209, 0.0250035, 0.997831, -0.060901, 0.0466341, 0.997834, -0.0463886, 0.031272, 0.997834, -0.0578691, 0.0513934, 0.997825, -0.0412751, 0.0514713, 0.997856, -0.0404143, 0.0585271, 0.997705, -0.0340448, 0.0429123, 0.997908, 0.0483488, 0.0585263, 0.997705, 0.0340456, 0.0514713, 0.997856, 0.0404143, 0.0513998, 0.997825, 0.0412697, 0.0488879, 0.997795, 0.0448794, 0.0351977, 0.997915, 0.054102, 0.0318062, 0.997917, 0.0561279, 0.0294831, 0.997917, 0.0573718, 0.0134911, 0.997845, 0.0642125, 0.0367259, 0.997835, 0.0545531, 0.0207592, 0.997908, 0.0612333, 0.0180066, 0.997919, 0.0619122, 0.0141646, 0.997919, 0.0629061, 0.0115792, 0.997919, 0.0634326, -0.00574946, 0.997837, 0.0654802, 0.0193078, 0.997832, 0.0629169, -0.0980107, 0, 0.995185, -0.0122823, 0, 0.999925, 2.82126e-06, 0, 1, -0.114288, 0, 0.993448, -0.195102, 0, 0.980783, -0.211093, 0, 0.977466, -0.258829, 0, 0.965923, -0.290298, 0, 0.956936, -0.359884, 0, 0.932997, -0.382684, 0, 0.923879, -0.458976, 0, 0.888449, -0.47139, 0, 0.881925, -0.555564, 0, 0.831474, -0.555508, 2.75984e-05, 0.831511, -0.62349, 0, 0.781831, -0.634383, 0, 0.773019, -0.695452, 0, 0.718573, -0.707103, 0, 0.70711, -0.765165, 0, 0.643834, -0.773017, 0, 0.634386, -0.831468, 0, 0.555573, -0.831471, 0, 0.555568, -0.881921, 0, 0.471397, -0.881922, 0, 0.471395, -0.923881, 0, 0.382681, -0.923874, 0, 0.382696, -0.95694, 0, 0.290286, -0.956943, 0, 0.290276, -0.977952, 0, 0.208829, -0.980784, 0, 0.195096, -0.995185, 0, 0.098019, -0.995186, 0, 0.0980019, -0.999902, 0, 0.0140289, -0.999925, 0, -0.0122734, -0.996462, 0, -0.0840471, -0.993452, 0, -0.114252, -0.980784, 0, -0.195095, -0.980787, 0, -0.195083, -0.960919, 0, -0.27683, -0.95694, 0, -0.290286, -0.929159, 0, -0.369681, -0.930005, 0, -0.367548, -0.88192, 0, -0.4714, -0.887638, 0, -0.460542, -0.831471, 0, -0.555569, -0.831466, 0, -0.555576, -0.773017, 0, -0.634386, -0.773007, 0, -0.634398, -0.716959, 0, -0.697115, -0.718564, 0, -0.695461, -0.643823, 0, -0.765174, -0.634452, -1.38497e-05, -0.772962, -0.555569, 0, -0.831471, -0.569076, 0, -0.822285, -0.482181, 0, -0.876072, -0.446568, -1.70258e-07, -0.89475, -0.382685, 0, -0.923879, -0.367535, 0, -0.930009, -0.2903, 0, -0.956936, -0.29029, 0, -0.956939, -0.208844, 0, -0.977949, -0.211105, 0, -0.977463, -0.110228, 0, -0.993906, -0.114288, 0, -0.993448, -0.0109193, 0, -0.99994, -0.0163485, 0, -0.999866, 0.0857909, 0, -0.996313, 0.114279, 0, -0.993449, 0.181308, 0, -0.983426, 0.195191, 3.90206e-05, -0.980765, 0.290286, 0, -0.95694, 0.290289, 0, -0.956939, 0.352256, 0, -0.935904, 0.382682, 0, -0.92388, 0.471475, 6.08224e-06, -0.881879, 0.460534, 0, -0.887642, 0.555569, 0, -0.83147, 0.541905, 0, -0.84044, 0.634387, 0, -0.773016, 0.624872, 0, -0.780727, 0.697127, 0, -0.716948, 0.693096, 0, -0.720845, 0.678805, 0, 0.734318, 0.62486, 0, 0.780737, 0.634399, 0, 0.773006, 0.697132, 0, 0.716942, 0.541865, 2.98476e-05, 0.840466, 0.55557, 0, 0.83147, 0.471402, 0, 0.881918, 0.460536, 0, 0.887641, 0.395612, 0, 0.918418, 0.367532, 0, 0.930011, 0.303683, 0, 0.952773, 0.290287, 0, 0.956939, 0.195094, 0, 0.980785, 0.195086, 0, 0.980786, 0.111964, 0, 0.993712, 0.0980019, 0, 0.995186, 0.0138636, 0.999903, 0.00135359, -0.0138659, 0.999903, -0.00135381, 0, 1, 0, 0, 1, 0, -1.15995e-06, 1, 1.6346e-05, -1.16352e-05, 1, -1.8871e-05, -0.013349, 0.999903, -0.00401927, 0.0133535, 0.999903, 0.0040206, -0.0128674, 0.999903, -0.00535334, 0.0128744, 0.999903, 0.00535622, 2.08575e-05, 1, -1.87016e-06, 3.50881e-07, 1, 1.32031e-05, 3.59029e-05, 1, -2.61087e-05, 2.9928e-06, 1, -4.7557e-05, 0.0108078, 0.999902, 0.00887851, -0.0107703, 0.999903, -0.00883493, -0.00986963, 0.999903, -0.00985795, 0.00986385, 0.999903, 0.00985222, -0.00885656, 0.999903, -0.0107864, 0.00885173, 0.999903, 0.0107805, -0.00771817, 0.999903, -0.0116152, 0.0078033, 0.999902, 0.0116132, -0.00658659, 0.999903, -0.0122911, 0.00658735, 0.999903, 0.0122924, -0.00531492, 0.999903, -0.0128875, -2.34759e-05, 1, -1.26765e-05, -0.00401662, 0.999903, -0.0133403, -2.98071e-05, 1, -1.98668e-05, 1.23983e-05, 1, -2.08632e-05, -1.4964e-05, 1, 8.04255e-06, 0.00135382, 0.999903, 0.0138659, -0.00135569, 0.999903, -0.0138848, 0, 1, 0, 0, 1, 0, -0.00135569, 0.999903, 0.0138848, 0.00135655, 0.999902, -0.0138937, -1.40124e-05, 1, -1.28201e-05, 1.33958e-05, 1, 1.58355e-05, 0.00402035, 0.999903, -0.0133526, -0.00402441, 0.999903, 0.013366, 0.00536079, 0.999903, -0.0128854, -0.00535915, 0.999903, 0.0128814, -1.29089e-05, 1, -2.09817e-07, 2.26696e-05, 1, -1.80531e-05, -0.00771802, 0.999903, 0.011615, 0.0077945, 0.999902, -0.0116, -6.82309e-06, 1, 2.31524e-06, -4.82903e-05, 1, 4.304e-05, 0.00986712, 0.999902, -0.00987878, -0.00987143, 0.999902, 0.00988305, 0.0107911, 0.999902, -0.00886045, -0.0107965, 0.999902, 0.00886489, 0.011624, 0.999903, -0.00772408, -0.0116132, 0.999902, 0.00780332, -2.01449e-07, 1, -1.28936e-05, -4.24052e-06, 1, 1.52788e-05, -0.0128677, 0.999903, 0.00535345, 0.0128721, 0.999903, -0.00535529, -0.0133487, 0.999903, 0.00401917, 0.0133646, 0.999903, -0.00402396, 1.1096e-06, 1, -1.68092e-05, -1.14998e-05, 1, 1.8872e-05, 0.0138645, 0.999903, -0.00135368, -0.0138657, 0.999903, 0.00135382, 0, 1, 0, 0, 1, 0, -0.0138644, 0.999903, -0.0013537, 0.0138657, 0.999903, 0.0013538, -2.07116e-06, 1, 1.61315e-05, 6.12516e-06, 1, -1.53308e-05, 8.74136e-06, 1, -2.11434e-05, -0.0133355, 0.999903, -0.00401519, -0.0128587, 0.999903, -0.00534975, -1.24517e-05, 1, 2.2074e-05, 2.03597e-07, 1, -1.28977e-05, 1.72964e-05, 1, 2.22522e-05, -1.72211e-05, 1, 3.85781e-05, 1.99299e-05, 1, 6.28774e-05, 0.000476146, 1, 0.000421481, -0.000464881, 1, -0.000412238, 0.00651262, 0.999962, 0.00582259, -0.00639843, 0.999963, -0.00572009, 0.000463574, 1, -0.000411193, -0.00048119, 1, 0.000358966, 0.00563954, 0.999971, -0.00511021, -0.00744992, 0.99995, 0.00666001, 0.0115774, 0.999903, -0.00777885, -0.0115795, 0.999903, 0.00769568, 6.39276e-06, 1, -2.288e-05, 0.0122995, 0.999903, -0.00655775, -9.18868e-06, 1, -2.34139e-05, 0.0128946, 0.999903, -0.00531787, 2.00993e-06, 1, 2.31996e-05, 1.51054e-05, 1, -2.83732e-05, 2.01415e-05, 1, 1.25396e-05, -1.23576e-05, 1, -1.41028e-05, -0.0138839, 0.999903, 0.0013556, 0.0138935, 0.999902, -0.00135655, -0.624722, 1.57269e-05, 0.780847, -0.634392, 0, 0.773012, -0.678804, 0, 0.73432, -0.695478, 0, 0.718547, -0.566887, 0, 0.823796, -0.57069, 0, 0.821165, -0.55763, 0, 0.830089, -0.459291, 0, 0.888286, -0.44598, 0, 0.895043, -0.355489, 0, 0.93468, -0.302634, 0, 0.953107, -0.274598, 0, 0.961559, -0.208832, 0, 0.977952, -0.195082, 0, 0.980787, -0.0980201, 0, 0.995184, -0.114277, 0, 0.993449, -0.0109187, 0, 0.99994, 0.0163496, 0, 0.999866, 0.0980197, 0, 0.995184, 0.114276, 0, 0.993449, 0.195087, 0, 0.980786, 0.195086, 0, 0.980786, 0.263357, 0, 0.964698, 0.290305, 0, 0.956934, 0.371314, 0, 0.928508, 0.382699, 0, 0.923873, 0.471392, 0, 0.881924, 0.471386, 0, 0.881927, 0.555551, 0, 0.831483, 0.555554, 0, 0.831481, 0.643819, 0, 0.765178, 0.634407, 0, 0.773, 0.707107, 0, 0.707107, 0.718561, 0, 0.695464, 0.762546, 0, 0.646934, 0.780739, 0, 0.624857, 0.824589, 0, 0.565733, 0.840421, 0, 0.541935, 0.887632, 0, 0.460553, 0.881924, 0, 0.471391, 0.923869, 0, 0.382709, 0.934245, 0, 0.356633, 0.956936, 0, 0.290298, 0.964705, 0, 0.263332, 0.980786, 0, 0.195086, 0.983844, 0, 0.179027, 0.993711, 0, 0.111972, 0.993453, 0, 0.114242, 0.999699, 0, 0.0245439, 1, 0, 1.23957e-06, 0.996462, 0, -0.0840491, 0.995184, 0, -0.0980209, 0.983426, 0, -0.181311, 0.983844, 0, -0.179028, 0.963781, 0, -0.266693, 0.961561, 0, -0.274591, 0.932995, 0, -0.35989, 0.923882, 0, -0.382676, 0.888455, 0, -0.458964, 0.881931, 0, -0.471379, 0.83919, 0, -0.543839, 0.831475, 0, -0.555562, 0.773005, 0, -0.6344, 0.773019, 0, -0.634383, 0.707103, 0, -0.707111, 0.707111, 0, -0.707103, 0.634386, 0, -0.773016, 0.634383, 0, -0.773019, 0.555574, 0, -0.831467, 0.569103, 0, -0.822266, 0.482189, 0, -0.876067, 0.471413, 0, -0.881913, 0.382685, 0, -0.923879, 0.382675, 0, -0.923883, 0.278529, 0, -0.960428, 0.290276, 0, -0.956943, 0.211093, 0, -0.977466, 0.179027, 0, -0.983844, 0.110226, 0, -0.993906, 0.114275, 0, -0.993449, 1.09659e-05, 0, -1, 0.0163498, 0, -0.999866, -0.0857981, 0, -0.996313, -0.114244, 0, -0.993453, -0.19509, 0, -0.980785, -0.195082, 0, -0.980787, -0.301995, 0, -0.95331, -0.290276, 0, -0.956943, -0.369685, 0, -0.929157, -0.397728, 0, -0.917503, -0.458971, 0, -0.888451, -0.471387, 0, -0.881927, -0.528073, 0, -0.849199, -0.555553, 0, -0.831481, -0.615209, 0, -0.788364, -0.634385, 0, -0.773017, -0.678797, 0, -0.734326, -0.695432, 0, -0.718592, 0.00138609, 0.999998, -0.00138609, 0.00878231, 0.999923, -0.00878231, 0.0161445, 0.999739, -0.0161445, 0.00140518, 0.999998, -0.00140518, -0.00102207, 0.999999, -0.00102207, -0.00100917, 0.999999, -0.00100917, 0.0145391, 0.999789, 0.0145391, -0.00103138, 0.999999, -0.00103138, -0.0506586, -0.995842, 0.0757161, -0.0506585, -0.995842, 0.0757161, -0.0210843, -0.991093, 0.131496, -0.0756473, -0.995849, 0.0506126, -0.0756473, -0.995849, 0.0506127, -0.0756599, -0.995849, -0.0505937, -0.07566, -0.995849, -0.0505938, -0.0210843, -0.991093, -0.131496, -0.0506008, -0.995849, -0.0756553, -0.131508, -0.991091, -0.0210763, -0.0506008, -0.995849, -0.0756553, 0.0506601, -0.995842, -0.0757151, 0.05066, -0.995842, -0.075715, 0.0506467, -0.995842, 0.075724, 0.0506467, -0.995842, 0.075724, -0.0877103, -0.446627, 0.890411, -0.0877103, -0.446627, 0.890411, -0.150579, -0.445731, 0.882411, -0.0702919, -0.995855, 0.0577305, -0.110245, -0.993866, 0.00875617, -0.0702919, -0.995855, 0.0577304, -0.882409, -0.445731, 0.150595, -0.890411, -0.446627, 0.0877103, -0.890411, -0.446627, 0.0877103, -0.890411, -0.446627, -0.0877123, -0.890411, -0.446627, -0.0877123, -0.882408, -0.445731, -0.150597, -0.0577202, -0.995855, -0.0703003, -0.00875686, -0.993866, -0.110244, -0.0577202, -0.995855, -0.0703003, -0.150598, -0.445731, -0.882408, -0.0877123, -0.446627, -0.890411, -0.0877123, -0.446627, -0.89041, 0.0877122, -0.446627, -0.890411, 0.0877122, -0.446627, -0.890411, 0.150598, -0.445731, -0.882408, 0.150578, -0.445732, 0.882411, 0.0877122, -0.446627, 0.890411, 0.0877122, -0.446627, 0.890411, -0.890407, -0.446633, 0.0877174, -0.890407, -0.446633, 0.0877174, -0.894716, -0.445809, 0.0271695, -0.894716, -0.445809, -0.0271695, -0.890407, -0.446633, -0.0877174, -0.890407, -0.446633, -0.0877174, -0.0877168, -0.446632, -0.890407, -0.0877168, -0.446633, -0.890407, -0.0271695, -0.445809, -0.894716, 0.0271695, -0.445809, -0.894716, 0.0877174, -0.446633, -0.890407, 0.0877174, -0.446633, -0.890407, 0.0877174, -0.446633, 0.890407, 0.0877174, -0.446633, 0.890407, 0.0271695, -0.445809, 0.894716, 0.114275, 0, -0.993449, 1.09659e-05, 0, -1, 0.179027, 0, -0.983844, 0.278529, 0, -0.960428, 0.382685, 0, -0.923879, 0.471413, 0, -0.881913, 0.555574, 0, -0.831467, 0.634386, 0, -0.773016, 0.707103, 0, -0.707111, 0.773005, 0, -0.6344, 0.83919, 0, -0.543839, 0.888455, 0, -0.458964, 0.932995, 0, -0.35989, 0.961561, 0, -0.274591, 0.983426, 0, -0.181311, 0.996462, 0, -0.0840491, 0.999699, 0, 0.0245439, 0.993453, 0, 0.114242, 0.980786, 0, 0.195086, 0.956936, 0, 0.290298, 0.923869, 0, 0.382709, 0.881924, 0, 0.471391, 0.824589, 0, 0.565733, 0.762546, 0, 0.646934, 0.718561, 0, 0.695464, 0.643819, 0, 0.765178, 0.555551, 0, 0.831483, 0.471386, 0, 0.881927, 0.382699, 0, 0.923873, 0.290305, 0, 0.956934, 0.195087, 0, 0.980786, 0.114276, 0, 0.993449, -0.0109187, 0, 0.99994, -0.114277, 0, 0.993449, -0.208832, 0, 0.977952, -0.274598, 0, 0.961559, -0.355489, 0, 0.93468, -0.459291, 0, 0.888286, -0.566887, 0, 0.823796, -0.634392, 0, 0.773012, -0.678804, 0, 0.73432, -0.634385, 0, -0.773017, -0.678797, 0, -0.734326, -0.555553, 0, -0.831481, -0.458971, 0, -0.888451, -0.369685, 0, -0.929157, -0.290276, 0, -0.956943, -0.19509, 0, -0.980785, -0.114244, 0, -0.993453, 0.193361, -0.961885, -0.193361, -0.0336781, -0.998865, 0.0336781, -0.201099, -0.958706, 0.201099, 0.584124, -0.563559, -0.584124, 0.532947, -0.657217, -0.532947, 0.264637, -0.927327, -0.264637, 0.181014, -0.966679, -0.181014, 0.695509, 0.18037, -0.695509, 0.686606, -0.239049, -0.686606, 0.0161445, 0.999739, -0.0161445, 0.00878231, 0.999923, -0.00878231, 0.657832, 0.366761, -0.657832, 0.707106, -0.00137093, -0.707106, 0.139876, 0.98024, -0.139876, 0.00606651, 0.999963, -0.00606651, -0.707107, 0, 0.707107, -0.707105, 0, 0.707109, -0.707107, 0, 0.707107, -0.707107, 0, 0.707107, 0.707093, 0, -0.70712, 0.51588, 0.683912, -0.51588, 0.515882, 0.683909, -0.515882, 0.707107, 0, -0.707107, -0.499994, 0.707115, 0.499994, -0.707107, 0, 0.707107, 0.00136852, 0.999998, -0.00136852, 0.00140911, 0.999998, -0.00140911, 0.00140722, 0.999998, -0.00140722, 0.00606651, 0.999963, -0.00606651, 0.00140898, 0.999998, -0.00140898, 0.00140078, 0.999998, -0.00140078, 0.00134467, 0.999998, -0.00134467, 0.00130472, 0.999998, -0.00130472, 0.193366, -0.961883, 0.193366, -0.0336788, -0.998865, -0.0336788, -0.2011, -0.958706, -0.2011, 0.584123, -0.563561, 0.584123, 0.53295, -0.657213, 0.53295, 0.264636, -0.927327, 0.264636, 0.181018, -0.966677, 0.181018, 0.695509, 0.18037, 0.695509, 0.686605, -0.239053, 0.686605, 0.0145391, 0.999789, 0.0145391, 0.0895619, 0.991946, 0.0895619, 0.707107, -0.000685469, 0.707107, 0.657832, 0.366761, 0.657832, 0.00509553, 0.999974, 0.00509553, 0.139264, 0.980414, 0.139264, -0.707107, 0, -0.707107, -0.707107, 0, -0.707107, -0.707106, 0, -0.707108, -0.707107, 0, -0.707107, 0.707107, 0, 0.707107, 0.515878, 0.683915, 0.515878, 0.707107, 0, 0.707107, -0.70706, 0, -0.707154, -0.50001, 0.707092, -0.50001, 0.139876, 0.98024, -0.139876, 0.0895619, 0.991946, 0.0895619, -0.00101376, 0.999999, -0.00101376, -0.00101399, 0.999999, -0.00101399, -0.00102348, 0.999999, -0.00102348, -0.00100577, 0.999999, -0.00100577, -0.00103877, 0.999999, -0.00103877, -0.00111188, 0.999999, -0.00111188, 0.00509553, 0.999974, 0.00509553, 0.139264, 0.980414, 0.139264, 0.547508, 0.388525, 0.741137, 0.574623, 0.348043, 0.740726, 0.522565, 0.360063, 0.772839, 0.555524, 0.306911, 0.772786, 0.529352, 0.4145, 0.740254, 0.481258, 0.413506, 0.772919, 0.472323, 0.477698, 0.740753, 0.441018, 0.45593, 0.773066, 0.393806, 0.497691, 0.772801, 0.411599, 0.530482, 0.741063, 0.366675, 0.562787, 0.740824, 0.33075, 0.541215, 0.773104, 0.285725, 0.566374, 0.773034, 0.274726, 0.612853, 0.740902, 0.225942, 0.59254, 0.773205, 0.213325, 0.636792, 0.740937, 0.166816, 0.611985, 0.773076, 0.149888, 0.654674, 0.740902, 0.105986, 0.625127, 0.773293, 0.0849933, 0.666229, 0.740888, 0.0442155, 0.632806, 0.773047, 0.019275, 0.671209, 0.741018, -0.0190915, 0.634224, 0.772914, -0.0301827, 0.671114, 0.74074, -0.0631458, 0.669079, 0.740504, -0.0915194, 0.62766, 0.77309, -0.128386, 0.659521, 0.740641, -0.152577, 0.615565, 0.773175, -0.208005, 0.638447, 0.741026, -0.212316, 0.598038, 0.772834, -0.2845, 0.608029, 0.741188, -0.259923, 0.578505, 0.773157, -0.317548, 0.549138, 0.773053, -0.34292, 0.577546, 0.740842, -0.397595, 0.540766, 0.741276, -0.367928, 0.516873, 0.772963, -0.424265, 0.472023, 0.772783, -0.44886, 0.499382, 0.741041, -0.484497, 0.465094, 0.740912, -0.480121, 0.414714, 0.772979, -0.527643, 0.415284, 0.741035, -0.518571, 0.365743, 0.772862, -0.574455, 0.34756, 0.741083, -0.547708, 0.319985, 0.773062, -0.612667, 0.27464, 0.741088, -0.571814, 0.27453, 0.773086, -0.592711, 0.226005, 0.773056, -0.636792, 0.213326, 0.740937, -0.61201, 0.166823, 0.773054, -0.654537, 0.149855, 0.741029, -0.625548, 0.106047, 0.772945, -0.666095, 0.0849755, 0.74101, -0.632803, 0.0442151, 0.77305, -0.671621, 0.0193043, 0.740644, -0.634058, -0.0190839, 0.77305, -0.6707, -0.0301634, 0.741115, -0.668936, -0.0631255, 0.740635, -0.627867, -0.0915511, 0.772918, -0.659476, -0.128375, 0.740683, -0.615681, -0.152605, 0.773077, -0.643704, -0.192394, 0.740696, -0.598022, -0.212311, 0.772848, -0.621731, -0.254557, 0.74071, -0.573974, -0.269735, 0.773173, -0.594063, -0.314432, 0.74042, -0.544869, -0.324753, 0.77308, 0.4807, 0.276288, 0.832221, 0.452145, 0.318446, 0.833161, 0.415853, 0.362484, 0.834069, 0.383406, 0.400298, 0.832323, 0.356059, 0.426946, 0.831227, 0.310823, 0.46134, 0.830996, 0.253248, 0.494218, 0.831634, 0.198126, 0.518698, 0.831684, 0.146431, 0.536018, 0.83141, 0.0932153, 0.547978, 0.831283, 0.0390511, 0.554379, 0.831347, -0.0165924, 0.554984, 0.831696, -0.080333, 0.549476, 0.831638, -0.133864, 0.539202, 0.83147, -0.185982, 0.52323, 0.83165, -0.236505, 0.502763, 0.831441, -0.28463, 0.477136, 0.83146, -0.330036, 0.44695, 0.831452, -0.365212, 0.418901, 0.831349, -0.405244, 0.380266, 0.831369, -0.444276, 0.333785, 0.831388, -0.470409, 0.295711, 0.831427, -0.496865, 0.248052, 0.831622, -0.518979, 0.198223, 0.831485, -0.536018, 0.146431, 0.83141, -0.548001, 0.0932201, 0.831267, -0.554087, 0.0390345, 0.831543, -0.555399, -0.0166145, 0.831418, -0.549751, -0.0803738, 0.831453, -0.538924, -0.133798, 0.83166, -0.523493, -0.186073, 0.831464, -0.502725, -0.236488, 0.83147, -0.477135, -0.284632, 0.83146, 0.336045, 0.341601, 0.877715, 0.316947, 0.341352, 0.884886, 0.291665, 0.361798, 0.885457, 0.259229, 0.389588, 0.883754, 0.215143, 0.419371, 0.881953, 0.168495, 0.440116, 0.88199, 0.124591, 0.454699, 0.881888, 0.0793784, 0.464422, 0.882049, 0.0334954, 0.470372, 0.881832, -0.0139647, 0.471051, 0.881995, -0.0684363, 0.466408, 0.881919, -0.113885, 0.457722, 0.881772, -0.158012, 0.443805, 0.882083, -0.200786, 0.426262, 0.882035, -0.241655, 0.404615, 0.881981, -0.279864, 0.37859, 0.882239, -0.316074, 0.349842, 0.881878, -0.347984, 0.318031, 0.881909, -0.372159, 0.288924, 0.882055, -0.398703, 0.251063, 0.882045, -0.421554, 0.210858, 0.881948, -0.440482, 0.168626, 0.881783, -0.454513, 0.124547, 0.88199, -0.464714, 0.0794253, 0.881892, -0.470178, 0.0334863, 0.881936, -0.471056, -0.0139732, 0.881993, -0.46652, -0.0684494, 0.881858, -0.457351, -0.113794, 0.881975, -0.444013, -0.158084, 0.881965, -0.42626, -0.200789, 0.882035, -0.404702, -0.241701, 0.881928, 0.199534, 0.320109, 0.92613, 0.216152, 0.320673, 0.922197, 0.173658, 0.340812, 0.923954, 0.137151, 0.357035, 0.923968, 0.101611, 0.369234, 0.923765, 0.0648537, 0.376915, 0.923975, 0.0276235, 0.381873, 0.923802, -0.0111776, 0.381972, 0.924106, -0.0557545, 0.378003, 0.924124, -0.0926565, 0.371201, 0.923918, -0.128599, 0.360344, 0.923912, -0.163093, 0.345564, 0.924114, -0.19642, 0.328323, 0.923917, -0.227375, 0.307105, 0.924114, -0.25676, 0.283769, 0.923877, -0.282338, 0.258034, 0.923961, -0.301588, 0.234689, 0.924103, -0.323482, 0.204207, 0.923936, -0.342288, 0.171685, 0.923777, -0.35739, 0.137276, 0.923812, -0.368947, 0.10154, 0.923887, -0.377197, 0.0648951, 0.923857, -0.381747, 0.027616, 0.923854, -0.382384, -0.0111923, 0.923936, -0.378003, -0.0557525, 0.924124, -0.371441, -0.0914186, 0.923945, -0.37144, -0.0914186, 0.923945, -0.361098, -0.132082, 0.923127, -0.359868, -0.12843, 0.924122, -0.346012, -0.163297, 0.92391, -0.328243, -0.196374, 0.923955, 0.128769, 0.258204, 0.95747, 0.151597, 0.241611, 0.958458, 0.129967, 0.261525, 0.956407, 0.0989364, 0.272942, 0.95693, 0.0776273, 0.280099, 0.956827, 0.0989364, 0.272942, 0.95693, 0.0497546, 0.286056, 0.95692, 0.021482, 0.289675, 0.956884, -0.00832045, 0.290205, 0.956928, -0.0427355, 0.287339, 0.956875, -0.070556, 0.281195, 0.957054, -0.0978727, 0.273195, 0.956967, -0.124177, 0.262281, 0.956968, -0.149243, 0.248772, 0.956995, -0.172786, 0.232782, 0.957057, -0.194081, 0.215914, 0.95693, -0.218565, 0.193702, 0.956404, -0.213979, 0.195566, 0.957062, -0.194081, 0.215914, 0.956929, -0.228677, 0.178614, 0.956976, -0.245243, 0.155438, 0.956919, -0.258929, 0.130477, 0.957043, -0.270766, 0.104578, 0.956948, -0.279421, 0.0774573, 0.957039, -0.285667, 0.0496955, 0.95704, -0.289772, 0.0214888, 0.956854, -0.290205, -0.00832215, 0.956928, -0.287244, -0.0427255, 0.956904, -0.379126, -0.0592372, 0.923447, -0.371436, -0.0913964, 0.923949, -0.281562, -0.0706477, 0.956939, -0.371436, -0.0913964, 0.923949, -0.273306, -0.09791, 0.956931, -0.262282, -0.124176, 0.956968, -0.248607, -0.149144, 0.957053, 0.0899644, 0.172327, 0.980923, 0.119911, 0.170492, 0.978036, 0.0709626, 0.181798, 0.980772, 0.098937, 0.272931, 0.956933, 0.052829, 0.187982, 0.980751, 0.098937, 0.272931, 0.956933, 0.0764915, 0.28098, 0.956661, 0.034085, 0.191857, 0.980831, 0.015127, 0.194476, 0.980791, -0.00534821, 0.194744, 0.98084, -0.029192, 0.193113, 0.980742, -0.0479292, 0.189118, 0.980784, -0.0661387, 0.183227, 0.980843, -0.0837789, 0.175868, 0.980842, -0.100769, 0.167073, 0.980781, -0.116485, 0.156151, 0.980841, -0.194059, 0.21592, 0.956933, -0.13043, 0.145113, 0.980781, -0.176266, 0.231795, 0.956662, -0.148123, 0.129135, 0.980502, -0.143794, 0.13142, 0.980842, -0.13043, 0.145113, 0.980781, -0.194059, 0.21592, 0.956932, -0.153134, 0.120502, 0.980831, -0.164465, 0.105071, 0.980771, -0.173964, 0.0884325, 0.980773, -0.181519, 0.0708572, 0.980831, -0.187576, 0.0527211, 0.980834, -0.191858, 0.0340847, 0.980831, -0.194259, 0.0151136, 0.980834, -0.195265, -0.00536784, 0.980736, -0.192619, -0.0291191, 0.980842, -0.189412, -0.0480021, 0.980724, -0.183518, -0.0662392, 0.980782, -0.175868, -0.0837787, 0.980842, -0.166803, -0.100612, 0.980844, 0.0366162, 0.0909679, 0.99518, 0.0497426, 0.0861585, 0.995039, 0.0275738, 0.0943114, 0.995161, 0.0181553, 0.0962636, 0.99519, 0.00863053, 0.0975765, 0.995191, -0.00234427, 0.0978922, 0.995194, -0.0153186, 0.0967069, 0.995195, -0.0247208, 0.0947336, 0.995196, -0.0338884, 0.0918574, 0.995195, -0.042854, 0.0883675, 0.995166, -0.0511629, 0.0834801, 0.995195, -0.0590958, 0.0780653, 0.995195, -0.119702, 0.154716, 0.980681, -0.0664584, 0.0718917, 0.995196, -0.0722672, 0.0660444, 0.995196, -0.0763407, 0.0613881, 0.99519, -0.0819865, 0.0536048, 0.995191, -0.0868472, 0.0453143, 0.995191, -0.0908719, 0.0365845, 0.99519, -0.0940163, 0.0274994, 0.995191, -0.096454, 0.0181793, 0.995171, -0.0975765, 0.00863029, 0.995191, -0.0978922, -0.00234296, 0.995194, -0.0967071, -0.015317, 0.995195, -0.0947334, -0.024722, 0.995196, -0.0918567, -0.0338904, 0.995195, -0.088091, -0.0427317, 0.995195, -0.0834804, -0.0511624, 0.995195, 0.000646961, -0.000234032, 1, 1.12144e-05, -4.68446e-06, 1, 0.000666755, -0.000169741, 1, 0.000679309, -0.000104121, 1, 0.00068685, -3.68174e-05, 1, 0.000534912, 2.39484e-05, 1, 1.98949e-07, -2.45955e-07, 1, 1.19179e-06, 5.68275e-07, 1, 8.17117e-08, 4.04968e-07, 1, -4.55485e-07, -8.3357e-07, 1, -7.08125e-07, -7.33146e-07, 1, 8.74814e-07, -1.42747e-07, 1, -4.08919e-07, -1.97615e-07, 1, -4.04997e-07, -7.97743e-07, 1, 0.000411024, 0.000550346, 1, 0.000354622, 0.000585886, 1, 0.000297377, 0.000622765, 1, 0.000233619, 0.000645822, 1, 0.000169731, 0.000666715, 1, 0.000104318, 0.000680604, 1, 3.68119e-05, 0.00068677, 1, -2.39462e-05, 0.000534856, 1, 4.47963e-07, -1.20095e-06, 1, -4.82227e-07, 8.4418e-07, 1, -4.16553e-07, 1.15132e-07, 1, 1.55929e-06, -4.42786e-06, 1, 6.53538e-07, -5.76399e-07, 1, 0.00578105, -0.00311373, 0.999978, 0.0784402, 0.0710221, 0.994386, 0.160478, 0.233855, 0.958936, 0.251931, 0.337128, 0.907125, 0.3998, 0.31401, 0.861137, 0.442522, 0.256757, 0.859215, -0.162166, -0.0116155, 0.986695, -0.00332996, -0.0093909, 0.99995, -0.00370845, -0.0104583, 0.999938, -0.167893, -0.0289206, 0.985381, -0.313881, -0.025467, 0.949121, -0.324779, -0.0668334, 0.943426, -0.442962, -0.0248012, 0.896197, -0.45542, -0.0949473, 0.885199, -0.554353, -0.0521243, 0.830648, -0.558555, -0.110837, 0.822029, -0.6401, -0.0891078, 0.763107, -0.637507, -0.141446, 0.757349, -0.692108, -0.173244, 0.700695, -0.686947, -0.200607, 0.69847, -0.699324, -0.284198, 0.655879, -0.698932, -0.285471, 0.655744, -0.653844, -0.404077, 0.639695, -0.676715, -0.36484, 0.639491, -0.243407, 0.0790495, 0.966697, -0.0122555, -0.0072736, 0.999898, -0.327561, 0.0239223, 0.944527, -0.0256228, -0.0152071, 0.999556, -0.507263, 0.110747, 0.854646, -0.593134, 0.0352943, 0.80433, -0.717521, 0.108583, 0.688022, -0.779357, 0.0237354, 0.62613, -0.874705, 0.0420908, 0.482825, -0.888455, 0.00619651, 0.458921, -0.953093, -0.0450135, 0.299313, -0.952745, -0.0418996, 0.300867, -0.977925, -0.136925, 0.15784, -0.977724, -0.138843, 0.157411, -0.967776, -0.245465, 0.0561793, -0.968078, -0.244189, 0.0565426, -0.945137, -0.326675, 0, -0.944749, -0.327794, 0, -0.450142, 0.187514, -0.873047, -0.452009, 0.224617, -0.86327, -0.398537, 0.244752, -0.883892, -0.528246, 0.1689, -0.832123, -0.502194, 0.146123, -0.85232, -0.59054, 0.127808, -0.796824, -0.566288, 0.138802, -0.812436, -0.537887, 0.0892441, -0.83828, -0.629789, 0.157835, -0.760561, -0.658229, 0.122196, -0.742834, -0.632725, 0.172494, -0.754921, -0.71662, 0.152656, -0.680552, -0.747382, 0.38679, -0.540198, -0.753485, 0.21486, -0.621365, -0.726668, 0.416461, -0.546365, -0.761528, 0.297332, -0.575907, -0.679589, 0.370312, -0.633267, -0.740046, 0.390976, -0.547238, -0.619803, 0.294288, -0.727488, -0.691655, 0.442314, -0.57094, -0.544155, 0.148223, -0.825787, -0.62691, 0.0670589, -0.776201, -0.561973, 0.106644, -0.820252, -0.63038, 0.158281, -0.759979, -0.694668, 0.0109448, -0.719247, -0.596906, 0.132565, -0.791284, -0.757972, -0.00829038, -0.652235, -0.8165, 0.0200902, -0.576995, -0.852127, 0.0859012, -0.516236, -0.854096, 0.156317, -0.49607, -0.833096, 0.248138, -0.494347, -0.784488, 0.345492, -0.514989, -0.62893, 0.0398911, -0.776438, -0.713522, -0.0625272, -0.697837, -0.779605, -0.126743, -0.613312, -0.837606, -0.146905, -0.526151, -0.881675, -0.127433, -0.454323, -0.90965, -0.0767805, -0.408218, -0.921005, 0.00125822, -0.389549, -0.911649, 0.106571, -0.396911, -0.872105, 0.229764, -0.43202, -0.730798, -0.195434, -0.654018, -0.680685, -0.0763689, -0.728585, -0.793042, -0.26906, -0.546526, -0.849061, -0.291689, -0.440469, -0.897851, -0.266444, -0.350529, -0.936396, -0.200246, -0.288208, -0.956312, -0.114471, -0.269007, -0.959691, 0.00297467, -0.281041, -0.933383, 0.140696, -0.330152, -0.7305, -0.323853, -0.601239, -0.687514, -0.195482, -0.699365, -0.787916, -0.399768, -0.468373, -0.841894, -0.418267, -0.34098, -0.892719, -0.384613, -0.23479, -0.932689, -0.317513, -0.171106, -0.967946, -0.209445, -0.138609, -0.985423, -0.0768289, -0.151784, -0.974405, 0.0781135, -0.210794, -0.708672, -0.439714, -0.551757, -0.675275, -0.307111, -0.670587, -0.760075, -0.515547, -0.395598, -0.812161, -0.527595, -0.249075, -0.865402, -0.484415, -0.128148, -0.910958, -0.408853, -0.0547277, -0.957273, -0.288751, -0.0158738, -0.989361, -0.142888, -0.0273486, -0.995317, 0.0282684, -0.0924413, -0.676254, -0.482963, -0.556262, -0.677867, -0.359575, -0.641251, -0.726381, -0.564705, -0.391763, -0.778309, -0.581371, -0.237158, -0.833288, -0.542138, -0.108246, -0.889447, -0.456732, -0.0167323, -0.941739, -0.33512, 0.0286903, -0.982042, -0.187433, 0.0214855, -0.999056, 0.0141987, -0.0410657, -0.1719, 0.210928, 0.962268, -0.028926, 0.0177643, 0.999424, -0.359118, 0.417707, 0.834599, -0.54424, 0.588481, 0.597907, -0.684306, 0.675462, 0.274731, -0.747382, 0.38679, -0.540198, -0.705488, 0.704116, 0.0806624, -0.726668, 0.416461, -0.546365, -0.679589, 0.370312, -0.633267, -0.619803, 0.294288, -0.727488, 0.615569, 0.268312, 0.741001, 0.578018, 0.262017, 0.772815, 0.597929, 0.212339, 0.772912, 0.639339, 0.205477, 0.740962, 0.615749, 0.152079, 0.773127, 0.656774, 0.140275, 0.740925, 0.627825, 0.0901775, 0.773113, 0.667469, 0.0743759, 0.740914, 0.633628, 0.029286, 0.773083, 0.67109, 0.024608, 0.740968, 0.671144, -0.020773, 0.741036, 0.633072, -0.0376787, 0.773175, 0.66612, -0.0849763, 0.740988, 0.626575, -0.0966738, 0.773342, 0.654595, -0.149869, 0.740975, 0.614381, -0.157703, 0.773088, 0.636696, -0.213292, 0.74103, 0.59605, -0.217191, 0.773015, 0.605759, -0.289582, 0.741079, 0.576518, -0.264797, 0.772987, 0.550704, -0.315006, 0.772979, 0.574439, -0.347553, 0.741098, 0.547411, -0.388961, 0.740979, 0.507277, -0.380819, 0.773076, 0.495538, -0.452883, 0.741174, 0.47477, -0.420699, 0.77305, 0.429575, -0.466964, 0.772923, 0.448816, -0.499333, 0.741101, 0.397767, -0.540994, 0.741017, 0.367857, -0.516773, 0.773064, 0.32476, -0.544875, 0.773073, 0.328732, -0.585894, 0.740719, 0.26979, -0.574087, 0.77307, 0.269558, -0.614943, 0.741069, 0.208044, -0.638575, 0.740905, 0.212217, -0.597753, 0.773081, 0.144421, -0.655759, 0.741028, 0.152581, -0.615577, 0.773165, 0.0794683, -0.666856, 0.740937, 0.0915689, -0.627981, 0.772823, 0.0301681, -0.6708, 0.741024, 0.0285035, -0.63377, 0.772996, -0.00281719, -0.671811, 0.740718, -0.0348075, -0.633336, 0.773094, -0.0686569, -0.668333, 0.740687, -0.0967243, -0.626904, 0.773069, -0.13384, -0.658388, 0.740683, -0.157701, -0.614381, 0.773088, -0.197758, -0.642181, 0.740605, -0.217201, -0.596082, 0.772988, -0.259674, -0.619548, 0.740763, -0.274569, -0.571887, 0.773018, -0.347579, -0.574473, 0.74106, -0.320057, -0.547821, 0.772952, -0.290505, -0.607303, 0.739452, -0.347579, -0.574474, 0.74106, -0.367618, -0.517381, 0.77277, -0.403136, -0.539157, 0.739453, -0.402193, -0.537626, 0.74108, -0.453003, -0.495672, 0.741011, -0.420836, -0.474917, 0.772885, -0.460794, -0.436343, 0.772835, -0.51027, -0.436511, 0.741001, -0.504731, -0.384113, 0.773113, -0.550598, -0.38439, 0.741003, -0.544869, -0.324753, 0.77308, -0.594063, -0.314432, 0.74042, 0.50524, 0.224358, 0.833305, 0.523314, 0.174543, 0.834073, 0.54133, 0.118928, 0.832357, 0.55172, 0.0664228, 0.83138, 0.555448, 0.0154024, 0.831409, 0.554245, -0.0341981, 0.831651, 0.548673, -0.0848698, 0.831718, 0.538182, -0.138361, 0.831394, 0.521978, -0.190424, 0.831431, 0.500772, -0.24066, 0.831451, 0.474848, -0.28863, 0.831392, 0.444143, -0.333687, 0.831498, 0.405168, -0.380197, 0.831438, 0.36521, -0.418897, 0.831352, 0.329993, -0.446896, 0.831497, 0.28463, -0.477137, 0.83146, 0.236488, -0.502724, 0.831469, 0.186077, -0.523492, 0.831464, 0.133876, -0.539222, 0.831454, 0.0803311, -0.549443, 0.831661, 0.0249526, -0.55486, 0.83157, -0.0307051, -0.554742, 0.831456, -0.083777, -0.549084, 0.831557, -0.083777, -0.549084, 0.831557, -0.141419, -0.53933, 0.830135, -0.138293, -0.537916, 0.831577, -0.190489, -0.52216, 0.831302, -0.240533, -0.500509, 0.831646, -0.2887, -0.474969, 0.831298, -0.333725, -0.444189, 0.831459, -0.380199, -0.405169, 0.831437, -0.418818, -0.365137, 0.831425, -0.446896, -0.329994, 0.831498, -0.477135, -0.284632, 0.83146, 0.467714, 0.109749, 0.87704, 0.454918, 0.100781, 0.884812, 0.461909, 0.0517198, 0.885418, 0.467938, 0.00516842, 0.883746, 0.470553, -0.0303511, 0.88185, 0.466137, -0.0711152, 0.881849, 0.457931, -0.120894, 0.880729, 0.456305, -0.117563, 0.882023, 0.466137, -0.0711152, 0.881849, 0.442954, -0.161856, 0.881813, 0.424592, -0.204317, 0.88203, 0.402608, -0.245, 0.881976, 0.376737, -0.283351, 0.881919, 0.34753, -0.317617, 0.882237, 0.315961, -0.349711, 0.88197, 0.280098, -0.378906, 0.882029, 0.241613, -0.40455, 0.882022, 0.200784, -0.426263, 0.882035, 0.158113, -0.4441, 0.881916, 0.113821, -0.457456, 0.881918, 0.0684138, -0.466278, 0.881989, 0.0211682, -0.470739, 0.882019, -0.0263013, -0.470775, 0.881861, -0.0337885, -0.555985, 0.830506, -0.0837826, -0.549073, 0.831564, -0.0722566, -0.465518, 0.882084, -0.0837826, -0.549074, 0.831564, -0.117607, -0.456485, 0.881924, -0.161856, -0.442954, 0.881813, -0.204268, -0.424487, 0.882092, -0.244956, -0.402521, 0.882028, -0.283296, -0.376661, 0.881969, -0.31801, -0.347959, 0.881926, -0.3498, -0.316038, 0.881907, -0.379067, -0.280213, 0.881923, -0.404702, -0.241701, 0.881928, 0.387399, 0.0157854, 0.921777, 0.378083, -0.00276228, 0.925768, 0.38174, -0.0262251, 0.923898, 0.466126, -0.0711241, 0.881855, 0.378112, -0.058975, 0.92388, 0.472049, -0.0295747, 0.881076, 0.370519, -0.0957541, 0.923876, 0.466126, -0.0711241, 0.881855, 0.359345, -0.13161, 0.923878, 0.344197, -0.16595, 0.924115, 0.326594, -0.199084, 0.92396, 0.305441, -0.23009, 0.923994, 0.282073, -0.257789, 0.92411, 0.2567, -0.283699, 0.923916, 0.282073, -0.257789, 0.92411, 0.227659, -0.307496, 0.923914, 0.196172, -0.327904, 0.924119, 0.163093, -0.345564, 0.924114, 0.128587, -0.360322, 0.923923, 0.0926312, -0.371111, 0.923957, 0.0557533, -0.378003, 0.924124, 0.0171844, -0.382205, 0.923918, -0.0216325, -0.382076, 0.923878, -0.0589766, -0.378128, 0.923873, -0.0958098, -0.370734, 0.923784, -0.131413, -0.358798, 0.924118, -0.16595, -0.344197, 0.924115, -0.199083, -0.326594, 0.92396, -0.230193, -0.305585, 0.92392, -0.258097, -0.282403, 0.923923, -0.283698, -0.256697, 0.923917, -0.307655, -0.227779, 0.923832, -0.328243, -0.196374, 0.923955, 0.285746, 0.000538245, 0.958305, 0.287815, -0.0208951, 0.957458, 0.286884, -0.0451004, 0.956903, 0.281083, -0.0730034, 0.956903, 0.272651, -0.100233, 0.956878, 0.261255, -0.126352, 0.956964, 0.247609, -0.15135, 0.956966, 0.231332, -0.174705, 0.95706, 0.282062, -0.257787, 0.924114, 0.21398, -0.195565, 0.957062, 0.30421, -0.233243, 0.923609, 0.194964, -0.214939, 0.956969, 0.259607, -0.282046, 0.923609, 0.282062, -0.257787, 0.924114, 0.173018, -0.2331, 0.956937, 0.149143, -0.248607, 0.957053, 0.124345, -0.26265, 0.956846, 0.0977686, -0.2729, 0.957062, 0.0705536, -0.281195, 0.957054, 0.0426951, -0.287039, 0.956967, 0.0130431, -0.289909, 0.956965, -0.0167593, -0.289816, 0.956935, -0.0450845, -0.286774, 0.956937, -0.0728795, -0.280593, 0.957056, -0.100027, -0.272085, 0.95706, -0.126218, -0.260971, 0.95706, -0.151404, -0.247701, 0.956933, -0.1747, -0.231335, 0.95706, -0.195562, -0.213982, 0.957062, -0.21592, -0.194077, 0.956929, -0.193701, -0.218563, 0.956405, -0.233275, -0.173148, 0.956871, -0.21592, -0.194077, 0.956929, -0.248607, -0.149144, 0.957053, 0.207324, 0.00927511, 0.978228, 0.194895, -0.00295838, 0.98082, 0.192374, -0.0307133, 0.980841, 0.188419, -0.0494228, 0.980844, 0.182681, -0.0676565, 0.980841, 0.175437, -0.0853601, 0.980783, 0.165974, -0.101994, 0.980841, 0.155334, -0.117884, 0.980803, 0.143795, -0.131419, 0.980842, 0.131495, -0.144273, 0.980762, 0.116485, -0.156151, 0.980841, 0.10061, -0.166804, 0.980844, 0.0837779, -0.175869, 0.980842, 0.0661348, -0.183229, 0.980843, 0.0478598, -0.188839, 0.980841, 0.0291205, -0.192619, 0.980842, 0.00875361, -0.194592, 0.980845, -0.0117392, -0.194945, 0.980744, -0.0294274, -0.192883, 0.98078, -0.0294274, -0.192883, 0.98078, -0.0529823, -0.189231, 0.980502, -0.0494196, -0.18842, 0.980844, -0.0677973, -0.183061, 0.980761, -0.0852382, -0.175175, 0.980841, -0.101994, -0.165974, 0.980841, -0.117774, -0.155177, 0.980841, -0.13142, -0.143795, 0.980842, -0.14397, -0.131222, 0.980843, -0.215912, -0.194069, 0.956932, -0.15615, -0.116486, 0.980841, -0.231794, -0.176274, 0.95666, -0.215912, -0.194069, 0.956932, -0.166803, -0.100612, 0.980844, 0.0988048, -0.00822766, 0.995073, 0.0965742, -0.0161233, 0.995195, 0.0945243, -0.0255082, 0.995196, 0.0915738, -0.0346498, 0.995195, 0.0877354, -0.0434572, 0.995195, 0.083051, -0.0518463, 0.995196, 0.0776462, -0.0597985, 0.995186, 0.0722659, -0.0660459, 0.995196, 0.0664598, -0.0718903, 0.995196, 0.059098, -0.0780637, 0.995195, 0.0511623, -0.0834804, 0.995195, 0.0427322, -0.0880908, 0.995195, 0.033993, -0.0921433, 0.995165, 0.0247225, -0.0947333, 0.995196, 0.0153185, -0.0967069, 0.995195, 0.0043976, -0.0978001, 0.995196, -0.00657737, -0.0976865, 0.995196, -0.0151989, -0.195025, 0.980681, -0.0294314, -0.192872, 0.980782, -0.0161197, -0.0965747, 0.995195, -0.0294314, -0.192872, 0.980782, -0.025507, -0.0945246, 0.995196, -0.0346496, -0.0915739, 0.995195, -0.0434573, -0.0877354, 0.995195, -0.0518475, -0.0830504, 0.995196, -0.0597441, -0.0775711, 0.995195, -0.0660464, -0.0722654, 0.995196, -0.0718904, -0.0664597, 0.995196, -0.0780637, -0.059098, 0.995195, -0.0834804, -0.0511624, 0.995195, -3.74141e-05, -0.000684599, 1, -6.92156e-07, -1.25004e-06, 1, 3.4613e-07, 5.04652e-07, 1, -1.50742e-06, -2.01253e-06, 1, 5.3978e-07, 8.77094e-07, 1, -6.74745e-07, -2.38286e-07, 1, 7.36611e-07, 6.45305e-08, 1, -6.39152e-07, -3.44002e-07, 1, -3.55486e-07, -4.90995e-07, 1, -2.63931e-07, 5.91891e-07, 1, 5.79018e-07, 6.55055e-07, 1, -6.058e-08, 5.92421e-07, 1, 2.91246e-06, 6.51339e-07, 1, 1.2226e-06, 2.56162e-08, 1, -2.25711e-08, 2.72443e-07, 1, 2.04375e-08, 9.4077e-08, 1, 4.20427e-07, 2.03283e-07, 1, -1.38846e-08, 5.03351e-07, 1, 6.01038e-07, -3.70368e-07, 1, -1.33357e-07, -4.54542e-07, 1, 7.56597e-07, -4.8157e-07, 1, -2.38562e-07, 6.74574e-07, 1, -5.4555e-07, -2.79836e-07, 1, -2.91857e-07, 5.91166e-07, 1, -4.66363e-07, 3.30144e-07, 1, 5.64548e-07, 3.02072e-07, 1, 6.53538e-07, -5.76399e-07, 1, -8.64879e-06, -0.00147998, 0.999999, 0.0998167, 0.00704672, 0.994981, 0.283012, 0.0205241, 0.958897, 0.279835, 0.0542582, 0.958514, 0.419405, 0.0475956, 0.906551, 0.473331, 0.18665, 0.860883, 0.492124, 0.142239, 0.858826, 0.446264, 0.245795, 0.860484, 0.473678, 0.185854, 0.860864, -0.0910392, -0.136277, 0.986479, -0.00971768, 0.00155472, 0.999952, -0.015281, 0.00244389, 0.99988, -0.082077, -0.137974, 0.987029, -0.166387, -0.26496, 0.949796, -0.150426, -0.268767, 0.951387, -0.241819, -0.374812, 0.895008, -0.213279, -0.383664, 0.898506, -0.292652, -0.46952, 0.83301, -0.337883, -0.449961, 0.826662, -0.366416, -0.529545, 0.765063, -0.439707, -0.485839, 0.755393, -0.469067, -0.535973, 0.701932, -0.535568, -0.480546, 0.694437, -0.568418, -0.495521, 0.65678, -0.616078, -0.440425, 0.653049, -0.041331, -0.0245364, 0.998844, -0.119134, -0.290578, 0.949406, -0.0438434, -0.0260283, 0.998699, -0.119112, -0.290452, 0.949447, -0.210828, -0.523173, 0.825737, -0.192196, -0.516187, 0.834632, -0.309657, -0.691301, 0.652852, -0.290547, -0.688765, 0.664218, -0.46853, -0.773784, 0.426308, -0.389572, -0.787165, 0.478127, -0.546753, -0.792894, 0.269037, -0.65173, -0.73206, 0.198334, -0.729694, -0.678202, 0.0871107, -0.786315, -0.615562, 0.0528412, -0.870671, -0.491848, -0.00419837, -0.883653, -0.468042, -0.00966713, 0.28569, -0.0113744, 0.958255, 0.28615, -0.0171993, 0.95803, 0.283271, 0.0171633, 0.958886, 0.484102, 0.161346, 0.860008, 0.481196, 0.168204, 0.860324, 0.48447, 0.160471, 0.859964, 0.0198186, 0.525319, -0.850675, -0.108223, 0.495026, -0.862112, -0.0244302, 0.477468, -0.878309, -0.0750149, 0.524, -0.848408, -0.194493, 0.514558, -0.835106, -0.174285, 0.53489, -0.826751, -0.275144, 0.538958, -0.796128, -0.281424, 0.533025, -0.797925, -0.372718, 0.544448, -0.751437, -0.365787, 0.553076, -0.748536, -0.46526, 0.541643, -0.700112, -0.446251, 0.564281, -0.694584, -0.551134, 0.526006, -0.647742, -0.521155, 0.561947, -0.64235, -0.627729, 0.49422, -0.601418, -0.589594, 0.541693, -0.599122, 0.137308, 0.57886, -0.803784, 0.0107744, 0.560062, -0.828381, -0.122364, 0.555838, -0.822236, -0.257584, 0.550428, -0.794153, -0.388676, 0.537623, -0.74826, -0.511239, 0.512144, -0.690176, -0.620779, 0.47017, -0.627355, -0.713283, 0.410091, -0.568377, 0.110557, 0.56552, -0.817291, 0.270747, 0.580979, -0.767567, -0.0569184, 0.569072, -0.820315, -0.234737, 0.558587, -0.795537, -0.406965, 0.533523, -0.74144, -0.563612, 0.488429, -0.666167, -0.696642, 0.420933, -0.580952, -0.800356, 0.332483, -0.498885, 0.207516, 0.556732, -0.804355, 0.388219, 0.554803, -0.735853, 0.00718263, 0.569162, -0.822194, -0.211105, 0.562471, -0.799413, -0.423088, 0.533095, -0.732671, -0.610288, 0.474381, -0.634438, -0.760638, 0.386282, -0.521744, -0.867955, 0.274096, -0.414157, 0.314974, 0.538922, -0.781252, 0.483992, 0.492628, -0.723235, 0.0895396, 0.56935, -0.817204, -0.178495, 0.568603, -0.803014, -0.437274, 0.535764, -0.722322, -0.651232, 0.471452, -0.594668, -0.813588, 0.368426, -0.449819, -0.919436, 0.236481, -0.314188, 0.564779, 0.424784, -0.707519, 0.381797, 0.483507, -0.787687, 0.124794, 0.530181, -0.83865, -0.143682, 0.569543, -0.809306, -0.439908, 0.5483, -0.71123, -0.686178, 0.473694, -0.552064, -0.855107, 0.358963, -0.374083, -0.954183, 0.210649, -0.212511, 0.606725, 0.40092, -0.686402, 0.404476, 0.456661, -0.792376, 0.137388, 0.512813, -0.847436, -0.166911, 0.547233, -0.820169, -0.436093, 0.556414, -0.707267, -0.67491, 0.504289, -0.538692, -0.854463, 0.387048, -0.346536, -0.956669, 0.235093, -0.171801, 0.102596, -0.243608, 0.964432, 0.00329917, -0.0644774, 0.997914, 0.194326, -0.520179, 0.831656, 0.257587, -0.749286, 0.610098, 0.280831, -0.900897, 0.330936, 0.232366, -0.971787, -0.0404387, 0.0862646, -0.890453, -0.446824, -0.144054, -0.625249, -0.767015, -0.282837, -0.414809, -0.864833, -0.00944802, 0.015994, -0.999828, 0.044117, -0.853577, -0.519095, -0.00281396, 0.00377095, -0.999989, 0.00669874, -0.874443, -0.485082, 0.148103, -0.851636, -0.502775, -0.00301336, 0.00334318, -0.99999, 0.214711, -0.830211, -0.51444, -0.00391279, 0.00352067, -0.999986, 0.0686122, -0.772326, -0.63151, -0.0055143, 0.00408903, -0.999976, 0.700329, -0.697393, -0.152257, 0.045779, -0.74006, -0.670981, 0.00444696, -0.00267229, -0.999987, 0.764654, -0.625831, -0.153755, 0.034389, -0.0164932, -0.999272, -0.912458, 0.372582, -0.169126, -0.309842, -0.596362, -0.740507, 0.0121608, -0.00446006, -0.999916, -0.944365, 0.282306, -0.168754, -0.233828, -0.635404, -0.735926, -0.178481, -0.647339, -0.741011, -0.0126686, 0.00324584, -0.999914, 0.905252, -0.38956, -0.169593, 0.939457, -0.297744, -0.169617, -0.0966698, -0.661697, -0.743513, -0.0146876, 0.00221389, -0.99989, 0.963504, -0.206732, -0.170067, -0.0263048, -0.67446, -0.737843, 9.85067e-06, -2.12422e-05, -1, -0.979835, -0.104024, -0.170596, 0.0319617, -0.672304, -0.739585, 4.64596e-05, -1.33888e-05, -1, 0.985761, -0.0111278, -0.167785, 0.111606, -0.661856, -0.741277, 4.25922e-05, -3.02782e-05, -1, -4.69692e-05, -9.67932e-05, -1, -0.942075, -0.290076, -0.168377, 0.16814, -0.657226, -0.7347, 0.969429, 0.17661, -0.170343, 0.218575, -0.640145, -0.736505, 2.07846e-06, 2.53829e-05, -1, 5.96667e-05, 3.98873e-05, -1, -0.865739, -0.470767, -0.169925, 0.290036, -0.605928, -0.740763, 0.915264, 0.366949, -0.166257, 0.348363, -0.577984, -0.737955, -0.0149534, -0.00885397, -0.999849, 0.390101, -0.546097, -0.74135, -0.0105245, -0.00769215, -0.999915, 0.876404, 0.449246, -0.173479, 0.473095, -0.485554, -0.735131, -0.0110743, -0.0100607, -0.999888, 0.827163, 0.53617, -0.168295, 0.503758, -0.446427, -0.739548, 5.26729e-05, 0.000135361, -1, 0.77018, 0.614992, -0.169139, 0.0209202, 0.028018, -0.999389, -0.542671, -0.822656, -0.169547, 0.536395, -0.414286, -0.735287, 0.0136383, 0.0225699, -0.999652, -0.457976, -0.872585, -0.169863, 0.569775, -0.351309, -0.742926, 0.00651368, 0.0136466, -0.999886, -0.372298, -0.912295, -0.170622, 0.604966, -0.292288, -0.740664, 0.634694, -0.235757, -0.735923, -0.00510413, -0.0141953, -0.999886, 0.477535, 0.862228, -0.16889, 0.655436, -0.170106, -0.735845, -0.0032227, -0.0127816, -0.999913, 0.391808, 0.904163, -0.170223, 0.669332, -0.0752897, -0.739139, -0.00231223, -0.0148666, -0.999887, 0.299193, 0.938932, -0.169973, 0.672109, -0.056039, -0.738329, 2.7904e-05, -0.000123125, -1, 0.203071, 0.965058, -0.165606, -0.00133123, 0.0299057, -0.999552, 0.0979052, -0.981448, -0.164844, 0.674552, 0.017136, -0.738029, -0.00423077, 0.0296333, -0.999552, 0.198546, -0.965228, -0.170042, 0.669906, 0.0971369, -0.736064, -0.00271776, 0.0112025, -0.999934, 0.292139, -0.941366, -0.168776, 0.650412, 0.159609, -0.742623, -0.178198, 0.969099, -0.170567, 0.632741, 0.226002, -0.74065, 0.00493831, -0.0140759, -0.999889, -0.272162, 0.947141, -0.169857, 0.604971, 0.299614, -0.737728, 0.0063813, -0.0135234, -0.999888, -0.367958, 0.91485, -0.166301, 0.570644, 0.355372, -0.740322, 0.00891145, -0.0151029, -0.999846, -0.00725277, 0.0154117, -0.999855, -0.441165, -0.564671, -0.69751, -0.00463393, 0.0130413, -0.999904, 0.263418, -0.948038, -0.178427, -0.697877, 0.0263111, -0.715734, -0.692604, 0.159653, -0.703428, 0.00318903, -0.0128591, -0.999912, -0.376535, 0.911826, -0.163688, -0.676201, 0.192745, -0.711056, 0.00200926, -0.0142249, -0.999897, -0.283792, 0.945143, -0.161761, -0.657718, 0.212234, -0.722747, 6.11768e-05, -0.00166739, -0.999999, -0.188903, 0.968579, -0.161774, -0.108556, -0.979463, -0.169904, 0.000743101, 0.014319, -0.999897, -0.674514, 0.0331876, -0.737515, -0.207491, -0.963244, -0.170615, 0.00222141, 0.0146241, -0.999891, -0.662535, 0.10233, -0.742008, -0.299523, -0.938653, -0.170928, -8.03733e-06, 0.000154456, -1, -0.647745, 0.163611, -0.744082, 0.1847, 0.967951, -0.170166, -0.635516, 0.233777, -0.735845, -0.00515691, -0.0140104, -0.999889, 0.280651, 0.94443, -0.171134, -0.604454, 0.286166, -0.743468, -5.20268e-05, -0.00011821, -1, -0.558625, -0.811601, -0.171002, 0.00784637, 0.0129963, -0.999885, -0.575941, 0.346023, -0.740648, -0.636103, -0.752501, -0.170631, 0.00891567, 0.0118824, -0.99989, -0.536087, 0.399896, -0.743434, -0.70611, -0.687203, -0.170763, 0.00879087, 0.00963901, -0.999915, -0.494451, 0.451236, -0.742903, -0.770799, -0.613398, -0.172081, 0.0130813, 0.0117634, -0.999845, -0.449277, 0.500322, -0.740154, 0.0240869, 0.0178056, -0.999551, -0.827274, -0.535289, -0.170541, -0.402414, 0.540253, -0.739047, 0.00996646, 0.00589685, -0.999933, -0.875447, -0.452854, -0.168866, -0.342202, 0.577095, -0.741525, -0.0136472, -0.00634262, -0.999887, -0.282203, 0.606131, -0.743617, 0.815534, 0.552545, -0.172044, -4.47351e-06, -3.60975e-05, -1, -0.227534, 0.632012, -0.740803, 0.8667, 0.469143, -0.169517, 0.0290602, 0.00709594, -0.999552, -0.969078, -0.179587, -0.169223, -0.161783, 0.657311, -0.736049, 0.0258926, 0.00375121, -0.999658, -0.982096, -0.0808736, -0.170136, -0.0968355, 0.669949, -0.736065, 0.0149621, 0.000685472, -0.999888, -0.985525, 0.0145864, -0.168904, -0.0310633, 0.674092, -0.737994, -0.0148013, 0.00082427, -0.99989, 0.0332331, 0.674515, -0.737512, 0.979884, 0.103863, -0.170413, -1.13979e-05, 3.45634e-05, -1, 0.102661, 0.66248, -0.742011, 0.985307, 0.00570201, -0.170696, 0.012752, -0.00323851, -0.999913, -0.938669, 0.299493, -0.170892, 0.169949, 0.648042, -0.742401, 0.239977, 0.628362, -0.739981, -0.0163722, 0.00602607, -0.999848, 0.967582, -0.187642, -0.169041, 0.29799, 0.598327, -0.743779, -0.0118346, 0.00570233, -0.999914, 0.944418, -0.280082, -0.172128, 0.911947, -0.372819, -0.171344, 0.345682, 0.56863, -0.746434, -0.0128141, 0.00772415, -0.999888, 0.871503, -0.459602, -0.171025, 0.345681, 0.568628, -0.746436, 0.400021, 0.535995, -0.743433, 3.93281e-06, 6.26293e-05, -1, -0.687195, 0.706116, -0.170774, -1.27906e-05, 3.37377e-05, -1, 0.453124, 0.497038, -0.740022, 0.765611, -0.62032, -0.170419, 0.500255, 0.449345, -0.740158, -0.000142276, 0.000119648, -1, -0.535118, 0.827345, -0.170734, 0.00771681, -0.0104493, -0.999916, 0.542845, 0.397434, -0.739842, -0.451524, 0.875809, -0.170544, 0.00891145, -0.0151029, -0.999846, 0.570644, 0.355372, -0.740322, 0.00304338, -0.00413916, -0.999987, 0.00333365, -0.0056153, -0.999979, 0.00262087, -0.0029157, -0.999992, 0.00226852, -0.00207131, -0.999995, 0.00180535, -0.00135058, -0.999997, 0.00140147, -0.000847985, -0.999999, 0.000248676, -0.00011877, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0.00267968, -0.0057374, -0.99998, 0.00178316, -0.00504906, -0.999986, 0.00143204, -0.00582839, -0.999982, 0.00108357, -0.00752118, -0.999971, 0.000304642, -0.00677815, -0.999977, 2.31846e-08, 4.40198e-07, -1, 5.63532e-07, 3.70586e-06, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, -0.538607, -0.400635, 0.741211, -0.508891, -0.378858, 0.772979, -0.566593, -0.361128, 0.740648, -0.542518, -0.328924, 0.77297, -0.518446, -0.427253, 0.740722, -0.462801, -0.434055, 0.772924, -0.458138, -0.490954, 0.740995, -0.41632, -0.478534, 0.773099, -0.395927, -0.542251, 0.741084, -0.363817, -0.520086, 0.772754, -0.353938, -0.570554, 0.741077, -0.304, -0.557105, 0.772799, -0.287829, -0.606656, 0.741028, -0.26481, -0.576543, 0.772964, -0.213323, -0.63681, 0.740923, -0.217094, -0.595783, 0.773248, -0.149875, -0.65465, 0.740925, -0.15769, -0.614348, 0.773118, -0.0849947, -0.666222, 0.740894, -0.0966984, -0.626749, 0.773198, -0.0192816, -0.671207, 0.741019, -0.0348045, -0.633233, 0.773178, 0.0301826, -0.671114, 0.74074, 0.0285023, -0.63377, 0.772996, 0.0631438, -0.669034, 0.740545, 0.091523, -0.627659, 0.77309, 0.128402, -0.659567, 0.740597, 0.152578, -0.615565, 0.773175, 0.192381, -0.643673, 0.740726, 0.212316, -0.598038, 0.772834, 0.254511, -0.621641, 0.740802, 0.269703, -0.573898, 0.773241, 0.314381, -0.593978, 0.740509, 0.324757, -0.544876, 0.773073, 0.386938, -0.548528, 0.741212, 0.367927, -0.516873, 0.772963, 0.424265, -0.472023, 0.772783, 0.448877, -0.499401, 0.741018, 0.473188, -0.477066, 0.740609, 0.480149, -0.414739, 0.772948, 0.517558, -0.428305, 0.740735, 0.518538, -0.365719, 0.772895, 0.567582, -0.358805, 0.741019, 0.547744, -0.320007, 0.773028, 0.612668, -0.274636, 0.741088, 0.571814, -0.27453, 0.773086, 0.592712, -0.226003, 0.773056, 0.636808, -0.21333, 0.740923, 0.612023, -0.166826, 0.773044, 0.654537, -0.149854, 0.741029, 0.625548, -0.106047, 0.772945, 0.666119, -0.0849784, 0.740988, 0.632803, -0.0442147, 0.77305, 0.671625, -0.0193043, 0.74064, 0.634058, 0.0190839, 0.77305, 0.670696, 0.0301628, 0.741119, 0.666857, 0.0794635, 0.740937, 0.627925, 0.0915596, 0.772869, 0.655806, 0.144431, 0.740984, 0.615566, 0.152576, 0.773175, 0.638478, 0.208011, 0.740997, 0.598023, 0.21231, 0.772848, 0.608098, 0.284533, 0.74112, 0.578717, 0.260023, 0.772965, 0.553292, 0.310424, 0.772984, 0.577567, 0.342934, 0.740819, -0.465608, -0.301488, 0.832054, -0.428972, -0.349415, 0.833002, -0.389398, -0.391448, 0.833749, -0.352064, -0.428802, 0.831974, -0.313389, -0.458839, 0.831417, -0.270965, -0.48558, 0.831137, -0.237276, -0.501913, 0.831735, -0.190322, -0.521689, 0.831636, -0.138292, -0.537916, 0.831578, -0.0849586, -0.549263, 0.831319, -0.0307053, -0.55485, 0.831384, 0.0249485, -0.554744, 0.831647, 0.0803342, -0.549476, 0.831639, 0.133869, -0.539201, 0.83147, 0.185985, -0.523228, 0.83165, 0.236487, -0.502725, 0.83147, 0.284631, -0.477136, 0.83146, 0.330038, -0.446949, 0.831452, 0.365211, -0.418903, 0.831349, 0.405243, -0.380267, 0.831369, 0.444275, -0.333787, 0.831388, 0.47479, -0.288594, 0.831438, 0.50013, -0.240351, 0.831926, 0.501374, -0.243899, 0.830143, 0.522205, -0.189271, 0.831552, 0.522205, -0.189271, 0.831552, 0.535907, -0.146403, 0.831487, 0.548001, -0.09322, 0.831267, 0.554087, -0.0390345, 0.831543, 0.555399, 0.0166145, 0.831418, 0.549752, 0.0803736, 0.831453, 0.539035, 0.133826, 0.831584, 0.523492, 0.186077, 0.831464, 0.502764, 0.236505, 0.831441, 0.477136, 0.284631, 0.83146, -0.313326, -0.364974, 0.87671, -0.29069, -0.364901, 0.884503, -0.258112, -0.386817, 0.885297, -0.220902, -0.412939, 0.883563, -0.200422, -0.426451, 0.882026, -0.161723, -0.442589, 0.882021, -0.117582, -0.45638, 0.881982, -0.0722662, -0.465608, 0.882035, -0.0262967, -0.470773, 0.881863, 0.0211683, -0.470739, 0.882019, 0.0684363, -0.466408, 0.881919, 0.113885, -0.457722, 0.881772, 0.158051, -0.443915, 0.88202, 0.200753, -0.426192, 0.882076, 0.241613, -0.40455, 0.882022, 0.279914, -0.378658, 0.882194, 0.316072, -0.349844, 0.881878, 0.347984, -0.318031, 0.881909, 0.376493, -0.283162, 0.882084, 0.402516, -0.244945, 0.882033, 0.421484, -0.210825, 0.881989, 0.44041, -0.168599, 0.881824, 0.52218, -0.189304, 0.83156, 0.52218, -0.189304, 0.83156, 0.454513, -0.124547, 0.88199, 0.538724, -0.141631, 0.830492, 0.464714, -0.0794253, 0.881892, 0.470256, -0.0334904, 0.881895, 0.471056, 0.0139732, 0.881993, 0.46652, 0.0684496, 0.881858, 0.457276, 0.113776, 0.882017, 0.443902, 0.158046, 0.882028, 0.425911, 0.200626, 0.882241, 0.404701, 0.241704, 0.881928, -0.171403, -0.337209, 0.925695, -0.195116, -0.335663, 0.921553, -0.161488, -0.346328, 0.92411, -0.131518, -0.359084, 0.923992, -0.0957807, -0.370617, 0.923834, -0.0588926, -0.377553, 0.924113, -0.0216367, -0.382201, 0.923826, 0.0171832, -0.382121, 0.923953, 0.0557545, -0.378003, 0.924124, 0.0925419, -0.370746, 0.924112, 0.128631, -0.360436, 0.923872, 0.163092, -0.345565, 0.924114, 0.196419, -0.328323, 0.923917, 0.227376, -0.307104, 0.924114, 0.256704, -0.283702, 0.923914, 0.282421, -0.258108, 0.923915, 0.30536, -0.230019, 0.924038, 0.326694, -0.199142, 0.923912, 0.327082, -0.202874, 0.922962, 0.345472, -0.165166, 0.92378, 0.345472, -0.165166, 0.92378, 0.357309, -0.137248, 0.923847, 0.368449, -0.101414, 0.9241, 0.377034, -0.0648734, 0.923925, 0.381662, -0.0276115, 0.923889, 0.381972, 0.0111758, 0.924106, 0.378003, 0.0557523, 0.924124, 0.37101, 0.0926114, 0.923999, 0.359868, 0.12843, 0.924122, 0.345905, 0.163248, 0.923959, 0.328243, 0.196375, 0.923955, -0.120875, -0.261997, 0.957469, -0.136587, -0.250773, 0.958361, -0.0989364, -0.272942, 0.95693, -0.129959, -0.261528, 0.956407, -0.0730483, -0.281273, 0.956843, -0.0989364, -0.272942, 0.95693, -0.0450868, -0.286774, 0.956937, -0.016756, -0.28972, 0.956965, 0.0130394, -0.289996, 0.956939, 0.0427214, -0.287249, 0.956903, 0.0705549, -0.281195, 0.957054, 0.0978739, -0.273195, 0.956967, 0.124051, -0.262009, 0.957059, 0.149246, -0.24877, 0.956995, 0.172787, -0.232781, 0.957057, 0.194086, -0.215909, 0.95693, 0.194085, -0.215909, 0.95693, 0.218565, -0.193701, 0.956404, 0.214291, -0.195849, 0.956934, 0.231592, -0.174891, 0.956963, 0.245322, -0.155484, 0.956892, 0.25893, -0.130476, 0.957043, 0.345474, -0.165141, 0.923784, 0.345474, -0.165141, 0.923784, 0.270861, -0.104612, 0.956917, 0.35954, -0.135215, 0.923281, 0.279421, -0.0774563, 0.957039, 0.285667, -0.0496956, 0.95704, 0.289561, -0.0214802, 0.956919, 0.290115, 0.00831801, 0.956956, 0.287035, 0.0426958, 0.956968, 0.281474, 0.070626, 0.956966, 0.273306, 0.097908, 0.956931, 0.262011, 0.124048, 0.957059, 0.248608, 0.149143, 0.957053, -0.0836682, -0.175382, 0.980939, -0.105301, -0.164895, 0.980674, -0.104222, -0.179658, 0.978193, -0.098937, -0.272931, 0.956933, -0.0677604, -0.18296, 0.980782, -0.0836682, -0.175382, 0.980939, -0.0494199, -0.18842, 0.980844, -0.0764838, -0.280983, 0.95666, -0.098937, -0.272931, 0.956933, -0.0307126, -0.192374, 0.980841, -0.0117249, -0.194659, 0.980801, 0.00875241, -0.194592, 0.980845, 0.0291932, -0.193113, 0.980742, 0.047864, -0.188838, 0.980841, 0.0662377, -0.183511, 0.980784, 0.0837789, -0.175868, 0.980842, 0.10061, -0.166804, 0.980844, 0.116485, -0.156151, 0.980841, 0.176266, -0.231795, 0.956662, 0.194059, -0.21592, 0.956932, 0.131558, -0.144351, 0.980742, 0.194059, -0.21592, 0.956933, 0.143794, -0.13142, 0.980842, 0.153528, -0.120797, 0.980733, 0.164206, -0.104913, 0.980831, 0.17406, -0.0884769, 0.980752, 0.181519, -0.0708571, 0.980831, 0.187878, -0.0527954, 0.980772, 0.192349, -0.0341561, 0.980732, 0.194259, -0.0151111, 0.980834, 0.195265, 0.00536787, 0.980736, 0.192619, 0.0291189, 0.980842, 0.189221, 0.0479536, 0.980763, 0.183698, 0.066303, 0.980744, 0.175868, 0.0837782, 0.980842, 0.166804, 0.10061, 0.980844, -0.0347122, -0.091756, 0.995176, -0.0709622, -0.181471, 0.980833, -0.0839419, -0.175239, 0.980941, -0.0454921, -0.0881978, 0.995064, -0.0255817, -0.0948199, 0.995166, -0.0161211, -0.0965745, 0.995195, -0.00657603, -0.0976865, 0.995196, 0.00439898, -0.0978, 0.995196, 0.0153186, -0.0967069, 0.995195, 0.0247208, -0.0947337, 0.995196, 0.0338884, -0.0918574, 0.995195, 0.042854, -0.0883675, 0.995166, 0.0511629, -0.0834801, 0.995195, 0.0590958, -0.0780653, 0.995195, 0.0664584, -0.0718916, 0.995196, 0.0722672, -0.0660444, 0.995196, 0.0763407, -0.0613881, 0.99519, 0.0819865, -0.0536048, 0.995191, 0.0868472, -0.0453143, 0.995191, 0.0908719, -0.0365845, 0.99519, 0.0940163, -0.0274994, 0.995191, 0.0962641, -0.0181524, 0.99519, 0.0975765, -0.00863028, 0.995191, 0.0978922, 0.00234297, 0.995194, 0.0967071, 0.015317, 0.995195, 0.0947334, 0.024722, 0.995196, 0.0918567, 0.0338904, 0.995195, 0.088091, 0.0427317, 0.995195, 0.0834804, 0.0511624, 0.995195, -0.0535195, -0.0845, 0.994985, -0.0839419, -0.175239, 0.980941, -0.149872, -0.240943, 0.958898, -0.178357, -0.221816, 0.958638, -0.231783, -0.354316, 0.905945, -0.377228, -0.343042, 0.860245, -0.418671, -0.296308, 0.858438, 0.155985, -0.00686305, 0.987736, 0.162926, 0.0139181, 0.98654, 0.305617, -0.0042473, 0.952145, 0.316193, 0.0344077, 0.948071, 0.437278, -0.0035374, 0.899319, 0.4488, 0.0561253, 0.891868, 0.551423, 0.0221443, 0.833932, 0.557375, 0.0924972, 0.825092, 0.64018, 0.0663085, 0.765358, 0.636802, 0.152611, 0.755773, 0.696551, 0.146775, 0.702334, 0.679712, 0.23465, 0.694933, 0.708812, 0.257683, 0.656647, 0.683838, 0.324529, 0.653487, 0.668082, 0.380116, 0.63967, 0.649016, 0.411972, 0.639576, 0.245822, -0.0775334, 0.966209, 0.330485, -0.0219593, 0.943556, 0.521545, -0.0988122, 0.847483, 0.59773, -0.0312093, 0.80109, 0.732262, -0.089736, 0.675085, 0.793166, -0.00222127, 0.609001, 0.895018, 0.0129661, 0.445842, 0.905938, 0.0490282, 0.420563, 0.958928, 0.144773, 0.24392, 0.957847, 0.182024, 0.222255, 0.94829, 0.303679, 0.0923306, 0.923048, 0.380033, 0.0596496, 0.88231, 0.470581, 0.00908184, 0.821621, 0.569859, -0.014136, 0.790903, 0.611941, 0, 0.727872, 0.685713, 0, -0.124774, -0.257435, 0.958206, -0.152172, -0.239363, 0.958931, -0.115312, -0.263584, 0.957719, -0.382812, 0.331994, -0.862111, -0.427926, 0.318378, -0.845881, -0.352982, 0.414568, -0.838771, -0.374767, 0.404571, -0.83419, -0.373572, 0.404119, -0.834944, -0.328817, 0.500527, -0.800845, -0.387109, 0.409344, -0.826187, -0.346213, 0.500902, -0.793242, -0.305921, 0.583845, -0.752022, -0.304553, 0.589216, -0.74838, -0.275956, 0.658945, -0.699742, -0.257235, 0.669431, -0.696916, -0.246395, 0.727824, -0.63997, -0.194914, 0.734484, -0.650033, -0.20352, 0.781795, -0.589387, -0.140445, 0.790897, -0.595615, -0.0952554, 0.787775, -0.608553, -0.0600106, 0.820522, -0.568456, -0.499553, 0.259312, -0.826562, -0.389558, 0.410262, -0.824579, -0.409418, 0.417769, -0.811077, -0.433436, 0.374055, -0.819888, -0.39237, 0.411351, -0.822701, -0.364947, 0.489865, -0.791736, -0.28634, 0.598765, -0.74799, -0.202021, 0.693694, -0.691358, -0.105972, 0.767423, -0.632323, -0.0210267, 0.823363, -0.567126, 0.0810618, 0.84991, -0.520656, -0.544841, 0.173868, -0.820316, -0.462017, 0.323299, -0.825844, -0.36914, 0.474208, -0.799289, -0.267509, 0.612446, -0.743875, -0.159137, 0.728347, -0.666473, -0.0362719, 0.81284, -0.581357, 0.0911669, 0.861807, -0.498976, 0.201218, 0.882353, -0.425399, -0.596102, 0.0824593, -0.798664, -0.503152, 0.266201, -0.822177, -0.392791, 0.454932, -0.79922, -0.26552, 0.626295, -0.732975, -0.124332, 0.763099, -0.634209, 0.0249062, 0.852566, -0.522026, 0.174787, 0.893192, -0.414316, 0.303811, 0.895875, -0.324201, -0.609721, -0.0123675, -0.79252, -0.517973, 0.205607, -0.830319, -0.401608, 0.433944, -0.806476, -0.261149, 0.6408, -0.721926, -0.102148, 0.797166, -0.595056, 0.0659966, 0.890701, -0.449773, 0.232542, 0.920547, -0.313874, 0.37348, 0.904264, -0.20693, -0.609492, -0.104843, -0.785829, -0.524086, 0.145, -0.839231, -0.407625, 0.41287, -0.814481, -0.258959, 0.653493, -0.711257, -0.0874578, 0.829324, -0.551882, 0.0942186, 0.922452, -0.37444, 0.27181, 0.938604, -0.212467, 0.421916, 0.902116, -0.0904098, -0.62694, -0.160557, -0.762343, -0.567313, 0.0846469, -0.81914, -0.452677, 0.373651, -0.80961, -0.299425, 0.639897, -0.707727, -0.119689, 0.83397, -0.538673, 0.0692096, 0.935485, -0.346522, 0.251532, 0.952472, -0.171841, 0.447206, 0.893528, -0.0401801, 0.165292, -0.207013, 0.964274, 0.349398, -0.412728, 0.841176, 0.529293, -0.583572, 0.615867, 0.668952, -0.677236, 0.306358, 0.748323, -0.660079, -0.0656443, 0.739952, -0.497599, -0.452622, 0.624436, -0.188583, -0.757968, 0.427971, 0.189876, -0.883622, -0.60903, -0.282601, 0.741093, -0.567179, -0.284523, 0.772887, -0.588587, -0.23829, 0.772518, -0.63349, -0.222463, 0.74108, -0.608617, -0.18017, 0.772738, -0.652614, -0.15782, 0.741072, -0.623444, -0.11844, 0.772845, -0.665134, -0.0917881, 0.741061, -0.632638, -0.0503669, 0.772808, -0.670336, -0.0408111, 0.740935, -0.671957, -0.00218509, 0.740586, -0.633371, 0.0321546, 0.77318, -0.668338, 0.0686572, 0.740682, -0.626195, 0.0966166, 0.773657, -0.658379, 0.133837, 0.740692, -0.614277, 0.157676, 0.773176, -0.642066, 0.19772, 0.740715, -0.59605, 0.217191, 0.773015, -0.619615, 0.259707, 0.740695, -0.571884, 0.274566, 0.773021, -0.591178, 0.319189, 0.740694, -0.542165, 0.329267, 0.773072, -0.557033, 0.375596, 0.740703, -0.507253, 0.380802, 0.7731, -0.504387, 0.443121, 0.741106, -0.474865, 0.420786, 0.772944, -0.424134, 0.471877, 0.772944, -0.448833, 0.499362, 0.741071, -0.397766, 0.540995, 0.741017, -0.367859, 0.516771, 0.773064, -0.31755, 0.549137, 0.773053, -0.34293, 0.57756, 0.740826, -0.284507, 0.608049, 0.741169, -0.259987, 0.57864, 0.773034, -0.221046, 0.594469, 0.77314, -0.208044, 0.638575, 0.740905, -0.161734, 0.613351, 0.773074, -0.144421, 0.65577, 0.741019, -0.100886, 0.626604, 0.772781, -0.0794597, 0.666858, 0.740937, -0.0379108, 0.633319, 0.772962, -0.0301591, 0.670796, 0.741028, 0.00282166, 0.67181, 0.740718, 0.0348075, 0.633336, 0.773094, 0.0686576, 0.668338, 0.740682, 0.0967242, 0.626904, 0.773069, 0.133842, 0.658398, 0.740674, 0.157703, 0.614381, 0.773088, 0.213337, 0.636822, 0.740909, 0.217205, 0.596081, 0.772987, 0.27465, 0.61269, 0.741066, 0.274568, 0.571887, 0.773018, 0.336243, 0.581214, 0.741034, 0.320057, 0.547821, 0.772952, 0.367582, 0.517334, 0.772819, 0.402205, 0.537642, 0.741061, 0.443231, 0.504518, 0.740951, 0.402205, 0.537642, 0.741061, 0.420923, 0.475013, 0.772779, 0.460794, 0.436343, 0.772835, 0.510273, 0.436515, 0.740996, 0.504779, 0.384147, 0.773064, 0.550606, 0.384401, 0.740992, 0.553292, 0.310424, 0.772984, 0.577567, 0.342934, 0.740819, -0.485371, -0.26652, 0.832696, -0.510899, -0.209254, 0.833784, -0.53123, -0.159103, 0.832154, -0.545373, -0.108931, 0.831085, -0.55372, -0.0503589, 0.831179, -0.554551, 0.02856, 0.831659, -0.548854, 0.0848971, 0.831596, -0.538105, 0.138341, 0.831448, -0.521871, 0.190387, 0.831507, -0.500853, 0.240697, 0.831391, -0.474755, 0.288573, 0.831465, -0.444275, 0.333787, 0.831388, -0.405169, 0.380196, 0.831438, -0.365209, 0.418898, 0.831352, -0.336753, 0.441981, 0.831415, -0.291802, 0.472849, 0.831424, -0.244046, 0.49916, 0.831433, -0.193945, 0.520686, 0.831427, -0.141962, 0.537137, 0.831463, -0.0885698, 0.548039, 0.831751, -0.0333014, 0.554532, 0.831496, 0.0307051, 0.554742, 0.831456, 0.083777, 0.549084, 0.831557, 0.083777, 0.549084, 0.831557, 0.141419, 0.53933, 0.830135, 0.13834, 0.538105, 0.831448, 0.190475, 0.522118, 0.831332, 0.240576, 0.500587, 0.831586, 0.288703, 0.474968, 0.831298, 0.333725, 0.444189, 0.831459, 0.380199, 0.405169, 0.831437, 0.418817, 0.365137, 0.831425, 0.441926, 0.336712, 0.83146, 0.477136, 0.284631, 0.83146, -0.458014, -0.14048, 0.877775, -0.448058, -0.128891, 0.884665, -0.457372, -0.0830289, 0.885391, -0.466244, -0.0391002, 0.883792, -0.470634, 0.0252395, 0.881967, -0.466137, 0.0711152, 0.881849, -0.466137, 0.0711152, 0.881849, -0.457931, 0.120894, 0.880729, -0.456305, 0.117563, 0.882023, -0.443065, 0.161895, 0.88175, -0.424592, 0.204317, 0.88203, -0.402704, 0.245061, 0.881915, -0.377476, 0.282413, 0.881904, -0.377476, 0.282413, 0.881904, -0.346795, 0.322454, 0.88077, -0.347827, 0.317886, 0.882023, -0.321315, 0.344878, 0.881939, -0.285663, 0.374306, 0.882209, -0.247805, 0.400854, 0.881991, -0.207309, 0.423191, 0.882005, -0.164863, 0.441559, 0.881956, -0.120821, 0.455718, 0.881887, -0.0755499, 0.465232, 0.881959, -0.0283745, 0.470478, 0.881955, 0.0262976, 0.470775, 0.881861, 0.0337885, 0.555985, 0.830506, 0.083774, 0.549075, 0.831564, 0.0722712, 0.465643, 0.882016, 0.083774, 0.549075, 0.831564, 0.117588, 0.45641, 0.881965, 0.161829, 0.442882, 0.881854, 0.204268, 0.424487, 0.882092, 0.244955, 0.402521, 0.882028, 0.283296, 0.376661, 0.88197, 0.318009, 0.347961, 0.881926, 0.349858, 0.316089, 0.881866, 0.379067, 0.280214, 0.881923, 0.404701, 0.241704, 0.881928, -0.384903, -0.0371458, 0.922209, -0.376992, -0.0197369, 0.926006, -0.381946, 0.0224646, 0.923912, -0.472049, 0.0295758, 0.881076, -0.466126, 0.0711241, 0.881855, -0.378112, 0.0589746, 0.92388, -0.466126, 0.0711241, 0.881855, -0.370437, 0.0957329, 0.923911, -0.359345, 0.13161, 0.923878, -0.344197, 0.165951, 0.924115, -0.326594, 0.199083, 0.92396, -0.402285, 0.248514, 0.88114, -0.377494, 0.282374, 0.881909, -0.305526, 0.230155, 0.923949, -0.377494, 0.282374, 0.881909, -0.282069, 0.257794, 0.92411, -0.261152, 0.279682, 0.923893, -0.282069, 0.257794, 0.92411, -0.232483, 0.303936, 0.923891, -0.201322, 0.324834, 0.924095, -0.16852, 0.343014, 0.92409, -0.134238, 0.358316, 0.923899, -0.0983622, 0.369304, 0.924089, -0.0616865, 0.377138, 0.9241, -0.0231769, 0.381928, 0.923901, 0.0216243, 0.381991, 0.923913, 0.0589663, 0.378044, 0.923908, 0.0957815, 0.370617, 0.923834, 0.131578, 0.359253, 0.923918, 0.16595, 0.344197, 0.924115, 0.199143, 0.326694, 0.923912, 0.230193, 0.305586, 0.92392, 0.258096, 0.282404, 0.923923, 0.283696, 0.256698, 0.923917, 0.307496, 0.227659, 0.923914, 0.328243, 0.196375, 0.923955, -0.285225, -0.0105507, 0.958403, -0.287815, 0.020895, 0.957458, -0.28677, 0.0450836, 0.956938, -0.280995, 0.0729812, 0.95693, -0.272565, 0.100202, 0.956905, -0.26116, 0.126307, 0.956996, -0.247786, 0.151457, 0.956903, -0.23157, 0.174883, 0.95697, -0.30421, 0.233243, 0.923609, -0.282062, 0.257787, 0.924114, -0.21421, 0.195775, 0.956967, -0.218559, 0.193705, 0.956405, -0.282062, 0.257787, 0.924114, -0.259607, 0.282046, 0.923609, -0.194082, 0.215916, 0.956929, -0.176767, 0.230224, 0.956948, -0.194082, 0.215916, 0.956929, -0.153348, 0.246441, 0.956949, -0.12858, 0.260561, 0.956857, -0.102218, 0.271324, 0.957045, -0.0752069, 0.280348, 0.956948, -0.0473236, 0.286062, 0.957042, -0.0177601, 0.289695, 0.956954, 0.016763, 0.289816, 0.956936, 0.0450756, 0.286683, 0.956964, 0.0728795, 0.280593, 0.957056, 0.100133, 0.272378, 0.956966, 0.126218, 0.260971, 0.95706, 0.151404, 0.247701, 0.956933, 0.174701, 0.231335, 0.95706, 0.195565, 0.21398, 0.957062, 0.215916, 0.194082, 0.956929, 0.193705, 0.218559, 0.956405, 0.233275, 0.173148, 0.956871, 0.215916, 0.194082, 0.956929, 0.248608, 0.149143, 0.957053, -0.206974, -0.0212436, 0.978116, -0.194869, 0.0034719, 0.980823, -0.192865, 0.0307879, 0.980742, -0.188419, 0.0494228, 0.980844, -0.182681, 0.0676569, 0.980842, -0.175436, 0.0853615, 0.980783, -0.165974, 0.101994, 0.980841, -0.155334, 0.117884, 0.980803, -0.143795, 0.131419, 0.980842, -0.134026, 0.141997, 0.980752, -0.19406, 0.215921, 0.956932, -0.119227, 0.154133, 0.98083, -0.19406, 0.215921, 0.956932, -0.176274, 0.231794, 0.95666, -0.103539, 0.165062, 0.980833, -0.0868635, 0.174422, 0.980832, -0.0693482, 0.182092, 0.980833, -0.0511676, 0.188022, 0.980831, -0.0324917, 0.192131, 0.980831, -0.0121552, 0.194438, 0.98084, 0.011743, 0.194945, 0.980744, 0.0307903, 0.192861, 0.980743, 0.0494953, 0.188718, 0.980783, 0.0677973, 0.183061, 0.980761, 0.0852381, 0.175175, 0.980841, 0.102196, 0.166305, 0.980764, 0.117774, 0.155177, 0.980841, 0.13142, 0.143795, 0.980842, 0.143971, 0.13122, 0.980843, 0.215916, 0.194065, 0.956932, 0.156151, 0.116485, 0.980841, 0.231793, 0.176274, 0.95666, 0.215916, 0.194065, 0.956932, 0.166804, 0.10061, 0.980844, -0.0988856, 0.004803, 0.995087, -0.0965742, 0.0161233, 0.995195, -0.0947213, 0.0255598, 0.995176, -0.0915738, 0.0346498, 0.995195, -0.0877354, 0.0434572, 0.995195, -0.083051, 0.0518463, 0.995196, -0.0776462, 0.0597985, 0.995186, -0.0722659, 0.0660459, 0.995196, -0.067989, 0.0705153, 0.995191, -0.0607555, 0.0768445, 0.99519, -0.0529304, 0.08243, 0.99519, -0.0445943, 0.0872189, 0.995191, -0.0359664, 0.0915511, 0.995151, -0.0267216, 0.0942408, 0.995191, -0.0173545, 0.0964131, 0.99519, -0.00645255, 0.0977075, 0.995194, 0.00657737, 0.0976865, 0.995196, 0.0161197, 0.0965747, 0.995195, 0.025507, 0.0945246, 0.995196, 0.0346496, 0.0915739, 0.995195, 0.0434573, 0.0877354, 0.995195, 0.0518474, 0.0830504, 0.995196, 0.0597441, 0.0775711, 0.995195, 0.0660464, 0.0722654, 0.995196, 0.0718904, 0.0664597, 0.995196, 0.0780637, 0.059098, 0.995195, 0.0834804, 0.0511624, 0.995195, -0.0998348, -0.0214458, 0.994773, -0.282505, -0.0270737, 0.958884, -0.414868, -0.0686494, 0.907288, -0.459575, -0.217274, 0.861152, 0.0849277, 0.137372, 0.986872, 0.0532427, 0.14447, 0.988076, 0.210114, 0.254382, 0.944003, 0.121509, 0.132233, 0.983743, 0.17433, 0.261906, 0.949218, 0.0949382, 0.13709, 0.985999, 0.293034, 0.357662, 0.886684, 0.239512, 0.374447, 0.895781, 0.358153, 0.440349, 0.823297, 0.319298, 0.458244, 0.829495, 0.387748, 0.517641, 0.762692, 0.43441, 0.489265, 0.756246, 0.48695, 0.521799, 0.700432, 0.510829, 0.501815, 0.698022, 0.586456, 0.475395, 0.655797, 0.591223, 0.470074, 0.655352, 0.0892976, 0.274587, 0.957407, 0.0743643, 0.266632, 0.960925, 0.22344, 0.5275, 0.819645, 0.173878, 0.509425, 0.842765, 0.327742, 0.693388, 0.641715, 0.282398, 0.68759, 0.668933, 0.433033, 0.780766, 0.45043, 0.366469, 0.789664, 0.492068, 0.469208, 0.82534, 0.314099, 0.530395, 0.80048, 0.279128, 0.572893, 0.802926, 0.164634, 0.614687, 0.775137, 0.146021, 0.665029, 0.744416, 0.0598359, 0.700778, 0.711579, 0.050644, 0.058903, 0.143473, 0.9879, 0.0778165, 0.140136, 0.98707, 0.148457, 0.127163, 0.980709, 0.0508643, 0.484954, -0.873059, 0.104567, 0.544085, -0.832489, 0.106957, 0.538674, -0.835697, 0.107032, 0.471218, -0.875499, 0.103186, 0.57642, -0.810612, 0.167357, 0.600983, -0.781544, 0.20922, 0.631877, -0.746296, 0.13101, 0.62209, -0.771907, 0.211923, 0.696095, -0.68596, 0.121, 0.70283, -0.700991, 0.176552, 0.758491, -0.627313, 0.0835934, 0.760529, -0.643901, 0.0923992, 0.748255, -0.656945, 0.110507, 0.80435, -0.583789, 0.0322702, 0.825243, -0.563855, -0.0395265, 0.855865, -0.515687, 0.0281684, 0.824762, -0.564779, -0.0163836, 0.78761, -0.615956, 0.104084, 0.556138, -0.824547, 0.241113, 0.58151, -0.776989, 0.322931, 0.614602, -0.719709, 0.102215, 0.596963, -0.79573, 0.102092, 0.599398, -0.793914, 0.370434, 0.66001, -0.653579, 0.378888, 0.714557, -0.588093, 0.346869, 0.770177, -0.535267, 0.280631, 0.816352, -0.504792, 0.19053, 0.843766, -0.501754, 0.391974, 0.580165, -0.713978, 0.483555, 0.606566, -0.631072, 0.533931, 0.644799, -0.546947, 0.541842, 0.696263, -0.47077, 0.508711, 0.754075, -0.415433, 0.439622, 0.80923, -0.389718, 0.342725, 0.851405, -0.39705, 0.521625, 0.54793, -0.653973, 0.615593, 0.567654, -0.54664, 0.663323, 0.600981, -0.445899, 0.667015, 0.653671, -0.357498, 0.630381, 0.717734, -0.295768, 0.558225, 0.78484, -0.269092, 0.456722, 0.844008, -0.281168, 0.62291, 0.467546, -0.627204, 0.723844, 0.479064, -0.496535, 0.772259, 0.525603, -0.356872, 0.768472, 0.591753, -0.243473, 0.725408, 0.666783, -0.170829, 0.647371, 0.749519, -0.138318, 0.539106, 0.828412, -0.151982, 0.72647, 0.412633, -0.549523, 0.816192, 0.420682, -0.396052, 0.853716, 0.44801, -0.265435, 0.848122, 0.508212, -0.1497, 0.79503, 0.604096, -0.0547337, 0.71187, 0.70214, -0.0155108, 0.599037, 0.800252, -0.0274146, 0.775796, 0.396758, -0.490635, 0.853219, 0.405914, -0.327493, 0.87644, 0.446549, -0.180131, 0.864598, 0.495548, -0.0830757, 0.826752, 0.562315, -0.0167881, 0.745027, 0.666417, 0.0286723, 0.634668, 0.772485, 0.02154, -0.101459, 0.21338, 0.971687, -0.194661, 0.507985, 0.839082, -0.25879, 0.742713, 0.61758, -0.274894, 0.910348, 0.309355, -0.279437, 0.957042, 0.0773675, -0.195291, 0.972617, -0.126008, -0.0395265, 0.855865, -0.515687, -0.149601, 0.962673, -0.225567, -0.0163836, 0.78761, -0.615956, -0.0952554, 0.787775, -0.608553, 0.00280531, -0.00480988, -0.999984, -0.445001, 0.877998, -0.176331, 0.643475, 0.213882, -0.734979, 0.724457, 0.0764552, -0.685067, 0.0131155, -0.0179175, -0.999753, -0.523935, 0.832086, -0.182004, 0.580176, 0.356457, -0.732348, 0.0131579, -0.0146353, -0.999806, -0.612514, 0.771508, -0.172053, 0.470379, 0.481697, -0.739399, 0.0143791, -0.0130771, -0.999811, -0.68543, 0.707673, -0.171419, 0.481061, 0.476778, -0.735706, 0.0168711, -0.0125776, -0.999779, -0.750489, 0.637748, -0.17333, 0.479009, 0.485565, -0.731285, 0.00680348, -0.00409498, -0.999968, -0.0241973, 0.0116157, -0.99964, 0.912704, -0.371308, -0.170591, 0.291035, 0.609784, -0.737199, -0.0121556, 0.00445817, -0.999916, 0.944919, -0.280323, -0.168958, 0.226918, 0.6352, -0.738261, -0.905214, 0.389941, -0.168918, 0.162706, 0.655096, -0.737818, 0.0126518, -0.00324154, -0.999915, -0.939315, 0.298218, -0.169567, 0.103608, 0.661799, -0.742487, 0.0170638, -0.00259197, -0.999851, -0.963318, 0.207312, -0.170415, 0.0331398, 0.674513, -0.737519, -7.03586e-06, 1.51723e-05, -1, -0.0150047, -0.000656002, -0.999887, -0.0319587, 0.672302, -0.739587, 0.979826, 0.10406, -0.170626, -0.985765, 0.0134025, -0.167596, -0.104661, 0.669385, -0.735507, 1.0369e-05, 1.94821e-05, -1, -0.0126823, -0.00304551, -0.999915, -0.170068, 0.649248, -0.741319, 0.941635, 0.29176, -0.16793, -0.218583, 0.640131, -0.736514, -0.000145829, 4.84092e-06, -1, -0.969429, -0.176393, -0.170569, -0.296874, 0.606131, -0.737883, 0.865603, 0.470935, -0.170152, -0.000182744, -0.000218846, -1, -0.0948041, -0.044519, -0.9945, -0.351864, 0.572228, -0.740774, 0.0944539, 0.0440912, -0.994552, 0.011149, 0.0066661, -0.999916, -0.000182777, -0.000218851, -1, -0.915129, -0.366521, -0.167931, -0.388749, 0.547082, -0.741334, 0.0120955, 0.0088704, -0.999888, -0.876466, -0.449037, -0.173705, -0.452426, 0.499266, -0.738948, 0.0130246, 0.0117014, -0.999847, -0.827053, -0.536004, -0.16936, -0.503745, 0.446438, -0.73955, -4.51461e-05, -0.000116018, -1, -0.770283, -0.614801, -0.169365, 0.542471, 0.822741, -0.169773, -0.00893579, -0.0119006, -0.999889, -0.536403, 0.41427, -0.735291, -0.0155839, -0.0257897, -0.999546, 0.457947, 0.872595, -0.169893, -0.569222, 0.35222, -0.742918, -0.00567172, -0.0120189, -0.999912, 0.371888, 0.91238, -0.17106, -0.60537, 0.291437, -0.74067, -0.476972, -0.862444, -0.169375, -0.634769, 0.228095, -0.738269, 0.0051382, 0.014053, -0.999888, -0.392133, -0.903946, -0.170629, -0.655427, 0.170098, -0.735854, 0.00368278, 0.0146063, -0.999887, -0.299686, -0.938566, -0.17112, -0.662532, 0.10233, -0.742011, 0.00219825, 0.0148099, -0.999888, -0.202324, -0.965201, -0.165685, -0.672143, 0.0347315, -0.739606, -2.61101e-05, 0.000156348, -1, 0.00133116, -0.0299044, -0.999552, -0.0985919, 0.981248, -0.165627, -0.674658, -0.0308114, -0.737487, 0.00493619, -0.0345742, -0.99939, -0.199476, 0.964952, -0.170523, -0.669896, -0.0971352, -0.736074, 0.00271763, -0.011202, -0.999934, -0.292332, 0.941265, -0.169002, -0.650416, -0.159611, -0.742619, 0.17798, -0.969099, -0.170792, -0.632743, -0.225998, -0.740649, 9.82159e-05, 9.89619e-05, -1, 9.82612e-05, 9.89694e-05, -1, 0.0126168, -0.0270816, -0.999554, -0.611903, -0.285978, -0.737422, -0.470107, 0.865928, -0.17079, 0.00758897, -0.0128403, -0.999889, -0.577654, -0.341265, -0.741522, -0.553559, 0.815172, -0.170492, 0.731486, -0.133232, -0.668714, 0.00270454, -0.00571201, -0.99998, 0.550091, -0.81831, -0.166638, 0.00961503, -0.0271311, -0.999586, -0.246777, 0.948716, -0.197581, 0.696675, -0.437946, -0.568196, 0.00601505, -0.0242915, -0.999687, -0.14974, 0.968162, -0.2006, 0.648753, -0.507842, -0.566759, 0.480864, -0.77639, -0.407416, 0.00129173, -0.00870717, -0.999961, 0.000835872, -0.0182139, -0.999834, 0.0304384, 0.981244, -0.190352, 0.591121, -0.49759, -0.634807, 0.0904572, -0.983606, -0.156005, 0.67446, -0.0263429, -0.737841, 0.000824331, 0.014802, -0.99989, 0.00566009, -0.985264, -0.170948, 0.662423, -0.095472, -0.743021, 0.00266934, 0.0173194, -0.999846, -0.0907063, -0.981165, -0.170549, 0.648011, -0.177387, -0.740686, 5.96832e-06, -0.000125731, -1, 5.37056e-05, 4.5288e-05, -1, 0.390866, 0.904401, -0.171118, 0.635589, -0.22619, -0.73815, 5.63838e-05, 0.000127339, -1, 0.605118, -0.292292, -0.740539, -0.280076, -0.944684, -0.170677, -0.00686353, -0.0113684, -0.999912, 0.559583, 0.810974, -0.170846, 0.582604, -0.332219, -0.741757, -0.0103778, -0.0139713, -0.999849, 0.63528, 0.753279, -0.170265, 0.535595, -0.408017, -0.739365, -0.0101067, -0.011067, -0.999888, 0.70723, 0.686094, -0.170593, 0.488603, -0.456912, -0.743303, -0.011159, -0.0100253, -0.999888, 0.770887, 0.613238, -0.172258, 0.440964, -0.501025, -0.744664, -0.010539, -0.00783488, -0.999914, 0.826553, 0.536214, -0.171128, 0.402414, -0.540253, -0.739047, -0.0149494, -0.00885155, -0.999849, 0.875505, 0.452664, -0.169074, 0.355321, -0.570672, -0.740325, 0.000140926, 1.54085e-05, -1, 0.914903, 0.367705, -0.16657, 0.283987, -0.605296, -0.743618, 0.225572, -0.632713, -0.740805, 0.012308, 0.00437547, -0.999915, -0.866618, -0.469245, -0.169653, 0.152877, -0.657664, -0.737636, 0.0168592, 0.00421093, -0.999849, -0.907798, -0.383361, -0.170109, 0.0965224, -0.669987, -0.736072, -1.50222e-05, -2.31459e-05, -1, -0.941372, -0.292128, -0.168762, -2.81904e-05, -1.13856e-05, -1, 0.985517, -0.0146254, -0.168945, 0.0426739, -0.674193, -0.737321, -0.040069, -0.674546, -0.737144, 0.0173411, -0.00095619, -0.999849, -0.979952, -0.103637, -0.170158, -0.0957845, -0.662376, -0.743023, 0.0129304, -0.00201062, -0.999914, -0.985262, -0.00567125, -0.17096, -0.981027, 0.0913695, -0.170988, -0.16306, -0.647895, -0.744072, 0.0168829, -0.00428137, -0.999848, -0.967585, 0.187425, -0.169266, -0.240695, -0.628095, -0.739975, 0.0139736, -0.00506767, -0.999889, -0.944421, 0.28006, -0.172151, -0.29883, -0.597919, -0.74377, 0.0135178, -0.00651334, -0.999887, -0.912753, 0.371072, -0.170841, -0.345979, -0.575968, -0.740647, 0.011211, -0.00675783, -0.999914, -0.870838, 0.460838, -0.171084, -0.413508, -0.521973, -0.746026, -3.95e-06, -6.26263e-05, -1, -0.413505, -0.521976, -0.746026, -0.00971034, 0.00886566, -0.999914, 0.686954, -0.706118, -0.171732, -0.446224, -0.50394, -0.739546, -0.765832, 0.619908, -0.170924, -0.493364, -0.456131, -0.740632, 8.5637e-05, -6.87955e-05, -1, -0.00777141, 0.0104881, -0.999915, 0.535577, -0.827078, -0.170587, -0.535103, -0.405226, -0.741253, 0.00758897, -0.0128403, -0.999889, 0.452066, -0.875499, -0.170696, -0.577654, -0.341265, -0.741522, 0.00352884, -0.00479942, -0.999982, 0.00182552, -0.00307496, -0.999994, 0.00500459, -0.00556756, -0.999972, 0.00648165, -0.00591816, -0.999961, 0.00811457, -0.00606417, -0.999949, 0.0085949, -0.00520639, -0.999949, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0.00133481, -0.00285627, -0.999995, 0.00102469, -0.00290437, -0.999995, 0.000562525, -0.00228541, -0.999997, 0.0002035, -0.00141252, -0.999999, 3.55704e-05, -0.000791426, -1, -1.97833e-05, -0.000371336, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, -0.000374353, 1, 0, 0.000369148, 0.994764, 0.102195, 0.00635177, 0.997637, 0.0684118, -0.00134512, 0.999987, -0.00488826, -0.00887953, 0.997117, -0.0753642, 0.000253814, 0.994764, -0.102195, 0.00731139, 0.997635, -0.068339, -0.000858947, 0.999987, 0.00493888, -0.00728742, 0.997121, 0.0754738, -0.00540514, 0.981493, 0.191423, 0.00477755, 0.982217, 0.187687, 0.0117531, 0.987909, 0.154588, 0.0115484, 0.994985, 0.0993605, 0.00495705, 0.999611, 0.0274583, -0.00799775, 0.998913, -0.0459132, -0.0127643, 0.993282, -0.115016, -0.0148764, 0.986125, -0.165336, -0.00278996, 0.981489, -0.191497, 0.00415052, 0.982159, -0.188007, 0.0111331, 0.987843, -0.155053, 0.0147734, 0.994996, -0.0988186, 0.00445836, 0.999613, -0.0274537, -0.00829651, 0.998918, 0.0457558, -0.0135958, 0.993239, 0.115285, -0.0115969, 0.986179, 0.165275, -0.00791787, 0.957284, 0.289041, 0.01204, 0.959055, 0.282963, 0.0231706, 0.971816, 0.234597, 0.0212574, 0.988492, 0.149775, 0.00857235, 0.99908, 0.0420146, -0.0172546, 0.997472, -0.0689375, -0.0286039, 0.98466, -0.172125, -0.0234744, 0.967975, -0.249947, -0.00946901, 0.95729, -0.288974, 0.0101664, 0.958948, -0.283401, 0.021509, 0.971882, -0.234484, 0.0200372, 0.988469, -0.150091, 0.00929201, 0.999083, -0.041798, -0.014695, 0.997467, 0.0695915, -0.028139, 0.984671, 0.172138, -0.0228971, 0.968046, 0.249727, 0.0015954, 0.925596, 0.378511, 0.0104897, 0.927119, 0.374621, 0.0179948, 0.933658, 0.357712, 0.0328786, 0.945141, 0.325002, 0.0328617, 0.95888, 0.281902, 0.0332711, 0.973594, 0.225847, 0.0263839, 0.986204, 0.163418, 0.0238941, 0.99574, 0.0890609, 0.00504834, 0.999815, 0.0185721, -0.0163007, 0.998412, -0.0539241, -0.0269146, 0.991647, -0.12614, -0.0307502, 0.98011, -0.196057, -0.0316743, 0.966272, -0.255569, -0.0276479, 0.951553, -0.306238, -0.0274711, 0.939144, -0.342425, -0.011438, 0.929654, -0.368257, -0.00222507, 0.925622, -0.378443, 0.0116244, 0.927131, -0.374557, 0.0210043, 0.933742, -0.357331, 0.0306004, 0.945167, -0.32515, 0.0329603, 0.958791, -0.282193, 0.0333905, 0.973501, -0.226231, 0.0251339, 0.986161, -0.163873, 0.0210407, 0.995712, -0.0900869, 0.00455376, 0.999815, -0.0186663, -0.0152183, 0.998429, 0.0539317, -0.0269331, 0.991648, 0.126133, -0.0307723, 0.980111, 0.196049, -0.0411761, 0.966614, 0.252907, -0.0269189, 0.966016, 0.257076, -0.0286032, 0.951596, 0.306017, -0.0409211, 0.966604, 0.252986, -0.0232934, 0.938898, 0.343408, -0.0160708, 0.929752, 0.367836, -0.00210298, 0.881808, 0.471604, 0.00918212, 0.881649, 0.471816, 0.0122053, 0.884048, 0.467237, 0.0250792, 0.894636, 0.446091, 0.0432935, 0.912259, 0.40732, 0.0460961, 0.934205, 0.353745, 0.0472543, 0.957477, 0.284615, 0.036937, 0.977934, 0.205621, 0.0284994, 0.993053, 0.114163, 0.00679633, 0.999717, 0.0227875, -0.0174659, 0.997445, -0.0692714, -0.0388673, 0.9866, -0.15846, -0.0434811, 0.968177, -0.246459, -0.0454475, 0.945646, -0.322006, -0.0474521, 0.922995, -0.381876, -0.0317766, 0.902587, -0.429334, -0.0118931, 0.888046, -0.4596, -0.00116815, 0.881818, -0.471588, 0.010192, 0.884002, -0.467371, 0.0233531, 0.894406, -0.446646, 0.0393646, 0.912138, -0.407988, 0.0399846, 0.933606, -0.356062, 0.0422977, 0.957017, -0.286931, 0.0400274, 0.97805, -0.20449, 0.0265071, 0.99295, -0.115535, 8.73991e-05, 0.999652, -0.0263784, -0.0244503, 0.997548, 0.0655798, 0.0116476, 0.999728, -0.0201895, -0.0396912, 0.986705, 0.157599, -0.0487979, 0.968524, 0.244089, -0.0453926, 0.945784, 0.321607, -0.0366973, 0.966448, 0.254228, -0.027626, 0.966048, 0.256881, -0.0373417, 0.922253, 0.384779, -0.03191, 0.902595, 0.429307, -0.0167515, 0.888242, 0.459071, -0.01118, 0.881855, 0.471389, -0.00216771, 0.881809, 0.471602, -0.00515898, 0.823701, 0.567001, 0.000147022, 0.881781, 0.47166, 0.0221199, 0.826991, 0.56178, 0.0417452, 0.842262, 0.53745, 0.0549826, 0.867904, 0.493679, 0.0648946, 0.900585, 0.429809, 0.0652956, 0.935286, 0.347817, 0.0507768, 0.966122, 0.25304, 0.0282233, 0.988735, 0.14699, 0.00237945, 0.999478, 0.0322324, -0.0308126, 0.996345, -0.0796735, -0.0466676, 0.97929, -0.197011, -0.0731802, 0.952857, -0.294464, -0.0736716, 0.918666, -0.388104, -0.0451911, 0.949692, -0.309909, -0.0645838, 0.884009, -0.462988, -0.047171, 0.853913, -0.518273, -0.0331973, 0.83322, -0.551945, -0.00545064, 0.823704, -0.566994, 0.0232231, 0.826944, -0.561804, 0.0411322, 0.84237, -0.537328, 0.0579052, 0.868039, -0.493108, 0.0664224, 0.900621, -0.4295, 0.0606874, 0.934565, -0.350578, 0.0503862, 0.966082, -0.253272, 0.0164587, 0.987822, -0.154713, 0.00607931, 0.999544, -0.0295653, -0.000306569, 0.999646, -0.0265907, 0.054455, 0.990062, -0.129662, -0.0209895, 0.996044, 0.0863417, 0.0117701, 0.999728, -0.0201234, -0.0421673, 0.978821, 0.200328, -0.0605104, 0.951411, 0.30192, -0.0669369, 0.917878, 0.391177, -0.0687785, 0.884284, 0.461857, -0.056168, 0.854492, 0.516418, -0.0338844, 0.833254, 0.551851, 1.71158e-05, 0.881782, 0.471657, 0.00463277, 0.796171, 0.605054, 0.141345, 0.794661, 0.590369, 0.212365, 0.798169, 0.563762, 0.231094, 0.810373, 0.538415, 0.26136, 0.823891, 0.502886, 0.308657, 0.837767, 0.45042, 0.275433, 0.860711, 0.428151, 0.299281, 0.878762, 0.371763, 0.236351, 0.903101, 0.358533, 0.228784, 0.922734, 0.310194, 0.226, 0.940278, 0.254562, 0.178417, 0.958397, 0.222808, 0.149092, 0.97256, 0.178604, 0.125142, 0.984134, 0.125778, 0.0797903, 0.992925, 0.0879404, 0.0449883, 0.998204, 0.0395667, -0.000602998, 0.999999, 0.000960825, -0.0495501, 0.998063, -0.0376154, -0.0786416, 0.993017, -0.0879402, -0.127718, 0.983905, -0.12498, -0.164579, 0.972174, -0.166711, -0.183405, 0.957903, -0.220874, -0.079658, 0.953447, -0.290848, -0.0533298, 0.95071, -0.30546, -0.206142, 0.941359, -0.267113, -0.253489, 0.921087, -0.295538, -0.0494343, 0.950231, -0.3076, -0.0812754, 0.895601, -0.437371, -0.0599094, 0.892439, -0.447172, -0.29658, 0.878861, -0.37369, -0.0803398, 0.895472, -0.437808, -0.308232, 0.857583, -0.411758, -0.275634, 0.840989, -0.46558, -0.294176, 0.820418, -0.490281, -0.235914, 0.809659, -0.537399, -0.0355027, 0.803706, -0.593966, -0.0121367, 0.802494, -0.596536, -0.136715, 0.794841, -0.591216, -0.0334897, 0.80362, -0.5942, -0.0043313, 0.795996, -0.605286, 0.118264, 0.796057, -0.593554, 0.190323, 0.800293, -0.568602, 0.266082, 0.806673, -0.527711, 0.290927, 0.820563, -0.491973, 0.268251, 0.841949, -0.468148, 0.275422, 0.860712, -0.428156, 0.299304, 0.87876, -0.371751, 0.214186, 0.903578, -0.371042, 0.254444, 0.921201, -0.294358, 0.207336, 0.941173, -0.266844, 0.197509, 0.957494, -0.210225, 0.149081, 0.97256, -0.178612, 0.0146176, 0.987661, -0.155922, 0.124919, 0.984188, -0.125574, 0.0180588, 0.987957, -0.15367, 0.0303225, 0.988877, -0.145615, 0.0800715, 0.992865, -0.088362, 0.044989, 0.998204, -0.0395662, 0.056579, 0.990126, -0.128254, -0.00133736, 0.999998, -0.00151885, -0.0466489, 0.998137, 0.039317, -0.0877636, 0.992836, 0.0810773, -0.11876, 0.984163, 0.131602, -0.164582, 0.972173, 0.166709, -0.183206, 0.958025, 0.220507, -0.205967, 0.941499, 0.266754, -0.253598, 0.920964, 0.295828, -0.241183, 0.90287, 0.355889, -0.271125, 0.880901, 0.387948, -0.272217, 0.861385, 0.428851, -0.304194, 0.837862, 0.453269, -0.25718, 0.824463, 0.504102, -0.261828, 0.807026, 0.529298, -0.21435, 0.798124, 0.563073, -0.124415, 0.795405, 0.593171, 0.210706, -0.977549, 0, -0.0124011, -0.999923, 0, 0.0905921, -0.995888, 0, 0.434896, -0.900481, 0, 0.494685, -0.869073, 0, 0.630442, -0.776236, 0, 0.704175, -0.710027, 0, 0.72859, -0.68495, 0, 0.904969, -0.425477, 0, 0.903851, -0.427847, 0, 0.957648, -0.287942, 0, 0.99873, -0.0503744, 0, 0.998577, -0.053327, 0, 0.971182, 0.23834, 0, 0.935811, 0.352503, 0, 0.924411, 0.381398, 0, 0.894228, 0.447611, 0, 0.757075, 0.653328, 0, 0.692734, 0.721193, 0, 0.682055, 0.731301, 0, 0.491127, 0.871088, 0, 0.328392, 0.944542, 0, 0.379799, 0.925069, 0, 0.171356, 0.985209, 0, 0.0381462, 0.999272, 0, -0.104892, 0.994484, 0, -0.13829, 0.990392, 0, -0.310779, 0.950482, 0, -0.522331, 0.852743, 0, -0.457381, 0.889271, 0, -0.630136, 0.776485, 0, -0.833456, 0.552586, 0, -0.724626, 0.689142, 0, -0.864565, 0.502521, 0, -0.985807, 0.167886, 0, -0.912703, 0.408623, 0, -0.980286, 0.197583, 0, -0.974332, -0.225116, 0, -0.999527, 0.0307474, 0, -0.979796, -0.2, 0, -0.82288, -0.568216, 0, -0.936857, -0.349711, 0, -0.566886, -0.823797, 0, -0.800035, -0.599954, 0, -0.697087, -0.716987, 0, -0.244501, -0.969649, 0, -0.452818, -0.891603, 0, -0.25334, -0.967377, 0, 0.104351, -0.994541, 0, -0.028605, -0.999591, 0, 0.15911, -0.987261, 0, 0.402945, -0.915224, 0, 0.410281, -0.911959, 0, 0.648448, -0.761259, 0, 0.654113, -0.756397, 0, 0.83748, -0.546468, 0, 0.906373, -0.422478, 0, 0.925476, -0.378807, 0, 0.984981, -0.172662, 0, 0.999136, -0.0415621, 0, 0.997504, 0.070616, 0, 0.997788, -0.0664815, 0, 0.942362, 0.334594, 0, 0.944889, 0.327392, 0, 0.845319, 0.534262, 0, 0.768183, 0.64023, 0, 0.737443, 0.67541, 0, 0.62487, 0.780729, 0, 0.498048, 0.867149, 0, 0.395312, 0.918547, 0, 0.335573, 0.942014, 0, 0.163654, 0.986518, 0, -0.020419, 0.999792, 0, 0.0216903, 0.999765, 0, -0.169469, 0.985536, 0, -0.445625, 0.89522, 0, -0.307391, 0.951583, 0, -0.504108, 0.863641, 0, -0.804844, 0.593486, 0, -0.615024, 0.788508, 0, -0.724599, 0.689171, 0, -0.978802, 0.20481, 0, -0.868272, 0.496089, 0, -0.945969, 0.324259, 0, -0.992058, -0.125784, 0, -0.978329, 0.207057, 0, -0.997858, -0.0654247, 0, -0.865447, -0.501001, 0, -0.972489, -0.232947, 0, -0.89821, -0.439567, 0, -0.6203, -0.784365, 0, -0.791122, -0.611659, 0, -0.63127, -0.775563, 0, -0.266648, -0.963794, 0, -0.411503, -0.911408, 0, -0.253347, -0.967376, 0, 0.954296, -0.298862, 0, -0.574844, 0.818263, 0, -0.782103, 0.623149, 0, -0.454624, 0.863279, -0.219243, -0.483248, 0.852752, -0.198208, -0.950838, 0.30969, 0, -0.531548, 0.714896, -0.454291, -0.299045, 0.785603, -0.541665, -0.322805, 0.780965, -0.534688, 0.865887, 0.500239, 0, 0.577509, 0.816384, 0, 0.578215, 0.815792, -0.0122791, 0.580662, 0.810174, -0.080315, 0.571211, 0.818397, 0.0627974, 0.573512, 0.812879, 0.101545, 0.58082, 0.810062, 0.0803024, 0.578416, 0.81565, 0.0122554, 0.57126, 0.818363, -0.0628019, 0.573496, 0.812891, -0.101544, 0.580332, 0.804518, -0.126353, 0.576641, 0.798627, -0.172282, 0.581832, 0.811138, -0.0593915, 0.575439, 0.817725, 0.0139813, 0.568147, 0.818233, 0.0877694, 0.561767, 0.814253, 0.146323, 0.562752, 0.805892, 0.183978, 0.566778, 0.800898, 0.193198, 0.577322, 0.79815, 0.172208, 0.578712, 0.805602, 0.126883, 0.582048, 0.810968, 0.0595875, 0.575568, 0.817634, -0.0140125, 0.567081, 0.819006, -0.0874562, 0.561779, 0.814269, -0.146185, 0.564236, 0.804774, -0.184326, 0.567929, 0.800144, -0.192943, 0.569856, 0.779157, -0.26111, 0.5797, 0.792034, -0.191391, 0.583258, 0.807038, -0.0921958, 0.574113, 0.818487, 0.021745, 0.559775, 0.817962, 0.132631, 0.547989, 0.806421, 0.222247, 0.545998, 0.790412, 0.277732, 0.554375, 0.779609, 0.29134, 0.569519, 0.779385, 0.261164, 0.578677, 0.792654, 0.191919, 0.580375, 0.809037, 0.0928635, 0.574341, 0.818325, -0.0218301, 0.561913, 0.816377, -0.133348, 0.548771, 0.805875, -0.222295, 0.546612, 0.789964, -0.277801, 0.554938, 0.779307, -0.291075, 0.573163, 0.754292, -0.320199, 0.577933, 0.768033, -0.275895, 0.584014, 0.781068, -0.221045, 0.589204, 0.79311, -0.154319, 0.584357, 0.807098, -0.0843756, 0.5768, 0.816838, -0.00883496, 0.567811, 0.820513, 0.065948, 0.553265, 0.821403, 0.138544, 0.542981, 0.814283, 0.205221, 0.533816, 0.803042, 0.264885, 0.52403, 0.792792, 0.311246, 0.524765, 0.776831, 0.348073, 0.52811, 0.764257, 0.37015, 0.535291, 0.755044, 0.378645, 0.54227, 0.752651, 0.373443, 0.557555, 0.751034, 0.353666, 0.567967, 0.757672, 0.321476, 0.578777, 0.767494, 0.275626, 0.588004, 0.778504, 0.219507, 0.58743, 0.794323, 0.154845, 0.586504, 0.805613, 0.0836686, 0.577622, 0.816257, 0.00877721, 0.566206, 0.821685, -0.0651482, 0.5536, 0.821166, -0.138612, 0.5433, 0.814035, -0.205357, 0.530783, 0.805518, -0.263458, 0.526686, 0.790737, -0.311988, 0.526269, 0.775685, -0.348358, 0.526857, 0.765183, -0.370023, 0.532269, 0.757192, -0.378616, 0.542206, 0.752575, -0.373688, 0.556718, 0.75159, -0.353804, 0.572453, 0.716651, -0.398383, 0.576237, 0.740059, -0.346792, 0.571619, 0.717173, -0.398641, 0.584163, 0.762334, -0.278568, 0.591921, 0.781717, -0.19634, 0.587332, 0.802265, -0.106824, 0.577828, 0.816078, -0.0114557, 0.559303, 0.824888, 0.0820955, 0.539687, 0.82385, 0.173233, 0.521549, 0.813476, 0.257378, 0.50298, 0.799136, 0.329231, 0.493168, 0.77815, 0.388931, 0.494719, 0.752804, 0.43421, 0.496476, 0.735312, 0.461333, 0.505905, 0.722067, 0.47189, 0.519968, 0.716253, 0.465419, 0.541153, 0.715442, 0.441923, 0.55876, 0.725086, 0.40254, 0.571663, 0.717146, 0.398627, 0.572495, 0.716624, 0.39837, 0.578358, 0.738826, 0.345889, 0.591637, 0.757709, 0.275398, 0.593243, 0.780969, 0.195322, 0.590449, 0.800182, 0.105252, 0.579395, 0.814976, 0.0107736, 0.560593, 0.823956, -0.0826537, 0.543553, 0.82085, -0.175369, 0.511248, 0.821786, -0.251584, 0.514014, 0.819585, -0.253121, 0.506138, 0.796532, -0.330699, 0.53037, 0.806191, -0.262228, 0.496507, 0.775589, -0.389797, 0.489339, 0.757006, -0.433, 0.4958, 0.736018, -0.460933, 0.507405, 0.721001, -0.47191, 0.519954, 0.716262, -0.46542, 0.538607, 0.71705, -0.442427, 0.550144, 0.730245, -0.405073, 0.565287, 0.721101, -0.40058, 0.555802, 0.675779, -0.484156, 0.57646, 0.701046, -0.419796, 0.564551, 0.721552, -0.400806, 0.594589, 0.730316, -0.336307, 0.603315, 0.761647, -0.236441, 0.595677, 0.792806, -0.128949, 0.580151, 0.814404, -0.0130909, 0.556964, 0.823959, 0.10432, 0.527868, 0.821584, 0.215301, 0.496886, 0.808693, 0.314834, 0.471849, 0.785135, 0.40115, 0.458302, 0.752921, 0.472302, 0.449758, 0.724212, 0.522719, 0.452979, 0.697826, 0.554842, 0.454769, 0.720002, 0.524197, 0.470043, 0.676059, 0.567454, 0.498082, 0.662365, 0.559631, 0.527889, 0.66236, 0.531614, 0.543106, 0.734371, 0.407105, 0.550309, 0.730142, 0.405033, 0.553532, 0.677094, 0.484918, 0.575892, 0.701295, 0.42016, 0.57594, 0.714451, 0.397308, 0.55777, 0.725682, 0.402837, 0.590225, 0.732768, 0.338653, 0.595177, 0.76617, 0.242381, 0.592429, 0.794763, 0.131831, 0.575937, 0.817316, 0.0170902, 0.5518, 0.827969, -0.0999178, 0.514046, 0.83314, -0.204045, 0.493543, 0.811666, -0.312431, 0.538898, 0.811979, -0.224229, 0.516762, 0.817379, -0.254654, 0.531384, 0.805337, -0.2628, 0.470465, 0.786382, -0.400332, 0.452119, 0.758162, -0.469872, 0.45057, 0.723288, -0.523298, 0.459209, 0.69299, -0.555781, 0.474365, 0.67279, -0.567742, 0.499992, 0.660901, -0.559658, 0.525594, 0.663747, -0.532157, 0.557837, 0.725639, -0.402822, 0.741896, 0.533677, -0.405929, 0.751451, 0.552187, -0.361125, 0.726484, 0.598025, -0.338506, 0.738834, 0.612152, -0.281769, 0.723339, 0.646071, -0.243665, 0.691376, 0.690039, -0.214115, 0.683949, 0.711449, -0.161413, 0.650357, 0.749082, -0.126141, 0.623693, 0.777279, -0.0827305, 0.599547, 0.799667, -0.0328158, 0.568944, 0.822287, 0.0120821, 0.535076, 0.842833, 0.0576715, 0.495997, 0.862899, 0.0969134, 0.465664, 0.872771, 0.146382, 0.419543, 0.889593, 0.180577, 0.395475, 0.888275, 0.233595, 0.348138, 0.899415, 0.264297, 0.317052, 0.897231, 0.307335, 0.315681, 0.875932, 0.364814, 0.272669, 0.878303, 0.392729, 0.260475, 0.86266, 0.433556, 0.441158, 0.731309, 0.520161, 0.286447, 0.824511, 0.487985, 0.456169, 0.71881, 0.524616, 0.28186, 0.807026, 0.518907, 0.46674, 0.709743, 0.527654, 0.335927, 0.75587, 0.561973, 0.456247, 0.718744, 0.524639, 0.37087, 0.720098, 0.586443, 0.360788, 0.717611, 0.595706, 0.439834, 0.663432, 0.605313, 0.514821, 0.615192, 0.597074, 0.582986, 0.575237, 0.573786, 0.624371, 0.559725, 0.544856, 0.684219, 0.532243, 0.49856, 0.69231, 0.549899, 0.467245, 0.760062, 0.517098, 0.393593, 0.726783, 0.572897, 0.378913, 0.726497, 0.598015, 0.338497, 0.73884, 0.612185, 0.281682, 0.709152, 0.657115, 0.255543, 0.706887, 0.67819, 0.20092, 0.674949, 0.718145, 0.169444, 0.658641, 0.743063, 0.118527, 0.623857, 0.777125, 0.0829403, 0.599581, 0.799642, 0.032784, 0.565696, 0.824564, -0.00906394, 0.581372, 0.813291, -0.0237443, 0.582511, 0.812444, -0.0248216, 0.53293, 0.844349, -0.0553171, 0.503883, 0.857485, -0.104028, 0.510233, 0.836223, -0.200981, 0.514938, 0.832412, -0.204767, 0.457598, 0.87808, -0.139929, 0.52998, 0.819788, -0.216954, 0.433993, 0.880116, -0.192472, 0.382156, 0.896786, -0.223006, 0.535892, 0.814637, -0.221779, 0.348132, 0.899419, -0.264292, 0.317305, 0.897232, -0.30707, 0.315655, 0.875948, -0.364797, 0.272654, 0.878312, -0.39272, 0.288926, 0.845728, -0.448627, 0.266744, 0.836532, -0.478604, 0.281993, 0.807103, -0.518714, 0.335577, 0.755914, -0.562123, 0.351402, 0.732404, -0.583182, 0.369137, 0.712073, -0.597235, 0.432319, 0.668675, -0.604958, 0.5032, 0.623436, -0.598429, 0.582681, 0.575472, -0.57386, 0.6218, 0.561898, -0.54556, 0.684206, 0.532254, -0.498566, 0.692028, 0.549894, -0.467669, 0.821464, -0.57026, 0, 0.620739, -0.784017, 0, 0.656964, -0.753922, 0, 0.883231, -0.468938, 0, 0.807255, -0.590203, 0, 0.968075, -0.250661, 0, 0.984328, -0.176349, 0, 0.999365, -0.0356276, 0, 0.993219, 0.116255, 0, 0.970154, 0.242491, 0, 0.973436, 0.22896, 0, 0.894617, 0.446834, 0, 0.778908, 0.627138, 0, 0.815092, 0.579331, 0, 0.67688, 0.736093, 0, 0.557022, 0.830498, 0, 0.433912, 0.900955, 0, 0.395373, 0.918521, 0, 0.219789, 0.975547, 0, 0.00451289, 0.99999, 0, 0.0703576, 0.997522, 0, -0.145367, 0.989378, 0, -0.415384, 0.909646, 0, -0.264583, 0.964363, 0, -0.51429, 0.857616, 0, -0.7459, 0.666058, 0, -0.548936, 0.835864, 0, -0.721595, 0.692316, 0, -0.943978, 0.330009, 0, -0.803382, 0.595464, 0, -0.934941, 0.354804, 0, -0.999255, -0.0385949, 0, -0.965903, 0.258903, 0, -0.999707, -0.0242246, 0, -0.933222, -0.3593, 0, -0.966828, -0.255428, 0, -0.764161, -0.645026, 0, -0.867826, -0.496868, 0, -0.676524, -0.73642, 0, -0.459348, -0.888257, 0, -0.423644, -0.905829, 0, -0.265595, -0.964085, 0, -0.11036, -0.993892, 0, -0.0441385, -0.999025, 0, 0.207419, -0.978252, 0, 0.246297, -0.969194, 0, 0.365164, -0.930943, 0, 0.584122, -0.811666, 0, 0.623003, -0.782219, 0, 0.532815, -0.846232, 0, 0.815796, -0.57834, 0, 0.840502, -0.541809, 0, 0.929353, -0.369194, 0, 0.971675, -0.236323, 0, 0.991783, -0.127929, 0, 0.972602, -0.232477, 0, 0.994607, 0.103716, 0, 0.988857, 0.148867, 0, 0.955422, 0.295243, 0, 0.895914, 0.444228, 0, 0.831479, 0.555556, 0, 0.792549, 0.609809, 0, 0.669022, 0.743243, 0, 0.507921, 0.861404, 0, 0.544989, 0.838443, 0, 0.366385, 0.930463, 0, 0.0998474, 0.995003, 0, 0.229889, 0.973217, 0, 0.0175003, 0.999847, 0, -0.320553, 0.947231, 0, -0.120178, 0.992752, 0, -0.333797, 0.942645, 0, -0.675576, 0.73729, 0, -0.488209, 0.872727, 0, -0.623904, 0.781501, 0, -0.910207, 0.414153, 0, -0.729339, 0.684153, 0, -0.860422, 0.509583, 0, -0.99999, 0.00444309, 0, -0.930533, 0.366207, 0, -0.965908, 0.258887, 0, -0.999707, -0.0242173, 0, -0.92081, -0.390012, 0, -0.987212, -0.159412, 0, -0.884295, -0.466929, 0, -0.728202, -0.685363, 0, -0.720671, -0.693277, 0, -0.498587, -0.86684, 0, -0.447586, -0.894241, 0, -0.265523, -0.964104, 0, -0.155989, -0.987759, 0, -0.153704, -0.988117, 0, 0.216001, -0.976393, 0, 0.194681, -0.980867, 0, 0.478338, -0.878176, 0, 0.584076, -0.811699, 0, -0.316898, 0.94846, 0, 0.575832, 0.817359, -0.0185121, 0.575635, 0.817502, -0.018327, 0.548186, 0.836328, 0.00695489, 0.387965, -0.921674, 0, -0.507212, 0.861821, -0.000761311, -0.388899, 0.92128, -0.000180936, -0.38761, 0.921823, 0.000543273, -0.507466, 0.861672, 0.000553929, -0.414176, 0.910007, -0.0185735, -0.50686, 0.862028, 0.000552107, -0.507876, 0.861429, -0.00136634, -0.40527, 0.914132, -0.0109111, -0.387659, 0.921466, -0.024932, -0.505871, 0.862607, 0.00173426, -0.330154, 0.943711, -0.0202252, -0.269311, 0.962097, -0.0429, -0.326139, 0.945322, -3.94173e-05, -0.251148, 0.967655, -0.0238336, -0.166097, 0.98466, -0.0534469, -0.183203, 0.982798, -0.0233398, -0.264078, 0.964472, -0.00750894, -0.183212, 0.982795, -0.0233898, -0.184527, 0.982354, -0.0305079, -0.0856969, 0.994674, -0.0572689, -0.187796, 0.98102, -0.0482985, -0.184692, 0.982295, -0.0313783, -0.149378, 0.98857, -0.0203621, -0.182516, 0.983005, -0.0197489, -0.0323457, 0.998445, -0.0454042, -0.184931, 0.982207, -0.0327207, -0.265502, 0.964105, -0.00313015, -0.141197, 0.989981, -0.000204259, -0.0122007, 0.999925, 0.000388494, -0.2643, 0.96439, 0.00990265, -0.149244, 0.988617, 0.0190277, -0.032285, 0.998468, 0.0449311, -0.184294, 0.982433, 0.0293409, -0.0855363, 0.994725, 0.0566263, -0.325726, 0.94546, 0.00286077, -0.250729, 0.967802, 0.0222465, -0.16528, 0.984918, 0.0511822, -0.329517, 0.943973, 0.0182746, -0.404914, 0.914305, 0.00954986, -0.266622, 0.963095, 0.0368827, -0.412971, 0.910618, 0.0151482, -0.385104, 0.922662, 0.019753, -0.506605, 0.862177, -0.00168466, -0.507651, 0.861562, 0.000723566, -0.505584, 0.862774, -0.00231716, -0.358285, 0.932728, -0.0406271, -0.500945, 0.865432, 0.00902601, -0.50224, 0.864712, 0.00527007, -0.328925, 0.942469, -0.0596706, -0.208504, 0.975668, -0.0678049, -0.166449, 0.978081, -0.125109, -0.0771782, 0.993645, -0.0819285, -0.115977, 0.991558, -0.0579776, 0.0134313, 0.993358, -0.114279, -0.130465, 0.988444, -0.0771833, 0.0255179, 0.996698, -0.0770896, 0.137777, 0.98531, -0.100903, 0.0936184, 0.994464, -0.0477164, 0.21805, 0.974106, -0.0597576, 0.117496, 0.993073, -0.00060958, 0.246086, 0.969248, -1.61786e-06, 0.0934795, 0.994436, 0.0485703, 0.218339, 0.974104, 0.058739, 0.0248765, 0.996557, 0.0790915, 0.138654, 0.985416, 0.0986414, -0.0767176, 0.993762, 0.080938, 0.0153289, 0.993701, 0.111006, -0.204338, 0.977015, 0.0607229, -0.139666, 0.986156, 0.0893893, -0.353286, 0.934932, 0.033021, -0.320611, 0.945891, 0.0499799, -0.500946, 0.865431, -0.00902491, -0.503035, 0.864255, -0.0043407, -0.500081, 0.865957, 0.00611939, -0.301077, 0.949988, -0.082915, -0.437149, 0.898252, 0.0452206, -0.272615, 0.956046, -0.107972, -0.443779, 0.895199, 0.0409697, -0.0846778, 0.987316, -0.134298, -0.159045, 0.980524, -0.115224, -0.170948, 0.976514, -0.131138, -0.0233143, 0.984217, -0.175421, 0.104728, 0.983182, -0.149619, -0.122107, 0.990313, -0.0661115, 0.193075, 0.962055, -0.192801, 0.248988, 0.960111, -0.12725, 0.356053, 0.920744, -0.159551, 0.339361, 0.937821, -0.0729789, 0.455061, 0.885793, -0.0910529, 0.37039, 0.928876, 0.000458168, 0.488679, 0.872464, -5.50237e-05, 0.339081, 0.937823, 0.0742419, 0.454554, 0.88584, 0.0931033, 0.249695, 0.960133, 0.125688, 0.356294, 0.920764, 0.158893, 0.107973, 0.983523, 0.144999, 0.197889, 0.962226, 0.18698, -0.0730062, 0.989851, 0.121919, -0.00693058, 0.986855, 0.161458, -0.286843, 0.955408, 0.0701205, -0.253067, 0.962815, 0.0945729, -0.501047, 0.865404, -0.00525389, -0.497159, 0.867639, -0.00591757, -0.494147, 0.869358, 0.00585494, -0.247041, 0.959131, -0.137978, -0.438631, 0.897576, 0.0442697, -0.490582, 0.871384, 0.00448829, -0.223267, 0.959577, -0.171356, 0.034849, 0.974175, -0.223087, 0.0884828, 0.956842, -0.276812, 0.277756, 0.929842, -0.241339, 0.354433, 0.886633, -0.297085, 0.455729, 0.867671, -0.198642, 0.559459, 0.798734, -0.221429, 0.562867, 0.818864, -0.112439, 0.661086, 0.738107, -0.134775, 0.598975, 0.800768, -4.74662e-05, 0.660773, 0.738183, -0.135884, 0.690154, 0.723532, -0.01373, 0.699213, 0.714914, 0, 0.562955, 0.818849, 0.11211, 0.660865, 0.73816, 0.135562, 0.690154, 0.723532, 0.0137299, 0.457214, 0.867427, 0.19628, 0.561491, 0.798233, 0.218065, 0.660999, 0.738129, 0.135078, 0.283341, 0.929649, 0.235522, 0.364093, 0.885626, 0.288275, 0.0567266, 0.976468, 0.208067, 0.118346, 0.958254, 0.260275, -0.219731, 0.967635, 0.124102, -0.189283, 0.968933, 0.159185, -0.493928, 0.869482, -0.00600324, -0.490656, 0.871342, -0.00446514, -0.487074, 0.873358, 0.00229492, -0.203888, 0.956469, -0.208799, -0.475924, 0.879485, 0.00164361, -0.163367, 0.960901, -0.223564, 0.136248, 0.93212, -0.335542, 0.198351, 0.915089, -0.351097, 0.446492, 0.828387, -0.338261, 0.460095, 0.800779, -0.38349, 0.647104, 0.717077, -0.258952, 0.626606, 0.689732, -0.362815, 0.745246, 0.645448, -0.167345, 0.659549, 0.738479, -0.140154, 0.762993, 0.600459, -0.239354, 0.695982, 0.717834, 0.0179836, 0.787024, 0.616922, -3.4478e-05, 0.666704, 0.736458, -0.114607, 0.825954, 0.563737, 0, 0.815107, 0.556337, -0.161522, 0.695982, 0.717834, -0.0179836, 0.750976, 0.643579, 0.147786, 0.666767, 0.736437, 0.114374, 0.825954, 0.563737, 0, 0.815406, 0.556541, 0.159296, 0.776893, 0.597165, 0.199576, 0.659459, 0.738501, 0.140466, 0.65177, 0.715598, 0.251229, 0.652747, 0.683208, 0.327334, 0.467319, 0.823911, 0.3206, 0.491948, 0.793339, 0.358608, 0.17396, 0.931629, 0.319068, 0.26944, 0.907603, 0.321961, -0.159956, 0.966833, 0.199116, -0.0753962, 0.975062, 0.208735, -0.487304, 0.873229, -0.0022586, -0.475493, 0.879718, -0.00159078, -0.387208, 0.921887, -0.0139342, -0.388033, 0.921621, -0.00674861, -0.389691, 0.92091, 0.00814649, -0.507371, 0.861726, -0.00171436, -0.389291, 0.921104, 0.00445825, -0.388411, 0.92148, -0.00345619, -0.39001, 0.920743, 0.0111494, -0.386992, 0.921948, -0.0157956, -0.616395, 0.787437, -0.00055085, -0.617263, 0.786756, 0.00121833, -0.595943, 0.802912, 0.0135961, -0.603019, 0.797696, 0.00703754, -0.617801, 0.785985, 0.0234285, -0.665133, 0.746535, 0.0168526, -0.710529, 0.702487, 0.0407546, -0.668219, 0.743962, 0.00165032, -0.724263, 0.689045, 0.0257034, -0.78082, 0.622705, 0.0505909, -0.769867, 0.637647, 0.0266632, -0.715479, 0.69859, 0.00782405, -0.829454, 0.556235, 0.0510838, -0.791828, 0.610431, 0.0195559, -0.858265, 0.51208, 0.0339803, -0.797376, 0.603481, -0.00138674, -0.71407, 0.700074, 0.000930138, -0.868315, 0.49601, -0.00168043, -0.791818, 0.61044, -0.0196787, -0.715353, 0.698709, -0.00875678, -0.858449, 0.511897, -0.0320369, -0.769713, 0.637788, -0.0277261, -0.829809, 0.555879, -0.0491614, -0.668395, 0.743806, -0.000406707, -0.725028, 0.688366, -0.0220572, -0.781856, 0.621702, -0.046779, -0.603581, 0.797292, -0.00388469, -0.665765, 0.74602, -0.0145457, -0.712468, 0.700804, -0.035535, -0.597098, 0.802106, -0.0100232, -0.620697, 0.783869, -0.0168552, -0.637425, 0.769081, 0.0469411, -0.664123, 0.7453, 0.0588893, -0.751847, 0.655851, 0.0677097, -0.786943, 0.608452, 0.102504, -0.832247, 0.548858, 0.0782218, -0.87526, 0.470137, 0.113538, -0.884768, 0.460187, 0.0735745, -0.929644, 0.355942, 0.0952243, -0.915126, 0.400463, 0.0466265, -0.958255, 0.280962, 0.0529866, -0.925397, 0.378999, -7.47878e-07, -0.966938, 0.255012, 5.96221e-08, -0.915622, 0.399855, -0.0418528, -0.95838, 0.280763, -0.0517635, -0.88552, 0.459297, -0.070002, -0.930369, 0.35496, -0.0917473, -0.833686, 0.547268, -0.0739318, -0.877278, 0.467649, -0.108105, -0.754584, 0.653299, -0.0616657, -0.79205, 0.603299, -0.0932028, -0.641893, 0.76579, -0.0392321, -0.671761, 0.739188, -0.0483476, -0.685066, 0.723879, 0.0817597, -0.565987, 0.823345, -0.0419742, -0.703787, 0.702302, 0.107027, -0.572303, 0.818721, -0.0465322, -0.822377, 0.55316, 0.133082, -0.849308, 0.49825, 0.174419, -0.907327, 0.390051, 0.156903, -0.934936, 0.29795, 0.192669, -0.959243, 0.249904, 0.131914, -0.975103, 0.140361, 0.171679, -0.98468, 0.158009, 0.0737441, -0.992719, 0.0365304, 0.114777, -0.99198, 0.126396, -0.000394358, -0.999988, -0.00490022, 0.000342673, -0.985457, 0.156456, -0.0663109, -0.993269, 0.0355025, -0.110256, -0.960949, 0.247065, -0.124639, -0.976703, 0.137251, -0.164968, -0.91061, 0.385485, -0.148963, -0.937533, 0.293625, -0.18659, -0.827519, 0.547334, -0.125051, -0.859625, 0.4851, -0.160386, -0.696517, 0.714207, -0.0690862, -0.719615, 0.688093, -0.0931852, -0.718927, 0.681568, 0.136415, -0.570928, 0.819736, -0.0455344, -0.730618, 0.661312, 0.169894, -0.868703, 0.442552, 0.222493, -0.879461, 0.387662, 0.276165, -0.947484, 0.208941, 0.242112, -0.933819, 0.149183, 0.325158, -0.979902, 0.0216893, 0.198297, -0.966386, -0.0913061, 0.240336, -0.980986, 0.0167318, 0.193358, -0.956817, 0.0969944, 0.274031, -0.989109, -0.0960031, 0.111561, -0.965892, -0.22091, 0.135097, -0.990654, -0.1364, 0, -0.96411, -0.265503, -0.000376009, -0.990652, -0.136414, 0, -0.982779, -0.135329, 0.125821, -0.98908, -0.0957837, -0.112015, -0.990654, -0.1364, 0, -0.965832, -0.220901, -0.135541, -0.982778, -0.135328, -0.12583, -0.990652, -0.136414, 0, -0.980309, 0.0206621, -0.196385, -0.966819, -0.0926986, -0.238051, -0.950481, 0.203071, -0.235264, -0.950566, 0.112555, -0.289405, -0.881643, 0.42408, -0.207031, -0.895163, 0.362198, -0.259801, -0.739656, 0.661739, -0.122521, -0.75593, 0.635418, -0.15752, -0.737481, 0.642885, 0.206934, -0.761099, 0.609508, 0.221876, -0.881564, 0.333221, 0.334377, -0.896429, 0.271153, 0.350559, -0.942219, 0.131605, 0.308063, -0.934014, 0.03245, 0.35576, -0.902589, 0.20492, 0.378604, -0.932277, -0.0444248, 0.359007, -0.936697, -0.198767, 0.288255, -0.962324, 0.0820675, 0.259226, -0.921015, -0.279483, 0.271332, -0.92597, -0.341855, 0.160358, -0.901253, -0.414219, 0.127144, -0.920515, -0.390707, 0.000380629, -0.892721, -0.45061, 0, -0.925965, -0.341556, -0.161024, -0.901257, -0.414571, -0.125965, -0.937385, -0.201628, -0.283998, -0.92143, -0.28334, -0.265868, -0.937022, 0.0236206, -0.348472, -0.936721, -0.0622911, -0.344491, -0.898671, 0.301171, -0.318884, -0.913401, 0.233325, -0.333554, -0.7677, 0.60966, -0.197361, -0.816182, 0.53938, -0.207162, -0.616675, 0.787207, 0.00407764, 0.0680952, 0.287623, 0.95532, 0.194223, 0.331536, 0.923234, 0.194132, 0.0882405, 0.976999, 0.0544866, 0.0419608, 0.997633, 0.302778, 0.423858, 0.853622, 0.34824, 0.204496, 0.914828, 0.365791, 0.549308, 0.751304, 0.444912, 0.369879, 0.815624, 0.367268, 0.684155, 0.630116, 0.483464, 0.572264, 0.662402, 0.324312, 0.816869, 0.477018, 0.435539, 0.763206, 0.477308, 0.233995, 0.923146, 0.305039, 0.309857, 0.901373, 0.302515, 0.107175, 0.985869, 0.12875, 0.140708, 0.982146, 0.124862, -0.0393848, 0.998699, -0.0324033, -0.0484761, 0.998724, -0.0141639, -0.232659, 0.956922, -0.173693, -0.178198, 0.962371, -0.205151, -0.386771, 0.850586, -0.356246, -0.288514, 0.877065, -0.384079, -0.492315, 0.698186, -0.519771, -0.358699, 0.756497, -0.546852, -0.5072, 0.497031, -0.704065, -0.375474, 0.617494, -0.691173, -0.348126, 0.486354, -0.801416, -0.41967, 0.29095, -0.859782, -0.257034, 0.373348, -0.891372, -0.284963, 0.141556, -0.948029, -0.125865, 0.302552, -0.944786, -0.100737, 0.0544412, -0.993422, 0.0406989, 0.286814, -0.957121, 0.054408, 0.0419569, -0.997637, 0.149337, 0.0773748, -0.985754, 0.194231, 0.331537, -0.923232, 0.316021, 0.189899, -0.929553, 0.302805, 0.423866, -0.853608, 0.425145, 0.35603, -0.832163, 0.365815, 0.549318, -0.751284, 0.47629, 0.565011, -0.673729, 0.367288, 0.684129, -0.630133, 0.318436, 0.813056, -0.487379, 0.435533, 0.763197, -0.477328, 0.231354, 0.921601, -0.311654, 0.309855, 0.90137, -0.302526, 0.106708, 0.985547, -0.13157, 0.140708, 0.982147, -0.124853, -0.0394823, 0.998705, 0.0320769, -0.0488765, 0.998704, 0.0141697, -0.178203, 0.962373, 0.205138, -0.232459, 0.956521, 0.176152, -0.288503, 0.877058, 0.384102, -0.385143, 0.847891, 0.364343, -0.358688, 0.75649, 0.546869, -0.486558, 0.691369, 0.534108, -0.375439, 0.617546, 0.691145, -0.495557, 0.487273, 0.719019, -0.358921, 0.490325, 0.794202, -0.419672, 0.290952, 0.85978, -0.274869, 0.37749, 0.884278, -0.284964, 0.141557, 0.948028, -0.150362, 0.304883, 0.940446, -0.100767, 0.0544455, 0.993419, 0.0279934, 0.715408, 0.698146, 0.0919822, 0.7329, 0.674089, 0.130069, 0.768895, 0.626006, 0.157646, 0.818845, 0.551942, 0.154969, 0.873368, 0.46175, 0.132928, 0.925631, 0.354312, 0.101954, 0.968874, 0.225585, 0.051605, 0.994347, 0.0927907, -0.0179676, 0.999376, -0.0304012, -0.0745496, 0.983766, -0.163238, -0.117214, 0.948781, -0.293385, -0.144636, 0.900041, -0.411105, -0.15529, 0.845344, -0.511154, -0.148293, 0.79287, -0.591072, -0.109986, 0.748637, -0.653793, -0.0551553, 0.721229, -0.690497, 0.0214677, 0.715367, -0.698419, 0.0919996, 0.732901, -0.674086, 0.130067, 0.768895, -0.626006, 0.155602, 0.818576, -0.552921, 0.151174, 0.872777, -0.464119, 0.124951, 0.924396, -0.360387, 0.0920994, 0.96779, -0.23431, 0.0463095, 0.994106, -0.0980213, -0.021659, 0.999406, 0.0267935, -0.0805938, 0.984208, 0.157604, -0.122533, 0.949465, 0.288965, -0.150666, 0.900962, 0.406901, -0.163042, 0.846513, 0.506788, -0.161979, 0.794368, 0.585441, -0.127162, 0.749863, 0.649258, -0.0761188, 0.721738, 0.687969, 0.0193444, 0.923218, 0.383789, 0.00368817, 0.918623, 0.395118, 0.0386627, 0.933543, 0.356374, 0.0462297, 0.947617, 0.316046, 0.0470804, 0.963453, 0.26371, 0.0431837, 0.978572, 0.201327, 0.0317806, 0.990882, 0.130931, 0.0227412, 0.998311, 0.0534668, -0.0064862, 0.999811, -0.0183287, -0.0289461, 0.995333, -0.0920536, -0.0396453, 0.985313, -0.166091, -0.0496153, 0.971417, -0.232138, -0.0515593, 0.955713, -0.289748, -0.04622, 0.940312, -0.33716, -0.0346081, 0.927862, -0.371315, -0.0160073, 0.920224, -0.391066, 0.00332191, 0.918621, -0.395126, 0.0250662, 0.923313, -0.38323, 0.038654, 0.933543, -0.356376, 0.0470795, 0.947645, -0.315837, 0.0488675, 0.963515, -0.263157, 0.0423327, 0.978654, -0.201106, 0.0346636, 0.990938, -0.129769, 0.0204896, 0.998308, -0.0544256, -0.00781961, 0.999812, 0.0177549, -0.0265205, 0.995307, 0.0930645, -0.0386632, 0.985306, 0.166365, -0.0472818, 0.971344, 0.232926, -0.0477568, 0.955493, 0.291122, -0.0408405, 0.940154, 0.338293, -0.0280773, 0.927844, 0.371909, -0.0111734, 0.920174, 0.39135, 0.00742516, 0.956569, 0.29141, 0.0160491, 0.959171, 0.282372, 0.0244755, 0.964616, 0.26252, 0.0275285, 0.972111, 0.2329, 0.0282884, 0.980532, 0.19431, 0.0258671, 0.988625, 0.148158, 0.0170471, 0.995113, 0.0972607, 0.0151213, 0.99908, 0.0401429, -0.00293335, 0.999897, -0.014055, -0.0187678, 0.99749, -0.0682791, -0.0253324, 0.992175, -0.122256, -0.031417, 0.984766, -0.171023, -0.0326105, 0.976337, -0.213783, -0.0293185, 0.968204, -0.248439, -0.0224702, 0.961575, -0.273621, -0.0106315, 0.957539, -0.288107, -0.000863678, 0.956681, -0.291137, 0.0134574, 0.959155, -0.282559, 0.0244801, 0.964616, -0.26252, 0.0293799, 0.972136, -0.23257, 0.0304756, 0.980563, -0.193823, 0.0265007, 0.988633, -0.147994, 0.0223875, 0.995155, -0.0957337, 0.0133257, 0.999083, -0.0406847, -0.00413011, 0.999898, 0.0136904, -0.015027, 0.997477, 0.069383, -0.0246574, 0.992169, 0.122441, -0.0292541, 0.984741, 0.171548, -0.0292422, 0.976295, 0.214462, -0.0244983, 0.968148, 0.249179, -0.0159788, 0.96152, 0.274271, -0.00558016, 0.957516, 0.288326, 0.194225, 0.331536, -0.923234, 0.0680965, 0.287623, -0.95532, 0.194128, 0.0882395, -0.977, 0.0544866, 0.0419608, -0.997633, 0.302785, 0.42386, -0.853618, 0.348238, 0.204494, -0.914829, 0.365792, 0.549308, -0.751303, 0.444905, 0.369874, -0.81563, 0.367275, 0.684159, -0.630108, 0.483463, 0.572263, -0.662404, 0.318457, 0.813069, -0.487343, 0.435539, 0.763206, -0.477308, 0.231362, 0.921605, -0.311633, 0.309857, 0.901373, -0.302515, 0.106708, 0.985547, -0.131571, 0.140708, 0.982146, -0.124862, -0.0394836, 0.998705, 0.0320725, -0.0484761, 0.998724, 0.0141639, -0.232659, 0.956922, 0.173693, -0.178199, 0.962372, 0.205148, -0.386771, 0.850587, 0.356245, -0.288516, 0.877066, 0.384075, -0.492317, 0.698188, 0.519767, -0.358703, 0.7565, 0.546846, -0.507202, 0.497033, 0.704063, -0.375481, 0.617498, 0.691166, -0.34813, 0.486356, 0.801413, -0.419668, 0.29095, 0.859783, -0.257031, 0.373348, 0.891374, -0.284955, 0.141554, 0.948031, -0.125859, 0.302552, 0.944787, -0.100745, 0.0544424, 0.993421, 0.0406945, 0.286814, 0.957122, 0.0543785, 0.0419556, 0.997639, 0.194153, 0.0882456, 0.976994, 0.194239, 0.331538, 0.92323, 0.348261, 0.204505, 0.914818, 0.302811, 0.423868, 0.853605, 0.44496, 0.369913, 0.815583, 0.365818, 0.54932, 0.751282, 0.483467, 0.572266, 0.662398, 0.367289, 0.68413, 0.630131, 0.324298, 0.81686, 0.477044, 0.435534, 0.763199, 0.477323, 0.233987, 0.923141, 0.305058, 0.309855, 0.90137, 0.302527, 0.107563, 0.985812, 0.128857, 0.140708, 0.982147, 0.124853, -0.0393861, 0.998699, -0.032399, -0.0484764, 0.998724, -0.0141563, -0.178202, 0.962373, -0.20514, -0.232161, 0.956596, -0.176141, -0.288503, 0.877058, -0.384102, -0.385143, 0.847891, -0.364343, -0.358687, 0.75649, -0.546869, -0.486378, 0.691514, -0.534083, -0.375434, 0.617544, -0.691151, -0.495559, 0.487274, -0.719017, -0.348135, 0.486357, -0.80141, -0.419672, 0.290952, -0.85978, -0.257049, 0.373352, -0.891366, -0.284966, 0.141558, -0.948027, -0.12588, 0.302554, -0.944783, -0.10077, 0.054446, -0.993419, 0.0919881, 0.732901, -0.674088, 0.0279934, 0.715408, -0.698146, 0.130075, 0.768895, -0.626004, 0.157647, 0.818845, -0.551942, 0.158421, 0.873886, -0.459593, 0.130297, 0.925234, -0.356321, 0.0989779, 0.968564, -0.228226, 0.0507088, 0.994313, -0.0936536, -0.0180938, 0.999378, 0.0302778, -0.0778345, 0.984015, 0.160178, -0.119835, 0.949124, 0.291211, -0.144641, 0.900042, 0.411101, -0.155295, 0.845345, 0.511151, -0.154741, 0.793597, 0.588437, -0.109994, 0.748638, 0.653791, -0.0551571, 0.721229, 0.690497, 0.0214788, 0.715367, 0.698418, 0.0919982, 0.732901, 0.674086, 0.130063, 0.768894, 0.626007, 0.155604, 0.818576, 0.55292, 0.151172, 0.872777, 0.464121, 0.129888, 0.925172, 0.356633, 0.0950902, 0.968136, 0.231667, 0.0472092, 0.994149, 0.0971562, -0.0193705, 0.999391, -0.0290302, -0.074531, 0.983765, -0.163255, -0.1172, 0.948779, -0.293397, -0.147551, 0.900492, -0.409075, -0.158395, 0.84585, -0.509361, -0.154637, 0.793587, -0.588479, -0.117591, 0.749209, -0.651812, -0.0636082, 0.721475, -0.689512, 0.0250788, 0.923313, -0.383229, 0.00553114, 0.91863, -0.395081, 0.0386523, 0.933543, -0.356376, 0.0462251, 0.947617, -0.316047, 0.0473339, 0.963461, -0.263631, 0.0418325, 0.978576, -0.20159, 0.0317772, 0.990882, -0.130932, 0.0211111, 0.998309, -0.0541612, -0.00656239, 0.999811, 0.0182959, -0.0272326, 0.995315, 0.0927678, -0.0386847, 0.985289, 0.16646, -0.0492835, 0.971407, 0.23225, -0.0506589, 0.955685, 0.29, -0.0445663, 0.940267, 0.337509, -0.0320989, 0.927814, 0.37166, -0.0160096, 0.920224, 0.391065, 0.00332172, 0.918621, 0.395126, 0.0250681, 0.923313, 0.38323, 0.039829, 0.933572, 0.35617, 0.0494071, 0.947717, 0.315265, 0.0496457, 0.96354, 0.262917, 0.04233, 0.978654, 0.201107, 0.034665, 0.990938, 0.129769, 0.0204902, 0.998308, 0.0544253, -0.00757455, 0.999812, -0.0178605, -0.0309891, 0.99535, -0.0912016, -0.0412147, 0.985298, -0.165799, -0.0488657, 0.971394, -0.232391, -0.0496684, 0.955558, -0.290589, -0.0440608, 0.940143, -0.33792, -0.0281261, 0.927726, -0.372201, -0.0111726, 0.920174, -0.39135, 0.0134527, 0.959155, -0.28256, 0.00130566, 0.956689, -0.291108, 0.0244756, 0.964616, -0.26252, 0.0275287, 0.972111, -0.2329, 0.028277, 0.980532, -0.194313, 0.0257668, 0.988685, -0.147778, 0.0170472, 0.995113, -0.0972607, 0.0125902, 0.999084, -0.0409059, -0.0030725, 0.999897, 0.0140127, -0.0187658, 0.99749, 0.0682796, -0.0253238, 0.992175, 0.122259, -0.0314092, 0.984766, 0.171025, -0.0323834, 0.976334, 0.213828, -0.0285888, 0.968197, 0.248551, -0.0210064, 0.961566, 0.273769, -0.0106262, 0.957539, 0.288108, -0.000863729, 0.956681, 0.291138, 0.0134575, 0.959155, 0.282559, 0.0223308, 0.964594, 0.262793, 0.0248521, 0.972069, 0.233375, 0.0289159, 0.980541, 0.194171, 0.0264981, 0.988633, 0.147995, 0.0223875, 0.995155, 0.0957337, 0.0133257, 0.999083, 0.0406847, -0.00412913, 0.999898, -0.0136907, -0.0150284, 0.997477, -0.0693825, -0.0246508, 0.992169, -0.122443, -0.0292566, 0.984742, -0.171547, -0.0310893, 0.976319, -0.21409, -0.0270167, 0.96818, -0.248793, -0.0159787, 0.96152, -0.274271, -0.0055801, 0.957516, -0.288326
-};
-
-uint32_t mIndices[] = {
-2, 1, 0, 3, 0, 1, 0, 3, 129, 2, 0, 132, 131, 132, 0, 131, 0, 258, 129, 258, 0, 129, 128, 126, 128, 129, 3, 258, 129, 256, 126, 256, 129, 259, 258, 256, 133, 131, 258, 259, 133, 258, 132, 131, 130, 133, 130, 131, 130, 133, 261, 260, 261, 133, 133, 388, 260, 388, 133, 259, 257, 259, 256, 259, 387, 388, 387, 259, 257, 389, 388, 387, 260, 388, 263, 389, 263, 388, 262, 261, 260, 263, 262, 260, 262, 265, 261, 265, 264, 261, 265, 267, 264, 267, 266, 264, 134, 130, 264, 261, 264, 130, 264, 266, 134, 266, 267, 268, 269, 268, 267, 136, 134, 266, 266, 268, 136, 135, 132, 134, 130, 134, 132, 134, 136, 135, 137, 135, 136, 137, 136, 138, 139, 138, 136, 139, 136, 268, 5, 2, 135, 132, 135, 2, 135, 137, 5, 6, 5, 137, 137, 138, 6, 138, 139, 140, 8, 6, 138, 138, 140, 8, 141, 140, 139, 141, 139, 271, 268, 271, 139, 141, 142, 140, 142, 141, 272, 271, 272, 141, 271, 268, 270, 273, 272, 271, 270, 273, 271, 269, 270, 268, 273, 275, 272, 275, 274, 272, 272, 274, 142, 275, 277, 274, 277, 276, 274, 144, 142, 274, 274, 276, 144, 277, 278, 276, 279, 276, 278, 147, 144, 276, 279, 149, 276, 147, 276, 149, 279, 278, 280, 281, 280, 278, 279, 280, 149, 149, 148, 147, 148, 149, 150, 150, 149, 280, 147, 146, 144, 146, 147, 148, 151, 148, 150, 18, 16, 148, 146, 148, 16, 148, 151, 18, 151, 150, 152, 152, 150, 282, 280, 282, 150, 153, 151, 152, 20, 18, 151, 151, 153, 20, 18, 17, 16, 19, 17, 18, 20, 19, 18, 21, 19, 20, 23, 22, 20, 21, 20, 22, 23, 20, 153, 399, 17, 19, 19, 400, 399, 400, 19, 21, 21, 401, 400, 401, 21, 22, 24, 22, 23, 25, 22, 24, 22, 25, 401, 23, 153, 24, 26, 25, 24, 155, 24, 153, 24, 155, 26, 27, 25, 26, 402, 401, 25, 25, 27, 402, 28, 27, 26, 157, 26, 155, 26, 157, 28, 155, 153, 154, 155, 154, 156, 156, 157, 155, 153, 152, 154, 284, 154, 282, 152, 282, 154, 154, 284, 156, 157, 156, 158, 287, 156, 284, 287, 158, 156, 158, 159, 157, 159, 28, 157, 161, 160, 158, 159, 158, 160, 158, 287, 289, 289, 161, 158, 287, 284, 286, 289, 287, 288, 286, 288, 287, 289, 288, 290, 161, 289, 290, 160, 161, 162, 290, 162, 161, 291, 290, 288, 293, 292, 290, 291, 293, 290, 162, 290, 292, 162, 163, 160, 163, 32, 160, 32, 31, 30, 33, 31, 32, 30, 160, 32, 31, 29, 30, 29, 31, 404, 405, 404, 31, 31, 33, 405, 30, 29, 28, 160, 30, 159, 28, 159, 30, 29, 27, 28, 27, 29, 403, 404, 403, 29, 403, 402, 27, 403, 468, 402, 404, 468, 403, 402, 467, 401, 467, 402, 468, 469, 468, 404, 469, 404, 470, 405, 470, 404, 470, 405, 471, 406, 471, 405, 406, 405, 33, 466, 401, 467, 401, 466, 400, 465, 400, 466, 400, 465, 399, 464, 399, 465, 17, 399, 398, 399, 464, 398, 463, 398, 464, 15, 398, 397, 17, 398, 15, 398, 463, 397, 17, 15, 16, 15, 12, 14, 16, 15, 14, 15, 397, 12, 12, 397, 396, 397, 462, 396, 462, 397, 463, 13, 12, 10, 11, 10, 12, 14, 12, 13, 12, 396, 11, 14, 13, 145, 16, 14, 146, 145, 146, 14, 13, 10, 143, 143, 145, 13, 145, 143, 144, 145, 144, 146, 143, 140, 142, 142, 144, 143, 140, 143, 10, 10, 8, 140, 8, 7, 6, 9, 7, 8, 10, 9, 8, 7, 4, 6, 393, 4, 7, 393, 7, 394, 9, 394, 7, 6, 4, 5, 5, 4, 2, 1, 2, 4, 392, 1, 4, 4, 393, 392, 393, 458, 392, 458, 393, 459, 394, 459, 393, 394, 9, 395, 394, 395, 459, 460, 459, 395, 11, 395, 9, 395, 11, 396, 396, 461, 395, 460, 395, 461, 11, 9, 10, 461, 396, 462, 457, 392, 458, 455, 391, 457, 392, 457, 391, 456, 390, 455, 391, 455, 390, 3, 391, 390, 391, 3, 1, 1, 392, 391, 390, 454, 3, 390, 456, 454, 519, 454, 456, 454, 453, 128, 128, 3, 454, 454, 519, 518, 518, 453, 454, 453, 452, 127, 127, 128, 453, 453, 518, 452, 127, 126, 128, 127, 125, 126, 125, 127, 452, 452, 123, 125, 451, 123, 452, 452, 517, 451, 517, 452, 518, 125, 123, 124, 126, 125, 124, 256, 126, 254, 124, 254, 126, 124, 123, 122, 124, 122, 254, 255, 254, 253, 257, 256, 254, 255, 257, 254, 253, 254, 122, 122, 120, 121, 123, 120, 122, 251, 122, 121, 251, 253, 122, 252, 253, 251, 252, 255, 253, 255, 252, 384, 384, 257, 255, 257, 384, 387, 383, 382, 384, 385, 384, 382, 387, 384, 386, 385, 386, 384, 383, 384, 252, 386, 389, 387, 251, 250, 252, 380, 252, 250, 380, 383, 252, 383, 380, 382, 381, 382, 380, 381, 380, 378, 378, 380, 248, 250, 248, 380, 249, 248, 250, 250, 251, 249, 246, 247, 248, 248, 249, 246, 248, 247, 378, 379, 378, 377, 379, 381, 378, 377, 378, 247, 247, 246, 244, 374, 247, 244, 377, 247, 374, 377, 374, 376, 376, 379, 377, 375, 374, 372, 375, 376, 374, 372, 374, 242, 244, 242, 374, 243, 242, 244, 244, 245, 243, 245, 244, 246, 241, 240, 242, 243, 241, 242, 242, 240, 372, 112, 111, 243, 241, 243, 111, 243, 245, 112, 114, 112, 245, 245, 246, 114, 112, 110, 111, 113, 110, 112, 114, 113, 112, 111, 110, 108, 111, 108, 241, 109, 108, 110, 445, 109, 110, 110, 446, 445, 446, 110, 113, 115, 113, 114, 113, 447, 446, 447, 113, 115, 446, 511, 445, 447, 512, 446, 511, 446, 512, 109, 445, 444, 445, 510, 444, 510, 445, 511, 107, 444, 443, 444, 107, 109, 443, 444, 508, 509, 508, 444, 509, 444, 510, 107, 105, 106, 108, 107, 106, 109, 107, 108, 443, 105, 107, 105, 443, 442, 443, 508, 442, 507, 442, 508, 103, 442, 441, 442, 103, 105, 441, 442, 506, 507, 506, 442, 103, 101, 102, 104, 103, 102, 105, 103, 104, 441, 101, 103, 101, 441, 440, 441, 506, 440, 505, 440, 506, 99, 440, 439, 440, 99, 101, 440, 505, 439, 101, 99, 100, 102, 101, 100, 99, 96, 98, 100, 99, 98, 96, 99, 438, 439, 438, 99, 439, 504, 438, 504, 439, 505, 438, 437, 96, 438, 503, 437, 503, 438, 504, 437, 436, 95, 95, 96, 437, 437, 502, 436, 502, 437, 503, 95, 93, 94, 95, 94, 96, 93, 95, 436, 93, 91, 92, 94, 93, 92, 91, 93, 435, 436, 435, 93, 97, 96, 94, 225, 94, 222, 92, 222, 94, 94, 225, 97, 92, 91, 90, 92, 221, 222, 221, 92, 90, 221, 220, 222, 223, 222, 220, 225, 222, 224, 223, 224, 222, 221, 218, 220, 90, 218, 221, 90, 89, 88, 91, 89, 90, 218, 90, 88, 219, 218, 216, 219, 220, 218, 88, 87, 218, 216, 218, 87, 88, 86, 87, 89, 86, 88, 89, 434, 86, 89, 91, 434, 435, 434, 91, 433, 86, 434, 434, 499, 433, 499, 434, 500, 435, 500, 434, 87, 86, 84, 85, 84, 86, 86, 433, 85, 87, 84, 216, 84, 83, 82, 85, 83, 84, 84, 82, 214, 214, 216, 84, 432, 83, 85, 432, 85, 433, 83, 81, 82, 431, 81, 83, 431, 83, 432, 82, 81, 80, 82, 80, 212, 212, 214, 82, 81, 79, 80, 430, 429, 81, 79, 81, 429, 430, 81, 431, 431, 496, 430, 496, 431, 432, 430, 495, 429, 495, 430, 496, 429, 428, 79, 493, 429, 494, 493, 428, 429, 494, 429, 495, 428, 427, 76, 76, 79, 428, 492, 428, 493, 492, 427, 428, 427, 426, 74, 74, 76, 427, 427, 491, 426, 492, 491, 427, 75, 74, 73, 72, 73, 74, 74, 75, 76, 72, 74, 426, 77, 76, 75, 202, 75, 73, 204, 75, 202, 204, 77, 75, 73, 72, 70, 73, 70, 202, 71, 70, 72, 426, 71, 72, 70, 69, 68, 71, 69, 70, 70, 68, 200, 200, 202, 70, 425, 69, 71, 71, 426, 425, 69, 67, 68, 424, 67, 69, 69, 425, 424, 68, 67, 66, 68, 66, 198, 198, 200, 68, 67, 65, 66, 65, 67, 422, 423, 422, 67, 67, 424, 423, 424, 488, 423, 489, 488, 424, 425, 489, 424, 422, 423, 487, 488, 487, 423, 422, 421, 65, 421, 422, 486, 487, 486, 422, 421, 420, 62, 62, 65, 421, 421, 486, 420, 485, 420, 486, 420, 419, 60, 60, 62, 420, 419, 420, 484, 485, 484, 420, 419, 418, 58, 58, 60, 419, 418, 419, 483, 484, 483, 419, 61, 60, 59, 58, 59, 60, 60, 61, 62, 59, 58, 56, 57, 56, 58, 57, 58, 418, 189, 59, 186, 56, 186, 59, 59, 189, 61, 63, 62, 61, 190, 61, 189, 61, 190, 63, 189, 186, 188, 189, 188, 190, 191, 190, 188, 190, 191, 192, 192, 63, 190, 64, 62, 63, 63, 192, 64, 65, 62, 64, 66, 65, 64, 194, 64, 192, 64, 194, 66, 193, 192, 191, 192, 193, 194, 195, 194, 193, 194, 195, 196, 196, 66, 194, 196, 198, 66, 197, 196, 195, 196, 197, 198, 195, 322, 324, 322, 195, 193, 324, 197, 195, 193, 320, 322, 320, 193, 191, 323, 322, 320, 322, 323, 324, 325, 324, 323, 327, 326, 324, 325, 327, 324, 197, 324, 326, 321, 323, 320, 321, 320, 318, 320, 191, 318, 188, 318, 191, 319, 318, 316, 319, 321, 318, 318, 188, 316, 187, 188, 186, 187, 316, 188, 315, 314, 316, 317, 316, 314, 317, 319, 316, 316, 187, 315, 187, 186, 185, 185, 315, 187, 184, 185, 186, 56, 54, 186, 184, 186, 54, 185, 184, 183, 185, 183, 315, 315, 313, 314, 313, 315, 183, 312, 314, 313, 313, 310, 312, 183, 310, 313, 183, 182, 181, 182, 183, 184, 181, 310, 183, 311, 310, 308, 311, 312, 310, 181, 308, 310, 181, 180, 178, 180, 181, 182, 308, 181, 178, 52, 50, 182, 180, 182, 50, 182, 184, 52, 179, 178, 180, 50, 49, 180, 179, 180, 49, 50, 48, 49, 51, 48, 50, 52, 51, 50, 49, 48, 46, 49, 176, 179, 176, 49, 46, 179, 176, 178, 174, 175, 176, 177, 176, 175, 177, 178, 176, 46, 174, 176, 175, 174, 173, 175, 173, 304, 304, 177, 175, 177, 304, 306, 306, 178, 177, 178, 306, 308, 304, 305, 306, 307, 306, 305, 309, 308, 306, 307, 309, 306, 305, 304, 303, 303, 304, 173, 302, 305, 303, 303, 301, 302, 173, 171, 303, 301, 303, 171, 300, 302, 301, 301, 298, 300, 171, 169, 301, 298, 301, 169, 171, 170, 169, 170, 171, 172, 173, 172, 171, 169, 168, 165, 166, 169, 165, 168, 169, 170, 169, 166, 298, 39, 36, 168, 165, 168, 36, 168, 170, 39, 166, 165, 164, 167, 164, 165, 36, 34, 165, 167, 165, 34, 166, 164, 295, 295, 298, 166, 294, 295, 164, 296, 295, 294, 299, 298, 295, 296, 299, 295, 299, 300, 298, 297, 296, 294, 36, 35, 34, 37, 35, 36, 35, 408, 407, 408, 35, 37, 37, 36, 38, 37, 409, 408, 409, 37, 38, 39, 38, 36, 40, 38, 39, 41, 38, 40, 38, 410, 409, 410, 38, 41, 409, 474, 408, 474, 409, 410, 411, 410, 43, 41, 43, 410, 474, 410, 475, 475, 410, 476, 411, 476, 410, 42, 41, 40, 43, 41, 42, 44, 43, 42, 45, 43, 44, 411, 43, 412, 45, 412, 43, 476, 411, 477, 412, 477, 411, 45, 47, 412, 413, 412, 47, 412, 413, 477, 46, 45, 44, 47, 45, 46, 44, 42, 174, 174, 46, 44, 47, 46, 48, 47, 48, 413, 414, 413, 48, 413, 478, 477, 478, 413, 479, 414, 479, 413, 414, 48, 415, 51, 415, 48, 414, 415, 479, 480, 479, 415, 415, 51, 416, 415, 416, 480, 53, 51, 52, 53, 416, 51, 416, 53, 417, 481, 480, 416, 417, 482, 416, 481, 416, 482, 54, 53, 52, 55, 53, 54, 55, 417, 53, 54, 52, 184, 56, 55, 54, 57, 55, 56, 417, 55, 418, 57, 418, 55, 417, 418, 482, 483, 482, 418, 172, 173, 174, 172, 174, 42, 42, 170, 172, 170, 42, 40, 40, 39, 170, 472, 408, 474, 473, 408, 472, 473, 407, 408, 309, 311, 308, 329, 326, 328, 327, 328, 326, 326, 329, 197, 329, 328, 330, 199, 197, 329, 329, 330, 199, 331, 330, 328, 333, 332, 330, 331, 333, 330, 201, 199, 330, 330, 332, 201, 199, 198, 197, 201, 200, 199, 198, 199, 200, 203, 202, 201, 200, 201, 202, 203, 201, 332, 335, 334, 332, 333, 335, 332, 332, 334, 203, 205, 204, 203, 202, 203, 204, 205, 203, 334, 337, 336, 334, 335, 337, 334, 334, 207, 205, 336, 207, 334, 207, 206, 205, 204, 205, 206, 206, 77, 204, 206, 207, 208, 208, 209, 206, 206, 78, 77, 209, 78, 206, 336, 338, 207, 208, 207, 338, 336, 337, 338, 339, 338, 337, 341, 340, 338, 339, 341, 338, 338, 340, 208, 208, 211, 209, 211, 208, 340, 343, 342, 340, 341, 343, 340, 340, 342, 211, 211, 210, 209, 210, 211, 212, 213, 212, 211, 213, 211, 342, 345, 344, 342, 343, 345, 342, 215, 342, 344, 342, 215, 213, 212, 213, 214, 215, 214, 213, 210, 212, 80, 209, 210, 80, 80, 79, 78, 209, 80, 78, 79, 76, 78, 78, 76, 77, 214, 215, 216, 217, 216, 215, 217, 219, 216, 217, 215, 346, 219, 217, 348, 346, 348, 217, 220, 219, 350, 348, 350, 219, 346, 347, 348, 349, 348, 347, 351, 350, 348, 349, 351, 348, 347, 346, 344, 344, 346, 215, 345, 347, 344, 351, 352, 350, 353, 350, 352, 352, 354, 353, 355, 353, 354, 223, 350, 353, 224, 353, 355, 353, 224, 223, 354, 357, 355, 357, 356, 355, 226, 355, 356, 355, 226, 224, 224, 226, 225, 227, 225, 226, 226, 228, 227, 356, 228, 226, 359, 358, 356, 357, 359, 356, 228, 356, 358, 229, 227, 228, 228, 230, 229, 230, 228, 360, 358, 360, 228, 361, 360, 358, 359, 361, 358, 360, 361, 362, 360, 362, 230, 231, 229, 230, 230, 232, 231, 232, 230, 362, 229, 98, 227, 229, 231, 98, 233, 231, 232, 100, 98, 231, 231, 233, 100, 235, 234, 232, 233, 232, 234, 235, 232, 365, 362, 365, 232, 102, 100, 233, 233, 234, 102, 235, 236, 234, 237, 234, 236, 104, 102, 234, 234, 237, 104, 236, 235, 366, 365, 366, 235, 365, 362, 364, 367, 366, 365, 364, 367, 365, 369, 366, 368, 367, 368, 366, 366, 369, 236, 371, 370, 369, 368, 371, 369, 238, 236, 369, 369, 370, 238, 370, 371, 372, 373, 372, 371, 240, 238, 370, 370, 372, 240, 237, 236, 238, 239, 237, 238, 239, 238, 240, 241, 239, 240, 108, 106, 239, 237, 239, 106, 239, 241, 108, 106, 104, 237, 106, 105, 104, 373, 375, 372, 363, 364, 362, 363, 362, 361, 98, 96, 97, 97, 227, 98, 227, 97, 225, 350, 223, 220, 490, 489, 425, 426, 490, 425, 491, 490, 426, 496, 432, 497, 497, 432, 433, 433, 498, 497, 498, 433, 499, 501, 500, 436, 435, 436, 500, 501, 436, 502, 448, 512, 447, 513, 512, 448, 115, 448, 447, 116, 115, 114, 117, 115, 116, 448, 115, 117, 118, 117, 116, 116, 114, 246, 246, 118, 116, 119, 117, 118, 117, 119, 448, 121, 120, 118, 119, 118, 120, 249, 118, 246, 249, 121, 118, 449, 448, 119, 119, 120, 449, 450, 449, 120, 120, 123, 450, 449, 514, 448, 514, 449, 515, 450, 515, 449, 513, 448, 514, 515, 451, 516, 515, 450, 451, 451, 450, 123, 516, 451, 517, 251, 121, 249, 285, 286, 284, 285, 284, 282, 283, 285, 282, 283, 282, 280, 281, 283, 280, 522, 521, 520, 523, 522, 520, 525, 524, 520, 523, 520, 524, 541, 520, 540, 521, 540, 520, 520, 541, 525, 521, 522, 604, 603, 604, 522, 604, 603, 602, 612, 611, 604, 602, 612, 604, 604, 611, 521, 605, 602, 603, 540, 521, 611, 540, 552, 541, 540, 611, 552, 611, 612, 616, 616, 617, 611, 617, 552, 611, 553, 541, 552, 552, 561, 553, 552, 617, 561, 617, 616, 620, 620, 621, 617, 621, 561, 617, 562, 553, 561, 572, 562, 561, 621, 572, 561, 624, 621, 620, 624, 625, 621, 625, 572, 621, 572, 573, 562, 572, 577, 573, 625, 577, 572, 553, 562, 554, 563, 554, 562, 573, 563, 562, 554, 542, 553, 542, 554, 544, 555, 544, 554, 564, 555, 554, 563, 564, 554, 573, 564, 563, 555, 564, 556, 565, 556, 564, 564, 574, 565, 573, 574, 564, 544, 555, 546, 556, 546, 555, 556, 557, 546, 557, 556, 566, 565, 566, 556, 565, 574, 566, 575, 566, 574, 574, 573, 579, 574, 579, 575, 557, 566, 558, 567, 558, 566, 575, 567, 566, 558, 549, 557, 549, 558, 550, 559, 550, 558, 559, 558, 568, 567, 568, 558, 567, 575, 568, 559, 568, 569, 571, 570, 568, 576, 568, 575, 576, 571, 568, 550, 559, 551, 560, 551, 559, 551, 539, 550, 539, 551, 615, 551, 648, 615, 539, 538, 537, 537, 550, 539, 610, 538, 539, 610, 539, 615, 615, 613, 610, 615, 618, 613, 618, 615, 649, 610, 609, 607, 614, 610, 613, 607, 538, 610, 536, 537, 538, 537, 536, 534, 535, 534, 536, 533, 532, 534, 535, 533, 534, 549, 534, 548, 532, 548, 534, 534, 549, 537, 533, 531, 532, 531, 529, 532, 548, 532, 546, 529, 546, 532, 548, 546, 557, 548, 557, 549, 550, 537, 549, 546, 529, 544, 528, 530, 529, 531, 528, 529, 547, 544, 529, 544, 543, 542, 542, 525, 541, 525, 542, 545, 541, 553, 542, 524, 525, 526, 528, 524, 527, 608, 607, 606, 619, 613, 618, 618, 622, 619, 623, 619, 622, 618, 650, 622, 622, 626, 623, 571, 622, 651, 571, 626, 622, 627, 623, 626, 626, 630, 627, 576, 626, 571, 576, 630, 626, 631, 627, 630, 630, 634, 631, 630, 576, 581, 581, 586, 630, 634, 630, 586, 576, 575, 581, 580, 581, 575, 581, 580, 586, 585, 586, 580, 586, 585, 591, 586, 591, 634, 580, 575, 579, 580, 579, 585, 584, 585, 579, 585, 584, 590, 590, 591, 585, 639, 634, 591, 600, 639, 591, 591, 590, 600, 589, 590, 584, 590, 589, 598, 598, 600, 590, 579, 578, 584, 583, 584, 578, 584, 583, 589, 578, 579, 573, 578, 573, 577, 577, 582, 578, 583, 578, 582, 582, 587, 583, 588, 583, 587, 588, 589, 583, 633, 582, 629, 629, 582, 577, 582, 633, 587, 629, 577, 625, 628, 629, 625, 629, 628, 632, 632, 633, 629, 637, 636, 633, 632, 637, 633, 636, 587, 633, 587, 636, 593, 593, 588, 587, 594, 593, 592, 642, 640, 593, 592, 593, 640, 588, 593, 594, 592, 595, 594, 596, 594, 595, 594, 596, 588, 589, 588, 596, 595, 597, 596, 598, 596, 597, 596, 598, 589, 597, 599, 598, 600, 598, 599, 599, 601, 600, 601, 644, 600, 645, 600, 644, 646, 645, 644, 647, 646, 644, 642, 641, 640, 643, 640, 641, 625, 624, 628, 639, 638, 634, 635, 634, 638, 635, 631, 634, 654, 653, 652, 655, 654, 652, 657, 656, 652, 655, 652, 656, 652, 653, 672, 652, 672, 674, 657, 652, 674, 653, 654, 739, 738, 739, 654, 739, 738, 737, 737, 745, 739, 746, 739, 745, 739, 746, 653, 740, 737, 738, 653, 673, 672, 673, 653, 746, 746, 745, 749, 673, 746, 684, 749, 684, 746, 750, 749, 745, 749, 750, 753, 749, 753, 684, 754, 753, 750, 753, 754, 757, 696, 684, 753, 753, 757, 696, 758, 757, 754, 757, 758, 761, 707, 696, 757, 757, 761, 707, 684, 696, 695, 707, 695, 696, 695, 707, 708, 707, 712, 708, 712, 707, 761, 685, 684, 695, 697, 686, 695, 685, 695, 686, 697, 695, 708, 685, 672, 684, 686, 674, 685, 672, 685, 674, 673, 684, 672, 657, 674, 675, 674, 686, 675, 687, 675, 686, 686, 697, 698, 698, 687, 686, 708, 698, 697, 687, 698, 699, 698, 708, 709, 709, 699, 698, 688, 676, 687, 675, 687, 676, 699, 700, 687, 702, 699, 701, 699, 709, 701, 701, 690, 703, 704, 692, 701, 690, 701, 692, 710, 701, 709, 710, 704, 701, 690, 677, 689, 692, 679, 690, 677, 690, 679, 660, 676, 677, 678, 660, 677, 680, 677, 679, 676, 691, 677, 679, 665, 681, 665, 679, 682, 679, 692, 682, 682, 669, 665, 669, 682, 683, 693, 682, 692, 682, 693, 683, 705, 693, 692, 704, 705, 692, 694, 683, 693, 693, 705, 694, 683, 670, 669, 683, 748, 670, 683, 694, 748, 669, 668, 665, 668, 669, 670, 671, 668, 670, 744, 671, 670, 744, 670, 748, 667, 665, 668, 664, 666, 665, 667, 664, 665, 664, 661, 663, 661, 659, 660, 661, 660, 662, 659, 656, 658, 659, 658, 660, 660, 658, 676, 656, 657, 658, 658, 657, 675, 658, 675, 676, 748, 747, 744, 747, 748, 751, 752, 751, 748, 752, 748, 694, 741, 744, 747, 744, 741, 742, 742, 671, 744, 743, 742, 741, 706, 694, 705, 694, 706, 752, 711, 706, 705, 756, 752, 706, 706, 711, 756, 704, 710, 705, 711, 705, 710, 716, 711, 710, 760, 756, 711, 711, 716, 760, 756, 755, 752, 760, 759, 756, 755, 756, 759, 764, 763, 760, 759, 760, 763, 764, 760, 716, 768, 767, 764, 763, 764, 767, 716, 721, 764, 768, 764, 721, 772, 771, 768, 767, 768, 771, 721, 726, 768, 772, 768, 726, 715, 721, 716, 721, 715, 720, 720, 726, 721, 726, 720, 725, 736, 772, 726, 726, 725, 736, 720, 714, 719, 720, 715, 714, 725, 720, 719, 715, 710, 714, 715, 716, 710, 714, 709, 713, 709, 714, 710, 719, 714, 713, 719, 713, 718, 724, 719, 718, 725, 719, 724, 713, 708, 712, 708, 713, 709, 718, 713, 717, 712, 717, 713, 723, 718, 722, 717, 722, 718, 724, 718, 723, 724, 723, 732, 732, 734, 724, 725, 724, 734, 729, 723, 728, 722, 728, 723, 729, 732, 723, 717, 765, 722, 769, 722, 765, 722, 769, 728, 729, 728, 727, 775, 773, 728, 727, 728, 773, 727, 730, 729, 730, 731, 729, 732, 729, 731, 731, 733, 732, 734, 732, 733, 733, 735, 734, 736, 734, 735, 734, 736, 725, 735, 777, 736, 778, 736, 777, 779, 778, 777, 780, 779, 777, 775, 774, 773, 776, 773, 774, 770, 769, 765, 766, 770, 765, 766, 765, 762, 761, 762, 765, 717, 761, 765, 762, 761, 758, 712, 761, 717, 751, 752, 755, 783, 782, 781, 784, 783, 781, 786, 785, 781, 784, 781, 785, 800, 781, 799, 782, 799, 781, 781, 800, 786, 782, 783, 858, 857, 858, 783, 858, 857, 856, 866, 865, 858, 856, 866, 858, 858, 865, 782, 859, 856, 857, 799, 782, 865, 799, 808, 800, 799, 865, 808, 865, 866, 870, 870, 871, 865, 871, 808, 865, 809, 800, 808, 808, 817, 809, 808, 871, 817, 871, 870, 874, 874, 875, 871, 875, 817, 871, 818, 809, 817, 826, 818, 817, 875, 826, 817, 878, 875, 874, 878, 879, 875, 879, 826, 875, 818, 826, 827, 826, 831, 827, 879, 831, 826, 809, 818, 810, 819, 810, 818, 819, 818, 827, 810, 801, 809, 801, 810, 802, 811, 802, 810, 811, 810, 820, 819, 820, 810, 827, 820, 819, 821, 812, 820, 811, 820, 812, 821, 820, 828, 820, 827, 828, 812, 803, 811, 802, 811, 803, 813, 804, 812, 803, 812, 804, 821, 822, 812, 813, 812, 822, 821, 828, 822, 829, 822, 828, 828, 827, 833, 828, 833, 829, 823, 814, 822, 813, 822, 814, 829, 823, 822, 814, 805, 813, 804, 813, 805, 815, 806, 814, 805, 814, 806, 814, 823, 824, 815, 814, 824, 823, 829, 824, 815, 824, 825, 830, 824, 829, 830, 825, 824, 816, 807, 815, 806, 815, 807, 816, 815, 825, 806, 796, 805, 807, 798, 806, 796, 806, 798, 798, 807, 869, 807, 816, 869, 872, 869, 816, 872, 816, 876, 825, 876, 816, 869, 867, 864, 869, 872, 867, 864, 798, 869, 798, 797, 796, 864, 797, 798, 864, 863, 861, 868, 864, 867, 861, 797, 864, 873, 867, 872, 872, 876, 873, 877, 873, 876, 876, 880, 877, 881, 877, 880, 880, 884, 881, 825, 880, 876, 830, 880, 825, 830, 884, 880, 885, 881, 884, 884, 888, 885, 889, 885, 888, 893, 892, 888, 889, 888, 892, 888, 884, 840, 893, 888, 845, 840, 845, 888, 854, 893, 845, 844, 845, 839, 840, 839, 845, 845, 844, 854, 839, 840, 834, 835, 834, 840, 835, 840, 884, 838, 839, 833, 834, 833, 839, 839, 838, 844, 834, 829, 833, 834, 835, 829, 830, 829, 835, 884, 830, 835, 832, 833, 827, 833, 832, 838, 837, 838, 832, 838, 837, 843, 843, 844, 838, 832, 827, 831, 831, 836, 832, 837, 832, 836, 836, 841, 837, 842, 837, 841, 842, 843, 837, 843, 842, 850, 844, 843, 852, 850, 852, 843, 852, 854, 844, 852, 850, 851, 851, 853, 852, 854, 852, 853, 850, 848, 849, 849, 851, 850, 848, 850, 842, 842, 847, 848, 841, 847, 842, 848, 847, 846, 846, 849, 848, 896, 894, 847, 846, 847, 894, 841, 890, 847, 896, 895, 894, 897, 894, 895, 891, 890, 887, 890, 841, 887, 836, 887, 841, 886, 887, 883, 886, 891, 887, 836, 883, 887, 883, 836, 831, 882, 883, 879, 883, 882, 886, 831, 879, 883, 879, 878, 882, 853, 855, 854, 855, 898, 854, 899, 854, 898, 900, 899, 898, 901, 900, 898, 795, 796, 797, 796, 795, 793, 794, 793, 795, 793, 805, 796, 792, 791, 793, 794, 792, 793, 805, 793, 804, 791, 804, 793, 792, 790, 791, 790, 789, 791, 804, 791, 803, 789, 803, 791, 790, 788, 789, 788, 787, 789, 803, 789, 802, 787, 802, 789, 788, 785, 787, 785, 786, 787, 802, 787, 801, 786, 801, 787, 801, 786, 800, 800, 809, 801, 862, 861, 860, 904, 903, 902, 905, 904, 902, 907, 906, 902, 905, 902, 906, 902, 903, 922, 902, 922, 924, 907, 902, 924, 903, 904, 984, 983, 984, 904, 984, 983, 982, 992, 991, 984, 993, 984, 991, 984, 993, 903, 986, 985, 983, 903, 923, 922, 923, 903, 993, 993, 991, 996, 923, 993, 934, 996, 934, 993, 997, 996, 991, 996, 997, 1000, 996, 1000, 934, 935, 922, 934, 923, 934, 922, 934, 943, 935, 943, 934, 1000, 1001, 1000, 997, 1000, 1001, 1004, 1000, 1004, 943, 944, 935, 943, 952, 944, 943, 952, 943, 1004, 1005, 1004, 1001, 1004, 1005, 1008, 1004, 1008, 952, 952, 953, 944, 952, 957, 953, 957, 952, 1008, 944, 945, 935, 953, 945, 944, 953, 946, 945, 953, 954, 946, 958, 953, 957, 953, 958, 954, 957, 962, 958, 957, 1008, 962, 959, 954, 958, 963, 958, 962, 958, 964, 959, 963, 964, 958, 962, 967, 963, 1012, 962, 1008, 962, 1012, 967, 968, 963, 967, 963, 969, 964, 968, 969, 963, 964, 965, 959, 964, 970, 965, 969, 970, 964, 969, 968, 977, 970, 969, 979, 977, 979, 969, 973, 968, 967, 973, 974, 968, 974, 977, 968, 977, 974, 976, 976, 978, 977, 979, 977, 978, 978, 980, 979, 981, 979, 980, 979, 981, 970, 980, 1024, 981, 1025, 981, 1024, 981, 1019, 971, 971, 970, 981, 1026, 1025, 1024, 1027, 1026, 1024, 970, 971, 965, 966, 965, 971, 966, 971, 1015, 1019, 1015, 971, 1019, 1018, 1015, 1015, 1014, 1011, 1014, 1015, 1018, 1015, 1011, 966, 961, 960, 966, 965, 966, 960, 961, 966, 1011, 959, 965, 960, 954, 960, 955, 959, 960, 954, 960, 961, 955, 956, 955, 961, 956, 961, 1007, 1011, 1007, 961, 1011, 1010, 1007, 1010, 1011, 1014, 1007, 1006, 1003, 1006, 1007, 1010, 1007, 1003, 956, 956, 950, 955, 956, 951, 950, 951, 956, 1003, 1003, 1002, 999, 1002, 1003, 1006, 1003, 999, 951, 951, 942, 950, 942, 951, 999, 999, 998, 995, 998, 999, 1002, 999, 995, 942, 942, 933, 941, 941, 950, 942, 933, 942, 995, 995, 994, 990, 994, 995, 998, 933, 995, 920, 990, 920, 995, 919, 932, 933, 933, 920, 919, 932, 941, 933, 941, 932, 940, 941, 940, 950, 915, 929, 932, 932, 919, 915, 929, 940, 932, 919, 918, 915, 918, 919, 920, 921, 918, 920, 990, 921, 920, 917, 915, 918, 914, 916, 915, 917, 914, 915, 929, 915, 931, 914, 911, 913, 911, 909, 910, 911, 910, 912, 909, 906, 908, 909, 908, 910, 910, 908, 926, 910, 926, 927, 928, 910, 927, 906, 907, 908, 908, 907, 925, 908, 925, 926, 925, 937, 926, 938, 926, 937, 926, 938, 927, 930, 927, 929, 939, 927, 938, 927, 939, 929, 937, 946, 938, 947, 938, 946, 948, 939, 938, 947, 948, 938, 937, 925, 936, 946, 937, 936, 945, 946, 936, 954, 947, 946, 947, 954, 948, 939, 948, 940, 949, 940, 948, 955, 948, 954, 955, 949, 948, 940, 929, 939, 949, 950, 940, 949, 955, 950, 936, 924, 935, 924, 936, 925, 945, 936, 935, 907, 924, 925, 922, 935, 924, 988, 921, 990, 989, 988, 987, 990, 987, 988, 987, 990, 994, 975, 976, 974, 972, 975, 974, 974, 973, 972, 972, 973, 1020, 1022, 1020, 973, 967, 1016, 973, 1022, 1021, 1020, 1023, 1020, 1021, 1017, 1016, 1012, 1016, 967, 1012, 1013, 1017, 1012, 1013, 1012, 1009, 1008, 1009, 1012, 1009, 1008, 1005, 1030, 1029, 1028, 1031, 1030, 1028, 1033, 1032, 1028, 1031, 1028, 1032, 1049, 1028, 1048, 1029, 1048, 1028, 1028, 1049, 1033, 1029, 1030, 1112, 1111, 1112, 1030, 1112, 1111, 1110, 1120, 1119, 1112, 1110, 1120, 1112, 1112, 1119, 1029, 1113, 1110, 1111, 1048, 1029, 1119, 1048, 1060, 1049, 1048, 1119, 1060, 1119, 1120, 1124, 1124, 1125, 1119, 1125, 1060, 1119, 1061, 1049, 1060, 1060, 1069, 1061, 1060, 1125, 1069, 1125, 1124, 1128, 1128, 1129, 1125, 1129, 1069, 1125, 1070, 1061, 1069, 1080, 1070, 1069, 1129, 1080, 1069, 1132, 1129, 1128, 1132, 1133, 1129, 1133, 1080, 1129, 1070, 1080, 1081, 1080, 1085, 1081, 1133, 1085, 1080, 1071, 1062, 1070, 1061, 1070, 1062, 1071, 1070, 1081, 1062, 1071, 1072, 1081, 1072, 1071, 1062, 1050, 1061, 1063, 1052, 1062, 1050, 1062, 1052, 1063, 1062, 1072, 1049, 1061, 1050, 1050, 1033, 1049, 1052, 1051, 1050, 1033, 1050, 1053, 1054, 1037, 1052, 1055, 1052, 1037, 1052, 1063, 1054, 1036, 1038, 1037, 1039, 1036, 1037, 1039, 1037, 1040, 1037, 1054, 1040, 1036, 1032, 1035, 1032, 1033, 1034, 1041, 1039, 1040, 1041, 1040, 1042, 1056, 1040, 1054, 1040, 1056, 1042, 1043, 1041, 1042, 1045, 1044, 1042, 1043, 1042, 1044, 1057, 1042, 1056, 1042, 1057, 1045, 1065, 1056, 1054, 1056, 1065, 1057, 1064, 1054, 1063, 1054, 1064, 1065, 1066, 1057, 1065, 1074, 1065, 1064, 1065, 1074, 1066, 1058, 1045, 1057, 1057, 1066, 1058, 1067, 1058, 1066, 1075, 1066, 1074, 1066, 1075, 1076, 1076, 1067, 1066, 1059, 1047, 1058, 1045, 1058, 1047, 1058, 1067, 1059, 1068, 1059, 1067, 1067, 1076, 1079, 1047, 1059, 1123, 1059, 1156, 1123, 1047, 1046, 1045, 1118, 1046, 1047, 1118, 1047, 1123, 1044, 1045, 1046, 1115, 1046, 1118, 1118, 1117, 1115, 1122, 1118, 1121, 1123, 1121, 1118, 1116, 1115, 1114, 1127, 1121, 1126, 1123, 1126, 1121, 1126, 1130, 1127, 1131, 1127, 1130, 1126, 1123, 1157, 1126, 1158, 1130, 1130, 1134, 1131, 1078, 1130, 1159, 1078, 1134, 1130, 1135, 1131, 1134, 1134, 1138, 1135, 1084, 1134, 1078, 1084, 1138, 1134, 1078, 1077, 1076, 1084, 1078, 1076, 1084, 1076, 1083, 1089, 1084, 1083, 1138, 1084, 1089, 1075, 1083, 1076, 1083, 1074, 1082, 1083, 1075, 1074, 1088, 1083, 1082, 1089, 1083, 1088, 1094, 1089, 1088, 1089, 1094, 1138, 1082, 1087, 1088, 1093, 1088, 1087, 1094, 1088, 1093, 1099, 1094, 1093, 1142, 1138, 1094, 1094, 1099, 1142, 1093, 1087, 1092, 1098, 1093, 1092, 1099, 1093, 1098, 1147, 1142, 1099, 1108, 1147, 1099, 1099, 1098, 1108, 1098, 1092, 1097, 1098, 1097, 1106, 1106, 1108, 1098, 1092, 1086, 1091, 1092, 1087, 1086, 1097, 1092, 1091, 1091, 1096, 1097, 1097, 1096, 1104, 1104, 1106, 1097, 1106, 1104, 1105, 1105, 1107, 1106, 1108, 1106, 1107, 1104, 1102, 1103, 1103, 1105, 1104, 1102, 1104, 1096, 1096, 1091, 1095, 1102, 1096, 1101, 1095, 1101, 1096, 1102, 1101, 1100, 1100, 1103, 1102, 1150, 1148, 1101, 1100, 1101, 1148, 1095, 1144, 1101, 1090, 1095, 1091, 1090, 1141, 1095, 1144, 1095, 1141, 1145, 1144, 1141, 1140, 1141, 1137, 1140, 1145, 1141, 1090, 1137, 1141, 1091, 1086, 1090, 1085, 1090, 1086, 1137, 1090, 1085, 1136, 1137, 1133, 1137, 1136, 1140, 1085, 1133, 1137, 1086, 1081, 1085, 1081, 1086, 1087, 1072, 1081, 1082, 1082, 1081, 1087, 1073, 1064, 1072, 1063, 1072, 1064, 1073, 1072, 1082, 1073, 1082, 1074, 1064, 1073, 1074, 1133, 1132, 1136, 1150, 1149, 1148, 1151, 1148, 1149, 1107, 1109, 1108, 1109, 1152, 1108, 1153, 1108, 1152, 1154, 1153, 1152, 1155, 1154, 1152, 1147, 1146, 1142, 1143, 1142, 1146, 1138, 1142, 1139, 1143, 1139, 1142, 1139, 1135, 1138, 1162, 1161, 1160, 1163, 1162, 1160, 1165, 1164, 1160, 1163, 1160, 1164, 1160, 1161, 1178, 1160, 1178, 1180, 1165, 1160, 1180, 1161, 1162, 1237, 1236, 1237, 1162, 1237, 1236, 1235, 1245, 1244, 1237, 1246, 1237, 1244, 1237, 1246, 1161, 1239, 1238, 1236, 1161, 1179, 1178, 1179, 1161, 1246, 1246, 1244, 1249, 1179, 1246, 1187, 1249, 1187, 1246, 1250, 1249, 1244, 1249, 1250, 1253, 1249, 1253, 1187, 1179, 1187, 1178, 1188, 1178, 1187, 1187, 1196, 1188, 1196, 1187, 1253, 1254, 1253, 1250, 1253, 1254, 1257, 1253, 1257, 1196, 1197, 1188, 1196, 1205, 1197, 1196, 1205, 1196, 1257, 1178, 1188, 1180, 1189, 1180, 1188, 1188, 1197, 1189, 1198, 1189, 1197, 1198, 1197, 1206, 1205, 1206, 1197, 1205, 1210, 1206, 1210, 1205, 1261, 1257, 1261, 1205, 1211, 1206, 1210, 1210, 1215, 1211, 1261, 1215, 1210, 1262, 1261, 1258, 1257, 1258, 1261, 1261, 1262, 1265, 1265, 1215, 1261, 1216, 1211, 1215, 1215, 1220, 1216, 1215, 1265, 1220, 1266, 1265, 1262, 1270, 1269, 1265, 1266, 1270, 1265, 1269, 1220, 1265, 1221, 1216, 1220, 1220, 1269, 1226, 1226, 1221, 1220, 1221, 1222, 1216, 1221, 1226, 1227, 1222, 1221, 1230, 1227, 1230, 1221, 1227, 1226, 1225, 1275, 1273, 1226, 1225, 1226, 1273, 1225, 1228, 1227, 1228, 1229, 1227, 1230, 1227, 1229, 1229, 1231, 1230, 1232, 1230, 1231, 1231, 1233, 1232, 1234, 1232, 1233, 1232, 1223, 1230, 1232, 1234, 1223, 1233, 1277, 1234, 1278, 1234, 1277, 1234, 1272, 1224, 1224, 1223, 1234, 1279, 1278, 1277, 1280, 1279, 1277, 1218, 1217, 1223, 1222, 1223, 1217, 1223, 1224, 1218, 1222, 1230, 1223, 1213, 1212, 1218, 1217, 1218, 1212, 1218, 1219, 1213, 1219, 1218, 1224, 1212, 1211, 1217, 1216, 1217, 1211, 1217, 1216, 1222, 1207, 1206, 1212, 1211, 1212, 1206, 1207, 1212, 1208, 1213, 1208, 1212, 1213, 1214, 1208, 1214, 1213, 1219, 1208, 1201, 1207, 1208, 1202, 1201, 1202, 1208, 1203, 1209, 1203, 1208, 1209, 1208, 1214, 1264, 1260, 1214, 1209, 1214, 1260, 1214, 1219, 1264, 1209, 1204, 1203, 1204, 1209, 1256, 1260, 1256, 1209, 1260, 1259, 1256, 1264, 1263, 1260, 1259, 1260, 1263, 1256, 1255, 1252, 1255, 1256, 1259, 1256, 1252, 1204, 1204, 1195, 1203, 1195, 1204, 1252, 1252, 1251, 1248, 1251, 1252, 1255, 1252, 1248, 1195, 1195, 1186, 1194, 1194, 1203, 1195, 1186, 1195, 1248, 1248, 1247, 1243, 1247, 1248, 1251, 1186, 1248, 1176, 1243, 1176, 1248, 1175, 1185, 1186, 1186, 1176, 1175, 1185, 1194, 1186, 1174, 1175, 1176, 1177, 1174, 1176, 1243, 1177, 1176, 1243, 1240, 1241, 1240, 1243, 1247, 1241, 1177, 1243, 1242, 1241, 1240, 1175, 1174, 1172, 1173, 1172, 1174, 1185, 1175, 1172, 1172, 1184, 1185, 1185, 1184, 1194, 1171, 1170, 1172, 1173, 1171, 1172, 1184, 1172, 1170, 1170, 1183, 1184, 1183, 1192, 1184, 1193, 1184, 1192, 1193, 1194, 1184, 1203, 1194, 1202, 1193, 1202, 1194, 1193, 1192, 1202, 1192, 1183, 1191, 1192, 1191, 1201, 1201, 1202, 1192, 1200, 1201, 1191, 1200, 1207, 1201, 1200, 1191, 1199, 1200, 1199, 1207, 1199, 1206, 1207, 1190, 1189, 1199, 1198, 1199, 1189, 1190, 1199, 1191, 1206, 1199, 1198, 1181, 1180, 1190, 1189, 1190, 1180, 1190, 1191, 1181, 1165, 1180, 1181, 1166, 1165, 1181, 1166, 1181, 1182, 1182, 1181, 1191, 1164, 1165, 1166, 1167, 1164, 1166, 1167, 1166, 1168, 1168, 1166, 1182, 1168, 1182, 1183, 1182, 1191, 1183, 1169, 1167, 1168, 1169, 1168, 1170, 1170, 1168, 1183, 1171, 1169, 1170, 1263, 1264, 1267, 1268, 1267, 1264, 1268, 1264, 1219, 1267, 1268, 1271, 1272, 1271, 1268, 1272, 1268, 1224, 1219, 1224, 1268, 1275, 1274, 1273, 1276, 1273, 1274, 1258, 1257, 1254, 1283, 1282, 1281, 1284, 1283, 1281, 1286, 1285, 1281, 1284, 1281, 1285, 1302, 1281, 1301, 1282, 1301, 1281, 1281, 1302, 1286, 1282, 1283, 1363, 1362, 1363, 1283, 1363, 1362, 1361, 1371, 1370, 1363, 1361, 1371, 1363, 1363, 1370, 1282, 1364, 1361, 1362, 1301, 1282, 1370, 1301, 1313, 1302, 1301, 1370, 1313, 1370, 1371, 1375, 1375, 1376, 1370, 1376, 1313, 1370, 1314, 1302, 1313, 1313, 1322, 1314, 1313, 1376, 1322, 1376, 1375, 1379, 1379, 1380, 1376, 1380, 1322, 1376, 1323, 1314, 1322, 1331, 1323, 1322, 1380, 1331, 1322, 1383, 1380, 1379, 1383, 1384, 1380, 1384, 1331, 1380, 1332, 1323, 1331, 1331, 1336, 1332, 1331, 1384, 1336, 1324, 1315, 1323, 1314, 1323, 1315, 1332, 1324, 1323, 1315, 1324, 1325, 1332, 1325, 1324, 1315, 1303, 1314, 1316, 1305, 1315, 1303, 1315, 1305, 1325, 1316, 1315, 1302, 1314, 1303, 1303, 1286, 1302, 1305, 1304, 1303, 1286, 1303, 1306, 1307, 1290, 1305, 1308, 1305, 1290, 1305, 1316, 1307, 1289, 1291, 1290, 1292, 1289, 1290, 1292, 1290, 1293, 1290, 1307, 1293, 1289, 1285, 1288, 1285, 1286, 1287, 1294, 1292, 1293, 1294, 1293, 1295, 1309, 1293, 1307, 1293, 1309, 1295, 1296, 1294, 1295, 1298, 1297, 1295, 1296, 1295, 1297, 1310, 1295, 1309, 1295, 1310, 1298, 1318, 1309, 1307, 1309, 1318, 1310, 1317, 1307, 1316, 1307, 1317, 1318, 1319, 1310, 1318, 1327, 1318, 1317, 1318, 1327, 1319, 1311, 1298, 1310, 1310, 1319, 1311, 1320, 1311, 1319, 1328, 1319, 1327, 1329, 1320, 1319, 1328, 1329, 1319, 1312, 1300, 1311, 1298, 1311, 1300, 1311, 1320, 1312, 1321, 1312, 1320, 1320, 1329, 1321, 1300, 1312, 1374, 1312, 1321, 1374, 1300, 1299, 1298, 1369, 1299, 1300, 1369, 1300, 1374, 1297, 1298, 1299, 1366, 1299, 1369, 1369, 1368, 1366, 1373, 1369, 1372, 1374, 1372, 1369, 1374, 1377, 1372, 1377, 1374, 1321, 1378, 1372, 1377, 1377, 1381, 1378, 1377, 1321, 1381, 1382, 1378, 1381, 1381, 1385, 1382, 1330, 1381, 1321, 1330, 1385, 1381, 1386, 1382, 1385, 1385, 1389, 1386, 1335, 1385, 1330, 1335, 1389, 1385, 1330, 1321, 1329, 1335, 1330, 1329, 1335, 1329, 1334, 1334, 1340, 1335, 1389, 1335, 1340, 1328, 1334, 1329, 1334, 1328, 1327, 1334, 1327, 1333, 1333, 1338, 1334, 1339, 1334, 1338, 1339, 1340, 1334, 1339, 1345, 1340, 1340, 1345, 1389, 1338, 1344, 1339, 1344, 1345, 1339, 1338, 1332, 1337, 1338, 1333, 1332, 1337, 1343, 1338, 1343, 1344, 1338, 1343, 1349, 1344, 1344, 1350, 1345, 1349, 1350, 1344, 1393, 1389, 1345, 1345, 1350, 1393, 1398, 1393, 1350, 1359, 1398, 1350, 1350, 1349, 1359, 1348, 1349, 1343, 1349, 1348, 1357, 1357, 1359, 1349, 1359, 1357, 1358, 1358, 1360, 1359, 1360, 1403, 1359, 1404, 1359, 1403, 1357, 1355, 1356, 1356, 1358, 1357, 1355, 1357, 1348, 1355, 1353, 1354, 1354, 1356, 1355, 1355, 1348, 1353, 1353, 1352, 1351, 1351, 1354, 1353, 1353, 1347, 1352, 1353, 1348, 1347, 1401, 1399, 1352, 1351, 1352, 1399, 1346, 1395, 1352, 1352, 1347, 1346, 1347, 1342, 1346, 1348, 1342, 1347, 1348, 1343, 1342, 1342, 1337, 1341, 1343, 1337, 1342, 1341, 1346, 1342, 1341, 1392, 1346, 1395, 1346, 1392, 1396, 1395, 1392, 1391, 1392, 1388, 1391, 1396, 1392, 1392, 1341, 1388, 1336, 1341, 1337, 1336, 1388, 1341, 1337, 1332, 1336, 1388, 1336, 1384, 1387, 1388, 1384, 1388, 1387, 1391, 1384, 1383, 1387, 1333, 1325, 1332, 1333, 1326, 1325, 1326, 1333, 1327, 1326, 1317, 1325, 1316, 1325, 1317, 1326, 1327, 1317, 1401, 1400, 1399, 1402, 1399, 1400, 1405, 1404, 1403, 1406, 1405, 1403, 1398, 1397, 1393, 1394, 1393, 1397, 1389, 1393, 1390, 1394, 1390, 1393, 1390, 1386, 1389, 1367, 1366, 1365, 1409, 1408, 1407, 1410, 1409, 1407, 1412, 1411, 1407, 1410, 1407, 1411, 1407, 1408, 1425, 1407, 1425, 1427, 1412, 1407, 1427, 1408, 1409, 1484, 1483, 1484, 1409, 1484, 1483, 1482, 1482, 1490, 1484, 1491, 1484, 1490, 1484, 1491, 1408, 1485, 1482, 1483, 1408, 1426, 1425, 1426, 1408, 1491, 1491, 1490, 1494, 1426, 1491, 1434, 1494, 1434, 1491, 1495, 1494, 1490, 1494, 1495, 1498, 1494, 1498, 1434, 1426, 1434, 1425, 1435, 1425, 1434, 1434, 1443, 1435, 1443, 1434, 1498, 1499, 1498, 1495, 1498, 1499, 1502, 1498, 1502, 1443, 1444, 1435, 1443, 1452, 1444, 1443, 1452, 1443, 1502, 1436, 1427, 1435, 1425, 1435, 1427, 1435, 1444, 1436, 1445, 1436, 1444, 1444, 1452, 1453, 1445, 1444, 1453, 1452, 1457, 1453, 1457, 1452, 1506, 1502, 1506, 1452, 1458, 1453, 1457, 1457, 1462, 1458, 1506, 1462, 1457, 1507, 1506, 1503, 1502, 1503, 1506, 1506, 1507, 1510, 1462, 1506, 1510, 1463, 1458, 1462, 1462, 1467, 1463, 1462, 1510, 1467, 1511, 1510, 1507, 1515, 1514, 1510, 1511, 1515, 1510, 1514, 1467, 1510, 1468, 1463, 1467, 1467, 1514, 1473, 1467, 1473, 1468, 1468, 1469, 1463, 1474, 1468, 1473, 1469, 1468, 1477, 1474, 1477, 1468, 1474, 1473, 1472, 1520, 1518, 1473, 1472, 1473, 1518, 1472, 1475, 1474, 1475, 1476, 1474, 1477, 1474, 1476, 1476, 1478, 1477, 1479, 1477, 1478, 1477, 1479, 1469, 1478, 1480, 1479, 1481, 1479, 1480, 1470, 1469, 1479, 1479, 1481, 1470, 1480, 1522, 1481, 1523, 1481, 1522, 1481, 1517, 1471, 1471, 1470, 1481, 1469, 1470, 1464, 1465, 1464, 1470, 1471, 1465, 1470, 1464, 1463, 1469, 1463, 1464, 1458, 1459, 1458, 1464, 1464, 1465, 1459, 1460, 1459, 1465, 1466, 1460, 1465, 1471, 1466, 1465, 1466, 1471, 1513, 1517, 1513, 1471, 1517, 1516, 1513, 1513, 1512, 1509, 1512, 1513, 1516, 1513, 1509, 1466, 1466, 1461, 1460, 1461, 1466, 1509, 1460, 1455, 1459, 1455, 1460, 1461, 1461, 1456, 1455, 1456, 1461, 1505, 1509, 1505, 1461, 1509, 1508, 1505, 1508, 1509, 1512, 1505, 1504, 1501, 1504, 1505, 1508, 1505, 1501, 1456, 1456, 1450, 1455, 1456, 1451, 1450, 1451, 1456, 1501, 1501, 1500, 1497, 1500, 1501, 1504, 1501, 1497, 1451, 1451, 1442, 1450, 1442, 1451, 1497, 1497, 1496, 1493, 1496, 1497, 1500, 1497, 1493, 1442, 1442, 1433, 1441, 1441, 1450, 1442, 1433, 1442, 1493, 1493, 1492, 1489, 1492, 1493, 1496, 1433, 1493, 1423, 1489, 1423, 1493, 1422, 1432, 1433, 1433, 1423, 1422, 1432, 1441, 1433, 1431, 1440, 1441, 1432, 1431, 1441, 1441, 1440, 1450, 1419, 1431, 1432, 1432, 1422, 1419, 1422, 1421, 1419, 1421, 1422, 1423, 1424, 1421, 1423, 1489, 1424, 1423, 1420, 1419, 1421, 1418, 1417, 1419, 1420, 1418, 1419, 1431, 1419, 1417, 1418, 1416, 1417, 1416, 1415, 1417, 1417, 1415, 1430, 1417, 1430, 1431, 1416, 1414, 1415, 1414, 1413, 1415, 1415, 1413, 1429, 1415, 1429, 1430, 1439, 1430, 1438, 1429, 1438, 1430, 1430, 1439, 1431, 1413, 1428, 1429, 1438, 1429, 1437, 1428, 1437, 1429, 1438, 1437, 1447, 1438, 1447, 1439, 1440, 1431, 1439, 1448, 1439, 1447, 1439, 1448, 1440, 1446, 1447, 1437, 1447, 1446, 1454, 1447, 1454, 1448, 1437, 1428, 1436, 1437, 1436, 1446, 1445, 1446, 1436, 1453, 1446, 1445, 1446, 1453, 1454, 1455, 1448, 1454, 1454, 1453, 1459, 1454, 1459, 1455, 1449, 1440, 1448, 1455, 1449, 1448, 1440, 1449, 1450, 1449, 1455, 1450, 1458, 1459, 1453, 1427, 1436, 1428, 1412, 1427, 1428, 1413, 1412, 1428, 1411, 1412, 1413, 1414, 1411, 1413, 1487, 1424, 1489, 1488, 1487, 1486, 1489, 1486, 1487, 1486, 1489, 1492, 1524, 1523, 1522, 1525, 1524, 1522, 1520, 1519, 1518, 1521, 1518, 1519, 1503, 1502, 1499, 1528, 1527, 1526, 1526, 1591, 1590, 1527, 1591, 1526, 1526, 1594, 1528, 1526, 1590, 1594, 1529, 1527, 1528, 1530, 1529, 1528, 1531, 1529, 1530, 1532, 1531, 1530, 1597, 1530, 1801, 1528, 1802, 1530, 1530, 1597, 1532, 1533, 1531, 1532, 1534, 1533, 1532, 1600, 1532, 1597, 1532, 1600, 1534, 1598, 1596, 1597, 1599, 1597, 1596, 1597, 1599, 1600, 1601, 1600, 1599, 1600, 1601, 1602, 1602, 1534, 1600, 1668, 1599, 1666, 1596, 1666, 1599, 1599, 1668, 1601, 1596, 1595, 1593, 1666, 1596, 1665, 1593, 1665, 1596, 1666, 1665, 1663, 1666, 1663, 1667, 1668, 1666, 1667, 1665, 1664, 1663, 1665, 1727, 1664, 1593, 1662, 1665, 1727, 1665, 1662, 1594, 1593, 1592, 1593, 1594, 1662, 1662, 1661, 1660, 1661, 1662, 1594, 1662, 1660, 1727, 1800, 1528, 1594, 1661, 1594, 1590, 1659, 1660, 1661, 1590, 1588, 1661, 1659, 1661, 1588, 1660, 1659, 1657, 1660, 1657, 1726, 1726, 1727, 1660, 1658, 1657, 1659, 1658, 1659, 1586, 1588, 1586, 1659, 1588, 1587, 1586, 1589, 1587, 1588, 1590, 1589, 1588, 1591, 1589, 1590, 1587, 1584, 1586, 1586, 1584, 1585, 1586, 1585, 1658, 1658, 1655, 1657, 1655, 1658, 1585, 1585, 1584, 1582, 1655, 1585, 1653, 1582, 1653, 1585, 1583, 1582, 1584, 1582, 1581, 1580, 1583, 1581, 1582, 1653, 1582, 1652, 1580, 1652, 1582, 1654, 1653, 1651, 1652, 1651, 1653, 1653, 1654, 1655, 1651, 1652, 1649, 1652, 1580, 1649, 1580, 1578, 1579, 1581, 1578, 1580, 1579, 1649, 1580, 1650, 1649, 1647, 1646, 1647, 1649, 1651, 1649, 1650, 1649, 1579, 1646, 1579, 1578, 1577, 1577, 1646, 1579, 1576, 1577, 1578, 1577, 1576, 1574, 1577, 1574, 1646, 1647, 1646, 1645, 1648, 1645, 1646, 1809, 1646, 1574, 1647, 1645, 1713, 1647, 1713, 1650, 1642, 1645, 1644, 1643, 1645, 1642, 1645, 1643, 1712, 1712, 1713, 1645, 1643, 1642, 1640, 1643, 1640, 1710, 1710, 1712, 1643, 1712, 1710, 1711, 1712, 1711, 1713, 1710, 1708, 1709, 1710, 1709, 1711, 1708, 1710, 1640, 1714, 1713, 1711, 1780, 1711, 1778, 1709, 1778, 1711, 1711, 1780, 1714, 1708, 1707, 1709, 1778, 1709, 1775, 1707, 1775, 1709, 1778, 1775, 1777, 1777, 1779, 1778, 1780, 1778, 1779, 1780, 1779, 1783, 1812, 1714, 1780, 1782, 1781, 1779, 1782, 1784, 1787, 1786, 1785, 1784, 1789, 1788, 1784, 1786, 1784, 1788, 1715, 1714, 1786, 1813, 1786, 1714, 1786, 1788, 1715, 1789, 1790, 1788, 1791, 1788, 1790, 1717, 1715, 1788, 1788, 1791, 1717, 1713, 1714, 1715, 1716, 1713, 1715, 1716, 1715, 1717, 1718, 1716, 1717, 1718, 1717, 1719, 1719, 1717, 1791, 1791, 1790, 1792, 1791, 1792, 1719, 1793, 1792, 1790, 1794, 1792, 1793, 1722, 1719, 1792, 1794, 1723, 1792, 1722, 1792, 1723, 1720, 1718, 1719, 1722, 1721, 1719, 1720, 1719, 1721, 1721, 1722, 1723, 1724, 1721, 1723, 1724, 1723, 1725, 1723, 1794, 1725, 1656, 1720, 1721, 1721, 1724, 1656, 1720, 1654, 1718, 1654, 1720, 1656, 1656, 1655, 1654, 1656, 1657, 1655, 1657, 1656, 1724, 1726, 1724, 1725, 1724, 1726, 1657, 1726, 1725, 1727, 1728, 1727, 1725, 1727, 1728, 1664, 1799, 1728, 1797, 1725, 1797, 1728, 1728, 1799, 1664, 1663, 1664, 1731, 1730, 1731, 1664, 1730, 1664, 1799, 1799, 1797, 1798, 1798, 1729, 1799, 1730, 1799, 1729, 1797, 1794, 1796, 1796, 1798, 1797, 1797, 1725, 1794, 1795, 1794, 1793, 1795, 1796, 1794, 1731, 1730, 1729, 1729, 1732, 1731, 1732, 1733, 1731, 1734, 1731, 1733, 1733, 1735, 1734, 1736, 1734, 1735, 1667, 1663, 1734, 1731, 1734, 1663, 1734, 1736, 1667, 1738, 1737, 1735, 1736, 1735, 1737, 1669, 1667, 1736, 1736, 1737, 1669, 1668, 1667, 1669, 1670, 1668, 1669, 1670, 1669, 1671, 1671, 1669, 1737, 1737, 1738, 1739, 1739, 1673, 1737, 1671, 1737, 1673, 1740, 1739, 1738, 1740, 1741, 1739, 1742, 1739, 1741, 1742, 1675, 1739, 1673, 1739, 1675, 1672, 1671, 1673, 1674, 1672, 1673, 1674, 1673, 1675, 1672, 1670, 1671, 1603, 1670, 1672, 1672, 1674, 1603, 1676, 1674, 1675, 1604, 1603, 1674, 1674, 1676, 1604, 1676, 1675, 1677, 1675, 1742, 1677, 1678, 1676, 1677, 1607, 1604, 1676, 1676, 1678, 1607, 1604, 1602, 1603, 1605, 1602, 1604, 1607, 1606, 1604, 1605, 1604, 1606, 1609, 1608, 1607, 1606, 1607, 1608, 1609, 1607, 1678, 1605, 1606, 1536, 1538, 1536, 1606, 1606, 1608, 1538, 1602, 1605, 1534, 1536, 1534, 1605, 1603, 1602, 1601, 1601, 1670, 1603, 1670, 1601, 1668, 1535, 1533, 1534, 1536, 1535, 1534, 1537, 1535, 1536, 1538, 1537, 1536, 1539, 1537, 1538, 1540, 1539, 1538, 1541, 1539, 1540, 1542, 1541, 1540, 1540, 1538, 1608, 1542, 1540, 1803, 1608, 1804, 1540, 1543, 1541, 1542, 1608, 1609, 1610, 1612, 1611, 1609, 1612, 1609, 1680, 1678, 1680, 1609, 1680, 1678, 1679, 1678, 1677, 1679, 1810, 1679, 1744, 1677, 1744, 1679, 1744, 1677, 1742, 1744, 1742, 1743, 1745, 1744, 1743, 1741, 1743, 1742, 1747, 1746, 1743, 1651, 1718, 1654, 1718, 1651, 1716, 1650, 1716, 1651, 1716, 1650, 1713, 1776, 1777, 1775, 1773, 1776, 1775, 1775, 1774, 1773, 1775, 1707, 1774, 1772, 1773, 1771, 1774, 1771, 1773, 1771, 1774, 1703, 1706, 1703, 1774, 1706, 1774, 1707, 1705, 1706, 1707, 1708, 1705, 1707, 1706, 1705, 1703, 1702, 1701, 1703, 1704, 1702, 1703, 1704, 1703, 1705, 1703, 1701, 1771, 1639, 1704, 1705, 1705, 1708, 1639, 1640, 1639, 1708, 1639, 1638, 1636, 1639, 1640, 1638, 1636, 1704, 1639, 1704, 1636, 1702, 1637, 1635, 1636, 1634, 1636, 1635, 1637, 1636, 1638, 1634, 1702, 1636, 1641, 1638, 1640, 1638, 1569, 1637, 1638, 1641, 1569, 1641, 1640, 1642, 1570, 1569, 1641, 1641, 1642, 1570, 1569, 1568, 1567, 1570, 1568, 1569, 1567, 1637, 1569, 1637, 1567, 1635, 1567, 1566, 1565, 1566, 1567, 1568, 1565, 1635, 1567, 1571, 1568, 1570, 1572, 1571, 1570, 1572, 1570, 1642, 1642, 1808, 1572, 1573, 1571, 1572, 1574, 1573, 1572, 1574, 1572, 1807, 1575, 1573, 1574, 1575, 1574, 1576, 1635, 1633, 1634, 1635, 1565, 1633, 1633, 1631, 1632, 1632, 1634, 1633, 1633, 1563, 1631, 1563, 1633, 1565, 1702, 1634, 1699, 1632, 1699, 1634, 1631, 1630, 1632, 1699, 1632, 1697, 1630, 1697, 1632, 1700, 1699, 1698, 1697, 1698, 1699, 1699, 1700, 1701, 1702, 1699, 1701, 1698, 1697, 1695, 1696, 1695, 1697, 1630, 1628, 1697, 1696, 1697, 1628, 1629, 1628, 1630, 1631, 1629, 1630, 1628, 1627, 1626, 1628, 1629, 1627, 1628, 1626, 1696, 1696, 1694, 1695, 1694, 1696, 1626, 1626, 1624, 1625, 1626, 1627, 1624, 1626, 1625, 1694, 1624, 1627, 1555, 1557, 1555, 1627, 1627, 1629, 1557, 1622, 1623, 1624, 1625, 1624, 1623, 1622, 1624, 1552, 1555, 1552, 1624, 1625, 1623, 1692, 1692, 1694, 1625, 1692, 1690, 1691, 1692, 1691, 1693, 1694, 1692, 1693, 1690, 1692, 1623, 1690, 1688, 1689, 1690, 1689, 1691, 1623, 1688, 1690, 1760, 1691, 1757, 1689, 1757, 1691, 1691, 1760, 1693, 1694, 1693, 1695, 1761, 1693, 1760, 1693, 1761, 1695, 1760, 1757, 1759, 1760, 1759, 1761, 1762, 1761, 1759, 1761, 1762, 1763, 1763, 1695, 1761, 1695, 1763, 1698, 1764, 1763, 1762, 1763, 1764, 1765, 1765, 1698, 1763, 1700, 1698, 1767, 1765, 1767, 1698, 1766, 1765, 1764, 1765, 1766, 1767, 1768, 1767, 1766, 1767, 1768, 1769, 1767, 1769, 1700, 1701, 1700, 1769, 1770, 1769, 1768, 1771, 1769, 1770, 1769, 1771, 1701, 1772, 1771, 1770, 1758, 1759, 1757, 1756, 1758, 1757, 1757, 1755, 1756, 1755, 1757, 1687, 1689, 1687, 1757, 1754, 1756, 1755, 1755, 1753, 1754, 1753, 1755, 1685, 1687, 1685, 1755, 1686, 1685, 1687, 1688, 1686, 1687, 1688, 1687, 1689, 1682, 1683, 1685, 1686, 1682, 1685, 1685, 1683, 1753, 1753, 1752, 1749, 1749, 1754, 1753, 1752, 1753, 1683, 1683, 1682, 1681, 1683, 1681, 1752, 1752, 1751, 1749, 1811, 1752, 1681, 1750, 1749, 1748, 1684, 1681, 1682, 1682, 1613, 1684, 1617, 1684, 1613, 1615, 1614, 1613, 1617, 1613, 1616, 1613, 1618, 1615, 1613, 1682, 1618, 1619, 1615, 1618, 1618, 1620, 1619, 1686, 1618, 1682, 1618, 1686, 1620, 1621, 1619, 1620, 1619, 1548, 1615, 1621, 1550, 1619, 1548, 1619, 1550, 1620, 1623, 1621, 1688, 1620, 1686, 1620, 1688, 1623, 1621, 1623, 1622, 1622, 1552, 1621, 1550, 1621, 1552, 1550, 1549, 1548, 1551, 1549, 1550, 1552, 1551, 1550, 1553, 1551, 1552, 1555, 1554, 1552, 1553, 1552, 1554, 1557, 1556, 1555, 1554, 1555, 1556, 1559, 1558, 1557, 1556, 1557, 1558, 1559, 1557, 1629, 1561, 1560, 1559, 1558, 1559, 1560, 1561, 1559, 1631, 1629, 1631, 1559, 1563, 1562, 1561, 1560, 1561, 1562, 1561, 1631, 1563, 1565, 1564, 1563, 1562, 1563, 1564, 1564, 1565, 1566, 1549, 1547, 1548, 1547, 1545, 1546, 1548, 1547, 1546, 1546, 1615, 1548, 1546, 1545, 1544, 1615, 1546, 1805, 1544, 1806, 1546, 1816, 1815, 1814, 1817, 1816, 1814, 1817, 1814, 1818, 1814, 1815, 1912, 1912, 1916, 1814, 1818, 1814, 1916, 1819, 1817, 1818, 1816, 1817, 2619, 2616, 2619, 1817, 1817, 1819, 2616, 1819, 1818, 1820, 1916, 1921, 1818, 1820, 1818, 1921, 1821, 1819, 1820, 1821, 1820, 1822, 1921, 1923, 1820, 1822, 1820, 1923, 1921, 1916, 1920, 1923, 1921, 1922, 1920, 1922, 1921, 1923, 1922, 1924, 1923, 1924, 1822, 1823, 1821, 1822, 1823, 1822, 1824, 1824, 1822, 1924, 1821, 2613, 1819, 1821, 1823, 2613, 1825, 1823, 1824, 2611, 2613, 1823, 1823, 1825, 2611, 1825, 1824, 1826, 1924, 1927, 1824, 1826, 1824, 1927, 1827, 1825, 1826, 2608, 2611, 1825, 1825, 1827, 2608, 2611, 2608, 2610, 2613, 2611, 2612, 2610, 2612, 2611, 2606, 2609, 2608, 2607, 2606, 2608, 2609, 2610, 2608, 2607, 2608, 1827, 2607, 2605, 2606, 2604, 2606, 2605, 1827, 1829, 2607, 2605, 2607, 1829, 2605, 2603, 2604, 1829, 1831, 2605, 2603, 2605, 1831, 2602, 2604, 2603, 2603, 2601, 2602, 1831, 1833, 2603, 2601, 2603, 1833, 1831, 1829, 1830, 1831, 1830, 1832, 1833, 1831, 1832, 1829, 1827, 1828, 1829, 1828, 1830, 1830, 1828, 1930, 1930, 1832, 1830, 1833, 1832, 1834, 1832, 1930, 1932, 1932, 1834, 1832, 1835, 1833, 1834, 1833, 1835, 2601, 1835, 1834, 1836, 1834, 1932, 1934, 1934, 1836, 1834, 1933, 1932, 1931, 1930, 1931, 1932, 1932, 1933, 1934, 1935, 1934, 1933, 1934, 1935, 1936, 1937, 1934, 1936, 1836, 1934, 1937, 1933, 2051, 2662, 1933, 1931, 2051, 1935, 1933, 2664, 1931, 1930, 1929, 1931, 1929, 2051, 2051, 2049, 2050, 2051, 2050, 2054, 2049, 2051, 1929, 1929, 1928, 1926, 1928, 1929, 1930, 1929, 1926, 2049, 1928, 1930, 1828, 1927, 1926, 1928, 1927, 1928, 1826, 1828, 1826, 1928, 1927, 1924, 1926, 1925, 1926, 1924, 1926, 1925, 2046, 2046, 2049, 1926, 1925, 1924, 1922, 1925, 1922, 2043, 2043, 2046, 1925, 2046, 2043, 2045, 2048, 2046, 2047, 2049, 2046, 2048, 2043, 2041, 2042, 2044, 2043, 2042, 2041, 2043, 1922, 1922, 1920, 2041, 2041, 2039, 2040, 2042, 2041, 2040, 2039, 2041, 1920, 1919, 1920, 1916, 1920, 1919, 2039, 2039, 2037, 2038, 2039, 2038, 2040, 2037, 2039, 1919, 2040, 2153, 2154, 2038, 2153, 2040, 2040, 2154, 2042, 2037, 2036, 2038, 2038, 2036, 2153, 2037, 2035, 2036, 2035, 2037, 2660, 1919, 2661, 2037, 1919, 1916, 1918, 1912, 1917, 1916, 1914, 1913, 1912, 1915, 1912, 1913, 1914, 1912, 1815, 1913, 1914, 2029, 1815, 2697, 1914, 1911, 1910, 1815, 1816, 1911, 1815, 2696, 1815, 1910, 1911, 1909, 1910, 1909, 1911, 2623, 2620, 2623, 1911, 1911, 1816, 2620, 1909, 1908, 1910, 2024, 1910, 1908, 1910, 2024, 2695, 1909, 1907, 1908, 2623, 1907, 1909, 2623, 2620, 2622, 2624, 2623, 2622, 2624, 1907, 2623, 1907, 1905, 1906, 1907, 1906, 1908, 2624, 1905, 1907, 2022, 1908, 1906, 1908, 2022, 2024, 2025, 2024, 2022, 2024, 2025, 2026, 2023, 2022, 2020, 2021, 2020, 2022, 2023, 2025, 2022, 1906, 2021, 2022, 1905, 1904, 1906, 2021, 1906, 1904, 2020, 2021, 2019, 1904, 2019, 2021, 2019, 2018, 2020, 2135, 2020, 2018, 2020, 2135, 2138, 2138, 2023, 2020, 2023, 2138, 2140, 2140, 2025, 2023, 2139, 2138, 2136, 2135, 2136, 2138, 2138, 2139, 2140, 2136, 2135, 2134, 2132, 2137, 2135, 2018, 2132, 2135, 2233, 2136, 2658, 2235, 2136, 2233, 2136, 2235, 2139, 2234, 2235, 2233, 2236, 2235, 2234, 2236, 2237, 2235, 2237, 2139, 2235, 2234, 2233, 2232, 2234, 2232, 2332, 2332, 2236, 2234, 2237, 2236, 2238, 2239, 2238, 2236, 2332, 2334, 2236, 2334, 2239, 2236, 2139, 2237, 2141, 2238, 2141, 2237, 2238, 2241, 2240, 2239, 2241, 2238, 2238, 2240, 2141, 2334, 2336, 2239, 2336, 2338, 2239, 2241, 2239, 2338, 2240, 2241, 2242, 2243, 2242, 2241, 2338, 2243, 2241, 2143, 2141, 2240, 2143, 2240, 2145, 2242, 2145, 2240, 2242, 2243, 2148, 2242, 2148, 2145, 2147, 2148, 2243, 2243, 2338, 2340, 2340, 2147, 2243, 2148, 2147, 2146, 2033, 2148, 2032, 2146, 2032, 2148, 2033, 2145, 2148, 2034, 2033, 2032, 2033, 2034, 2145, 2145, 2144, 2143, 2144, 2145, 2034, 2035, 2034, 2032, 2034, 2035, 1913, 1913, 2144, 2034, 2035, 2032, 2036, 2032, 2146, 2036, 2659, 1913, 2035, 2031, 1913, 2030, 2144, 1913, 2682, 2142, 2143, 2144, 2681, 2142, 2144, 2143, 2142, 2141, 2140, 2141, 2142, 2025, 2140, 2142, 2142, 2680, 2025, 2141, 2140, 2139, 2028, 2027, 2025, 2151, 2036, 2146, 2151, 2153, 2036, 2151, 2146, 2150, 2153, 2151, 2152, 2150, 2152, 2151, 2149, 2146, 2147, 2149, 2150, 2146, 2150, 2149, 2248, 2248, 2152, 2150, 2149, 2147, 2244, 2244, 2248, 2149, 2246, 2244, 2147, 2147, 2340, 2246, 2246, 2245, 2244, 2244, 2249, 2248, 2245, 2249, 2244, 2248, 2251, 2250, 2249, 2251, 2248, 2152, 2248, 2250, 2249, 2342, 2347, 2342, 2249, 2245, 2347, 2251, 2249, 2247, 2245, 2246, 2245, 2344, 2342, 2344, 2245, 2247, 2344, 2343, 2342, 2345, 2342, 2343, 2347, 2342, 2346, 2345, 2346, 2342, 2347, 2346, 2348, 2251, 2347, 2348, 2349, 2348, 2346, 2346, 2345, 2445, 2445, 2349, 2346, 2345, 2343, 2440, 2440, 2445, 2345, 2445, 2440, 2444, 2445, 2447, 2446, 2444, 2447, 2445, 2349, 2445, 2446, 2348, 2349, 2350, 2351, 2350, 2349, 2349, 2446, 2351, 2348, 2350, 2251, 2350, 2351, 2352, 2253, 2251, 2350, 2255, 2350, 2352, 2253, 2350, 2255, 2353, 2352, 2351, 2351, 2446, 2448, 2351, 2448, 2353, 2355, 2352, 2354, 2353, 2354, 2352, 2352, 2355, 2255, 2353, 2448, 2451, 2354, 2353, 2452, 2451, 2452, 2353, 2446, 2449, 2448, 2451, 2448, 2450, 2449, 2450, 2448, 2451, 2453, 2452, 2450, 2453, 2451, 2450, 2449, 2703, 2703, 2453, 2450, 2447, 2449, 2446, 2449, 2447, 2702, 2702, 2703, 2449, 2704, 2453, 2703, 2453, 2454, 2452, 2704, 2705, 2453, 2454, 2453, 2705, 2455, 2452, 2454, 2454, 2457, 2455, 2705, 2706, 2454, 2457, 2454, 2706, 2455, 2457, 2456, 2455, 2357, 2452, 2456, 2359, 2455, 2357, 2455, 2359, 2457, 2459, 2456, 2459, 2457, 2707, 2706, 2707, 2457, 2456, 2459, 2458, 2458, 2361, 2456, 2359, 2456, 2361, 2359, 2358, 2357, 2361, 2360, 2359, 2358, 2359, 2360, 2363, 2362, 2361, 2360, 2361, 2362, 2361, 2458, 2363, 2458, 2461, 2460, 2459, 2461, 2458, 2460, 2363, 2458, 2365, 2364, 2363, 2362, 2363, 2364, 2363, 2460, 2365, 2362, 2265, 2360, 2364, 2267, 2362, 2265, 2362, 2267, 2364, 2365, 2366, 2366, 2269, 2364, 2267, 2364, 2269, 2367, 2366, 2365, 2462, 2365, 2460, 2365, 2462, 2367, 2366, 2367, 2368, 2269, 2366, 2271, 2368, 2271, 2366, 2269, 2268, 2267, 2268, 2269, 2270, 2271, 2270, 2269, 2270, 2271, 2272, 2273, 2272, 2271, 2368, 2371, 2271, 2273, 2271, 2371, 2270, 2173, 2268, 2270, 2272, 2173, 2272, 2273, 2274, 2174, 2173, 2272, 2272, 2177, 2174, 2274, 2177, 2272, 2275, 2274, 2273, 2371, 2275, 2273, 2370, 2371, 2368, 2371, 2370, 2372, 2372, 2275, 2371, 2274, 2275, 2276, 2277, 2276, 2275, 2372, 2277, 2275, 2373, 2372, 2370, 2372, 2373, 2374, 2374, 2277, 2372, 2277, 2279, 2276, 2374, 2279, 2277, 2375, 2374, 2373, 2374, 2375, 2376, 2376, 2279, 2374, 2468, 2373, 2370, 2471, 2373, 2468, 2471, 2375, 2373, 2377, 2376, 2375, 2375, 2471, 2472, 2377, 2375, 2474, 2472, 2474, 2375, 2376, 2379, 2378, 2379, 2376, 2377, 2376, 2378, 2279, 2474, 2477, 2377, 2379, 2377, 2477, 2472, 2475, 2474, 2477, 2474, 2476, 2475, 2476, 2474, 2471, 2473, 2472, 2473, 2475, 2472, 2475, 2714, 2715, 2714, 2475, 2473, 2475, 2715, 2476, 2476, 2479, 2477, 2476, 2715, 2716, 2479, 2476, 2717, 2716, 2717, 2476, 2477, 2479, 2478, 2479, 2481, 2478, 2481, 2479, 2718, 2717, 2718, 2479, 2478, 2481, 2480, 2381, 2477, 2478, 2383, 2478, 2480, 2478, 2383, 2381, 2481, 2483, 2480, 2483, 2481, 2719, 2718, 2719, 2481, 2480, 2483, 2482, 2385, 2480, 2482, 2480, 2385, 2383, 2383, 2382, 2381, 2383, 2385, 2382, 2382, 2385, 2384, 2385, 2386, 2384, 2386, 2385, 2484, 2482, 2484, 2385, 2482, 2485, 2484, 2483, 2485, 2482, 2719, 2485, 2483, 2485, 2719, 2720, 2485, 2487, 2484, 2720, 2487, 2485, 2484, 2487, 2486, 2484, 2486, 2386, 2387, 2384, 2386, 2386, 2388, 2387, 2388, 2386, 2486, 2486, 2489, 2488, 2487, 2489, 2486, 2391, 2486, 2488, 2486, 2391, 2388, 2389, 2387, 2388, 2389, 2388, 2390, 2391, 2390, 2388, 2391, 2392, 2390, 2391, 2488, 2392, 2488, 2491, 2490, 2489, 2491, 2488, 2392, 2488, 2490, 2393, 2390, 2392, 2393, 2392, 2394, 2395, 2394, 2392, 2392, 2490, 2395, 2293, 2389, 2390, 2390, 2393, 2293, 2295, 2293, 2393, 2297, 2393, 2394, 2295, 2393, 2297, 2295, 2294, 2293, 2294, 2295, 2296, 2297, 2296, 2295, 2296, 2297, 2298, 2299, 2298, 2297, 2297, 2394, 2299, 2199, 2294, 2296, 2296, 2298, 2199, 2292, 2293, 2294, 2197, 2292, 2294, 2197, 2294, 2199, 2199, 2198, 2197, 2199, 2200, 2198, 2200, 2199, 2298, 2298, 2299, 2300, 2298, 2300, 2200, 2201, 2198, 2200, 2201, 2200, 2202, 2203, 2202, 2200, 2203, 2200, 2300, 2301, 2300, 2299, 2300, 2301, 2302, 2300, 2302, 2203, 2203, 2204, 2202, 2204, 2203, 2302, 2303, 2302, 2301, 2302, 2303, 2304, 2302, 2304, 2204, 2205, 2202, 2204, 2204, 2206, 2205, 2206, 2204, 2304, 2305, 2304, 2303, 2304, 2305, 2306, 2306, 2209, 2304, 2206, 2304, 2209, 2207, 2205, 2206, 2209, 2208, 2206, 2207, 2206, 2208, 2208, 2209, 2210, 2210, 2209, 2308, 2306, 2308, 2209, 2307, 2306, 2305, 2306, 2307, 2308, 2309, 2308, 2307, 2311, 2308, 2310, 2309, 2310, 2308, 2308, 2311, 2210, 2211, 2208, 2210, 2211, 2210, 2212, 2212, 2210, 2311, 2311, 2313, 2312, 2310, 2313, 2311, 2311, 2312, 2212, 2310, 2309, 2408, 2313, 2310, 2411, 2408, 2411, 2310, 2313, 2315, 2312, 2313, 2411, 2315, 2312, 2315, 2314, 2214, 2212, 2312, 2214, 2312, 2217, 2314, 2217, 2312, 2315, 2317, 2314, 2412, 2315, 2411, 2412, 2415, 2315, 2317, 2315, 2415, 2410, 2411, 2408, 2411, 2410, 2412, 2413, 2412, 2410, 2414, 2412, 2413, 2414, 2415, 2412, 2415, 2417, 2416, 2417, 2415, 2414, 2415, 2416, 2317, 2414, 2413, 2513, 2513, 2417, 2414, 2508, 2413, 2410, 2510, 2413, 2508, 2510, 2513, 2413, 2410, 2408, 2409, 2410, 2409, 2508, 2506, 2509, 2508, 2508, 2511, 2510, 2509, 2511, 2508, 2506, 2508, 2409, 2513, 2510, 2512, 2511, 2512, 2510, 2511, 2509, 2733, 2512, 2511, 2734, 2733, 2734, 2511, 2512, 2515, 2513, 2515, 2512, 2735, 2734, 2735, 2512, 2513, 2515, 2514, 2515, 2517, 2514, 2515, 2735, 2517, 2517, 2735, 2736, 2514, 2517, 2516, 2517, 2519, 2516, 2519, 2517, 2737, 2736, 2737, 2517, 2514, 2417, 2513, 2514, 2516, 2417, 2516, 2519, 2518, 2419, 2417, 2516, 2516, 2421, 2419, 2516, 2518, 2421, 2519, 2521, 2518, 2519, 2737, 2521, 2521, 2737, 2738, 2518, 2521, 2520, 2521, 2761, 2520, 2771, 2770, 2521, 2518, 2520, 2421, 2423, 2421, 2520, 2520, 2761, 2760, 2520, 2760, 2769, 2420, 2423, 2422, 2421, 2423, 2420, 2759, 2422, 2423, 2418, 2421, 2420, 2418, 2420, 2321, 2323, 2321, 2420, 2420, 2422, 2323, 2325, 2323, 2422, 2422, 2759, 2758, 2422, 2758, 2325, 2320, 2323, 2322, 2321, 2323, 2320, 2323, 2325, 2322, 2318, 2321, 2320, 2319, 2321, 2318, 2321, 2319, 2418, 2318, 2320, 2220, 2222, 2220, 2320, 2320, 2322, 2222, 2322, 2325, 2324, 2225, 2222, 2322, 2322, 2324, 2225, 2222, 2221, 2220, 2222, 2223, 2221, 2225, 2224, 2222, 2223, 2222, 2224, 2225, 2227, 2224, 2227, 2225, 2324, 2324, 2325, 2756, 2324, 2767, 2227, 2224, 2227, 2226, 2754, 2226, 2227, 2754, 2227, 2767, 2224, 2124, 2223, 2224, 2226, 2124, 2126, 2124, 2226, 2755, 2226, 2754, 2755, 2752, 2226, 2124, 2122, 2123, 2125, 2122, 2124, 2126, 2125, 2124, 2656, 2223, 2124, 2127, 2125, 2126, 2122, 2125, 2006, 2008, 2006, 2125, 2125, 2127, 2008, 2005, 2004, 2006, 2006, 2007, 2005, 2007, 2006, 2008, 2006, 2004, 2122, 2008, 2009, 2007, 2009, 2008, 2010, 2010, 2008, 2127, 2005, 2007, 1888, 1890, 1888, 2007, 2007, 2009, 1890, 2010, 2011, 2009, 1892, 1890, 2009, 2009, 2011, 1892, 2011, 2010, 2750, 2751, 2750, 2010, 2010, 2127, 2751, 1894, 1892, 2011, 2750, 2747, 2011, 1894, 2011, 2747, 1891, 1890, 1892, 1893, 1891, 1892, 1893, 1892, 1894, 1895, 1893, 1894, 2747, 1895, 1894, 2538, 1891, 1893, 2541, 1893, 1895, 2538, 1893, 2541, 1891, 1889, 1890, 2543, 1889, 1891, 2543, 1891, 2538, 1889, 1887, 1888, 1889, 1888, 1890, 2544, 1887, 1889, 2544, 1889, 2543, 2543, 2538, 2542, 2544, 2543, 2542, 2545, 2544, 2542, 2544, 2545, 2546, 1887, 2544, 2546, 1887, 1885, 1886, 1887, 1886, 1888, 2546, 1885, 1887, 1888, 1886, 2005, 1885, 1884, 1886, 1886, 1884, 2002, 2002, 2005, 1886, 2004, 2005, 2002, 2003, 2002, 2001, 2000, 2001, 2002, 2002, 2003, 2004, 2000, 2002, 1884, 1883, 1882, 1884, 1885, 1883, 1884, 1884, 1882, 2000, 2001, 2000, 1995, 1999, 1995, 2000, 1999, 2000, 1882, 2001, 1995, 2115, 2115, 2117, 2001, 2003, 2001, 2117, 1997, 1996, 1995, 1999, 1998, 1995, 1995, 2679, 2113, 2113, 2115, 1995, 2694, 1999, 1880, 1882, 1880, 1999, 1879, 1878, 1880, 1881, 1879, 1880, 1881, 1880, 1882, 1880, 1878, 2693, 1883, 1881, 1882, 2552, 1879, 1881, 1881, 2551, 2552, 2551, 1881, 1883, 1883, 1885, 2551, 2551, 2548, 2550, 2551, 2550, 2552, 2548, 2551, 1885, 1885, 2546, 2548, 2546, 2547, 2548, 2549, 2548, 2547, 2549, 2550, 2548, 2553, 2552, 2550, 2553, 2554, 2552, 2555, 2552, 2554, 2555, 2554, 2556, 2557, 2556, 2554, 1877, 2555, 2556, 2555, 1877, 1879, 1879, 2552, 2555, 1877, 1875, 1876, 1877, 1876, 1878, 1879, 1877, 1878, 2556, 1875, 1877, 1875, 1874, 1876, 1983, 1876, 1874, 1876, 1983, 2689, 2690, 1878, 1876, 1878, 2691, 1991, 1991, 2692, 1878, 1991, 1990, 1987, 1991, 1987, 1994, 1989, 1988, 1987, 1993, 1992, 1987, 2106, 1987, 2676, 1987, 2106, 2108, 2108, 2111, 1987, 2677, 1987, 2111, 2109, 2108, 2107, 2106, 2107, 2108, 2108, 2109, 2110, 2111, 2108, 2110, 2111, 2110, 2112, 2113, 2111, 2112, 2111, 2113, 2678, 2110, 2109, 2213, 2213, 2215, 2110, 2112, 2110, 2215, 2109, 2107, 2211, 2211, 2213, 2109, 2213, 2211, 2212, 2213, 2212, 2214, 2214, 2215, 2213, 2215, 2214, 2216, 2215, 2114, 2112, 2216, 2114, 2215, 2113, 2112, 2114, 2115, 2113, 2114, 2115, 2114, 2116, 2216, 2219, 2114, 2116, 2114, 2219, 2217, 2216, 2214, 2218, 2216, 2217, 2218, 2219, 2216, 2220, 2219, 2218, 2220, 2221, 2219, 2219, 2221, 2116, 2117, 2115, 2116, 2118, 2117, 2116, 2118, 2116, 2221, 2221, 2223, 2118, 2119, 2117, 2118, 2120, 2119, 2118, 2655, 2118, 2223, 2117, 2119, 2003, 2122, 2119, 2121, 2004, 2003, 2119, 2119, 2122, 2004, 2220, 2218, 2318, 2218, 2217, 2316, 2316, 2318, 2218, 2316, 2319, 2318, 2314, 2317, 2316, 2317, 2319, 2316, 2314, 2316, 2217, 2319, 2317, 2416, 2416, 2418, 2319, 2416, 2419, 2418, 2419, 2416, 2417, 2421, 2418, 2419, 2208, 2211, 2107, 2107, 2207, 2208, 2107, 2106, 2105, 2207, 2107, 2105, 2105, 2103, 2207, 2205, 2207, 2103, 2105, 2104, 2103, 2104, 2105, 2106, 2675, 2104, 2106, 2102, 2103, 2104, 1982, 2102, 2104, 2104, 2674, 1982, 2103, 2102, 2101, 2103, 2101, 2205, 2202, 2205, 2101, 2101, 2100, 2098, 2100, 2101, 2102, 2101, 2098, 2202, 1980, 2100, 2102, 2102, 1982, 1980, 2097, 2098, 2100, 1978, 2097, 2100, 2100, 1980, 1978, 2098, 2097, 2096, 2098, 2198, 2201, 2654, 2198, 2098, 2201, 2202, 2098, 2093, 2099, 2097, 1976, 2093, 2097, 2097, 1978, 1976, 2094, 2093, 2091, 2095, 2091, 2093, 1975, 2672, 2093, 2093, 1976, 1975, 1977, 1974, 1976, 1975, 1976, 1974, 1976, 1978, 1977, 1975, 1974, 1972, 1975, 1972, 2673, 1973, 1972, 1974, 1866, 1973, 1974, 1974, 1868, 1866, 1868, 1974, 1977, 1973, 1971, 1972, 1864, 1971, 1973, 1973, 1866, 1864, 1865, 1864, 1866, 1867, 1865, 1866, 1867, 1866, 1868, 1869, 1867, 1868, 1869, 1868, 1870, 1977, 1870, 1868, 1865, 1867, 2569, 2567, 2569, 1867, 1867, 1869, 2567, 1865, 1863, 1864, 1865, 2569, 1863, 2569, 2567, 2568, 2570, 2569, 2568, 2570, 1863, 2569, 2567, 2564, 2566, 2566, 2568, 2567, 2564, 2567, 1869, 2568, 2571, 2570, 2573, 2570, 2572, 2571, 2572, 2570, 2570, 2573, 1863, 2575, 2573, 2574, 2572, 2574, 2573, 2575, 1859, 2573, 1861, 2573, 1859, 1861, 1863, 2573, 2576, 2575, 2574, 2576, 1857, 2575, 1859, 2575, 1857, 2574, 2577, 2576, 2579, 2576, 2578, 2577, 2578, 2576, 2576, 1855, 1857, 2579, 1855, 2576, 1857, 1855, 1856, 1857, 1856, 1858, 1859, 1857, 1858, 1855, 1853, 1854, 1855, 1854, 1856, 2579, 1853, 1855, 1856, 1854, 1964, 1964, 1967, 1856, 1858, 1856, 1967, 1859, 1858, 1860, 1967, 1968, 1858, 1860, 1858, 1968, 1967, 1964, 1966, 1967, 1966, 1968, 1969, 1968, 1966, 1971, 1968, 1970, 1969, 1970, 1968, 1968, 1971, 1860, 1861, 1859, 1860, 1861, 1860, 1862, 1862, 1860, 1971, 1970, 1972, 1971, 1971, 1864, 1862, 1970, 1969, 2089, 1972, 1970, 2089, 1969, 1966, 2087, 2087, 2089, 1969, 2089, 2087, 2088, 2089, 2088, 2092, 1972, 2089, 2671, 2087, 2084, 2086, 2088, 2087, 2086, 2084, 2087, 1966, 2084, 2081, 2083, 2086, 2084, 2085, 2081, 2084, 1965, 1966, 1965, 2084, 2086, 2651, 2192, 2086, 2192, 2088, 2191, 2190, 2192, 2193, 2192, 2190, 2192, 2193, 2194, 2191, 2192, 2650, 2194, 2088, 2192, 2191, 2188, 2190, 2188, 2191, 2080, 2649, 2080, 2191, 2186, 2187, 2188, 2189, 2188, 2187, 2189, 2190, 2188, 2188, 2080, 2186, 2184, 2185, 2186, 2187, 2186, 2185, 2186, 2078, 2184, 2078, 2186, 2080, 2187, 2185, 2284, 2284, 2189, 2187, 2189, 2284, 2286, 2190, 2189, 2288, 2286, 2288, 2189, 2282, 2285, 2284, 2284, 2287, 2286, 2285, 2287, 2284, 2282, 2284, 2185, 2286, 2289, 2288, 2287, 2289, 2286, 2288, 2291, 2290, 2289, 2291, 2288, 2288, 2290, 2190, 2193, 2190, 2290, 2290, 2293, 2292, 2291, 2293, 2290, 2290, 2292, 2193, 2291, 2289, 2389, 2389, 2293, 2291, 2289, 2287, 2387, 2387, 2389, 2289, 2384, 2387, 2287, 2287, 2285, 2384, 2382, 2384, 2285, 2380, 2381, 2382, 2380, 2382, 2285, 2378, 2379, 2380, 2381, 2380, 2379, 2378, 2380, 2283, 2380, 2285, 2283, 2477, 2381, 2379, 2280, 2283, 2282, 2281, 2283, 2280, 2283, 2285, 2282, 2378, 2283, 2281, 2281, 2279, 2378, 2278, 2281, 2280, 2279, 2281, 2278, 2276, 2279, 2278, 2278, 2181, 2276, 2278, 2280, 2181, 2276, 2179, 2274, 2276, 2181, 2179, 2181, 2180, 2179, 2182, 2180, 2181, 2182, 2181, 2280, 2179, 2178, 2177, 2178, 2179, 2180, 2274, 2179, 2177, 2182, 2183, 2180, 2180, 2072, 2178, 2180, 2183, 2072, 2183, 2182, 2184, 2185, 2184, 2182, 2280, 2185, 2182, 2074, 2072, 2183, 2074, 2183, 2076, 2184, 2076, 2183, 2076, 2184, 2078, 2075, 2074, 2076, 2077, 2075, 2076, 2077, 2076, 2078, 2073, 2072, 2074, 2075, 2073, 2074, 2073, 2075, 2669, 1955, 2670, 2075, 2075, 2077, 1955, 2079, 2077, 2078, 1961, 1955, 2077, 2077, 2079, 1961, 2080, 2079, 2078, 2081, 2079, 2080, 1963, 1961, 2079, 2079, 2081, 1963, 1961, 1960, 1955, 1960, 1961, 1962, 1963, 1962, 1961, 1962, 1963, 1964, 1965, 1964, 1963, 1965, 1963, 2081, 2082, 2081, 2080, 1965, 1966, 1964, 1962, 1964, 1854, 1960, 1962, 1852, 1854, 1852, 1962, 1853, 1852, 1854, 1851, 1850, 1852, 1853, 1851, 1852, 1852, 1850, 1960, 2581, 1851, 1853, 2581, 1853, 2579, 1851, 1849, 1850, 2583, 1849, 1851, 2583, 1851, 2581, 1849, 1848, 1850, 1850, 1848, 1959, 1959, 1960, 1850, 1847, 1846, 1848, 1849, 1847, 1848, 1848, 1846, 2687, 2688, 1959, 1848, 1955, 1959, 1958, 1959, 1955, 1960, 1957, 1956, 1955, 1845, 1844, 1846, 1847, 1845, 1846, 2684, 1846, 1844, 1846, 2685, 1951, 1951, 2686, 1846, 1947, 1951, 1950, 1951, 1947, 1954, 1949, 1948, 1947, 1953, 1952, 1947, 2068, 1947, 2667, 1947, 2068, 2070, 2070, 2073, 1947, 2668, 1947, 2073, 2071, 2070, 2069, 2068, 2069, 2070, 2070, 2071, 2072, 2073, 2070, 2072, 2071, 2069, 2178, 2178, 2072, 2071, 2069, 2068, 2067, 2175, 2069, 2067, 2176, 2069, 2175, 2176, 2178, 2069, 2176, 2177, 2178, 2177, 2176, 2174, 2175, 2174, 2176, 2174, 2175, 2172, 2172, 2175, 2065, 2067, 2065, 2175, 2067, 2066, 2065, 2066, 2067, 2068, 2065, 2064, 2063, 2064, 2065, 2066, 2170, 2065, 2063, 2172, 2065, 2170, 1942, 2064, 2066, 2066, 2665, 1942, 2666, 2066, 2068, 2062, 2063, 2064, 1940, 2062, 2064, 2064, 1942, 1940, 2063, 2062, 2060, 2063, 2060, 2170, 2059, 2060, 2062, 1938, 2059, 2062, 2062, 1940, 1938, 1939, 1938, 1940, 1940, 1941, 1939, 1941, 1940, 1942, 1937, 1936, 1938, 1939, 1937, 1938, 2059, 1938, 1936, 2060, 2059, 2058, 2055, 2061, 2059, 1936, 2055, 2059, 2055, 1936, 1935, 2056, 2055, 2053, 2057, 2053, 2055, 1935, 2663, 2055, 2053, 2052, 2050, 2053, 2050, 2164, 2164, 2646, 2053, 2050, 2049, 2048, 2050, 2160, 2162, 2050, 2048, 2160, 2162, 2164, 2050, 2048, 2159, 2160, 2048, 2645, 2159, 2159, 2158, 2160, 2161, 2160, 2158, 2160, 2161, 2162, 2163, 2162, 2161, 2162, 2163, 2164, 2161, 2158, 2258, 2161, 2258, 2163, 2159, 2156, 2158, 2157, 2158, 2156, 2158, 2157, 2256, 2256, 2258, 2158, 2256, 2259, 2258, 2258, 2261, 2260, 2259, 2261, 2258, 2260, 2163, 2258, 2165, 2164, 2163, 2163, 2260, 2165, 2260, 2261, 2262, 2262, 2165, 2260, 2167, 2166, 2165, 2164, 2165, 2166, 2165, 2262, 2167, 2647, 2164, 2166, 2166, 2167, 2168, 2169, 2166, 2168, 2166, 2060, 2648, 2060, 2166, 2169, 2264, 2167, 2262, 2167, 2264, 2168, 2262, 2263, 2264, 2265, 2264, 2263, 2264, 2265, 2266, 2266, 2168, 2264, 2263, 2262, 2261, 2263, 2261, 2360, 2263, 2360, 2265, 2267, 2266, 2265, 2266, 2267, 2268, 2266, 2268, 2168, 2171, 2168, 2268, 2171, 2268, 2173, 2171, 2170, 2168, 2173, 2172, 2171, 2170, 2171, 2172, 2169, 2168, 2170, 2169, 2170, 2060, 2174, 2172, 2173, 2358, 2360, 2261, 2356, 2357, 2358, 2358, 2261, 2356, 2259, 2356, 2261, 2355, 2354, 2356, 2357, 2356, 2354, 2356, 2259, 2355, 2354, 2452, 2357, 2257, 2255, 2355, 2257, 2355, 2259, 2257, 2259, 2256, 2254, 2257, 2256, 2255, 2257, 2254, 2252, 2255, 2254, 2253, 2255, 2252, 2157, 2252, 2254, 2254, 2256, 2157, 2250, 2253, 2252, 2155, 2152, 2252, 2250, 2252, 2152, 2155, 2252, 2157, 2251, 2253, 2250, 2157, 2156, 2155, 2155, 2154, 2152, 2154, 2155, 2156, 2153, 2152, 2154, 2042, 2154, 2156, 2156, 2159, 2042, 2644, 2042, 2159, 1937, 1838, 1836, 1838, 1937, 1939, 1837, 1836, 1838, 1839, 1837, 1838, 1839, 1838, 1840, 1939, 1840, 1838, 1837, 1835, 1836, 1835, 1837, 2599, 2597, 2599, 1837, 1837, 1839, 2597, 1841, 1839, 1840, 2595, 2597, 1839, 1839, 1841, 2595, 1841, 1840, 1842, 1840, 1939, 1941, 1941, 1842, 1840, 1843, 1841, 1842, 2592, 2595, 1841, 1841, 1843, 2592, 2595, 2592, 2594, 2594, 2596, 2595, 2597, 2595, 2596, 2591, 2590, 2592, 2593, 2592, 2590, 2593, 2594, 2592, 2591, 2592, 1843, 2591, 2589, 2590, 1843, 1845, 2591, 2589, 2591, 1845, 2588, 2590, 2589, 2589, 2587, 2588, 2587, 2589, 1847, 1845, 1847, 2589, 1845, 1843, 1844, 1843, 1842, 1844, 1943, 1844, 1842, 1844, 1943, 2683, 1842, 1941, 1943, 1942, 1943, 1941, 1943, 1942, 1946, 1945, 1944, 1942, 1847, 1849, 2587, 2584, 2587, 1849, 2584, 1849, 2583, 2587, 2584, 2586, 2586, 2588, 2587, 2584, 2583, 2582, 2585, 2584, 2582, 2585, 2586, 2584, 2583, 2581, 2582, 2580, 2582, 2581, 2581, 2579, 2580, 2578, 2580, 2579, 2596, 2598, 2597, 2599, 2597, 2598, 2598, 2600, 2599, 2601, 2599, 2600, 2599, 2601, 1835, 2600, 2602, 2601, 2280, 2282, 2185, 2195, 2194, 2193, 2195, 2193, 2292, 2194, 2195, 2196, 2197, 2196, 2195, 2195, 2292, 2197, 2194, 2196, 2088, 2196, 2197, 2198, 2091, 2088, 2196, 2652, 2196, 2198, 2091, 2196, 2653, 2091, 2090, 2088, 1863, 1861, 1862, 1863, 1862, 1864, 1871, 1869, 1870, 1869, 2562, 2564, 1871, 2562, 1869, 1871, 1870, 1872, 1873, 1871, 1872, 1871, 1873, 2562, 1870, 1977, 1979, 1979, 1872, 1870, 1873, 1872, 1874, 1872, 1979, 1981, 1981, 1874, 1872, 1875, 1873, 1874, 2560, 2562, 1873, 1873, 1875, 2560, 1874, 1981, 1983, 1981, 1979, 1980, 1980, 1982, 1981, 1983, 1981, 1982, 1979, 1977, 1978, 1978, 1980, 1979, 1985, 1984, 1982, 1983, 1982, 1986, 2561, 2560, 2558, 2559, 2558, 2560, 2560, 2561, 2562, 2559, 2560, 1875, 2561, 2563, 2562, 2562, 2563, 2564, 2563, 2565, 2564, 2565, 2566, 2564, 1875, 2556, 2559, 2559, 2556, 2558, 2557, 2558, 2556, 2547, 2546, 2545, 2539, 2542, 2538, 2540, 2539, 2538, 2538, 2541, 2540, 2540, 2541, 2762, 1895, 2749, 2541, 2749, 1895, 2748, 2753, 2751, 2127, 2753, 2127, 2752, 2752, 2127, 2126, 2126, 2766, 2752, 2757, 2756, 2325, 2768, 2325, 2758, 2732, 2733, 2509, 2732, 2509, 2731, 2507, 2509, 2506, 2507, 2731, 2509, 2507, 2730, 2731, 2504, 2507, 2506, 2505, 2507, 2504, 2730, 2507, 2505, 2409, 2406, 2506, 2504, 2506, 2406, 2502, 2505, 2504, 2406, 2502, 2504, 2503, 2505, 2502, 2505, 2503, 2730, 2729, 2730, 2503, 2501, 2503, 2502, 2500, 2503, 2501, 2503, 2500, 2729, 2502, 2405, 2501, 2502, 2406, 2405, 2501, 2498, 2500, 2402, 2400, 2501, 2498, 2501, 2400, 2402, 2501, 2405, 2405, 2404, 2402, 2406, 2404, 2405, 2400, 2402, 2401, 2403, 2401, 2402, 2403, 2402, 2404, 2401, 2399, 2400, 2398, 2400, 2399, 2400, 2398, 2498, 2303, 2301, 2401, 2399, 2401, 2301, 2401, 2403, 2303, 2305, 2303, 2403, 2403, 2404, 2305, 2307, 2305, 2404, 2309, 2307, 2407, 2404, 2407, 2307, 2407, 2408, 2309, 2407, 2404, 2406, 2407, 2406, 2408, 2409, 2408, 2406, 2399, 2301, 2397, 2299, 2397, 2301, 2397, 2394, 2396, 2399, 2397, 2398, 2396, 2398, 2397, 2397, 2299, 2394, 2395, 2396, 2394, 2494, 2396, 2492, 2395, 2492, 2396, 2398, 2396, 2496, 2494, 2496, 2396, 2496, 2498, 2398, 2494, 2497, 2496, 2496, 2499, 2498, 2497, 2499, 2496, 2492, 2495, 2494, 2495, 2497, 2494, 2490, 2493, 2492, 2493, 2495, 2492, 2395, 2490, 2492, 2495, 2493, 2725, 2725, 2497, 2495, 2726, 2497, 2725, 2726, 2499, 2497, 2499, 2500, 2498, 2727, 2499, 2726, 2727, 2500, 2499, 2728, 2500, 2727, 2728, 2729, 2500, 2724, 2725, 2493, 2491, 2493, 2490, 2493, 2491, 2724, 2723, 2724, 2491, 2491, 2489, 2723, 2722, 2723, 2489, 2489, 2487, 2722, 2721, 2722, 2487, 2487, 2720, 2721, 2470, 2473, 2471, 2473, 2470, 2714, 2471, 2468, 2470, 2469, 2470, 2468, 2470, 2469, 2713, 2713, 2714, 2470, 2467, 2469, 2468, 2467, 2468, 2369, 2370, 2369, 2468, 2467, 2464, 2466, 2466, 2469, 2467, 2467, 2369, 2464, 2369, 2368, 2367, 2370, 2368, 2369, 2464, 2369, 2367, 2462, 2465, 2464, 2465, 2466, 2464, 2464, 2367, 2462, 2711, 2466, 2710, 2465, 2710, 2466, 2466, 2711, 2469, 2463, 2465, 2462, 2465, 2463, 2710, 2460, 2463, 2462, 2461, 2463, 2460, 2463, 2461, 2709, 2709, 2710, 2463, 2461, 2459, 2708, 2708, 2709, 2461, 2707, 2708, 2459, 2712, 2469, 2711, 2712, 2713, 2469, 2701, 2702, 2447, 2447, 2444, 2701, 2700, 2701, 2444, 2441, 2444, 2440, 2444, 2698, 2700, 2698, 2444, 2441, 2442, 2441, 2440, 2443, 2441, 2442, 2441, 2699, 2698, 2699, 2441, 2443, 2442, 2440, 2343, 2536, 2443, 2442, 2343, 2536, 2442, 2537, 2443, 2536, 2443, 2537, 2699, 2746, 2699, 2537, 2535, 2537, 2536, 2534, 2537, 2535, 2537, 2534, 2746, 2439, 2535, 2536, 2536, 2343, 2439, 2343, 2344, 2439, 2439, 2438, 2437, 2438, 2439, 2344, 2535, 2439, 2437, 2535, 2532, 2534, 2437, 2435, 2535, 2532, 2535, 2435, 2434, 2437, 2436, 2435, 2437, 2434, 2436, 2437, 2438, 2341, 2436, 2438, 2247, 2438, 2344, 2438, 2247, 2341, 2434, 2436, 2337, 2339, 2337, 2436, 2436, 2341, 2339, 2432, 2433, 2434, 2435, 2434, 2433, 2432, 2434, 2337, 2337, 2336, 2335, 2336, 2337, 2338, 2339, 2338, 2337, 2432, 2337, 2335, 2338, 2339, 2340, 2341, 2340, 2339, 2340, 2341, 2246, 2247, 2246, 2341, 2335, 2334, 2333, 2334, 2335, 2336, 2430, 2335, 2333, 2430, 2432, 2335, 2332, 2333, 2334, 2333, 2332, 2331, 2333, 2331, 2430, 2428, 2431, 2430, 2430, 2431, 2432, 2428, 2430, 2331, 2331, 2330, 2329, 2330, 2331, 2332, 2425, 2331, 2329, 2428, 2331, 2425, 2330, 2332, 2232, 2326, 2329, 2330, 2326, 2330, 2230, 2232, 2230, 2330, 2329, 2326, 2327, 2327, 2427, 2329, 2425, 2329, 2427, 2328, 2327, 2326, 2326, 2230, 2328, 2230, 2229, 2228, 2232, 2229, 2230, 2228, 2328, 2230, 2232, 2233, 2229, 2231, 2228, 2229, 2229, 2130, 2231, 2229, 2233, 2130, 2228, 2231, 2787, 2787, 2800, 2228, 2328, 2228, 2800, 2789, 2327, 2328, 2790, 2327, 2789, 2790, 2792, 2327, 2792, 2791, 2427, 2427, 2327, 2792, 2424, 2427, 2791, 2427, 2424, 2425, 2426, 2425, 2424, 2524, 2426, 2424, 2425, 2429, 2428, 2429, 2425, 2426, 2522, 2426, 2524, 2522, 2526, 2426, 2429, 2426, 2526, 2431, 2428, 2429, 2526, 2529, 2429, 2431, 2429, 2529, 2522, 2527, 2526, 2529, 2526, 2528, 2527, 2528, 2526, 2524, 2523, 2522, 2523, 2527, 2522, 2741, 2527, 2739, 2523, 2739, 2527, 2527, 2741, 2528, 2528, 2531, 2529, 2528, 2741, 2742, 2531, 2528, 2743, 2742, 2743, 2528, 2529, 2531, 2530, 2531, 2533, 2530, 2533, 2531, 2744, 2743, 2744, 2531, 2530, 2533, 2532, 2533, 2534, 2532, 2533, 2744, 2534, 2534, 2744, 2745, 2745, 2746, 2534, 2435, 2530, 2532, 2530, 2435, 2433, 2433, 2432, 2431, 2433, 2431, 2530, 2529, 2530, 2431, 2523, 2525, 2739, 2740, 2739, 2525, 2525, 2523, 2524, 2525, 2524, 2793, 2525, 2803, 2802, 2794, 2793, 2524, 2801, 2794, 2524, 2788, 2787, 2231, 2788, 2231, 2785, 2231, 2130, 2128, 2130, 2129, 2128, 2133, 2132, 2130, 2129, 2130, 2132, 2657, 2130, 2233, 2131, 2128, 2129, 2128, 2131, 2785, 2128, 2785, 2799, 2786, 2785, 2131, 2014, 2131, 2129, 2014, 2012, 2131, 2786, 2131, 2784, 2012, 2784, 2131, 2014, 2013, 2012, 2013, 2014, 2016, 2016, 2014, 2129, 2015, 2012, 2013, 2784, 2012, 2783, 2015, 2783, 2012, 2015, 1896, 1897, 1896, 2015, 2013, 2783, 2015, 2780, 1897, 2780, 2015, 1898, 1897, 1896, 1899, 1898, 1896, 1899, 1896, 1900, 2013, 1900, 1896, 1897, 1898, 2780, 1898, 1899, 2635, 2782, 2781, 1898, 2635, 2782, 1898, 1901, 1899, 1900, 2632, 2635, 1899, 1899, 1901, 2632, 1901, 1900, 1902, 1900, 2013, 2017, 2017, 1902, 1900, 1903, 1901, 1902, 1903, 1902, 1904, 1902, 2017, 2019, 2019, 1904, 1902, 2016, 2017, 2013, 2017, 2016, 2018, 2018, 2019, 2017, 2016, 2129, 2132, 2132, 2018, 2016, 1905, 1903, 1904, 2629, 1901, 1903, 1903, 1905, 2629, 2627, 2629, 1905, 2627, 1905, 2624, 2629, 2627, 2628, 2630, 2629, 2628, 2630, 1901, 2629, 2630, 2632, 1901, 2631, 2630, 2628, 2630, 2631, 2632, 2626, 2628, 2627, 2627, 2624, 2626, 2622, 2625, 2624, 2625, 2626, 2624, 2621, 2622, 2620, 2618, 2621, 2620, 2620, 2619, 2618, 2619, 2620, 1816, 2619, 2616, 2618, 2617, 2618, 2616, 2615, 2617, 2616, 2616, 2614, 2615, 2614, 2616, 1819, 2612, 2615, 2614, 2614, 2613, 2612, 2614, 1819, 2613, 2633, 2632, 2631, 2633, 2634, 2632, 2635, 2632, 2634, 2798, 2635, 2634, 1827, 1826, 1828, 2638, 2637, 2636, 2639, 2636, 2637, 2636, 2772, 2638, 2773, 2638, 2772, 2639, 2637, 2777, 2776, 2777, 2637, 2777, 2776, 2774, 2779, 2777, 2778, 2778, 2777, 2774, 2776, 2775, 2774, 2776, 2804, 2775, 2642, 2641, 2640, 2643, 2642, 2640, 2805, 2642, 2643, 2806, 2805, 2643, 2805, 2808, 2807, 2806, 2808, 2805, 2810, 2809, 2808, 2811, 2810, 2808, 2808, 2809, 2807, 2807, 2809, 2812, 2812, 2813, 2807, 2765, 2764, 2763, 2797, 2796, 2795, 2816, 2815, 2814, 2814, 2818, 2816, 2816, 2817, 2815, 2815, 3231, 3230, 2817, 3231, 2815, 2817, 2816, 2880, 2817, 3297, 3231, 3297, 2817, 2880, 3232, 3230, 3231, 3298, 3231, 3297, 3298, 3232, 3231, 3232, 3233, 3230, 3234, 3233, 3232, 3299, 3232, 3298, 3299, 3234, 3232, 3332, 3298, 3331, 3332, 3299, 3298, 3297, 3529, 3298, 3331, 3298, 3530, 3297, 2880, 3532, 2881, 2880, 2816, 3106, 2880, 2881, 3106, 3531, 2880, 2819, 2816, 2818, 2816, 2819, 2881, 2818, 2820, 2819, 2821, 2819, 2820, 2882, 2881, 2819, 2819, 2821, 2882, 2820, 2822, 2821, 2823, 2822, 2820, 2883, 2882, 2821, 2821, 2884, 2883, 2822, 2884, 2821, 2882, 2883, 2913, 2913, 3105, 2882, 2881, 2882, 3105, 2914, 2913, 2883, 2914, 2883, 2915, 2884, 2915, 2883, 2884, 2822, 2885, 2915, 2884, 2916, 2885, 2916, 2884, 2945, 2915, 2944, 2916, 2944, 2915, 2945, 3104, 2915, 2914, 2915, 3104, 2913, 2914, 3104, 3104, 2945, 3117, 2913, 3104, 3119, 3117, 3119, 3104, 3118, 3117, 3116, 3115, 3116, 3117, 3117, 3118, 3119, 3115, 3117, 2945, 3120, 3119, 3118, 3119, 3120, 3121, 2913, 3119, 3105, 3121, 3105, 3119, 3122, 3121, 3120, 3137, 3120, 3135, 3118, 3135, 3120, 3120, 3137, 3122, 3121, 3122, 3123, 3121, 3106, 3105, 3123, 3106, 3121, 3106, 2881, 3105, 3106, 3123, 3570, 3124, 3123, 3122, 3124, 3548, 3123, 3547, 3123, 3548, 3547, 3569, 3123, 3141, 3124, 3139, 3122, 3139, 3124, 3124, 3141, 3564, 3548, 3124, 3564, 3142, 3141, 3140, 3139, 3140, 3141, 3141, 3142, 3564, 3140, 3139, 3138, 3137, 3138, 3139, 3139, 3122, 3137, 3140, 3138, 3228, 3142, 3140, 3229, 3228, 3229, 3140, 3563, 3564, 3142, 3142, 3229, 3563, 3564, 3563, 3562, 3548, 3564, 3562, 3561, 3562, 3563, 3563, 3642, 3561, 3642, 3563, 3643, 3562, 3561, 3560, 3546, 3562, 3560, 3546, 3548, 3562, 3548, 3546, 3547, 3546, 3544, 3545, 3545, 3547, 3546, 3544, 3546, 3560, 3560, 3559, 3557, 3559, 3560, 3561, 3544, 3560, 3557, 3544, 3542, 3543, 3543, 3545, 3544, 3557, 3542, 3544, 3331, 3545, 3528, 3543, 3528, 3545, 3545, 3331, 3547, 3568, 3547, 3331, 3332, 3331, 3528, 3332, 3528, 3333, 3367, 3333, 3528, 3528, 3543, 3367, 3541, 3543, 3542, 3541, 3367, 3543, 3368, 3333, 3367, 3367, 3527, 3400, 3400, 3368, 3367, 3367, 3541, 3566, 3542, 3540, 3541, 3540, 3567, 3541, 3542, 3539, 3540, 3539, 3542, 3555, 3557, 3555, 3542, 3540, 3539, 3538, 3538, 3434, 3540, 3565, 3540, 3434, 3539, 3537, 3538, 3537, 3539, 3553, 3555, 3553, 3539, 3538, 3537, 3536, 3536, 3525, 3538, 3434, 3538, 3525, 3435, 3400, 3434, 3434, 3525, 3435, 3400, 3526, 3434, 3467, 3525, 3524, 3467, 3435, 3525, 3525, 3536, 3524, 3468, 3436, 3467, 3435, 3467, 3436, 3467, 3497, 3468, 3497, 3467, 3524, 3469, 3437, 3468, 3436, 3468, 3437, 3498, 3468, 3497, 3468, 3498, 3469, 3436, 3402, 3435, 3437, 3403, 3436, 3402, 3436, 3403, 3438, 3404, 3437, 3403, 3437, 3404, 3437, 3469, 3438, 3403, 3373, 3402, 3404, 3375, 3403, 3373, 3403, 3375, 3402, 3371, 3401, 3371, 3402, 3373, 3401, 3435, 3402, 3373, 3338, 3371, 3375, 3340, 3373, 3338, 3373, 3340, 3376, 3341, 3375, 3340, 3375, 3341, 3375, 3404, 3376, 3340, 3305, 3338, 3341, 3306, 3340, 3305, 3340, 3306, 3338, 3304, 3337, 3304, 3338, 3305, 3374, 3371, 3338, 3305, 3247, 3304, 3306, 3249, 3305, 3247, 3305, 3249, 3307, 3250, 3306, 3249, 3306, 3250, 3306, 3341, 3307, 3249, 3248, 3247, 3248, 3249, 3250, 3247, 3246, 3245, 3246, 3247, 3248, 3245, 3304, 3247, 3251, 3248, 3250, 3253, 3252, 3250, 3251, 3250, 3252, 3250, 3307, 3253, 3255, 3254, 3253, 3252, 3253, 3254, 3308, 3253, 3307, 3253, 3308, 3255, 3255, 3256, 3254, 3309, 3255, 3308, 3255, 3309, 3256, 3257, 3254, 3256, 3257, 3256, 3258, 3259, 3258, 3256, 3310, 3256, 3309, 3256, 3311, 3259, 3310, 3311, 3256, 3261, 3258, 3260, 3259, 3260, 3258, 3259, 3312, 3260, 3311, 3312, 3259, 3310, 3346, 3311, 3311, 3347, 3312, 3346, 3347, 3311, 3309, 3345, 3310, 3345, 3346, 3310, 3345, 3382, 3346, 3346, 3383, 3347, 3382, 3383, 3346, 3347, 3348, 3312, 3347, 3384, 3348, 3383, 3384, 3347, 3312, 3313, 3260, 3312, 3348, 3313, 3348, 3349, 3313, 3348, 3385, 3349, 3384, 3385, 3348, 3383, 3416, 3384, 3384, 3417, 3385, 3416, 3417, 3384, 3382, 3415, 3383, 3415, 3416, 3383, 3415, 3446, 3416, 3416, 3447, 3417, 3446, 3447, 3416, 3417, 3418, 3385, 3417, 3448, 3418, 3447, 3448, 3417, 3385, 3386, 3349, 3385, 3418, 3386, 3418, 3419, 3386, 3418, 3449, 3419, 3448, 3449, 3418, 3447, 3480, 3448, 3448, 3481, 3449, 3480, 3481, 3448, 3446, 3479, 3447, 3479, 3480, 3447, 3479, 3510, 3480, 3480, 3511, 3481, 3510, 3511, 3480, 3481, 3482, 3449, 3481, 3512, 3482, 3511, 3512, 3481, 3449, 3450, 3419, 3449, 3482, 3450, 3450, 3482, 3451, 3483, 3451, 3482, 3482, 3512, 3483, 3419, 3450, 3420, 3420, 3450, 3421, 3451, 3421, 3450, 3421, 3451, 3422, 3452, 3422, 3451, 3451, 3483, 3484, 3486, 3485, 3483, 3513, 3483, 3512, 3483, 3513, 3486, 3487, 3486, 3455, 3488, 3455, 3486, 3514, 3486, 3513, 3486, 3514, 3488, 3513, 3512, 4544, 4544, 4545, 3513, 3514, 3513, 4545, 3515, 3488, 3514, 4545, 4546, 3514, 3515, 3514, 4546, 4545, 4544, 4515, 4515, 4516, 4545, 4546, 4545, 4516, 4544, 4543, 4514, 4514, 4515, 4544, 4543, 4544, 3512, 4515, 4514, 4482, 4482, 4483, 4515, 4516, 4515, 4483, 4483, 4484, 4516, 4517, 4516, 4484, 4516, 4517, 4546, 4483, 4482, 4449, 4449, 4450, 4483, 4484, 4483, 4450, 4482, 4481, 4448, 4448, 4449, 4482, 4481, 4482, 4514, 4449, 4448, 4413, 4413, 4414, 4449, 4450, 4449, 4414, 4451, 4450, 4415, 4414, 4415, 4450, 4450, 4451, 4484, 4414, 4413, 4376, 4415, 4414, 4377, 4376, 4377, 4414, 4413, 4411, 4375, 4375, 4376, 4413, 4411, 4413, 4448, 4376, 4375, 4334, 4377, 4376, 4336, 4334, 4336, 4376, 4378, 4377, 4338, 4336, 4338, 4377, 4377, 4378, 4415, 4336, 4334, 4335, 4335, 4337, 4336, 4338, 4336, 4337, 4334, 4332, 4333, 4333, 4335, 4334, 4332, 4334, 4375, 4332, 4330, 4331, 4331, 4333, 4332, 4330, 4332, 4373, 4375, 4374, 4332, 4330, 4328, 4329, 4329, 4331, 4330, 4328, 4330, 4371, 4372, 4371, 4330, 4328, 4325, 4327, 4327, 4329, 4328, 4325, 4328, 4370, 4371, 4370, 4328, 4370, 4371, 4407, 4408, 4407, 4371, 4371, 4409, 4408, 4369, 4323, 4370, 4325, 4370, 4323, 4370, 4407, 4369, 4406, 4369, 4407, 4407, 4446, 4406, 4407, 4408, 4446, 4411, 4408, 4410, 4447, 4446, 4408, 4408, 4411, 4447, 4445, 4406, 4446, 4446, 4480, 4445, 4446, 4447, 4480, 4448, 4447, 4411, 4481, 4480, 4447, 4447, 4448, 4481, 4412, 4375, 4411, 4480, 4481, 4513, 4514, 4513, 4481, 4479, 4445, 4480, 4480, 4513, 4479, 4512, 4479, 4513, 4513, 4543, 4512, 4513, 4514, 4543, 4478, 4444, 4479, 4445, 4479, 4444, 4479, 4512, 4478, 4511, 4478, 4512, 4512, 4542, 4511, 4542, 4512, 4543, 4543, 3512, 4542, 4541, 4511, 4542, 4542, 3511, 4541, 3511, 4542, 3512, 4510, 4477, 4511, 4478, 4511, 4477, 4511, 4541, 4510, 4540, 4510, 4541, 4541, 3510, 4540, 3510, 4541, 3511, 4509, 4476, 4510, 4477, 4510, 4476, 4510, 4540, 4509, 4476, 4442, 4477, 4443, 4477, 4442, 4477, 4443, 4478, 4475, 4441, 4476, 4442, 4476, 4441, 4476, 4509, 4475, 4441, 4402, 4442, 4403, 4442, 4402, 4442, 4403, 4443, 4404, 4443, 4403, 4443, 4404, 4444, 4444, 4478, 4443, 4402, 4365, 4403, 4366, 4403, 4365, 4403, 4366, 4404, 4401, 4364, 4402, 4365, 4402, 4364, 4402, 4441, 4401, 4364, 4314, 4365, 4315, 4365, 4314, 4365, 4315, 4366, 4318, 4366, 4315, 4366, 4318, 4367, 4367, 4404, 4366, 4313, 4316, 4315, 4314, 4313, 4315, 4318, 4315, 4317, 4316, 4317, 4315, 4314, 4311, 4313, 4314, 4364, 4311, 4312, 4313, 4311, 4312, 4311, 4309, 4310, 4309, 4311, 4363, 4362, 4311, 4310, 4311, 4362, 4311, 4364, 4363, 4307, 4309, 4308, 4310, 4308, 4309, 4308, 4310, 4361, 4362, 4361, 4310, 4308, 4306, 4307, 4306, 4308, 4360, 4361, 4360, 4308, 4305, 4307, 4306, 4306, 4304, 4305, 4304, 4306, 4359, 4360, 4359, 4306, 4359, 4360, 4394, 4395, 4394, 4360, 4360, 4361, 4395, 4396, 4395, 4361, 4361, 4362, 4397, 4394, 4395, 4431, 4432, 4431, 4395, 4395, 4433, 4432, 4431, 4430, 4394, 4430, 4431, 4462, 4463, 4462, 4431, 4431, 4432, 4463, 4435, 4432, 4434, 4464, 4463, 4432, 4432, 4435, 4464, 4462, 4463, 4498, 4499, 4498, 4463, 4463, 4464, 4499, 4465, 4464, 4435, 4500, 4499, 4464, 4464, 4465, 4500, 4498, 4499, 4531, 4532, 4531, 4499, 4499, 4500, 4532, 4498, 4497, 4462, 4497, 4498, 4530, 4531, 4530, 4498, 4530, 4531, 3499, 3500, 3499, 4531, 4531, 4532, 3500, 4533, 4532, 4500, 3501, 3500, 4532, 4532, 4533, 3501, 3500, 3470, 3499, 3501, 3471, 3500, 3470, 3500, 3471, 3499, 3469, 3498, 3469, 3499, 3470, 3499, 3498, 4530, 3470, 3438, 3469, 3471, 3439, 3470, 3438, 3470, 3439, 3472, 3440, 3471, 3439, 3471, 3440, 3471, 3501, 3472, 3439, 3405, 3438, 3440, 3406, 3439, 3405, 3439, 3406, 3404, 3438, 3405, 3405, 3376, 3404, 3406, 3377, 3405, 3376, 3405, 3377, 3407, 3378, 3406, 3377, 3406, 3378, 3406, 3440, 3407, 3441, 3407, 3440, 3440, 3472, 3441, 3409, 3408, 3407, 3378, 3407, 3410, 3407, 3441, 3409, 3378, 3343, 3377, 3379, 3344, 3378, 3343, 3378, 3344, 3343, 3308, 3342, 3344, 3309, 3343, 3308, 3343, 3309, 3342, 3377, 3343, 3344, 3345, 3309, 3344, 3380, 3345, 3381, 3380, 3344, 3380, 3382, 3345, 3412, 3411, 3380, 3380, 3414, 3382, 3411, 3414, 3380, 3414, 3415, 3382, 3411, 3444, 3414, 3414, 3445, 3415, 3444, 3445, 3414, 3409, 3411, 3413, 3409, 3443, 3411, 3443, 3444, 3411, 3443, 3476, 3444, 3444, 3477, 3445, 3476, 3477, 3444, 3445, 3446, 3415, 3445, 3478, 3446, 3477, 3478, 3445, 3476, 3507, 3477, 3477, 3508, 3478, 3507, 3508, 3477, 3475, 3476, 3443, 3475, 3506, 3476, 3506, 3507, 3476, 3506, 4537, 3507, 4538, 3507, 4537, 3507, 4538, 3508, 3508, 3509, 3478, 4539, 3508, 4538, 3508, 4539, 3509, 4537, 4505, 4538, 4508, 4538, 4505, 4538, 4508, 4539, 4536, 4503, 4537, 4505, 4537, 4503, 4537, 3506, 4536, 4503, 4506, 4505, 4473, 4505, 4507, 4505, 4473, 4508, 4475, 4508, 4473, 4508, 4475, 4509, 4509, 4539, 4508, 4474, 4438, 4473, 4440, 4473, 4438, 4473, 4440, 4475, 4441, 4475, 4440, 4438, 4400, 4440, 4401, 4440, 4400, 4440, 4401, 4441, 4439, 4399, 4438, 4400, 4438, 4399, 4438, 4472, 4471, 4399, 4362, 4400, 4363, 4400, 4362, 4400, 4363, 4401, 4364, 4401, 4363, 4399, 4398, 4362, 4436, 4399, 4435, 4437, 4435, 4399, 4435, 4466, 4465, 4468, 4465, 4467, 4501, 4500, 4465, 4465, 4468, 4501, 4468, 4470, 4469, 4502, 4501, 4468, 4502, 4468, 4503, 4504, 4503, 4468, 4501, 4502, 4534, 4535, 4534, 4502, 4535, 4502, 4536, 4503, 4536, 4502, 4534, 4533, 4501, 4533, 4534, 3502, 3503, 3502, 4534, 4534, 4535, 3503, 3504, 3503, 4535, 3504, 4535, 3505, 4536, 3505, 4535, 3505, 4536, 3506, 3474, 3505, 3475, 3504, 3505, 3474, 3505, 3506, 3475, 3504, 3474, 3503, 3503, 3473, 3502, 3473, 3503, 3474, 3474, 3442, 3473, 3474, 3475, 3442, 3442, 3475, 3443, 3442, 3409, 3441, 3442, 3443, 3409, 3441, 3473, 3442, 3473, 3441, 3472, 3472, 3502, 3473, 3502, 3472, 3501, 3502, 3501, 4533, 4500, 4501, 4533, 4539, 4509, 4540, 4540, 3509, 4539, 3509, 4540, 3510, 3478, 3509, 3479, 3509, 3510, 3479, 3478, 3479, 3446, 3377, 3342, 3376, 3342, 3307, 3341, 3307, 3342, 3308, 3341, 3376, 3342, 4530, 4529, 4497, 4529, 4530, 3498, 4529, 4528, 4496, 4496, 4497, 4529, 4528, 4529, 3497, 3498, 3497, 4529, 4497, 4496, 4461, 4461, 4462, 4497, 4496, 4495, 4460, 4460, 4461, 4496, 4495, 4496, 4528, 4461, 4460, 4429, 4429, 4430, 4461, 4462, 4461, 4430, 4460, 4459, 4427, 4427, 4429, 4460, 4459, 4460, 4495, 4429, 4427, 4392, 4392, 4393, 4429, 4430, 4429, 4393, 4393, 4394, 4430, 4393, 4392, 4358, 4358, 4359, 4393, 4394, 4393, 4359, 4392, 4391, 4357, 4357, 4358, 4392, 4428, 4392, 4427, 4358, 4357, 4302, 4302, 4304, 4358, 4359, 4358, 4304, 4357, 4356, 4300, 4300, 4302, 4357, 4356, 4357, 4390, 4302, 4300, 4301, 4301, 4303, 4302, 4304, 4302, 4303, 4303, 4305, 4304, 4299, 4301, 4300, 4300, 4298, 4299, 4298, 4300, 4356, 4297, 4299, 4298, 4298, 4296, 4297, 4296, 4298, 4355, 4356, 4355, 4298, 4295, 4297, 4296, 4296, 4293, 4295, 4293, 4296, 4354, 4355, 4354, 4296, 4354, 4355, 4387, 4388, 4387, 4355, 4355, 4356, 4388, 4291, 4354, 4353, 4293, 4354, 4291, 4354, 4387, 4353, 4353, 4387, 4386, 4387, 4423, 4386, 4387, 4388, 4423, 4389, 4388, 4356, 4424, 4423, 4388, 4388, 4425, 4424, 4386, 4423, 4422, 4423, 4424, 4458, 4422, 4423, 4458, 4427, 4424, 4426, 4459, 4458, 4424, 4424, 4427, 4459, 4458, 4495, 4494, 4459, 4495, 4458, 4556, 4458, 4494, 4422, 4458, 4556, 4494, 4495, 4555, 4528, 4555, 4495, 4494, 4555, 4563, 4563, 4566, 4494, 4556, 4494, 4566, 4566, 4568, 4556, 4422, 4556, 4568, 4566, 4563, 4565, 4565, 4567, 4566, 4568, 4566, 4567, 4563, 4562, 4561, 4561, 4565, 4563, 4591, 4563, 4555, 4579, 4565, 4577, 4561, 4577, 4565, 4565, 4579, 4567, 4559, 4561, 4564, 4577, 4561, 4575, 4559, 4575, 4561, 4578, 4577, 4576, 4575, 4576, 4577, 4577, 4578, 4579, 4576, 4575, 3549, 3551, 3549, 4575, 4575, 4559, 3551, 4576, 3549, 4655, 4578, 4576, 4656, 4655, 4656, 4576, 4580, 4579, 4578, 4656, 4657, 4578, 4580, 4578, 4657, 4582, 4581, 4580, 4579, 4580, 4581, 4657, 4658, 4580, 4582, 4580, 4658, 4581, 4582, 4583, 4658, 4659, 4582, 4583, 4582, 4660, 4584, 4581, 4583, 4584, 4583, 4585, 4662, 4661, 4583, 4585, 4583, 4661, 4586, 4584, 4585, 4584, 4570, 4581, 4586, 4572, 4584, 4570, 4584, 4572, 4586, 4585, 4587, 4587, 4585, 4663, 4661, 4663, 4585, 4588, 4586, 4587, 4588, 4574, 4586, 4572, 4586, 4574, 4572, 4571, 4570, 4574, 4573, 4572, 4571, 4572, 4573, 4188, 4187, 4574, 4573, 4574, 4187, 4574, 4588, 4188, 4588, 4587, 4204, 4203, 4588, 4204, 4203, 4188, 4588, 4188, 4186, 4187, 4188, 4203, 4201, 4186, 4188, 4201, 4201, 4203, 4202, 4204, 4202, 4203, 4204, 4284, 4202, 4204, 4587, 4284, 4202, 4200, 4201, 4202, 4283, 4200, 4283, 4202, 4284, 4199, 4201, 4200, 4186, 4201, 4199, 4200, 4198, 4199, 4200, 4282, 4198, 4282, 4200, 4283, 4197, 4199, 4198, 4184, 4199, 4197, 4184, 4186, 4199, 4198, 4195, 4197, 4198, 4281, 4195, 4281, 4198, 4282, 4196, 4197, 4195, 4182, 4197, 4196, 4197, 4182, 4184, 4184, 4182, 4183, 4186, 4184, 4185, 4183, 4185, 4184, 4182, 4180, 4181, 4181, 4183, 4182, 4196, 4180, 4182, 4196, 4195, 4194, 4180, 4196, 4194, 4180, 4178, 4179, 4179, 4181, 4180, 4194, 4178, 4180, 4179, 4036, 4181, 4170, 4181, 4036, 4181, 4170, 4183, 4177, 4179, 4178, 4177, 4206, 4179, 4036, 4179, 4207, 4178, 4176, 4177, 4175, 4177, 4176, 4175, 4103, 4177, 4205, 4177, 4103, 4176, 4174, 4175, 4176, 4192, 4190, 4190, 4174, 4176, 4192, 4176, 4178, 4174, 3108, 4173, 4173, 4175, 4174, 3126, 3108, 4174, 4190, 3126, 4174, 4190, 4189, 3126, 4190, 4191, 4189, 4192, 4191, 4190, 3126, 4189, 3128, 3128, 4189, 3221, 4277, 3221, 4189, 4277, 4189, 4278, 4191, 4278, 4189, 4192, 4193, 4191, 4278, 4191, 4279, 4193, 4279, 4191, 4194, 4193, 4192, 4194, 4195, 4193, 4279, 4193, 4280, 4195, 4280, 4193, 4178, 4194, 4192, 4280, 4195, 4281, 3125, 3221, 3220, 3128, 3221, 3125, 3220, 3222, 3125, 3129, 3125, 3222, 3222, 3223, 3129, 3130, 3127, 3129, 3125, 3129, 3127, 3129, 3131, 3130, 3131, 3129, 3223, 3223, 3224, 3131, 3132, 3130, 3131, 3131, 3133, 3132, 3133, 3131, 3224, 3112, 3127, 3130, 3114, 3130, 3132, 3130, 3114, 3112, 3134, 3132, 3133, 3116, 3132, 3134, 3114, 3132, 3116, 3114, 3113, 3112, 3113, 3114, 3115, 3116, 3115, 3114, 3112, 3111, 3110, 3111, 3112, 3113, 3127, 3112, 3110, 3103, 3011, 3113, 3111, 3113, 3011, 3113, 3115, 3103, 2945, 3103, 3115, 3103, 2976, 3011, 3103, 2945, 2976, 3011, 2976, 3010, 3011, 3010, 3047, 3102, 3011, 3047, 3011, 3102, 3111, 2976, 2944, 2975, 2975, 3010, 2976, 2945, 2944, 2976, 3010, 2975, 3012, 3047, 3010, 3046, 3012, 3046, 3010, 2946, 2975, 2944, 2975, 2946, 2977, 3013, 3012, 2975, 2944, 2916, 2946, 2917, 2946, 2916, 2946, 2917, 2947, 2947, 2978, 2946, 2916, 2885, 2917, 2886, 2917, 2885, 2917, 2886, 2918, 2918, 2947, 2917, 2947, 2918, 2948, 2980, 2947, 2979, 2948, 2979, 2947, 2887, 2918, 2886, 2918, 2887, 2919, 2919, 2948, 2918, 2948, 2919, 2949, 2979, 2948, 2981, 2949, 2981, 2948, 2979, 3014, 3016, 3014, 2979, 3017, 2981, 3017, 2979, 2981, 2949, 2982, 3017, 2981, 3018, 2982, 3018, 2981, 3017, 3049, 3014, 3049, 3017, 3050, 3018, 3050, 3017, 3018, 2982, 3019, 3050, 3018, 3051, 3019, 3051, 3018, 2950, 2982, 2949, 2982, 2950, 2983, 2983, 3019, 2982, 2983, 2984, 3019, 3020, 3019, 2984, 3019, 3020, 3051, 3052, 3051, 3020, 3051, 3079, 3050, 3051, 3052, 3079, 2984, 2985, 3020, 3021, 3020, 2985, 3020, 3021, 3052, 2984, 2983, 2952, 2952, 2953, 2984, 2985, 2984, 2953, 2953, 2954, 2985, 2986, 2985, 2954, 2985, 2986, 3021, 3022, 3021, 2986, 3053, 3052, 3021, 3021, 3022, 3053, 2954, 2955, 2986, 2987, 2986, 2955, 2986, 2987, 3022, 2954, 2953, 2925, 2925, 2926, 2954, 2955, 2954, 2926, 2956, 2955, 2927, 2926, 2927, 2955, 2955, 2956, 2987, 2988, 2987, 2956, 3023, 3022, 2987, 2987, 2988, 3023, 2957, 2956, 2928, 2927, 2928, 2956, 2956, 2957, 2988, 2927, 2926, 2896, 2928, 2927, 2897, 2896, 2897, 2927, 2929, 2928, 2898, 2897, 2898, 2928, 2928, 2929, 2957, 2958, 2957, 2929, 2989, 2988, 2957, 2957, 2958, 2989, 2930, 2929, 2899, 2898, 2899, 2929, 2929, 2930, 2958, 2898, 2897, 2850, 2899, 2898, 2850, 2897, 2896, 2849, 2849, 2850, 2897, 2848, 2851, 2850, 2850, 2849, 2848, 2853, 2850, 2852, 2851, 2852, 2850, 2899, 2850, 2853, 2849, 2846, 2848, 2846, 2849, 2896, 2847, 2848, 2846, 2844, 2847, 2846, 2845, 2844, 2846, 2896, 2895, 2846, 2845, 2846, 2895, 2895, 2896, 2926, 2895, 2894, 2845, 2926, 2925, 2895, 2894, 2895, 2925, 2845, 2843, 2844, 2843, 2845, 2894, 2842, 2844, 2843, 2843, 2841, 2842, 2894, 2893, 2843, 2841, 2843, 2893, 2893, 2894, 2924, 2925, 2924, 2894, 2924, 2925, 2953, 2924, 2923, 2893, 2923, 2924, 2952, 2953, 2952, 2924, 2893, 2892, 2841, 2892, 2893, 2923, 2923, 2922, 2892, 2922, 2923, 2951, 2952, 2951, 2923, 2951, 2952, 2983, 2950, 2921, 2951, 2922, 2951, 2921, 2951, 2983, 2950, 2921, 2890, 2922, 2891, 2922, 2890, 2891, 2892, 2922, 2892, 2891, 2839, 2839, 2841, 2892, 2890, 2834, 2891, 2836, 2891, 2834, 2836, 2839, 2891, 2889, 2832, 2890, 2834, 2890, 2832, 2890, 2921, 2889, 2832, 2833, 2834, 2835, 2834, 2833, 2834, 2835, 2836, 2837, 2836, 2835, 2837, 2838, 2836, 2839, 2836, 2838, 2838, 2840, 2839, 2841, 2839, 2840, 2840, 2842, 2841, 2833, 2832, 2831, 2830, 2831, 2832, 2832, 2889, 2830, 2831, 2830, 2829, 2828, 2829, 2830, 2830, 2888, 2828, 2888, 2830, 2889, 2829, 2828, 2827, 2826, 2827, 2828, 2828, 2887, 2826, 2887, 2828, 2888, 2888, 2919, 2887, 2919, 2888, 2920, 2889, 2920, 2888, 2920, 2889, 2921, 2920, 2949, 2919, 2949, 2920, 2950, 2921, 2950, 2920, 2886, 2826, 2887, 2885, 2825, 2886, 2826, 2886, 2825, 2825, 2885, 2822, 2825, 2822, 2824, 2824, 2826, 2825, 2823, 2824, 2822, 2827, 2826, 2824, 2855, 2853, 2854, 2852, 2854, 2853, 2900, 2853, 2855, 2900, 2899, 2853, 2854, 2856, 2855, 2857, 2855, 2856, 2859, 2856, 2858, 2859, 2857, 2856, 2857, 2901, 2855, 2902, 2901, 2857, 2859, 2902, 2857, 2858, 2860, 2859, 2859, 2903, 2902, 2860, 2903, 2859, 2861, 2860, 2858, 2861, 2862, 2860, 2860, 2904, 2903, 2862, 2904, 2860, 2903, 2934, 2902, 2903, 2935, 2934, 2904, 2935, 2903, 2902, 2933, 2901, 2902, 2934, 2933, 2934, 2963, 2933, 2934, 2964, 2963, 2935, 2964, 2934, 2904, 2936, 2935, 2935, 2965, 2964, 2936, 2965, 2935, 2862, 2905, 2904, 2905, 2936, 2904, 2905, 2937, 2936, 2936, 2966, 2965, 2937, 2966, 2936, 2965, 2999, 2964, 2965, 3000, 2999, 2966, 3000, 2965, 2964, 2998, 2963, 2964, 2999, 2998, 2999, 3038, 2998, 2999, 3039, 3038, 3000, 3039, 2999, 2966, 3001, 3000, 3000, 3040, 3039, 3001, 3040, 3000, 2937, 2967, 2966, 2967, 3001, 2966, 2967, 2968, 3001, 3002, 3001, 2968, 3001, 3002, 3040, 3041, 3040, 3002, 3040, 3068, 3039, 3040, 3041, 3068, 3039, 3067, 3038, 3039, 3068, 3067, 3069, 3068, 3041, 3068, 3095, 3067, 3068, 3069, 3095, 3002, 3005, 3041, 3042, 3041, 3005, 3041, 3042, 3069, 2968, 3003, 3002, 3005, 3002, 3004, 3006, 2972, 3005, 3007, 3005, 2972, 3005, 3007, 3042, 3043, 3042, 3007, 3070, 3069, 3042, 3042, 3043, 3070, 2972, 2973, 3007, 3008, 3007, 2973, 3007, 3008, 3043, 2972, 2971, 2941, 2941, 2942, 2972, 2973, 2972, 2942, 2942, 2943, 2973, 2974, 2973, 2943, 2973, 2974, 3008, 3009, 3008, 2974, 3044, 3043, 3008, 3008, 3009, 3044, 3045, 3044, 3009, 3043, 3044, 3071, 3072, 3071, 3044, 3044, 3045, 3072, 3073, 3072, 3045, 3071, 3072, 3098, 3099, 3098, 3072, 3072, 3073, 3099, 3071, 3070, 3043, 3070, 3071, 3097, 3098, 3097, 3071, 3098, 4163, 3097, 3099, 4164, 3098, 4163, 3098, 4164, 3100, 3099, 3073, 3100, 4165, 3099, 4164, 3099, 4165, 4164, 4135, 4163, 4165, 4136, 4164, 4135, 4164, 4136, 4163, 4134, 4162, 4134, 4163, 4135, 4162, 3097, 4163, 4135, 4099, 4134, 4136, 4100, 4135, 4099, 4135, 4100, 4134, 4098, 4133, 4098, 4134, 4099, 4133, 4162, 4134, 4162, 4133, 4161, 3097, 4162, 3096, 4161, 3096, 4162, 4133, 4097, 4132, 4097, 4133, 4098, 4132, 4161, 4133, 4161, 4132, 4160, 3096, 4161, 3095, 4160, 3095, 4161, 3096, 3095, 3069, 3069, 3070, 3096, 3097, 3096, 3070, 3067, 3095, 3094, 3095, 4159, 3094, 3095, 4160, 4159, 3038, 3067, 3066, 3067, 3094, 3066, 3066, 3094, 3093, 3094, 4158, 3093, 3094, 4159, 4158, 4159, 4129, 4158, 4159, 4130, 4129, 4160, 4130, 4159, 4158, 4128, 4157, 4158, 4129, 4128, 3093, 4158, 4157, 4129, 4092, 4128, 4129, 4093, 4092, 4130, 4093, 4129, 4130, 4094, 4093, 4131, 4094, 4130, 4160, 4131, 4130, 4131, 4160, 4132, 4131, 4095, 4094, 4132, 4096, 4131, 4095, 4131, 4096, 4094, 4058, 4093, 4094, 4059, 4058, 4095, 4059, 4094, 4093, 4057, 4092, 4093, 4058, 4057, 4058, 4025, 4057, 4058, 4027, 4025, 4059, 4027, 4058, 4059, 4028, 4027, 4060, 4028, 4059, 4095, 4060, 4059, 4027, 3992, 4025, 4027, 3993, 3992, 4028, 3993, 4027, 4025, 4024, 4022, 4025, 3992, 4026, 4057, 4025, 4022, 3992, 3946, 3991, 3992, 3948, 3946, 3993, 3948, 3992, 3946, 3944, 3945, 3946, 3947, 3944, 3948, 3947, 3946, 3990, 3946, 3945, 3948, 3949, 3947, 3950, 3949, 3948, 3993, 3950, 3948, 3950, 3951, 3949, 3952, 3951, 3950, 3994, 3950, 3993, 3994, 3952, 3950, 4028, 3994, 3993, 3995, 3952, 3994, 4029, 3994, 4028, 4029, 3995, 3994, 3952, 3953, 3951, 3954, 3953, 3952, 3995, 3954, 3952, 3996, 3957, 3995, 3954, 3995, 3957, 3995, 4029, 3996, 4030, 3996, 4029, 4060, 4029, 4028, 4029, 4060, 4030, 3997, 3959, 3996, 3957, 3996, 3959, 3996, 4030, 3997, 3957, 3956, 3954, 3959, 3958, 3957, 3956, 3957, 3958, 3961, 3960, 3959, 3958, 3959, 3960, 3959, 3997, 3961, 3998, 3961, 3997, 4031, 3997, 4030, 3997, 4031, 3998, 3963, 3962, 3961, 3960, 3961, 3962, 3961, 3998, 3963, 3999, 3963, 3998, 4032, 3998, 4031, 3998, 4032, 3999, 4062, 4031, 4061, 4030, 4061, 4031, 4031, 4062, 4032, 4033, 3999, 4032, 4063, 4032, 4062, 4032, 4063, 4033, 4097, 4062, 4096, 4061, 4096, 4062, 4062, 4097, 4063, 4061, 4030, 4060, 4096, 4061, 4095, 4060, 4095, 4061, 4096, 4132, 4097, 4098, 4063, 4097, 4064, 4033, 4063, 4063, 4098, 4064, 4099, 4064, 4098, 4065, 4034, 4064, 4033, 4064, 4034, 4064, 4099, 4065, 4100, 4065, 4099, 4034, 4000, 4033, 4000, 3964, 3999, 3999, 4033, 4000, 3962, 3963, 3964, 3965, 3962, 3964, 3963, 3999, 3964, 3955, 3954, 3956, 3954, 3955, 3953, 3942, 3945, 3944, 3943, 3945, 3942, 3943, 3988, 3945, 3989, 3945, 3988, 3940, 3941, 3942, 3943, 3942, 3941, 3941, 3987, 3943, 3988, 3943, 3987, 4021, 3988, 3987, 4022, 3988, 4021, 4022, 4023, 3988, 3987, 3941, 3986, 3986, 4020, 3987, 4021, 3987, 4020, 3941, 3940, 3939, 3939, 3986, 3941, 3938, 3939, 3940, 3939, 3938, 3936, 3939, 3936, 3985, 3986, 3939, 3985, 3985, 4019, 3986, 4020, 3986, 4019, 4019, 4052, 4020, 4053, 4020, 4052, 4054, 4021, 4020, 4019, 3985, 4018, 4018, 4051, 4019, 4052, 4019, 4051, 4086, 4052, 4051, 4087, 4052, 4086, 4087, 4088, 4052, 4051, 4018, 4050, 4050, 4085, 4051, 4086, 4051, 4085, 4125, 4086, 4085, 4126, 4086, 4125, 4126, 4087, 4086, 4090, 4089, 4087, 4127, 4087, 4126, 4127, 4090, 4087, 4155, 4126, 4125, 4156, 4126, 4155, 4156, 4127, 4126, 4128, 4090, 4127, 4157, 4127, 4156, 4157, 4128, 4127, 3091, 4156, 4155, 3092, 4156, 3091, 3092, 4157, 4156, 4155, 4125, 4154, 3090, 4155, 4154, 3091, 4155, 3090, 3063, 3091, 3090, 3064, 3091, 3063, 3064, 3092, 3091, 3065, 3092, 3064, 3065, 3093, 3092, 3093, 4157, 3092, 3035, 3064, 3063, 3036, 3064, 3035, 3036, 3065, 3064, 3034, 3063, 3062, 3035, 3063, 3034, 3063, 3090, 3062, 2995, 3035, 3034, 2996, 3035, 2995, 2996, 3036, 3035, 2997, 3036, 2996, 2997, 3037, 3036, 3037, 3065, 3036, 2961, 2996, 2995, 2962, 2996, 2961, 2962, 2997, 2996, 2960, 2995, 2994, 2961, 2995, 2960, 2995, 3034, 2994, 2961, 2960, 2931, 2932, 2961, 2931, 2932, 2962, 2961, 2933, 2962, 2932, 2933, 2963, 2962, 2963, 2997, 2962, 2932, 2931, 2900, 2901, 2932, 2900, 2901, 2933, 2932, 2931, 2930, 2899, 2900, 2931, 2899, 2931, 2960, 2930, 2901, 2900, 2855, 2959, 2958, 2930, 2960, 2959, 2930, 2992, 2991, 2959, 2958, 2959, 2993, 2994, 2992, 2959, 2960, 2994, 2959, 2990, 2989, 2958, 2988, 2989, 3024, 3025, 3024, 2989, 2989, 3028, 3025, 3024, 3023, 2988, 3023, 3024, 3055, 3056, 3055, 3024, 3024, 3025, 3056, 3027, 3025, 3026, 3057, 3056, 3025, 3025, 3058, 3057, 3055, 3056, 3083, 3084, 3083, 3056, 3056, 3057, 3084, 3059, 3057, 3027, 3085, 3084, 3057, 3057, 3059, 3085, 3084, 4149, 3083, 4149, 3084, 4150, 3085, 4150, 3084, 3083, 3082, 3055, 3083, 4148, 3082, 4148, 3083, 4149, 4149, 4117, 4148, 4117, 4149, 4118, 4150, 4118, 4149, 4118, 4150, 4121, 4151, 4121, 4150, 4150, 3085, 4151, 4118, 4080, 4117, 4080, 4118, 4119, 4121, 4120, 4118, 4122, 4121, 4084, 4123, 4084, 4121, 4121, 4151, 4123, 4084, 4050, 4083, 4085, 4050, 4084, 4124, 4084, 4123, 4124, 4085, 4084, 4152, 4123, 4151, 4153, 4123, 4152, 4153, 4124, 4123, 4125, 4085, 4124, 4154, 4124, 4153, 4154, 4125, 4124, 3088, 4153, 4152, 3089, 4153, 3088, 3089, 4154, 4153, 4151, 3086, 4152, 3087, 4152, 3086, 3088, 4152, 3087, 3060, 3088, 3087, 3061, 3088, 3060, 3061, 3089, 3088, 3062, 3089, 3061, 3062, 3090, 3089, 3090, 4154, 3089, 3030, 3061, 3060, 3033, 3061, 3030, 3033, 3062, 3061, 3060, 3059, 3030, 3059, 3060, 3086, 3087, 3086, 3060, 3030, 3029, 2992, 2992, 3033, 3030, 3031, 3030, 3059, 2994, 3033, 2992, 2994, 3034, 3033, 3034, 3062, 3033, 3032, 2992, 3031, 3086, 3085, 3059, 3086, 4151, 3085, 4050, 4018, 4049, 4049, 4082, 4050, 4018, 3985, 4017, 4017, 4049, 4018, 4049, 4017, 4048, 4048, 4080, 4049, 4081, 4049, 4080, 4017, 3984, 4016, 3984, 4017, 3985, 4016, 4048, 4017, 3984, 3985, 3936, 3984, 3936, 3983, 3983, 4016, 3984, 4016, 3983, 4015, 4015, 4047, 4016, 4048, 4016, 4047, 3983, 3935, 3982, 3935, 3983, 3936, 3982, 4015, 3983, 3937, 3934, 3936, 3935, 3936, 3934, 3937, 3936, 3938, 3935, 3934, 3933, 3933, 3982, 3935, 3982, 3933, 3981, 3981, 4014, 3982, 4015, 3982, 4014, 3933, 3932, 3931, 3932, 3933, 3934, 3931, 3981, 3933, 3981, 3931, 3980, 3980, 4013, 3981, 4014, 3981, 4013, 4013, 4045, 4014, 4046, 4014, 4045, 4014, 4046, 4015, 4013, 3980, 4012, 4012, 4044, 4013, 4045, 4013, 4044, 4044, 4076, 4045, 4077, 4045, 4076, 4045, 4077, 4046, 4047, 4015, 4046, 4078, 4046, 4077, 4046, 4078, 4047, 4076, 4114, 4077, 4115, 4077, 4114, 4077, 4115, 4078, 4076, 4044, 4075, 4075, 4113, 4076, 4114, 4076, 4113, 4113, 4145, 4114, 4146, 4114, 4145, 4114, 4146, 4115, 4116, 4078, 4115, 4147, 4115, 4146, 4115, 4147, 4116, 4145, 3080, 4146, 3081, 4146, 3080, 4146, 3081, 4147, 4145, 4113, 4144, 4144, 3079, 4145, 3080, 4145, 3079, 3080, 3079, 3052, 3052, 3053, 3080, 3081, 3080, 3053, 3053, 3054, 3081, 3082, 3081, 3054, 3082, 4147, 3081, 3054, 3053, 3022, 3022, 3023, 3054, 3055, 3054, 3023, 3054, 3055, 3082, 4147, 3082, 4148, 4148, 4116, 4147, 4116, 4148, 4117, 4078, 4116, 4079, 4117, 4079, 4116, 4079, 4117, 4080, 4079, 4047, 4078, 4047, 4079, 4048, 4080, 4048, 4079, 3078, 3050, 3079, 4143, 3079, 4144, 3078, 3079, 4143, 3050, 3078, 3049, 3077, 3049, 3078, 4142, 3078, 4143, 3077, 3078, 4142, 4110, 4143, 4111, 4142, 4143, 4110, 4143, 4144, 4111, 4111, 4144, 4112, 4112, 4144, 4113, 4072, 4111, 4073, 4110, 4111, 4072, 4111, 4112, 4073, 4070, 4110, 4072, 4107, 4110, 4070, 4107, 4142, 4110, 4039, 4072, 4040, 4070, 4072, 4039, 4072, 4073, 4040, 4040, 4073, 4041, 4073, 4074, 4041, 4073, 4112, 4074, 4007, 4040, 4008, 4039, 4040, 4007, 4040, 4041, 4008, 4006, 4039, 4007, 4038, 4039, 4006, 4038, 4070, 4039, 3973, 4007, 3974, 4006, 4007, 3973, 4007, 4008, 3974, 3974, 4008, 3975, 4008, 4009, 3975, 4008, 4041, 4009, 3915, 3974, 3917, 3973, 3974, 3915, 3974, 3975, 3917, 3913, 3973, 3915, 3972, 3973, 3913, 3972, 4006, 3973, 3912, 3915, 3914, 3913, 3915, 3912, 3915, 3917, 3914, 3914, 3917, 3916, 3917, 3919, 3916, 3917, 3975, 3919, 3916, 3919, 3918, 3919, 3921, 3918, 3919, 3976, 3921, 3975, 3976, 3919, 3918, 3921, 3920, 3921, 3923, 3920, 3921, 3977, 3923, 3976, 3977, 3921, 3975, 4009, 3976, 3976, 4010, 3977, 4009, 4010, 3976, 3923, 3977, 3925, 3978, 3925, 3977, 3977, 4010, 3978, 3920, 3923, 3922, 3922, 3923, 3924, 3925, 3924, 3923, 3924, 3925, 3926, 3927, 3926, 3925, 3925, 3978, 3927, 3979, 3927, 3978, 4011, 3978, 4010, 3978, 4011, 3979, 3926, 3927, 3928, 3929, 3928, 3927, 3927, 3979, 3929, 3980, 3929, 3979, 4012, 3979, 4011, 3979, 4012, 3980, 4010, 4042, 4011, 4043, 4011, 4042, 4011, 4043, 4012, 4044, 4012, 4043, 4042, 4074, 4043, 4075, 4043, 4074, 4043, 4075, 4044, 4009, 4042, 4010, 4041, 4042, 4009, 4041, 4074, 4042, 4074, 4112, 4075, 4113, 4075, 4112, 3929, 3980, 3931, 3928, 3929, 3930, 3931, 3930, 3929, 3930, 3931, 3932, 3913, 3912, 3911, 3910, 3911, 3912, 3911, 3972, 3913, 3911, 3910, 3909, 3909, 3971, 3911, 3971, 3972, 3911, 3908, 3909, 3910, 3909, 3908, 3906, 3907, 3909, 3906, 3907, 3970, 3909, 3970, 3971, 3909, 3970, 4004, 3971, 3971, 4005, 3972, 4004, 4005, 3971, 4005, 4006, 3972, 4004, 4037, 4005, 4005, 4038, 4006, 4037, 4038, 4005, 4003, 4004, 3970, 4003, 4035, 4004, 4035, 4037, 4004, 3969, 3970, 3907, 3969, 4003, 3970, 4002, 4003, 3969, 4036, 4035, 4003, 4036, 4003, 4170, 4002, 4170, 4003, 4035, 4066, 4037, 4067, 4066, 4035, 4036, 4067, 4035, 4067, 4036, 4169, 4067, 4101, 4066, 4103, 4102, 4067, 4067, 4168, 4103, 4103, 4140, 4167, 4166, 4140, 4103, 4103, 4175, 4166, 3101, 4140, 4166, 4166, 4173, 3101, 4173, 4166, 4175, 3109, 4173, 3108, 3109, 3101, 4173, 3109, 3108, 3107, 3109, 3107, 3101, 3110, 3107, 3108, 3126, 3110, 3108, 3107, 3110, 3111, 3102, 3101, 3107, 3107, 3111, 3102, 3110, 3126, 3127, 3127, 3126, 3125, 3128, 3125, 3126, 3102, 3047, 3101, 3075, 3047, 3074, 3046, 3074, 3047, 3101, 3047, 3075, 3101, 3075, 4140, 3075, 3074, 4140, 3074, 3046, 3076, 4140, 3074, 4137, 3074, 3076, 4137, 3046, 3012, 3048, 3048, 3076, 3046, 3076, 3048, 3077, 4137, 3076, 4141, 3076, 3077, 4141, 4138, 4137, 4105, 4140, 4137, 4139, 4137, 4141, 4105, 4105, 4141, 4107, 4141, 4142, 4107, 4141, 3077, 4142, 3049, 3077, 3048, 3048, 3014, 3049, 3014, 3048, 3012, 3012, 3015, 3014, 4108, 4107, 4070, 4105, 4107, 4109, 4071, 4070, 4038, 4037, 4068, 4038, 4066, 4069, 4037, 4066, 4105, 4104, 4106, 4105, 4066, 4002, 4001, 4170, 4001, 4183, 4170, 4002, 3969, 4001, 3968, 4001, 3969, 4001, 3968, 4171, 4001, 4171, 4183, 4185, 4183, 4171, 3967, 4171, 3968, 4172, 4171, 3967, 4171, 4172, 4185, 3968, 3905, 3967, 3905, 3968, 3907, 3969, 3907, 3968, 3967, 3901, 3966, 3901, 3967, 3905, 3966, 4172, 3967, 4187, 4185, 4172, 4172, 3966, 4558, 4172, 4558, 4187, 4185, 4187, 4186, 4573, 4187, 4558, 4350, 4351, 4558, 4384, 4558, 4351, 4350, 4558, 3966, 4558, 4384, 4573, 3903, 3966, 3901, 4350, 3966, 3903, 4286, 4350, 3903, 4286, 4351, 4350, 4287, 4351, 4286, 4287, 4352, 4351, 4351, 4385, 4384, 4352, 4385, 4351, 4384, 4385, 4557, 4384, 4557, 4571, 4571, 4573, 4384, 4352, 4386, 4385, 4385, 4386, 4557, 4289, 4352, 4287, 4289, 4353, 4352, 4353, 4386, 4352, 4422, 4557, 4386, 4557, 4422, 4569, 4569, 4571, 4557, 4569, 4570, 4571, 4570, 4569, 4567, 4568, 4567, 4569, 4568, 4569, 4422, 4567, 4581, 4570, 4581, 4567, 4579, 4291, 4353, 4289, 4290, 4291, 4289, 4292, 4291, 4290, 4292, 4293, 4291, 4290, 4289, 4288, 4288, 4289, 4287, 4288, 4287, 4285, 4285, 4287, 4286, 4286, 3902, 4285, 4286, 3903, 3902, 3902, 3901, 3900, 3903, 3901, 3902, 3900, 3901, 3904, 3905, 3904, 3901, 3904, 3905, 3906, 3907, 3906, 3905, 4294, 4293, 4292, 4294, 4295, 4293, 2963, 2998, 2997, 2998, 3037, 2997, 2998, 3038, 3037, 3037, 3066, 3065, 3038, 3066, 3037, 3066, 3093, 3065, 4128, 4092, 4090, 4092, 4056, 4090, 4092, 4057, 4056, 4090, 4056, 4091, 4056, 4021, 4055, 4056, 4022, 4021, 4057, 4022, 4056, 2943, 2942, 2912, 2942, 2941, 2911, 2911, 2912, 2942, 2912, 2911, 2879, 2911, 2910, 2877, 2877, 2879, 2911, 2910, 2911, 2941, 2941, 2940, 2910, 2940, 2941, 2970, 2910, 2909, 2875, 2875, 2877, 2910, 2909, 2910, 2940, 2877, 2875, 2876, 2876, 2878, 2877, 2879, 2877, 2878, 2875, 2873, 2874, 2874, 2876, 2875, 2873, 2875, 2909, 2909, 2908, 2873, 2908, 2909, 2939, 2940, 2939, 2909, 2873, 2871, 2872, 2872, 2874, 2873, 2871, 2873, 2908, 2908, 2907, 2871, 2907, 2908, 2938, 2939, 2938, 2908, 2938, 2939, 2967, 2968, 2967, 2939, 2939, 2940, 2968, 2906, 2938, 2937, 2907, 2938, 2906, 2938, 2967, 2937, 2864, 2906, 2905, 2866, 2906, 2864, 2866, 2907, 2906, 2906, 2937, 2905, 2863, 2864, 2862, 2865, 2864, 2863, 2865, 2866, 2864, 2864, 2905, 2862, 2867, 2866, 2865, 2867, 2868, 2866, 2868, 2907, 2866, 2869, 2868, 2867, 2869, 2870, 2868, 2871, 2868, 2870, 2868, 2871, 2907, 2870, 2872, 2871, 2863, 2862, 2861, 2969, 2968, 2940, 3116, 3134, 3118, 3134, 3133, 3135, 3135, 3118, 3134, 3136, 3135, 3133, 3136, 3133, 3225, 3224, 3226, 3133, 3135, 3136, 3137, 3138, 3137, 3136, 3225, 3227, 3136, 3138, 3136, 3227, 3227, 3228, 3138, 4663, 4664, 4587, 3636, 4655, 3549, 3636, 3549, 3635, 3551, 3550, 3549, 3552, 3549, 3550, 3552, 3635, 3549, 3635, 3552, 3637, 3550, 3553, 3552, 3554, 3552, 3553, 3554, 3637, 3552, 3550, 3551, 3533, 3533, 3537, 3550, 3553, 3550, 3537, 3535, 3533, 3551, 3535, 3551, 4559, 3535, 3534, 3533, 3536, 3533, 3534, 3537, 3533, 3536, 3535, 4559, 3534, 4560, 3534, 4559, 3534, 3524, 3536, 3534, 4589, 3524, 4528, 3524, 4555, 4528, 3497, 3524, 4555, 3524, 4590, 3553, 3555, 3554, 3556, 3554, 3555, 3555, 3557, 3556, 3556, 3638, 3554, 3637, 3554, 3638, 3558, 3556, 3557, 3638, 3556, 3639, 3558, 3639, 3556, 3558, 3557, 3559, 3639, 3558, 3640, 3559, 3640, 3558, 3640, 3559, 3641, 3561, 3641, 3559, 3641, 3561, 3642, 4318, 4317, 4319, 4320, 4319, 4317, 4319, 4367, 4318, 4319, 4320, 4321, 4367, 4319, 4368, 4321, 4368, 4319, 4322, 4321, 4320, 4321, 4322, 4323, 4368, 4321, 4369, 4323, 4369, 4321, 4368, 4405, 4367, 4405, 4368, 4406, 4369, 4406, 4368, 4404, 4367, 4405, 4405, 4444, 4404, 4444, 4405, 4445, 4406, 4445, 4405, 4324, 4323, 4322, 4323, 4324, 4325, 4326, 4325, 4324, 4326, 4327, 4325, 4338, 4337, 4339, 4340, 4339, 4337, 4338, 4339, 4378, 4342, 4341, 4339, 4343, 4339, 4341, 4379, 4378, 4339, 4339, 4343, 4379, 4416, 4415, 4378, 4378, 4379, 4416, 4380, 4379, 4343, 4417, 4416, 4379, 4379, 4380, 4417, 4343, 4341, 4344, 4343, 4344, 4380, 4345, 4344, 4341, 4344, 4345, 4346, 4381, 4380, 4344, 4381, 4344, 4382, 4344, 4346, 4382, 4347, 4346, 4345, 4346, 4347, 4348, 4382, 4346, 4383, 4346, 4348, 4383, 4381, 4382, 4420, 4382, 4383, 4421, 4420, 4382, 4421, 4380, 4381, 4419, 4419, 4381, 4420, 4419, 4420, 4456, 4420, 4421, 4457, 4456, 4420, 4457, 4418, 4380, 4419, 4418, 4419, 4455, 4455, 4419, 4456, 4455, 4456, 4491, 4456, 4457, 4493, 4491, 4456, 4493, 4454, 4418, 4455, 4454, 4455, 4489, 4492, 4455, 4491, 4525, 4491, 4524, 4491, 4493, 4527, 4524, 4491, 4527, 4522, 4526, 4524, 4522, 4524, 4553, 4524, 4527, 4554, 4553, 4524, 4554, 4488, 4523, 4522, 4521, 4488, 4522, 4521, 4522, 4552, 4552, 4522, 4553, 4552, 4553, 3522, 4553, 4554, 3523, 3522, 4553, 3523, 4551, 4521, 4552, 4551, 4552, 3521, 3521, 4552, 3522, 4521, 4520, 4488, 4520, 4521, 4550, 4551, 4550, 4521, 4550, 4551, 3519, 3520, 3519, 4551, 3520, 4551, 3521, 3494, 3493, 3521, 3520, 3521, 3493, 3521, 3522, 3494, 3520, 3493, 3519, 3519, 3492, 3518, 3492, 3519, 3493, 3519, 3518, 4550, 4550, 4549, 4520, 4549, 4550, 3518, 3518, 3491, 3517, 3491, 3518, 3492, 3518, 3517, 4549, 3492, 3459, 3491, 3459, 3492, 3460, 3493, 3460, 3492, 3493, 3494, 3460, 3460, 3428, 3459, 3460, 3461, 3428, 3461, 3460, 3494, 3459, 3427, 3458, 3427, 3459, 3428, 3458, 3491, 3459, 3491, 3458, 3490, 3490, 3517, 3491, 3458, 3426, 3457, 3426, 3458, 3427, 3457, 3490, 3458, 3427, 3395, 3426, 3395, 3427, 3396, 3428, 3396, 3427, 3426, 3394, 3425, 3394, 3426, 3395, 3425, 3457, 3426, 3457, 3425, 3456, 3456, 3489, 3457, 3490, 3457, 3489, 3425, 3393, 3424, 3393, 3425, 3394, 3424, 3456, 3425, 3394, 3361, 3393, 3361, 3394, 3362, 3395, 3362, 3394, 3393, 3360, 3392, 3360, 3393, 3361, 3392, 3424, 3393, 3424, 3392, 3423, 3423, 3455, 3424, 3456, 3424, 3455, 3392, 3359, 3391, 3359, 3392, 3360, 3391, 3423, 3392, 3360, 3324, 3359, 3324, 3360, 3325, 3361, 3325, 3360, 3359, 3323, 3358, 3323, 3359, 3324, 3358, 3391, 3359, 3391, 3358, 3390, 3390, 3422, 3391, 3423, 3391, 3422, 3358, 3322, 3356, 3322, 3358, 3323, 3356, 3390, 3358, 3323, 3279, 3322, 3279, 3323, 3281, 3324, 3281, 3323, 3322, 3277, 3321, 3277, 3322, 3279, 3357, 3356, 3322, 3356, 3355, 3353, 3353, 3389, 3356, 3390, 3356, 3389, 3353, 3318, 3352, 3318, 3353, 3354, 3352, 3388, 3353, 3389, 3353, 3388, 3388, 3420, 3389, 3421, 3389, 3420, 3389, 3421, 3390, 3351, 3388, 3352, 3387, 3388, 3351, 3387, 3420, 3388, 3419, 3420, 3387, 3350, 3387, 3351, 3386, 3387, 3350, 3386, 3419, 3387, 3315, 3351, 3316, 3350, 3351, 3315, 3351, 3352, 3316, 3314, 3350, 3315, 3349, 3350, 3314, 3349, 3386, 3350, 3265, 3315, 3267, 3314, 3315, 3265, 3315, 3316, 3267, 3267, 3316, 3269, 3316, 3317, 3269, 3316, 3352, 3317, 3317, 3352, 3318, 3269, 3317, 3271, 3271, 3317, 3273, 3318, 3273, 3317, 3266, 3269, 3268, 3267, 3269, 3266, 3269, 3271, 3268, 3264, 3267, 3266, 3265, 3267, 3264, 3263, 3265, 3264, 3263, 3261, 3262, 3262, 3265, 3263, 3260, 3262, 3261, 3260, 3313, 3262, 3262, 3314, 3265, 3313, 3314, 3262, 3313, 3349, 3314, 3268, 3271, 3270, 3270, 3271, 3272, 3273, 3272, 3271, 3272, 3273, 3274, 3275, 3274, 3273, 3273, 3318, 3275, 3274, 3275, 3276, 3277, 3276, 3275, 3319, 3275, 3318, 3275, 3320, 3277, 3276, 3277, 3278, 3279, 3278, 3277, 3278, 3279, 3280, 3281, 3280, 3279, 3280, 3281, 3284, 3283, 3282, 3281, 3281, 3324, 3283, 3286, 3285, 3283, 3325, 3283, 3324, 3283, 3325, 3286, 3326, 3286, 3325, 3325, 3361, 3326, 3286, 3326, 3290, 3327, 3290, 3326, 3362, 3326, 3361, 3326, 3362, 3327, 3290, 3289, 3286, 3289, 3290, 3291, 3290, 3327, 3291, 3328, 3291, 3327, 3363, 3327, 3362, 3328, 3327, 3364, 3363, 3364, 3327, 3362, 3395, 3363, 3396, 3363, 3395, 3364, 3363, 3397, 3396, 3397, 3363, 3364, 3365, 3328, 3365, 3364, 3398, 3397, 3398, 3364, 3291, 3328, 3329, 3329, 3328, 3365, 3365, 3366, 3329, 3366, 3365, 3399, 3398, 3399, 3365, 3398, 3397, 3431, 3399, 3398, 3433, 3431, 3433, 3398, 3397, 3396, 3429, 3432, 3431, 3397, 3431, 3464, 3463, 3433, 3431, 3466, 3463, 3466, 3431, 3461, 3463, 3465, 3463, 3461, 3495, 3466, 3463, 3496, 3495, 3496, 3463, 3462, 3428, 3461, 3494, 3495, 3461, 3495, 3494, 3522, 3496, 3495, 3523, 3522, 3523, 3495, 3428, 3430, 3396, 3330, 3329, 3366, 3295, 3293, 3330, 3293, 3329, 3330, 3293, 3291, 3329, 3292, 3291, 3293, 3294, 3292, 3293, 3294, 3293, 3295, 3296, 3294, 3295, 3291, 3292, 3289, 3288, 3286, 3289, 3286, 3288, 3287, 3422, 3390, 3421, 3422, 3453, 3423, 3455, 3423, 3454, 3455, 3488, 3456, 3489, 3456, 3488, 3488, 3515, 3489, 3516, 3489, 3515, 3489, 3516, 3490, 4546, 4547, 3515, 3516, 3515, 4547, 3517, 3490, 3516, 4547, 4548, 3516, 3517, 3516, 4548, 4547, 4546, 4517, 4517, 4518, 4547, 4548, 4547, 4518, 4518, 4519, 4548, 4549, 4548, 4519, 4548, 4549, 3517, 4518, 4517, 4485, 4485, 4486, 4518, 4519, 4518, 4486, 4484, 4485, 4517, 4485, 4484, 4451, 4486, 4485, 4452, 4451, 4452, 4485, 4487, 4486, 4453, 4452, 4453, 4486, 4486, 4487, 4519, 4452, 4451, 4416, 4453, 4452, 4417, 4416, 4417, 4452, 4415, 4416, 4451, 4418, 4417, 4380, 4417, 4418, 4453, 4454, 4453, 4418, 4453, 4454, 4487, 4488, 4487, 4454, 4488, 4454, 4490, 4487, 4488, 4520, 4520, 4519, 4487, 4519, 4520, 4549, 4349, 4348, 4347, 3304, 3245, 3303, 3303, 3339, 3304, 3245, 3244, 3243, 3244, 3245, 3246, 3243, 3303, 3245, 3303, 3243, 3302, 3336, 3303, 3335, 3302, 3335, 3303, 3243, 3242, 3241, 3242, 3243, 3244, 3241, 3302, 3243, 3302, 3241, 3301, 3335, 3302, 3334, 3301, 3334, 3302, 3369, 3335, 3368, 3334, 3368, 3335, 3335, 3369, 3372, 3334, 3300, 3333, 3334, 3301, 3300, 3368, 3334, 3333, 3368, 3400, 3369, 3371, 3370, 3369, 3401, 3369, 3400, 3369, 3401, 3371, 3435, 3401, 3400, 3333, 3299, 3332, 3333, 3300, 3299, 3300, 3234, 3299, 3234, 3235, 3233, 3236, 3235, 3234, 3300, 3236, 3234, 3236, 3237, 3235, 3238, 3237, 3236, 3301, 3236, 3300, 3301, 3238, 3236, 3238, 3239, 3237, 3241, 3240, 3238, 3239, 3238, 3240, 3238, 3301, 3241, 3240, 3241, 3242, 3145, 3144, 3143, 3146, 3143, 3144, 3143, 3146, 3147, 3145, 4208, 3144, 3144, 3163, 3146, 4209, 3144, 4208, 3144, 4209, 3163, 3148, 3147, 3146, 3164, 3146, 3163, 3146, 3164, 3165, 3147, 3150, 3149, 3152, 3149, 3151, 3149, 3152, 3153, 3154, 3153, 3152, 3168, 3167, 3152, 3169, 3152, 3167, 3152, 3169, 3154, 3153, 3154, 3155, 3156, 3155, 3154, 3170, 3154, 3169, 3154, 3170, 3156, 3167, 3177, 3169, 3178, 3169, 3177, 3169, 3178, 3170, 3171, 3156, 3170, 3179, 3170, 3178, 3170, 3180, 3171, 3179, 3180, 3170, 3178, 3177, 3187, 3179, 3178, 3188, 3187, 3188, 3178, 3179, 3189, 3180, 3188, 3189, 3179, 3171, 3180, 3181, 3180, 3189, 3190, 3190, 3181, 3180, 3198, 3189, 3188, 3189, 3198, 3199, 3190, 3189, 3199, 3188, 3187, 3197, 3188, 3197, 3198, 3198, 3197, 3207, 3198, 3207, 3208, 3199, 3198, 3208, 3190, 3199, 3200, 3199, 3208, 3209, 3200, 3199, 3209, 3181, 3190, 3191, 3191, 3190, 3200, 3191, 3200, 3201, 3200, 3209, 3210, 3201, 3200, 3210, 3209, 3208, 3218, 3210, 3209, 3219, 3218, 3219, 3209, 3208, 3207, 3217, 3217, 3218, 3208, 3216, 3217, 3207, 3207, 3206, 3216, 3215, 3216, 3206, 3197, 3196, 3206, 3205, 3206, 3196, 3197, 3206, 3207, 3206, 3205, 3215, 3214, 3215, 3205, 3196, 3195, 3205, 3204, 3205, 3195, 3205, 3204, 3214, 3187, 3186, 3196, 3195, 3196, 3186, 3196, 3197, 3187, 3186, 3184, 3195, 3193, 3195, 3184, 3195, 3193, 3204, 3202, 3204, 3193, 3204, 3202, 3213, 3213, 3214, 3204, 3184, 3185, 3193, 3194, 3193, 3185, 3193, 3194, 3202, 3176, 3175, 3184, 3185, 3184, 3175, 3184, 3186, 3176, 3175, 4245, 3185, 3185, 4253, 3194, 4245, 4253, 3185, 3203, 3202, 3194, 3194, 4261, 3203, 4253, 4261, 3194, 4253, 4245, 4254, 4261, 4253, 4262, 4254, 4262, 4253, 4237, 4245, 3175, 4245, 4237, 4246, 4246, 4254, 4245, 4254, 4246, 4255, 4262, 4254, 4263, 4255, 4263, 4254, 4262, 4270, 4261, 4270, 4262, 4271, 4263, 4271, 4262, 4263, 4255, 4264, 4271, 4263, 4272, 4264, 4272, 4263, 4247, 4255, 4246, 4255, 4247, 4256, 4256, 4264, 4255, 4264, 4256, 4265, 4272, 4264, 4273, 4265, 4273, 4264, 4248, 4256, 4247, 4256, 4248, 4257, 4257, 4265, 4256, 4246, 4238, 4247, 4239, 4247, 4238, 4247, 4239, 4248, 4240, 4248, 4239, 4248, 4240, 4249, 4249, 4257, 4248, 4257, 4249, 4258, 4265, 4257, 4266, 4258, 4266, 4257, 4241, 4249, 4240, 4249, 4241, 4250, 4250, 4258, 4249, 4240, 4239, 4232, 4240, 4232, 4241, 4239, 4238, 4231, 4231, 4232, 4239, 4232, 4231, 4217, 4217, 4219, 4232, 4233, 4232, 4219, 4233, 4241, 4232, 4241, 4233, 4242, 4242, 4250, 4241, 4234, 4233, 4221, 4219, 4221, 4233, 4234, 4242, 4233, 4219, 4217, 4218, 4218, 4220, 4219, 4221, 4219, 4220, 4220, 4222, 4221, 4223, 4221, 4222, 4234, 4221, 4235, 4223, 4235, 4221, 4242, 4234, 4243, 4235, 4243, 4234, 4223, 4225, 4235, 4236, 4235, 4225, 4243, 4235, 4244, 4236, 4244, 4235, 4222, 4224, 4223, 4225, 4223, 4224, 4224, 4609, 4225, 4608, 4225, 4609, 4225, 4608, 4236, 4608, 4619, 4236, 4236, 4619, 4244, 4244, 4252, 4243, 4619, 4626, 4244, 4244, 4626, 4252, 4605, 4618, 4619, 4608, 4605, 4619, 4626, 4619, 4618, 4607, 4605, 4608, 4609, 4607, 4608, 4605, 4604, 4602, 4607, 4606, 4605, 4618, 4605, 4602, 4618, 4602, 4617, 4625, 4618, 4617, 4618, 4625, 4626, 4602, 4601, 4600, 4602, 4603, 4601, 4617, 4602, 4600, 4617, 4600, 4616, 4624, 4617, 4616, 4625, 4617, 4624, 4632, 4625, 4624, 4625, 4632, 4633, 4626, 4625, 4633, 4624, 4616, 4623, 4631, 4624, 4623, 4624, 4631, 4632, 4639, 4632, 4631, 4632, 4639, 4640, 4633, 4632, 4640, 4626, 4633, 4252, 4633, 4640, 4260, 4252, 4633, 4260, 4640, 4639, 4647, 4640, 4647, 4268, 4260, 4640, 4268, 4631, 4638, 4639, 4639, 4638, 4646, 4639, 4646, 4647, 4647, 4646, 4654, 4268, 4647, 4276, 4654, 4276, 4647, 4267, 4259, 4268, 4260, 4268, 4259, 4268, 4276, 4267, 4275, 4267, 4276, 4266, 4258, 4267, 4259, 4267, 4258, 4267, 4275, 4266, 4258, 4250, 4259, 4251, 4259, 4250, 4259, 4251, 4260, 4250, 4242, 4251, 4243, 4251, 4242, 4251, 4243, 4252, 4252, 4260, 4251, 4266, 4274, 4265, 4274, 4266, 4275, 4273, 4265, 4274, 4653, 4654, 4646, 4646, 4645, 4653, 4652, 4653, 4645, 4638, 4645, 4646, 4637, 4644, 4645, 4638, 4637, 4645, 4645, 4644, 4652, 4651, 4652, 4644, 4644, 4636, 4643, 4644, 4637, 4636, 4644, 4650, 4651, 4643, 4650, 4644, 4637, 4629, 4636, 4637, 4630, 4629, 4630, 4637, 4638, 4638, 4631, 4630, 4630, 4622, 4629, 4630, 4623, 4622, 4623, 4630, 4631, 4629, 4621, 4628, 4629, 4622, 4621, 4636, 4629, 4628, 4622, 4612, 4621, 4622, 4615, 4612, 4623, 4615, 4622, 4623, 4616, 4615, 4615, 4597, 4612, 4615, 4598, 4597, 4616, 4598, 4615, 4613, 4612, 4597, 4611, 4612, 4614, 4611, 4621, 4612, 4597, 4594, 4596, 4598, 4594, 4597, 4598, 4599, 4594, 4600, 4599, 4598, 4616, 4600, 4598, 4592, 4595, 4594, 3573, 3571, 4592, 4593, 4592, 3571, 3573, 3572, 3571, 3574, 3571, 3572, 3572, 3575, 3574, 3576, 3574, 3575, 3574, 3588, 3571, 3589, 3588, 3574, 3576, 3589, 3574, 3575, 3577, 3576, 3578, 3577, 3575, 3576, 3590, 3589, 3577, 3590, 3576, 3589, 3597, 3588, 3589, 3598, 3597, 3590, 3598, 3589, 3577, 3591, 3590, 3590, 3599, 3598, 3591, 3599, 3590, 3578, 3579, 3577, 3579, 3591, 3577, 3580, 3579, 3578, 3579, 3580, 3581, 3591, 3579, 3592, 3581, 3592, 3579, 3591, 3600, 3599, 3592, 3600, 3591, 3599, 3607, 3598, 3599, 3608, 3607, 3600, 3608, 3599, 3600, 3592, 3601, 3608, 3600, 3609, 3601, 3609, 3600, 3592, 3581, 3593, 3593, 3601, 3592, 3601, 3593, 3602, 3609, 3601, 3610, 3602, 3610, 3601, 3609, 3617, 3608, 3617, 3609, 3618, 3610, 3618, 3609, 3608, 3616, 3607, 3616, 3608, 3617, 3617, 3625, 3616, 3625, 3617, 3626, 3618, 3626, 3617, 3618, 3610, 3201, 3626, 3618, 3210, 3201, 3210, 3618, 3610, 3602, 3192, 3192, 3201, 3610, 3192, 3191, 3201, 3182, 3191, 3192, 3183, 3182, 3192, 3183, 3192, 3602, 3182, 3181, 3191, 3172, 3181, 3182, 3182, 3173, 3172, 3173, 3182, 3183, 3174, 3173, 3183, 3602, 3594, 3183, 3174, 3183, 3594, 3594, 3602, 3593, 3593, 3583, 3594, 3585, 3594, 3583, 3594, 3585, 3174, 3174, 3162, 3173, 3585, 3162, 3174, 3583, 3584, 3585, 3586, 3585, 3584, 3585, 3586, 3162, 3581, 3582, 3583, 3584, 3583, 3582, 3583, 3593, 3581, 3582, 3581, 3580, 3162, 3161, 3160, 3160, 3173, 3162, 3586, 3161, 3162, 3159, 3160, 3161, 3160, 3159, 3158, 3173, 3160, 3158, 3158, 3172, 3173, 3158, 3157, 3156, 3157, 3158, 3159, 3156, 3171, 3158, 3172, 3158, 3171, 3181, 3172, 3171, 3155, 3156, 3157, 3210, 3219, 3626, 3634, 3626, 3219, 3626, 3634, 3625, 3633, 3625, 3634, 3624, 3616, 3625, 3625, 3633, 3624, 3632, 3624, 3633, 3623, 3615, 3624, 3616, 3624, 3615, 3624, 3632, 3623, 3615, 3607, 3616, 3606, 3615, 3614, 3607, 3615, 3606, 3615, 3623, 3614, 3598, 3607, 3606, 3597, 3606, 3605, 3598, 3606, 3597, 3606, 3614, 3605, 3605, 3614, 3613, 3613, 3614, 3621, 3622, 3621, 3614, 3622, 3614, 3623, 3595, 3605, 3603, 3597, 3605, 3595, 3613, 3603, 3605, 3597, 3595, 3588, 3595, 3587, 3588, 3595, 3596, 3587, 3603, 3596, 3595, 3603, 3604, 3596, 3611, 3604, 3603, 3603, 3613, 3611, 3596, 4620, 3587, 3596, 4627, 4620, 3604, 4627, 3596, 3588, 3587, 3571, 3587, 4611, 3571, 3587, 4620, 4611, 4620, 4621, 4611, 4628, 4621, 4620, 4627, 4628, 4620, 3604, 4634, 4627, 4635, 4628, 4627, 4634, 4635, 4627, 4636, 4628, 4635, 4642, 4635, 4641, 4634, 4641, 4635, 4635, 4642, 4636, 3612, 4634, 3604, 3612, 3619, 4634, 4641, 4634, 3619, 4641, 3627, 4648, 3619, 3627, 4641, 4641, 4648, 4642, 3612, 3611, 3619, 3620, 3619, 3611, 3620, 3627, 3619, 3611, 3612, 3604, 3611, 3613, 3620, 3621, 3620, 3613, 3620, 3628, 3627, 3621, 3628, 3620, 3621, 3629, 3628, 3629, 3621, 3622, 3622, 3630, 3629, 3630, 3622, 3623, 3623, 3631, 3630, 3631, 3623, 3632, 4643, 4636, 4642, 4642, 4648, 4649, 4642, 4649, 4643, 4643, 4649, 4650, 3571, 4611, 4610, 4600, 4601, 4599, 4216, 4218, 4217, 4213, 4216, 4215, 4217, 4215, 4216, 4215, 4217, 4231, 4215, 4214, 4213, 4230, 4215, 4229, 4231, 4229, 4215, 4210, 4213, 4212, 4208, 4210, 4209, 4211, 4209, 4210, 4226, 3163, 4209, 4209, 4227, 4226, 4229, 4226, 4228, 3163, 4226, 3175, 4237, 3175, 4226, 4226, 4229, 4237, 3163, 3175, 3164, 3176, 3164, 3175, 3167, 3166, 3164, 3164, 3176, 3167, 3177, 3167, 3176, 3177, 3176, 3186, 3186, 3187, 3177, 4238, 4237, 4229, 4238, 4246, 4237, 4229, 4231, 4238, 4269, 4261, 4270, 4261, 4269, 3203, 3212, 3203, 4269, 3202, 3203, 3211, 3212, 3211, 3203, 3211, 3213, 3202, 3646, 3645, 3644, 3647, 3644, 3645, 3644, 3647, 3739, 3646, 3644, 3835, 3836, 3835, 3644, 3644, 3739, 3836, 3645, 3646, 3648, 3649, 3648, 3646, 3648, 3649, 3650, 3651, 3650, 3649, 3649, 3646, 3837, 3651, 3649, 3838, 3837, 3838, 3649, 3650, 3651, 3654, 3653, 3652, 3651, 3839, 3653, 3651, 3838, 3839, 3651, 3656, 3655, 3653, 3652, 3653, 3657, 3840, 3656, 3653, 3839, 3840, 3653, 3655, 3656, 3658, 3841, 3658, 3656, 3840, 3841, 3656, 3658, 3660, 3659, 3660, 3658, 3661, 3658, 3841, 3661, 3842, 3661, 3841, 3661, 3663, 3662, 3665, 3664, 3661, 3663, 3661, 3666, 3661, 3842, 3665, 3843, 3665, 3842, 3664, 3665, 3667, 3669, 3668, 3665, 3844, 3669, 3665, 3843, 3844, 3665, 3668, 3669, 3670, 3672, 3671, 3669, 3845, 3672, 3669, 3844, 3845, 3669, 3672, 3675, 3671, 3672, 3845, 3675, 3846, 3675, 3845, 3675, 3674, 3673, 3674, 3675, 3676, 3678, 3677, 3675, 3847, 3678, 3675, 3846, 3847, 3675, 3678, 3679, 3677, 3848, 3679, 3678, 3847, 3848, 3678, 3681, 3680, 3679, 3681, 3679, 3682, 3684, 3683, 3679, 3679, 3848, 3684, 3849, 3684, 3848, 3684, 3685, 3683, 3850, 3685, 3684, 3849, 3850, 3684, 3687, 3686, 3685, 3687, 3685, 3688, 3690, 3689, 3685, 3851, 3690, 3685, 3850, 3851, 3685, 3692, 3691, 3690, 3689, 3690, 3693, 3690, 3851, 3692, 3852, 3692, 3851, 3695, 3694, 3692, 3691, 3692, 3696, 3695, 3692, 3853, 3852, 3853, 3692, 3698, 3697, 3695, 3694, 3695, 3699, 3854, 3698, 3695, 3853, 3854, 3695, 3698, 3700, 3697, 3698, 3854, 3855, 3855, 3700, 3698, 3702, 3701, 3700, 3702, 3700, 3703, 3700, 3855, 3703, 3856, 3703, 3855, 3705, 3704, 3703, 3705, 3703, 3706, 3703, 3856, 3857, 3857, 3706, 3703, 3708, 3707, 3706, 3710, 3709, 3706, 3708, 3706, 3711, 3706, 3857, 3710, 3858, 3710, 3857, 3713, 3712, 3710, 3709, 3710, 3714, 3710, 3858, 3713, 3859, 3713, 3858, 3716, 3715, 3713, 3712, 3713, 3717, 3713, 3859, 3860, 3860, 3716, 3713, 3719, 3718, 3716, 3715, 3716, 3720, 3716, 3860, 3861, 3861, 3719, 3716, 3718, 3719, 3721, 3719, 3861, 3721, 3862, 3721, 3861, 3721, 3723, 3722, 3723, 3721, 3724, 3721, 3862, 3724, 3863, 3724, 3862, 3724, 3726, 3725, 3726, 3724, 3727, 3724, 3863, 3727, 3864, 3727, 3863, 3727, 3729, 3728, 3729, 3727, 3730, 3732, 3731, 3727, 3727, 3864, 3865, 3865, 3732, 3727, 3731, 3732, 3733, 3735, 3734, 3732, 3732, 3865, 3866, 3866, 3735, 3732, 3734, 3735, 3736, 3738, 3737, 3735, 3735, 3866, 3867, 3867, 3738, 3735, 3835, 3837, 3646, 3868, 3836, 3739, 3868, 3739, 3869, 3740, 3739, 3647, 3739, 3740, 3741, 3741, 3869, 3739, 3741, 3745, 3869, 3870, 3869, 3745, 3743, 3741, 3742, 3745, 3741, 3744, 3743, 3746, 3741, 3748, 3745, 3747, 3744, 3749, 3745, 3745, 3748, 3870, 3871, 3870, 3748, 3751, 3748, 3750, 3747, 3752, 3748, 3748, 3751, 3871, 3872, 3871, 3751, 3751, 3750, 3754, 3751, 3754, 3872, 3873, 3872, 3754, 3755, 3754, 3753, 3754, 3755, 3757, 3754, 3757, 3873, 3874, 3873, 3757, 3758, 3757, 3756, 3757, 3758, 3760, 3757, 3760, 3874, 3875, 3874, 3760, 3761, 3760, 3759, 3761, 3762, 3760, 3764, 3760, 3763, 3760, 3764, 3875, 3876, 3875, 3764, 3763, 3765, 3764, 3767, 3764, 3766, 3764, 3767, 3876, 3877, 3876, 3767, 3767, 3766, 3769, 3767, 3769, 3877, 3878, 3877, 3769, 3770, 3769, 3768, 3769, 3770, 3772, 3769, 3772, 3878, 3879, 3878, 3772, 3773, 3772, 3771, 3772, 3773, 3775, 3772, 3775, 3879, 3880, 3879, 3775, 3776, 3775, 3774, 3775, 3776, 3778, 3880, 3775, 3881, 3778, 3881, 3775, 3779, 3778, 3777, 3778, 3779, 3780, 3778, 3780, 3881, 3780, 3882, 3881, 3782, 3780, 3781, 3780, 3782, 3783, 3780, 3783, 3882, 3783, 3883, 3882, 3785, 3783, 3784, 3787, 3786, 3783, 3783, 3785, 3788, 3883, 3783, 3884, 3786, 3884, 3783, 3786, 3787, 3791, 3790, 3789, 3786, 3884, 3786, 3885, 3789, 3885, 3786, 3789, 3790, 3792, 3789, 3792, 3885, 3792, 3886, 3885, 3794, 3792, 3793, 3792, 3794, 3795, 3792, 3795, 3886, 3795, 3887, 3886, 3797, 3795, 3796, 3795, 3797, 3798, 3887, 3795, 3888, 3798, 3888, 3795, 3800, 3798, 3799, 3802, 3801, 3798, 3800, 3803, 3798, 3798, 3801, 3888, 3801, 3889, 3888, 3805, 3804, 3801, 3802, 3806, 3801, 3801, 3804, 3889, 3804, 3890, 3889, 3804, 3805, 3807, 3890, 3804, 3891, 3807, 3891, 3804, 3809, 3807, 3808, 3811, 3807, 3810, 3809, 3812, 3807, 3891, 3807, 3892, 3811, 3892, 3807, 3814, 3811, 3813, 3810, 3815, 3811, 3811, 3814, 3892, 3814, 3893, 3892, 3813, 3816, 3814, 3818, 3814, 3817, 3893, 3814, 3894, 3818, 3894, 3814, 3820, 3819, 3818, 3822, 3818, 3821, 3894, 3818, 3895, 3822, 3895, 3818, 3822, 3821, 3824, 3822, 3824, 3895, 3824, 3896, 3895, 3825, 3824, 3823, 3825, 3826, 3824, 3828, 3824, 3827, 3896, 3824, 3828, 3828, 3897, 3896, 3828, 3827, 3830, 3897, 3828, 3830, 3830, 3898, 3897, 3831, 3830, 3829, 3830, 3831, 3833, 3898, 3830, 3899, 3833, 3899, 3830, 3834, 3833, 3832, 4667, 4666, 4665, 4669, 4665, 4668, 4768, 4767, 4665, 4667, 4665, 4769, 4863, 4665, 4669, 4864, 4665, 4863, 4864, 4768, 4665, 4668, 4670, 4669, 4672, 4669, 4671, 4865, 4669, 4672, 4863, 4669, 4865, 4671, 4673, 4672, 4675, 4672, 4674, 4866, 4672, 4675, 4865, 4672, 4866, 4674, 4676, 4675, 4678, 4675, 4677, 4866, 4675, 4867, 4678, 4867, 4675, 4677, 4679, 4678, 4681, 4678, 4680, 4867, 4678, 4868, 4681, 4868, 4678, 4681, 4680, 4682, 4681, 4682, 4868, 4869, 4868, 4682, 4684, 4682, 4683, 4684, 4685, 4682, 4682, 4685, 4869, 4870, 4869, 4685, 4687, 4685, 4686, 4687, 4688, 4685, 4690, 4685, 4689, 4685, 4690, 4870, 4871, 4870, 4690, 4689, 4691, 4690, 4693, 4690, 4692, 4871, 4690, 4872, 4693, 4872, 4690, 4692, 4694, 4693, 4696, 4693, 4695, 4693, 4696, 4872, 4873, 4872, 4696, 4695, 4697, 4696, 4873, 4696, 4874, 4697, 4874, 4696, 4697, 4699, 4698, 4698, 4700, 4697, 4702, 4697, 4701, 4697, 4702, 4874, 4875, 4874, 4702, 4701, 4703, 4702, 4875, 4702, 4876, 4703, 4876, 4702, 4703, 4705, 4704, 4707, 4703, 4706, 4704, 4708, 4703, 4876, 4703, 4877, 4707, 4877, 4703, 4712, 4707, 4706, 4707, 4878, 4877, 4879, 4877, 4878, 4880, 4715, 4879, 4881, 4879, 4715, 4715, 4714, 4713, 4719, 4715, 4718, 4713, 4720, 4715, 4881, 4715, 4882, 4719, 4882, 4715, 4722, 4719, 4721, 4718, 4723, 4719, 4882, 4719, 4883, 4722, 4883, 4719, 4725, 4722, 4724, 4721, 4726, 4722, 4722, 4725, 4883, 4884, 4883, 4725, 4725, 4724, 4728, 4725, 4885, 4884, 4728, 4885, 4725, 4729, 4728, 4727, 4728, 4729, 4730, 4728, 4886, 4885, 4730, 4886, 4728, 4732, 4730, 4731, 4730, 4732, 4733, 4886, 4730, 4887, 4733, 4887, 4730, 4735, 4733, 4734, 4735, 4736, 4733, 4738, 4733, 4737, 4733, 4888, 4887, 4738, 4888, 4733, 4737, 4739, 4738, 4741, 4738, 4740, 4738, 4889, 4888, 4741, 4889, 4738, 4740, 4742, 4741, 4744, 4741, 4743, 4741, 4890, 4889, 4744, 4890, 4741, 4743, 4745, 4744, 4747, 4744, 4746, 4744, 4891, 4890, 4747, 4891, 4744, 4747, 4746, 4748, 4747, 4892, 4891, 4748, 4892, 4747, 4750, 4748, 4749, 4750, 4751, 4748, 4748, 4893, 4892, 4751, 4893, 4748, 4753, 4751, 4752, 4753, 4754, 4751, 4751, 4754, 4893, 4894, 4893, 4754, 4756, 4754, 4755, 4756, 4757, 4754, 4759, 4754, 4758, 4754, 4895, 4894, 4896, 4895, 4754, 4758, 4761, 4760, 4761, 4763, 4762, 4762, 4764, 4761, 4761, 4897, 4898, 4761, 4899, 4897, 4764, 4899, 4761, 4764, 4766, 4765, 4898, 4897, 4895, 4768, 4770, 4767, 4900, 4768, 4864, 4900, 4901, 4768, 4770, 4768, 4901, 4772, 4771, 4770, 4770, 4773, 4772, 4901, 4773, 4770, 4902, 4773, 4901, 4775, 4774, 4773, 4773, 4776, 4775, 4777, 4776, 4773, 4902, 4777, 4773, 4903, 4777, 4902, 4777, 4778, 4776, 4903, 4778, 4777, 4904, 4778, 4903, 4780, 4779, 4778, 4778, 4781, 4780, 4783, 4782, 4778, 4904, 4905, 4778, 4783, 4778, 4905, 4783, 4784, 4782, 4783, 4786, 4785, 4905, 4906, 4783, 4786, 4783, 4906, 4786, 4787, 4785, 4786, 4789, 4788, 4906, 4789, 4786, 4907, 4789, 4906, 4789, 4790, 4788, 4907, 4790, 4789, 4908, 4790, 4907, 4792, 4791, 4790, 4794, 4790, 4793, 4790, 4795, 4792, 4908, 4793, 4790, 4909, 4793, 4908, 4793, 4796, 4794, 4909, 4796, 4793, 4910, 4796, 4909, 4798, 4797, 4796, 4796, 4799, 4798, 4910, 4911, 4796, 4799, 4796, 4911, 4801, 4800, 4799, 4799, 4802, 4801, 4911, 4802, 4799, 4912, 4802, 4911, 4804, 4803, 4802, 4802, 4805, 4804, 4912, 4805, 4802, 4805, 4912, 4913, 4807, 4806, 4805, 4805, 4808, 4807, 4913, 4808, 4805, 4808, 4913, 4914, 4810, 4809, 4808, 4808, 4811, 4810, 4811, 4808, 4915, 4914, 4915, 4808, 4813, 4812, 4811, 4811, 4814, 4813, 4915, 4814, 4811, 4814, 4915, 4916, 4816, 4815, 4814, 4818, 4817, 4814, 4816, 4814, 4819, 4916, 4818, 4814, 4818, 4916, 4917, 4821, 4820, 4818, 4817, 4818, 4822, 4821, 4818, 4918, 4917, 4918, 4818, 4824, 4823, 4821, 4820, 4821, 4825, 4918, 4824, 4821, 4824, 4918, 4919, 4824, 4826, 4823, 4919, 4826, 4824, 4826, 4919, 4920, 4828, 4827, 4826, 4830, 4829, 4826, 4828, 4826, 4831, 4830, 4826, 4921, 4920, 4921, 4826, 4833, 4832, 4830, 4829, 4830, 4834, 4921, 4833, 4830, 4833, 4921, 4922, 4832, 4833, 4835, 4837, 4836, 4833, 4837, 4833, 4923, 4922, 4923, 4833, 4837, 4838, 4836, 4840, 4839, 4837, 4923, 4840, 4837, 4840, 4923, 4924, 4840, 4841, 4839, 4843, 4842, 4840, 4924, 4843, 4840, 4843, 4924, 4925, 4843, 4844, 4842, 4846, 4845, 4843, 4925, 4846, 4843, 4846, 4925, 4926, 4846, 4847, 4845, 4846, 4849, 4848, 4849, 4846, 4927, 4926, 4927, 4846, 4849, 4851, 4850, 4927, 4851, 4849, 4851, 4927, 4928, 4853, 4852, 4851, 4851, 4854, 4853, 4851, 4856, 4855, 4851, 4928, 4856, 4929, 4856, 4928, 4856, 4857, 4855, 4856, 4929, 4857, 4857, 4929, 4930, 4859, 4858, 4857, 4857, 4860, 4859, 4860, 4857, 4931, 4930, 4931, 4857, 4862, 4861, 4860, 4711, 4710, 4709, 4709, 4717, 4716, 4934, 4933, 4932, 4935, 4934, 4932, 4936, 4935, 4932, 4937, 4936, 4932, 4938, 4937, 4932, 4939, 4938, 4932, 4940, 4939, 4932, 4933, 4940, 4932, 4935, 4945, 4934, 4946, 4945, 4935, 4935, 4936, 4946, 4945, 4944, 4934, 4945, 4961, 4944, 4945, 4962, 4961, 4946, 4962, 4945, 4947, 4946, 4936, 4962, 4946, 4963, 4947, 4963, 4946, 4961, 4962, 4981, 4982, 4981, 4962, 4983, 4982, 4962, 4962, 4963, 4983, 4963, 4947, 4964, 4984, 4983, 4963, 4985, 4984, 4963, 4963, 4964, 4985, 4948, 4947, 4936, 4948, 4964, 4947, 4949, 4948, 4937, 4936, 4937, 4948, 4948, 4949, 4964, 4950, 4949, 4937, 4965, 4964, 4949, 4966, 4965, 4949, 4950, 4966, 4949, 4937, 4951, 4950, 4938, 4951, 4937, 4950, 4951, 4966, 4952, 4951, 4938, 4967, 4966, 4951, 4967, 4951, 4968, 4952, 4968, 4951, 4938, 4939, 4952, 4953, 4952, 4939, 4968, 4952, 4969, 4953, 4969, 4952, 4954, 4953, 4939, 4939, 4940, 4954, 4953, 4954, 4969, 4955, 4954, 4940, 4970, 4969, 4954, 4954, 4955, 4970, 4956, 4955, 4940, 4956, 4940, 4941, 4933, 4941, 4940, 4971, 4970, 4955, 4955, 4972, 4971, 4956, 4972, 4955, 4969, 4970, 4998, 4999, 4998, 4970, 4970, 4971, 4999, 5000, 4999, 4971, 5001, 5000, 4971, 4971, 4972, 5004, 4998, 4999, 5035, 5036, 4999, 5000, 5036, 5035, 4999, 5037, 5036, 5000, 5038, 5037, 5000, 5077, 5076, 5036, 5035, 5036, 5076, 5036, 5037, 5077, 5035, 5033, 4998, 5076, 5074, 5035, 5033, 5035, 5074, 5145, 5074, 5076, 5146, 5145, 5076, 5147, 5076, 5077, 5147, 5146, 5076, 5074, 5071, 5033, 5071, 5074, 5143, 5144, 5143, 5074, 5145, 5144, 5074, 5235, 5144, 5145, 5237, 5145, 5146, 5235, 5145, 5237, 5238, 5146, 5147, 5237, 5146, 5238, 5237, 5236, 5235, 5236, 5237, 5238, 5233, 5234, 5235, 5233, 5235, 5236, 5234, 5144, 5235, 5234, 5143, 5144, 5234, 5233, 5232, 5232, 5143, 5234, 5230, 5232, 5233, 5230, 5231, 5232, 5232, 5142, 5143, 5231, 5142, 5232, 5227, 5229, 5230, 5231, 5230, 5229, 5231, 5229, 5142, 5142, 5140, 5071, 5142, 5071, 5143, 5140, 5142, 5229, 5227, 5228, 5229, 5229, 5228, 5140, 5228, 5227, 5226, 5224, 5226, 5227, 5228, 5226, 5139, 5139, 5140, 5228, 5140, 5139, 5071, 5139, 5136, 5138, 5141, 5071, 5139, 5136, 5139, 5226, 5224, 5225, 5226, 5226, 5225, 5136, 5225, 5224, 5223, 5221, 5223, 5224, 5225, 5223, 5134, 5134, 5136, 5225, 5136, 5134, 5135, 5134, 5133, 5069, 5069, 5137, 5134, 5133, 5134, 5223, 5221, 5222, 5223, 5223, 5222, 5133, 5222, 5221, 5220, 5219, 5220, 5221, 5222, 5220, 5132, 5132, 5133, 5222, 5133, 5132, 5069, 5132, 5131, 5068, 5068, 5069, 5132, 5131, 5132, 5220, 5219, 5218, 5220, 5220, 5263, 5131, 5219, 5215, 5218, 5217, 5218, 5215, 5129, 5218, 5217, 5218, 5129, 5130, 5130, 5131, 5218, 5131, 5130, 5068, 5130, 5129, 5067, 5067, 5068, 5130, 5068, 5067, 5029, 5068, 5029, 5069, 5067, 5066, 5028, 5028, 5029, 5067, 5066, 5067, 5128, 5129, 5128, 5067, 5217, 5128, 5129, 5128, 5127, 5066, 5216, 5127, 5128, 5128, 5217, 5216, 5126, 5065, 5127, 5127, 5065, 5066, 5214, 5126, 5127, 5127, 5216, 5214, 5216, 5215, 5214, 5215, 5216, 5217, 5212, 5213, 5214, 5212, 5214, 5215, 5126, 5214, 5213, 5126, 5125, 5065, 5213, 5125, 5126, 5213, 5212, 5211, 5125, 5213, 5211, 5209, 5211, 5212, 5209, 5210, 5211, 5124, 5211, 5210, 5211, 5124, 5125, 5125, 5124, 5065, 5124, 5123, 5064, 5064, 5065, 5124, 5210, 5123, 5124, 5210, 5209, 5206, 5208, 5210, 5206, 5123, 5210, 5208, 5123, 5063, 5064, 5123, 5122, 5063, 5208, 5122, 5123, 5064, 5063, 5025, 5025, 5026, 5064, 5065, 5064, 5026, 5026, 5066, 5065, 5026, 5025, 4990, 4991, 5026, 4990, 4991, 5027, 5026, 5027, 5066, 5026, 5025, 5024, 4990, 5024, 5025, 5063, 4990, 4989, 4966, 4991, 4990, 4966, 4989, 4990, 5024, 4991, 4966, 4992, 4992, 5027, 4991, 4992, 4993, 5027, 5028, 5027, 4993, 5027, 5028, 5066, 4967, 4992, 4966, 4993, 4992, 4967, 4965, 4966, 4989, 4989, 4988, 4965, 5024, 4988, 4989, 4988, 4987, 4965, 4964, 4965, 4987, 5023, 5022, 4988, 4987, 4988, 5022, 5024, 5023, 4988, 4987, 4986, 4964, 4986, 4987, 5022, 4986, 4985, 4964, 4986, 5021, 4985, 5021, 4986, 5022, 4985, 5020, 4984, 5020, 4985, 5021, 5021, 5060, 5020, 5021, 5022, 5060, 5019, 4984, 5020, 5020, 5058, 5019, 5058, 5020, 5060, 4984, 5019, 4983, 5018, 4983, 5019, 5018, 5019, 5056, 5057, 5056, 5019, 5059, 5019, 5058, 4983, 5018, 4982, 5017, 4982, 5018, 5018, 5056, 5017, 4981, 4982, 5016, 5017, 5016, 4982, 5017, 5055, 5016, 5055, 5017, 5056, 5016, 5015, 4981, 5016, 5054, 5015, 5016, 5055, 5054, 4981, 4980, 4961, 4980, 4981, 5015, 5015, 5014, 4979, 4980, 5015, 4979, 5015, 5053, 5014, 5015, 5054, 5053, 4980, 4960, 4961, 4980, 4979, 4960, 4961, 4960, 4944, 4960, 4959, 4944, 4978, 4977, 4960, 4959, 4960, 4977, 4979, 4978, 4960, 5014, 5013, 4979, 4978, 4979, 5013, 5013, 4977, 4978, 4977, 4976, 4959, 5012, 5011, 4977, 4976, 4977, 5011, 5013, 5012, 4977, 5051, 5012, 5013, 5052, 5013, 5014, 5052, 5051, 5013, 5011, 5012, 5050, 5051, 5050, 5012, 5092, 5050, 5051, 5093, 5092, 5051, 5094, 5051, 5052, 5094, 5093, 5051, 5014, 5053, 5052, 5095, 5094, 5052, 5052, 5053, 5095, 5093, 5094, 5174, 5175, 5174, 5094, 5094, 5095, 5175, 5092, 5093, 5172, 5174, 5172, 5093, 5174, 5173, 5170, 5172, 5174, 5170, 5173, 5174, 5175, 5175, 5177, 5173, 5177, 5175, 5095, 5096, 5095, 5053, 5095, 5096, 5177, 5177, 5176, 5173, 5176, 5177, 5178, 5178, 5177, 5096, 5097, 5096, 5053, 5096, 5097, 5178, 5178, 5180, 5176, 5180, 5178, 5097, 5180, 5179, 5176, 5179, 5180, 5181, 5097, 5098, 5180, 5181, 5180, 5098, 5053, 5054, 5097, 5098, 5097, 5054, 5099, 5098, 5054, 5098, 5099, 5181, 5181, 5182, 5179, 5182, 5181, 5099, 5183, 5179, 5182, 5183, 5182, 5184, 5099, 5184, 5182, 5054, 5055, 5099, 5100, 5099, 5055, 5100, 5184, 5099, 5184, 5185, 5183, 5100, 5185, 5184, 5186, 5183, 5185, 5186, 5185, 5187, 5101, 5185, 5100, 5101, 5187, 5185, 5101, 5100, 5055, 5055, 5056, 5101, 5102, 5101, 5056, 5102, 5187, 5101, 5187, 5188, 5186, 5102, 5188, 5187, 5189, 5186, 5188, 5189, 5188, 5190, 5103, 5188, 5102, 5103, 5102, 5056, 5105, 5104, 5056, 5103, 5056, 5104, 5103, 5190, 5255, 5104, 5190, 5103, 5190, 5191, 5189, 5104, 5191, 5190, 5192, 5189, 5191, 5192, 5191, 5193, 5107, 5191, 5104, 5107, 5104, 5106, 5108, 5107, 5058, 5109, 5058, 5107, 5107, 5193, 5256, 5108, 5193, 5107, 5192, 5193, 5194, 5108, 5194, 5193, 5195, 5192, 5194, 5195, 5194, 5196, 5257, 5194, 5108, 5258, 5112, 5194, 5110, 5108, 5058, 5058, 5060, 5113, 5061, 5060, 5022, 5112, 5111, 5060, 5114, 5112, 5060, 5060, 5061, 5115, 5114, 5060, 5115, 5022, 5023, 5062, 5062, 5061, 5022, 5063, 5023, 5024, 5063, 5062, 5023, 5117, 5061, 5062, 5118, 5117, 5062, 5062, 5063, 5121, 5120, 5119, 5063, 5122, 5120, 5063, 5262, 5120, 5204, 5205, 5204, 5120, 5120, 5122, 5205, 5207, 5205, 5122, 5122, 5208, 5207, 5203, 5204, 5205, 5205, 5207, 5203, 5204, 5203, 5200, 5202, 5204, 5200, 5204, 5202, 5261, 5207, 5206, 5203, 5206, 5207, 5208, 5200, 5201, 5202, 5202, 5201, 5117, 5117, 5260, 5202, 5198, 5201, 5200, 5199, 5201, 5198, 5201, 5199, 5116, 5116, 5117, 5201, 5117, 5116, 5061, 5116, 5115, 5061, 5115, 5116, 5199, 5198, 5197, 5199, 5199, 5197, 5115, 5198, 5195, 5197, 5195, 5196, 5197, 5197, 5196, 5114, 5114, 5115, 5197, 5196, 5259, 5112, 5112, 5114, 5196, 5167, 5169, 5170, 5171, 5170, 5169, 5170, 5171, 5172, 5165, 5168, 5167, 5167, 5168, 5169, 5168, 5089, 5169, 5090, 5169, 5089, 5169, 5090, 5171, 5091, 5171, 5090, 5091, 5092, 5171, 5172, 5171, 5092, 5090, 5089, 5050, 5091, 5090, 5050, 5089, 5088, 5049, 5049, 5050, 5089, 5089, 5168, 5088, 5165, 5166, 5168, 5166, 5088, 5168, 5088, 5087, 5049, 5088, 5166, 5087, 5010, 5011, 5049, 5048, 5010, 5049, 5050, 5049, 5011, 5048, 5049, 5087, 5092, 5091, 5050, 5087, 5086, 5048, 5087, 5164, 5086, 5254, 5087, 5166, 5165, 5164, 5166, 5161, 5163, 5164, 5165, 5161, 5164, 5163, 5086, 5164, 5048, 5086, 5047, 5085, 5047, 5086, 5086, 5163, 5085, 5048, 5047, 5010, 5047, 5045, 5009, 5009, 5010, 5047, 5084, 5083, 5047, 5045, 5047, 5083, 5085, 5084, 5047, 5085, 5162, 5084, 5162, 5085, 5163, 5161, 5162, 5163, 5162, 5161, 5158, 5158, 5084, 5162, 5084, 5158, 5083, 5083, 5157, 5045, 5159, 5083, 5158, 5157, 5083, 5253, 5159, 5253, 5083, 5160, 5159, 5158, 5160, 5158, 5161, 5253, 5159, 5251, 5160, 5251, 5159, 5251, 5252, 5253, 5253, 5252, 5157, 5252, 5251, 5250, 5248, 5250, 5251, 5252, 5250, 5156, 5156, 5157, 5252, 5248, 5249, 5250, 5250, 5249, 5155, 5155, 5156, 5250, 5249, 5248, 5247, 5245, 5247, 5248, 5249, 5247, 5154, 5154, 5155, 5249, 5155, 5154, 5081, 5156, 5155, 5081, 5156, 5081, 5157, 5080, 5041, 5081, 5042, 5081, 5041, 5081, 5042, 5045, 5080, 5081, 5154, 5045, 5157, 5081, 5154, 5153, 5080, 5153, 5154, 5247, 5153, 5152, 5080, 5152, 5153, 5246, 5247, 5246, 5153, 5152, 5151, 5079, 5079, 5080, 5152, 5151, 5152, 5244, 5246, 5244, 5152, 5246, 5245, 5244, 5245, 5246, 5247, 5242, 5243, 5244, 5242, 5244, 5245, 5244, 5243, 5151, 5239, 5241, 5242, 5243, 5242, 5241, 5243, 5149, 5150, 5241, 5149, 5243, 5150, 5151, 5243, 5239, 5240, 5241, 5241, 5148, 5149, 5240, 5148, 5241, 5240, 5239, 5236, 5238, 5240, 5236, 5240, 5147, 5148, 5238, 5147, 5240, 5148, 5147, 5077, 5149, 5148, 5078, 5077, 5078, 5148, 5150, 5149, 5078, 5150, 5078, 5151, 5078, 5077, 5037, 5037, 5079, 5078, 5151, 5078, 5079, 5039, 5003, 5037, 5040, 5037, 5003, 5040, 5079, 5037, 5040, 5080, 5079, 5003, 5041, 5040, 5041, 5080, 5040, 5003, 5002, 4972, 5005, 5003, 4972, 5005, 5041, 5003, 5041, 5005, 5042, 5005, 4972, 5006, 5006, 5042, 5005, 4956, 4957, 4972, 4957, 5006, 4972, 4973, 5006, 4957, 5042, 5006, 5043, 4973, 5044, 5006, 5082, 5045, 5042, 5046, 5009, 5045, 5009, 5008, 4974, 4974, 4975, 5009, 5010, 5009, 4975, 4974, 4973, 4958, 4975, 4974, 4958, 4973, 4974, 5007, 4975, 4958, 4976, 4975, 4976, 5011, 5010, 4975, 5011, 4958, 4959, 4976, 4959, 4958, 4943, 4943, 4944, 4959, 4943, 4942, 4934, 4944, 4943, 4934, 4942, 4943, 4958, 4942, 4941, 4933, 4933, 4934, 4942, 4941, 4942, 4957, 4958, 4957, 4942, 4941, 4957, 4956, 4957, 4958, 4973, 4967, 4968, 4993, 4994, 4993, 4968, 4995, 4994, 4968, 4969, 4996, 4968, 4995, 4968, 4996, 5028, 4993, 5029, 4994, 5029, 4993, 4994, 4995, 5029, 5030, 5029, 4995, 4995, 4996, 5030, 4997, 4996, 4969, 5031, 5030, 4996, 4996, 4997, 5031, 4997, 4969, 4998, 5032, 5031, 4997, 4997, 4998, 5033, 5034, 4997, 5033, 5075, 5033, 5071, 5072, 5071, 5031, 5073, 5031, 5071, 5030, 5031, 5069, 5070, 5069, 5031, 5030, 5069, 5029, 5266, 5265, 5264, 5265, 5267, 5264, 5267, 5268, 5264, 5268, 5269, 5264, 5269, 5270, 5264, 5270, 5271, 5264, 5271, 5272, 5264, 5272, 5266, 5264, 5269, 5268, 5281, 5281, 5282, 5269, 5283, 5269, 5282, 5283, 5270, 5269, 5283, 5284, 5270, 5284, 5285, 5270, 5271, 5270, 5285, 5285, 5286, 5271, 5271, 5286, 5272, 5301, 5285, 5300, 5284, 5300, 5285, 5285, 5301, 5286, 5284, 5283, 5300, 5299, 5283, 5282, 5283, 5299, 5300, 5326, 5300, 5325, 5299, 5325, 5300, 5326, 5327, 5300, 5327, 5328, 5300, 5301, 5300, 5328, 5361, 5326, 5360, 5325, 5360, 5326, 5326, 5361, 5362, 5327, 5326, 5362, 5324, 5325, 5299, 5360, 5325, 5324, 5360, 5324, 5359, 5402, 5360, 5359, 5360, 5402, 5403, 5361, 5360, 5403, 5361, 5403, 5404, 5362, 5361, 5404, 5363, 5328, 5362, 5327, 5362, 5328, 5362, 5404, 5363, 5405, 5363, 5404, 5403, 5465, 5404, 5467, 5404, 5466, 5467, 5468, 5404, 5404, 5468, 5469, 5591, 5556, 5467, 5557, 5467, 5556, 5467, 5557, 5468, 5471, 5470, 5468, 5559, 5468, 5557, 5468, 5559, 5471, 5556, 5555, 5557, 5559, 5557, 5558, 5555, 5558, 5557, 5556, 5554, 5555, 5556, 5590, 5554, 5552, 5555, 5554, 5553, 5552, 5554, 5554, 5463, 5553, 5463, 5554, 5589, 5549, 5552, 5551, 5553, 5551, 5552, 5461, 5551, 5553, 5553, 5462, 5461, 5462, 5553, 5463, 5463, 5403, 5402, 5462, 5463, 5402, 5463, 5464, 5403, 5461, 5462, 5402, 5461, 5402, 5460, 5461, 5460, 5551, 5550, 5549, 5551, 5460, 5550, 5551, 5459, 5460, 5401, 5401, 5460, 5402, 5460, 5459, 5550, 5402, 5359, 5401, 5401, 5358, 5400, 5401, 5359, 5358, 5459, 5401, 5458, 5400, 5458, 5401, 5459, 5458, 5548, 5459, 5548, 5550, 5550, 5548, 5549, 5546, 5547, 5548, 5547, 5549, 5548, 5458, 5546, 5548, 5457, 5458, 5400, 5458, 5457, 5546, 5547, 5546, 5543, 5545, 5543, 5546, 5457, 5545, 5546, 5457, 5400, 5456, 5457, 5456, 5545, 5544, 5543, 5545, 5456, 5544, 5545, 5544, 5542, 5543, 5541, 5543, 5542, 5455, 5542, 5544, 5456, 5455, 5544, 5455, 5456, 5397, 5397, 5456, 5400, 5396, 5455, 5397, 5454, 5455, 5396, 5455, 5454, 5542, 5540, 5541, 5542, 5454, 5540, 5542, 5541, 5540, 5537, 5539, 5537, 5540, 5540, 5454, 5539, 5453, 5454, 5396, 5453, 5539, 5454, 5396, 5395, 5393, 5396, 5397, 5399, 5396, 5393, 5453, 5452, 5453, 5393, 5539, 5453, 5538, 5452, 5538, 5453, 5538, 5537, 5539, 5538, 5534, 5537, 5536, 5534, 5538, 5538, 5452, 5536, 5451, 5452, 5393, 5451, 5536, 5452, 5535, 5534, 5536, 5536, 5451, 5535, 5535, 5531, 5534, 5533, 5531, 5535, 5535, 5450, 5533, 5450, 5535, 5451, 5393, 5392, 5451, 5450, 5451, 5392, 5449, 5450, 5392, 5449, 5533, 5450, 5532, 5531, 5533, 5533, 5449, 5532, 5532, 5530, 5531, 5528, 5531, 5530, 5532, 5448, 5530, 5448, 5532, 5449, 5449, 5392, 5448, 5447, 5448, 5391, 5391, 5448, 5392, 5447, 5530, 5448, 5529, 5528, 5530, 5530, 5447, 5529, 5529, 5527, 5528, 5526, 5528, 5527, 5444, 5527, 5529, 5529, 5446, 5444, 5446, 5529, 5447, 5447, 5391, 5446, 5444, 5446, 5389, 5389, 5446, 5391, 5444, 5389, 5443, 5442, 5444, 5445, 5527, 5444, 5442, 5525, 5526, 5527, 5442, 5525, 5527, 5523, 5526, 5525, 5524, 5523, 5525, 5440, 5524, 5525, 5525, 5442, 5440, 5440, 5442, 5441, 5440, 5439, 5387, 5438, 5440, 5387, 5524, 5440, 5438, 5522, 5523, 5524, 5438, 5522, 5524, 5520, 5523, 5522, 5521, 5520, 5522, 5437, 5521, 5522, 5522, 5438, 5437, 5437, 5438, 5387, 5437, 5387, 5436, 5521, 5437, 5436, 5519, 5520, 5521, 5436, 5519, 5521, 5517, 5520, 5519, 5519, 5518, 5517, 5435, 5518, 5519, 5519, 5436, 5435, 5435, 5436, 5386, 5386, 5436, 5387, 5435, 5386, 5434, 5518, 5435, 5434, 5516, 5517, 5518, 5434, 5588, 5518, 5517, 5516, 5514, 5516, 5515, 5514, 5516, 5434, 5515, 5433, 5434, 5385, 5385, 5434, 5386, 5433, 5515, 5434, 5513, 5514, 5515, 5515, 5433, 5513, 5514, 5513, 5511, 5512, 5511, 5513, 5513, 5432, 5512, 5432, 5513, 5433, 5433, 5385, 5384, 5432, 5433, 5384, 5385, 5346, 5384, 5386, 5347, 5385, 5346, 5385, 5347, 5384, 5345, 5383, 5345, 5384, 5346, 5431, 5384, 5383, 5431, 5432, 5384, 5431, 5512, 5432, 5430, 5431, 5383, 5512, 5431, 5510, 5430, 5510, 5431, 5383, 5344, 5382, 5344, 5383, 5345, 5383, 5382, 5429, 5429, 5430, 5383, 5510, 5430, 5509, 5429, 5509, 5430, 5511, 5510, 5508, 5509, 5508, 5510, 5510, 5511, 5512, 5507, 5508, 5509, 5509, 5429, 5507, 5428, 5429, 5382, 5428, 5507, 5429, 5508, 5507, 5504, 5506, 5504, 5507, 5507, 5428, 5506, 5427, 5428, 5382, 5427, 5506, 5428, 5505, 5504, 5506, 5506, 5427, 5505, 5505, 5501, 5504, 5503, 5501, 5505, 5505, 5426, 5425, 5503, 5505, 5425, 5426, 5505, 5427, 5382, 5381, 5427, 5426, 5427, 5381, 5425, 5426, 5381, 5381, 5380, 5425, 5424, 5425, 5380, 5503, 5425, 5424, 5502, 5501, 5503, 5502, 5503, 5424, 5502, 5498, 5501, 5500, 5498, 5502, 5502, 5424, 5423, 5500, 5502, 5423, 5423, 5424, 5380, 5422, 5423, 5379, 5380, 5379, 5423, 5500, 5423, 5422, 5499, 5498, 5500, 5499, 5500, 5422, 5499, 5497, 5498, 5496, 5498, 5497, 5499, 5422, 5421, 5497, 5499, 5421, 5421, 5422, 5379, 5421, 5379, 5420, 5497, 5421, 5420, 5495, 5496, 5497, 5495, 5497, 5420, 5493, 5496, 5495, 5492, 5493, 5495, 5495, 5420, 5419, 5492, 5495, 5419, 5419, 5420, 5377, 5377, 5420, 5379, 5419, 5377, 5418, 5492, 5419, 5418, 5494, 5493, 5492, 5494, 5492, 5418, 5585, 5493, 5494, 5587, 5585, 5494, 5494, 5418, 5587, 5376, 5418, 5377, 5491, 5418, 5376, 5491, 5587, 5418, 5586, 5585, 5587, 5587, 5491, 5586, 5583, 5585, 5584, 5586, 5584, 5585, 5586, 5490, 5584, 5490, 5586, 5491, 5491, 5376, 5416, 5490, 5491, 5416, 5489, 5490, 5416, 5489, 5584, 5490, 5582, 5583, 5584, 5584, 5489, 5592, 5583, 5582, 5580, 5582, 5581, 5580, 5582, 5488, 5581, 5488, 5582, 5489, 5415, 5488, 5489, 5489, 5416, 5415, 5416, 5373, 5415, 5373, 5416, 5376, 5415, 5372, 5414, 5372, 5415, 5373, 5487, 5415, 5414, 5487, 5488, 5415, 5487, 5581, 5488, 5579, 5580, 5581, 5581, 5487, 5579, 5580, 5579, 5577, 5579, 5578, 5577, 5579, 5486, 5578, 5486, 5579, 5487, 5487, 5414, 5486, 5485, 5486, 5414, 5485, 5578, 5486, 5576, 5577, 5578, 5578, 5485, 5576, 5577, 5576, 5574, 5575, 5574, 5576, 5484, 5483, 5576, 5575, 5576, 5483, 5484, 5576, 5485, 5485, 5414, 5413, 5484, 5485, 5413, 5483, 5484, 5413, 5412, 5483, 5413, 5482, 5483, 5412, 5483, 5482, 5575, 5573, 5574, 5575, 5573, 5575, 5482, 5574, 5573, 5570, 5572, 5570, 5573, 5482, 5481, 5573, 5572, 5573, 5481, 5481, 5482, 5412, 5481, 5412, 5480, 5481, 5480, 5572, 5571, 5570, 5572, 5571, 5572, 5480, 5571, 5569, 5570, 5567, 5570, 5569, 5480, 5479, 5571, 5569, 5571, 5479, 5479, 5480, 5411, 5411, 5480, 5412, 5479, 5411, 5478, 5479, 5478, 5569, 5568, 5567, 5569, 5568, 5569, 5478, 5568, 5566, 5567, 5564, 5567, 5566, 5478, 5477, 5568, 5566, 5568, 5477, 5477, 5478, 5410, 5410, 5478, 5411, 5477, 5410, 5476, 5477, 5476, 5566, 5565, 5564, 5566, 5565, 5566, 5476, 5565, 5563, 5564, 5561, 5564, 5563, 5565, 5476, 5563, 5474, 5476, 5406, 5406, 5476, 5410, 5474, 5563, 5476, 5410, 5366, 5406, 5410, 5411, 5366, 5330, 5329, 5366, 5367, 5366, 5329, 5366, 5368, 5330, 5409, 5406, 5366, 5368, 5366, 5411, 5411, 5412, 5368, 5331, 5330, 5368, 5368, 5369, 5331, 5369, 5368, 5412, 5369, 5412, 5370, 5413, 5370, 5412, 5332, 5331, 5369, 5369, 5370, 5332, 5330, 5331, 5302, 5302, 5331, 5303, 5332, 5303, 5331, 5332, 5333, 5303, 5332, 5370, 5333, 5370, 5371, 5333, 5414, 5371, 5370, 5413, 5414, 5370, 5333, 5334, 5303, 5371, 5334, 5333, 5303, 5287, 5302, 5303, 5304, 5287, 5303, 5334, 5304, 5334, 5335, 5304, 5334, 5371, 5335, 5372, 5335, 5371, 5371, 5414, 5372, 5336, 5304, 5335, 5373, 5335, 5372, 5373, 5336, 5335, 5304, 5288, 5287, 5289, 5288, 5304, 5336, 5289, 5304, 5336, 5305, 5289, 5336, 5373, 5374, 5305, 5336, 5375, 5417, 5373, 5376, 5377, 5338, 5376, 5378, 5376, 5338, 5379, 5340, 5377, 5338, 5377, 5340, 5338, 5306, 5337, 5340, 5307, 5338, 5306, 5338, 5307, 5340, 5341, 5307, 5340, 5379, 5341, 5380, 5341, 5379, 5308, 5307, 5341, 5308, 5341, 5309, 5342, 5309, 5341, 5341, 5380, 5342, 5306, 5307, 5290, 5307, 5308, 5290, 5291, 5290, 5308, 5308, 5309, 5291, 5309, 5310, 5291, 5310, 5309, 5343, 5342, 5343, 5309, 5381, 5342, 5380, 5343, 5342, 5382, 5381, 5382, 5342, 5310, 5343, 5311, 5344, 5311, 5343, 5343, 5382, 5344, 5292, 5291, 5310, 5310, 5311, 5292, 5292, 5311, 5293, 5312, 5293, 5311, 5311, 5345, 5312, 5344, 5345, 5311, 5276, 5275, 5292, 5291, 5292, 5275, 5276, 5292, 5277, 5293, 5277, 5292, 5275, 5276, 5265, 5265, 5276, 5267, 5277, 5267, 5276, 5275, 5265, 5273, 5275, 5273, 5291, 5290, 5291, 5273, 5274, 5273, 5266, 5266, 5273, 5265, 5290, 5273, 5289, 5274, 5289, 5273, 5306, 5290, 5305, 5289, 5305, 5290, 5274, 5288, 5289, 5274, 5272, 5288, 5274, 5266, 5272, 5287, 5288, 5272, 5287, 5272, 5286, 5286, 5302, 5287, 5302, 5286, 5301, 5302, 5301, 5330, 5328, 5329, 5301, 5329, 5330, 5301, 5329, 5328, 5364, 5363, 5365, 5328, 5407, 5406, 5363, 5408, 5363, 5406, 5474, 5406, 5473, 5475, 5473, 5406, 5473, 5562, 5474, 5563, 5474, 5562, 5471, 5473, 5472, 5471, 5560, 5473, 5562, 5473, 5560, 5562, 5560, 5561, 5562, 5561, 5563, 5559, 5558, 5560, 5558, 5561, 5560, 5560, 5471, 5559, 5305, 5339, 5306, 5277, 5278, 5267, 5267, 5278, 5268, 5277, 5293, 5278, 5279, 5268, 5278, 5294, 5278, 5293, 5278, 5294, 5279, 5279, 5280, 5268, 5280, 5281, 5268, 5295, 5279, 5294, 5279, 5295, 5280, 5314, 5294, 5313, 5293, 5313, 5294, 5314, 5315, 5294, 5294, 5315, 5295, 5312, 5313, 5293, 5346, 5313, 5345, 5312, 5345, 5313, 5347, 5313, 5346, 5347, 5314, 5313, 5348, 5314, 5347, 5348, 5315, 5314, 5316, 5295, 5315, 5315, 5348, 5316, 5349, 5316, 5348, 5387, 5348, 5386, 5347, 5386, 5348, 5348, 5387, 5349, 5316, 5317, 5295, 5316, 5349, 5350, 5317, 5316, 5350, 5388, 5349, 5387, 5349, 5390, 5389, 5350, 5349, 5389, 5350, 5351, 5317, 5389, 5391, 5350, 5351, 5350, 5391, 5318, 5317, 5351, 5318, 5351, 5319, 5352, 5319, 5351, 5351, 5391, 5352, 5392, 5352, 5391, 5352, 5353, 5319, 5352, 5392, 5353, 5318, 5319, 5296, 5319, 5320, 5296, 5320, 5319, 5353, 5318, 5296, 5317, 5296, 5280, 5295, 5296, 5297, 5280, 5295, 5317, 5296, 5297, 5296, 5320, 5320, 5321, 5297, 5320, 5353, 5321, 5281, 5280, 5297, 5281, 5297, 5282, 5298, 5282, 5297, 5297, 5321, 5298, 5322, 5298, 5321, 5354, 5321, 5353, 5321, 5355, 5322, 5299, 5282, 5298, 5322, 5323, 5298, 5298, 5323, 5299, 5357, 5322, 5356, 5322, 5358, 5323, 5357, 5358, 5322, 5324, 5299, 5323, 5323, 5358, 5324, 5359, 5324, 5358, 5400, 5358, 5357, 5398, 5397, 5357, 5397, 5400, 5357, 5393, 5353, 5392, 5353, 5393, 5394, 5595, 5594, 5593, 5596, 5593, 5594, 5765, 5764, 5593, 5595, 5593, 5766, 5771, 5593, 5770, 5596, 5770, 5593, 5593, 5771, 5902, 5902, 5765, 5593, 5771, 5786, 5789, 5902, 5771, 5789, 5771, 5781, 5786, 5771, 5770, 5781, 5773, 5777, 5770, 5777, 5781, 5770, 5770, 5596, 5773, 5780, 5781, 5777, 5780, 5783, 5781, 5781, 5783, 5786, 5773, 5778, 5777, 5777, 5778, 5780, 5780, 5778, 5782, 5783, 5780, 5784, 5782, 5784, 5780, 5786, 5783, 5785, 5785, 5783, 5787, 5784, 5787, 5783, 5784, 5782, 5809, 5784, 5811, 5787, 5784, 5809, 5811, 5779, 5782, 5778, 5782, 5779, 5807, 5782, 5807, 5809, 5809, 5807, 5810, 5811, 5809, 5812, 5810, 5812, 5809, 5787, 5811, 5790, 5813, 5790, 5811, 5811, 5812, 5813, 5812, 5814, 5813, 5810, 5835, 5812, 5812, 5835, 5814, 5808, 5810, 5807, 5810, 5808, 5833, 5810, 5833, 5835, 5835, 5833, 5836, 5837, 5814, 5835, 5835, 5836, 5837, 5816, 5815, 5814, 5813, 5814, 5815, 5814, 5837, 5816, 5836, 5838, 5837, 5839, 5816, 5837, 5837, 5838, 5839, 5815, 5816, 5817, 5818, 5817, 5816, 5816, 5839, 5818, 5815, 5792, 5813, 5792, 5815, 5795, 5817, 5795, 5815, 5795, 5817, 5798, 5819, 5798, 5817, 5817, 5818, 5819, 5795, 5794, 5792, 5794, 5795, 5797, 5798, 5797, 5795, 5797, 5798, 5799, 5800, 5799, 5798, 5798, 5819, 5800, 5794, 5797, 5796, 5796, 5797, 5799, 5794, 5793, 5791, 5791, 5792, 5794, 5794, 5796, 5793, 5635, 5796, 5799, 5793, 5796, 5902, 5902, 5796, 5765, 5635, 5765, 5796, 5636, 5635, 5799, 5800, 5636, 5799, 5636, 5633, 5635, 5631, 5635, 5633, 5635, 5631, 5765, 5768, 5765, 5631, 5631, 5630, 5627, 5631, 5633, 5630, 5767, 5631, 5627, 5633, 5634, 5630, 5634, 5633, 5637, 5636, 5637, 5633, 5637, 5636, 5800, 5637, 5664, 5634, 5800, 5821, 5637, 5664, 5637, 5821, 5632, 5630, 5634, 5634, 5662, 5632, 5662, 5634, 5664, 5664, 5665, 5662, 5664, 5821, 5665, 5821, 5800, 5819, 5821, 5819, 5822, 5822, 5665, 5821, 5663, 5662, 5665, 5665, 5694, 5663, 5665, 5822, 5694, 5660, 5632, 5662, 5662, 5663, 5660, 5661, 5660, 5663, 5663, 5692, 5661, 5692, 5663, 5694, 5694, 5695, 5692, 5822, 5845, 5694, 5694, 5845, 5695, 5820, 5822, 5819, 5822, 5820, 5845, 5820, 5819, 5818, 5843, 5820, 5818, 5845, 5820, 5843, 5845, 5843, 5846, 5846, 5695, 5845, 5693, 5692, 5695, 5695, 5725, 5693, 5695, 5846, 5725, 5844, 5846, 5843, 5846, 5844, 5875, 5846, 5875, 5725, 5841, 5843, 5818, 5843, 5841, 5844, 5841, 5818, 5839, 5841, 5839, 5842, 5842, 5844, 5841, 5844, 5842, 5873, 5875, 5844, 5873, 5875, 5873, 5876, 5876, 5726, 5875, 5725, 5875, 5726, 5873, 5842, 5871, 5873, 5871, 5874, 5874, 5876, 5873, 5840, 5842, 5839, 5871, 5842, 5840, 5840, 5839, 5838, 5869, 5840, 5838, 5840, 5869, 5871, 5871, 5869, 5872, 5872, 5874, 5871, 5874, 5872, 5898, 5874, 5898, 5900, 5876, 5874, 5900, 5870, 5872, 5869, 5896, 5872, 5870, 5898, 5872, 5896, 5838, 5864, 5869, 5869, 5864, 5870, 5864, 5838, 5836, 5836, 5865, 5864, 5864, 5867, 5866, 5866, 5870, 5864, 5894, 5870, 5866, 5870, 5894, 5896, 5861, 5866, 5868, 5892, 5866, 5861, 5866, 5892, 5894, 5894, 5892, 5895, 5896, 5894, 5897, 5895, 5897, 5894, 5861, 5890, 5892, 5892, 5890, 5893, 5893, 5895, 5892, 5890, 5861, 5888, 5890, 5889, 5891, 5888, 5889, 5890, 5891, 5893, 5890, 5888, 5859, 5885, 5888, 5887, 5889, 5888, 5885, 5887, 5859, 5888, 5861, 5858, 5855, 5859, 5862, 5859, 5861, 5858, 5859, 5863, 5855, 5885, 5859, 5858, 5834, 5854, 5858, 5854, 5855, 5834, 5858, 5836, 5860, 5836, 5858, 5833, 5831, 5834, 5832, 5834, 5831, 5834, 5836, 5833, 5832, 5854, 5834, 5854, 5832, 5852, 5854, 5856, 5855, 5854, 5852, 5857, 5831, 5830, 5832, 5830, 5852, 5832, 5852, 5830, 5850, 5852, 5851, 5853, 5852, 5850, 5851, 5829, 5828, 5830, 5831, 5829, 5830, 5828, 5850, 5830, 5850, 5828, 5847, 5850, 5849, 5851, 5850, 5847, 5849, 5879, 5851, 5877, 5849, 5877, 5851, 5851, 5879, 5883, 5847, 5699, 5849, 5877, 5849, 5727, 5699, 5727, 5849, 5729, 5877, 5727, 5877, 5729, 5878, 5878, 5879, 5877, 5728, 5727, 5700, 5699, 5700, 5727, 5727, 5728, 5729, 5700, 5699, 5697, 5696, 5697, 5699, 5699, 5847, 5696, 5700, 5701, 5702, 5697, 5701, 5700, 5700, 5702, 5728, 5697, 5696, 5669, 5697, 5674, 5701, 5669, 5674, 5697, 5698, 5669, 5696, 5847, 5825, 5696, 5848, 5696, 5825, 5825, 5847, 5828, 5823, 5826, 5825, 5827, 5825, 5828, 5827, 5823, 5825, 5829, 5827, 5828, 5827, 5804, 5823, 5829, 5806, 5827, 5804, 5827, 5806, 5823, 5802, 5666, 5824, 5823, 5666, 5802, 5823, 5804, 5803, 5802, 5804, 5804, 5806, 5803, 5801, 5640, 5802, 5803, 5801, 5802, 5640, 5666, 5802, 5667, 5666, 5641, 5640, 5641, 5666, 5666, 5667, 5670, 5638, 5641, 5640, 5639, 5638, 5640, 5640, 5801, 5639, 5641, 5642, 5643, 5638, 5642, 5641, 5641, 5673, 5667, 5639, 5601, 5638, 5638, 5604, 5642, 5601, 5604, 5638, 5602, 5601, 5639, 5602, 5639, 5801, 5602, 5597, 5601, 5601, 5603, 5604, 5597, 5603, 5601, 5607, 5604, 5606, 5603, 5606, 5604, 5604, 5607, 5642, 5600, 5603, 5597, 5606, 5603, 5605, 5600, 5605, 5603, 5599, 5598, 5597, 5600, 5597, 5598, 5597, 5602, 5599, 5600, 5594, 5605, 5594, 5600, 5596, 5598, 5596, 5600, 5609, 5608, 5605, 5606, 5605, 5610, 5605, 5594, 5609, 5606, 5613, 5607, 5612, 5607, 5611, 5644, 5642, 5607, 5607, 5612, 5644, 5612, 5618, 5617, 5648, 5644, 5612, 5612, 5617, 5648, 5646, 5645, 5644, 5642, 5644, 5647, 5644, 5648, 5646, 5649, 5646, 5648, 5650, 5648, 5617, 5648, 5650, 5649, 5675, 5671, 5646, 5676, 5646, 5671, 5646, 5649, 5675, 5651, 5649, 5650, 5678, 5675, 5649, 5649, 5651, 5678, 5617, 5621, 5650, 5652, 5650, 5621, 5650, 5652, 5651, 5653, 5651, 5652, 5680, 5678, 5651, 5680, 5651, 5653, 5679, 5677, 5678, 5675, 5678, 5677, 5678, 5680, 5679, 5681, 5679, 5680, 5682, 5680, 5653, 5681, 5680, 5682, 5653, 5652, 5655, 5655, 5684, 5653, 5682, 5653, 5684, 5683, 5681, 5682, 5684, 5685, 5682, 5683, 5682, 5685, 5679, 5681, 5705, 5707, 5705, 5681, 5707, 5681, 5683, 5709, 5707, 5683, 5685, 5713, 5683, 5709, 5683, 5713, 5685, 5684, 5687, 5687, 5716, 5685, 5713, 5685, 5716, 5713, 5714, 5709, 5716, 5717, 5713, 5718, 5713, 5717, 5716, 5687, 5719, 5719, 5720, 5716, 5717, 5716, 5720, 5746, 5751, 5717, 5717, 5752, 5746, 5752, 5717, 5754, 5720, 5754, 5717, 5720, 5719, 5722, 5754, 5720, 5756, 5722, 5756, 5720, 5753, 5752, 5754, 5754, 5755, 5753, 5755, 5754, 5757, 5756, 5757, 5754, 5750, 5746, 5752, 5752, 5753, 5750, 5746, 5750, 5749, 5747, 5746, 5741, 5748, 5741, 5746, 5712, 5741, 5740, 5737, 5742, 5741, 5741, 5743, 5737, 5741, 5712, 5745, 5712, 5711, 5709, 5712, 5709, 5715, 5710, 5707, 5709, 5705, 5707, 5706, 5708, 5706, 5707, 5705, 5703, 5679, 5706, 5704, 5705, 5703, 5705, 5704, 5701, 5677, 5703, 5702, 5703, 5704, 5701, 5703, 5702, 5677, 5679, 5703, 5731, 5704, 5733, 5702, 5704, 5731, 5704, 5706, 5733, 5731, 5728, 5702, 5732, 5730, 5731, 5728, 5731, 5730, 5731, 5733, 5732, 5734, 5732, 5733, 5733, 5706, 5735, 5734, 5733, 5736, 5735, 5736, 5733, 5735, 5706, 5737, 5738, 5737, 5706, 5736, 5735, 5739, 5737, 5739, 5735, 5739, 5737, 5744, 5730, 5729, 5728, 5677, 5674, 5675, 5674, 5677, 5701, 5669, 5671, 5674, 5671, 5675, 5674, 5669, 5668, 5667, 5667, 5671, 5669, 5667, 5672, 5671, 5757, 5756, 5759, 5756, 5722, 5758, 5758, 5759, 5756, 5759, 5758, 5761, 5724, 5758, 5722, 5758, 5724, 5760, 5760, 5761, 5758, 5721, 5722, 5719, 5722, 5721, 5724, 5723, 5724, 5721, 5724, 5723, 5726, 5726, 5760, 5724, 5876, 5900, 5760, 5726, 5876, 5760, 5760, 5900, 5761, 5901, 5761, 5900, 5900, 5898, 5901, 5899, 5901, 5898, 5898, 5896, 5899, 5897, 5899, 5896, 5725, 5726, 5723, 5723, 5693, 5725, 5691, 5690, 5693, 5692, 5693, 5690, 5693, 5723, 5691, 5689, 5688, 5691, 5690, 5691, 5688, 5691, 5721, 5689, 5721, 5691, 5723, 5688, 5659, 5690, 5661, 5690, 5659, 5690, 5661, 5692, 5659, 5688, 5657, 5686, 5657, 5688, 5688, 5689, 5686, 5658, 5659, 5656, 5657, 5656, 5659, 5659, 5658, 5661, 5660, 5661, 5658, 5629, 5658, 5626, 5656, 5626, 5658, 5658, 5629, 5660, 5626, 5656, 5624, 5654, 5624, 5656, 5656, 5657, 5654, 5625, 5626, 5624, 5626, 5625, 5629, 5628, 5629, 5625, 5629, 5628, 5632, 5632, 5660, 5629, 5622, 5625, 5623, 5625, 5624, 5623, 5622, 5627, 5625, 5628, 5625, 5627, 5623, 5624, 5621, 5624, 5654, 5621, 5623, 5619, 5622, 5623, 5620, 5619, 5621, 5620, 5623, 5622, 5619, 5762, 5769, 5627, 5622, 5628, 5627, 5630, 5630, 5632, 5628, 5615, 5609, 5619, 5620, 5615, 5619, 5595, 5763, 5619, 5619, 5609, 5595, 5620, 5621, 5615, 5609, 5615, 5614, 5615, 5617, 5616, 5617, 5615, 5621, 5609, 5594, 5595, 5652, 5621, 5654, 5654, 5655, 5652, 5655, 5654, 5657, 5657, 5686, 5655, 5684, 5655, 5686, 5686, 5687, 5684, 5687, 5686, 5689, 5689, 5719, 5687, 5719, 5689, 5721, 5598, 5773, 5596, 5773, 5598, 5772, 5599, 5772, 5598, 5772, 5775, 5773, 5775, 5778, 5773, 5772, 5599, 5774, 5775, 5772, 5776, 5774, 5776, 5772, 5602, 5774, 5599, 5602, 5801, 5774, 5803, 5776, 5774, 5774, 5801, 5803, 5776, 5779, 5775, 5803, 5805, 5776, 5779, 5776, 5805, 5778, 5775, 5779, 5807, 5779, 5805, 5805, 5803, 5806, 5807, 5805, 5808, 5806, 5808, 5805, 5831, 5806, 5829, 5808, 5806, 5831, 5808, 5831, 5833, 5879, 5878, 5880, 5882, 5881, 5879, 5882, 5879, 5880, 5882, 5880, 5884, 5885, 5855, 5882, 5886, 5882, 5855, 5885, 5882, 5884, 5885, 5884, 5887, 5789, 5793, 5902, 5789, 5786, 5788, 5788, 5791, 5789, 5789, 5791, 5793, 5785, 5788, 5786, 5787, 5790, 5788, 5785, 5787, 5788, 5788, 5790, 5791, 5792, 5791, 5790, 5790, 5813, 5792, 5905, 5904, 5903, 5906, 5905, 5903, 5965, 5966, 5903, 5906, 5903, 5966, 5903, 5904, 5967, 5903, 5967, 5965, 5905, 5908, 5904, 5908, 5907, 5904, 5908, 5910, 5907, 5910, 5909, 5907, 5907, 5969, 5968, 5904, 5907, 5968, 5969, 5907, 5909, 5910, 5912, 5909, 5912, 5911, 5909, 5909, 5970, 5969, 5970, 5909, 5911, 5969, 6001, 5999, 5999, 5968, 5969, 6001, 5969, 5970, 5904, 5968, 5967, 5968, 5999, 5967, 6000, 5967, 5999, 5999, 6032, 6031, 6000, 5999, 6031, 6032, 5999, 6001, 5998, 5965, 5967, 5967, 6000, 6030, 5998, 5967, 6030, 6000, 6031, 6062, 6030, 6000, 6062, 5998, 6030, 6029, 6030, 6062, 6061, 6029, 6030, 6061, 5997, 5963, 5998, 5965, 5998, 5963, 5997, 5998, 6029, 5963, 5964, 5965, 5966, 5965, 5964, 5961, 5962, 5963, 5964, 5963, 5962, 5963, 5997, 5961, 5996, 5961, 5997, 6029, 6028, 5997, 5996, 5997, 6028, 5959, 5960, 5961, 5962, 5961, 5960, 5961, 5996, 5959, 5995, 5959, 5996, 5995, 5996, 6027, 6028, 6027, 5996, 6027, 6028, 6059, 6060, 6059, 6028, 6028, 6029, 6060, 6027, 6026, 5995, 6026, 6027, 6058, 6059, 6058, 6027, 5959, 5995, 5994, 5994, 5995, 6026, 6026, 6025, 5994, 6025, 6026, 6057, 6058, 6057, 6026, 5957, 5994, 5993, 5994, 5957, 5959, 5993, 5994, 6025, 6025, 6024, 5993, 6056, 6024, 6025, 6057, 6056, 6025, 5955, 5993, 5992, 5993, 5955, 5957, 6024, 5992, 5993, 5992, 6024, 6023, 6024, 6056, 6055, 6055, 6023, 6024, 5953, 5992, 5991, 5992, 5953, 5955, 6023, 5991, 5992, 5956, 5955, 5953, 5958, 5957, 5955, 5955, 5956, 5958, 5954, 5953, 5951, 5953, 5954, 5956, 5991, 5951, 5953, 5951, 5952, 5954, 5949, 5950, 5951, 5952, 5951, 5950, 5951, 5991, 5949, 5947, 5948, 5949, 5950, 5949, 5948, 5949, 5990, 5947, 5990, 5949, 5991, 5945, 5946, 5947, 5948, 5947, 5946, 5947, 5989, 5945, 5989, 5947, 5990, 5990, 6022, 6021, 5989, 5990, 6021, 6022, 5990, 5991, 5988, 5945, 5989, 5989, 6021, 6020, 5988, 5989, 6020, 6021, 6053, 6052, 6020, 6021, 6052, 6021, 6022, 6053, 5988, 6020, 6019, 6020, 6052, 6051, 6019, 6020, 6051, 5987, 5944, 5988, 5945, 5988, 5944, 5987, 5988, 6019, 6019, 6018, 5987, 6051, 6050, 6019, 6018, 6019, 6050, 5987, 5986, 5944, 5986, 5987, 6018, 5944, 5942, 5943, 5944, 5943, 5945, 5986, 5942, 5944, 5946, 5945, 5943, 5942, 5941, 5943, 5942, 5940, 5941, 5985, 5940, 5942, 5986, 5985, 5942, 5985, 5986, 6017, 6018, 6017, 5986, 5985, 5984, 5940, 5984, 5985, 6016, 6017, 6016, 5985, 5940, 5938, 5939, 5940, 5939, 5941, 5984, 5938, 5940, 5984, 5983, 5938, 5984, 6016, 5983, 6015, 5983, 6016, 6016, 6048, 6015, 6016, 6017, 6048, 6049, 6048, 6017, 6017, 6018, 6049, 6047, 6015, 6048, 5983, 6015, 5982, 6014, 5982, 6015, 6015, 6047, 6014, 6046, 6014, 6047, 5982, 6014, 5981, 6013, 5981, 6014, 6014, 6046, 6013, 5933, 5982, 5931, 5981, 5931, 5982, 5982, 5933, 5983, 5931, 5981, 5929, 5980, 5929, 5981, 5981, 6013, 5980, 6012, 5980, 6013, 6013, 6045, 6012, 6045, 6013, 6046, 5929, 5980, 5928, 5979, 5928, 5980, 5980, 6012, 5979, 5930, 5929, 5927, 5928, 5927, 5929, 5929, 5930, 5931, 5928, 5926, 5927, 5926, 5928, 5978, 5928, 5979, 5978, 5979, 6011, 5978, 6011, 5979, 6012, 5926, 5978, 5977, 5978, 6010, 5977, 6010, 5978, 6011, 5926, 5924, 5925, 5925, 5927, 5926, 5924, 5926, 5977, 5977, 5976, 5924, 5977, 6009, 5976, 6009, 5977, 6010, 6010, 6042, 6009, 6042, 6010, 6043, 6011, 6043, 6010, 6008, 5976, 6009, 6009, 6041, 6008, 6041, 6009, 6042, 5976, 5975, 5922, 5922, 5924, 5976, 5976, 6008, 5975, 6007, 5975, 6008, 6008, 6040, 6007, 6040, 6008, 6041, 5919, 5975, 5917, 5974, 5917, 5975, 5919, 5922, 5975, 5975, 6007, 5974, 5922, 5919, 5921, 5921, 5923, 5922, 5924, 5922, 5923, 5920, 5919, 5918, 5917, 5918, 5919, 5920, 5921, 5919, 5918, 5917, 5916, 5915, 5916, 5917, 5917, 5974, 5915, 5916, 5915, 5914, 5913, 5914, 5915, 5915, 5973, 5913, 5973, 5915, 5974, 5914, 5913, 5912, 5911, 5912, 5913, 5913, 5972, 5911, 5972, 5913, 5973, 5973, 6005, 5972, 5974, 6006, 5973, 6005, 5973, 6006, 5971, 5911, 5972, 6003, 5971, 5972, 6004, 6003, 5972, 6004, 5972, 6005, 5911, 5971, 5970, 5971, 6003, 5970, 6002, 5970, 6003, 6003, 6035, 6002, 6004, 6036, 6003, 6035, 6003, 6036, 6005, 6037, 6004, 6036, 6004, 6037, 6037, 6005, 6038, 6006, 6038, 6005, 6038, 6006, 6039, 6007, 6039, 6006, 6039, 6007, 6040, 6006, 5974, 6007, 6034, 6002, 6035, 6002, 6034, 6033, 6001, 6033, 6032, 6033, 6001, 6002, 5970, 6002, 6001, 5923, 5925, 5924, 6043, 6011, 6044, 6012, 6044, 6011, 6044, 6012, 6045, 5932, 5931, 5930, 5931, 5932, 5933, 5934, 5933, 5932, 5933, 5934, 5935, 5935, 5983, 5933, 5936, 5935, 5934, 5935, 5936, 5937, 5938, 5935, 5937, 5983, 5935, 5938, 5938, 5937, 5939, 6050, 6049, 6018, 6022, 6054, 6053, 5991, 6023, 6022, 6054, 6022, 6023, 6023, 6055, 6054, 5957, 5958, 5960, 5960, 5959, 5957, 6061, 6060, 6029, 6065, 6064, 6063, 6068, 6063, 6067, 6063, 6068, 6065, 6063, 6128, 6127, 6128, 6063, 6064, 6127, 6067, 6063, 6064, 6065, 6066, 6066, 6126, 6064, 6125, 6064, 6126, 6064, 6125, 6128, 6126, 6124, 6125, 6123, 6125, 6124, 6125, 6123, 6158, 6158, 6128, 6125, 6124, 6122, 6123, 6121, 6123, 6122, 6123, 6121, 6157, 6157, 6158, 6123, 6190, 6158, 6189, 6157, 6189, 6158, 6158, 6190, 6128, 6156, 6157, 6121, 6188, 6157, 6156, 6189, 6157, 6188, 6220, 6189, 6188, 6221, 6189, 6220, 6189, 6221, 6190, 6187, 6188, 6155, 6156, 6155, 6188, 6188, 6187, 6220, 6121, 6119, 6156, 6155, 6156, 6119, 6119, 6154, 6155, 6155, 6186, 6187, 6186, 6155, 6154, 6218, 6187, 6186, 6218, 6219, 6187, 6219, 6220, 6187, 6154, 6153, 6186, 6185, 6186, 6153, 6186, 6217, 6218, 6217, 6186, 6185, 6117, 6153, 6154, 6154, 6119, 6117, 6115, 6152, 6153, 6115, 6153, 6117, 6153, 6152, 6185, 6184, 6185, 6152, 6185, 6216, 6217, 6184, 6216, 6185, 6113, 6151, 6152, 6113, 6152, 6115, 6152, 6151, 6184, 6116, 6113, 6115, 6118, 6115, 6117, 6116, 6115, 6118, 6114, 6111, 6113, 6114, 6113, 6116, 6111, 6151, 6113, 6112, 6111, 6114, 6112, 6110, 6111, 6109, 6111, 6110, 6111, 6109, 6151, 6110, 6108, 6109, 6107, 6109, 6108, 6109, 6107, 6150, 6150, 6151, 6109, 6108, 6106, 6107, 6105, 6107, 6106, 6107, 6105, 6149, 6149, 6150, 6107, 6182, 6150, 6181, 6149, 6181, 6150, 6150, 6182, 6151, 6148, 6149, 6105, 6181, 6149, 6180, 6148, 6180, 6149, 6213, 6181, 6212, 6180, 6212, 6181, 6181, 6213, 6182, 6180, 6148, 6179, 6212, 6180, 6211, 6179, 6211, 6180, 6105, 6104, 6148, 6147, 6148, 6104, 6147, 6179, 6148, 6179, 6147, 6178, 6179, 6178, 6211, 6210, 6211, 6178, 6178, 6146, 6177, 6178, 6147, 6146, 6178, 6177, 6210, 6104, 6146, 6147, 6104, 6103, 6102, 6104, 6105, 6103, 6102, 6146, 6104, 6146, 6102, 6145, 6177, 6146, 6145, 6102, 6101, 6100, 6101, 6102, 6103, 6100, 6145, 6102, 6106, 6103, 6105, 6145, 6100, 6144, 6176, 6145, 6144, 6176, 6177, 6145, 6100, 6099, 6098, 6099, 6100, 6101, 6098, 6144, 6100, 6144, 6098, 6143, 6144, 6143, 6176, 6175, 6176, 6143, 6176, 6175, 6208, 6208, 6177, 6176, 6095, 6093, 6143, 6142, 6143, 6093, 6095, 6143, 6098, 6143, 6142, 6175, 6098, 6097, 6095, 6097, 6098, 6099, 6096, 6094, 6095, 6093, 6095, 6094, 6096, 6095, 6097, 6094, 6092, 6093, 6091, 6093, 6092, 6093, 6091, 6142, 6141, 6142, 6091, 6142, 6141, 6174, 6174, 6175, 6142, 6092, 6090, 6091, 6089, 6091, 6090, 6091, 6089, 6141, 6140, 6141, 6089, 6141, 6140, 6173, 6173, 6174, 6141, 6174, 6173, 6206, 6175, 6174, 6207, 6206, 6207, 6174, 6207, 6208, 6175, 6208, 6209, 6177, 6209, 6210, 6177, 6205, 6206, 6173, 6172, 6173, 6140, 6173, 6172, 6205, 6204, 6205, 6172, 6140, 6139, 6172, 6171, 6172, 6139, 6172, 6171, 6204, 6203, 6204, 6171, 6139, 6138, 6171, 6170, 6171, 6138, 6171, 6170, 6203, 6139, 6088, 6138, 6139, 6140, 6088, 6138, 6086, 6137, 6138, 6088, 6086, 6138, 6137, 6170, 6169, 6170, 6137, 6170, 6169, 6202, 6202, 6203, 6170, 6137, 6084, 6136, 6137, 6086, 6084, 6169, 6137, 6168, 6136, 6168, 6137, 6169, 6168, 6201, 6201, 6202, 6169, 6167, 6168, 6135, 6136, 6135, 6168, 6168, 6167, 6200, 6200, 6201, 6168, 6136, 6082, 6135, 6136, 6084, 6082, 6134, 6135, 6077, 6079, 6077, 6135, 6135, 6082, 6079, 6135, 6134, 6167, 6082, 6081, 6079, 6082, 6083, 6081, 6084, 6083, 6082, 6077, 6079, 6078, 6080, 6078, 6079, 6079, 6081, 6080, 6078, 6076, 6077, 6075, 6077, 6076, 6077, 6075, 6134, 6076, 6074, 6075, 6073, 6075, 6074, 6075, 6073, 6133, 6133, 6134, 6075, 6074, 6072, 6073, 6071, 6073, 6072, 6073, 6071, 6132, 6132, 6133, 6073, 6133, 6132, 6165, 6165, 6166, 6133, 6134, 6133, 6166, 6166, 6167, 6134, 6166, 6165, 6198, 6198, 6199, 6166, 6167, 6166, 6199, 6164, 6165, 6132, 6165, 6164, 6197, 6197, 6198, 6165, 6131, 6132, 6071, 6132, 6131, 6164, 6163, 6164, 6131, 6164, 6163, 6196, 6196, 6197, 6164, 6071, 6130, 6131, 6131, 6130, 6163, 6162, 6163, 6130, 6163, 6162, 6195, 6195, 6196, 6163, 6069, 6129, 6130, 6130, 6071, 6069, 6130, 6161, 6162, 6129, 6161, 6130, 6162, 6193, 6194, 6161, 6193, 6162, 6194, 6195, 6162, 6161, 6129, 6159, 6193, 6161, 6191, 6159, 6191, 6161, 6127, 6128, 6159, 6160, 6159, 6128, 6127, 6159, 6129, 6159, 6160, 6191, 6192, 6191, 6160, 6160, 6128, 6190, 6192, 6160, 6222, 6190, 6222, 6160, 6222, 6190, 6221, 6067, 6127, 6129, 6129, 6069, 6067, 6070, 6067, 6069, 6067, 6070, 6068, 6072, 6069, 6071, 6069, 6072, 6070, 6199, 6200, 6167, 6084, 6085, 6083, 6086, 6085, 6084, 6086, 6087, 6085, 6088, 6087, 6086, 6090, 6087, 6089, 6088, 6089, 6087, 6089, 6088, 6140, 6151, 6182, 6183, 6214, 6182, 6213, 6182, 6214, 6183, 6183, 6184, 6151, 6183, 6214, 6215, 6183, 6215, 6184, 6184, 6215, 6216, 6118, 6117, 6120, 6120, 6117, 6119, 6122, 6120, 6121, 6119, 6121, 6120
-};
@@ -1,26 +0,0 @@
-size_t mVertexCount = 4;
-size_t mIndexCount = 6;
-
-float mPositions[] = {
--1, 0, -1, 1, 0, -1, 1, 0, 1, -1, 0, 1
-};
-
-float mUVs[] = {
-0, 1, 1, 1, 1, 0, 0, 0
-};
-
-float mNormals[] = {
-0, 1, -0, 0, 1, -0, 0, 1, -0, 0, 1, -0
-};
-
-float mTangents[] = {
-1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0
-};
-
-float mBitangents[] = {
-0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1
-};
-
-uint32_t mIndices[] = {
-3, 2, 1, 3, 1, 0
-};
@@ -48,6 +48,8 @@ namespace Morpheus {
 		// Does not take into account the transform of this node
 		DG::float4x4 GetProjection(DG::ISwapChain* swapChain, bool bIsGL) const;
 		DG::float4x4 GetProjection(RealtimeGraphics& graphics) const;
+		// For a viewport with the given width / height and no surface pretransform
+		DG::float4x4 GetProjection(float aspectRatio, bool bIsGL) const;
 		
 		DG::float3 GetEye() const;
 
@@ -151,5 +153,9 @@ namespace Morpheus {
 	
 		HLSL::CameraAttribs GetLocalAttribs(RealtimeGraphics& graphics);
 		HLSL::CameraAttribs GetTransformedAttribs(entt::entity entity, entt::registry* registry, RealtimeGraphics& graphics);
+
+		// transform is the world transform of the camera node, or nullptr if it has none
+		HLSL::CameraAttribs GetTransformedAttribs(const DG::float4x4* transform, DG::ISwapChain* swapChain, bool bIsGL);
+		HLSL::CameraAttribs GetTransformedAttribs(const DG::float4x4* transform, RealtimeGraphics& graphics);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <vector>
+
+// Checks component accesses made through Frame against the access declared
+// by the task that is currently running. On by default in debug builds.
+#if !defined(NDEBUG) && !defined(COMPONENT_ACCESS_DEBUG)
+#define COMPONENT_ACCESS_DEBUG
+#endif
+
+namespace Morpheus {
+
+	// The components a task reads and writes. Tasks whose accesses do not
+	// conflict may run at the same time.
+	struct ComponentAccess {
+		std::vector<entt::id_type> mReads;
+		std::vector<entt::id_type> mWrites;
+		// Creates or destroys entities, which conflicts with everything
+		bool bExclusive = false;
+
+		template <typename... T>
+		inline ComponentAccess& Read() {
+			(mReads.push_back(entt::type_id<T>().hash()), ...);
+			return *this;
+		}
+
+		template <typename... T>
+		inline ComponentAccess& Write() {
+			(mWrites.push_back(entt::type_id<T>().hash()), ...);
+			return *this;
+		}
+
+		inline ComponentAccess& Exclusive() {
+			bExclusive = true;
+			return *this;
+		}
+
+		bool CanRead(entt::id_type component) const;
+		bool CanWrite(entt::id_type component) const;
+		bool ConflictsWith(const ComponentAccess& other) const;
+	};
+
+	// Makes access the declared access of the calling thread until destroyed.
+	// ParallelFor passes the access of its caller on to its helper tasks.
+	class ComponentAccessScope {
+	private:
+		const ComponentAccess* mPrevious;
+
+	public:
+		ComponentAccessScope(const ComponentAccess* access);
+		~ComponentAccessScope();
+
+		ComponentAccessScope(const ComponentAccessScope&) = delete;
+		ComponentAccessScope& operator=(const ComponentAccessScope&) = delete;
+	};
+
+	// nullptr if the calling thread is not running a task with declared access
+	const ComponentAccess* GetCurrentComponentAccess();
+
+	void ThrowUndeclaredAccess(const char* kind, entt::type_info type);
+
+	template <typename T>
+	inline void CheckComponentRead() {
+#ifdef COMPONENT_ACCESS_DEBUG
+		auto access = GetCurrentComponentAccess();
+		if (access && !access->CanRead(entt::type_id<T>().hash()))
+			ThrowUndeclaredAccess("read", entt::type_id<T>());
+#endif
+	}
+
+	template <typename T>
+	inline void CheckComponentWrite() {
+#ifdef COMPONENT_ACCESS_DEBUG
+		auto access = GetCurrentComponentAccess();
+		if (access && !access->CanWrite(entt::type_id<T>().hash()))
+			ThrowUndeclaredAccess("write", entt::type_id<T>());
+#endif
+	}
+
+	inline void CheckStructuralChange() {
+#ifdef COMPONENT_ACCESS_DEBUG
+		auto access = GetCurrentComponentAccess();
+		if (access && !access->bExclusive)
+			ThrowUndeclaredAccess("create or destroy", entt::type_id<entt::entity>());
+#endif
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Engine/Defines.hpp>
+
+namespace DG = Diligent;
+
+namespace Morpheus {
+
+	// Lights shine from the translation of their RendererTransformCache. Their
+	// light reaches no further than mRange.
+	struct PointLightComponent {
+		DG::float3 mColor = DG::float3(1.0f, 1.0f, 1.0f);
+		float mIntensity = 1.0f;
+		float mRange = 10.0f;
+
+		inline PointLightComponent() {
+		}
+
+		inline PointLightComponent(const DG::float3& color, float intensity, float range) :
+			mColor(color), mIntensity(intensity), mRange(range) {
+		}
+	};
+
+	// Shines down the local +z axis. Angles are from the axis to the edge of
+	// the cone, in radians; light fades out between the inner and outer angle.
+	struct SpotLightComponent {
+		DG::float3 mColor = DG::float3(1.0f, 1.0f, 1.0f);
+		float mIntensity = 1.0f;
+		float mRange = 10.0f;
+		float mInnerAngle = DG::PI_F / 8.0f;
+		float mOuterAngle = DG::PI_F / 6.0f;
+
+		inline SpotLightComponent() {
+		}
+
+		inline SpotLightComponent(const DG::float3& color, float intensity, float range,
+			float innerAngle, float outerAngle) :
+			mColor(color), mIntensity(intensity), mRange(range),
+			mInnerAngle(innerAngle), mOuterAngle(outerAngle) {
+		}
+	};
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Engine/GeometryStructures.hpp>
+
+#include <memory>
+
+namespace Morpheus {
+	// A few triangles that stand in for a mesh when rendering occlusion. They
+	// should stay inside the surface they stand in for, or things visible
+	// around the edges of the real mesh may be culled.
+	struct OccluderMesh {
+		std::vector<DG::float3> mVertices;
+		std::vector<uint32_t> mIndices;
+
+		static inline std::shared_ptr<OccluderMesh> Box(const BoundingBox& box) {
+			auto mesh = std::make_shared<OccluderMesh>();
+
+			for (int i = 0; i < 8; ++i) {
+				mesh->mVertices.emplace_back(
+					(i & 1) ? box.mUpper.x : box.mLower.x,
+					(i & 2) ? box.mUpper.y : box.mLower.y,
+					(i & 4) ? box.mUpper.z : box.mLower.z);
+			}
+
+			// Occluders are drawn from both sides, so the winding does not matter
+			mesh->mIndices = {
+				0, 1, 3, 0, 3, 2,
+				4, 5, 7, 4, 7, 6,
+				0, 1, 5, 0, 5, 4,
+				2, 3, 7, 2, 7, 6,
+				0, 2, 6, 0, 6, 4,
+				1, 3, 7, 1, 7, 5
+			};
+
+			return mesh;
+		}
+	};
+
+	// Marks an entity as an occluder. Uses the same transform as a static mesh.
+	struct OccluderComponent {
+		std::shared_ptr<const OccluderMesh> mMesh;
+
+		inline OccluderComponent() {
+		}
+
+		inline OccluderComponent(std::shared_ptr<const OccluderMesh> mesh) :
+			mMesh(std::move(mesh)) {
+		}
+	};
+}
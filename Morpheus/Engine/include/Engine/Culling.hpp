@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Engine/Camera.hpp>
+#include <Engine/GeometryStructures.hpp>
+#include <Engine/RenderSnapshot.hpp>
+
+// Static meshes tested by a single task
+#define CULL_CHUNK_SIZE 2048
+
+namespace Morpheus {
+
+	// Row-vector view matrix of a camera. transform is the world transform
+	// of the camera node, or nullptr if it has none.
+	DG::float4x4 GetCameraView(const Camera& camera,
+		const DG::float4x4* transform);
+
+	// Row-vector view projection of a camera, transform as above
+	DG::float4x4 GetCameraViewProjection(const Camera& camera,
+		const DG::float4x4* transform,
+		const DG::float4x4& projection);
+
+	enum class FrustumPlane {
+		LEFT,
+		RIGHT,
+		BOTTOM,
+		TOP,
+		// NEAR and FAR are macros on Windows
+		ZNEAR,
+		ZFAR
+	};
+
+	// The six planes of a view frustum as (normal, distance), with normals
+	// pointing inwards. The planes are also kept as columns, so a box is
+	// tested against four planes at once where SSE is available.
+	class Frustum {
+	private:
+		DG::float4 mPlanes[6];
+
+		// Planes 0-3 and 4-5, the last two repeated to fill the lanes
+		alignas(16) float mNormalX[8];
+		alignas(16) float mNormalY[8];
+		alignas(16) float mNormalZ[8];
+		alignas(16) float mDistance[8];
+
+	public:
+		// viewProj is a row-vector view projection matrix. The near plane is
+		// at z = -w for GL and z = 0 for everything else.
+		Frustum(const DG::float4x4& viewProj, bool bIsGL);
+
+		// transform is the world transform of the camera node, or nullptr if it has none
+		static Frustum FromCamera(const Camera& camera,
+			const DG::float4x4* transform,
+			const DG::float4x4& projection,
+			bool bIsGL);
+
+		inline const DG::float4& GetPlane(FrustumPlane plane) const {
+			return mPlanes[(int)plane];
+		}
+
+		// Tests box, in the local space of the row-vector affine transform, as
+		// an oriented box. May keep boxes that are just outside a corner of the
+		// frustum. Empty boxes are always visible.
+		bool IsVisible(const BoundingBox& box, const DG::float4x4& transform) const;
+		bool IsVisible(const BoundingBox& box) const;
+	};
+
+	// Writes the indices of the instances whose geometry bounds intersect the
+	// frustum to visible, in their original order. Instances are tested in
+	// chunks across the queue.
+	void CullStaticMeshes(const Frustum& frustum,
+		const ArenaArray<StaticMeshInstance>& instances,
+		std::vector<uint32_t>* visible,
+		ITaskQueue* queue = nullptr);
+}
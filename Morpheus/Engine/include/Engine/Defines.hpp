@@ -19,6 +19,8 @@ namespace Morpheus {
 	class TaskGroup;
 	struct TaskBarrier;
 	struct Task;
+	class CompiledTaskGraph;
+	struct CompiledTaskGraphPin;
 
 	template <typename T>
 	class Future;
@@ -78,6 +80,8 @@ namespace Morpheus {
 
 	class Texture;
 	class Geometry;
+	class GeometryBVH;
+	struct PackedGeometry;
 
 	template <typename T>
 	struct LoadParams;
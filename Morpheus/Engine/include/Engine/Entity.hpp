@@ -142,24 +142,30 @@ namespace Morpheus {
 			if (data.mParent != entt::null) {
 				HierarchyData& parentData = registry.get<HierarchyData>(data.mParent);
 
-				if (parentData.mFirstChild == ent) {
+				if (parentData.mFirstChild == ent)
 					parentData.mFirstChild = data.mNext;
-					if (data.mNext != entt::null) {
-						HierarchyData& nextData = registry.get<HierarchyData>(data.mNext);
-						nextData.mPrevious = entt::null;
-					}
-				}
 
-				if (parentData.mLastChild == ent) {
+				if (parentData.mLastChild == ent)
 					parentData.mLastChild = data.mPrevious;
-					if (data.mPrevious != entt::null) {
-						HierarchyData& prevData = registry.get<HierarchyData>(data.mPrevious);
-						prevData.mNext = entt::null;
-					}
-				}
+			}
+
+			// Unlink from the siblings, wherever this node is in the list
+			if (data.mNext != entt::null) {
+				HierarchyData& nextData = registry.get<HierarchyData>(data.mNext);
+				nextData.mPrevious = data.mPrevious;
+			}
+
+			if (data.mPrevious != entt::null) {
+				HierarchyData& prevData = registry.get<HierarchyData>(data.mPrevious);
+				prevData.mNext = data.mNext;
 			}
 
 			data.mParent = entt::null;
+			data.mPrevious = entt::null;
+			data.mNext = entt::null;
+
+			// Let observers know that the hierarchy has changed
+			registry.patch<HierarchyData>(ent);
 		}
 
 		static void AddChild(entt::registry& registry, entt::entity parent, entt::entity newChild) {
@@ -186,6 +192,8 @@ namespace Morpheus {
 			}
 
 			childData.mParent = parent;
+
+			registry.patch<HierarchyData>(newChild);
 		}
 	};
 }
\ No newline at end of file
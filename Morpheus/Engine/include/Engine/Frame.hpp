@@ -2,6 +2,7 @@
 
 #include <Engine/Entity.hpp>
 #include <Engine/Camera.hpp>
+#include <Engine/ComponentAccess.hpp>
 #include <stack>
 
 namespace Morpheus {
@@ -99,6 +100,8 @@ namespace Morpheus {
 		entt::registry mRegistry;
 		entt::entity mRoot;
 		entt::entity mCamera = entt::null;
+		// Published when the frame is destroyed, while the registry is still intact
+		entt::sigh<void(Frame&)> mDestroySignal;
 
 		inline entt::entity SpawnDefaultCamera(Camera** cameraOut = nullptr) {
 			auto cameraNode = CreateEntity();
@@ -115,6 +118,18 @@ namespace Morpheus {
 			mRegistry.emplace<HierarchyData>(mRoot);
 		}
 
+		inline ~Frame() {
+			// Listeners may disconnect from the signal while it is published
+			auto signal = std::move(mDestroySignal);
+			signal.publish(*this);
+		}
+
+		// Objects that connect to the registry detach through this before
+		// the frame goes away
+		inline entt::sink<void(Frame&)> OnDestroy() {
+			return entt::sink<void(Frame&)>(mDestroySignal);
+		}
+
 		inline void Orphan(entt::entity ent) {
 			HierarchyData::Orphan(mRegistry, ent);
 		}
@@ -125,6 +140,7 @@ namespace Morpheus {
 			AddChild(parent, child);
 		}
 		inline entt::entity CreateEntity(entt::entity parent) {
+			CheckStructuralChange();
 			auto e = mRegistry.create();
 			mRegistry.emplace<HierarchyData>(e);
 			AddChild(parent, e);
@@ -161,46 +177,55 @@ namespace Morpheus {
 			return DepthFirstNodeDoubleIterator(&mRegistry, subtree);
 		}
 		inline void Destroy(entt::entity ent) {
+			CheckStructuralChange();
 			Orphan(ent);
 
+			// Destroying a child orphans it, so the first child is always the next one
 			for (entt::entity child = GetFirstChild(ent); 
 				child != entt::null; 
-				child = GetNext(child)) 
+				child = GetFirstChild(ent)) 
 				Destroy(child);
 
 			mRegistry.destroy(ent);
 		}
 
 		inline Camera& CameraData() {
+			CheckComponentRead<Camera>();
 			return mRegistry.get<Camera>(mCamera);
 		}
 
 		inline const Camera& CameraData() const {
+			CheckComponentRead<Camera>();
 			return mRegistry.get<Camera>(mCamera);
 		}
 
 		template <typename T>
 		inline T& Get(entt::entity e) {
+			CheckComponentRead<T>();
 			return mRegistry.get<T>(e);
 		}
 
 		template <typename T>
 		inline T* TryGet(entt::entity e) {
+			CheckComponentRead<T>();
 			return mRegistry.try_get<T>(e);
 		}
 
 		template <typename T>
 		inline T& Replace(entt::entity e, const T& obj) {
+			CheckComponentWrite<T>();
 			return mRegistry.replace<T>(e, obj);
 		}
 
 		template <typename T>
 		inline T& Replace(entt::entity e, T&& obj) {
+			CheckComponentWrite<T>();
 			return mRegistry.replace<T>(e, std::move(obj));
 		}
 
 		template <typename T, typename... Args>
 		inline T& Emplace(entt::entity e, Args&&... args) {
+			CheckComponentWrite<T>();
 			return mRegistry.emplace<T>(e, std::forward<Args>(args)...);
 		}
 	};
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <Engine/GeometryStructures.hpp>
+#include <Engine/ThreadPool.hpp>
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#define BVH_SAH_BIN_COUNT 16
+#define BVH_MAX_LEAF_SIZE 4
+#define BVH_MAX_DEPTH 64
+#define BVH_PARALLEL_GRAIN 4096
+
+namespace Morpheus {
+
+	struct BVHNode {
+		BoundingBox mBounds;
+		// Interior nodes: index of the right child, the left child immediately follows this node.
+		// Leaf nodes: index of the first triangle in the leaf.
+		uint32_t mOffset;
+		// Number of triangles in a leaf, zero for interior nodes.
+		uint32_t mCount;
+
+		inline bool IsLeaf() const {
+			return mCount > 0;
+		}
+	};
+
+	struct BVHHit {
+		// Distance along the ray in units of the ray direction
+		float mDistance = std::numeric_limits<float>::infinity();
+		// Index of the triangle in the original geometry
+		uint32_t mTriangle = 0;
+		// Barycentric coordinates of the hit with respect to the second and third vertices
+		DG::float2 mBarycentrics = DG::float2(0.0f, 0.0f);
+	};
+
+	// Ray with a precomputed reciprocal direction for repeated slab tests
+	struct PrecomputedRay {
+		DG::float3 mStart;
+		DG::float3 mInvDirection;
+
+		inline PrecomputedRay(const Ray& ray) : mStart(ray.mStart) {
+			mInvDirection = DG::float3(
+				1.0f / ray.mDirection.x,
+				1.0f / ray.mDirection.y,
+				1.0f / ray.mDirection.z);
+		}
+
+		// Returns the entry distance into the box, or infinity if the ray misses it
+		inline float Intersect(const BoundingBox& box, float tMax) const {
+			float tx1 = (box.mLower.x - mStart.x) * mInvDirection.x;
+			float tx2 = (box.mUpper.x - mStart.x) * mInvDirection.x;
+			float tmin = std::min(tx1, tx2);
+			float tmax = std::max(tx1, tx2);
+
+			float ty1 = (box.mLower.y - mStart.y) * mInvDirection.y;
+			float ty2 = (box.mUpper.y - mStart.y) * mInvDirection.y;
+			tmin = std::max(tmin, std::min(ty1, ty2));
+			tmax = std::min(tmax, std::max(ty1, ty2));
+
+			float tz1 = (box.mLower.z - mStart.z) * mInvDirection.z;
+			float tz2 = (box.mUpper.z - mStart.z) * mInvDirection.z;
+			tmin = std::max(tmin, std::min(tz1, tz2));
+			tmax = std::min(tmax, std::max(tz1, tz2));
+
+			tmin = std::max(tmin, 0.0f);
+
+			if (tmax >= tmin && tmin < tMax)
+				return tmin;
+			else
+				return std::numeric_limits<float>::infinity();
+		}
+	};
+
+	// A binned SAH bounding volume hierarchy over the triangles of a geometry.
+	// Nodes are stored depth-first in a flat array, and triangles are
+	// reordered so that each leaf references a contiguous range.
+	class GeometryBVH {
+	private:
+		std::vector<BVHNode> mNodes;
+		std::vector<DG::float3> mPositions;
+		// Triangle vertex indices in leaf order
+		std::vector<uint32_t> mIndices;
+		// Original triangle index for every triangle in leaf order
+		std::vector<uint32_t> mTriangles;
+
+		void RefitNodes();
+
+	public:
+		// Builds the BVH from the raw aspect of the given geometry. Subtrees
+		// are built as separate tasks on whatever queue runs the returned task.
+		Task BuildTask(const Geometry* geometry);
+
+		inline void Build(const Geometry* geometry) {
+			BuildTask(geometry)();
+		}
+
+		inline void Build(const Geometry& geometry) {
+			Build(&geometry);
+		}
+
+		Task BuildTask(std::vector<DG::float3>&& positions,
+			std::vector<uint32_t>&& indices);
+
+		inline void Build(std::vector<DG::float3>&& positions,
+			std::vector<uint32_t>&& indices) {
+			BuildTask(std::move(positions), std::move(indices))();
+		}
+
+		// Updates node bounds for new vertex positions without changing the tree topology.
+		// The vertex count must match the geometry this BVH was built from.
+		void Refit(const Geometry& geometry);
+		void Refit(const DG::float3* positions, size_t count);
+
+		bool IntersectClosest(const Ray& ray, BVHHit* hit,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+		bool IntersectAny(const Ray& ray,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+
+		// Appends the original indices of all triangles that overlap the box.
+		void Query(const BoundingBox& box, std::vector<uint32_t>* triangles) const;
+
+		inline const std::vector<BVHNode>& GetNodes() const {
+			return mNodes;
+		}
+
+		inline const std::vector<DG::float3>& GetPositions() const {
+			return mPositions;
+		}
+
+		inline const std::vector<uint32_t>& GetIndices() const {
+			return mIndices;
+		}
+
+		inline const std::vector<uint32_t>& GetTriangles() const {
+			return mTriangles;
+		}
+
+		inline size_t GetTriangleCount() const {
+			return mTriangles.size();
+		}
+
+		inline BoundingBox GetBoundingBox() const {
+			if (mNodes.size() > 0)
+				return mNodes[0].mBounds;
+			else
+				return BoundingBox{DG::float3(0.0f, 0.0f, 0.0f), DG::float3(0.0f, 0.0f, 0.0f)};
+		}
+
+		inline bool IsEmpty() const {
+			return mNodes.size() == 0;
+		}
+
+		void Clear();
+
+		// Throws if the nodes do not form a depth-first tree of at most
+		// BVH_MAX_DEPTH levels, or reference triangles or vertices that do not exist
+		void Set(std::vector<BVHNode>&& nodes,
+			std::vector<DG::float3>&& positions,
+			std::vector<uint32_t>&& indices,
+			std::vector<uint32_t>&& triangles);
+
+		Task SaveTask(const std::string& path) const;
+		inline void Save(const std::string& path) const {
+			SaveTask(path)();
+		}
+
+		Task ReadArchiveTask(const std::string& path);
+		void ReadArchive(const uint8_t* rawArchive, const size_t length);
+		inline void ReadArchive(const std::string& path) {
+			ReadArchiveTask(path)();
+		}
+	};
+
+	// Builds a BVH over arbitrary primitive bounds on the calling thread. The order receives
+	// the primitive index of every leaf slot, leaves reference ranges of this array.
+	void BuildBVH(const std::vector<BoundingBox>& bounds,
+		std::vector<BVHNode>* nodes,
+		std::vector<uint32_t>* order);
+
+	// Extracts vertex positions and triangle indices from the raw aspect of a geometry
+	void ReadTriangles(const Geometry& geometry,
+		std::vector<DG::float3>* positions,
+		std::vector<uint32_t>* indices);
+
+	bool Intersects(const BoundingBox& a, const BoundingBox& b);
+	bool IntersectTriangle(const Ray& ray,
+		const DG::float3& a,
+		const DG::float3& b,
+		const DG::float3& c,
+		float tMax, float* t, DG::float2* barycentrics);
+	bool IntersectTriangle(const BoundingBox& box,
+		const DG::float3& a,
+		const DG::float3& b,
+		const DG::float3& c);
+}
@@ -3,12 +3,59 @@
 #include "BasicMath.hpp"
 #include "InputLayout.h"
 
+#include <limits>
+
 namespace DG = Diligent;
 
 namespace Morpheus {
 	struct BoundingBox {
 		DG::float3 mLower;
 		DG::float3 mUpper;
+
+		inline static BoundingBox Empty() {
+			constexpr float inf = std::numeric_limits<float>::infinity();
+			return BoundingBox{DG::float3(inf, inf, inf), DG::float3(-inf, -inf, -inf)};
+		}
+
+		inline void Grow(const DG::float3& point) {
+			mLower = DG::min(mLower, point);
+			mUpper = DG::max(mUpper, point);
+		}
+
+		inline void Grow(const BoundingBox& box) {
+			mLower = DG::min(mLower, box.mLower);
+			mUpper = DG::max(mUpper, box.mUpper);
+		}
+
+		inline DG::float3 Center() const {
+			return 0.5f * (mLower + mUpper);
+		}
+
+		inline DG::float3 Extents() const {
+			return mUpper - mLower;
+		}
+
+		inline float SurfaceArea() const {
+			DG::float3 d = mUpper - mLower;
+			if (d.x < 0.0f || d.y < 0.0f || d.z < 0.0f)
+				return 0.0f;
+			return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+		}
+
+		// Bounds of this box after transformation by a row-vector affine matrix
+		inline BoundingBox Transformed(const DG::float4x4& m) const {
+			DG::float3 c = Center();
+			DG::float3 e = 0.5f * Extents();
+			DG::float3 center(
+				c.x * m.m00 + c.y * m.m10 + c.z * m.m20 + m.m30,
+				c.x * m.m01 + c.y * m.m11 + c.z * m.m21 + m.m31,
+				c.x * m.m02 + c.y * m.m12 + c.z * m.m22 + m.m32);
+			DG::float3 extents(
+				e.x * std::abs(m.m00) + e.y * std::abs(m.m10) + e.z * std::abs(m.m20),
+				e.x * std::abs(m.m01) + e.y * std::abs(m.m11) + e.z * std::abs(m.m21),
+				e.x * std::abs(m.m02) + e.y * std::abs(m.m12) + e.z * std::abs(m.m22));
+			return BoundingBox{center - extents, center + extents};
+		}
 	};
 
 	struct BoundingBox2D {
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Engine/RenderSnapshot.hpp>
+
+// Instances packed by a single task
+#define INSTANCE_PACK_CHUNK_SIZE 1024
+
+namespace Morpheus {
+	// A range of instances, [mBegin, mEnd)
+	struct InstanceRange {
+		size_t mBegin;
+		size_t mEnd;
+	};
+
+	// CPU side copy of an instance buffer. It is kept from frame to frame, so
+	// packing only touches the entries whose transforms changed and records
+	// which ranges need to be uploaded. Knows nothing about the GPU.
+	//
+	// Entries are compared slot by slot in draw order, not per instance. That
+	// suits scenes where the visible set is steady. An instance that appears
+	// or disappears, or a batch that changes size, shifts every later slot, and
+	// all of those are uploaded again. Stable slots per instance would need
+	// the vertex shader to fetch transforms through an index, instead of
+	// reading them as per-instance vertex attributes.
+	class InstanceBuffer {
+	private:
+		std::vector<DG::float4x4> mData;
+		std::vector<InstanceRange> mChunkRanges;
+		std::vector<InstanceRange> mDirtyRanges;
+		size_t mDirtyCount = 0;
+
+	public:
+		// Packs the transposed transforms of instances[order[i]] at i, across
+		// the queue. Ranges that differ from the last pack become dirty.
+		void Pack(const ArenaArray<StaticMeshInstance>& instances,
+			const std::vector<uint32_t>& order,
+			ITaskQueue* queue = nullptr);
+
+		// The next pack marks everything dirty, for when the GPU copy is lost
+		void Invalidate();
+
+		inline const std::vector<DG::float4x4>& GetData() const {
+			return mData;
+		}
+
+		inline size_t Size() const {
+			return mData.size();
+		}
+
+		// Sorted and never adjacent to each other
+		inline const std::vector<InstanceRange>& GetDirtyRanges() const {
+			return mDirtyRanges;
+		}
+
+		// Number of instances in the dirty ranges
+		inline size_t GetDirtyCount() const {
+			return mDirtyCount;
+		}
+	};
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Engine/RenderSnapshot.hpp>
+
+// Default froxel grid: screen tiles across, tiles down and depth slices
+#define LIGHT_CLUSTERS_X 16
+#define LIGHT_CLUSTERS_Y 9
+#define LIGHT_CLUSTERS_Z 24
+
+namespace Morpheus {
+
+	// Range of LightClusters::GetIndices that lists the lights of a cluster
+	struct LightCluster {
+		uint32_t mOffset;
+		uint32_t mCount;
+	};
+
+	// Assigns lights to clusters of the view frustum: screen tiles, each cut
+	// into slices along the view depth that get exponentially thicker with
+	// distance. The view space bounds of the clusters only change with the
+	// projection, so they are kept between builds.
+	//
+	// Every slice is assigned by its own task. Lights are first tested against
+	// the bounds of the whole slice, then the survivors against every cluster of
+	// the slice four at a time where SSE is available: spheres against the
+	// cluster box, and spot light cones against the sphere around the cluster.
+	// The result is one offset and count per cluster into a single index list.
+	class LightClusters {
+	private:
+		struct Slice {
+			// Lights that touch the slice, and their view space data
+			std::vector<uint32_t> mCandidates;
+			std::vector<float> mX;
+			std::vector<float> mY;
+			std::vector<float> mZ;
+			std::vector<float> mRadius;
+			std::vector<float> mDirX;
+			std::vector<float> mDirY;
+			std::vector<float> mDirZ;
+			std::vector<float> mCos;
+			std::vector<float> mSin;
+			std::vector<float> mSpot;
+
+			// Light indices of every cluster in the slice, back to back
+			std::vector<uint32_t> mIndices;
+		};
+
+		struct ViewLight {
+			DG::float3 mPosition;
+			float mRadius;
+			DG::float3 mDirection;
+			float mCos;
+			float mSin;
+			bool bSpot;
+		};
+
+		uint mSizeX;
+		uint mSizeY;
+		uint mSizeZ;
+
+		DG::float4x4 mProjection;
+		float mNearZ = 0.0f;
+		float mFarZ = 0.0f;
+		bool bHasBounds = false;
+
+		std::vector<BoundingBox> mBounds;
+		std::vector<DG::float4> mSpheres;
+		std::vector<BoundingBox> mSliceBounds;
+
+		std::vector<ViewLight> mViewLights;
+		std::vector<Slice> mSlices;
+
+		std::vector<LightCluster> mClusters;
+		std::vector<uint32_t> mIndices;
+
+		void ComputeBounds(const DG::float4x4& projection, float nearZ, float farZ);
+		void AssignSlice(uint z);
+
+	public:
+		LightClusters(uint sizeX = LIGHT_CLUSTERS_X,
+			uint sizeY = LIGHT_CLUSTERS_Y,
+			uint sizeZ = LIGHT_CLUSTERS_Z);
+
+		// view and projection are the row-vector matrices of the camera, and
+		// nearZ and farZ its clip planes. Works for perspective and
+		// orthographic projections.
+		void Build(const DG::float4x4& view,
+			const DG::float4x4& projection,
+			float nearZ,
+			float farZ,
+			const ArenaArray<LightInstance>& lights,
+			ITaskQueue* queue = nullptr);
+
+		// Same, with the camera of a snapshot
+		void Build(const RenderSnapshot& snapshot,
+			const DG::float4x4& projection,
+			ITaskQueue* queue = nullptr);
+
+		// Slice a view space depth falls into, clamped to the grid
+		uint GetSlice(float depth) const;
+
+		// Tile row 0 is at the top of the screen
+		inline uint GetClusterIndex(uint x, uint y, uint z) const {
+			return x + mSizeX * (y + mSizeY * z);
+		}
+
+		inline const LightCluster& GetCluster(uint x, uint y, uint z) const {
+			return mClusters[GetClusterIndex(x, y, z)];
+		}
+
+		// View space bounds of a cluster
+		inline const BoundingBox& GetClusterBounds(uint x, uint y, uint z) const {
+			return mBounds[GetClusterIndex(x, y, z)];
+		}
+
+		inline const std::vector<LightCluster>& GetClusters() const {
+			return mClusters;
+		}
+
+		// Indices into the lights that were built from
+		inline const std::vector<uint32_t>& GetIndices() const {
+			return mIndices;
+		}
+
+		inline uint GetSizeX() const {
+			return mSizeX;
+		}
+
+		inline uint GetSizeY() const {
+			return mSizeY;
+		}
+
+		inline uint GetSizeZ() const {
+			return mSizeZ;
+		}
+	};
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <Engine/Renderer.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// A MaterialId is a slot index in its low bits and the generation of the
+// slot above them. Ids stay non-negative, so they never equal NullMaterialId.
+#define MATERIAL_INDEX_BITS 20
+#define MATERIAL_GENERATION_BITS 11
+// Slots are allocated in chunks that never move once created
+#define MATERIAL_TABLE_CHUNK_SIZE 1024
+
+namespace Morpheus {
+
+	// Dense storage for the materials of a renderer, indexed by generational
+	// ids. Looking up a material is an index into a chunk and a generation
+	// check, so ids of destroyed materials are caught instead of aliasing the
+	// material that reuses their slot. Creating a material with the same
+	// description as a live one returns the live one.
+	//
+	// Create and Flush must be called from one thread. Lookups may run on any
+	// thread, also while materials are created. AddRef and Release are thread
+	// safe and only take effect at the next Flush, which destroys the
+	// materials that are no longer referenced.
+	template <typename T>
+	class MaterialTable {
+	private:
+		static constexpr uint32_t IndexMask = (1u << MATERIAL_INDEX_BITS) - 1;
+		static constexpr uint32_t GenerationMask = (1u << MATERIAL_GENERATION_BITS) - 1;
+		static constexpr uint32_t MaxChunks = (1u << MATERIAL_INDEX_BITS) / MATERIAL_TABLE_CHUNK_SIZE;
+
+		struct Slot {
+			T mData;
+			MaterialDesc mDesc;
+			std::atomic<uint32_t> mGeneration = 0;
+			int mRefCount = 0;
+			bool bAlive = false;
+		};
+
+		std::unique_ptr<std::unique_ptr<Slot[]>[]> mChunks;
+		std::atomic<uint32_t> mSlotCount = 0;
+		std::vector<uint32_t> mFreeSlots;
+		std::unordered_multimap<MaterialDesc, uint32_t, MaterialDesc::Hasher> mByDesc;
+		size_t mLiveCount = 0;
+		uint mDeduplicatedCount = 0;
+
+		std::mutex mAddRefMutex;
+		std::mutex mReleaseMutex;
+		std::vector<MaterialId> mToAddRef;
+		std::vector<MaterialId> mToRelease;
+
+		inline Slot& GetSlot(uint32_t index) const {
+			return mChunks[index / MATERIAL_TABLE_CHUNK_SIZE][index % MATERIAL_TABLE_CHUNK_SIZE];
+		}
+
+		inline Slot* GetLiveSlot(MaterialId id) const {
+			if (id < 0)
+				return nullptr;
+
+			uint32_t index = IndexOf(id);
+			if (index >= mSlotCount.load(std::memory_order_acquire))
+				return nullptr;
+
+			auto& slot = GetSlot(index);
+			if (slot.mGeneration.load(std::memory_order_acquire) != GenerationOf(id))
+				return nullptr;
+
+			return &slot;
+		}
+
+		void Destroy(uint32_t index) {
+			auto& slot = GetSlot(index);
+
+			auto range = mByDesc.equal_range(slot.mDesc);
+			for (auto it = range.first; it != range.second; ++it) {
+				if (it->second == index) {
+					mByDesc.erase(it);
+					break;
+				}
+			}
+
+			// Outstanding ids stop matching before the slot is touched
+			slot.mGeneration.store((slot.mGeneration.load() + 1) & GenerationMask,
+				std::memory_order_release);
+			slot.mData = T();
+			slot.mDesc = MaterialDesc();
+			slot.mRefCount = 0;
+			slot.bAlive = false;
+
+			mFreeSlots.emplace_back(index);
+			--mLiveCount;
+		}
+
+	public:
+		inline MaterialTable() :
+			mChunks(new std::unique_ptr<Slot[]>[MaxChunks]) {
+		}
+
+		MaterialTable(const MaterialTable&) = delete;
+		MaterialTable& operator=(const MaterialTable&) = delete;
+
+		static inline uint32_t IndexOf(MaterialId id) {
+			return (uint32_t)id & IndexMask;
+		}
+
+		static inline uint32_t GenerationOf(MaterialId id) {
+			return ((uint32_t)id >> MATERIAL_INDEX_BITS) & GenerationMask;
+		}
+
+		static inline MaterialId MakeId(uint32_t index, uint32_t generation) {
+			return (MaterialId)((generation << MATERIAL_INDEX_BITS) | index);
+		}
+
+		// Returns the id of a live material with the same description if there
+		// is one. Otherwise create(desc) makes the data of a new material.
+		// Either way the caller owns one reference, which it must Release.
+		template <typename CreateT>
+		MaterialId Create(const MaterialDesc& desc, CreateT create) {
+			auto range = mByDesc.equal_range(desc);
+			if (range.first != range.second) {
+				uint32_t index = range.first->second;
+				auto& slot = GetSlot(index);
+				++slot.mRefCount;
+				++mDeduplicatedCount;
+				return MakeId(index, slot.mGeneration.load());
+			}
+
+			uint32_t index;
+			if (!mFreeSlots.empty()) {
+				index = mFreeSlots.back();
+				mFreeSlots.pop_back();
+			} else {
+				index = mSlotCount.load();
+				if (index > IndexMask)
+					throw std::runtime_error("Too many materials!");
+
+				auto& chunk = mChunks[index / MATERIAL_TABLE_CHUNK_SIZE];
+				if (!chunk)
+					chunk.reset(new Slot[MATERIAL_TABLE_CHUNK_SIZE]);
+			}
+
+			auto& slot = GetSlot(index);
+			slot.mData = create(desc);
+			slot.mDesc = desc;
+			slot.mRefCount = 1;
+			slot.bAlive = true;
+
+			// Only publish the slot once it is filled in
+			if (index == mSlotCount.load())
+				mSlotCount.store(index + 1, std::memory_order_release);
+
+			mByDesc.emplace(desc, index);
+			++mLiveCount;
+
+			return MakeId(index, slot.mGeneration.load());
+		}
+
+		// Null if the material does not exist (anymore)
+		inline T* TryGet(MaterialId id) {
+			auto slot = GetLiveSlot(id);
+			return slot ? &slot->mData : nullptr;
+		}
+
+		inline const T* TryGet(MaterialId id) const {
+			auto slot = GetLiveSlot(id);
+			return slot ? &slot->mData : nullptr;
+		}
+
+		inline const MaterialDesc* TryGetDesc(MaterialId id) const {
+			auto slot = GetLiveSlot(id);
+			return slot ? &slot->mDesc : nullptr;
+		}
+
+		inline bool Contains(MaterialId id) const {
+			return GetLiveSlot(id) != nullptr;
+		}
+
+		inline void AddRef(MaterialId id) {
+			std::lock_guard<std::mutex> lock(mAddRefMutex);
+			mToAddRef.emplace_back(id);
+		}
+
+		inline void Release(MaterialId id) {
+			std::lock_guard<std::mutex> lock(mReleaseMutex);
+			mToRelease.emplace_back(id);
+		}
+
+		// Applies the queued references, all additions before any release, and
+		// destroys the materials left without any. Returns how many were destroyed.
+		size_t Flush() {
+			std::vector<MaterialId> addRefs;
+			std::vector<MaterialId> releases;
+
+			{
+				std::lock_guard<std::mutex> lock(mAddRefMutex);
+				std::swap(addRefs, mToAddRef);
+			}
+			{
+				std::lock_guard<std::mutex> lock(mReleaseMutex);
+				std::swap(releases, mToRelease);
+			}
+
+			for (auto id : addRefs) {
+				auto slot = GetLiveSlot(id);
+				if (slot)
+					++slot->mRefCount;
+			}
+
+			size_t destroyed = 0;
+			for (auto id : releases) {
+				auto slot = GetLiveSlot(id);
+				if (slot && --slot->mRefCount <= 0) {
+					Destroy(IndexOf(id));
+					++destroyed;
+				}
+			}
+
+			return destroyed;
+		}
+
+		// Destroys every material, whether it is referenced or not
+		void Clear() {
+			for (uint32_t i = 0, count = mSlotCount.load(); i < count; ++i) {
+				if (GetSlot(i).bAlive)
+					Destroy(i);
+			}
+
+			std::lock_guard<std::mutex> addRefLock(mAddRefMutex);
+			std::lock_guard<std::mutex> releaseLock(mReleaseMutex);
+			mToAddRef.clear();
+			mToRelease.clear();
+		}
+
+		// Materials that are alive
+		inline size_t Size() const {
+			return mLiveCount;
+		}
+
+		// Slots ever used, alive or free
+		inline size_t Capacity() const {
+			return mSlotCount.load();
+		}
+
+		// Times Create returned an existing material
+		inline uint GetDeduplicatedCount() const {
+			return mDeduplicatedCount;
+		}
+
+		// Calls func(id, data) for every live material
+		template <typename FuncT>
+		void ForEach(FuncT func) {
+			for (uint32_t i = 0, count = mSlotCount.load(); i < count; ++i) {
+				auto& slot = GetSlot(i);
+				if (slot.bAlive)
+					func(MakeId(i, slot.mGeneration.load()), slot.mData);
+			}
+		}
+	};
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Engine/RenderSnapshot.hpp>
+
+// Size of the square screen tiles occluders are binned into. A multiple of 4.
+#define OCCLUSION_TILE_SIZE 32
+#define OCCLUSION_BUFFER_WIDTH 320
+#define OCCLUSION_BUFFER_HEIGHT 192
+
+namespace Morpheus {
+
+	// Low resolution depth buffer that occluders are rasterized into on the
+	// CPU, and that boxes are tested against before they are drawn. Depth is
+	// in [0, 1], with 0 closest, so projections must use the D3D convention.
+	//
+	// Occluder triangles are set up and clipped in parallel, binned into
+	// screen tiles and then every tile is rasterized by its own task, four
+	// pixels at a time where SSE is available. Every level of the hierarchy
+	// above the depth buffer holds the farthest depth of 2x2 texels below it.
+	class OcclusionBuffer {
+	public:
+		// A triangle in pixel space, as edge and depth plane equations
+		struct Triangle {
+			float mEdgeA[3];
+			float mEdgeB[3];
+			float mEdgeC[3];
+			float mDepthA;
+			float mDepthB;
+			float mDepthC;
+			int mMinX;
+			int mMinY;
+			int mMaxX;
+			int mMaxY;
+		};
+
+	private:
+		uint mWidth;
+		uint mHeight;
+		uint mTilesX;
+		uint mTilesY;
+
+		DG::float4x4 mViewProjection;
+
+		std::vector<std::vector<float>> mLevels;
+		std::vector<DG::uint2> mLevelSizes;
+
+		std::vector<std::vector<Triangle>> mOccluderTriangles;
+		std::vector<Triangle> mTriangles;
+		std::vector<std::vector<uint32_t>> mBins;
+
+		void SetupTriangles(const ArenaArray<OccluderInstance>& occluders, ITaskQueue* queue);
+		void BinTriangles();
+		void RasterizeTile(uint tile);
+		void BuildHierarchy();
+
+	public:
+		// width must be a multiple of 4
+		OcclusionBuffer(uint width = OCCLUSION_BUFFER_WIDTH,
+			uint height = OCCLUSION_BUFFER_HEIGHT);
+
+		// Clears the buffer and draws the occluders as seen through viewProj
+		void Render(const DG::float4x4& viewProj,
+			const ArenaArray<OccluderInstance>& occluders,
+			ITaskQueue* queue = nullptr);
+
+		// Whether any part of box, in the local space of transform, may be in
+		// front of the occluders. Boxes that cross the near plane or leave the
+		// screen are always visible.
+		bool IsVisible(const BoundingBox& box, const DG::float4x4& transform) const;
+		bool IsVisible(const BoundingBox& box) const;
+
+		inline uint GetWidth() const {
+			return mWidth;
+		}
+
+		inline uint GetHeight() const {
+			return mHeight;
+		}
+
+		// Level 0 is the depth buffer itself, rows top to bottom
+		inline uint GetLevelCount() const {
+			return (uint)mLevels.size();
+		}
+
+		inline const std::vector<float>& GetLevel(uint level) const {
+			return mLevels[level];
+		}
+
+		inline DG::uint2 GetLevelSize(uint level) const {
+			return mLevelSizes[level];
+		}
+
+		inline float GetDepth(uint x, uint y) const {
+			return mLevels[0][x + y * mWidth];
+		}
+	};
+
+	// Removes the instances that are hidden behind the occluders from visible,
+	// keeping the order of the rest
+	void OcclusionCullStaticMeshes(const OcclusionBuffer& buffer,
+		const ArenaArray<StaticMeshInstance>& instances,
+		std::vector<uint32_t>* visible,
+		ITaskQueue* queue = nullptr);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Engine/ThreadPool.hpp>
+
+#include <entt/entt.hpp>
+
+#include <type_traits>
+#include <vector>
+
+// Default number of entities processed by a single task
+#define PARALLEL_VIEW_CHUNK_SIZE 512
+
+namespace Morpheus {
+
+	template <typename ViewT, typename = void>
+	struct HasContiguousEntities : std::false_type {
+	};
+
+	// Single component views and groups expose their entities as one packed array
+	template <typename ViewT>
+	struct HasContiguousEntities<ViewT,
+		std::void_t<decltype(std::declval<const ViewT&>().data())>> : std::true_type {
+	};
+
+	// Returns the entities of an entt view or group as one array. Views over
+	// multiple components only find their matches while iterating, so those are
+	// gathered into storage first.
+	template <typename ViewT>
+	const entt::entity* GetViewEntities(const ViewT& view,
+		std::vector<entt::entity>* storage,
+		size_t* count) {
+		if constexpr (HasContiguousEntities<ViewT>::value) {
+			*count = view.size();
+			return view.data();
+		} else {
+			storage->clear();
+			storage->reserve(view.size_hint());
+			for (auto e : view)
+				storage->push_back(e);
+
+			*count = storage->size();
+			return storage->data();
+		}
+	}
+
+	// Splits the entities of an entt view or group into contiguous chunks and calls
+	// kernel(begin, end) on each of them across the queue. Returns once all chunks
+	// are done. The kernel may read and write the components of its own entities,
+	// but must not add or remove components or entities.
+	template <typename ViewT, typename KernelT>
+	void ParallelEachChunk(ITaskQueue* queue,
+		const ViewT& view,
+		KernelT&& kernel,
+		size_t chunkSize = PARALLEL_VIEW_CHUNK_SIZE,
+		TaskType type = TaskType::UNSPECIFIED) {
+		std::vector<entt::entity> storage;
+		size_t count;
+		auto entities = GetViewEntities(view, &storage, &count);
+
+		ParallelFor(queue, count, chunkSize, [entities, &kernel](size_t begin, size_t end) {
+			kernel(entities + begin, entities + end);
+		}, type);
+	}
+
+	// Calls kernel(entity) for every entity of the view across the queue. If the kernel
+	// takes (size_t, entt::entity), it also receives the position of the entity,
+	// which is below view.size() for single component views and groups.
+	template <typename ViewT, typename KernelT>
+	void ParallelEach(ITaskQueue* queue,
+		const ViewT& view,
+		KernelT&& kernel,
+		size_t chunkSize = PARALLEL_VIEW_CHUNK_SIZE,
+		TaskType type = TaskType::UNSPECIFIED) {
+		std::vector<entt::entity> storage;
+		size_t count;
+		auto entities = GetViewEntities(view, &storage, &count);
+
+		ParallelFor(queue, count, chunkSize, [entities, &kernel](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				if constexpr (std::is_invocable_v<KernelT&, size_t, entt::entity>)
+					kernel(i, entities[i]);
+				else
+					kernel(entities[i]);
+			}
+		}, type);
+	}
+}
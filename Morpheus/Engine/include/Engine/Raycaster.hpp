@@ -0,0 +1,145 @@
+#pragma once
+
+#include <Engine/Frame.hpp>
+#include <Engine/GeometryBVH.hpp>
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/Resources/Resource.hpp>
+
+#include <unordered_map>
+#include <memory>
+
+#define RAYCAST_BATCH_CHUNK_SIZE 256
+
+namespace Morpheus {
+
+	struct RaycastHit {
+		entt::entity mEntity = entt::null;
+		// Distance along the ray in units of the ray direction
+		float mDistance = std::numeric_limits<float>::infinity();
+		// Triangle of the instance geometry that was hit, or UINT32_MAX
+		// if the instance has no triangle BVH and only its bounds were tested.
+		uint32_t mTriangle = std::numeric_limits<uint32_t>::max();
+		DG::float2 mBarycentrics;
+		DG::float3 mPosition;
+
+		inline operator bool() const {
+			return mEntity != entt::null;
+		}
+	};
+
+	// Casts rays against all StaticMeshComponent entities of a frame. Instance bounds
+	// are kept in a SpatialIndex that is updated incrementally as meshes are added,
+	// removed or moved. Instances whose geometry has a triangle BVH are tested against
+	// their triangles, all others against their bounding boxes.
+	//
+	// Update must not run concurrently with queries; queries may run concurrently.
+	class Raycaster {
+	private:
+		struct Instance {
+			entt::entity mEntity;
+			const GeometryBVH* mBVH;
+			BoundingBox mLocalBounds;
+			BoundingBox mWorldBounds;
+			DG::float4x4 mWorldToLocal;
+		};
+
+		struct GeometryEntry {
+			Handle<Geometry> mGeometry;
+			std::shared_ptr<GeometryBVH> mBVH;
+		};
+
+		Frame* mFrame = nullptr;
+		bool bInstancesDirty = true;
+		bool bBuildTriangleBVHs = true;
+
+		std::unordered_map<entt::entity, Instance> mInstances;
+		std::unordered_map<const Geometry*, GeometryEntry> mGeometryBVHs;
+		std::vector<entt::entity> mChanged;
+		SpatialIndex mIndex;
+
+		uint mRefitCount = 0;
+
+		void OnChanged(entt::registry& registry, entt::entity e);
+		void OnFrameDestroyed(Frame& frame);
+		void Connect();
+		void Disconnect();
+
+		const GeometryBVH* GetBVH(Geometry* geometry);
+		// Returns false if the entity has nothing to cast against
+		bool UpdateInstance(entt::entity e, Instance* instance);
+		void Rebuild();
+
+		bool IntersectInstance(const Instance& instance, const Ray& ray,
+			float tMax, RaycastHit* hit) const;
+
+	public:
+		inline Raycaster() {
+		}
+
+		inline Raycaster(Frame* frame) {
+			SetFrame(frame);
+		}
+
+		~Raycaster();
+
+		Raycaster(const Raycaster&) = delete;
+		Raycaster& operator=(const Raycaster&) = delete;
+
+		// Detached again when either the raycaster or the frame is destroyed
+		void SetFrame(Frame* frame);
+
+		// Synchronizes the acceleration structure with the frame. Should be
+		// called after the transform cache has been updated.
+		void Update();
+
+		// Geometries that only live on the GPU have no raw aspect to build a BVH from.
+		// A BVH can be built before upload and registered for them here.
+		void SetGeometryBVH(Geometry* geometry, std::shared_ptr<GeometryBVH> bvh);
+
+		// Whether to build triangle BVHs for raw geometries automatically
+		inline void SetBuildTriangleBVHs(bool value) {
+			bBuildTriangleBVHs = value;
+		}
+
+		void ClearGeometryBVHs();
+
+		bool CastClosest(const Ray& ray, RaycastHit* hit,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+		bool CastAny(const Ray& ray,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+
+		// Batched queries, split into chunks that run as separate tasks
+		Task CastClosestTask(const Ray* rays, size_t count, RaycastHit* hits,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+		Task CastAnyTask(const Ray* rays, size_t count, bool* results,
+			float tMax = std::numeric_limits<float>::infinity()) const;
+
+		inline void CastClosest(const Ray* rays, size_t count, RaycastHit* hits,
+			float tMax = std::numeric_limits<float>::infinity()) const {
+			CastClosestTask(rays, count, hits, tMax)();
+		}
+
+		inline void CastAny(const Ray* rays, size_t count, bool* results,
+			float tMax = std::numeric_limits<float>::infinity()) const {
+			CastAnyTask(rays, count, results, tMax)();
+		}
+
+		inline size_t GetInstanceCount() const {
+			return mInstances.size();
+		}
+
+		inline const SpatialIndex& GetIndex() const {
+			return mIndex;
+		}
+
+		// Times the instance index was built from scratch
+		inline uint GetRebuildCount() const {
+			return mIndex.GetStats().mRebuildCount;
+		}
+
+		// Updates that only touched the instances that changed
+		inline uint GetRefitCount() const {
+			return mRefitCount;
+		}
+	};
+}
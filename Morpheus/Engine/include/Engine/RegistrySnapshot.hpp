@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Engine/Frame.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Morpheus {
+
+	// How a component type is copied in and out of snapshots
+	struct SnapshotComponentHooks {
+		entt::type_info mType;
+		bool bTrivial;
+		// Tag components, only the entities of their pool are kept
+		bool bEmpty;
+		size_t mSize;
+		// Copies count components into a new buffer and points data at them.
+		// Only used for components that are not trivially copyable.
+		std::shared_ptr<void> (*mCopy)(const void* values, size_t count, const void** data);
+		// Creates the pool of the component if the registry does not have it yet
+		void (*mAssure)(entt::registry& registry);
+		// Adds the tag to count entities. Only used for empty components.
+		void (*mInsertEmpty)(entt::registry& registry, const entt::entity* entities, size_t count);
+	};
+
+	template <typename T>
+	std::shared_ptr<void> CopySnapshotComponents(const void* values, size_t count, const void** data) {
+		auto begin = static_cast<const T*>(values);
+		auto copy = std::make_shared<std::vector<T>>(begin, begin + count);
+		*data = copy->data();
+		return copy;
+	}
+
+	template <typename T>
+	void AssureSnapshotPool(entt::registry& registry) {
+		registry.view<T>();
+	}
+
+	template <typename T>
+	void InsertSnapshotTags(entt::registry& registry, const entt::entity* entities, size_t count) {
+		registry.insert<T>(entities, entities + count);
+	}
+
+	// A copy of every entity and component of a registry. Pools of trivially
+	// copyable components are copied with memcpy, everything else is copied
+	// through the hooks registered with RegisterComponent. Restoring brings back
+	// the exact entity ids, so HierarchyData links and any other stored entity
+	// ids stay valid. Capturing into the same snapshot again reuses its memory.
+	class RegistrySnapshot {
+	private:
+		struct PoolSnapshot {
+			const SnapshotComponentHooks* mHooks = nullptr;
+			std::vector<entt::entity> mEntities;
+			std::vector<std::max_align_t> mTrivialData;
+			std::shared_ptr<void> mCopiedData;
+			const void* mData = nullptr;
+		};
+
+		std::vector<entt::entity> mEntities;
+		entt::entity mDestroyed = entt::null;
+		std::vector<PoolSnapshot> mPools;
+		size_t mPoolCount = 0;
+
+		entt::entity mRoot = entt::null;
+		entt::entity mCamera = entt::null;
+
+		static void RegisterHooks(const SnapshotComponentHooks& hooks);
+
+	public:
+		// Returns nullptr if the component type was never registered
+		static const SnapshotComponentHooks* FindHooks(entt::id_type type);
+
+		// Every component type with a non-empty pool must be registered before
+		// a registry containing it can be captured. Tag components are fine,
+		// their pools are restored from the list of entities alone.
+		template <typename T>
+		static void RegisterComponent() {
+			SnapshotComponentHooks hooks;
+			hooks.mType = entt::type_id<T>();
+			hooks.mAssure = &AssureSnapshotPool<T>;
+
+			if constexpr (std::is_empty_v<T>) {
+				hooks.bTrivial = false;
+				hooks.bEmpty = true;
+				hooks.mSize = 0;
+				hooks.mCopy = nullptr;
+				hooks.mInsertEmpty = &InsertSnapshotTags<T>;
+			} else {
+				hooks.bTrivial = std::is_trivially_copyable_v<T> &&
+					alignof(T) <= alignof(std::max_align_t);
+				hooks.bEmpty = false;
+				hooks.mSize = sizeof(T);
+				hooks.mCopy = &CopySnapshotComponents<T>;
+				hooks.mInsertEmpty = nullptr;
+			}
+
+			RegisterHooks(hooks);
+		}
+
+		// HierarchyData, Transform, Camera and the other components of the engine
+		static void RegisterEngineComponents();
+
+		void Capture(const entt::registry& registry);
+		// Replaces everything in registry with the contents of the snapshot
+		void Restore(entt::registry& registry) const;
+
+		// Also keep the root and camera of the frame
+		void Capture(const Frame& frame);
+		void Restore(Frame& frame) const;
+
+		inline size_t EntityCount() const {
+			return mEntities.size();
+		}
+
+		inline size_t PoolCount() const {
+			return mPoolCount;
+		}
+	};
+}
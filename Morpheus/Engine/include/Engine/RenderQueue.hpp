@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Engine/RenderSnapshot.hpp>
+
+#include <functional>
+#include <unordered_map>
+
+// Bits of a static mesh sort key, from most to least significant
+#define SORT_KEY_PIPELINE_BITS 8
+#define SORT_KEY_MATERIAL_BITS 20
+#define SORT_KEY_GEOMETRY_BITS 20
+#define SORT_KEY_DEPTH_BITS 16
+
+namespace Morpheus {
+	// Instances that share geometry and material, drawn with a single call
+	struct DrawBatch {
+		Geometry* mGeometry;
+		MaterialId mMaterial;
+		uint mFirstInstance;
+		uint mInstanceCount;
+	};
+
+	// What submitting the batches of a queue costs. Batches without a
+	// material are not drawn and are not counted.
+	struct RenderQueueStats {
+		uint mDrawCalls = 0;
+		uint mPipelineChanges = 0;
+		uint mMaterialChanges = 0;
+		uint mGeometryChanges = 0;
+	};
+
+	// Orders static mesh instances by a 64 bit key of pipeline, material,
+	// geometry and depth, so that every instance of the same geometry and
+	// material ends up in one batch and state changes happen as rarely as
+	// possible. Within a batch instances are front to back.
+	class RenderQueue {
+	public:
+		// Returns something that identifies the pipeline of a material; only
+		// equality matters
+		typedef std::function<const void*(MaterialId)> pipeline_func_t;
+
+	private:
+		std::vector<uint64_t> mKeys;
+		std::vector<uint64_t> mKeysScratch;
+		std::vector<uint32_t> mOrder;
+		std::vector<uint32_t> mOrderScratch;
+		std::vector<DrawBatch> mBatches;
+		RenderQueueStats mStats;
+
+		// Small ids for the key, assigned in the order things are first seen
+		std::unordered_map<MaterialId, uint32_t> mMaterialIds;
+		std::unordered_map<const void*, uint32_t> mPipelineIds;
+		std::unordered_map<Geometry*, uint32_t> mGeometryIds;
+		std::vector<uint32_t> mMaterialPipelines;
+
+		void SortKeys();
+		void EmitBatches(const ArenaArray<StaticMeshInstance>& instances,
+			const pipeline_func_t& pipelineOf);
+
+	public:
+		// visible indexes instances. eye is the world position depth is measured
+		// from and maxDepth is the distance of the last depth bucket. pipelineOf
+		// may be empty, in which case all materials share a pipeline.
+		void Build(const ArenaArray<StaticMeshInstance>& instances,
+			const std::vector<uint32_t>& visible,
+			const DG::float3& eye,
+			float maxDepth,
+			const pipeline_func_t& pipelineOf = nullptr);
+
+		// Depth is measured from the snapshot camera, if it has one
+		void Build(const RenderSnapshot& snapshot,
+			const std::vector<uint32_t>& visible,
+			const pipeline_func_t& pipelineOf = nullptr);
+
+		// Indices into the instances, in the order they should be packed
+		inline const std::vector<uint32_t>& GetOrder() const {
+			return mOrder;
+		}
+
+		// DrawBatch::mFirstInstance indexes GetOrder()
+		inline const std::vector<DrawBatch>& GetBatches() const {
+			return mBatches;
+		}
+
+		inline const RenderQueueStats& GetStats() const {
+			return mStats;
+		}
+	};
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Engine/Frame.hpp>
+#include <Engine/Camera.hpp>
+#include <Engine/Renderer.hpp>
+#include <Engine/Components/LightProbe.hpp>
+#include <Engine/Resources/Geometry.hpp>
+#include <Engine/Resources/Texture.hpp>
+#include <Engine/Components/OccluderComponent.hpp>
+
+#include <type_traits>
+
+// Size of the blocks a FrameArena allocates from
+#define FRAME_ARENA_BLOCK_SIZE (1u << 20)
+// Static meshes extracted by a single task
+#define EXTRACT_CHUNK_SIZE 1024
+
+namespace Morpheus {
+	class SpatialIndex;
+	class Frustum;
+
+	// Bump allocator for data that only lives for a single frame. Allocations are
+	// never freed individually; Reset releases everything at once and keeps the
+	// memory around for the next frame. Not thread safe.
+	class FrameArena {
+	private:
+		struct Block {
+			std::unique_ptr<uint8_t[]> mData;
+			size_t mSize;
+		};
+
+		std::vector<Block> mBlocks;
+		size_t mCurrentBlock = 0;
+		size_t mOffset = 0;
+		size_t mBlockSize;
+
+	public:
+		inline FrameArena(size_t blockSize = FRAME_ARENA_BLOCK_SIZE) :
+			mBlockSize(blockSize) {
+		}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment);
+		void Reset();
+		size_t Capacity() const;
+
+		template <typename T>
+		inline T* Allocate(size_t count) {
+			static_assert(std::is_trivially_destructible<T>::value,
+				"Destructors are not run on arena memory!");
+			return reinterpret_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+	};
+
+	template <typename T>
+	struct ArenaArray {
+		T* mData = nullptr;
+		size_t mCount = 0;
+
+		inline T* begin() const {
+			return mData;
+		}
+
+		inline T* end() const {
+			return mData + mCount;
+		}
+
+		inline size_t size() const {
+			return mCount;
+		}
+
+		inline bool empty() const {
+			return mCount == 0;
+		}
+
+		inline T& operator[](size_t i) const {
+			return mData[i];
+		}
+
+		inline void Allocate(FrameArena* arena, size_t count) {
+			mData = count > 0 ? arena->Allocate<T>(count) : nullptr;
+			mCount = count;
+		}
+	};
+
+	struct StaticMeshInstance {
+		DG::float4x4 mTransform;
+		Geometry* mGeometry;
+		MaterialId mMaterial;
+		entt::entity mEntity;
+	};
+
+	struct OccluderInstance {
+		DG::float4x4 mTransform;
+		const OccluderMesh* mMesh;
+	};
+
+	// A point or spot light in world space, laid out as three float4s so it
+	// can be uploaded as is. Point lights have a cone that covers everything.
+	struct LightInstance {
+		DG::float3 mPosition;
+		float mRange;
+		DG::float3 mColor;
+		float mCosOuterAngle;
+		DG::float3 mDirection;
+		float mCosInnerAngle;
+
+		inline bool IsSpot() const {
+			return mCosOuterAngle > -1.0f;
+		}
+	};
+
+	// Copy of everything the renderer needs from a frame. A snapshot is written
+	// during extraction and only read while rendering, so rendering a snapshot can
+	// overlap with the update of the next frame.
+	struct RenderSnapshot {
+		FrameArena mArena;
+
+		ArenaArray<StaticMeshInstance> mStaticMeshes;
+		ArenaArray<OccluderInstance> mOccluders;
+		ArenaArray<LightInstance> mLights;
+
+		bool bHasCamera = false;
+		Camera mCamera;
+		bool bHasCameraTransform = false;
+		DG::float4x4 mCameraTransform;
+
+		Handle<Texture> mSkybox;
+		bool bHasLightProbe = false;
+		LightProbe mLightProbe;
+
+		// Keeps the geometry and materials referenced by mStaticMeshes alive
+		// while rendering, even if the entities are destroyed by the update of
+		// the next frame
+		std::vector<Handle<Geometry>> mRetainedGeometry;
+		std::vector<Material> mRetainedMaterials;
+		std::vector<std::shared_ptr<const OccluderMesh>> mRetainedOccluders;
+
+		void Clear();
+	};
+
+	void ExtractStaticMeshes(Frame* frame, RenderSnapshot* snapshot, ITaskQueue* queue = nullptr);
+	// Only extracts the meshes whose bounds in index intersect frustum
+	void ExtractStaticMeshes(Frame* frame, RenderSnapshot* snapshot,
+		const SpatialIndex& index, const Frustum& frustum, ITaskQueue* queue = nullptr);
+	void ExtractOccluders(Frame* frame, RenderSnapshot* snapshot);
+	void ExtractLights(Frame* frame, RenderSnapshot* snapshot);
+	void ExtractCamera(Frame* frame, RenderSnapshot* snapshot);
+	void ExtractSkybox(Frame* frame, RenderSnapshot* snapshot);
+
+	// Extracts all of the above. The frame processor clears the snapshot before
+	// extraction starts; the arena must not be used by two extract tasks at once.
+	void ExtractRenderSnapshot(Frame* frame, RenderSnapshot* snapshot, ITaskQueue* queue = nullptr);
+
+	// Same, but only extracts the static meshes that index places inside the
+	// view of the camera, if there is one
+	void ExtractRenderSnapshot(Frame* frame, RenderSnapshot* snapshot,
+		const SpatialIndex& index, float aspectRatio, bool bIsGL, ITaskQueue* queue = nullptr);
+}
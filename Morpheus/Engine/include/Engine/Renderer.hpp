@@ -27,6 +27,18 @@ namespace Morpheus {
 		float mRoughnessFactor 		= 1.0f;
 		float mMetallicFactor 		= 1.0f;
 		float mDisplacementFactor 	= 1.0f;
+
+		// Channels that roughness and metallic are read from, since some
+		// formats pack both into one texture
+		uint mRoughnessChannel		= 0;
+		uint mMetallicChannel		= 0;
+
+		// Same type, same textures, same channels and same factors
+		bool operator==(const MaterialDesc& other) const;
+
+		struct Hasher {
+			std::size_t operator()(const MaterialDesc& desc) const;
+		};
 	};
 
 	struct MaterialDescFuture : public IVirtualTaskNodeOut {
@@ -43,6 +55,9 @@ namespace Morpheus {
 		float mMetallicFactor 		= 1.0f;
 		float mDisplacementFactor 	= 1.0f;
 
+		uint mRoughnessChannel		= 0;
+		uint mMetallicChannel		= 0;
+
 		MaterialDesc Get() const;
 		bool IsAvailable() const;
 		void Connect(TaskNodeInLock& lock) override;
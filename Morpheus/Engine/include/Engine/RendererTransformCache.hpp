@@ -3,6 +3,11 @@
 #include <Engine/Components/Transform.hpp>
 #include <Engine/Frame.hpp>
 
+#include <unordered_map>
+
+// Levels with more nodes than this are propagated across the thread pool
+#define TRANSFORM_PARALLEL_CHUNK_SIZE 2048
+
 namespace Morpheus {
 
 	struct RendererTransformCache {
@@ -32,29 +37,99 @@ namespace Morpheus {
 			mCache(transform.ToMatrix()) {
 		}
 
+		inline RendererTransformCache(const DG::float4x4& matrix) :
+			mCache(matrix) {
+		}
+
 		inline RendererTransformCache() :
 			mCache(DG::float4x4::Identity()) {
 			}
 	};
 
+	// out = a * b, SIMD accelerated where available. out may alias a or b.
+	void MultiplyTransforms(const DG::float4x4& a, const DG::float4x4& b, DG::float4x4* out);
+
+	// The entities with a Transform, flattened in depth sorted order and stored as
+	// structure of arrays. Every level is contiguous and every parent comes before
+	// its children, so world transforms can be propagated level by level.
+	struct FlatTransformHierarchy {
+		std::vector<entt::entity> mEntities;
+		// Index of the closest ancestor that has a Transform, or -1
+		std::vector<int32_t> mParents;
+		// Children of a node are contiguous in the next level, so the children of
+		// any contiguous range of nodes are contiguous as well
+		std::vector<uint32_t> mChildBegin;
+		std::vector<uint32_t> mChildCount;
+		// Level i is [mLevelOffsets[i], mLevelOffsets[i + 1])
+		std::vector<uint32_t> mLevelOffsets;
+		std::vector<DG::float4x4> mLocal;
+		std::vector<DG::float4x4> mWorld;
+		std::vector<uint8_t> mDirty;
+		std::unordered_map<entt::entity, uint32_t> mIndices;
+
+		inline size_t Size() const {
+			return mEntities.size();
+		}
+
+		inline size_t LevelCount() const {
+			return mLevelOffsets.empty() ? 0 : mLevelOffsets.size() - 1;
+		}
+
+		void Clear();
+	};
+
+	struct TransformUpdateStats {
+		// Changed nodes that have no changed ancestor
+		size_t mDirtyRoots = 0;
+		// World transforms recomputed, each dirty node counts once
+		size_t mNodesRecomputed = 0;
+		size_t mLevelsVisited = 0;
+		// Nodes taken out of and put back into the flat hierarchy by
+		// structural changes, a moved node counts for both
+		size_t mNodesRemoved = 0;
+		size_t mNodesInserted = 0;
+		bool bRebuiltHierarchy = false;
+	};
+
 	class TransformCacheUpdater {
 	private:
+		struct NodeRange {
+			uint32_t mBegin;
+			uint32_t mEnd;
+		};
+
 		entt::observer mTransformUpdateObs;
-		entt::observer mNewTransformObs;
-		Frame* mFrame;
-	
+		Frame* mFrame = nullptr;
+
+		FlatTransformHierarchy mHierarchy;
+		bool bHierarchyDirty = true;
+
+		std::vector<uint32_t> mPending;
+		// Entities whose place in the hierarchy changed since the last update,
+		// and the flat nodes whose subtrees they took with them
+		std::vector<entt::entity> mMoved;
+		std::vector<uint32_t> mRemovedRoots;
+		std::vector<uint32_t> mRoots;
+		std::vector<NodeRange> mFrontier;
+		std::vector<NodeRange> mNextFrontier;
+		std::vector<NodeRange> mUpdatedRanges;
+		TransformUpdateStats mStats;
+
+		void Connect();
+		void Disconnect();
+		void OnHierarchyChanged(entt::registry& registry, entt::entity e);
+		void OnFrameDestroyed(Frame& frame);
+
+		void Rebuild();
+		// Moves the changed subtrees in place, false if only a full rebuild will do
+		bool ApplyStructuralChanges();
+		void CoalesceDirty();
+		void Propagate(ITaskQueue* queue);
+		void WriteBack();
+
 	public:
-		inline void SetFrame(Frame* frame) {
-			mTransformUpdateObs.clear();
-			mNewTransformObs.clear();
-
-			mTransformUpdateObs.connect(frame->mRegistry, 
-				entt::collector.update<Transform>());
-			mNewTransformObs.connect(frame->mRegistry, 
-				entt::collector.group<Transform>(entt::exclude<RendererTransformCache>));
-				
-			mFrame = frame;
-		}
+		// Detached again when either the updater or the frame is destroyed
+		void SetFrame(Frame* frame);
 
 		inline TransformCacheUpdater(Frame* frame) {
 			SetFrame(frame);
@@ -63,10 +138,30 @@ namespace Morpheus {
 		inline TransformCacheUpdater() {
 		}
 
-		void UpdateDescendants(entt::entity node, const DG::float4x4& matrix);
-		entt::entity FindTransformParent(entt::entity node);
-		void UpdateAll();
+		~TransformCacheUpdater();
+
+		TransformCacheUpdater(const TransformCacheUpdater&) = delete;
+		TransformCacheUpdater& operator=(const TransformCacheUpdater&) = delete;
+
+		// Marks a node whose Transform was modified without a registry update
 		void Update(entt::entity node);
-		void UpdateChanges();
+		// Recomputes every cached transform. If a queue is given, large levels
+		// are split across it.
+		void UpdateAll(ITaskQueue* queue = nullptr);
+		void UpdateChanges(ITaskQueue* queue = nullptr);
+
+		// Forces the flattened hierarchy to be rebuilt on the next update
+		inline void InvalidateHierarchy() {
+			bHierarchyDirty = true;
+		}
+
+		inline const FlatTransformHierarchy& Hierarchy() const {
+			return mHierarchy;
+		}
+
+		// Statistics of the last UpdateAll or UpdateChanges
+		inline const TransformUpdateStats& LastStats() const {
+			return mStats;
+		}
 	};
-}
\ No newline at end of file
+}
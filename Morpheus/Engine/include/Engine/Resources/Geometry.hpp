@@ -5,6 +5,8 @@
 #include <Engine/Graphics.hpp>
 #include <Engine/GeometryStructures.hpp>
 
+#include <memory>
+
 namespace Morpheus {
 	template <>
 	struct LoadParams<Geometry> {
@@ -69,10 +71,12 @@ namespace Morpheus {
 			std::vector<DG::BufferDesc> mVertexBufferDescs;
 			DG::BufferDesc mIndexBufferDesc;
 
-			std::vector<std::vector<uint8_t>> mVertexBufferDatas;
-			std::vector<uint8_t> mIndexBufferData;
+			// Buffer data is shared between copies of a geometry and is
+			// only ever replaced as a whole, never modified in place.
+			std::shared_ptr<const std::vector<std::vector<uint8_t>>> mVertexBufferDatas;
+			std::shared_ptr<const std::vector<uint8_t>> mIndexBufferData;
 
-			bool bHasIndexBuffer;
+			bool bHasIndexBuffer = false;
 		} mRawAspect;
 
 		// Stuff resident on an external device
@@ -162,6 +166,23 @@ namespace Morpheus {
 			ReadAssimpRawTask(params)();
 		}
 
+		// Native importers that bypass Assimp, see GeometryImport.cpp
+		Task ReadObjTask(const LoadParams<Geometry>& params);
+		inline void ReadObj(const LoadParams<Geometry>& params) {
+			ReadObjTask(params)();
+		}
+
+		Task ReadPlyTask(const LoadParams<Geometry>& params);
+		inline void ReadPly(const LoadParams<Geometry>& params) {
+			ReadPlyTask(params)();
+		}
+
+		// glTF 2.0 and GLB, see GltfImport.cpp
+		Task ReadGltfTask(const LoadParams<Geometry>& params);
+		inline void ReadGltf(const LoadParams<Geometry>& params) {
+			ReadGltfTask(params)();
+		}
+
 		Task ReadTask(const LoadParams<Geometry>& params);
 		inline void Read(const LoadParams<Geometry>& params) {
 			ReadTask(params)();
@@ -339,7 +360,7 @@ namespace Morpheus {
 		// -------------------------------------------------------------
 
 		inline int GetChannelCount() const {
-			return mRawAspect.mVertexBufferDatas.size();
+			return mRawAspect.mVertexBufferDatas ? mRawAspect.mVertexBufferDatas->size() : 0;
 		}
 
 		inline DG::IBuffer* GetVertexBuffer() {
@@ -355,17 +376,22 @@ namespace Morpheus {
 		}
 
 		inline const std::vector<uint8_t>& GetVertexData(int channel = 0) const {
-			assert(!(mFlags & RESOURCE_RAW_ASPECT));
-			return mRawAspect.mVertexBufferDatas[channel];
+			assert(mFlags & RESOURCE_RAW_ASPECT);
+			return (*mRawAspect.mVertexBufferDatas)[channel];
 		}
 
 		inline const std::vector<uint8_t>& GetIndexData() const {
-			assert(!(mFlags & RESOURCE_RAW_ASPECT));
-			return mRawAspect.mIndexBufferData;
+			assert(mFlags & RESOURCE_RAW_ASPECT);
+			static const std::vector<uint8_t> empty;
+			return mRawAspect.mIndexBufferData ? *mRawAspect.mIndexBufferData : empty;
+		}
+
+		inline bool HasIndexData() const {
+			return mRawAspect.bHasIndexBuffer;
 		}
 
 		inline const DG::BufferDesc& GetVertexDesc(int channel = 0) const {
-			assert(!(mFlags & RESOURCE_RAW_ASPECT));
+			assert(mFlags & RESOURCE_RAW_ASPECT);
 			return mRawAspect.mVertexBufferDescs[channel];
 		}
 
@@ -391,7 +417,24 @@ namespace Morpheus {
 
 		typedef LoadParams<Geometry> LoadParameters;
 
+		enum class Prefab {
+			MATERIAL_BALL,
+			BOX,
+			SPHERE,
+			BLENDER_MONKEY,
+			TORUS,
+			PLANE,
+			STANFORD_BUNNY,
+			UTAH_TEAPOT
+		};
+
 		struct Prefabs {
+			// Returns the raw prefab geometry for the given layout. Every prefab and layout
+			// is only unpacked once, later calls share the same geometry. The result must
+			// not be modified, use CopyFrom to get a private copy (which shares buffer data).
+			static Handle<Geometry> Get(Prefab prefab, const VertexLayout& layout);
+			static void ClearCache();
+
 			static Geometry MaterialBall(const VertexLayout& layout);
 			static Geometry Box(const VertexLayout& layout);
 			static Geometry Sphere(const VertexLayout& layout);
@@ -410,8 +453,6 @@ namespace Morpheus {
 			static Geometry StanfordBunny(GraphicsDevice device, const VertexLayout& layout);
 			static Geometry UtahTeapot(GraphicsDevice device, const VertexLayout& layout);
 		};
-
-		friend class RawGeometry;
 	};
 
 	void ComputeLayoutProperties(
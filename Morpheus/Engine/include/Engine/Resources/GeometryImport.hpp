@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Engine/Resources/Geometry.hpp>
+
+// Size of the pieces an OBJ file is split into for parsing on separate tasks
+#define OBJ_PARSE_CHUNK_SIZE (1u << 20)
+// Number of PLY vertices decoded by a single task
+#define PLY_DECODE_CHUNK_SIZE 65536
+
+namespace Morpheus {
+
+	// Parses a decimal floating point number and returns a pointer past it, or
+	// nullptr if there is no number at the start of the range. Leading spaces are skipped.
+	const char* ParseFloat(const char* begin, const char* end, float* out);
+	// Parses a decimal integer and returns a pointer past it, or nullptr on failure.
+	const char* ParseInt(const char* begin, const char* end, int64_t* out);
+
+	// Angle weighted vertex normals. Vertices that share a position index
+	// receive the same normal, so seams in other attributes do not show up as creases.
+	void GenerateSmoothNormals(size_t vertexCount,
+		size_t indexCount,
+		const uint32_t indices[],
+		const float positions[],
+		const uint32_t positionIds[],
+		float normalsOut[]);
+
+	// Per-vertex tangent frames following the MikkTSpace conventions: per-face tangents
+	// are projected into the tangent plane of each corner normal and angle weighted,
+	// and bitangents are reconstructed as sign * cross(normal, tangent).
+	// If uvs is null, an arbitrary frame orthogonal to the normal is generated.
+	void GenerateTangents(size_t vertexCount,
+		size_t indexCount,
+		const uint32_t indices[],
+		const float positions[],
+		const float normals[],
+		const float uvs[],
+		float tangentsOut[],
+		float bitangentsOut[]);
+}
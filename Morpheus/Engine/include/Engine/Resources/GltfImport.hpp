@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Engine/Resources/Geometry.hpp>
+#include <Engine/Renderer.hpp>
+
+// Used in place of the metallic-roughness texture when it cannot be loaded
+#define GLTF_FALLBACK_ROUGHNESS 0.5f
+#define GLTF_FALLBACK_METALLIC 0.0f
+
+namespace Morpheus {
+
+	// Requests the textures used by the material of the first primitive of a glTF / GLB
+	// file from a texture cache. Only images referenced by a relative uri can be loaded.
+	// The packed metallic-roughness texture is used for both roughness and metallic,
+	// read from its green and blue channels. Occlusion and emissive textures are
+	// skipped, the engine's materials have no place for them.
+	MaterialDescFuture LoadGltfMaterial(const std::string& source,
+		IResourceCache<Texture>* cache,
+		ITaskQueue* queue);
+}
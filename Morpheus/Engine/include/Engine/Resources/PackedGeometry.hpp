@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Engine/Resources/Geometry.hpp>
+
+namespace Morpheus {
+
+	// Attribute streams of a geometry quantized for compact storage. Positions and UVs
+	// are stored as 16-bit fixed point within their bounds, normals, tangents and
+	// bitangents as 16-bit octahedral coordinates. Indices are stored as 16-bit
+	// integers whenever the vertex count allows it.
+	//
+	// This is the format mesh2cpp emits for the geometry prefabs embedded in the engine.
+	struct PackedGeometry {
+		uint32_t mVertexCount = 0;
+		uint32_t mIndexCount = 0;
+
+		BoundingBox mPositionBounds;
+		DG::float2 mUVLower;
+		DG::float2 mUVUpper;
+
+		std::vector<uint16_t> mPositions;
+		std::vector<uint16_t> mUVs;
+		std::vector<int16_t> mNormals;
+		std::vector<int16_t> mTangents;
+		std::vector<int16_t> mBitangents;
+		std::vector<uint32_t> mIndices;
+
+		// Any attribute may be null, in which case its stream is left empty
+		void Pack(size_t vertexCount,
+			size_t indexCount,
+			const uint32_t indices[],
+			const float positions[],
+			const float uvs[],
+			const float normals[],
+			const float tangents[],
+			const float bitangents[]);
+
+		void Unpack(const VertexLayout& layout, Geometry* geometry) const;
+
+		inline Geometry Unpack(const VertexLayout& layout) const {
+			Geometry geometry;
+			Unpack(layout, &geometry);
+			return geometry;
+		}
+
+		Task SaveTask(const std::string& path) const;
+		inline void Save(const std::string& path) const {
+			SaveTask(path)();
+		}
+
+		void ReadArchive(const uint8_t* rawArchive, const size_t length);
+	};
+}
@@ -7,9 +7,15 @@
 
 #define TEXTURE_ARCHIVE_EXTENSION ".tark"
 #define GEOMETRY_ARCHIVE_EXTENSION ".gark"
+#define BVH_ARCHIVE_EXTENSION ".bark"
+#define PACKED_GEOMETRY_ARCHIVE_EXTENSION ".pgark"
+#define SCENE_ARCHIVE_EXTENSION ".sark"
 
 #define TEXTURE_ARCHIVE_VERSION 1
 #define GEOMETRY_ARCHIVE_VERSION 1
+#define BVH_ARCHIVE_VERSION 1
+#define PACKED_GEOMETRY_ARCHIVE_VERSION 1
+#define SCENE_ARCHIVE_VERSION 1
 
 namespace Morpheus {
 	class MemoryInputStream : public std::istream
@@ -35,4 +41,10 @@ namespace Morpheus {
 
 	void Load(cereal::PortableBinaryInputArchive& ar, Texture* texture);
 	void Save(cereal::PortableBinaryOutputArchive& ar, const Texture* texture);
+
+	void Load(cereal::PortableBinaryInputArchive& ar, GeometryBVH* bvh);
+	void Save(cereal::PortableBinaryOutputArchive& ar, const GeometryBVH* bvh);
+
+	void Load(cereal::PortableBinaryInputArchive& ar, PackedGeometry* geometry);
+	void Save(cereal::PortableBinaryOutputArchive& ar, const PackedGeometry* geometry);
 }
\ No newline at end of file
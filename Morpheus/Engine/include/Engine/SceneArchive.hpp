@@ -0,0 +1,118 @@
+#pragma once
+
+#include <Engine/Frame.hpp>
+#include <Engine/RegistrySnapshot.hpp>
+#include <Engine/Resources/Geometry.hpp>
+#include <Engine/Systems/System.hpp>
+#include <Engine/Components/Transform.hpp>
+
+#include <functional>
+#include <iostream>
+
+namespace Morpheus {
+
+	// Finds the key a geometry was loaded with. Returns false if the geometry
+	// did not come from an asset, which makes saving the scene fail.
+	typedef std::function<bool(const Geometry*, LoadParams<Geometry>*)> geometry_key_func_t;
+
+	enum class SceneBlockType : uint32_t {
+		END,
+		GEOMETRY_KEYS,
+		HIERARCHY,
+		TRANSFORMS,
+		STATIC_MESHES,
+		COMPONENT
+	};
+
+	struct SceneComponentColumn {
+		const SnapshotComponentHooks* mHooks = nullptr;
+		std::vector<uint32_t> mIndices;
+		std::vector<std::max_align_t> mData;
+	};
+
+	// A scene archive decoded into columns. Reading it does not touch any
+	// registry, so it can happen on a FILE_IO task while frames are running.
+	struct SceneData {
+		uint64_t mEntityCount = 0;
+		uint32_t mRoot = 0;
+		uint32_t mCamera = 0;
+
+		// Parent, previous, next, first child and last child of every entity
+		std::vector<uint32_t> mHierarchy[5];
+		std::vector<uint32_t> mTransformIndices;
+		std::vector<Transform> mTransforms;
+		std::vector<uint32_t> mMeshIndices;
+		std::vector<uint32_t> mMeshGeometry;
+		std::vector<Future<Geometry*>> mGeometry;
+		std::vector<SceneComponentColumn> mComponents;
+
+		bool IsGeometryAvailable() const;
+	};
+
+	// Binary scene format. Every entity with HierarchyData is stored under its
+	// position in the HierarchyData pool, and every component is stored as one
+	// block of columns indexed by those positions, so loading is a bulk insert
+	// per pool. Geometry keys are written first, which lets their loads run
+	// while the rest of the scene is read.
+	//
+	// Besides HierarchyData, Transform and StaticMeshComponent, any trivially
+	// copyable component registered with RegistrySnapshot::RegisterComponent
+	// is stored as raw bytes. Materials, RendererTransformCache and other non
+	// trivially copyable components are not stored.
+	class SceneArchive {
+	private:
+		static void SaveEntities(const Frame& frame,
+			const entt::entity* entities,
+			size_t count,
+			entt::entity root,
+			std::ostream& stream,
+			const geometry_key_func_t& geometryKeys);
+
+	public:
+		static void Save(const Frame& frame,
+			std::ostream& stream,
+			const geometry_key_func_t& geometryKeys);
+		static void Save(const Frame& frame,
+			const std::string& path,
+			const geometry_key_func_t& geometryKeys);
+
+		// Saves subtree and everything below it. The subtree becomes the root
+		// of the archive, links to entities outside of it are dropped.
+		static void Save(const Frame& frame,
+			entt::entity subtree,
+			std::ostream& stream,
+			const geometry_key_func_t& geometryKeys);
+		static void Save(const Frame& frame,
+			entt::entity subtree,
+			const std::string& path,
+			const geometry_key_func_t& geometryKeys);
+
+		// Decodes an archive and starts loading its geometry through the cache.
+		static void Read(std::istream& stream,
+			IResourceCache<Geometry>* geometryCache,
+			ITaskQueue* queue,
+			SceneData* data);
+
+		// Creates the entities of data in bulk and inserts every component
+		// column with a single insert. The root of the scene is added as a
+		// child of parent unless parent is null. Waits on any geometry of the
+		// scene that is not yet available. Returns the root of the scene.
+		static entt::entity Instantiate(Frame* frame,
+			SceneData& data,
+			entt::entity parent,
+			ITaskQueue* queue,
+			entt::entity* cameraOut = nullptr);
+
+		// Replaces the contents of frame with the scene. Geometry is loaded
+		// through the cache on the queue, and the load returns once it is all
+		// available.
+		static void Load(Frame* frame,
+			std::istream& stream,
+			IResourceCache<Geometry>* geometryCache,
+			ITaskQueue* queue);
+		static void Load(Frame* frame,
+			const std::string& path,
+			IResourceCache<Geometry>* geometryCache,
+			ITaskQueue* queue);
+	};
+}
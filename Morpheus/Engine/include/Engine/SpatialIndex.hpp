@@ -0,0 +1,194 @@
+#pragma once
+
+#include <Engine/Frame.hpp>
+#include <Engine/GeometryBVH.hpp>
+
+#include <unordered_map>
+
+// Leaf bounds are grown by this fraction of their diagonal, so small
+// movements do not have to touch the tree
+#define SPATIAL_INDEX_MARGIN 0.1f
+// The tree is rebuilt once its cost has grown by this factor since the last build
+#define SPATIAL_INDEX_REBUILD_RATIO 1.5f
+// Trees smaller than this are never worth rebuilding
+#define SPATIAL_INDEX_MIN_REBUILD_SIZE 64
+
+namespace Morpheus {
+	class Frustum;
+
+	struct SpatialIndexStats {
+		uint mReinsertCount = 0;
+		uint mRebuildCount = 0;
+	};
+
+	// A dynamic bounding volume hierarchy over entities. Every entity is a leaf
+	// with loose bounds. Moving an entity only touches the tree once it leaves
+	// its loose bounds, in which case it is removed and inserted again where it
+	// adds the least surface area. The tree is rebuilt from scratch when its
+	// surface area heuristic cost has degraded too much.
+	//
+	// Modifications must not run concurrently with queries; queries may run
+	// concurrently.
+	class SpatialIndex {
+	private:
+		static constexpr int32_t Null = -1;
+
+		struct Node {
+			BoundingBox mBounds;
+			int32_t mParent;
+			int32_t mLeft;
+			int32_t mRight;
+			entt::entity mEntity;
+
+			inline bool IsLeaf() const {
+				return mLeft == Null;
+			}
+		};
+
+		std::vector<Node> mNodes;
+		int32_t mRoot = Null;
+		int32_t mFreeList = Null;
+		std::unordered_map<entt::entity, int32_t> mLeaves;
+
+		// Sum of the surface areas of all interior nodes
+		float mInteriorArea = 0.0f;
+		float mBuildCost = 0.0f;
+		SpatialIndexStats mStats;
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t node);
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		void Refit(int32_t node);
+		int32_t Build(std::vector<int32_t>& leaves, size_t begin, size_t end);
+
+		template <typename TestT>
+		void QueryTree(TestT test, std::vector<entt::entity>* result) const;
+
+	public:
+		// Adds an entity, or moves it if it is already in the index
+		void Insert(entt::entity entity, const BoundingBox& bounds);
+		void Remove(entt::entity entity);
+		// Returns whether the tree had to change
+		bool Move(entt::entity entity, const BoundingBox& bounds);
+		void Clear();
+
+		// Rebuilds the whole tree, top down
+		void Rebuild();
+		// Rebuilds the tree if it has degraded enough since the last build
+		bool Optimize();
+
+		inline bool Contains(entt::entity entity) const {
+			return mLeaves.find(entity) != mLeaves.end();
+		}
+
+		inline size_t Size() const {
+			return mLeaves.size();
+		}
+
+		// Cost of a ray traversal relative to the root, lower is better
+		float GetCost() const;
+		uint GetHeight() const;
+
+		inline const SpatialIndexStats& GetStats() const {
+			return mStats;
+		}
+
+		// Loose bounds of an entity, which contain its real bounds
+		const BoundingBox& GetBounds(entt::entity entity) const;
+
+		// Appends every entity whose loose bounds intersect the query
+		void Query(const BoundingBox& box, std::vector<entt::entity>* result) const;
+		void Query(const Frustum& frustum, std::vector<entt::entity>* result) const;
+
+		// Calls hit(entity, distance) for every entity whose loose bounds the
+		// ray enters before tMax, nearest subtrees first. hit returns the new
+		// tMax, so closest hit queries can skip everything behind their hit.
+		template <typename HitT>
+		void Raycast(const Ray& ray, float tMax, HitT hit) const {
+			if (mRoot == Null)
+				return;
+
+			PrecomputedRay pre(ray);
+			constexpr float inf = std::numeric_limits<float>::infinity();
+
+			std::vector<std::pair<int32_t, float>> stack;
+			stack.reserve(64);
+
+			float tRoot = pre.Intersect(mNodes[mRoot].mBounds, tMax);
+			if (tRoot != inf)
+				stack.emplace_back(mRoot, tRoot);
+
+			while (!stack.empty()) {
+				auto [current, tEntry] = stack.back();
+				stack.pop_back();
+
+				if (tEntry >= tMax)
+					continue;
+
+				auto& node = mNodes[current];
+
+				if (node.IsLeaf()) {
+					tMax = hit(node.mEntity, tEntry);
+					continue;
+				}
+
+				float tLeft = pre.Intersect(mNodes[node.mLeft].mBounds, tMax);
+				float tRight = pre.Intersect(mNodes[node.mRight].mBounds, tMax);
+
+				// Farther child goes on the stack first
+				if (tLeft <= tRight) {
+					if (tRight != inf)
+						stack.emplace_back(node.mRight, tRight);
+					if (tLeft != inf)
+						stack.emplace_back(node.mLeft, tLeft);
+				} else {
+					if (tLeft != inf)
+						stack.emplace_back(node.mLeft, tLeft);
+					stack.emplace_back(node.mRight, tRight);
+				}
+			}
+		}
+	};
+
+	// Keeps a SpatialIndex of the world bounds of every StaticMeshComponent in
+	// a frame. Registry signals mark entities whose mesh or cached transform
+	// changed, and Update applies them to the index, so it should run after
+	// the transform cache has been updated.
+	class SpatialIndexUpdater {
+	private:
+		Frame* mFrame = nullptr;
+		SpatialIndex mIndex;
+		std::vector<entt::entity> mChanged;
+
+		void Connect();
+		void Disconnect();
+		void OnChanged(entt::registry& registry, entt::entity e);
+		void OnFrameDestroyed(Frame& frame);
+
+	public:
+		inline SpatialIndexUpdater() {
+		}
+
+		inline SpatialIndexUpdater(Frame* frame) {
+			SetFrame(frame);
+		}
+
+		~SpatialIndexUpdater();
+
+		SpatialIndexUpdater(const SpatialIndexUpdater&) = delete;
+		SpatialIndexUpdater& operator=(const SpatialIndexUpdater&) = delete;
+
+		// Indexes every mesh of the frame from scratch. Detached again when
+		// either the updater or the frame is destroyed.
+		void SetFrame(Frame* frame);
+		void Update();
+
+		inline const SpatialIndex& GetIndex() const {
+			return mIndex;
+		}
+
+		// World bounds of a mesh entity, false if it has no geometry
+		static bool GetWorldBounds(entt::registry& registry, entt::entity e, BoundingBox* bounds);
+	};
+}
@@ -11,7 +11,12 @@
 
 #include "MapHelper.hpp"
 
-#define DEFAULT_SPRITE_BATCH_SIZE 100
+#include <array>
+
+#define DEFAULT_SPRITE_BATCH_SIZE 1024
+// Textures a multi-texture sprite batch binds for a single draw
+#define DEFAULT_SPRITE_BATCH_TEXTURE_SLOTS 8
+#define MAX_SPRITE_BATCH_TEXTURE_SLOTS 16
 
 namespace Morpheus {
 
@@ -50,14 +55,18 @@ namespace Morpheus {
 			mVS(vs), mGS(gs), mPS(ps) {
 		}
 
+		// With more than one texture slot, the pixel shader samples a texture
+		// array with the slot of each sprite
 		static ResourceTask<SpriteShaders> LoadDefaults(
 			DG::IRenderDevice* device, 
-			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance());
+			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance(),
+			uint textureSlots = 1);
 	
 		static inline ResourceTask<SpriteShaders> LoadDefaults(
 			RealtimeGraphics& graphics,
-			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance()) {
-			return LoadDefaults(graphics.Device(), system);
+			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance(),
+			uint textureSlots = 1) {
+			return LoadDefaults(graphics.Device(), system, textureSlots);
 		}
 	};
 
@@ -66,18 +75,26 @@ namespace Morpheus {
 		DG::IShaderResourceVariable* mTextureVariable;
 		Handle<DG::IShaderResourceBinding> mShaderBinding;
 		Handle<DG::IPipelineState> mPipeline;
+		uint mTextureSlots;
 
 	public:
 		inline SpriteBatchState() :
-			mTextureVariable(nullptr) {
+			mTextureVariable(nullptr),
+			mTextureSlots(1) {
 		}
 
 		inline SpriteBatchState(DG::IShaderResourceBinding* shaderBinding, 
 			DG::IShaderResourceVariable* textureVariable, 
-			DG::IPipelineState* pipeline) :
+			DG::IPipelineState* pipeline,
+			uint textureSlots = 1) :
 			mTextureVariable(textureVariable),
 			mShaderBinding(shaderBinding),
-			mPipeline(pipeline) {
+			mPipeline(pipeline),
+			mTextureSlots(textureSlots) {
+		}
+
+		inline uint GetTextureSlots() const {
+			return mTextureSlots;
 		}
 
 		friend class SpriteBatch;
@@ -87,17 +104,20 @@ namespace Morpheus {
 	public:
 		Handle<DG::IPipelineState> mPipeline;
 		SpriteShaders mShaders;
+		uint mTextureSlots = 1;
 
 		inline SpriteBatchPipeline() {
 		}
 
+		// textureSlots must match the slots the shaders were loaded with
 		SpriteBatchPipeline(DG::IRenderDevice* device,
 			SpriteBatchGlobals* globals,
 			DG::TEXTURE_FORMAT backbufferFormat,
 			DG::TEXTURE_FORMAT depthbufferFormat,
 			uint samples,
 			DG::FILTER_TYPE filterType,
-			const SpriteShaders& shaders);
+			const SpriteShaders& shaders,
+			uint textureSlots = 1);
 
 		inline SpriteBatchPipeline(RealtimeGraphics& graphics,
 			SpriteBatchGlobals* globals,
@@ -105,20 +125,24 @@ namespace Morpheus {
 			DG::TEXTURE_FORMAT depthbufferFormat,
 			uint samples,
 			DG::FILTER_TYPE filterType,
-			const SpriteShaders& shaders) : SpriteBatchPipeline(graphics.Device(),
-				globals, backbufferFormat, depthbufferFormat, samples, filterType, shaders) {
+			const SpriteShaders& shaders,
+			uint textureSlots = 1) : SpriteBatchPipeline(graphics.Device(),
+				globals, backbufferFormat, depthbufferFormat, samples, filterType, 
+				shaders, textureSlots) {
 		}
 
 		inline SpriteBatchPipeline(RealtimeGraphics& graphics,
 			SpriteBatchGlobals* globals,
 			DG::FILTER_TYPE filterType,
-			const SpriteShaders& shaders) : SpriteBatchPipeline(graphics.Device(),
+			const SpriteShaders& shaders,
+			uint textureSlots = 1) : SpriteBatchPipeline(graphics.Device(),
 				globals, 
 				graphics.SwapChain()->GetDesc().ColorBufferFormat,
 				graphics.SwapChain()->GetDesc().DepthBufferFormat,
 				1,
 				filterType,
-				shaders) {
+				shaders,
+				textureSlots) {
 		}
 
 		inline SpriteBatchPipeline(
@@ -138,7 +162,8 @@ namespace Morpheus {
 			DG::TEXTURE_FORMAT depthbufferFormat,
 			uint samples,
 			DG::FILTER_TYPE filterType,
-			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance());
+			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance(),
+			uint textureSlots = 1);
 
 		inline static ResourceTask<SpriteBatchPipeline> LoadDefault(
 			RealtimeGraphics& graphics,
@@ -162,6 +187,19 @@ namespace Morpheus {
 				scDesc.ColorBufferFormat, scDesc.DepthBufferFormat, 1,
 				filterType, system);
 		}
+
+		// Sprites with up to textureSlots different textures share a draw
+		inline static ResourceTask<SpriteBatchPipeline> LoadMultiTexture(
+			RealtimeGraphics& graphics,
+			SpriteBatchGlobals* globals,
+			uint textureSlots = DEFAULT_SPRITE_BATCH_TEXTURE_SLOTS,
+			DG::FILTER_TYPE filterType = DG::FILTER_TYPE_LINEAR,
+			IVirtualFileSystem* system = EmbeddedFileLoader::GetGlobalInstance()) {
+			auto& scDesc = graphics.SwapChain()->GetDesc();
+			return LoadDefault(graphics.Device(), globals,
+				scDesc.ColorBufferFormat, scDesc.DepthBufferFormat, 1,
+				filterType, system, textureSlots);
+		}
 	};
 
 	struct SpriteBatchVSInput;
@@ -186,6 +224,94 @@ namespace Morpheus {
 		DG::float4 mColor;
 	};
 
+	// Decides which sprites of a SpriteBatch go into the same draw. Every
+	// sprite takes a place in the batch, and its texture one of the texture
+	// slots unless an earlier sprite of the batch already put it in one. Once
+	// either runs out, the batch has to be flushed. With a single slot, this
+	// flushes whenever the texture changes.
+	class SpriteBatchSlots {
+	private:
+		std::array<DG::ITexture*, MAX_SPRITE_BATCH_TEXTURE_SLOTS> mTextures;
+		uint mSlotCount;
+		uint mUsedSlots = 0;
+		uint mBatchSize;
+		uint mSpriteCount = 0;
+		int mLastSlot = -1;
+
+	public:
+		inline SpriteBatchSlots(uint batchSize = DEFAULT_SPRITE_BATCH_SIZE, 
+			uint slotCount = 1) :
+			mSlotCount(slotCount), 
+			mBatchSize(batchSize) {
+			if (slotCount == 0 || slotCount > MAX_SPRITE_BATCH_TEXTURE_SLOTS)
+				throw std::runtime_error("Invalid number of sprite batch texture slots!");
+			if (batchSize == 0)
+				throw std::runtime_error("Sprite batch size cannot be zero!");
+			mTextures.fill(nullptr);
+		}
+
+		// Adds a sprite and returns the slot of its texture, or -1 if the
+		// batch has to be flushed first
+		inline int Add(DG::ITexture* texture) {
+			if (mSpriteCount == mBatchSize)
+				return -1;
+
+			// Runs of sprites with the same texture are the common case
+			if (mLastSlot < 0 || mTextures[mLastSlot] != texture) {
+				int slot = -1;
+				for (uint i = 0; i < mUsedSlots; ++i) {
+					if (mTextures[i] == texture) {
+						slot = (int)i;
+						break;
+					}
+				}
+
+				if (slot < 0) {
+					if (mUsedSlots == mSlotCount)
+						return -1;
+					slot = (int)mUsedSlots++;
+					mTextures[slot] = texture;
+				}
+
+				mLastSlot = slot;
+			}
+
+			++mSpriteCount;
+			return mLastSlot;
+		}
+
+		inline void Reset() {
+			mTextures.fill(nullptr);
+			mUsedSlots = 0;
+			mSpriteCount = 0;
+			mLastSlot = -1;
+		}
+
+		inline DG::ITexture* GetTexture(uint slot) const {
+			return mTextures[slot];
+		}
+
+		inline uint GetUsedSlots() const {
+			return mUsedSlots;
+		}
+
+		inline uint GetSlotCount() const {
+			return mSlotCount;
+		}
+
+		inline uint GetSpriteCount() const {
+			return mSpriteCount;
+		}
+
+		inline uint GetBatchSize() const {
+			return mBatchSize;
+		}
+
+		inline bool IsEmpty() const {
+			return mSpriteCount == 0;
+		}
+	};
+
 	class SpriteBatch {
 	private:
 		Handle<DG::IBuffer> mBuffer;
@@ -193,12 +319,14 @@ namespace Morpheus {
 		SpriteBatchState mDefaultState;
 		SpriteBatchState mCurrentState;
 
-		DG::ITexture* mLastTexture;
+		SpriteBatchSlots mSlots;
 		DG::IDeviceContext* mCurrentContext;
 
-		uint mWriteIndex;
 		uint mBatchSize;
 		uint mBatchSizeBytes;
+		uint mDrawCount = 0;
+
+		SpriteBatchVSInput* NextInstance(DG::ITexture* texture);
 
 		DG::MapHelper<SpriteBatchVSInput> mMapHelper;
 
@@ -223,6 +351,11 @@ namespace Morpheus {
 		void Flush();
 		void End();
 
+		// Draw calls issued since the last Begin
+		inline uint GetDrawCount() const {
+			return mDrawCount;
+		}
+
 		void Draw(const SpriteBatchCall2D sprites[], size_t count);
 		void Draw(const SpriteBatchCall3D sprites[], size_t count);
 
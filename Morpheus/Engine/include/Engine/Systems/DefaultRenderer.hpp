@@ -9,6 +9,12 @@
 #include <Engine/LightProbeProcessor.hpp>
 #include <Engine/Resources/EmbeddedFileLoader.hpp>
 #include <Engine/Renderer.hpp>
+#include <Engine/RenderQueue.hpp>
+#include <Engine/InstanceBuffer.hpp>
+#include <Engine/OcclusionCulling.hpp>
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/MaterialTable.hpp>
+#include <Engine/LightClusters.hpp>
 #include <Engine/Resources/Geometry.hpp>
 
 #include <shaders/BasicStructures.hlsl>
@@ -30,7 +36,12 @@ namespace Morpheus {
 			DG::IShaderResourceBinding* mBinding = nullptr;
 			DG::IShaderResourceVariable* mIrradianceSHVariable = nullptr;
 			DG::IShaderResourceVariable* mEnvMapVariable = nullptr;
-			std::atomic<int> mRefCount = 0;
+
+			// Written to the material constants as is when the material is applied
+			HLSL::MaterialAttribs mAttribs;
+			// What the light probe variables are currently set to
+			DG::IBuffer* mBoundIrradianceSH = nullptr;
+			DG::ITextureView* mBoundEnvMap = nullptr;
 
 			inline Material(const MaterialDesc& desc,
 				DG::IPipelineState* pipeline,
@@ -38,46 +49,69 @@ namespace Morpheus {
 				mDesc(desc),
 				mPipeline(pipeline),
 				mBinding(binding) {
+				mAttribs.mAlbedoFactor = desc.mAlbedoFactor;
+				mAttribs.mDisplacementFactor = desc.mDisplacementFactor;
+				mAttribs.mMetallicFactor = desc.mMetallicFactor;
+				mAttribs.mRoughnessFactor = desc.mRoughnessFactor;
+				mAttribs.mMetallicChannel = ChannelMask(desc.mMetallicChannel);
+				mAttribs.mRoughnessChannel = ChannelMask(desc.mRoughnessChannel);
+			}
+
+			static inline DG::float4 ChannelMask(uint channel) {
+				DG::float4 mask(0.0f, 0.0f, 0.0f, 0.0f);
+				mask[std::min<uint>(channel, 3)] = 1.0f;
+				return mask;
 			}
 
 			inline Material() {
 			}
 
+			inline ~Material() {
+				if (mBinding)
+					mBinding->Release();
+			}
+
 			inline Material(Material&& data) :
-				mDesc(std::move(data.mDesc)) {
+				mDesc(std::move(data.mDesc)),
+				mAttribs(data.mAttribs) {
 				std::swap(data.mPipeline, mPipeline);
 				std::swap(data.mBinding, mBinding);
 				std::swap(data.mIrradianceSHVariable, mIrradianceSHVariable);
 				std::swap(data.mEnvMapVariable, mEnvMapVariable);
-				mRefCount = data.mRefCount.exchange(mRefCount);
+				std::swap(data.mBoundIrradianceSH, mBoundIrradianceSH);
+				std::swap(data.mBoundEnvMap, mBoundEnvMap);
 			}
 
 			inline Material& operator=(Material&& data) {
 				mDesc = std::move(data.mDesc);
+				mAttribs = data.mAttribs;
 				std::swap(data.mPipeline, mPipeline);
 				std::swap(data.mBinding, mBinding);
 				std::swap(data.mIrradianceSHVariable, mIrradianceSHVariable);
 				std::swap(data.mEnvMapVariable, mEnvMapVariable);
-				mRefCount = data.mRefCount.exchange(mRefCount);
+				std::swap(data.mBoundIrradianceSH, mBoundIrradianceSH);
+				std::swap(data.mBoundEnvMap, mBoundEnvMap);
 				return *this;
 			}
 		};
 
 		TransformCacheUpdater mUpdater;
+		SpatialIndexUpdater mSpatialIndex;
 		VertexLayout mStaticMeshLayout = DefaultInstancedStaticMeshLayout();
 
-		std::mutex mMaterialAddRefMutex;
-		std::mutex mMaterialReleaseMutex;
-		std::vector<MaterialId> mMaterialsToAddRef;
-		std::vector<MaterialId> mMaterialsToRelease;
+		// Indices of the static meshes in the snapshot that survive culling
+		std::vector<uint32_t> mVisibleStaticMeshes;
+		OcclusionBuffer mOcclusionBuffer;
+		LightClusters mLightClusters;
+		RenderQueue mStaticMeshQueue;
+		InstanceBuffer mInstances;
+		size_t mInstanceCapacity = 0;
 
-		std::unordered_map<MaterialId, Material> mMaterials;
-		MaterialId mCurrentMaterialId = 0;
-
-		MaterialId CreateNewMaterialId();
+		MaterialTable<Material> mMaterials;
 
 		EmbeddedFileLoader mLoader;
 		RealtimeGraphics* mGraphics;
+		// Starting size of the instance buffer, which grows to fit a frame
 		uint mInstanceBatchSize = 512;
 
 		std::unique_ptr<ParameterizedTaskGroup<RenderParams>> mRenderGroup;
@@ -130,6 +164,7 @@ namespace Morpheus {
 		void CreateLambertPipeline(Handle<DG::IShader> vs, Handle<DG::IShader> ps);
 		void CreateCookTorrenceIBLPipeline(Handle<DG::IShader> vs, Handle<DG::IShader> ps);
 		void CreateSkyboxPipeline(Handle<DG::IShader> vs, Handle<DG::IShader> ps);
+		void CreateInstanceBuffer(size_t capacity);
 		void InitializeDefaultResources();
 
 		ParameterizedTask<RenderParams> BeginRender();
@@ -137,7 +172,8 @@ namespace Morpheus {
 		ParameterizedTask<RenderParams> DrawStaticMeshes();
 
 	public:
-		void ApplyMaterial(DG::IDeviceContext* context, MaterialId id, 
+		// Returns false if the material does not exist (anymore)
+		bool ApplyMaterial(DG::IDeviceContext* context, MaterialId id, 
 			const MaterialApplyParams& params);
 
 		inline auto& Resources() {
@@ -148,6 +184,16 @@ namespace Morpheus {
 			return mUpdater;
 		}
 
+		// World bounds of every static mesh, as of the last extraction
+		inline const SpatialIndex& GetSpatialIndex() const {
+			return mSpatialIndex.GetIndex();
+		}
+
+		// Lights of every cluster of the camera, as of the last frame with lights
+		inline const LightClusters& GetLightClusters() const {
+			return mLightClusters;
+		}
+
 		ParameterizedTaskGroup<RenderParams>* CreateRenderGroup();
 
 		inline RealtimeGraphics* GetGraphics() {
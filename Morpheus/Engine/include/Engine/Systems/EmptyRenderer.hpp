@@ -4,23 +4,112 @@
 #include <Engine/Systems/System.hpp>
 #include <Engine/Renderer.hpp>
 #include <Engine/GeometryStructures.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/RenderQueue.hpp>
+#include <Engine/InstanceBuffer.hpp>
+#include <Engine/OcclusionCulling.hpp>
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/MaterialTable.hpp>
+#include <Engine/LightClusters.hpp>
 
 namespace Morpheus {
+	// Renders nothing. Without graphics it runs headless: instead of clearing 
+	// the screen it builds the draw list a real renderer would submit, so the 
+	// CPU side of a frame can be measured on machines without a GPU.
 	class EmptyRenderer : public ISystem, 
 		public IRenderer, 
 		public IVertexFormatProvider {
 	private:
 		RealtimeGraphics* mGraphics;
 		VertexLayout mDefaultLayout = VertexLayout::PositionUVNormalTangent();
+		TransformCacheUpdater mUpdater;
+		SpatialIndexUpdater mSpatialIndex;
+
+		InstanceBuffer mInstances;
+		std::vector<uint32_t> mVisibleStaticMeshes;
+		OcclusionBuffer mOcclusionBuffer;
+		LightClusters mLightClusters;
+		RenderQueue mStaticMeshQueue;
+		// Materials are tracked like DefaultRenderer does, without any GPU state
+		MaterialTable<MaterialType> mMaterials;
+
+		// There is no swap chain to take this from when headless
+		float mAspectRatio = 16.0f / 9.0f;
+
+		ParameterizedTask<RenderParams> ClearScreen();
+		ParameterizedTask<RenderParams> BuildDrawList();
 	
 	public:
 		inline EmptyRenderer(RealtimeGraphics& graphics) : mGraphics(&graphics) {
 		}
 
+		// Headless
+		inline EmptyRenderer() : mGraphics(nullptr) {
+		}
+
 		inline RealtimeGraphics* GetGraphics() {
 			return mGraphics;
 		}
 
+		inline bool IsHeadless() const {
+			return mGraphics == nullptr;
+		}
+
+		// The draw list of the last rendered frame, headless only
+		inline const std::vector<DrawBatch>& GetDrawList() const {
+			return mStaticMeshQueue.GetBatches();
+		}
+
+		// Draw calls and state changes the draw list of the last frame would cost
+		inline const RenderQueueStats& GetDrawStats() const {
+			return mStaticMeshQueue.GetStats();
+		}
+
+		inline void SetAspectRatio(float aspectRatio) {
+			mAspectRatio = aspectRatio;
+		}
+
+		inline float GetAspectRatio() const {
+			return mAspectRatio;
+		}
+
+		// Transposed transforms of the visible instances, indexed by DrawBatch::mFirstInstance
+		inline const std::vector<DG::float4x4>& GetInstanceData() const {
+			return mInstances.GetData();
+		}
+
+		// Occluders of the last frame, as seen by the camera
+		inline const OcclusionBuffer& GetOcclusionBuffer() const {
+			return mOcclusionBuffer;
+		}
+
+		// What a real renderer would have had to upload last frame
+		inline const InstanceBuffer& GetInstanceBuffer() const {
+			return mInstances;
+		}
+
+		// Lights of every cluster of the camera, as of the last frame with lights
+		inline const LightClusters& GetLightClusters() const {
+			return mLightClusters;
+		}
+
+		inline MaterialTable<MaterialType>& GetMaterials() {
+			return mMaterials;
+		}
+
+		inline const MaterialTable<MaterialType>& GetMaterials() const {
+			return mMaterials;
+		}
+
+		inline TransformCacheUpdater& CacheUpdater() {
+			return mUpdater;
+		}
+
+		// World bounds of every static mesh, as of the last extraction
+		inline const SpatialIndex& GetSpatialIndex() const {
+			return mSpatialIndex.GetIndex();
+		}
+
 		Task Startup(SystemCollection& collection) override;
 		bool IsInitialized() const override;
 		void Shutdown() override;
@@ -9,6 +9,7 @@
 #include <Engine/Defines.hpp>
 #include <Engine/ThreadPool.hpp>
 #include <Engine/Entity.hpp>
+#include <Engine/ComponentAccess.hpp>
 
 namespace DG = Diligent;
 
@@ -17,6 +18,7 @@ namespace Morpheus {
 	class ResourceProcessor;
 	class SystemCollection;
 	struct GraphicsCapabilityConfig;
+	struct RenderSnapshot;
 
 	typedef std::function<void(Frame*)> inject_proc_t;
 
@@ -44,6 +46,20 @@ namespace Morpheus {
 			mCurrentTime = timer.GetElapsedTime();
 			mElapsedTime = mCurrentTime - last;
 		}
+
+		// For fixed step loops that do not follow the wall clock
+		inline void Advance(double timeStep) {
+			mCurrentTime += timeStep;
+			mElapsedTime = timeStep;
+		}
+	};
+
+	// Wall clock time each stage of the last frame took, in seconds.
+	// Zero for stages that did not run.
+	struct FrameStageTimings {
+		double mUpdate = 0.0;
+		double mExtract = 0.0;
+		double mRender = 0.0;
 	};
 
 	struct UpdateParams {
@@ -54,6 +70,15 @@ namespace Morpheus {
 	struct RenderParams {
 		FrameTime mTime;
 		Frame* mFrame;
+		// State extracted from mFrame after its last update. Render tasks should
+		// read from this rather than the registry, which is being updated concurrently.
+		RenderSnapshot* mSnapshot = nullptr;
+	};
+
+	struct ExtractParams {
+		FrameTime mTime;
+		Frame* mFrame;
+		RenderSnapshot* mSnapshot;
 	};
 
 	struct InjectProc {
@@ -85,29 +110,108 @@ namespace Morpheus {
 
 	class FrameProcessor {
 	private:
+		struct DeclaredUpdate {
+			// Input pins of the first and last node of the task or group
+			TaskNodeIn* mStart;
+			TaskNodeIn* mFinish;
+			ComponentAccess mAccess;
+		};
+
 		ParameterizedTaskGroup<Frame*> mInject;
+		// Runs alone between injection and the rest of the update
+		ParameterizedTaskGroup<UpdateParams> mStructuralUpdate;
 		ParameterizedTaskGroup<UpdateParams> mUpdate;
 		ParameterizedTaskGroup<RenderParams> mRender;
+		ParameterizedTaskGroup<ExtractParams> mExtract;
 		TaskBarrier mRenderSwitch;
 		TaskBarrier mUpdateSwitch;
 
+		// Extraction writes one snapshot while the other is being rendered
+		std::unique_ptr<RenderSnapshot> mSnapshots[2];
+		uint mRenderSnapshot = 0;
+		bool bSnapshotPending = false;
+
 		std::unordered_map<entt::type_info, 
 			TypeInjector, TypeInfoHasher> mInjectByType;
 
+		// Update tasks and groups with their component access, in the order they were added
+		std::vector<DeclaredUpdate> mDeclaredUpdates;
+		IParameterizedTask<UpdateParams>* mLastStructuralUpdate = nullptr;
+		// Orderings between tasks that only exist in the compiled graph
+		std::vector<TaskGraphEdge> mOrderEdges;
+
 		Frame* mFrame = nullptr;
 		RenderParams mSavedRenderParams;
 		bool bFirstFrame = true;
 
+		// Every task reads its parameters from these
+		std::tuple<Frame*> mInjectArgs;
+		std::tuple<UpdateParams> mUpdateArgs;
+		std::tuple<RenderParams> mRenderArgs;
+		std::tuple<ExtractParams> mExtractArgs;
+
+		// The groups above, compiled on the first frame after they change
+		CompiledTaskGraph mGraph;
+		uint mInjectNode;
+		uint mUpdateSwitchNode;
+		uint mRenderSwitchNode;
+		uint mUpdateStartedNode;
+		uint mRenderStartedNode;
+		uint mExtractStartedNode;
+		uint mInjectFinishedNode;
+		uint mUpdateFinishedNode;
+		uint mRenderFinishedNode;
+		uint mExtractFinishedNode;
+
 		void Initialize(SystemCollection* systems, Frame* frame);
+		void Compile();
+		void DeclareUpdate(TaskNodeIn* start, TaskNodeIn* finish, const ComponentAccess& access);
+		double StageTime(uint started, uint finished) const;
+
+		// Every change to the groups releases the graph, and none may happen
+		// while a frame is running, so nothing is running without a graph
+		inline bool IsFinished(uint node) const {
+			return !mGraph.IsCompiled() || mGraph.IsFinished(node);
+		}
 
 	public:
 		void Reset();
 		void Flush(ITaskQueue* queue);
+		// Must be called before any task in the frame graph is destroyed
+		void ReleaseGraph();
 		void AddInjector(const InjectProc& proc);
+		// Without declared access the task may touch anything, so it runs after
+		// every update task added before it and before every one added after it
 		void AddUpdateTask(ParameterizedTask<UpdateParams>&& task);
+		// The task runs after every previously added task whose declared access
+		// conflicts with access, and concurrently with all others. 
+		// Must not be called while a frame is running.
+		void AddUpdateTask(ParameterizedTask<UpdateParams>&& task, const ComponentAccess& access);
+
+		// Like the above, and in debug builds also checks that the task only
+		// touches the components it declared through Frame.
+		template <typename T>
+		inline void AddUpdateTask(T&& lambda, const ComponentAccess& access, const std::string& name = "") {
+			ParameterizedTask<UpdateParams> task(
+				[lambda = std::move(lambda), access](const TaskParams& e, const UpdateParams& params) mutable {
+#ifdef COMPONENT_ACCESS_DEBUG
+				ComponentAccessScope scope(&access);
+#endif
+				return lambda(e, params);
+			}, name, TaskType::UPDATE);
+
+			AddUpdateTask(std::move(task), access);
+		}
+		// For tasks that create or destroy entities in bulk. They run one after
+		// another, after injection and before any other update task, whether
+		// or not those declare their access.
+		void AddStructuralUpdateTask(ParameterizedTask<UpdateParams>&& task);
 		void AddRenderTask(ParameterizedTask<RenderParams>&& task);
 		void AddRenderGroup(ParameterizedTaskGroup<RenderParams>* group);
+		// Ordered like an update task without declared access
 		void AddUpdateGroup(ParameterizedTaskGroup<UpdateParams>* group);
+		void AddExtractTask(ParameterizedTask<ExtractParams>&& task);
+		void AddExtractGroup(ParameterizedTaskGroup<ExtractParams>* group);
 		void Apply(const FrameTime& time, 
 			ITaskQueue* queue,
 			bool bUpdate = true, 
@@ -118,6 +222,8 @@ namespace Morpheus {
 		inline Frame* GetFrame() const {
 			return mFrame;
 		}
+		// Only valid after waiting on the frame
+		FrameStageTimings GetStageTimings() const;
 		inline ParameterizedTaskGroup<Frame*>& GetInjectGroup() {
 			return mInject;
 		}
@@ -127,18 +233,26 @@ namespace Morpheus {
 		inline ParameterizedTaskGroup<RenderParams>& GetRenderGroup() {
 			return mRender;
 		}
-		inline FrameProcessor(SystemCollection* systems) {
-			Initialize(systems, nullptr);
+		inline ParameterizedTaskGroup<ExtractParams>& GetExtractGroup() {
+			return mExtract;
 		}
+		FrameProcessor(SystemCollection* systems);
+		~FrameProcessor();
+
 		inline void WaitOnRender(ITaskQueue* queue) {
-			queue->YieldUntilFinished(&mRender);
+			queue->YieldUntilCondition([this]() {
+				return IsFinished(mRenderFinishedNode);
+			});
 		}
 		inline void WaitOnUpdate(ITaskQueue* queue) {
-			queue->YieldUntilFinished(&mUpdate);
+			queue->YieldUntilCondition([this]() {
+				return IsFinished(mUpdateFinishedNode) &&
+					IsFinished(mExtractFinishedNode);
+			});
 		}
 		inline void WaitUntilFinished(ITaskQueue* queue) {
-			queue->YieldUntilFinished(&mRender);
-			queue->YieldUntilFinished(&mUpdate);
+			WaitOnRender(queue);
+			WaitOnUpdate(queue);
 		}
 	};
 
@@ -186,6 +300,19 @@ namespace Morpheus {
 			mFrameProcessor.AddUpdateTask(std::move(task));
 		}
 
+		template <typename T>
+		inline void AddUpdateTask(T&& lambda, const ComponentAccess& access, const std::string& name = "") {
+			mFrameProcessor.AddUpdateTask(std::move(lambda), access, name);
+		}
+
+		inline void AddStructuralUpdateTask(ParameterizedTask<UpdateParams>&& task) {
+			mFrameProcessor.AddStructuralUpdateTask(std::move(task));
+		}
+
+		inline void AddExtractTask(ParameterizedTask<ExtractParams>&& task) {
+			mFrameProcessor.AddExtractTask(std::move(task));
+		}
+
 		inline ParameterizedTaskGroup<UpdateParams>* GetUpdateGroup(const entt::hashed_string& str) const {
 			auto it = mUpdateGroupsByName.find(str);
 			if (it == mUpdateGroupsByName.end())
@@ -266,7 +393,18 @@ namespace Morpheus {
 		void SetFrame(Frame* frame);
 		void Shutdown();
 
+		/* Runs frameCount frames back to back with a fixed time step, 
+		without a window or a wall clock. Each frame is waited on before 
+		the next one starts, and onFrame is called after it if given. */
+		void RunFixedStep(ITaskQueue* queue,
+			double timeStep,
+			uint frameCount,
+			bool bRender = true,
+			const std::function<void(uint)>& onFrame = nullptr);
+
 		/* Renders and then updates the frame.
+		The render uses the snapshot extracted after the previous update,
+		so it can overlap with the update of this frame.
 		Note that this function is asynchronous, you will need to 
 		call WaitOnRender and WaitOnUpdate to wait on its completion. */
 		inline void RunFrame(const FrameTime& time, 
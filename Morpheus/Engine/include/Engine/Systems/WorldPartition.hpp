@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Engine/Systems/System.hpp>
+#include <Engine/SceneArchive.hpp>
+#include <Engine/GeometryStructures.hpp>
+
+#include <exception>
+#include <future>
+
+namespace Morpheus {
+
+	struct WorldCell {
+		// Scene archive with the entities of the cell
+		std::string mSource;
+		BoundingBox mBounds;
+	};
+
+	// Sorts the children of the root of frame into a grid of cells on the xz plane
+	// by their translation, and saves every non-empty cell to
+	// pathPrefix + "x_z" + SCENE_ARCHIVE_EXTENSION. The cells are removed from
+	// frame afterwards, whatever is left is the part of the world that is always
+	// loaded. Children without a Transform and the camera stay in frame.
+	std::vector<WorldCell> PartitionFrame(Frame* frame,
+		float cellSize,
+		const std::string& pathPrefix,
+		const geometry_key_func_t& geometryKeys);
+
+	struct WorldPartitionParams {
+		// Cells closer than this to the camera are loaded
+		float mLoadDistance = 200.0f;
+		// Cells further than this are unloaded, should be above mLoadDistance
+		float mUnloadDistance = 250.0f;
+		// Seconds per frame spent adding and removing cells. At least one cell
+		// is added or removed every frame in which any cell is waiting.
+		double mFrameBudget = 0.002;
+		// Cells being read from disk at the same time
+		uint mMaxPendingReads = 4;
+	};
+
+	// Streams the cells of a partitioned world in and out of the frame around
+	// the camera. Cells are read and their geometry is loaded on FILE_IO tasks,
+	// then added to the frame in bulk by a structural update task, which runs
+	// before any other update task of the frame. Cells that cannot be read are
+	// marked as failed and left out, instead of failing the frame.
+	class WorldPartitionSystem : public ISystem {
+	private:
+		enum class CellState {
+			UNLOADED,
+			READING,
+			LOADED,
+			ACTIVE,
+			FAILED
+		};
+
+		struct PendingRead {
+			SceneData mData;
+			std::promise<void> mPromise;
+			std::future<void> mFinished = mPromise.get_future();
+		};
+
+		struct Cell {
+			WorldCell mDesc;
+			CellState mState = CellState::UNLOADED;
+			std::shared_ptr<PendingRead> mRead;
+			std::exception_ptr mError;
+			entt::entity mRoot = entt::null;
+			float mDistance = 0.0f;
+		};
+
+		std::vector<Cell> mCells;
+		// Cells by distance to the camera, closest first
+		std::vector<size_t> mOrder;
+		WorldPartitionParams mParams;
+		IResourceCache<Geometry>* mGeometryCache = nullptr;
+		uint mPendingReads = 0;
+
+		void BeginRead(Cell& cell, ITaskQueue* queue);
+		void Activate(Frame* frame, Cell& cell, ITaskQueue* queue);
+		void Deactivate(Frame* frame, Cell& cell);
+
+	public:
+		void Update(Frame* frame, ITaskQueue* queue);
+
+		inline WorldPartitionSystem(const std::vector<WorldCell>& cells,
+			const WorldPartitionParams& params = WorldPartitionParams()) :
+			mParams(params) {
+			mCells.resize(cells.size());
+			for (size_t i = 0; i < cells.size(); ++i)
+				mCells[i].mDesc = cells[i];
+		}
+
+		inline size_t CellCount() const {
+			return mCells.size();
+		}
+
+		inline bool IsActive(size_t cell) const {
+			return mCells[cell].mState == CellState::ACTIVE;
+		}
+
+		inline bool HasFailed(size_t cell) const {
+			return mCells[cell].mState == CellState::FAILED;
+		}
+
+		// Why a cell could not be read, null unless it failed
+		inline std::exception_ptr GetError(size_t cell) const {
+			return mCells[cell].mError;
+		}
+
+		// Lets a failed cell be read again once it is close enough
+		void Retry(size_t cell);
+
+		size_t ActiveCellCount() const;
+
+		Task Startup(SystemCollection& systems) override;
+		bool IsInitialized() const override;
+		void Shutdown() override;
+		void NewFrame(Frame* frame) override;
+		void OnAddedTo(SystemCollection& collection) override;
+	};
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <Engine/Resources/Texture.hpp>
+#include <Engine/GeometryStructures.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+#define TEXTURE_ATLAS_PAGE_SIZE 2048
+// Texels of each entry's edge repeated around it, so filtering never reads
+// a neighbour
+#define TEXTURE_ATLAS_PADDING 4
+// Entries start and end on multiples of this, so they stay apart in mips
+#define TEXTURE_ATLAS_ALIGNMENT 4
+// Compact once less than this fraction of the packed area is still in use
+#define TEXTURE_ATLAS_COMPACT_RATIO 0.5f
+
+namespace Morpheus {
+
+	// Packs rectangles into a fixed size area by keeping the top outline
+	// of everything placed so far. Each rectangle goes wherever it ends up
+	// lowest. Rectangles cannot be removed one by one, only all at once.
+	class SkylinePacker {
+	private:
+		struct Segment {
+			uint mX;
+			uint mY;
+			uint mWidth;
+		};
+
+		std::vector<Segment> mSkyline;
+		uint mWidth;
+		uint mHeight;
+		size_t mUsedArea = 0;
+
+		bool Fits(size_t segment, uint width, uint height, uint* y) const;
+
+	public:
+		SkylinePacker(uint width, uint height);
+
+		// Finds room for a width x height rectangle and returns its top left
+		// corner, or false if it does not fit anymore
+		bool Insert(uint width, uint height, uint* x, uint* y);
+		void Reset();
+
+		inline uint GetWidth() const {
+			return mWidth;
+		}
+
+		inline uint GetHeight() const {
+			return mHeight;
+		}
+
+		inline size_t GetUsedArea() const {
+			return mUsedArea;
+		}
+	};
+
+	typedef uint32_t AtlasEntryId;
+	constexpr AtlasEntryId NullAtlasEntryId = 0;
+
+	// Puts many small images into a few large RGBA8 pages, so sprites, tiles
+	// and glyphs can share textures and draws. Entries are surrounded by
+	// copies of their edge texels and aligned, so linear filtering and the
+	// first GetSafeMipCount() mips of a page never mix neighbouring entries.
+	//
+	// Pages only have a raw aspect; whoever draws with them creates the GPU
+	// textures, and recreates them when the version of a page changes.
+	// Removing an entry leaves a hole until the atlas is compacted, which
+	// repacks every entry and moves them around.
+	class TextureAtlas {
+	private:
+		struct Entry {
+			uint mPage;
+			// Cell of the entry in its page, including padding
+			uint mCellX;
+			uint mCellY;
+			uint mCellWidth;
+			uint mCellHeight;
+			// Size of the image itself
+			uint mWidth;
+			uint mHeight;
+		};
+
+		struct Page {
+			std::unique_ptr<Texture> mTexture;
+			SkylinePacker mPacker;
+			size_t mLiveArea = 0;
+			uint mVersion = 0;
+
+			inline Page(uint width, uint height) : mPacker(width, height) {
+			}
+		};
+
+		uint mPageWidth;
+		uint mPageHeight;
+		uint mPadding;
+		bool bSRGB;
+
+		std::vector<Page> mPages;
+		std::unordered_map<AtlasEntryId, Entry> mEntries;
+		AtlasEntryId mNextId = 1;
+		uint mCompactCount = 0;
+
+		uint8_t* GetPixels(uint page);
+		size_t GetRowPitch(uint page) const;
+		uint AddPage();
+		bool Place(uint width, uint height, Entry* entry);
+		void WriteCell(const Entry& entry, const uint8_t* rgba, size_t rowPitch);
+		void ClearCell(const Entry& entry);
+
+	public:
+		TextureAtlas(uint pageWidth = TEXTURE_ATLAS_PAGE_SIZE,
+			uint pageHeight = TEXTURE_ATLAS_PAGE_SIZE,
+			uint padding = TEXTURE_ATLAS_PADDING,
+			bool bSRGB = false);
+
+		// Copies an image of 8 bit RGBA texels, rows rowPitch bytes apart
+		AtlasEntryId Insert(uint width, uint height,
+			const uint8_t* rgba, size_t rowPitch);
+
+		// Copies the first mip of a raw 2D texture of 8 bit texels. Missing
+		// channels are filled in the way ImageCopy does.
+		AtlasEntryId Insert(const Texture& texture);
+
+		void Remove(AtlasEntryId id);
+
+		// Repacks every entry into as few pages as possible. Returns the
+		// number of pages released.
+		uint Compact();
+
+		// Whether too much of the packed area belongs to removed entries
+		bool NeedsCompaction() const;
+
+		inline bool Contains(AtlasEntryId id) const {
+			return mEntries.find(id) != mEntries.end();
+		}
+
+		// Page the entry is on. Pages can change when the atlas is compacted.
+		uint GetPage(AtlasEntryId id) const;
+
+		// Where the entry's image is on its page, in texels
+		SpriteRect GetRect(AtlasEntryId id) const;
+
+		// A rectangle of the original image, like a tile of a tileset, moved
+		// to where it is on the page
+		SpriteRect Remap(AtlasEntryId id, const SpriteRect& rect) const;
+
+		// Texture coordinates of the entry on its page, as (u0, v0, u1, v1)
+		DG::float4 GetUVs(AtlasEntryId id) const;
+
+		// Texture coordinates of the original image moved onto the page
+		DG::float2 RemapUV(AtlasEntryId id, const DG::float2& uv) const;
+
+		// Mips of a page, counting the full size one, that padding and
+		// alignment keep apart
+		uint GetSafeMipCount() const;
+
+		inline size_t GetPageCount() const {
+			return mPages.size();
+		}
+
+		inline const Texture& GetPageTexture(uint page) const {
+			return *mPages[page].mTexture;
+		}
+
+		// Changes whenever the texels of a page do
+		inline uint GetPageVersion(uint page) const {
+			return mPages[page].mVersion;
+		}
+
+		inline size_t GetEntryCount() const {
+			return mEntries.size();
+		}
+
+		// Times the atlas was compacted, so remapped rectangles can be refreshed
+		inline uint GetCompactCount() const {
+			return mCompactCount;
+		}
+
+		inline uint GetPageWidth() const {
+			return mPageWidth;
+		}
+
+		inline uint GetPageHeight() const {
+			return mPageHeight;
+		}
+
+		inline uint GetPadding() const {
+			return mPadding;
+		}
+	};
+}
@@ -57,7 +57,8 @@ namespace Morpheus {
 
 	enum class TaskPinOwnerType {
 		TASK,
-		BARRIER
+		BARRIER,
+		GRAPH
 	};
 
 	struct TaskNodeInLock;
@@ -114,6 +115,7 @@ namespace Morpheus {
 		union {
 			ITask* mTask;
 			TaskBarrier* mBarrier;
+			CompiledTaskGraphPin* mGraphPin;
 		} mOwner;
 	public:
 		inline ITask* Task() {
@@ -160,11 +162,17 @@ namespace Morpheus {
 			mOwnerType = TaskPinOwnerType::BARRIER;
 		}
 
+		inline TaskNodeIn(CompiledTaskGraphPin* owner) {
+			mOwner.mGraphPin = owner;
+			mOwnerType = TaskPinOwnerType::GRAPH;
+		}
+
 		friend class TaskNodeOut;
 		friend class ImmediateTaskQueue;
 		friend class ThreadPool;
 		friend class ITaskQueue;
 		friend class TaskNodeInLock;
+		friend class CompiledTaskGraph;
 	};
 
 	struct TaskNodeOutLock {
@@ -207,6 +215,7 @@ namespace Morpheus {
 		friend class ITaskQueue;
 		friend class TaskNodeOutLock;
 		friend class TaskNodeInLock;
+		friend class CompiledTaskGraph;
 	};
 
 	struct TaskBarrier {
@@ -282,6 +291,13 @@ namespace Morpheus {
 			mNodeOut.Lock().Reset();
 		}
 
+		// Only safe while nothing else can touch the task
+		inline void ResetUnsafe() {
+			mStagesFinished = 0;
+			mNodeIn.ResetUnsafe();
+			mNodeOut.ResetUnsafe();
+		}
+
 		inline TaskResult Run(const TaskParams& params) {
 			mCurrentStage = 0;
 			return InternalRun(params);
@@ -320,6 +336,7 @@ namespace Morpheus {
 	class IParameterizedTask : public ITask {
 	private:
 		std::tuple<Args...> mArgs;
+		const std::tuple<Args...>* mBoundArgs = nullptr;
 
 		virtual TaskResult InternalParameterizedRun(const TaskParams& params, const Args&... args) = 0;
 
@@ -327,7 +344,7 @@ namespace Morpheus {
 			TaskResult result;
 			std::apply([this, &params, &result](const Args&... args) {
 				result = InternalParameterizedRun(params, args...);
-			}, mArgs);
+			}, mBoundArgs ? *mBoundArgs : mArgs);
 			return result;
 		}
 
@@ -336,6 +353,12 @@ namespace Morpheus {
 			mArgs = std::make_tuple<Args...>(std::forward<Args...>(args)...);
 		}
 
+		// Reads the parameters from args instead, so they can be changed for many
+		// tasks at once. Takes precedence over SetParameters until unbound with nullptr.
+		inline void BindParameters(const std::tuple<Args...>* args) {
+			mBoundArgs = args;
+		}
+
 		inline IParameterizedTask(TaskType taskType, int assignedThread = ASSIGN_THREAD_ANY) : 
 			ITask(taskType, assignedThread) {
 		}
@@ -735,6 +758,20 @@ namespace Morpheus {
 			}
 		}
 
+		inline void BindParameters(const std::tuple<Args...>* args) {
+			for (auto& mem : mMembers) {
+				mem->BindParameters(args);
+			}
+
+			for (auto& mem : mOwnedMembers) {
+				mem->BindParameters(args);
+			}
+
+			for (auto& group : mSubGroups) {
+				group->BindParameters(args);
+			}
+		}
+
 		inline TaskBarrier& BarrierIn() {
 			return mBarrierIn;
 		}
@@ -999,6 +1036,9 @@ namespace Morpheus {
 
 		virtual void YieldUntilEmpty() = 0;
 
+		// Threads that run tasks of this queue, including the calling thread
+		virtual uint ThreadCount() const = 0;
+
 		template <typename T>
 		friend class Promise;
 	};
@@ -1024,6 +1064,10 @@ namespace Morpheus {
 		inline uint RemainingJobCount() const {
 			return mImmediateQueue.size();
 		}
+
+		inline uint ThreadCount() const override {
+			return 1;
+		}
 	};
 
 	struct TaskComparePriority {
@@ -1068,7 +1112,7 @@ namespace Morpheus {
 			return mTasksPending == 0;
 		}
 
-		inline uint ThreadCount() const {
+		inline uint ThreadCount() const override {
 			return mThreads.size() + 1;
 		}
 
@@ -1095,6 +1139,105 @@ namespace Morpheus {
 		friend class TaskNodeDependencies;
 	};
 
+	// Splits [0, count) into chunks of chunkSize and runs kernel(begin, end) on each.
+	// The caller works through the chunks itself while helper tasks on the queue claim
+	// chunks from the same counter. It returns once every chunk is done, so it is safe
+	// to use inside tasks that are reset and re-run every frame.
+	void ParallelFor(ITaskQueue* queue,
+		size_t count,
+		size_t chunkSize,
+		const std::function<void(size_t, size_t)>& kernel,
+		TaskType type = TaskType::UNSPECIFIED);
+
+	struct CompiledTaskGraphPin {
+		TaskNodeIn mIn;
+		CompiledTaskGraph* mGraph = nullptr;
+		uint mNode = 0;
+
+		inline CompiledTaskGraphPin() : mIn(this) {
+		}
+	};
+
+	// A task graph whose topology is frozen into flat arrays, so running it again
+	// only resets a counter per node instead of every pin of every group.
+	// Compiling takes over the outputs of the tasks in the graph until the graph
+	// is released; neither may happen while the graph is running.
+	// Orders two nodes of a compiled graph without connecting their pins.
+	// Nodes are given by their input pins, to runs after from is finished.
+	struct TaskGraphEdge {
+		TaskNodeIn* mFrom;
+		TaskNodeIn* mTo;
+	};
+
+	class CompiledTaskGraph {
+	private:
+		struct Node {
+			ITask* mTask = nullptr;
+			TaskBarrier* mBarrier = nullptr;
+			uint mInputCount = 0;
+			uint mSuccessorBegin = 0;
+			uint mSuccessorEnd = 0;
+
+			// Connections of mTask from before compilation
+			std::vector<TaskNodeOut*> mSavedInputs;
+			std::vector<TaskNodeIn*> mSavedOutputs;
+		};
+
+		std::vector<Node> mNodes;
+		std::vector<uint> mSuccessors;
+		std::unique_ptr<std::atomic<uint>[]> mInputsLeft;
+		std::unique_ptr<std::atomic<bool>[]> mFinished;
+		std::unique_ptr<std::chrono::high_resolution_clock::time_point[]> mFinishTimes;
+		std::unique_ptr<CompiledTaskGraphPin[]> mPins;
+		std::unordered_map<const TaskNodeIn*, uint> mNodeIndices;
+		bool bCompiled = false;
+
+		void Start(ITaskQueue* queue, uint node);
+		void Finish(ITaskQueue* queue, uint node);
+
+	public:
+		~CompiledTaskGraph() {
+			Release();
+		}
+
+		// Freezes everything reachable from entries, plus the extra edges between
+		// those nodes. Throws if there is a cycle.
+		void Compile(const std::vector<TaskNodeIn*>& entries,
+			const std::vector<TaskGraphEdge>& edges = {});
+		// Gives the tasks their original connections back
+		void Release();
+		// Prepares the graph to run again
+		void Reset();
+
+		// Starts an entry node. Nodes with inputs start on their own.
+		void Trigger(ITaskQueue* queue, uint node);
+		// Marks a node as finished without running it or its successors
+		void SetFinished(uint node);
+
+		// Throws if the barrier is not part of the graph
+		uint FindNode(const TaskBarrier* barrier) const;
+
+		inline bool IsFinished(uint node) const {
+			return mFinished[node].load(std::memory_order_acquire);
+		}
+
+		inline bool IsCompiled() const {
+			return bCompiled;
+		}
+
+		// Only valid once IsFinished(node) is true. Nodes that were marked
+		// finished with SetFinished keep the default time point.
+		inline std::chrono::high_resolution_clock::time_point FinishTime(uint node) const {
+			return mFinishTimes[node];
+		}
+
+		inline uint NodeCount() const {
+			return mNodes.size();
+		}
+
+		friend class ITaskQueue;
+	};
+
 	void ITask::operator()() {
 		ImmediateTaskQueue queue;
 		queue.Trigger(this);
@@ -190,6 +190,9 @@ struct MaterialAttribs {
 	float mRoughnessFactor;
 	float mDisplacementFactor;
 	float mPadding;
+	// Selects the channel of the metallic and roughness textures to read
+	float4 mMetallicChannel;
+	float4 mRoughnessChannel;
 };
 
 #ifdef CHECK_STRUCT_ALIGNMENT
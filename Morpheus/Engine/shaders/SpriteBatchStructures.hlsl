@@ -15,6 +15,9 @@ namespace Morpheus {
 
 		float2 mSize;
 		float2 mOrigin;
+
+		// Texture slot of the sprite when the batch binds several textures
+		float mSlot;
 	};
 }
 
@@ -31,6 +34,7 @@ struct SpriteBatchVSInput
 
 	float2 mSize 		: ATTRIB4;
 	float2 mOrigin		: ATTRIB5;
+	float mSlot			: ATTRIB6;
 };
 
 struct SpriteBatchGSInput
@@ -41,6 +45,7 @@ struct SpriteBatchGSInput
 	float4 mUVY			: TEXCOORD1;
 	float2 mUVTop		: TEXCOORD2;
 	float2 mUVBottom	: TEXCOORD3;
+	nointerpolation float mSlot : TEXCOORD4;
 };
 
 struct SpriteBatchPSInput 
@@ -48,6 +53,7 @@ struct SpriteBatchPSInput
 	float4 mPos 		: SV_Position;
 	float4 mColor		: COLOR0;
 	float2 mUV			: TEXCOORD0;
+	nointerpolation float mSlot : TEXCOORD1;
 };
 
 #endif
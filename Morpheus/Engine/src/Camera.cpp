@@ -186,19 +186,25 @@ namespace Morpheus {
 
 	HLSL::CameraAttribs Camera::GetTransformedAttribs(entt::entity entity, entt::registry* registry, 
 		DG::ISwapChain* swapChain, bool bIsGL) {
-		auto eye3 = GetEye();
-		auto view = GetView();
-		auto proj = GetProjection(swapChain, bIsGL);
-
 		RendererTransformCache* cameraTransform = nullptr;
 
 		if (entity != entt::null)
 			cameraTransform = registry->try_get<RendererTransformCache>(entity);
 
-		if (cameraTransform) {
-			auto camera_transform_inv = cameraTransform->mCache.Inverse();
+		return GetTransformedAttribs(cameraTransform ? &cameraTransform->mCache : nullptr, 
+			swapChain, bIsGL);
+	}
+
+	HLSL::CameraAttribs Camera::GetTransformedAttribs(const DG::float4x4* transform,
+		DG::ISwapChain* swapChain, bool bIsGL) {
+		auto eye3 = GetEye();
+		auto view = GetView();
+		auto proj = GetProjection(swapChain, bIsGL);
+
+		if (transform) {
+			auto camera_transform_inv = transform->Inverse();
 			view = camera_transform_inv * view;
-			eye3 = eye3 * (cameraTransform->mCache);
+			eye3 = eye3 * (*transform);
 		}
 
 		auto eye = DG::float4(eye3, 1.0f);
@@ -217,6 +223,9 @@ namespace Morpheus {
 	HLSL::CameraAttribs Camera::GetTransformedAttribs(entt::entity entity, entt::registry* registry, RealtimeGraphics& graphics) {
 		return GetTransformedAttribs(entity, registry, graphics.SwapChain(), graphics.IsGL());
 	}
+	HLSL::CameraAttribs Camera::GetTransformedAttribs(const DG::float4x4* transform, RealtimeGraphics& graphics) {
+		return GetTransformedAttribs(transform, graphics.SwapChain(), graphics.IsGL());
+	}
 
 	Camera::Camera(CameraType type) :
 		mType(type) {	
@@ -268,6 +277,22 @@ namespace Morpheus {
 		return GetProjection(graphics.SwapChain(), graphics.IsGL());
 	}
 
+	DG::float4x4 Camera::GetProjection(float aspectRatio, bool bIsGL) const {
+		if (mType == CameraType::PERSPECTIVE) {
+			float yScale = 1.0f / std::tan(mFieldOfView / 2.0f);
+
+			DG::float4x4 proj;
+			proj._11 = yScale / aspectRatio;
+			proj._22 = yScale;
+			proj.SetNearFarClipPlanes(mNearPlane, mFarPlane, bIsGL);
+			return proj;
+		} else if (mType == CameraType::ORTHOGRAPHIC) {
+			return GetAdjustedOrthoMatrix(bIsGL, mOrthoSize, mNearPlane, mFarPlane);
+		} else {
+			throw std::runtime_error("Invalid Camera Type!");
+		}
+	}
+
 	DG::float3 Camera::GetEye() const {
 		return mEye;
 	}
@@ -0,0 +1,55 @@
+#include <Engine/ComponentAccess.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Morpheus {
+	thread_local const ComponentAccess* gCurrentComponentAccess = nullptr;
+
+	bool ComponentAccess::CanRead(entt::id_type component) const {
+		return bExclusive ||
+			std::find(mReads.begin(), mReads.end(), component) != mReads.end() ||
+			std::find(mWrites.begin(), mWrites.end(), component) != mWrites.end();
+	}
+
+	bool ComponentAccess::CanWrite(entt::id_type component) const {
+		return bExclusive ||
+			std::find(mWrites.begin(), mWrites.end(), component) != mWrites.end();
+	}
+
+	bool ComponentAccess::ConflictsWith(const ComponentAccess& other) const {
+		if (bExclusive || other.bExclusive)
+			return true;
+
+		// Write-write and read-write pairs conflict, read-read pairs do not
+		for (auto write : mWrites) {
+			if (other.CanRead(write))
+				return true;
+		}
+
+		for (auto write : other.mWrites) {
+			if (CanRead(write))
+				return true;
+		}
+
+		return false;
+	}
+
+	ComponentAccessScope::ComponentAccessScope(const ComponentAccess* access) :
+		mPrevious(gCurrentComponentAccess) {
+		gCurrentComponentAccess = access;
+	}
+
+	ComponentAccessScope::~ComponentAccessScope() {
+		gCurrentComponentAccess = mPrevious;
+	}
+
+	const ComponentAccess* GetCurrentComponentAccess() {
+		return gCurrentComponentAccess;
+	}
+
+	void ThrowUndeclaredAccess(const char* kind, entt::type_info type) {
+		throw std::runtime_error(std::string("Task tried to ") + kind + " " +
+			std::string(type.name()) + " without declaring it!");
+	}
+}
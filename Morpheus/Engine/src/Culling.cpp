@@ -0,0 +1,159 @@
+#include <Engine/Culling.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MORPHEUS_CULLING_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Morpheus {
+	Frustum::Frustum(const DG::float4x4& viewProj, bool bIsGL) {
+		auto& m = viewProj;
+
+		// Clip coordinates are v * viewProj, so each is a column of the matrix
+		DG::float4 x(m.m00, m.m10, m.m20, m.m30);
+		DG::float4 y(m.m01, m.m11, m.m21, m.m31);
+		DG::float4 z(m.m02, m.m12, m.m22, m.m32);
+		DG::float4 w(m.m03, m.m13, m.m23, m.m33);
+
+		mPlanes[(int)FrustumPlane::LEFT] = w + x;
+		mPlanes[(int)FrustumPlane::RIGHT] = w - x;
+		mPlanes[(int)FrustumPlane::BOTTOM] = w + y;
+		mPlanes[(int)FrustumPlane::TOP] = w - y;
+		mPlanes[(int)FrustumPlane::ZNEAR] = bIsGL ? w + z : z;
+		mPlanes[(int)FrustumPlane::ZFAR] = w - z;
+
+		for (auto& plane : mPlanes) {
+			float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			plane = plane / length;
+		}
+
+		for (int i = 0; i < 8; ++i) {
+			auto& plane = mPlanes[std::min(i, 5)];
+			mNormalX[i] = plane.x;
+			mNormalY[i] = plane.y;
+			mNormalZ[i] = plane.z;
+			mDistance[i] = plane.w;
+		}
+	}
+
+	DG::float4x4 GetCameraView(const Camera& camera,
+		const DG::float4x4* transform) {
+		auto view = camera.GetView();
+
+		// Same as Camera::GetTransformedAttribs
+		if (transform)
+			view = transform->Inverse() * view;
+
+		return view;
+	}
+
+	DG::float4x4 GetCameraViewProjection(const Camera& camera,
+		const DG::float4x4* transform,
+		const DG::float4x4& projection) {
+		return GetCameraView(camera, transform) * projection;
+	}
+
+	Frustum Frustum::FromCamera(const Camera& camera,
+		const DG::float4x4* transform,
+		const DG::float4x4& projection,
+		bool bIsGL) {
+		return Frustum(GetCameraViewProjection(camera, transform, projection), bIsGL);
+	}
+
+	bool Frustum::IsVisible(const BoundingBox& box, const DG::float4x4& transform) const {
+		if (box.mLower.x > box.mUpper.x ||
+			box.mLower.y > box.mUpper.y ||
+			box.mLower.z > box.mUpper.z)
+			return true;
+
+		auto& m = transform;
+		auto c = box.Center();
+		auto e = 0.5f * box.Extents();
+
+		// Center of the box and its half axes in world space
+		float cx = c.x * m.m00 + c.y * m.m10 + c.z * m.m20 + m.m30;
+		float cy = c.x * m.m01 + c.y * m.m11 + c.z * m.m21 + m.m31;
+		float cz = c.x * m.m02 + c.y * m.m12 + c.z * m.m22 + m.m32;
+
+		float ax[3] = { m.m00 * e.x, m.m10 * e.y, m.m20 * e.z };
+		float ay[3] = { m.m01 * e.x, m.m11 * e.y, m.m21 * e.z };
+		float az[3] = { m.m02 * e.x, m.m12 * e.y, m.m22 * e.z };
+
+#ifdef MORPHEUS_CULLING_SSE
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		__m128 vcx = _mm_set1_ps(cx);
+		__m128 vcy = _mm_set1_ps(cy);
+		__m128 vcz = _mm_set1_ps(cz);
+
+		for (int i = 0; i < 8; i += 4) {
+			__m128 nx = _mm_load_ps(&mNormalX[i]);
+			__m128 ny = _mm_load_ps(&mNormalY[i]);
+			__m128 nz = _mm_load_ps(&mNormalZ[i]);
+
+			// Signed distance of the center to each plane
+			__m128 d = _mm_add_ps(_mm_load_ps(&mDistance[i]),
+				_mm_add_ps(_mm_mul_ps(nx, vcx),
+				_mm_add_ps(_mm_mul_ps(ny, vcy), _mm_mul_ps(nz, vcz))));
+
+			// Extent of the box along the normal of each plane
+			__m128 r = _mm_setzero_ps();
+			for (int j = 0; j < 3; ++j) {
+				__m128 dot = _mm_add_ps(_mm_mul_ps(nx, _mm_set1_ps(ax[j])),
+					_mm_add_ps(_mm_mul_ps(ny, _mm_set1_ps(ay[j])),
+					_mm_mul_ps(nz, _mm_set1_ps(az[j]))));
+				r = _mm_add_ps(r, _mm_andnot_ps(signMask, dot));
+			}
+
+			// Completely behind any one plane
+			if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(d, r), _mm_setzero_ps())))
+				return false;
+		}
+
+		return true;
+#else
+		for (auto& plane : mPlanes) {
+			float d = plane.x * cx + plane.y * cy + plane.z * cz + plane.w;
+
+			float r = 0.0f;
+			for (int j = 0; j < 3; ++j)
+				r += std::abs(plane.x * ax[j] + plane.y * ay[j] + plane.z * az[j]);
+
+			if (d + r < 0.0f)
+				return false;
+		}
+
+		return true;
+#endif
+	}
+
+	bool Frustum::IsVisible(const BoundingBox& box) const {
+		return IsVisible(box, DG::float4x4::Identity());
+	}
+
+	void CullStaticMeshes(const Frustum& frustum,
+		const ArenaArray<StaticMeshInstance>& instances,
+		std::vector<uint32_t>* visible,
+		ITaskQueue* queue) {
+		// One flag per instance, so chunks never write to the same memory
+		std::vector<uint8_t> flags(instances.size());
+
+		ParallelFor(queue, instances.size(), CULL_CHUNK_SIZE,
+			[&frustum, &instances, &flags](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				auto& instance = instances[i];
+				flags[i] = instance.mGeometry &&
+					frustum.IsVisible(instance.mGeometry->GetBoundingBox(), instance.mTransform);
+			}
+		}, TaskType::RENDER);
+
+		visible->clear();
+		for (size_t i = 0; i < flags.size(); ++i) {
+			if (flags[i])
+				visible->emplace_back((uint32_t)i);
+		}
+	}
+}
@@ -0,0 +1,790 @@
+#include <Engine/GeometryBVH.hpp>
+#include <Engine/Resources/Geometry.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+
+namespace Morpheus {
+
+	struct BVHBuildState {
+		struct TopNode {
+			BoundingBox mBounds;
+			int mLeft = -1;
+			int mRight = -1;
+			int mJob = -1;
+		};
+
+		struct Job {
+			uint32_t mBegin;
+			uint32_t mEnd;
+			uint mDepth;
+			std::vector<BVHNode> mNodes;
+		};
+
+		std::vector<DG::float3> mPositions;
+		std::vector<uint32_t> mIndices;
+
+		std::vector<BoundingBox> mPrimBounds;
+		std::vector<DG::float3> mCentroids;
+		std::vector<uint32_t> mPrims;
+
+		std::vector<TopNode> mTop;
+		std::vector<Job> mJobs;
+	};
+
+	void ComputePrimitiveBounds(BVHBuildState& state) {
+		size_t triCount = state.mIndices.size() / 3;
+
+		state.mPrimBounds.resize(triCount);
+		state.mCentroids.resize(triCount);
+		state.mPrims.resize(triCount);
+
+		for (size_t i = 0; i < triCount; ++i) {
+			BoundingBox box = BoundingBox::Empty();
+			box.Grow(state.mPositions[state.mIndices[3 * i]]);
+			box.Grow(state.mPositions[state.mIndices[3 * i + 1]]);
+			box.Grow(state.mPositions[state.mIndices[3 * i + 2]]);
+
+			state.mPrimBounds[i] = box;
+			state.mCentroids[i] = box.Center();
+			state.mPrims[i] = i;
+		}
+	}
+
+	BoundingBox ComputeRangeBounds(const BVHBuildState& state,
+		uint32_t begin, uint32_t end) {
+		BoundingBox box = BoundingBox::Empty();
+		for (uint32_t i = begin; i < end; ++i)
+			box.Grow(state.mPrimBounds[state.mPrims[i]]);
+		return box;
+	}
+
+	// Finds a binned SAH split of the given primitive range and partitions the range.
+	// Returns false if the range should become a leaf instead.
+	bool SplitRangeSAH(BVHBuildState& state,
+		uint32_t begin, uint32_t end,
+		const BoundingBox& bounds,
+		uint32_t* middle) {
+
+		uint32_t count = end - begin;
+
+		if (count <= 1)
+			return false;
+
+		BoundingBox centroidBounds = BoundingBox::Empty();
+		for (uint32_t i = begin; i < end; ++i)
+			centroidBounds.Grow(state.mCentroids[state.mPrims[i]]);
+
+		DG::float3 extents = centroidBounds.Extents();
+
+		struct Bin {
+			BoundingBox mBounds = BoundingBox::Empty();
+			uint32_t mCount = 0;
+		};
+
+		float bestCost = std::numeric_limits<float>::infinity();
+		int bestAxis = -1;
+		int bestBin = -1;
+
+		for (int axis = 0; axis < 3; ++axis) {
+			float lower = centroidBounds.mLower[axis];
+			float extent = extents[axis];
+
+			if (extent <= 0.0f)
+				continue;
+
+			Bin bins[BVH_SAH_BIN_COUNT];
+			float scale = BVH_SAH_BIN_COUNT / extent;
+
+			for (uint32_t i = begin; i < end; ++i) {
+				uint32_t prim = state.mPrims[i];
+				int b = std::min<int>(BVH_SAH_BIN_COUNT - 1,
+					(int)((state.mCentroids[prim][axis] - lower) * scale));
+				bins[b].mCount++;
+				bins[b].mBounds.Grow(state.mPrimBounds[prim]);
+			}
+
+			// Sweep from the right to get the cost of every right partition
+			float rightArea[BVH_SAH_BIN_COUNT - 1];
+			uint32_t rightCount[BVH_SAH_BIN_COUNT - 1];
+
+			BoundingBox accum = BoundingBox::Empty();
+			uint32_t accumCount = 0;
+			for (int b = BVH_SAH_BIN_COUNT - 1; b > 0; --b) {
+				accum.Grow(bins[b].mBounds);
+				accumCount += bins[b].mCount;
+				rightArea[b - 1] = accum.SurfaceArea();
+				rightCount[b - 1] = accumCount;
+			}
+
+			accum = BoundingBox::Empty();
+			accumCount = 0;
+			for (int b = 0; b < BVH_SAH_BIN_COUNT - 1; ++b) {
+				accum.Grow(bins[b].mBounds);
+				accumCount += bins[b].mCount;
+
+				if (accumCount == 0 || rightCount[b] == 0)
+					continue;
+
+				float cost = accum.SurfaceArea() * accumCount +
+					rightArea[b] * rightCount[b];
+
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = b;
+				}
+			}
+		}
+
+		if (bestAxis < 0) {
+			// All centroids coincide, split down the middle if the leaf would be too large
+			if (count <= BVH_MAX_LEAF_SIZE)
+				return false;
+
+			*middle = begin + count / 2;
+			return true;
+		}
+
+		// Traversal and intersection costs are both taken to be one
+		float area = bounds.SurfaceArea();
+		float splitCost = area > 0.0f ? 1.0f + bestCost / area : 1.0f;
+		float leafCost = (float)count;
+
+		if (count <= BVH_MAX_LEAF_SIZE && splitCost >= leafCost)
+			return false;
+
+		float lower = centroidBounds.mLower[bestAxis];
+		float scale = BVH_SAH_BIN_COUNT / extents[bestAxis];
+
+		auto it = std::partition(&state.mPrims[begin], &state.mPrims[0] + end,
+			[&state, bestAxis, bestBin, lower, scale](uint32_t prim) {
+			int b = std::min<int>(BVH_SAH_BIN_COUNT - 1,
+				(int)((state.mCentroids[prim][bestAxis] - lower) * scale));
+			return b <= bestBin;
+		});
+
+		*middle = (uint32_t)(it - &state.mPrims[0]);
+		return true;
+	}
+
+	uint32_t BuildSubtreeBVH(BVHBuildState& state,
+		uint32_t begin, uint32_t end, uint depth,
+		std::vector<BVHNode>& nodes) {
+
+		uint32_t nodeIndex = nodes.size();
+		nodes.emplace_back();
+
+		BoundingBox bounds = ComputeRangeBounds(state, begin, end);
+		nodes[nodeIndex].mBounds = bounds;
+
+		uint32_t middle;
+		if (depth >= BVH_MAX_DEPTH || !SplitRangeSAH(state, begin, end, bounds, &middle)) {
+			nodes[nodeIndex].mOffset = begin;
+			nodes[nodeIndex].mCount = end - begin;
+			return nodeIndex;
+		}
+
+		BuildSubtreeBVH(state, begin, middle, depth + 1, nodes);
+		uint32_t right = BuildSubtreeBVH(state, middle, end, depth + 1, nodes);
+
+		nodes[nodeIndex].mOffset = right;
+		nodes[nodeIndex].mCount = 0;
+		return nodeIndex;
+	}
+
+	// Splits the top of the tree serially until ranges are small enough
+	// to be handed off to subtree jobs.
+	int BuildTopBVH(BVHBuildState& state,
+		uint32_t begin, uint32_t end, uint depth,
+		uint32_t grainSize) {
+
+		int topIndex = state.mTop.size();
+		state.mTop.emplace_back();
+
+		BoundingBox bounds = ComputeRangeBounds(state, begin, end);
+		state.mTop[topIndex].mBounds = bounds;
+
+		uint32_t middle;
+		if (end - begin <= grainSize || depth >= BVH_MAX_DEPTH ||
+			!SplitRangeSAH(state, begin, end, bounds, &middle)) {
+			BVHBuildState::Job job;
+			job.mBegin = begin;
+			job.mEnd = end;
+			job.mDepth = depth;
+
+			state.mTop[topIndex].mJob = state.mJobs.size();
+			state.mJobs.emplace_back(std::move(job));
+			return topIndex;
+		}
+
+		int left = BuildTopBVH(state, begin, middle, depth + 1, grainSize);
+		int right = BuildTopBVH(state, middle, end, depth + 1, grainSize);
+
+		state.mTop[topIndex].mLeft = left;
+		state.mTop[topIndex].mRight = right;
+		return topIndex;
+	}
+
+	void FlattenTopBVH(const BVHBuildState& state, int topIndex,
+		std::vector<BVHNode>& nodes) {
+		auto& top = state.mTop[topIndex];
+
+		if (top.mJob >= 0) {
+			auto& job = state.mJobs[top.mJob];
+			uint32_t base = nodes.size();
+			for (auto node : job.mNodes) {
+				if (!node.IsLeaf())
+					node.mOffset += base;
+				nodes.emplace_back(node);
+			}
+			return;
+		}
+
+		uint32_t nodeIndex = nodes.size();
+		nodes.emplace_back();
+		nodes[nodeIndex].mBounds = top.mBounds;
+		nodes[nodeIndex].mCount = 0;
+
+		FlattenTopBVH(state, top.mLeft, nodes);
+		nodes[nodeIndex].mOffset = nodes.size();
+		FlattenTopBVH(state, top.mRight, nodes);
+	}
+
+	void BuildBVH(const std::vector<BoundingBox>& bounds,
+		std::vector<BVHNode>* nodes,
+		std::vector<uint32_t>* order) {
+		BVHBuildState state;
+		state.mPrimBounds = bounds;
+		state.mCentroids.resize(bounds.size());
+		state.mPrims.resize(bounds.size());
+
+		for (size_t i = 0; i < bounds.size(); ++i) {
+			state.mCentroids[i] = bounds[i].Center();
+			state.mPrims[i] = i;
+		}
+
+		nodes->clear();
+		if (bounds.size() > 0)
+			BuildSubtreeBVH(state, 0, bounds.size(), 0, *nodes);
+
+		*order = std::move(state.mPrims);
+	}
+
+	void ReadTriangles(const Geometry& geometry,
+		std::vector<DG::float3>* positions,
+		std::vector<uint32_t>* indices) {
+
+		if (!geometry.IsRaw())
+			throw std::runtime_error("Geometry must have a raw aspect to read triangles!");
+
+		auto& layout = geometry.GetLayout();
+
+		if (layout.mPosition < 0)
+			throw std::runtime_error("Geometry layout has no position attribute!");
+
+		auto& posAttrib = layout.mElements[layout.mPosition];
+		if (posAttrib.ValueType != DG::VT_FLOAT32 || posAttrib.NumComponents < 3)
+			throw std::runtime_error("Position attribute must be VT_FLOAT32 with 3 components!");
+
+		std::vector<size_t> offsets;
+		std::vector<size_t> strides;
+		std::vector<size_t> channel_sizes;
+		ComputeLayoutProperties(1, layout, offsets, strides, channel_sizes);
+
+		size_t offset = offsets[layout.mPosition];
+		size_t stride = strides[layout.mPosition];
+		auto& channel = geometry.GetVertexData(posAttrib.BufferSlot);
+
+		size_t vertexCount = 0;
+		if (channel.size() >= offset + 3 * sizeof(float))
+			vertexCount = (channel.size() - offset - 3 * sizeof(float)) / stride + 1;
+
+		positions->resize(vertexCount);
+		for (size_t i = 0, bufindx = offset; i < vertexCount; ++i, bufindx += stride) {
+			const float* ptr = reinterpret_cast<const float*>(&channel[bufindx]);
+			(*positions)[i] = DG::float3(ptr[0], ptr[1], ptr[2]);
+		}
+
+		if (geometry.HasIndexData()) {
+			auto& attribs = geometry.GetIndexedDrawAttribs();
+			auto& data = geometry.GetIndexData();
+
+			if (attribs.IndexType == DG::VT_UINT32) {
+				size_t count = data.size() / sizeof(DG::Uint32);
+				const DG::Uint32* ptr = reinterpret_cast<const DG::Uint32*>(data.data());
+				indices->assign(ptr, ptr + count - count % 3);
+			} else if (attribs.IndexType == DG::VT_UINT16) {
+				size_t count = data.size() / sizeof(DG::Uint16);
+				const DG::Uint16* ptr = reinterpret_cast<const DG::Uint16*>(data.data());
+				indices->assign(ptr, ptr + count - count % 3);
+			} else {
+				throw std::runtime_error("Unsupported index type!");
+			}
+		} else {
+			size_t count = vertexCount - vertexCount % 3;
+			indices->resize(count);
+			for (size_t i = 0; i < count; ++i)
+				(*indices)[i] = i;
+		}
+
+		for (auto index : *indices) {
+			if (index >= vertexCount)
+				throw std::runtime_error("Geometry index out of range!");
+		}
+	}
+
+	Task GeometryBVH::BuildTask(const Geometry* geometry) {
+		std::vector<DG::float3> positions;
+		std::vector<uint32_t> indices;
+		ReadTriangles(*geometry, &positions, &indices);
+		return BuildTask(std::move(positions), std::move(indices));
+	}
+
+	Task GeometryBVH::BuildTask(std::vector<DG::float3>&& positions,
+		std::vector<uint32_t>&& indices) {
+
+		auto state = std::make_shared<BVHBuildState>();
+		state->mPositions = std::move(positions);
+		state->mIndices = std::move(indices);
+
+		Task task([this, state](const TaskParams& e) {
+			if (e.mTask->BeginSubTask()) {
+				ComputePrimitiveBounds(*state);
+
+				uint32_t triCount = state->mPrims.size();
+				if (triCount > 0) {
+					BuildTopBVH(*state, 0, triCount, 0, BVH_PARALLEL_GRAIN);
+				}
+
+				// Build every subtree below the top of the tree as a separate task.
+				// Connect all of them before triggering any so none can fire early.
+				std::vector<ITask*> jobs;
+				jobs.reserve(state->mJobs.size());
+				for (size_t i = 0; i < state->mJobs.size(); ++i) {
+					Task job([state, i](const TaskParams& params) {
+						auto& range = state->mJobs[i];
+						BuildSubtreeBVH(*state, range.mBegin, range.mEnd, range.mDepth, range.mNodes);
+					}, "Build BVH Subtree");
+
+					jobs.emplace_back(e.mQueue->Adopt(std::move(job)));
+				}
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					for (auto job : jobs)
+						lock.Connect(job);
+					bWait = lock.ShouldWait();
+				}
+
+				e.mTask->EndSubTask();
+
+				for (auto job : jobs)
+					e.mQueue->Trigger(job);
+
+				if (bWait)
+					return TaskResult::WAITING;
+			}
+
+			std::vector<BVHNode> nodes;
+			if (state->mTop.size() > 0) {
+				size_t nodeCount = 0;
+				for (auto& job : state->mJobs)
+					nodeCount += job.mNodes.size();
+				nodes.reserve(nodeCount + state->mTop.size());
+
+				FlattenTopBVH(*state, 0, nodes);
+			}
+
+			// Reorder triangles so that every leaf references a contiguous range
+			size_t triCount = state->mPrims.size();
+			std::vector<uint32_t> indices(3 * triCount);
+			for (size_t i = 0; i < triCount; ++i) {
+				uint32_t prim = state->mPrims[i];
+				indices[3 * i] = state->mIndices[3 * prim];
+				indices[3 * i + 1] = state->mIndices[3 * prim + 1];
+				indices[3 * i + 2] = state->mIndices[3 * prim + 2];
+			}
+
+			Set(std::move(nodes),
+				std::move(state->mPositions),
+				std::move(indices),
+				std::move(state->mPrims));
+
+			return TaskResult::FINISHED;
+		}, "Build Geometry BVH");
+
+		return task;
+	}
+
+	// Traversal keeps its stack in a fixed array, so trees that did not come
+	// from the builder have to be checked before they are used
+	void ValidateBVH(const std::vector<BVHNode>& nodes,
+		size_t positionCount,
+		const std::vector<uint32_t>& indices,
+		size_t triangleCount) {
+		if (indices.size() != 3 * triangleCount)
+			throw std::runtime_error("BVH index count does not match its triangle count!");
+
+		for (auto index : indices)
+			if (index >= positionCount)
+				throw std::runtime_error("BVH vertex index out of range!");
+
+		if (nodes.empty())
+			return;
+
+		std::vector<bool> visited(nodes.size(), false);
+		std::vector<std::pair<uint32_t, uint32_t>> stack;
+		stack.emplace_back(0, 0);
+
+		while (!stack.empty()) {
+			auto [current, depth] = stack.back();
+			stack.pop_back();
+
+			if (visited[current])
+				throw std::runtime_error("BVH node is referenced twice!");
+			visited[current] = true;
+
+			auto& node = nodes[current];
+
+			if (node.IsLeaf()) {
+				if (node.mOffset > triangleCount || node.mCount > triangleCount - node.mOffset)
+					throw std::runtime_error("BVH leaf references triangles out of range!");
+				continue;
+			}
+
+			if (depth >= BVH_MAX_DEPTH)
+				throw std::runtime_error("BVH is deeper than BVH_MAX_DEPTH!");
+
+			// Children come after their parent, which also rules out cycles
+			uint32_t left = current + 1;
+			uint32_t right = node.mOffset;
+			if (left >= nodes.size() || right <= left || right >= nodes.size())
+				throw std::runtime_error("BVH node has a child out of range!");
+
+			stack.emplace_back(right, depth + 1);
+			stack.emplace_back(left, depth + 1);
+		}
+
+		for (bool bVisited : visited)
+			if (!bVisited)
+				throw std::runtime_error("BVH has nodes that are not part of the tree!");
+	}
+
+	void GeometryBVH::Set(std::vector<BVHNode>&& nodes,
+		std::vector<DG::float3>&& positions,
+		std::vector<uint32_t>&& indices,
+		std::vector<uint32_t>&& triangles) {
+		ValidateBVH(nodes, positions.size(), indices, triangles.size());
+
+		mNodes = std::move(nodes);
+		mPositions = std::move(positions);
+		mIndices = std::move(indices);
+		mTriangles = std::move(triangles);
+	}
+
+	void GeometryBVH::Clear() {
+		mNodes.clear();
+		mPositions.clear();
+		mIndices.clear();
+		mTriangles.clear();
+	}
+
+	void GeometryBVH::RefitNodes() {
+		// Children always come after their parents, so a reverse sweep is bottom-up
+		for (size_t i = mNodes.size(); i > 0; --i) {
+			auto& node = mNodes[i - 1];
+
+			if (node.IsLeaf()) {
+				BoundingBox box = BoundingBox::Empty();
+				for (uint32_t tri = node.mOffset, end = node.mOffset + node.mCount; tri < end; ++tri) {
+					box.Grow(mPositions[mIndices[3 * tri]]);
+					box.Grow(mPositions[mIndices[3 * tri + 1]]);
+					box.Grow(mPositions[mIndices[3 * tri + 2]]);
+				}
+				node.mBounds = box;
+			} else {
+				BoundingBox box = mNodes[i].mBounds;
+				box.Grow(mNodes[node.mOffset].mBounds);
+				node.mBounds = box;
+			}
+		}
+	}
+
+	void GeometryBVH::Refit(const DG::float3* positions, size_t count) {
+		if (count != mPositions.size())
+			throw std::runtime_error("Refit vertex count does not match BVH!");
+
+		std::copy(positions, positions + count, mPositions.begin());
+		RefitNodes();
+	}
+
+	void GeometryBVH::Refit(const Geometry& geometry) {
+		std::vector<DG::float3> positions;
+		std::vector<uint32_t> indices;
+		ReadTriangles(geometry, &positions, &indices);
+
+		if (indices.size() != mIndices.size())
+			throw std::runtime_error("Refit triangle count does not match BVH!");
+
+		Refit(positions.data(), positions.size());
+	}
+
+	bool IntersectTriangle(const Ray& ray,
+		const DG::float3& a,
+		const DG::float3& b,
+		const DG::float3& c,
+		float tMax, float* t, DG::float2* barycentrics) {
+		// Moller-Trumbore
+		DG::float3 e1 = b - a;
+		DG::float3 e2 = c - a;
+		DG::float3 p = DG::cross(ray.mDirection, e2);
+		float det = DG::dot(e1, p);
+
+		// Only rays parallel to the triangle, or triangles too thin for det to
+		// have a finite inverse, are rejected. A fixed threshold on det would
+		// depend on the scale of the mesh and the length of the ray.
+		float invDet = 1.0f / det;
+		if (!std::isfinite(invDet))
+			return false;
+
+		DG::float3 s = ray.mStart - a;
+		float u = DG::dot(s, p) * invDet;
+		if (u < 0.0f || u > 1.0f)
+			return false;
+
+		DG::float3 q = DG::cross(s, e1);
+		float v = DG::dot(ray.mDirection, q) * invDet;
+		if (v < 0.0f || u + v > 1.0f)
+			return false;
+
+		float dist = DG::dot(e2, q) * invDet;
+		if (dist < 0.0f || dist >= tMax)
+			return false;
+
+		*t = dist;
+		*barycentrics = DG::float2(u, v);
+		return true;
+	}
+
+	bool GeometryBVH::IntersectClosest(const Ray& ray, BVHHit* hit, float tMax) const {
+		if (mNodes.empty())
+			return false;
+
+		PrecomputedRay pre(ray);
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		if (pre.Intersect(mNodes[0].mBounds, tMax) == inf)
+			return false;
+
+		uint32_t stack[BVH_MAX_DEPTH + 1];
+		int stackSize = 0;
+		uint32_t current = 0;
+		bool bHit = false;
+
+		while (true) {
+			auto& node = mNodes[current];
+
+			if (node.IsLeaf()) {
+				for (uint32_t tri = node.mOffset, end = node.mOffset + node.mCount; tri < end; ++tri) {
+					float t;
+					DG::float2 bary;
+					if (IntersectTriangle(ray,
+						mPositions[mIndices[3 * tri]],
+						mPositions[mIndices[3 * tri + 1]],
+						mPositions[mIndices[3 * tri + 2]],
+						tMax, &t, &bary)) {
+						tMax = t;
+						hit->mDistance = t;
+						hit->mTriangle = mTriangles[tri];
+						hit->mBarycentrics = bary;
+						bHit = true;
+					}
+				}
+			} else {
+				uint32_t left = current + 1;
+				uint32_t right = node.mOffset;
+
+				float tLeft = pre.Intersect(mNodes[left].mBounds, tMax);
+				float tRight = pre.Intersect(mNodes[right].mBounds, tMax);
+
+				if (tLeft > tRight) {
+					std::swap(tLeft, tRight);
+					std::swap(left, right);
+				}
+
+				if (tLeft != inf) {
+					// Visit the nearer child first and defer the farther one
+					if (tRight != inf)
+						stack[stackSize++] = right;
+					current = left;
+					continue;
+				}
+			}
+
+			if (stackSize == 0)
+				break;
+			current = stack[--stackSize];
+		}
+
+		return bHit;
+	}
+
+	bool GeometryBVH::IntersectAny(const Ray& ray, float tMax) const {
+		if (mNodes.empty())
+			return false;
+
+		PrecomputedRay pre(ray);
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		uint32_t stack[BVH_MAX_DEPTH + 1];
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0) {
+			uint32_t current = stack[--stackSize];
+			auto& node = mNodes[current];
+
+			if (pre.Intersect(node.mBounds, tMax) == inf)
+				continue;
+
+			if (node.IsLeaf()) {
+				for (uint32_t tri = node.mOffset, end = node.mOffset + node.mCount; tri < end; ++tri) {
+					float t;
+					DG::float2 bary;
+					if (IntersectTriangle(ray,
+						mPositions[mIndices[3 * tri]],
+						mPositions[mIndices[3 * tri + 1]],
+						mPositions[mIndices[3 * tri + 2]],
+						tMax, &t, &bary))
+						return true;
+				}
+			} else {
+				stack[stackSize++] = node.mOffset;
+				stack[stackSize++] = current + 1;
+			}
+		}
+
+		return false;
+	}
+
+	bool Intersects(const BoundingBox& a, const BoundingBox& b) {
+		return a.mLower.x <= b.mUpper.x && a.mUpper.x >= b.mLower.x &&
+			a.mLower.y <= b.mUpper.y && a.mUpper.y >= b.mLower.y &&
+			a.mLower.z <= b.mUpper.z && a.mUpper.z >= b.mLower.z;
+	}
+
+	bool IntersectTriangle(const BoundingBox& box,
+		const DG::float3& a,
+		const DG::float3& b,
+		const DG::float3& c) {
+		// Separating axis test (Akenine-Moller)
+		DG::float3 center = box.Center();
+		DG::float3 half = 0.5f * box.Extents();
+
+		DG::float3 v[3] = { a - center, b - center, c - center };
+		DG::float3 f[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+
+		auto separated = [&v, &half](const DG::float3& axis) {
+			float p0 = DG::dot(v[0], axis);
+			float p1 = DG::dot(v[1], axis);
+			float p2 = DG::dot(v[2], axis);
+			float r = half.x * std::abs(axis.x) +
+				half.y * std::abs(axis.y) +
+				half.z * std::abs(axis.z);
+			return std::max(p0, std::max(p1, p2)) < -r ||
+				std::min(p0, std::min(p1, p2)) > r;
+		};
+
+		// Box face normals
+		for (int i = 0; i < 3; ++i) {
+			float lo = std::min(v[0][i], std::min(v[1][i], v[2][i]));
+			float hi = std::max(v[0][i], std::max(v[1][i], v[2][i]));
+			if (lo > half[i] || hi < -half[i])
+				return false;
+		}
+
+		// Triangle normal
+		if (separated(DG::cross(f[0], f[1])))
+			return false;
+
+		// Cross products of box and triangle edges
+		const DG::float3 boxAxes[3] = {
+			DG::float3(1.0f, 0.0f, 0.0f),
+			DG::float3(0.0f, 1.0f, 0.0f),
+			DG::float3(0.0f, 0.0f, 1.0f)
+		};
+
+		for (int i = 0; i < 3; ++i)
+			for (int j = 0; j < 3; ++j)
+				if (separated(DG::cross(boxAxes[i], f[j])))
+					return false;
+
+		return true;
+	}
+
+	void GeometryBVH::Query(const BoundingBox& box, std::vector<uint32_t>* triangles) const {
+		if (mNodes.empty())
+			return;
+
+		uint32_t stack[BVH_MAX_DEPTH + 1];
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0) {
+			uint32_t current = stack[--stackSize];
+			auto& node = mNodes[current];
+
+			if (!Intersects(node.mBounds, box))
+				continue;
+
+			if (node.IsLeaf()) {
+				for (uint32_t tri = node.mOffset, end = node.mOffset + node.mCount; tri < end; ++tri) {
+					if (IntersectTriangle(box,
+						mPositions[mIndices[3 * tri]],
+						mPositions[mIndices[3 * tri + 1]],
+						mPositions[mIndices[3 * tri + 2]]))
+						triangles->emplace_back(mTriangles[tri]);
+				}
+			} else {
+				stack[stackSize++] = node.mOffset;
+				stack[stackSize++] = current + 1;
+			}
+		}
+	}
+
+	Task GeometryBVH::SaveTask(const std::string& path) const {
+		return Task([this, path](const TaskParams& e) {
+			std::ofstream f(path, std::ios::binary);
+
+			if (f.is_open()) {
+				cereal::PortableBinaryOutputArchive ar(f);
+				Morpheus::Save(ar, this);
+				f.close();
+			} else {
+				throw std::runtime_error("Could not open file for writing!");
+			}
+		}, std::string("Save BVH ") + path + " (Archive)", TaskType::FILE_IO);
+	}
+
+	void GeometryBVH::ReadArchive(const uint8_t* rawArchive, const size_t length) {
+		MemoryInputStream stream(rawArchive, length);
+		cereal::PortableBinaryInputArchive ar(stream);
+		Morpheus::Load(ar, this);
+	}
+
+	Task GeometryBVH::ReadArchiveTask(const std::string& path) {
+		Task task([this, path](const TaskParams& e) {
+			std::vector<uint8_t> data;
+			ReadBinaryFile(path, data);
+			ReadArchive(&data[0], data.size());
+		},
+		std::string("Load BVH ") + path + " (Archive)",
+		TaskType::FILE_IO);
+
+		return task;
+	}
+}
@@ -0,0 +1,59 @@
+#include <Engine/InstanceBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Morpheus {
+	void InstanceBuffer::Pack(const ArenaArray<StaticMeshInstance>& instances,
+		const std::vector<uint32_t>& order,
+		ITaskQueue* queue) {
+		size_t oldSize = mData.size();
+		size_t count = order.size();
+		size_t chunkCount = (count + INSTANCE_PACK_CHUNK_SIZE - 1) / INSTANCE_PACK_CHUNK_SIZE;
+
+		mData.resize(count);
+		mChunkRanges.resize(chunkCount);
+
+		// Each chunk only writes its own entries and its own range
+		ParallelFor(queue, chunkCount, 1, [&](size_t chunkBegin, size_t chunkEnd) {
+			for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+				size_t begin = chunk * INSTANCE_PACK_CHUNK_SIZE;
+				size_t end = std::min(begin + INSTANCE_PACK_CHUNK_SIZE, count);
+
+				InstanceRange dirty{end, begin};
+
+				for (size_t i = begin; i < end; ++i) {
+					auto transform = instances[order[i]].mTransform.Transpose();
+					auto& dest = mData[i];
+
+					if (i >= oldSize || std::memcmp(&dest, &transform, sizeof(DG::float4x4)) != 0) {
+						dest = transform;
+						dirty.mBegin = std::min(dirty.mBegin, i);
+						dirty.mEnd = i + 1;
+					}
+				}
+
+				mChunkRanges[chunk] = dirty;
+			}
+		}, TaskType::RENDER);
+
+		mDirtyRanges.clear();
+		mDirtyCount = 0;
+
+		for (auto& range : mChunkRanges) {
+			if (range.mBegin >= range.mEnd)
+				continue;
+
+			if (!mDirtyRanges.empty() && mDirtyRanges.back().mEnd == range.mBegin)
+				mDirtyRanges.back().mEnd = range.mEnd;
+			else
+				mDirtyRanges.emplace_back(range);
+
+			mDirtyCount += range.mEnd - range.mBegin;
+		}
+	}
+
+	void InstanceBuffer::Invalidate() {
+		mData.clear();
+	}
+}
@@ -0,0 +1,323 @@
+#include <Engine/LightClusters.hpp>
+#include <Engine/Culling.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MORPHEUS_LIGHTS_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Morpheus {
+
+	// Lights are tested in groups of this many, padding lights never hit
+	constexpr size_t LightGroupSize = 4;
+	constexpr float PaddingPosition = 1e18f;
+
+	static bool SphereIntersects(const BoundingBox& box, const DG::float3& center, float radius) {
+		float dx = std::max(std::max(box.mLower.x - center.x, center.x - box.mUpper.x), 0.0f);
+		float dy = std::max(std::max(box.mLower.y - center.y, center.y - box.mUpper.y), 0.0f);
+		float dz = std::max(std::max(box.mLower.z - center.z, center.z - box.mUpper.z), 0.0f);
+		return dx * dx + dy * dy + dz * dz <= radius * radius;
+	}
+
+	LightClusters::LightClusters(uint sizeX, uint sizeY, uint sizeZ) :
+		mSizeX(sizeX), mSizeY(sizeY), mSizeZ(sizeZ) {
+		if (sizeX == 0 || sizeY == 0 || sizeZ == 0)
+			throw std::runtime_error("Light cluster grid cannot be empty!");
+
+		size_t count = (size_t)sizeX * sizeY * sizeZ;
+		mBounds.resize(count);
+		mSpheres.resize(count);
+		mSliceBounds.resize(sizeZ);
+		mSlices.resize(sizeZ);
+		mClusters.resize(count, LightCluster{0, 0});
+	}
+
+	void LightClusters::ComputeBounds(const DG::float4x4& projection, float nearZ, float farZ) {
+		auto invProjection = projection.Inverse();
+		bool bOrthographic = projection.m23 == 0.0f;
+
+		// Point of the view ray through a screen position at a view depth.
+		// The middle of the depth range is inside the clip volume for both
+		// GL and D3D conventions.
+		auto unproject = [&](float ndcX, float ndcY, float depth) {
+			DG::float4 p = DG::float4(ndcX, ndcY, 0.5f, 1.0f) * invProjection;
+			p = p / p.w;
+			if (bOrthographic)
+				return DG::float3(p.x, p.y, depth);
+			float scale = depth / p.z;
+			return DG::float3(p.x * scale, p.y * scale, depth);
+		};
+
+		float ratio = farZ / nearZ;
+
+		for (uint z = 0; z < mSizeZ; ++z) {
+			float zNear = nearZ * std::pow(ratio, (float)z / (float)mSizeZ);
+			float zFar = z + 1 == mSizeZ ? farZ : nearZ * std::pow(ratio, (float)(z + 1) / (float)mSizeZ);
+
+			auto& sliceBounds = mSliceBounds[z];
+			sliceBounds.mLower = DG::float3(std::numeric_limits<float>::infinity(),
+				std::numeric_limits<float>::infinity(),
+				std::numeric_limits<float>::infinity());
+			sliceBounds.mUpper = -sliceBounds.mLower;
+
+			for (uint y = 0; y < mSizeY; ++y) {
+				float ndcTop = 1.0f - 2.0f * (float)y / (float)mSizeY;
+				float ndcBottom = 1.0f - 2.0f * (float)(y + 1) / (float)mSizeY;
+
+				for (uint x = 0; x < mSizeX; ++x) {
+					float ndcLeft = -1.0f + 2.0f * (float)x / (float)mSizeX;
+					float ndcRight = -1.0f + 2.0f * (float)(x + 1) / (float)mSizeX;
+
+					DG::float3 corners[] = {
+						unproject(ndcLeft, ndcTop, zNear),
+						unproject(ndcRight, ndcTop, zNear),
+						unproject(ndcLeft, ndcBottom, zNear),
+						unproject(ndcRight, ndcBottom, zNear),
+						unproject(ndcLeft, ndcTop, zFar),
+						unproject(ndcRight, ndcTop, zFar),
+						unproject(ndcLeft, ndcBottom, zFar),
+						unproject(ndcRight, ndcBottom, zFar)
+					};
+
+					BoundingBox box{corners[0], corners[0]};
+					for (auto& corner : corners) {
+						box.mLower = DG::min(box.mLower, corner);
+						box.mUpper = DG::max(box.mUpper, corner);
+					}
+
+					auto index = GetClusterIndex(x, y, z);
+					mBounds[index] = box;
+
+					DG::float3 center = (box.mLower + box.mUpper) * 0.5f;
+					float radius = DG::length(box.mUpper - center);
+					mSpheres[index] = DG::float4(center.x, center.y, center.z, radius);
+
+					sliceBounds.mLower = DG::min(sliceBounds.mLower, box.mLower);
+					sliceBounds.mUpper = DG::max(sliceBounds.mUpper, box.mUpper);
+				}
+			}
+		}
+
+		mProjection = projection;
+		mNearZ = nearZ;
+		mFarZ = farZ;
+		bHasBounds = true;
+	}
+
+	void LightClusters::AssignSlice(uint z) {
+		auto& slice = mSlices[z];
+		auto& sliceBounds = mSliceBounds[z];
+
+		slice.mCandidates.clear();
+		slice.mIndices.clear();
+
+		for (uint32_t i = 0; i < (uint32_t)mViewLights.size(); ++i) {
+			auto& light = mViewLights[i];
+			if (SphereIntersects(sliceBounds, light.mPosition, light.mRadius))
+				slice.mCandidates.emplace_back(i);
+		}
+
+		// Gather the survivors into padded columns
+		size_t count = slice.mCandidates.size();
+		size_t padded = (count + LightGroupSize - 1) / LightGroupSize * LightGroupSize;
+
+		for (auto column : { &slice.mX, &slice.mY, &slice.mZ, &slice.mRadius,
+			&slice.mDirX, &slice.mDirY, &slice.mDirZ, &slice.mCos, &slice.mSin, &slice.mSpot })
+			column->resize(padded);
+
+		for (size_t i = 0; i < padded; ++i) {
+			if (i < count) {
+				auto& light = mViewLights[slice.mCandidates[i]];
+				slice.mX[i] = light.mPosition.x;
+				slice.mY[i] = light.mPosition.y;
+				slice.mZ[i] = light.mPosition.z;
+				slice.mRadius[i] = light.mRadius;
+				slice.mDirX[i] = light.mDirection.x;
+				slice.mDirY[i] = light.mDirection.y;
+				slice.mDirZ[i] = light.mDirection.z;
+				slice.mCos[i] = light.mCos;
+				slice.mSin[i] = light.mSin;
+				slice.mSpot[i] = light.bSpot ? 1.0f : 0.0f;
+			} else {
+				slice.mX[i] = PaddingPosition;
+				slice.mY[i] = PaddingPosition;
+				slice.mZ[i] = PaddingPosition;
+				slice.mRadius[i] = 0.0f;
+				slice.mDirX[i] = 0.0f;
+				slice.mDirY[i] = 0.0f;
+				slice.mDirZ[i] = 1.0f;
+				slice.mCos[i] = -1.0f;
+				slice.mSin[i] = 0.0f;
+				slice.mSpot[i] = 0.0f;
+			}
+		}
+
+		for (uint y = 0; y < mSizeY; ++y) {
+			for (uint x = 0; x < mSizeX; ++x) {
+				auto index = GetClusterIndex(x, y, z);
+				auto& box = mBounds[index];
+				auto& sphere = mSpheres[index];
+				auto& cluster = mClusters[index];
+
+				cluster.mOffset = (uint32_t)slice.mIndices.size();
+
+				for (size_t group = 0; group < padded; group += LightGroupSize) {
+					int mask = 0;
+
+#ifdef MORPHEUS_LIGHTS_SSE
+					__m128 lx = _mm_loadu_ps(&slice.mX[group]);
+					__m128 ly = _mm_loadu_ps(&slice.mY[group]);
+					__m128 lz = _mm_loadu_ps(&slice.mZ[group]);
+					__m128 radius = _mm_loadu_ps(&slice.mRadius[group]);
+					__m128 zero = _mm_setzero_ps();
+
+					// Sphere against the cluster box
+					__m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.mLower.x), lx),
+						_mm_sub_ps(lx, _mm_set1_ps(box.mUpper.x))), zero);
+					__m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.mLower.y), ly),
+						_mm_sub_ps(ly, _mm_set1_ps(box.mUpper.y))), zero);
+					__m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.mLower.z), lz),
+						_mm_sub_ps(lz, _mm_set1_ps(box.mUpper.z))), zero);
+					__m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+						_mm_mul_ps(dz, dz));
+					__m128 hit = _mm_cmple_ps(distSq, _mm_mul_ps(radius, radius));
+
+					// Cone against the sphere around the cluster
+					__m128 cr = _mm_set1_ps(sphere.w);
+					__m128 vx = _mm_sub_ps(_mm_set1_ps(sphere.x), lx);
+					__m128 vy = _mm_sub_ps(_mm_set1_ps(sphere.y), ly);
+					__m128 vz = _mm_sub_ps(_mm_set1_ps(sphere.z), lz);
+					__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+						_mm_mul_ps(vz, vz));
+					__m128 along = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(vx, _mm_loadu_ps(&slice.mDirX[group])),
+						_mm_mul_ps(vy, _mm_loadu_ps(&slice.mDirY[group]))),
+						_mm_mul_ps(vz, _mm_loadu_ps(&slice.mDirZ[group])));
+					__m128 across = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lengthSq, _mm_mul_ps(along, along)), zero));
+					__m128 closest = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(&slice.mCos[group]), across),
+						_mm_mul_ps(_mm_loadu_ps(&slice.mSin[group]), along));
+					__m128 outside = _mm_or_ps(_mm_or_ps(
+						_mm_cmpgt_ps(closest, cr),
+						_mm_cmpgt_ps(along, _mm_add_ps(cr, radius))),
+						_mm_cmplt_ps(along, _mm_sub_ps(zero, cr)));
+					__m128 spot = _mm_cmpgt_ps(_mm_loadu_ps(&slice.mSpot[group]), zero);
+					hit = _mm_andnot_ps(_mm_and_ps(spot, outside), hit);
+
+					mask = _mm_movemask_ps(hit);
+#else
+					for (size_t lane = 0; lane < LightGroupSize; ++lane) {
+						size_t i = group + lane;
+						DG::float3 position(slice.mX[i], slice.mY[i], slice.mZ[i]);
+						float radius = slice.mRadius[i];
+
+						if (!SphereIntersects(box, position, radius))
+							continue;
+
+						if (slice.mSpot[i] > 0.0f) {
+							DG::float3 v = DG::float3(sphere.x, sphere.y, sphere.z) - position;
+							float lengthSq = DG::dot(v, v);
+							float along = v.x * slice.mDirX[i] + v.y * slice.mDirY[i] + v.z * slice.mDirZ[i];
+							float across = std::sqrt(std::max(lengthSq - along * along, 0.0f));
+							float closest = slice.mCos[i] * across - slice.mSin[i] * along;
+							if (closest > sphere.w || along > sphere.w + radius || along < -sphere.w)
+								continue;
+						}
+
+						mask |= 1 << lane;
+					}
+#endif
+
+					while (mask) {
+						int lane = 0;
+						while (!(mask & (1 << lane)))
+							++lane;
+						mask &= ~(1 << lane);
+						slice.mIndices.emplace_back(slice.mCandidates[group + lane]);
+					}
+				}
+
+				cluster.mCount = (uint32_t)slice.mIndices.size() - cluster.mOffset;
+			}
+		}
+	}
+
+	void LightClusters::Build(const DG::float4x4& view,
+		const DG::float4x4& projection,
+		float nearZ,
+		float farZ,
+		const ArenaArray<LightInstance>& lights,
+		ITaskQueue* queue) {
+
+		if (!bHasBounds || nearZ != mNearZ || farZ != mFarZ ||
+			std::memcmp(&projection, &mProjection, sizeof(DG::float4x4)) != 0)
+			ComputeBounds(projection, nearZ, farZ);
+
+		mViewLights.resize(lights.size());
+		for (size_t i = 0; i < lights.size(); ++i) {
+			auto& light = lights[i];
+			auto& viewLight = mViewLights[i];
+
+			DG::float4 position = DG::float4(light.mPosition, 1.0f) * view;
+			viewLight.mPosition = DG::float3(position.x, position.y, position.z);
+			viewLight.mRadius = light.mRange;
+			viewLight.bSpot = light.IsSpot();
+
+			if (viewLight.bSpot) {
+				DG::float4 direction = DG::float4(light.mDirection, 0.0f) * view;
+				viewLight.mDirection = DG::normalize(DG::float3(direction.x, direction.y, direction.z));
+				viewLight.mCos = light.mCosOuterAngle;
+				viewLight.mSin = std::sqrt(std::max(1.0f - light.mCosOuterAngle * light.mCosOuterAngle, 0.0f));
+			} else {
+				viewLight.mDirection = DG::float3(0.0f, 0.0f, 1.0f);
+				viewLight.mCos = -1.0f;
+				viewLight.mSin = 0.0f;
+			}
+		}
+
+		ParallelFor(queue, mSizeZ, 1, [this](size_t begin, size_t end) {
+			for (size_t z = begin; z < end; ++z)
+				AssignSlice((uint)z);
+		});
+
+		// Slices were assigned separately, append them into one list
+		size_t total = 0;
+		for (auto& slice : mSlices)
+			total += slice.mIndices.size();
+		mIndices.resize(total);
+
+		uint32_t offset = 0;
+		size_t clustersPerSlice = (size_t)mSizeX * mSizeY;
+		for (uint z = 0; z < mSizeZ; ++z) {
+			auto& slice = mSlices[z];
+			std::copy(slice.mIndices.begin(), slice.mIndices.end(), mIndices.begin() + offset);
+
+			auto first = mClusters.begin() + z * clustersPerSlice;
+			for (auto it = first; it != first + clustersPerSlice; ++it)
+				it->mOffset += offset;
+
+			offset += (uint32_t)slice.mIndices.size();
+		}
+	}
+
+	void LightClusters::Build(const RenderSnapshot& snapshot,
+		const DG::float4x4& projection,
+		ITaskQueue* queue) {
+		auto& camera = snapshot.mCamera;
+		auto view = GetCameraView(camera,
+			snapshot.bHasCameraTransform ? &snapshot.mCameraTransform : nullptr);
+
+		Build(view, projection, camera.GetNearZ(), camera.GetFarZ(), snapshot.mLights, queue);
+	}
+
+	uint LightClusters::GetSlice(float depth) const {
+		if (depth <= mNearZ)
+			return 0;
+
+		float slice = std::log(depth / mNearZ) / std::log(mFarZ / mNearZ) * (float)mSizeZ;
+		return std::min((uint)slice, mSizeZ - 1);
+	}
+}
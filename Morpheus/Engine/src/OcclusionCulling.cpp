@@ -0,0 +1,374 @@
+#include <Engine/OcclusionCulling.hpp>
+#include <Engine/Culling.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MORPHEUS_OCCLUSION_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Morpheus {
+	OcclusionBuffer::OcclusionBuffer(uint width, uint height) :
+		mWidth(width),
+		mHeight(height) {
+		if (width == 0 || height == 0 || width % 4 != 0)
+			throw std::runtime_error("Occlusion buffer width must be a positive multiple of 4!");
+
+		mTilesX = (width + OCCLUSION_TILE_SIZE - 1) / OCCLUSION_TILE_SIZE;
+		mTilesY = (height + OCCLUSION_TILE_SIZE - 1) / OCCLUSION_TILE_SIZE;
+		mBins.resize(mTilesX * mTilesY);
+
+		DG::uint2 size(width, height);
+		while (true) {
+			mLevelSizes.emplace_back(size);
+			mLevels.emplace_back(size.x * size.y, 1.0f);
+
+			if (size.x == 1 && size.y == 1)
+				break;
+
+			size.x = (size.x + 1) / 2;
+			size.y = (size.y + 1) / 2;
+		}
+
+		mViewProjection = DG::float4x4::Identity();
+	}
+
+	bool SetupTriangle(const DG::float3 v[3], uint width, uint height,
+		OcclusionBuffer::Triangle* result) {
+		float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[2].x - v[0].x) * (v[1].y - v[0].y);
+		if (std::abs(area) < 1e-8f)
+			return false;
+
+		float minX = std::min(v[0].x, std::min(v[1].x, v[2].x));
+		float maxX = std::max(v[0].x, std::max(v[1].x, v[2].x));
+		float minY = std::min(v[0].y, std::min(v[1].y, v[2].y));
+		float maxY = std::max(v[0].y, std::max(v[1].y, v[2].y));
+
+		// Every pixel whose center may be inside, clamped to the screen
+		result->mMinX = std::max((int)std::floor(minX), 0);
+		result->mMinY = std::max((int)std::floor(minY), 0);
+		result->mMaxX = std::min((int)std::floor(maxX), (int)width - 1);
+		result->mMaxY = std::min((int)std::floor(maxY), (int)height - 1);
+
+		if (result->mMinX > result->mMaxX || result->mMinY > result->mMaxY)
+			return false;
+
+		// Positive inside, whichever way the triangle winds
+		float sign = area > 0.0f ? 1.0f : -1.0f;
+		for (int i = 0; i < 3; ++i) {
+			auto& a = v[i];
+			auto& b = v[(i + 1) % 3];
+			result->mEdgeA[i] = sign * (a.y - b.y);
+			result->mEdgeB[i] = sign * (b.x - a.x);
+			result->mEdgeC[i] = sign * (a.x * b.y - a.y * b.x);
+		}
+
+		float dzdx = ((v[1].z - v[0].z) * (v[2].y - v[0].y) - (v[2].z - v[0].z) * (v[1].y - v[0].y)) / area;
+		float dzdy = ((v[2].z - v[0].z) * (v[1].x - v[0].x) - (v[1].z - v[0].z) * (v[2].x - v[0].x)) / area;
+		result->mDepthA = dzdx;
+		result->mDepthB = dzdy;
+		result->mDepthC = v[0].z - dzdx * v[0].x - dzdy * v[0].y;
+
+		return true;
+	}
+
+	void OcclusionBuffer::SetupTriangles(const ArenaArray<OccluderInstance>& occluders, ITaskQueue* queue) {
+		mOccluderTriangles.resize(std::max(mOccluderTriangles.size(), occluders.size()));
+
+		ParallelFor(queue, occluders.size(), 1, [this, &occluders](size_t begin, size_t end) {
+			std::vector<DG::float4> clip;
+
+			for (size_t o = begin; o < end; ++o) {
+				auto& occluder = occluders[o];
+				auto& mesh = *occluder.mMesh;
+				auto& triangles = mOccluderTriangles[o];
+				triangles.clear();
+
+				auto transform = occluder.mTransform * mViewProjection;
+
+				clip.resize(mesh.mVertices.size());
+				for (size_t i = 0; i < clip.size(); ++i)
+					clip[i] = DG::float4(mesh.mVertices[i], 1.0f) * transform;
+
+				for (size_t i = 0; i + 2 < mesh.mIndices.size(); i += 3) {
+					DG::float4 in[3] = {
+						clip[mesh.mIndices[i]],
+						clip[mesh.mIndices[i + 1]],
+						clip[mesh.mIndices[i + 2]]
+					};
+
+					// Clip against the near plane, z = 0
+					DG::float4 polygon[4];
+					int count = 0;
+					for (int j = 0; j < 3; ++j) {
+						auto& a = in[j];
+						auto& b = in[(j + 1) % 3];
+
+						if (a.z >= 0.0f)
+							polygon[count++] = a;
+						if ((a.z >= 0.0f) != (b.z >= 0.0f))
+							polygon[count++] = a + (b - a) * (a.z / (a.z - b.z));
+					}
+
+					DG::float3 screen[4];
+					bool bValid = count >= 3;
+					for (int j = 0; j < count && bValid; ++j) {
+						auto& p = polygon[j];
+						if (p.w <= 1e-6f) {
+							bValid = false;
+							break;
+						}
+
+						float invW = 1.0f / p.w;
+						screen[j] = DG::float3(
+							(p.x * invW * 0.5f + 0.5f) * mWidth,
+							(0.5f - p.y * invW * 0.5f) * mHeight,
+							p.z * invW);
+					}
+
+					if (!bValid)
+						continue;
+
+					for (int j = 1; j + 1 < count; ++j) {
+						DG::float3 fan[3] = { screen[0], screen[j], screen[j + 1] };
+						Triangle triangle;
+						if (SetupTriangle(fan, mWidth, mHeight, &triangle))
+							triangles.emplace_back(triangle);
+					}
+				}
+			}
+		}, TaskType::RENDER);
+	}
+
+	void OcclusionBuffer::BinTriangles() {
+		for (auto& bin : mBins)
+			bin.clear();
+		mTriangles.clear();
+
+		for (auto& triangles : mOccluderTriangles) {
+			for (auto& triangle : triangles) {
+				uint32_t index = (uint32_t)mTriangles.size();
+				mTriangles.emplace_back(triangle);
+
+				int tileMinX = triangle.mMinX / OCCLUSION_TILE_SIZE;
+				int tileMaxX = triangle.mMaxX / OCCLUSION_TILE_SIZE;
+				int tileMinY = triangle.mMinY / OCCLUSION_TILE_SIZE;
+				int tileMaxY = triangle.mMaxY / OCCLUSION_TILE_SIZE;
+
+				for (int y = tileMinY; y <= tileMaxY; ++y)
+					for (int x = tileMinX; x <= tileMaxX; ++x)
+						mBins[x + y * mTilesX].emplace_back(index);
+			}
+
+			triangles.clear();
+		}
+	}
+
+	void OcclusionBuffer::RasterizeTile(uint tile) {
+		int tileX = (tile % mTilesX) * OCCLUSION_TILE_SIZE;
+		int tileY = (tile / mTilesX) * OCCLUSION_TILE_SIZE;
+		int tileEndX = std::min(tileX + OCCLUSION_TILE_SIZE, (int)mWidth);
+		int tileEndY = std::min(tileY + OCCLUSION_TILE_SIZE, (int)mHeight);
+
+		auto depth = mLevels[0].data();
+
+		for (auto index : mBins[tile]) {
+			auto& t = mTriangles[index];
+
+			// Tiles and the width are multiples of 4, so whole groups of 4
+			// pixels never leave the tile
+			int minX = std::max(t.mMinX, tileX) & ~3;
+			int maxX = std::min(t.mMaxX, tileEndX - 1);
+			int minY = std::max(t.mMinY, tileY);
+			int maxY = std::min(t.mMaxY, tileEndY - 1);
+
+#ifdef MORPHEUS_OCCLUSION_SSE
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+
+			__m128 edgeA0 = _mm_set1_ps(t.mEdgeA[0]);
+			__m128 edgeA1 = _mm_set1_ps(t.mEdgeA[1]);
+			__m128 edgeA2 = _mm_set1_ps(t.mEdgeA[2]);
+			__m128 depthA = _mm_set1_ps(t.mDepthA);
+
+			for (int y = minY; y <= maxY; ++y) {
+				float py = y + 0.5f;
+				__m128 rowE0 = _mm_set1_ps(t.mEdgeB[0] * py + t.mEdgeC[0]);
+				__m128 rowE1 = _mm_set1_ps(t.mEdgeB[1] * py + t.mEdgeC[1]);
+				__m128 rowE2 = _mm_set1_ps(t.mEdgeB[2] * py + t.mEdgeC[2]);
+				__m128 rowZ = _mm_set1_ps(t.mDepthB * py + t.mDepthC);
+
+				float* row = &depth[y * mWidth];
+
+				for (int x = minX; x <= maxX; x += 4) {
+					__m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneOffsets);
+
+					__m128 e0 = _mm_add_ps(_mm_mul_ps(edgeA0, px), rowE0);
+					__m128 e1 = _mm_add_ps(_mm_mul_ps(edgeA1, px), rowE1);
+					__m128 e2 = _mm_add_ps(_mm_mul_ps(edgeA2, px), rowE2);
+
+					__m128 inside = _mm_and_ps(_mm_cmpge_ps(e0, zero),
+						_mm_and_ps(_mm_cmpge_ps(e1, zero), _mm_cmpge_ps(e2, zero)));
+
+					if (!_mm_movemask_ps(inside))
+						continue;
+
+					__m128 z = _mm_add_ps(_mm_mul_ps(depthA, px), rowZ);
+					__m128 old = _mm_loadu_ps(&row[x]);
+					__m128 closest = _mm_min_ps(old, z);
+
+					_mm_storeu_ps(&row[x], _mm_or_ps(_mm_and_ps(inside, closest),
+						_mm_andnot_ps(inside, old)));
+				}
+			}
+#else
+			for (int y = minY; y <= maxY; ++y) {
+				float py = y + 0.5f;
+				float* row = &depth[y * mWidth];
+
+				for (int x = minX; x <= maxX; ++x) {
+					float px = x + 0.5f;
+
+					bool bInside = true;
+					for (int i = 0; i < 3; ++i)
+						bInside &= t.mEdgeA[i] * px + t.mEdgeB[i] * py + t.mEdgeC[i] >= 0.0f;
+
+					if (bInside)
+						row[x] = std::min(row[x], t.mDepthA * px + t.mDepthB * py + t.mDepthC);
+				}
+			}
+#endif
+		}
+	}
+
+	void OcclusionBuffer::BuildHierarchy() {
+		for (size_t level = 1; level < mLevels.size(); ++level) {
+			auto& src = mLevels[level - 1];
+			auto& dst = mLevels[level];
+			auto srcSize = mLevelSizes[level - 1];
+			auto dstSize = mLevelSizes[level];
+
+			for (uint y = 0; y < dstSize.y; ++y) {
+				uint y0 = 2 * y;
+				uint y1 = std::min(y0 + 1, srcSize.y - 1);
+
+				for (uint x = 0; x < dstSize.x; ++x) {
+					uint x0 = 2 * x;
+					uint x1 = std::min(x0 + 1, srcSize.x - 1);
+
+					dst[x + y * dstSize.x] = std::max(
+						std::max(src[x0 + y0 * srcSize.x], src[x1 + y0 * srcSize.x]),
+						std::max(src[x0 + y1 * srcSize.x], src[x1 + y1 * srcSize.x]));
+				}
+			}
+		}
+	}
+
+	void OcclusionBuffer::Render(const DG::float4x4& viewProj,
+		const ArenaArray<OccluderInstance>& occluders,
+		ITaskQueue* queue) {
+		mViewProjection = viewProj;
+		std::fill(mLevels[0].begin(), mLevels[0].end(), 1.0f);
+
+		SetupTriangles(occluders, queue);
+		BinTriangles();
+
+		// Tiles never share pixels, so each can be drawn by its own task
+		ParallelFor(queue, mBins.size(), 1, [this](size_t begin, size_t end) {
+			for (size_t tile = begin; tile < end; ++tile)
+				RasterizeTile((uint)tile);
+		}, TaskType::RENDER);
+
+		BuildHierarchy();
+	}
+
+	bool OcclusionBuffer::IsVisible(const BoundingBox& box, const DG::float4x4& transform) const {
+		if (box.mLower.x > box.mUpper.x ||
+			box.mLower.y > box.mUpper.y ||
+			box.mLower.z > box.mUpper.z)
+			return true;
+
+		auto m = transform * mViewProjection;
+
+		float minX = std::numeric_limits<float>::infinity();
+		float minY = minX;
+		float minZ = minX;
+		float maxX = -minX;
+		float maxY = -minX;
+
+		for (int i = 0; i < 8; ++i) {
+			DG::float4 corner(
+				(i & 1) ? box.mUpper.x : box.mLower.x,
+				(i & 2) ? box.mUpper.y : box.mLower.y,
+				(i & 4) ? box.mUpper.z : box.mLower.z, 1.0f);
+			auto p = corner * m;
+
+			if (p.z < 0.0f || p.w <= 1e-6f)
+				return true;
+
+			float invW = 1.0f / p.w;
+			float x = (p.x * invW * 0.5f + 0.5f) * mWidth;
+			float y = (0.5f - p.y * invW * 0.5f) * mHeight;
+
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+			minY = std::min(minY, y);
+			maxY = std::max(maxY, y);
+			minZ = std::min(minZ, p.z * invW);
+		}
+
+		if (maxX < 0.0f || maxY < 0.0f || minX >= mWidth || minY >= mHeight)
+			return true;
+
+		uint x0 = (uint)std::max(minX, 0.0f);
+		uint y0 = (uint)std::max(minY, 0.0f);
+		uint x1 = (uint)std::min(maxX, (float)(mWidth - 1));
+		uint y1 = (uint)std::min(maxY, (float)(mHeight - 1));
+
+		// The finest level where the box covers at most 4x4 texels. Coarser
+		// levels are cheaper to read, but take in more of the screen around it.
+		uint level = 0;
+		while (level + 1 < mLevels.size() &&
+			((x1 >> level) - (x0 >> level) > 3 || (y1 >> level) - (y0 >> level) > 3))
+			++level;
+
+		auto& depth = mLevels[level];
+		uint levelWidth = mLevelSizes[level].x;
+
+		float farthest = 0.0f;
+		for (uint y = y0 >> level; y <= (y1 >> level); ++y)
+			for (uint x = x0 >> level; x <= (x1 >> level); ++x)
+				farthest = std::max(farthest, depth[x + y * levelWidth]);
+
+		return minZ <= farthest;
+	}
+
+	bool OcclusionBuffer::IsVisible(const BoundingBox& box) const {
+		return IsVisible(box, DG::float4x4::Identity());
+	}
+
+	void OcclusionCullStaticMeshes(const OcclusionBuffer& buffer,
+		const ArenaArray<StaticMeshInstance>& instances,
+		std::vector<uint32_t>* visible,
+		ITaskQueue* queue) {
+		auto& indices = *visible;
+		std::vector<uint8_t> flags(indices.size());
+
+		ParallelFor(queue, indices.size(), CULL_CHUNK_SIZE,
+			[&buffer, &instances, &indices, &flags](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				auto& instance = instances[indices[i]];
+				flags[i] = buffer.IsVisible(instance.mGeometry->GetBoundingBox(), instance.mTransform);
+			}
+		}, TaskType::RENDER);
+
+		size_t count = 0;
+		for (size_t i = 0; i < indices.size(); ++i) {
+			if (flags[i])
+				indices[count++] = indices[i];
+		}
+		indices.resize(count);
+	}
+}
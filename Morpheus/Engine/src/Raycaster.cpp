@@ -0,0 +1,309 @@
+#include <Engine/Raycaster.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+#include <Engine/Resources/Geometry.hpp>
+
+#include <algorithm>
+
+namespace Morpheus {
+
+	Raycaster::~Raycaster() {
+		Disconnect();
+	}
+
+	void Raycaster::Connect() {
+		auto& registry = mFrame->mRegistry;
+
+		mFrame->OnDestroy().connect<&Raycaster::OnFrameDestroyed>(*this);
+
+		registry.on_construct<StaticMeshComponent>().connect<&Raycaster::OnChanged>(*this);
+		registry.on_update<StaticMeshComponent>().connect<&Raycaster::OnChanged>(*this);
+		registry.on_destroy<StaticMeshComponent>().connect<&Raycaster::OnChanged>(*this);
+
+		registry.on_construct<RendererTransformCache>().connect<&Raycaster::OnChanged>(*this);
+		registry.on_update<RendererTransformCache>().connect<&Raycaster::OnChanged>(*this);
+		registry.on_destroy<RendererTransformCache>().connect<&Raycaster::OnChanged>(*this);
+	}
+
+	void Raycaster::Disconnect() {
+		// A destroyed frame resets mFrame while its registry is still intact
+		if (!mFrame)
+			return;
+
+		auto& registry = mFrame->mRegistry;
+
+		mFrame->OnDestroy().disconnect<&Raycaster::OnFrameDestroyed>(*this);
+
+		registry.on_construct<StaticMeshComponent>().disconnect<&Raycaster::OnChanged>(*this);
+		registry.on_update<StaticMeshComponent>().disconnect<&Raycaster::OnChanged>(*this);
+		registry.on_destroy<StaticMeshComponent>().disconnect<&Raycaster::OnChanged>(*this);
+
+		registry.on_construct<RendererTransformCache>().disconnect<&Raycaster::OnChanged>(*this);
+		registry.on_update<RendererTransformCache>().disconnect<&Raycaster::OnChanged>(*this);
+		registry.on_destroy<RendererTransformCache>().disconnect<&Raycaster::OnChanged>(*this);
+	}
+
+	void Raycaster::SetFrame(Frame* frame) {
+		Disconnect();
+
+		mFrame = frame;
+		mInstances.clear();
+		mChanged.clear();
+		mIndex.Clear();
+		bInstancesDirty = true;
+
+		if (mFrame)
+			Connect();
+	}
+
+	void Raycaster::OnChanged(entt::registry& registry, entt::entity e) {
+		mChanged.emplace_back(e);
+	}
+
+	void Raycaster::OnFrameDestroyed(Frame& frame) {
+		SetFrame(nullptr);
+	}
+
+	void Raycaster::SetGeometryBVH(Geometry* geometry, std::shared_ptr<GeometryBVH> bvh) {
+		GeometryEntry entry;
+		entry.mGeometry = geometry;
+		entry.mBVH = std::move(bvh);
+		mGeometryBVHs[geometry] = std::move(entry);
+
+		// Instances need to pick up the new BVH
+		bInstancesDirty = true;
+	}
+
+	void Raycaster::ClearGeometryBVHs() {
+		mGeometryBVHs.clear();
+		bInstancesDirty = true;
+	}
+
+	const GeometryBVH* Raycaster::GetBVH(Geometry* geometry) {
+		auto it = mGeometryBVHs.find(geometry);
+		if (it != mGeometryBVHs.end())
+			return it->second.mBVH.get();
+
+		if (!bBuildTriangleBVHs || !geometry->IsRaw())
+			return nullptr;
+
+		GeometryEntry entry;
+		entry.mGeometry = geometry;
+		entry.mBVH = std::make_shared<GeometryBVH>();
+		entry.mBVH->Build(geometry);
+
+		auto result = entry.mBVH.get();
+		mGeometryBVHs[geometry] = std::move(entry);
+		return result;
+	}
+
+	bool Raycaster::UpdateInstance(entt::entity e, Instance* instance) {
+		auto& registry = mFrame->mRegistry;
+
+		if (!registry.valid(e))
+			return false;
+
+		auto mesh = registry.try_get<StaticMeshComponent>(e);
+		if (!mesh || !mesh->mGeometry)
+			return false;
+
+		auto cache = registry.try_get<RendererTransformCache>(e);
+		DG::float4x4 world = cache ? cache->mCache : DG::float4x4::Identity();
+
+		instance->mEntity = e;
+		instance->mBVH = GetBVH(mesh->mGeometry.Ptr());
+		instance->mLocalBounds = mesh->mGeometry->GetBoundingBox();
+		instance->mWorldBounds = instance->mLocalBounds.Transformed(world);
+		instance->mWorldToLocal = world.Inverse();
+		return true;
+	}
+
+	void Raycaster::Rebuild() {
+		auto& registry = mFrame->mRegistry;
+		auto view = registry.view<StaticMeshComponent>();
+
+		mInstances.clear();
+		mInstances.reserve(view.size());
+		mIndex.Clear();
+
+		Instance instance;
+		for (auto e : view) {
+			if (!UpdateInstance(e, &instance))
+				continue;
+
+			mInstances[e] = instance;
+			mIndex.Insert(e, instance.mWorldBounds);
+		}
+
+		mIndex.Rebuild();
+	}
+
+	void Raycaster::Update() {
+		if (!mFrame)
+			return;
+
+		if (bInstancesDirty) {
+			Rebuild();
+			bInstancesDirty = false;
+			mChanged.clear();
+			return;
+		}
+
+		if (mChanged.empty())
+			return;
+
+		std::sort(mChanged.begin(), mChanged.end());
+		mChanged.erase(std::unique(mChanged.begin(), mChanged.end()), mChanged.end());
+
+		// Destroy signals fire before the component is gone, so removals are
+		// only visible now
+		Instance instance;
+		for (auto e : mChanged) {
+			if (UpdateInstance(e, &instance)) {
+				mInstances[e] = instance;
+				mIndex.Move(e, instance.mWorldBounds);
+			} else {
+				mInstances.erase(e);
+				mIndex.Remove(e);
+			}
+		}
+		mChanged.clear();
+
+		mIndex.Optimize();
+		++mRefitCount;
+	}
+
+	bool Raycaster::IntersectInstance(const Instance& instance, const Ray& ray,
+		float tMax, RaycastHit* hit) const {
+
+		// The ray parameter is preserved by the affine transform into local space
+		auto& m = instance.mWorldToLocal;
+		DG::float4 start = DG::float4(ray.mStart, 1.0f) * m;
+		DG::float4 direction = DG::float4(ray.mDirection, 0.0f) * m;
+
+		Ray localRay;
+		localRay.mStart = DG::float3(start.x, start.y, start.z);
+		localRay.mDirection = DG::float3(direction.x, direction.y, direction.z);
+
+		if (instance.mBVH) {
+			BVHHit bvhHit;
+			if (!instance.mBVH->IntersectClosest(localRay, &bvhHit, tMax))
+				return false;
+
+			if (hit) {
+				hit->mDistance = bvhHit.mDistance;
+				hit->mTriangle = bvhHit.mTriangle;
+				hit->mBarycentrics = bvhHit.mBarycentrics;
+			}
+		} else {
+			PrecomputedRay pre(localRay);
+			float t = pre.Intersect(instance.mLocalBounds, tMax);
+			if (t == std::numeric_limits<float>::infinity())
+				return false;
+
+			if (hit) {
+				hit->mDistance = t;
+				hit->mTriangle = std::numeric_limits<uint32_t>::max();
+				hit->mBarycentrics = DG::float2(0.0f, 0.0f);
+			}
+		}
+
+		if (hit) {
+			hit->mEntity = instance.mEntity;
+			hit->mPosition = ray.mStart + hit->mDistance * ray.mDirection;
+		}
+
+		return true;
+	}
+
+	bool Raycaster::CastClosest(const Ray& ray, RaycastHit* hit, float tMax) const {
+		*hit = RaycastHit();
+
+		PrecomputedRay pre(ray);
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		mIndex.Raycast(ray, tMax, [&](entt::entity e, float tEntry) {
+			auto& instance = mInstances.find(e)->second;
+
+			if (pre.Intersect(instance.mWorldBounds, tMax) != inf &&
+				IntersectInstance(instance, ray, tMax, hit))
+				tMax = hit->mDistance;
+
+			return tMax;
+		});
+
+		return hit->mEntity != entt::null;
+	}
+
+	bool Raycaster::CastAny(const Ray& ray, float tMax) const {
+		PrecomputedRay pre(ray);
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		bool bHit = false;
+		mIndex.Raycast(ray, tMax, [&](entt::entity e, float tEntry) {
+			auto& instance = mInstances.find(e)->second;
+
+			// A distance of zero stops the traversal
+			if (pre.Intersect(instance.mWorldBounds, tMax) != inf &&
+				IntersectInstance(instance, ray, tMax, nullptr)) {
+				bHit = true;
+				return 0.0f;
+			}
+
+			return tMax;
+		});
+
+		return bHit;
+	}
+
+	template <typename KernelT>
+	Task CreateRaycastBatchTask(size_t count, KernelT kernel, const std::string& name) {
+		return Task([count, kernel, name](const TaskParams& e) {
+			if (e.mTask->BeginSubTask()) {
+				std::vector<ITask*> chunks;
+				for (size_t begin = 0; begin < count; begin += RAYCAST_BATCH_CHUNK_SIZE) {
+					size_t end = std::min<size_t>(count, begin + RAYCAST_BATCH_CHUNK_SIZE);
+
+					Task chunk([kernel, begin, end](const TaskParams& params) {
+						for (size_t i = begin; i < end; ++i)
+							kernel(i);
+					}, name + " (Chunk)");
+
+					chunks.emplace_back(e.mQueue->Adopt(std::move(chunk)));
+				}
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					for (auto chunk : chunks)
+						lock.Connect(chunk);
+					bWait = lock.ShouldWait();
+				}
+
+				e.mTask->EndSubTask();
+
+				for (auto chunk : chunks)
+					e.mQueue->Trigger(chunk);
+
+				if (bWait)
+					return TaskResult::WAITING;
+			}
+
+			return TaskResult::FINISHED;
+		}, name);
+	}
+
+	Task Raycaster::CastClosestTask(const Ray* rays, size_t count,
+		RaycastHit* hits, float tMax) const {
+		return CreateRaycastBatchTask(count, [this, rays, hits, tMax](size_t i) {
+			CastClosest(rays[i], &hits[i], tMax);
+		}, "Raycast Closest Batch");
+	}
+
+	Task Raycaster::CastAnyTask(const Ray* rays, size_t count,
+		bool* results, float tMax) const {
+		return CreateRaycastBatchTask(count, [this, rays, results, tMax](size_t i) {
+			results[i] = CastAny(rays[i], tMax);
+		}, "Raycast Any Batch");
+	}
+}
@@ -0,0 +1,116 @@
+#include <Engine/RegistrySnapshot.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Components/Transform.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+#include <Engine/Components/SkyboxComponent.hpp>
+#include <Engine/Components/LightProbe.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Morpheus {
+	std::unordered_map<entt::id_type, SnapshotComponentHooks>& GetSnapshotHooks() {
+		static std::unordered_map<entt::id_type, SnapshotComponentHooks> hooks;
+		return hooks;
+	}
+
+	void RegistrySnapshot::RegisterHooks(const SnapshotComponentHooks& hooks) {
+		GetSnapshotHooks()[hooks.mType.hash()] = hooks;
+	}
+
+	const SnapshotComponentHooks* RegistrySnapshot::FindHooks(entt::id_type type) {
+		auto& hooks = GetSnapshotHooks();
+		auto it = hooks.find(type);
+		if (it == hooks.end())
+			return nullptr;
+		return &it->second;
+	}
+
+	void RegistrySnapshot::RegisterEngineComponents() {
+		RegisterComponent<HierarchyData>();
+		RegisterComponent<Transform>();
+		RegisterComponent<RendererTransformCache>();
+		RegisterComponent<Camera>();
+		RegisterComponent<StaticMeshComponent>();
+		RegisterComponent<SkyboxComponent>();
+		RegisterComponent<LightProbe>();
+	}
+
+	void RegistrySnapshot::Capture(const entt::registry& registry) {
+		// Every id ever handed out, including the versions of destroyed ones
+		mEntities.assign(registry.data(), registry.data() + registry.size());
+		mDestroyed = registry.destroyed();
+		mPoolCount = 0;
+
+		registry.visit([this, &registry](const entt::type_info info) {
+			auto&& storage = registry.storage(info);
+			size_t count = storage->size();
+
+			if (count == 0)
+				return;
+
+			auto hooks = FindHooks(info.hash());
+			if (!hooks)
+				throw std::runtime_error("Component " + std::string(info.name()) +
+					" is not registered for snapshots!");
+
+			// Keep the buffers of earlier captures around
+			if (mPoolCount == mPools.size())
+				mPools.emplace_back();
+			auto& pool = mPools[mPoolCount++];
+
+			pool.mHooks = hooks;
+			pool.mEntities.assign(storage->data(), storage->data() + count);
+
+			if (hooks->bEmpty) {
+				pool.mCopiedData.reset();
+				pool.mData = nullptr;
+			} else if (hooks->bTrivial) {
+				size_t bytes = hooks->mSize * count;
+				pool.mTrivialData.resize((bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+				std::memcpy(pool.mTrivialData.data(), storage->raw(), bytes);
+				pool.mCopiedData.reset();
+				pool.mData = pool.mTrivialData.data();
+			} else {
+				pool.mCopiedData = hooks->mCopy(storage->raw(), count, &pool.mData);
+			}
+		});
+
+		// Release whatever is left over from larger captures
+		for (size_t i = mPoolCount; i < mPools.size(); ++i) {
+			mPools[i].mCopiedData.reset();
+			mPools[i].mData = nullptr;
+		}
+	}
+
+	void RegistrySnapshot::Restore(entt::registry& registry) const {
+		registry.clear();
+		registry.assign(mEntities.begin(), mEntities.end(), mDestroyed);
+
+		for (size_t i = 0; i < mPoolCount; ++i) {
+			auto& pool = mPools[i];
+
+			// Keeps the order of the pool, so iteration order survives a rollback
+			if (pool.mHooks->bEmpty) {
+				pool.mHooks->mInsertEmpty(registry, pool.mEntities.data(), pool.mEntities.size());
+			} else {
+				pool.mHooks->mAssure(registry);
+				auto&& storage = registry.storage(pool.mHooks->mType);
+				storage->insert(registry, pool.mEntities.data(), pool.mData, pool.mEntities.size());
+			}
+		}
+	}
+
+	void RegistrySnapshot::Capture(const Frame& frame) {
+		Capture(frame.mRegistry);
+		mRoot = frame.mRoot;
+		mCamera = frame.mCamera;
+	}
+
+	void RegistrySnapshot::Restore(Frame& frame) const {
+		Restore(frame.mRegistry);
+		frame.mRoot = mRoot;
+		frame.mCamera = mCamera;
+	}
+}
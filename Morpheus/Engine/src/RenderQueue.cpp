@@ -0,0 +1,181 @@
+#include <Engine/RenderQueue.hpp>
+
+#include <algorithm>
+
+namespace Morpheus {
+	constexpr uint64_t MaskBits(uint64_t value, int bits) {
+		return value & ((1ull << bits) - 1);
+	}
+
+	void RenderQueue::Build(const ArenaArray<StaticMeshInstance>& instances,
+		const std::vector<uint32_t>& visible,
+		const DG::float3& eye,
+		float maxDepth,
+		const pipeline_func_t& pipelineOf) {
+
+		mKeys.resize(visible.size());
+		mOrder.resize(visible.size());
+
+		mMaterialIds.clear();
+		mPipelineIds.clear();
+		mGeometryIds.clear();
+		mMaterialPipelines.clear();
+
+		constexpr uint32_t maxDepthBucket = (1u << SORT_KEY_DEPTH_BITS) - 1;
+		float depthScale = maxDepth > 0.0f ? maxDepthBucket / maxDepth : 0.0f;
+
+		// Runs of the same material and geometry are common, skip the lookups for them
+		MaterialId lastMaterial = NullMaterialId;
+		Geometry* lastGeometry = nullptr;
+		uint32_t materialId = 0;
+		uint32_t pipelineId = 0;
+		uint32_t geometryId = 0;
+		bool bFirst = true;
+
+		for (size_t i = 0; i < visible.size(); ++i) {
+			auto& instance = instances[visible[i]];
+
+			if (bFirst || instance.mMaterial != lastMaterial) {
+				auto it = mMaterialIds.find(instance.mMaterial);
+				if (it == mMaterialIds.end()) {
+					materialId = (uint32_t)mMaterialIds.size();
+					mMaterialIds[instance.mMaterial] = materialId;
+
+					const void* pipeline = pipelineOf && instance.mMaterial != NullMaterialId ?
+						pipelineOf(instance.mMaterial) : nullptr;
+					auto pipelineIt = mPipelineIds.find(pipeline);
+					if (pipelineIt == mPipelineIds.end())
+						pipelineIt = mPipelineIds.emplace(pipeline, (uint32_t)mPipelineIds.size()).first;
+					mMaterialPipelines.emplace_back(pipelineIt->second);
+				} else {
+					materialId = it->second;
+				}
+
+				pipelineId = mMaterialPipelines[materialId];
+				lastMaterial = instance.mMaterial;
+			}
+
+			if (bFirst || instance.mGeometry != lastGeometry) {
+				auto it = mGeometryIds.find(instance.mGeometry);
+				if (it == mGeometryIds.end())
+					it = mGeometryIds.emplace(instance.mGeometry, (uint32_t)mGeometryIds.size()).first;
+				geometryId = it->second;
+				lastGeometry = instance.mGeometry;
+			}
+
+			bFirst = false;
+
+			auto& m = instance.mTransform;
+			float depth = DG::length(DG::float3(m.m30, m.m31, m.m32) - eye);
+			uint32_t depthBucket = (uint32_t)std::min(depth * depthScale, (float)maxDepthBucket);
+
+			// Ids past the end of their field only cost batching, since
+			// batches compare the real material and geometry
+			uint64_t key = MaskBits(pipelineId, SORT_KEY_PIPELINE_BITS);
+			key = (key << SORT_KEY_MATERIAL_BITS) | MaskBits(materialId, SORT_KEY_MATERIAL_BITS);
+			key = (key << SORT_KEY_GEOMETRY_BITS) | MaskBits(geometryId, SORT_KEY_GEOMETRY_BITS);
+			key = (key << SORT_KEY_DEPTH_BITS) | depthBucket;
+
+			mKeys[i] = key;
+			mOrder[i] = visible[i];
+		}
+
+		SortKeys();
+		EmitBatches(instances, pipelineOf);
+	}
+
+	void RenderQueue::Build(const RenderSnapshot& snapshot,
+		const std::vector<uint32_t>& visible,
+		const pipeline_func_t& pipelineOf) {
+		DG::float3 eye(0.0f, 0.0f, 0.0f);
+		float maxDepth = 0.0f;
+
+		if (snapshot.bHasCamera) {
+			eye = snapshot.mCamera.GetEye();
+			if (snapshot.bHasCameraTransform)
+				eye = eye * snapshot.mCameraTransform;
+			maxDepth = snapshot.mCamera.GetFarZ();
+		}
+
+		Build(snapshot.mStaticMeshes, visible, eye, maxDepth, pipelineOf);
+	}
+
+	void RenderQueue::SortKeys() {
+		size_t count = mKeys.size();
+		mKeysScratch.resize(count);
+		mOrderScratch.resize(count);
+
+		// Least significant digit first, eight bits at a time. Stable, so
+		// instances with equal keys keep their snapshot order.
+		for (int shift = 0; shift < 64; shift += 8) {
+			size_t histogram[256] = {};
+			for (auto key : mKeys)
+				++histogram[(key >> shift) & 0xFF];
+
+			// Every key has the same digit, this pass would not move anything
+			if (histogram[(mKeys.empty() ? 0 : mKeys[0] >> shift) & 0xFF] == count)
+				continue;
+
+			size_t offset = 0;
+			for (auto& bucket : histogram) {
+				size_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; ++i) {
+				auto dest = histogram[(mKeys[i] >> shift) & 0xFF]++;
+				mKeysScratch[dest] = mKeys[i];
+				mOrderScratch[dest] = mOrder[i];
+			}
+
+			std::swap(mKeys, mKeysScratch);
+			std::swap(mOrder, mOrderScratch);
+		}
+	}
+
+	void RenderQueue::EmitBatches(const ArenaArray<StaticMeshInstance>& instances,
+		const pipeline_func_t& pipelineOf) {
+		mBatches.clear();
+		mStats = RenderQueueStats();
+
+		const void* currentPipeline = nullptr;
+		MaterialId currentMaterial = NullMaterialId;
+		Geometry* currentGeometry = nullptr;
+		bool bFirstDraw = true;
+
+		for (size_t i = 0; i < mOrder.size();) {
+			auto& first = instances[mOrder[i]];
+
+			DrawBatch batch;
+			batch.mGeometry = first.mGeometry;
+			batch.mMaterial = first.mMaterial;
+			batch.mFirstInstance = (uint)i;
+
+			for (; i < mOrder.size()
+				&& instances[mOrder[i]].mGeometry == batch.mGeometry
+				&& instances[mOrder[i]].mMaterial == batch.mMaterial; ++i);
+
+			batch.mInstanceCount = (uint)i - batch.mFirstInstance;
+			mBatches.emplace_back(batch);
+
+			if (batch.mMaterial == NullMaterialId)
+				continue;
+
+			const void* pipeline = pipelineOf ? pipelineOf(batch.mMaterial) : nullptr;
+
+			if (bFirstDraw || pipeline != currentPipeline)
+				++mStats.mPipelineChanges;
+			if (bFirstDraw || batch.mMaterial != currentMaterial)
+				++mStats.mMaterialChanges;
+			if (bFirstDraw || batch.mGeometry != currentGeometry)
+				++mStats.mGeometryChanges;
+			++mStats.mDrawCalls;
+
+			currentPipeline = pipeline;
+			currentMaterial = batch.mMaterial;
+			currentGeometry = batch.mGeometry;
+			bFirstDraw = false;
+		}
+	}
+}
@@ -0,0 +1,268 @@
+#include <Engine/RenderSnapshot.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/ParallelView.hpp>
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+#include <Engine/Components/SkyboxComponent.hpp>
+#include <Engine/Components/OccluderComponent.hpp>
+#include <Engine/Components/LightComponents.hpp>
+
+namespace Morpheus {
+	void* FrameArena::Allocate(size_t size, size_t alignment) {
+		while (mCurrentBlock < mBlocks.size()) {
+			auto& block = mBlocks[mCurrentBlock];
+			size_t offset = (mOffset + alignment - 1) & ~(alignment - 1);
+
+			if (offset + size <= block.mSize) {
+				mOffset = offset + size;
+				return &block.mData[offset];
+			}
+
+			++mCurrentBlock;
+			mOffset = 0;
+		}
+
+		Block block;
+		block.mSize = std::max(size + alignment, mBlockSize);
+		block.mData.reset(new uint8_t[block.mSize]);
+		mBlocks.emplace_back(std::move(block));
+
+		mCurrentBlock = mBlocks.size() - 1;
+		mOffset = 0;
+		return Allocate(size, alignment);
+	}
+
+	void FrameArena::Reset() {
+		// Merge everything into a single block, so next frame fits without spilling
+		if (mBlocks.size() > 1) {
+			size_t total = Capacity();
+			mBlocks.clear();
+
+			Block block;
+			block.mSize = total;
+			block.mData.reset(new uint8_t[total]);
+			mBlocks.emplace_back(std::move(block));
+		}
+
+		mCurrentBlock = 0;
+		mOffset = 0;
+	}
+
+	size_t FrameArena::Capacity() const {
+		size_t total = 0;
+		for (auto& block : mBlocks)
+			total += block.mSize;
+		return total;
+	}
+
+	void RenderSnapshot::Clear() {
+		mArena.Reset();
+		mStaticMeshes = ArenaArray<StaticMeshInstance>();
+		mOccluders = ArenaArray<OccluderInstance>();
+		mLights = ArenaArray<LightInstance>();
+		bHasCamera = false;
+		bHasCameraTransform = false;
+		mSkybox = nullptr;
+		bHasLightProbe = false;
+		mLightProbe = LightProbe();
+		mRetainedGeometry.clear();
+		mRetainedMaterials.clear();
+		mRetainedOccluders.clear();
+	}
+
+	template <typename MeshViewT, typename CacheViewT>
+	inline void ExtractStaticMesh(const MeshViewT& meshView, const CacheViewT& cacheView,
+		entt::entity e, StaticMeshInstance* instance) {
+		auto& mesh = meshView.template get<StaticMeshComponent>(e);
+
+		instance->mEntity = e;
+		instance->mGeometry = mesh.mGeometry.Ptr();
+		instance->mMaterial = mesh.mMaterial.Id();
+
+		if (cacheView.contains(e))
+			instance->mTransform = cacheView.template get<RendererTransformCache>(e).mCache;
+		else
+			instance->mTransform = DG::float4x4::Identity();
+	}
+
+	template <typename MeshViewT>
+	inline void RetainResources(const MeshViewT& meshView, RenderSnapshot* snapshot) {
+		// Meshes that share geometry or materials tend to be next to each other
+		Geometry* lastGeometry = nullptr;
+		MaterialId lastMaterial = NullMaterialId;
+		for (auto& instance : snapshot->mStaticMeshes) {
+			if (instance.mGeometry && instance.mGeometry != lastGeometry) {
+				snapshot->mRetainedGeometry.emplace_back(instance.mGeometry);
+				lastGeometry = instance.mGeometry;
+			}
+
+			if (instance.mMaterial != NullMaterialId && instance.mMaterial != lastMaterial) {
+				snapshot->mRetainedMaterials.emplace_back(
+					meshView.template get<StaticMeshComponent>(instance.mEntity).mMaterial);
+				lastMaterial = instance.mMaterial;
+			}
+		}
+	}
+
+	void ExtractStaticMeshes(Frame* frame, RenderSnapshot* snapshot, ITaskQueue* queue) {
+		auto& registry = frame->mRegistry;
+
+		// Creating the views up front makes sure the pools exist before
+		// they are read from multiple threads
+		auto meshView = registry.view<StaticMeshComponent>();
+		auto cacheView = registry.view<RendererTransformCache>();
+
+		snapshot->mStaticMeshes.Allocate(&snapshot->mArena, meshView.size());
+		auto& instances = snapshot->mStaticMeshes;
+
+		ParallelEach(queue, meshView, [&meshView, &cacheView, &instances](size_t i, entt::entity e) {
+			ExtractStaticMesh(meshView, cacheView, e, &instances[i]);
+		}, EXTRACT_CHUNK_SIZE);
+
+		RetainResources(meshView, snapshot);
+	}
+
+	void ExtractStaticMeshes(Frame* frame, RenderSnapshot* snapshot,
+		const SpatialIndex& index, const Frustum& frustum, ITaskQueue* queue) {
+		auto& registry = frame->mRegistry;
+
+		auto meshView = registry.view<StaticMeshComponent>();
+		auto cacheView = registry.view<RendererTransformCache>();
+
+		std::vector<entt::entity> entities;
+		entities.reserve(index.Size());
+		index.Query(frustum, &entities);
+
+		snapshot->mStaticMeshes.Allocate(&snapshot->mArena, entities.size());
+		auto& instances = snapshot->mStaticMeshes;
+
+		ParallelFor(queue, entities.size(), EXTRACT_CHUNK_SIZE,
+			[&meshView, &cacheView, &instances, &entities](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+				ExtractStaticMesh(meshView, cacheView, entities[i], &instances[i]);
+		});
+
+		RetainResources(meshView, snapshot);
+	}
+
+	void ExtractOccluders(Frame* frame, RenderSnapshot* snapshot) {
+		auto& registry = frame->mRegistry;
+		auto occluderView = registry.view<OccluderComponent>();
+
+		// There are only ever a few occluders, not worth splitting up
+		snapshot->mOccluders.Allocate(&snapshot->mArena, occluderView.size());
+		size_t count = 0;
+
+		for (auto e : occluderView) {
+			auto& occluder = occluderView.get<OccluderComponent>(e);
+			if (!occluder.mMesh)
+				continue;
+
+			auto& instance = snapshot->mOccluders[count++];
+			instance.mMesh = occluder.mMesh.get();
+
+			auto cache = registry.try_get<RendererTransformCache>(e);
+			instance.mTransform = cache ? cache->mCache : DG::float4x4::Identity();
+
+			snapshot->mRetainedOccluders.emplace_back(occluder.mMesh);
+		}
+
+		snapshot->mOccluders.mCount = count;
+	}
+
+	void ExtractLights(Frame* frame, RenderSnapshot* snapshot) {
+		auto& registry = frame->mRegistry;
+		auto pointView = registry.view<PointLightComponent>();
+		auto spotView = registry.view<SpotLightComponent>();
+
+		// Hundreds at most, not worth splitting up
+		snapshot->mLights.Allocate(&snapshot->mArena, pointView.size() + spotView.size());
+		size_t count = 0;
+
+		auto getTransform = [&registry](entt::entity e) {
+			auto cache = registry.try_get<RendererTransformCache>(e);
+			return cache ? cache->mCache : DG::float4x4::Identity();
+		};
+
+		for (auto e : pointView) {
+			auto& light = pointView.get<PointLightComponent>(e);
+			auto m = getTransform(e);
+
+			auto& instance = snapshot->mLights[count++];
+			instance.mPosition = DG::float3(m.m30, m.m31, m.m32);
+			instance.mRange = light.mRange;
+			instance.mColor = light.mColor * light.mIntensity;
+			instance.mDirection = DG::float3(0.0f, 0.0f, 1.0f);
+			instance.mCosOuterAngle = -1.0f;
+			instance.mCosInnerAngle = -1.0f;
+		}
+
+		for (auto e : spotView) {
+			auto& light = spotView.get<SpotLightComponent>(e);
+			auto m = getTransform(e);
+
+			auto& instance = snapshot->mLights[count++];
+			instance.mPosition = DG::float3(m.m30, m.m31, m.m32);
+			instance.mRange = light.mRange;
+			instance.mColor = light.mColor * light.mIntensity;
+			instance.mDirection = DG::normalize(DG::float3(m.m20, m.m21, m.m22));
+			instance.mCosOuterAngle = std::cos(std::min(light.mOuterAngle, DG::PI_F * 0.5f));
+			instance.mCosInnerAngle = std::cos(std::min(light.mInnerAngle, light.mOuterAngle));
+		}
+	}
+
+	void ExtractCamera(Frame* frame, RenderSnapshot* snapshot) {
+		snapshot->bHasCamera = frame->mCamera != entt::null;
+
+		if (snapshot->bHasCamera) {
+			snapshot->mCamera = frame->CameraData();
+
+			auto cameraTransform = frame->TryGet<RendererTransformCache>(frame->mCamera);
+			snapshot->bHasCameraTransform = cameraTransform != nullptr;
+			if (cameraTransform)
+				snapshot->mCameraTransform = cameraTransform->mCache;
+		}
+	}
+
+	void ExtractSkybox(Frame* frame, RenderSnapshot* snapshot) {
+		auto skyboxes = frame->mRegistry.view<SkyboxComponent>();
+
+		auto ent = skyboxes.front();
+		if (ent != entt::null) {
+			snapshot->mSkybox = skyboxes.get<SkyboxComponent>(ent).mCubemap;
+
+			auto lightProbe = frame->TryGet<LightProbe>(ent);
+			snapshot->bHasLightProbe = lightProbe != nullptr;
+			if (lightProbe)
+				snapshot->mLightProbe = *lightProbe;
+		}
+	}
+
+	void ExtractRenderSnapshot(Frame* frame, RenderSnapshot* snapshot, ITaskQueue* queue) {
+		ExtractCamera(frame, snapshot);
+		ExtractSkybox(frame, snapshot);
+		ExtractStaticMeshes(frame, snapshot, queue);
+		ExtractOccluders(frame, snapshot);
+		ExtractLights(frame, snapshot);
+	}
+
+	void ExtractRenderSnapshot(Frame* frame, RenderSnapshot* snapshot,
+		const SpatialIndex& index, float aspectRatio, bool bIsGL, ITaskQueue* queue) {
+		ExtractCamera(frame, snapshot);
+		ExtractSkybox(frame, snapshot);
+
+		if (snapshot->bHasCamera) {
+			auto frustum = Frustum::FromCamera(snapshot->mCamera,
+				snapshot->bHasCameraTransform ? &snapshot->mCameraTransform : nullptr,
+				snapshot->mCamera.GetProjection(aspectRatio, bIsGL),
+				bIsGL);
+			ExtractStaticMeshes(frame, snapshot, index, frustum, queue);
+		} else {
+			ExtractStaticMeshes(frame, snapshot, queue);
+		}
+
+		ExtractOccluders(frame, snapshot);
+		ExtractLights(frame, snapshot);
+	}
+}
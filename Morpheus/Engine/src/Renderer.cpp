@@ -2,6 +2,47 @@
 #include <Engine/Renderer.hpp>
 
 namespace Morpheus {
+	bool MaterialDesc::operator==(const MaterialDesc& other) const {
+		return mType == other.mType &&
+			mAlbedo.Ptr() == other.mAlbedo.Ptr() &&
+			mNormal.Ptr() == other.mNormal.Ptr() &&
+			mRoughness.Ptr() == other.mRoughness.Ptr() &&
+			mMetallic.Ptr() == other.mMetallic.Ptr() &&
+			mDisplacement.Ptr() == other.mDisplacement.Ptr() &&
+			mAlbedoFactor == other.mAlbedoFactor &&
+			mRoughnessFactor == other.mRoughnessFactor &&
+			mMetallicFactor == other.mMetallicFactor &&
+			mDisplacementFactor == other.mDisplacementFactor &&
+			mRoughnessChannel == other.mRoughnessChannel &&
+			mMetallicChannel == other.mMetallicChannel;
+	}
+
+	std::size_t MaterialDesc::Hasher::operator()(const MaterialDesc& desc) const {
+		std::size_t h = std::hash<int>()(static_cast<int>(desc.mType));
+
+		auto combine = [&h](std::size_t value) {
+			h ^= value + 0x9e3779b9 + (h << 6) + (h >> 2);
+		};
+
+		combine(std::hash<Texture*>()(desc.mAlbedo.Ptr()));
+		combine(std::hash<Texture*>()(desc.mNormal.Ptr()));
+		combine(std::hash<Texture*>()(desc.mRoughness.Ptr()));
+		combine(std::hash<Texture*>()(desc.mMetallic.Ptr()));
+		combine(std::hash<Texture*>()(desc.mDisplacement.Ptr()));
+
+		combine(std::hash<float>()(desc.mAlbedoFactor.x));
+		combine(std::hash<float>()(desc.mAlbedoFactor.y));
+		combine(std::hash<float>()(desc.mAlbedoFactor.z));
+		combine(std::hash<float>()(desc.mAlbedoFactor.w));
+		combine(std::hash<float>()(desc.mRoughnessFactor));
+		combine(std::hash<float>()(desc.mMetallicFactor));
+		combine(std::hash<float>()(desc.mDisplacementFactor));
+		combine(std::hash<uint>()(desc.mRoughnessChannel));
+		combine(std::hash<uint>()(desc.mMetallicChannel));
+
+		return h;
+	}
+
 	MaterialDesc MaterialDescFuture::Get() const {
 		MaterialDesc desc;
 
@@ -22,16 +63,19 @@ namespace Morpheus {
 		desc.mRoughnessFactor = mRoughnessFactor;
 		desc.mMetallicFactor = mMetallicFactor;
 		desc.mDisplacementFactor = mDisplacementFactor;
+		desc.mRoughnessChannel = mRoughnessChannel;
+		desc.mMetallicChannel = mMetallicChannel;
 
 		return desc;
 	}
 
 	bool MaterialDescFuture::IsAvailable() const {
-		return mAlbedo.IsAvailable() &&
-			mNormal.IsAvailable() &&
-			mRoughness.IsAvailable() &&
-			mMetallic.IsAvailable() &&
-			mDisplacement.IsAvailable();
+		// Unset textures count as available
+		return (!mAlbedo || mAlbedo.IsAvailable()) &&
+			(!mNormal || mNormal.IsAvailable()) &&
+			(!mRoughness || mRoughness.IsAvailable()) &&
+			(!mMetallic || mMetallic.IsAvailable()) &&
+			(!mDisplacement || mDisplacement.IsAvailable());
 	}
 
 	void MaterialDescFuture::Connect(TaskNodeInLock& lock) {
@@ -1,71 +1,638 @@
 #include <Engine/RendererTransformCache.hpp>
 
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MORPHEUS_TRANSFORM_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace Morpheus {
-	void TransformCacheUpdater::UpdateDescendants(entt::entity node, const DG::float4x4& matrix) {
-		for (auto child = mFrame->GetFirstChild(node); child != entt::null; child = mFrame->GetNext(child)) {
-			auto transform = mFrame->mRegistry.try_get<Transform>(child);
-			if (transform) {
-				auto result = mFrame->mRegistry.emplace_or_replace<RendererTransformCache>(child, *transform, matrix);
-				UpdateDescendants(child, result.mCache);
+	void MultiplyTransforms(const DG::float4x4& a, const DG::float4x4& b, DG::float4x4* out) {
+#ifdef MORPHEUS_TRANSFORM_SSE
+		const float* pa = &a.m00;
+		const float* pb = &b.m00;
+		float* po = &out->m00;
+
+		__m128 b0 = _mm_loadu_ps(pb);
+		__m128 b1 = _mm_loadu_ps(pb + 4);
+		__m128 b2 = _mm_loadu_ps(pb + 8);
+		__m128 b3 = _mm_loadu_ps(pb + 12);
+
+		// Row i of the result is a[i][0] * b0 + a[i][1] * b1 + a[i][2] * b2 + a[i][3] * b3
+		__m128 rows[4];
+		for (int i = 0; i < 4; ++i) {
+			const float* row = pa + 4 * i;
+			__m128 r = _mm_mul_ps(_mm_set1_ps(row[0]), b0);
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[1]), b1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[2]), b2));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[3]), b3));
+			rows[i] = r;
+		}
+
+		for (int i = 0; i < 4; ++i) {
+			_mm_storeu_ps(po + 4 * i, rows[i]);
+		}
+#else
+		*out = a * b;
+#endif
+	}
+
+	void FlatTransformHierarchy::Clear() {
+		mEntities.clear();
+		mParents.clear();
+		mChildBegin.clear();
+		mChildCount.clear();
+		mLevelOffsets.clear();
+		mLocal.clear();
+		mWorld.clear();
+		mDirty.clear();
+		mIndices.clear();
+	}
+
+	TransformCacheUpdater::~TransformCacheUpdater() {
+		Disconnect();
+	}
+
+	void TransformCacheUpdater::Connect() {
+		auto& registry = mFrame->mRegistry;
+
+		mFrame->OnDestroy().connect<&TransformCacheUpdater::OnFrameDestroyed>(*this);
+
+		registry.on_construct<Transform>().connect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+		registry.on_destroy<Transform>().connect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+		registry.on_construct<HierarchyData>().connect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+		registry.on_update<HierarchyData>().connect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+		registry.on_destroy<HierarchyData>().connect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+
+		mTransformUpdateObs.connect(registry, entt::collector.update<Transform>());
+	}
+
+	void TransformCacheUpdater::Disconnect() {
+		// A destroyed frame resets mFrame while its registry is still intact
+		if (mFrame) {
+			auto& registry = mFrame->mRegistry;
+
+			mFrame->OnDestroy().disconnect<&TransformCacheUpdater::OnFrameDestroyed>(*this);
+			registry.on_construct<Transform>().disconnect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+			registry.on_destroy<Transform>().disconnect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+			registry.on_construct<HierarchyData>().disconnect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+			registry.on_update<HierarchyData>().disconnect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+			registry.on_destroy<HierarchyData>().disconnect<&TransformCacheUpdater::OnHierarchyChanged>(*this);
+		}
+
+		mTransformUpdateObs.disconnect();
+	}
+
+	void TransformCacheUpdater::SetFrame(Frame* frame) {
+		Disconnect();
+
+		mFrame = frame;
+		mHierarchy.Clear();
+		mPending.clear();
+		mMoved.clear();
+		mRemovedRoots.clear();
+		bHierarchyDirty = true;
+
+		if (mFrame)
+			Connect();
+	}
+
+	void TransformCacheUpdater::OnFrameDestroyed(Frame& frame) {
+		SetFrame(nullptr);
+	}
+
+	void TransformCacheUpdater::OnHierarchyChanged(entt::registry& registry, entt::entity e) {
+		// Everything is rebuilt anyway
+		if (bHierarchyDirty)
+			return;
+
+		mMoved.push_back(e);
+
+		// The flat hierarchy still has the layout of the last update, so find
+		// the nodes that e takes with it now, while its children are still
+		// attached. A destroyed entity has lost its children by this point.
+		auto& indices = mHierarchy.mIndices;
+		auto it = indices.find(e);
+		if (it != indices.end()) {
+			mRemovedRoots.push_back(it->second);
+			return;
+		}
+
+		std::vector<entt::entity> stack;
+		stack.push_back(e);
+		while (!stack.empty()) {
+			auto node = stack.back();
+			stack.pop_back();
+
+			auto data = registry.try_get<HierarchyData>(node);
+			if (!data)
+				continue;
+
+			for (auto child = data->mFirstChild; child != entt::null; child = registry.get<HierarchyData>(child).mNext) {
+				it = indices.find(child);
+				if (it != indices.end())
+					mRemovedRoots.push_back(it->second);
+				else
+					stack.push_back(child);
+			}
+		}
+	}
+
+	void TransformCacheUpdater::Rebuild() {
+		auto& registry = mFrame->mRegistry;
+
+		struct Visit {
+			entt::entity mEntity;
+			int32_t mParent;
+		};
+
+		// Gather every node with a Transform together with the closest ancestor
+		// that also has one. Children are always visited after their parents.
+		std::vector<entt::entity> entities;
+		std::vector<int32_t> parents;
+		std::vector<uint32_t> levels;
+		std::vector<Visit> stack;
+		stack.push_back({mFrame->mRoot, -1});
+
+		uint32_t levelCount = 0;
+		while (!stack.empty()) {
+			auto visit = stack.back();
+			stack.pop_back();
+
+			int32_t childParent = visit.mParent;
+			if (registry.has<Transform>(visit.mEntity)) {
+				uint32_t level = visit.mParent < 0 ? 0 : levels[visit.mParent] + 1;
+				childParent = (int32_t)entities.size();
+				entities.push_back(visit.mEntity);
+				parents.push_back(visit.mParent);
+				levels.push_back(level);
+				levelCount = std::max(levelCount, level + 1);
+			}
+
+			for (auto child = mFrame->GetFirstChild(visit.mEntity); child != entt::null; child = mFrame->GetNext(child)) {
+				stack.push_back({child, childParent});
+			}
+		}
+
+		// Counting sort by level
+		mHierarchy.mLevelOffsets.assign(levelCount + 1, 0);
+		for (auto level : levels) {
+			mHierarchy.mLevelOffsets[level + 1]++;
+		}
+		for (uint32_t i = 0; i < levelCount; ++i) {
+			mHierarchy.mLevelOffsets[i + 1] += mHierarchy.mLevelOffsets[i];
+		}
+
+		size_t count = entities.size();
+		std::vector<uint32_t> remap(count);
+		std::vector<uint32_t> cursor(mHierarchy.mLevelOffsets.begin(), mHierarchy.mLevelOffsets.end() - 1);
+		for (size_t i = 0; i < count; ++i) {
+			remap[i] = cursor[levels[i]]++;
+		}
+
+		mHierarchy.mEntities.resize(count);
+		mHierarchy.mParents.resize(count);
+		mHierarchy.mChildBegin.resize(count);
+		mHierarchy.mChildCount.assign(count, 0);
+		mHierarchy.mLocal.resize(count);
+		mHierarchy.mWorld.resize(count);
+		mHierarchy.mDirty.assign(count, 0);
+		mHierarchy.mIndices.clear();
+		mHierarchy.mIndices.reserve(count);
+
+		for (size_t i = 0; i < count; ++i) {
+			uint32_t idx = remap[i];
+			mHierarchy.mEntities[idx] = entities[i];
+			mHierarchy.mParents[idx] = parents[i] < 0 ? -1 : (int32_t)remap[parents[i]];
+			mHierarchy.mIndices[entities[i]] = idx;
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			if (mHierarchy.mParents[i] >= 0)
+				mHierarchy.mChildCount[mHierarchy.mParents[i]]++;
+		}
+
+		// Levels are in depth first order, so children are grouped by parent
+		// in the same order as the parents themselves
+		for (uint32_t level = 0; level < levelCount; ++level) {
+			uint32_t cursor = mHierarchy.mLevelOffsets[level + 1];
+			for (uint32_t i = mHierarchy.mLevelOffsets[level]; i < mHierarchy.mLevelOffsets[level + 1]; ++i) {
+				mHierarchy.mChildBegin[i] = cursor;
+				cursor += mHierarchy.mChildCount[i];
+			}
+		}
+
+		mPending.clear();
+		mMoved.clear();
+		mRemovedRoots.clear();
+		bHierarchyDirty = false;
+	}
+
+	bool TransformCacheUpdater::ApplyStructuralChanges() {
+		auto& registry = mFrame->mRegistry;
+		auto& old = mHierarchy;
+		size_t oldCount = old.Size();
+
+		// Take the old subtrees of everything that changed out of the hierarchy
+		std::vector<uint8_t> removed(oldCount, 0);
+		std::vector<NodeRange> stack;
+		for (auto root : mRemovedRoots) {
+			stack.push_back({root, root + 1});
+			while (!stack.empty()) {
+				auto range = stack.back();
+				stack.pop_back();
+
+				for (uint32_t i = range.mBegin; i < range.mEnd; ++i) {
+					if (removed[i])
+						continue;
+					removed[i] = 1;
+					mStats.mNodesRemoved++;
+					if (old.mChildCount[i] > 0)
+						stack.push_back({old.mChildBegin[i], old.mChildBegin[i] + old.mChildCount[i]});
+				}
+			}
+		}
+
+		std::sort(mMoved.begin(), mMoved.end());
+		mMoved.erase(std::unique(mMoved.begin(), mMoved.end()), mMoved.end());
+
+		// Put back the current subtree of every changed entity that is still in
+		// the frame, unless it moved together with one of its ancestors
+		struct Inserted {
+			entt::entity mEntity;
+			int32_t mOldIndex;
+		};
+		std::unordered_map<entt::entity, std::vector<Inserted>> inserted;
+		std::vector<uint8_t> hasInserted(oldCount, 0);
+
+		struct Visit {
+			entt::entity mEntity;
+			entt::entity mParent;
+		};
+		std::vector<Visit> visits;
+
+		for (auto e : mMoved) {
+			if (!registry.valid(e) || !registry.has<HierarchyData>(e))
+				continue;
+
+			entt::entity parent = entt::null;
+			entt::entity top = e;
+			bool bCovered = false;
+			for (auto ancestor = mFrame->GetParent(e); ancestor != entt::null; ancestor = mFrame->GetParent(ancestor)) {
+				if (parent == entt::null && registry.has<Transform>(ancestor))
+					parent = ancestor;
+				if (std::binary_search(mMoved.begin(), mMoved.end(), ancestor))
+					bCovered = true;
+				top = ancestor;
+			}
+
+			// Detached from the frame, or inserted with an ancestor
+			if (top != mFrame->mRoot || bCovered)
+				continue;
+
+			// Nodes are only inserted below nodes that stay where they are
+			if (parent != entt::null) {
+				auto it = old.mIndices.find(parent);
+				if (it == old.mIndices.end() || removed[it->second])
+					return false;
+				hasInserted[it->second] = 1;
+			}
+
+			visits.push_back({e, parent});
+			while (!visits.empty()) {
+				auto visit = visits.back();
+				visits.pop_back();
+
+				entt::entity childParent = visit.mParent;
+				if (registry.has<Transform>(visit.mEntity)) {
+					int32_t oldIdx = -1;
+					auto it = old.mIndices.find(visit.mEntity);
+					if (it != old.mIndices.end()) {
+						if (!removed[it->second])
+							return false;
+						oldIdx = (int32_t)it->second;
+					}
+
+					inserted[visit.mParent].push_back({visit.mEntity, oldIdx});
+					mStats.mNodesInserted++;
+					childParent = visit.mEntity;
+				}
+
+				for (auto child = mFrame->GetFirstChild(visit.mEntity); child != entt::null; child = mFrame->GetNext(child)) {
+					visits.push_back({child, childParent});
+				}
+			}
+		}
+
+		// Lay the hierarchy out again level by level. The kept children of a
+		// node come first, followed by the ones inserted below it, so the
+		// children of every node stay contiguous and in the order of their parents.
+		FlatTransformHierarchy h;
+		h.mIndices = std::move(old.mIndices);
+		for (uint32_t i = 0; i < oldCount; ++i) {
+			if (removed[i])
+				h.mIndices.erase(old.mEntities[i]);
+		}
+
+		size_t capacity = oldCount + mStats.mNodesInserted - mStats.mNodesRemoved;
+		h.mEntities.reserve(capacity);
+		h.mParents.reserve(capacity);
+		h.mChildBegin.reserve(capacity);
+		h.mChildCount.reserve(capacity);
+		h.mLocal.reserve(capacity);
+		h.mWorld.reserve(capacity);
+		h.mDirty.reserve(capacity);
+
+		// Old index of every kept node, or -1 for inserted ones
+		std::vector<int32_t> source;
+		source.reserve(capacity);
+		mPending.clear();
+
+		// kept is the old index of a node that stays where it is, transforms
+		// the old index of the node to take the transforms from
+		auto emit = [&](entt::entity e, int32_t parent, int32_t kept, int32_t transforms) {
+			uint32_t idx = (uint32_t)h.mEntities.size();
+			h.mEntities.push_back(e);
+			h.mParents.push_back(parent);
+			h.mChildBegin.push_back(0);
+			h.mChildCount.push_back(0);
+			source.push_back(kept);
+
+			// Dirty nodes read their local transform once the layout is done
+			if (transforms >= 0) {
+				h.mLocal.push_back(old.mLocal[transforms]);
+				h.mWorld.push_back(old.mWorld[transforms]);
+				h.mDirty.push_back(old.mDirty[transforms]);
 			} else {
-				UpdateDescendants(child, matrix);
+				h.mLocal.push_back(DG::float4x4::Identity());
+				h.mWorld.push_back(DG::float4x4::Identity());
+				h.mDirty.push_back(1);
 			}
+
+			if (h.mDirty[idx])
+				mPending.push_back(idx);
+			if (kept != (int32_t)idx)
+				h.mIndices[e] = idx;
+		};
+
+		auto emitInserted = [&](entt::entity parentEntity, int32_t parent) {
+			auto it = inserted.find(parentEntity);
+			if (it == inserted.end())
+				return;
+
+			for (auto& node : it->second) {
+				// A node carried along below the same parent keeps its transforms.
+				// The changed entities themselves may have a new Transform.
+				int32_t transforms = -1;
+				if (node.mOldIndex >= 0 && !std::binary_search(mMoved.begin(), mMoved.end(), node.mEntity)) {
+					int32_t oldParent = old.mParents[node.mOldIndex];
+					if (oldParent < 0 ? parentEntity == entt::null : old.mEntities[oldParent] == parentEntity)
+						transforms = node.mOldIndex;
+				}
+				emit(node.mEntity, parent, -1, transforms);
+			}
+		};
+
+		uint32_t oldTop = old.LevelCount() > 0 ? old.mLevelOffsets[1] : 0;
+		for (uint32_t i = 0; i < oldTop; ++i) {
+			if (!removed[i])
+				emit(old.mEntities[i], -1, (int32_t)i, (int32_t)i);
 		}
+		emitInserted(entt::null, -1);
+
+		h.mLevelOffsets.push_back(0);
+		uint32_t levelBegin = 0;
+		uint32_t levelEnd = (uint32_t)h.Size();
+		while (levelBegin < levelEnd) {
+			h.mLevelOffsets.push_back(levelEnd);
+
+			for (uint32_t j = levelBegin; j < levelEnd; ++j) {
+				h.mChildBegin[j] = (uint32_t)h.Size();
+
+				int32_t o = source[j];
+				if (o >= 0) {
+					for (uint32_t c = old.mChildBegin[o]; c < old.mChildBegin[o] + old.mChildCount[o]; ++c) {
+						if (!removed[c])
+							emit(old.mEntities[c], (int32_t)j, (int32_t)c, (int32_t)c);
+					}
+				}
+
+				if (o < 0 || hasInserted[o])
+					emitInserted(h.mEntities[j], (int32_t)j);
+
+				h.mChildCount[j] = (uint32_t)h.Size() - h.mChildBegin[j];
+			}
+
+			levelBegin = levelEnd;
+			levelEnd = (uint32_t)h.Size();
+		}
+
+		mHierarchy = std::move(h);
+		mMoved.clear();
+		mRemovedRoots.clear();
+		return true;
 	}
 
-	entt::entity TransformCacheUpdater::FindTransformParent(entt::entity node) {
-		auto result = mFrame->GetParent(node);
-		for (; result != entt::null; result = mFrame->GetParent(result)) {
-			if (mFrame->mRegistry.has<Transform>(result)) {
-				return result;
+	void TransformCacheUpdater::CoalesceDirty() {
+		auto& h = mHierarchy;
+
+		// Only changed nodes without a changed ancestor start a subtree update,
+		// everything below them is recomputed as part of that subtree
+		mRoots.clear();
+		for (auto idx : mPending) {
+			bool bCovered = false;
+			for (int32_t parent = h.mParents[idx]; parent >= 0; parent = h.mParents[parent]) {
+				if (h.mDirty[parent]) {
+					bCovered = true;
+					break;
+				}
+			}
+
+			if (!bCovered)
+				mRoots.push_back(idx);
+		}
+
+		std::sort(mRoots.begin(), mRoots.end());
+		mStats.mDirtyRoots = mRoots.size();
+	}
+
+	void TransformCacheUpdater::Propagate(ITaskQueue* queue) {
+		auto& h = mHierarchy;
+
+		mFrontier.clear();
+		mUpdatedRanges.clear();
+
+		std::vector<size_t> rangeOffsets;
+		size_t nextRoot = 0;
+		size_t level = 0;
+
+		while (level < h.LevelCount() && (!mFrontier.empty() || nextRoot < mRoots.size())) {
+			// Skip ahead to the next level with a dirty root
+			if (mFrontier.empty()) {
+				level = std::upper_bound(h.mLevelOffsets.begin(), h.mLevelOffsets.end(),
+					mRoots[nextRoot]) - h.mLevelOffsets.begin() - 1;
+			}
+
+			for (; nextRoot < mRoots.size() && mRoots[nextRoot] < h.mLevelOffsets[level + 1]; ++nextRoot) {
+				uint32_t root = mRoots[nextRoot];
+				if (!mFrontier.empty() && mFrontier.back().mEnd == root)
+					mFrontier.back().mEnd++;
+				else
+					mFrontier.push_back({root, root + 1});
 			}
+
+			rangeOffsets.resize(mFrontier.size() + 1);
+			rangeOffsets[0] = 0;
+			for (size_t i = 0; i < mFrontier.size(); ++i)
+				rangeOffsets[i + 1] = rangeOffsets[i] + (mFrontier[i].mEnd - mFrontier[i].mBegin);
+
+			size_t levelCount = rangeOffsets.back();
+			auto& frontier = mFrontier;
+
+			ParallelFor(queue, levelCount, TRANSFORM_PARALLEL_CHUNK_SIZE,
+				[&h, &frontier, &rangeOffsets](size_t begin, size_t end) {
+				size_t range = std::upper_bound(rangeOffsets.begin(), rangeOffsets.end(), begin)
+					- rangeOffsets.begin() - 1;
+
+				for (size_t k = begin; k < end; ++k) {
+					while (k >= rangeOffsets[range + 1])
+						++range;
+
+					size_t i = frontier[range].mBegin + (k - rangeOffsets[range]);
+					int32_t parent = h.mParents[i];
+
+					if (parent < 0)
+						h.mWorld[i] = h.mLocal[i];
+					else
+						MultiplyTransforms(h.mLocal[i], h.mWorld[parent], &h.mWorld[i]);
+				}
+			});
+
+			mStats.mNodesRecomputed += levelCount;
+			mStats.mLevelsVisited++;
+
+			// The children of the updated ranges make up the next level
+			mNextFrontier.clear();
+			for (auto& range : mFrontier) {
+				uint32_t last = range.mEnd - 1;
+				NodeRange children = { h.mChildBegin[range.mBegin], h.mChildBegin[last] + h.mChildCount[last] };
+
+				if (children.mBegin == children.mEnd)
+					continue;
+
+				if (!mNextFrontier.empty() && mNextFrontier.back().mEnd == children.mBegin)
+					mNextFrontier.back().mEnd = children.mEnd;
+				else
+					mNextFrontier.push_back(children);
+			}
+
+			mUpdatedRanges.insert(mUpdatedRanges.end(), mFrontier.begin(), mFrontier.end());
+			std::swap(mFrontier, mNextFrontier);
+			++level;
 		}
-		return entt::null;
 	}
 
-	void TransformCacheUpdater::UpdateAll() {
-		auto transform = mFrame->mRegistry.try_get<Transform>(mFrame->mRoot);
-		if (transform) {
-			auto cache = mFrame->mRegistry.emplace_or_replace<RendererTransformCache>(mFrame->mRoot, *transform);
-			UpdateDescendants(mFrame->mRoot, cache.mCache);
-		} else {
-			DG::float4x4 id(DG::float4x4::Identity());
-			UpdateDescendants(mFrame->mRoot, id);
+	void TransformCacheUpdater::WriteBack() {
+		auto& registry = mFrame->mRegistry;
+		auto& h = mHierarchy;
+
+		// Registry writes fire signals, so they stay on this thread
+		for (auto& range : mUpdatedRanges) {
+			for (uint32_t i = range.mBegin; i < range.mEnd; ++i) {
+				registry.emplace_or_replace<RendererTransformCache>(h.mEntities[i], h.mWorld[i]);
+				h.mDirty[i] = 0;
+			}
 		}
 
+		mPending.clear();
 		mTransformUpdateObs.clear();
-		mNewTransformObs.clear();
 	}
 
-	void TransformCacheUpdater::Update(entt::entity node) {
-		auto parent = FindTransformParent(node);
+	void TransformCacheUpdater::UpdateAll(ITaskQueue* queue) {
+		mStats = TransformUpdateStats();
+		mStats.bRebuiltHierarchy = true;
+
+		Rebuild();
 
-		if (parent == entt::null) {
-			auto& transform = mFrame->mRegistry.get<Transform>(node);
-			auto cache = mFrame->mRegistry.emplace_or_replace<RendererTransformCache>(node, transform);
-			UpdateDescendants(node, cache.mCache);
-		} else {
-			auto parentCache = mFrame->mRegistry.try_get<RendererTransformCache>(parent);
+		auto transforms = mFrame->mRegistry.view<Transform>();
+		auto& h = mHierarchy;
 
-			// If parent doesn't have transform cache, it will get caught eventually and descendents will be updated
-			if (parentCache) {
-				auto& transform = mFrame->mRegistry.get<Transform>(node);
-				auto cache = mFrame->mRegistry.emplace_or_replace<RendererTransformCache>(node, transform, parentCache->mCache);
-				UpdateDescendants(node, cache.mCache);
+		ParallelFor(queue, h.Size(), TRANSFORM_PARALLEL_CHUNK_SIZE, [&h, &transforms](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				h.mLocal[i] = transforms.get<Transform>(h.mEntities[i]).ToMatrix();
 			}
+		});
+
+		// Every top level node is a dirty root
+		mRoots.clear();
+		if (h.LevelCount() > 0) {
+			for (uint32_t i = 0; i < h.mLevelOffsets[1]; ++i)
+				mRoots.push_back(i);
 		}
+		mStats.mDirtyRoots = mRoots.size();
+
+		Propagate(queue);
+		WriteBack();
 	}
 
-	void TransformCacheUpdater::UpdateChanges() {
+	void TransformCacheUpdater::Update(entt::entity node) {
+		if (bHierarchyDirty)
+			return;
+
+		auto it = mHierarchy.mIndices.find(node);
+		if (it == mHierarchy.mIndices.end())
+			return;
+
+		if (!mHierarchy.mDirty[it->second]) {
+			mHierarchy.mDirty[it->second] = 1;
+			mPending.push_back(it->second);
+		}
+	}
+
+	void TransformCacheUpdater::UpdateChanges(ITaskQueue* queue) {
+		if (bHierarchyDirty) {
+			UpdateAll(queue);
+			return;
+		}
+
+		mStats = TransformUpdateStats();
+
+		// Structural changes only touch the subtrees that moved
+		if ((!mMoved.empty() || !mRemovedRoots.empty()) && !ApplyStructuralChanges()) {
+			UpdateAll(queue);
+			return;
+		}
+
+		auto transforms = mFrame->mRegistry.view<Transform>();
+		auto& h = mHierarchy;
+
 		for (auto e : mTransformUpdateObs) {
-			Update(e);
+			auto it = h.mIndices.find(e);
+			if (it != h.mIndices.end() && !h.mDirty[it->second]) {
+				h.mDirty[it->second] = 1;
+				mPending.push_back(it->second);
+			}
 		}
 
-		for (auto e : mNewTransformObs) {
-			Update(e);
+		if (mPending.empty()) {
+			mTransformUpdateObs.clear();
+			return;
 		}
 
-		mTransformUpdateObs.clear();
-		mNewTransformObs.clear();
+		// Local transforms are read here, so a node that changes again after it
+		// was marked still picks up its latest Transform
+		auto& pending = mPending;
+		ParallelFor(queue, mPending.size(), TRANSFORM_PARALLEL_CHUNK_SIZE,
+			[&h, &transforms, &pending](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				uint32_t idx = pending[i];
+				h.mLocal[idx] = transforms.get<Transform>(h.mEntities[idx]).ToMatrix();
+			}
+		});
+
+		CoalesceDirty();
+		Propagate(queue);
+		WriteBack();
 	}
-}
\ No newline at end of file
+}
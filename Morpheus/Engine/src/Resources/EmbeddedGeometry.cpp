@@ -1,132 +1,195 @@
-#include <Engine/Resources/Geometry.hpp>
+#include <Engine/Resources/PackedGeometry.hpp>
 
-namespace matball {
-	#include <embed/matballmesh.hpp>
-}
-
-namespace box {
-	#include <embed/boxmesh.hpp>
-}
+#include <mutex>
+#include <unordered_map>
 
-namespace bunny {
-	#include <embed/bunnymesh.hpp>
-}
+// Packed geometry archives linked into the engine by embed_binary_files in CMakeLists.txt
+#define DECLARE_EMBEDDED_GEOMETRY(name) \
+	extern "C" const uint8_t g_##name##_data[]; \
+	extern "C" const uint64_t g_##name##_size;
 
-namespace monkey {
-	#include <embed/monkeymesh.hpp>
-}
+DECLARE_EMBEDDED_GEOMETRY(matball)
+DECLARE_EMBEDDED_GEOMETRY(box)
+DECLARE_EMBEDDED_GEOMETRY(bunny)
+DECLARE_EMBEDDED_GEOMETRY(monkey)
+DECLARE_EMBEDDED_GEOMETRY(plane)
+DECLARE_EMBEDDED_GEOMETRY(sphere)
+DECLARE_EMBEDDED_GEOMETRY(torus)
+DECLARE_EMBEDDED_GEOMETRY(teapot)
 
-namespace plane {
-	#include <embed/planemesh.hpp>
-}
+namespace Morpheus {
 
-namespace sphere {
-	#include <embed/spheremesh.hpp>
-}
+	struct PrefabKey {
+		Geometry::Prefab mPrefab;
+		VertexLayout mLayout;
+
+		bool operator==(const PrefabKey& other) const {
+			if (mPrefab != other.mPrefab ||
+				mLayout.mPosition != other.mLayout.mPosition ||
+				mLayout.mUV != other.mLayout.mUV ||
+				mLayout.mNormal != other.mLayout.mNormal ||
+				mLayout.mTangent != other.mLayout.mTangent ||
+				mLayout.mBitangent != other.mLayout.mBitangent ||
+				mLayout.mElements.size() != other.mLayout.mElements.size())
+				return false;
+
+			for (size_t i = 0; i < mLayout.mElements.size(); ++i) {
+				auto& a = mLayout.mElements[i];
+				auto& b = other.mLayout.mElements[i];
+
+				if (a.InputIndex != b.InputIndex ||
+					a.BufferSlot != b.BufferSlot ||
+					a.NumComponents != b.NumComponents ||
+					a.ValueType != b.ValueType ||
+					a.IsNormalized != b.IsNormalized ||
+					a.RelativeOffset != b.RelativeOffset ||
+					a.Stride != b.Stride ||
+					a.Frequency != b.Frequency ||
+					a.InstanceDataStepRate != b.InstanceDataStepRate)
+					return false;
+			}
+
+			return true;
+		}
+
+		struct Hasher {
+			inline std::size_t operator()(const PrefabKey& k) const {
+				std::size_t h = std::hash<int>()(static_cast<int>(k.mPrefab));
+
+				auto combine = [&h](std::size_t value) {
+					h ^= value + 0x9e3779b9 + (h << 6) + (h >> 2);
+				};
+
+				for (auto& element : k.mLayout.mElements) {
+					combine(element.InputIndex);
+					combine(element.BufferSlot);
+					combine(element.NumComponents);
+					combine(element.ValueType);
+					combine(element.RelativeOffset);
+					combine(element.Stride);
+				}
+
+				return h;
+			}
+		};
+	};
+
+	struct PrefabEntry {
+		std::once_flag mOnce;
+		Handle<Geometry> mGeometry;
+	};
+
+	std::mutex gPrefabMutex;
+	std::unordered_map<PrefabKey, std::shared_ptr<PrefabEntry>, PrefabKey::Hasher> gPrefabCache;
+
+	void UnpackEmbedded(Geometry::Prefab prefab, const VertexLayout& layout, Geometry* geometry) {
+		const uint8_t* data = nullptr;
+		uint64_t size = 0;
+
+		switch (prefab) {
+			case Geometry::Prefab::MATERIAL_BALL:
+				data = g_matball_data;
+				size = g_matball_size;
+				break;
+			case Geometry::Prefab::BOX:
+				data = g_box_data;
+				size = g_box_size;
+				break;
+			case Geometry::Prefab::SPHERE:
+				data = g_sphere_data;
+				size = g_sphere_size;
+				break;
+			case Geometry::Prefab::BLENDER_MONKEY:
+				data = g_monkey_data;
+				size = g_monkey_size;
+				break;
+			case Geometry::Prefab::TORUS:
+				data = g_torus_data;
+				size = g_torus_size;
+				break;
+			case Geometry::Prefab::PLANE:
+				data = g_plane_data;
+				size = g_plane_size;
+				break;
+			case Geometry::Prefab::STANFORD_BUNNY:
+				data = g_bunny_data;
+				size = g_bunny_size;
+				break;
+			case Geometry::Prefab::UTAH_TEAPOT:
+				data = g_teapot_data;
+				size = g_teapot_size;
+				break;
+			default:
+				throw std::runtime_error("Invalid prefab!");
+		}
+
+		PackedGeometry packed;
+		packed.ReadArchive(data, size);
+		packed.Unpack(layout, geometry);
+	}
 
-namespace torus {
-	#include <embed/torusmesh.hpp>
-}
+	Handle<Geometry> Geometry::Prefabs::Get(Prefab prefab, const VertexLayout& layout) {
+		PrefabKey key{prefab, layout};
+		std::shared_ptr<PrefabEntry> entry;
+
+		{
+			std::lock_guard<std::mutex> lock(gPrefabMutex);
+			auto& slot = gPrefabCache[key];
+			if (!slot)
+				slot = std::make_shared<PrefabEntry>();
+			entry = slot;
+		}
+
+		// Unpack outside of the cache lock so different prefabs can be built concurrently
+		std::call_once(entry->mOnce, [&]() {
+			Geometry* geometry = new Geometry();
+			UnpackEmbedded(prefab, layout, geometry);
+			entry->mGeometry.Adopt(geometry);
+		});
+
+		return entry->mGeometry;
+	}
 
-namespace teapot {
-	#include <embed/teapotmesh.hpp>
-}
+	void Geometry::Prefabs::ClearCache() {
+		std::lock_guard<std::mutex> lock(gPrefabMutex);
+		gPrefabCache.clear();
+	}
 
-namespace Morpheus {
+	Geometry CopyPrefab(Geometry::Prefab prefab, const VertexLayout& layout) {
+		Geometry geometry;
+		geometry.CopyFrom(*Geometry::Prefabs::Get(prefab, layout));
+		return geometry;
+	}
 
 	Geometry Geometry::Prefabs::MaterialBall(const VertexLayout& layout) {
-		return Geometry(layout, 
-			matball::mVertexCount,
-			matball::mIndexCount,
-			matball::mIndices,
-			matball::mPositions,
-			matball::mUVs,
-			matball::mNormals,
-			matball::mTangents,
-			matball::mBitangents);
+		return CopyPrefab(Prefab::MATERIAL_BALL, layout);
 	}
 
 	Geometry Geometry::Prefabs::Box(const VertexLayout& layout) {
-		return Geometry(layout, 
-			box::mVertexCount,
-			box::mIndexCount,
-			box::mIndices,
-			box::mPositions,
-			box::mUVs,
-			box::mNormals,
-			box::mTangents,
-			box::mBitangents);
+		return CopyPrefab(Prefab::BOX, layout);
 	}
 
 	Geometry Geometry::Prefabs::Sphere(const VertexLayout& layout) {
-		return Geometry(layout, 
-			sphere::mVertexCount,
-			sphere::mIndexCount,
-			sphere::mIndices,
-			sphere::mPositions,
-			sphere::mUVs,
-			sphere::mNormals,
-			sphere::mTangents,
-			sphere::mBitangents);
+		return CopyPrefab(Prefab::SPHERE, layout);
 	}
 
 	Geometry Geometry::Prefabs::BlenderMonkey(const VertexLayout& layout) {
-		return Geometry(layout, 
-			monkey::mVertexCount,
-			monkey::mIndexCount,
-			monkey::mIndices,
-			monkey::mPositions,
-			monkey::mUVs,
-			monkey::mNormals,
-			monkey::mTangents,
-			monkey::mBitangents);
+		return CopyPrefab(Prefab::BLENDER_MONKEY, layout);
 	}
 
 	Geometry Geometry::Prefabs::Torus(const VertexLayout& layout) {
-		return Geometry (layout, 
-			torus::mVertexCount,
-			torus::mIndexCount,
-			torus::mIndices,
-			torus::mPositions,
-			torus::mUVs,
-			torus::mNormals,
-			torus::mTangents,
-			torus::mBitangents);
+		return CopyPrefab(Prefab::TORUS, layout);
 	}
 
 	Geometry Geometry::Prefabs::Plane(const VertexLayout& layout) {
-		return Geometry(layout, 
-			plane::mVertexCount,
-			plane::mIndexCount,
-			plane::mIndices,
-			plane::mPositions,
-			plane::mUVs,
-			plane::mNormals,
-			plane::mTangents,
-			plane::mBitangents);
+		return CopyPrefab(Prefab::PLANE, layout);
 	}
 
 	Geometry Geometry::Prefabs::StanfordBunny(const VertexLayout& layout) {
-		return Geometry(layout, 
-			bunny::mVertexCount,
-			bunny::mIndexCount,
-			bunny::mIndices,
-			bunny::mPositions,
-			bunny::mUVs,
-			bunny::mNormals,
-			bunny::mTangents,
-			bunny::mBitangents);
+		return CopyPrefab(Prefab::STANFORD_BUNNY, layout);
 	}
 
 	Geometry Geometry::Prefabs::UtahTeapot(const VertexLayout& layout) {
-		return Geometry(layout, 
-			teapot::mVertexCount,
-			teapot::mIndexCount,
-			teapot::mIndices,
-			teapot::mPositions,
-			teapot::mUVs,
-			teapot::mNormals,
-			teapot::mTangents,
-			teapot::mBitangents);
+		return CopyPrefab(Prefab::UTAH_TEAPOT, layout);
 	}
-}
\ No newline at end of file
+}
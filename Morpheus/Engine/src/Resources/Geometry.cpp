@@ -29,8 +29,21 @@ namespace Morpheus {
 
 		Task task([params, device, promise = std::move(promise), data = Data()](const TaskParams& e) mutable {
 			if (e.mTask->BeginSubTask()) {
-				data.mRaw.Read(params);
+				// Read on the pool so importers can split their work into further tasks
+				auto readTask = e.mQueue->Adopt(data.mRaw.ReadTask(params));
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					lock.Connect(readTask);
+					bWait = lock.ShouldWait();
+				}
+
 				e.mTask->EndSubTask();
+				e.mQueue->Trigger(readTask);
+
+				if (bWait)
+					return TaskResult::WAITING;
 			}
 
 			if (device.mGpuDevice) {
@@ -66,14 +79,32 @@ namespace Morpheus {
 		Promise<T> promise;
 		Future<T> future(promise);
 
-		Task task([params, promise = std::move(promise)](const TaskParams& e) mutable {
-			Geometry* geo = new Geometry();
-			geo->LoadRaw(params);
+		Task task([params, promise = std::move(promise), geo = (Geometry*)nullptr](const TaskParams& e) mutable {
+			if (e.mTask->BeginSubTask()) {
+				geo = new Geometry();
+				auto readTask = e.mQueue->Adopt(geo->ReadTask(params));
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					lock.Connect(readTask);
+					bWait = lock.ShouldWait();
+				}
+
+				e.mTask->EndSubTask();
+				e.mQueue->Trigger(readTask);
+
+				if (bWait)
+					return TaskResult::WAITING;
+			}
+
 			promise.Set(geo, e.mQueue);
 
 			if constexpr (std::is_same_v<T, Handle<Geometry>>) {
 				geo->Release();
 			}
+
+			return TaskResult::FINISHED;
 		}, 
 		std::string("Load ") + params.mSource, 
 		TaskType::FILE_IO);
@@ -86,35 +117,35 @@ namespace Morpheus {
 	}
 
 	Geometry Geometry::Prefabs::MaterialBall(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::MaterialBall(layout));
+		return Geometry(device, Prefabs::Get(Prefab::MATERIAL_BALL, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::Box(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::Box(layout));
+		return Geometry(device, Prefabs::Get(Prefab::BOX, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::Sphere(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::Sphere(layout));
+		return Geometry(device, Prefabs::Get(Prefab::SPHERE, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::BlenderMonkey(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::BlenderMonkey(layout));
+		return Geometry(device, Prefabs::Get(Prefab::BLENDER_MONKEY, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::Torus(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::Torus(layout));
+		return Geometry(device, Prefabs::Get(Prefab::TORUS, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::Plane(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::Plane(layout));
+		return Geometry(device, Prefabs::Get(Prefab::PLANE, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::StanfordBunny(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::StanfordBunny(layout));
+		return Geometry(device, Prefabs::Get(Prefab::STANFORD_BUNNY, layout).Ptr());
 	}
 
 	Geometry Geometry::Prefabs::UtahTeapot(GraphicsDevice device, const VertexLayout& layout) {
-		return Geometry(device, Geometry::Prefabs::UtahTeapot(layout));
+		return Geometry(device, Prefabs::Get(Prefab::UTAH_TEAPOT, layout).Ptr());
 	}
 
 	void Geometry::Set(DG::IBuffer* vertexBuffer, 
@@ -219,7 +250,9 @@ namespace Morpheus {
 		mFlags |= RESOURCE_RAW_ASPECT;
 		
 		mRawAspect.mVertexBufferDescs = std::move(vertexBufferDescs);
-		mRawAspect.mVertexBufferDatas = std::move(vertexBufferDatas);
+		mRawAspect.mVertexBufferDatas = std::make_shared<const std::vector<std::vector<uint8_t>>>(
+			std::move(vertexBufferDatas));
+		mRawAspect.mIndexBufferData = nullptr;
 		mRawAspect.bHasIndexBuffer = false;
 
 		mShared.mLayout = layout;
@@ -239,8 +272,10 @@ namespace Morpheus {
 		
 		mRawAspect.mVertexBufferDescs = std::move(vertexBufferDescs);
 		mRawAspect.mIndexBufferDesc = indexBufferDesc;
-		mRawAspect.mVertexBufferDatas = std::move(vertexBufferDatas);
-		mRawAspect.mIndexBufferData = indexBufferData;
+		mRawAspect.mVertexBufferDatas = std::make_shared<const std::vector<std::vector<uint8_t>>>(
+			std::move(vertexBufferDatas));
+		mRawAspect.mIndexBufferData = std::make_shared<const std::vector<uint8_t>>(
+			std::move(indexBufferData));
 		mRawAspect.bHasIndexBuffer = true;
 
 		mShared.mIndexedAttribs = indexedDrawAttribs;
@@ -264,17 +299,20 @@ namespace Morpheus {
 		if (!(mFlags & RESOURCE_RAW_ASPECT))
 			throw std::runtime_error("Spawn on GPU requires geometry have a raw aspect!");
 
-		if (mRawAspect.mVertexBufferDatas.size() == 0)
+		if (GetChannelCount() == 0)
 			throw std::runtime_error("Spawning on GPU requires at least one channel!");
 
+		auto& vertexData = (*mRawAspect.mVertexBufferDatas)[0];
+
 		DG::BufferData data;
-		data.pData = &mRawAspect.mVertexBufferDatas[0][0];
-		data.DataSize = mRawAspect.mVertexBufferDatas[0].size();
+		data.pData = &vertexData[0];
+		data.DataSize = vertexData.size();
 		device->CreateBuffer(mRawAspect.mVertexBufferDescs[0], &data, vertexBufferOut);
 
 		if (mRawAspect.bHasIndexBuffer) {
-			data.pData = &mRawAspect.mIndexBufferData[0];
-			data.DataSize = mRawAspect.mIndexBufferData.size();
+			auto& indexData = *mRawAspect.mIndexBufferData;
+			data.pData = &indexData[0];
+			data.DataSize = indexData.size();
 			device->CreateBuffer(mRawAspect.mIndexBufferDesc, &data, indexBufferOut);
 		}
 	}
@@ -805,7 +843,15 @@ namespace Morpheus {
 		}
 		auto ext = params.mSource.substr(pos);
 
-		return ReadAssimpRawTask(params);
+		if (ext == ".obj") {
+			return ReadObjTask(params);
+		} else if (ext == ".ply") {
+			return ReadPlyTask(params);
+		} else if (ext == ".gltf" || ext == ".glb") {
+			return ReadGltfTask(params);
+		} else {
+			return ReadAssimpRawTask(params);
+		}
 	}
 
 	void Geometry::Clear() {
@@ -0,0 +1,1099 @@
+#include <Engine/Resources/GeometryImport.hpp>
+
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+
+namespace Morpheus {
+
+	const double gPow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+		1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+		1e21, 1e22
+	};
+
+	inline bool IsDigit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	inline bool IsSpace(char c) {
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	const char* ParseFloat(const char* begin, const char* end, float* out) {
+		const char* p = begin;
+		while (p < end && IsSpace(*p))
+			++p;
+
+		const char* start = p;
+
+		bool bNegative = false;
+		if (p < end && (*p == '-' || *p == '+')) {
+			bNegative = *p == '-';
+			++p;
+		}
+
+		uint64_t mantissa = 0;
+		int exponent = 0;
+		int digits = 0;
+		bool bAnyDigits = false;
+
+		for (; p < end && IsDigit(*p); ++p) {
+			bAnyDigits = true;
+			// Digits beyond what fits into the mantissa only shift the exponent
+			if (digits < 19) {
+				mantissa = mantissa * 10 + (*p - '0');
+				if (mantissa > 0)
+					++digits;
+			} else {
+				++exponent;
+			}
+		}
+
+		if (p < end && *p == '.') {
+			++p;
+			for (; p < end && IsDigit(*p); ++p) {
+				bAnyDigits = true;
+				if (digits < 19) {
+					mantissa = mantissa * 10 + (*p - '0');
+					if (mantissa > 0)
+						++digits;
+					--exponent;
+				}
+			}
+		}
+
+		if (!bAnyDigits) {
+			// Let the C library deal with inf and nan
+			if (p < end && (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N')) {
+				std::string str(start, std::min<size_t>(end - start, 16));
+				char* strEnd = nullptr;
+				float value = std::strtof(str.c_str(), &strEnd);
+				if (strEnd == str.c_str())
+					return nullptr;
+				*out = value;
+				return start + (strEnd - str.c_str());
+			}
+			return nullptr;
+		}
+
+		if (p < end && (*p == 'e' || *p == 'E')) {
+			const char* expStart = p;
+			++p;
+
+			bool bExpNegative = false;
+			if (p < end && (*p == '-' || *p == '+')) {
+				bExpNegative = *p == '-';
+				++p;
+			}
+
+			if (p < end && IsDigit(*p)) {
+				int exp = 0;
+				for (; p < end && IsDigit(*p); ++p) {
+					if (exp < 10000)
+						exp = exp * 10 + (*p - '0');
+				}
+				exponent += bExpNegative ? -exp : exp;
+			} else {
+				// Not an exponent after all
+				p = expStart;
+			}
+		}
+
+		double value = static_cast<double>(mantissa);
+		// Zero stays zero, however large the exponent
+		if (mantissa != 0 && exponent < 0) {
+			if (exponent >= -22)
+				value /= gPow10[-exponent];
+			else
+				value *= std::pow(10.0, exponent);
+		} else if (mantissa != 0 && exponent > 0) {
+			if (exponent <= 22)
+				value *= gPow10[exponent];
+			else
+				value *= std::pow(10.0, exponent);
+		}
+
+		*out = static_cast<float>(bNegative ? -value : value);
+		return p;
+	}
+
+	const char* ParseInt(const char* begin, const char* end, int64_t* out) {
+		const char* p = begin;
+		while (p < end && IsSpace(*p))
+			++p;
+
+		bool bNegative = false;
+		if (p < end && (*p == '-' || *p == '+')) {
+			bNegative = *p == '-';
+			++p;
+		}
+
+		if (p >= end || !IsDigit(*p))
+			return nullptr;
+
+		int64_t value = 0;
+		for (; p < end && IsDigit(*p); ++p)
+			value = value * 10 + (*p - '0');
+
+		*out = bNegative ? -value : value;
+		return p;
+	}
+
+	inline DG::float3 LoadFloat3(const float data[], size_t i) {
+		return DG::float3(data[3 * i], data[3 * i + 1], data[3 * i + 2]);
+	}
+
+	inline void StoreFloat3(float data[], size_t i, const DG::float3& v) {
+		data[3 * i] = v.x;
+		data[3 * i + 1] = v.y;
+		data[3 * i + 2] = v.z;
+	}
+
+	inline float CornerAngle(const DG::float3& a, const DG::float3& b, const DG::float3& c) {
+		DG::float3 e1 = b - a;
+		DG::float3 e2 = c - a;
+		float l1 = DG::length(e1);
+		float l2 = DG::length(e2);
+		if (l1 == 0.0f || l2 == 0.0f)
+			return 0.0f;
+		float cosine = DG::dot(e1, e2) / (l1 * l2);
+		return std::acos(std::min(std::max(cosine, -1.0f), 1.0f));
+	}
+
+	inline DG::float3 AnyOrthogonal(const DG::float3& n) {
+		DG::float3 axis = std::abs(n.x) < 0.9f ?
+			DG::float3(1.0f, 0.0f, 0.0f) : DG::float3(0.0f, 1.0f, 0.0f);
+		return DG::normalize(axis - n * DG::dot(n, axis));
+	}
+
+	void GenerateSmoothNormals(size_t vertexCount,
+		size_t indexCount,
+		const uint32_t indices[],
+		const float positions[],
+		const uint32_t positionIds[],
+		float normalsOut[]) {
+
+		uint32_t idCount = 0;
+		for (size_t i = 0; i < vertexCount; ++i)
+			idCount = std::max(idCount, positionIds[i] + 1);
+
+		std::vector<DG::float3> accum(idCount, DG::float3(0.0f, 0.0f, 0.0f));
+
+		for (size_t i = 0; i + 2 < indexCount; i += 3) {
+			uint32_t v[3] = { indices[i], indices[i + 1], indices[i + 2] };
+			DG::float3 p[3] = {
+				LoadFloat3(positions, v[0]),
+				LoadFloat3(positions, v[1]),
+				LoadFloat3(positions, v[2])
+			};
+
+			DG::float3 n = DG::cross(p[1] - p[0], p[2] - p[0]);
+			float length = DG::length(n);
+			if (length == 0.0f)
+				continue;
+			n = n / length;
+
+			for (int c = 0; c < 3; ++c) {
+				float angle = CornerAngle(p[c], p[(c + 1) % 3], p[(c + 2) % 3]);
+				accum[positionIds[v[c]]] += n * angle;
+			}
+		}
+
+		for (size_t i = 0; i < vertexCount; ++i) {
+			DG::float3 n = accum[positionIds[i]];
+			float length = DG::length(n);
+			StoreFloat3(normalsOut, i, length > 0.0f ?
+				n / length : DG::float3(0.0f, 1.0f, 0.0f));
+		}
+	}
+
+	void GenerateTangents(size_t vertexCount,
+		size_t indexCount,
+		const uint32_t indices[],
+		const float positions[],
+		const float normals[],
+		const float uvs[],
+		float tangentsOut[],
+		float bitangentsOut[]) {
+
+		std::vector<DG::float3> tangents(vertexCount, DG::float3(0.0f, 0.0f, 0.0f));
+		std::vector<DG::float3> bitangents(vertexCount, DG::float3(0.0f, 0.0f, 0.0f));
+
+		if (uvs) {
+			for (size_t i = 0; i + 2 < indexCount; i += 3) {
+				uint32_t v[3] = { indices[i], indices[i + 1], indices[i + 2] };
+				DG::float3 p[3] = {
+					LoadFloat3(positions, v[0]),
+					LoadFloat3(positions, v[1]),
+					LoadFloat3(positions, v[2])
+				};
+
+				DG::float3 e1 = p[1] - p[0];
+				DG::float3 e2 = p[2] - p[0];
+				float du1 = uvs[2 * v[1]] - uvs[2 * v[0]];
+				float dv1 = uvs[2 * v[1] + 1] - uvs[2 * v[0] + 1];
+				float du2 = uvs[2 * v[2]] - uvs[2 * v[0]];
+				float dv2 = uvs[2 * v[2] + 1] - uvs[2 * v[0] + 1];
+
+				float det = du1 * dv2 - du2 * dv1;
+				if (std::abs(det) < 1e-20f)
+					continue;
+
+				DG::float3 sdir = (e1 * dv2 - e2 * dv1) / det;
+				DG::float3 tdir = (e2 * du1 - e1 * du2) / det;
+
+				for (int c = 0; c < 3; ++c) {
+					DG::float3 n = LoadFloat3(normals, v[c]);
+					float angle = CornerAngle(p[c], p[(c + 1) % 3], p[(c + 2) % 3]);
+
+					DG::float3 t = sdir - n * DG::dot(n, sdir);
+					DG::float3 b = tdir - n * DG::dot(n, tdir);
+					float tl = DG::length(t);
+					float bl = DG::length(b);
+
+					if (tl > 0.0f)
+						tangents[v[c]] += t * (angle / tl);
+					if (bl > 0.0f)
+						bitangents[v[c]] += b * (angle / bl);
+				}
+			}
+		}
+
+		for (size_t i = 0; i < vertexCount; ++i) {
+			DG::float3 n = LoadFloat3(normals, i);
+			DG::float3 t = tangents[i] - n * DG::dot(n, tangents[i]);
+			float length = DG::length(t);
+
+			t = length > 1e-12f ? t / length : AnyOrthogonal(n);
+
+			float sign = DG::dot(DG::cross(n, t), bitangents[i]) < 0.0f ? -1.0f : 1.0f;
+
+			StoreFloat3(tangentsOut, i, t);
+			StoreFloat3(bitangentsOut, i, DG::cross(n, t) * sign);
+		}
+	}
+
+	struct ImportedMesh {
+		std::vector<float> mPositions;
+		std::vector<float> mUVs;
+		std::vector<float> mNormals;
+		// Index into the source position array of every vertex, vertices with
+		// equal ids are smoothed together when normals are generated.
+		std::vector<uint32_t> mPositionIds;
+		std::vector<uint32_t> mIndices;
+	};
+
+	// Matches the conventions of the Assimp import path: left handed coordinates,
+	// flipped texture V and clockwise winding.
+	void ConvertToEngineSpace(ImportedMesh* mesh) {
+		for (size_t i = 2; i < mesh->mPositions.size(); i += 3)
+			mesh->mPositions[i] = -mesh->mPositions[i];
+		for (size_t i = 2; i < mesh->mNormals.size(); i += 3)
+			mesh->mNormals[i] = -mesh->mNormals[i];
+		for (size_t i = 1; i < mesh->mUVs.size(); i += 2)
+			mesh->mUVs[i] = 1.0f - mesh->mUVs[i];
+		for (size_t i = 0; i + 2 < mesh->mIndices.size(); i += 3)
+			std::swap(mesh->mIndices[i], mesh->mIndices[i + 2]);
+	}
+
+	void FinishImport(ImportedMesh& mesh, const VertexLayout& layout, Geometry* geometry) {
+		if (mesh.mIndices.empty())
+			throw std::runtime_error("Geometry has no faces!");
+
+		ConvertToEngineSpace(&mesh);
+
+		size_t vertexCount = mesh.mPositions.size() / 3;
+
+		if (mesh.mNormals.empty()) {
+			mesh.mNormals.resize(vertexCount * 3);
+			GenerateSmoothNormals(vertexCount,
+				mesh.mIndices.size(),
+				mesh.mIndices.data(),
+				mesh.mPositions.data(),
+				mesh.mPositionIds.data(),
+				mesh.mNormals.data());
+		}
+
+		std::vector<float> tangents;
+		std::vector<float> bitangents;
+
+		if (layout.mTangent >= 0 || layout.mBitangent >= 0) {
+			tangents.resize(vertexCount * 3);
+			bitangents.resize(vertexCount * 3);
+			GenerateTangents(vertexCount,
+				mesh.mIndices.size(),
+				mesh.mIndices.data(),
+				mesh.mPositions.data(),
+				mesh.mNormals.data(),
+				mesh.mUVs.empty() ? nullptr : mesh.mUVs.data(),
+				tangents.data(),
+				bitangents.data());
+		}
+
+		geometry->FromMemory(layout,
+			vertexCount,
+			mesh.mIndices.size(),
+			mesh.mIndices.data(),
+			mesh.mPositions.data(),
+			mesh.mUVs.empty() ? nullptr : mesh.mUVs.data(),
+			mesh.mNormals.data(),
+			tangents.empty() ? nullptr : tangents.data(),
+			bitangents.empty() ? nullptr : bitangents.data());
+	}
+
+	// -------------------------------------------------------------
+	// OBJ
+	// -------------------------------------------------------------
+
+	constexpr int32_t OBJ_MISSING = std::numeric_limits<int32_t>::min();
+
+	struct ObjCorner {
+		// Position, texture coordinate and normal index
+		int32_t mIndex[3];
+		// Bit i is set if mIndex[i] is relative to the start of the chunk
+		uint8_t mRelative;
+	};
+
+	struct ObjChunk {
+		const char* mBegin;
+		const char* mEnd;
+
+		std::vector<float> mPositions;
+		std::vector<float> mUVs;
+		std::vector<float> mNormals;
+		std::vector<ObjCorner> mCorners;
+	};
+
+	struct ObjImportState {
+		std::vector<uint8_t> mData;
+		std::vector<ObjChunk> mChunks;
+	};
+
+	struct ObjVertexKey {
+		int32_t mIndex[3];
+
+		inline bool operator==(const ObjVertexKey& other) const {
+			return mIndex[0] == other.mIndex[0] &&
+				mIndex[1] == other.mIndex[1] &&
+				mIndex[2] == other.mIndex[2];
+		}
+
+		struct Hasher {
+			inline std::size_t operator()(const ObjVertexKey& k) const {
+				uint64_t h = static_cast<uint32_t>(k.mIndex[0]);
+				h = h * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(k.mIndex[1]);
+				h = h * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(k.mIndex[2]);
+				return static_cast<std::size_t>(h ^ (h >> 32));
+			}
+		};
+	};
+
+	void SplitObjChunks(ObjImportState& state) {
+		const char* data = reinterpret_cast<const char*>(state.mData.data());
+		const char* end = data + state.mData.size();
+
+		const char* p = data;
+		while (p < end) {
+			const char* chunkEnd = p + std::min<size_t>(OBJ_PARSE_CHUNK_SIZE, end - p);
+
+			// Chunks always end on a line break
+			if (chunkEnd < end) {
+				auto lineEnd = static_cast<const char*>(std::memchr(chunkEnd, '\n', end - chunkEnd));
+				chunkEnd = lineEnd ? lineEnd + 1 : end;
+			}
+
+			ObjChunk chunk;
+			chunk.mBegin = p;
+			chunk.mEnd = chunkEnd;
+			state.mChunks.emplace_back(std::move(chunk));
+
+			p = chunkEnd;
+		}
+	}
+
+	const char* ParseObjFloats(const char* p, const char* end, int required, int count,
+		std::vector<float>* out) {
+		for (int i = 0; i < count; ++i) {
+			float value = 0.0f;
+			const char* next = ParseFloat(p, end, &value);
+			if (!next) {
+				if (i < required)
+					throw std::runtime_error("Malformed OBJ vertex attribute!");
+				value = 0.0f;
+			} else {
+				p = next;
+			}
+			out->emplace_back(value);
+		}
+		return p;
+	}
+
+	inline void ResolveObjIndex(int64_t index, size_t localCount, int attrib, ObjCorner* corner) {
+		if (index > 0) {
+			corner->mIndex[attrib] = static_cast<int32_t>(index - 1);
+		} else if (index < 0) {
+			corner->mIndex[attrib] = static_cast<int32_t>(static_cast<int64_t>(localCount) + index);
+			corner->mRelative |= 1u << attrib;
+		} else {
+			throw std::runtime_error("OBJ indices cannot be zero!");
+		}
+	}
+
+	void ParseObjChunk(ObjChunk& chunk) {
+		const char* p = chunk.mBegin;
+		const char* end = chunk.mEnd;
+
+		std::vector<ObjCorner> face;
+
+		while (p < end) {
+			auto lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+			if (!lineEnd)
+				lineEnd = end;
+
+			while (p < lineEnd && IsSpace(*p))
+				++p;
+
+			if (lineEnd - p >= 2 && p[0] == 'v') {
+				if (IsSpace(p[1]))
+					ParseObjFloats(p + 2, lineEnd, 3, 3, &chunk.mPositions);
+				else if (p[1] == 't')
+					ParseObjFloats(p + 2, lineEnd, 1, 2, &chunk.mUVs);
+				else if (p[1] == 'n')
+					ParseObjFloats(p + 2, lineEnd, 3, 3, &chunk.mNormals);
+			} else if (lineEnd - p >= 2 && p[0] == 'f' && IsSpace(p[1])) {
+				face.clear();
+				const char* q = p + 2;
+
+				while (true) {
+					ObjCorner corner;
+					corner.mIndex[0] = OBJ_MISSING;
+					corner.mIndex[1] = OBJ_MISSING;
+					corner.mIndex[2] = OBJ_MISSING;
+					corner.mRelative = 0;
+
+					int64_t index;
+					q = ParseInt(q, lineEnd, &index);
+					if (!q)
+						break;
+					ResolveObjIndex(index, chunk.mPositions.size() / 3, 0, &corner);
+
+					if (q < lineEnd && *q == '/') {
+						++q;
+						if (q < lineEnd && *q != '/') {
+							q = ParseInt(q, lineEnd, &index);
+							if (!q)
+								throw std::runtime_error("Malformed OBJ face!");
+							ResolveObjIndex(index, chunk.mUVs.size() / 2, 1, &corner);
+						}
+						if (q < lineEnd && *q == '/') {
+							++q;
+							q = ParseInt(q, lineEnd, &index);
+							if (!q)
+								throw std::runtime_error("Malformed OBJ face!");
+							ResolveObjIndex(index, chunk.mNormals.size() / 3, 2, &corner);
+						}
+					}
+
+					face.emplace_back(corner);
+				}
+
+				// Triangulate polygons as a fan
+				for (size_t i = 2; i < face.size(); ++i) {
+					chunk.mCorners.emplace_back(face[0]);
+					chunk.mCorners.emplace_back(face[i - 1]);
+					chunk.mCorners.emplace_back(face[i]);
+				}
+			}
+
+			p = lineEnd + 1;
+		}
+	}
+
+	void MergeObjChunks(ObjImportState& state, ImportedMesh* mesh) {
+		size_t positionCount = 0;
+		size_t uvCount = 0;
+		size_t normalCount = 0;
+		size_t cornerCount = 0;
+
+		for (auto& chunk : state.mChunks) {
+			positionCount += chunk.mPositions.size() / 3;
+			uvCount += chunk.mUVs.size() / 2;
+			normalCount += chunk.mNormals.size() / 3;
+			cornerCount += chunk.mCorners.size();
+		}
+
+		std::vector<float> positions;
+		std::vector<float> uvs;
+		std::vector<float> normals;
+		positions.reserve(positionCount * 3);
+		uvs.reserve(uvCount * 2);
+		normals.reserve(normalCount * 3);
+
+		bool bAllUVs = true;
+		bool bAllNormals = true;
+
+		size_t totals[3] = { positionCount, uvCount, normalCount };
+		size_t prefix[3] = { 0, 0, 0 };
+
+		// Resolve chunk relative indices against the attributes of all previous chunks
+		std::vector<ObjVertexKey> keys;
+		keys.reserve(cornerCount);
+
+		for (auto& chunk : state.mChunks) {
+			for (auto& corner : chunk.mCorners) {
+				ObjVertexKey key;
+				for (int a = 0; a < 3; ++a) {
+					int64_t index = corner.mIndex[a];
+					if (index == OBJ_MISSING) {
+						key.mIndex[a] = -1;
+						continue;
+					}
+					if (corner.mRelative & (1u << a))
+						index += prefix[a];
+					if (index < 0 || index >= static_cast<int64_t>(totals[a]))
+						throw std::runtime_error("OBJ index out of range!");
+					key.mIndex[a] = static_cast<int32_t>(index);
+				}
+
+				if (key.mIndex[0] < 0)
+					throw std::runtime_error("OBJ face corner has no position!");
+
+				bAllUVs &= key.mIndex[1] >= 0;
+				bAllNormals &= key.mIndex[2] >= 0;
+				keys.emplace_back(key);
+			}
+
+			prefix[0] += chunk.mPositions.size() / 3;
+			prefix[1] += chunk.mUVs.size() / 2;
+			prefix[2] += chunk.mNormals.size() / 3;
+
+			positions.insert(positions.end(), chunk.mPositions.begin(), chunk.mPositions.end());
+			uvs.insert(uvs.end(), chunk.mUVs.begin(), chunk.mUVs.end());
+			normals.insert(normals.end(), chunk.mNormals.begin(), chunk.mNormals.end());
+
+			chunk = ObjChunk();
+		}
+
+		bool bHasUVs = uvCount > 0;
+
+		// Deduplicate vertices that share all attribute indices
+		std::unordered_map<ObjVertexKey, uint32_t, ObjVertexKey::Hasher> lookup;
+		lookup.reserve(keys.size());
+
+		mesh->mIndices.reserve(keys.size());
+
+		for (auto& key : keys) {
+			auto result = lookup.emplace(key, static_cast<uint32_t>(mesh->mPositionIds.size()));
+
+			if (result.second) {
+				uint32_t p = key.mIndex[0];
+				mesh->mPositionIds.emplace_back(p);
+				mesh->mPositions.insert(mesh->mPositions.end(),
+					&positions[3 * p], &positions[3 * p] + 3);
+
+				if (bHasUVs) {
+					int32_t t = key.mIndex[1];
+					mesh->mUVs.emplace_back(t >= 0 ? uvs[2 * t] : 0.0f);
+					mesh->mUVs.emplace_back(t >= 0 ? uvs[2 * t + 1] : 0.0f);
+				}
+
+				if (bAllNormals) {
+					int32_t n = key.mIndex[2];
+					mesh->mNormals.insert(mesh->mNormals.end(),
+						&normals[3 * n], &normals[3 * n] + 3);
+				}
+			}
+
+			mesh->mIndices.emplace_back(result.first->second);
+		}
+	}
+
+	Task Geometry::ReadObjTask(const LoadParams<Geometry>& params) {
+		auto state = std::make_shared<ObjImportState>();
+
+		Task task([this, params, state](const TaskParams& e) {
+			if (e.mTask->BeginSubTask()) {
+				ReadBinaryFile(params.mSource, state->mData);
+				SplitObjChunks(*state);
+
+				std::vector<ITask*> jobs;
+				jobs.reserve(state->mChunks.size());
+				for (size_t i = 0; i < state->mChunks.size(); ++i) {
+					Task job([state, i](const TaskParams& e) {
+						ParseObjChunk(state->mChunks[i]);
+					}, "Parse OBJ Chunk");
+
+					jobs.emplace_back(e.mQueue->Adopt(std::move(job)));
+				}
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					for (auto job : jobs)
+						lock.Connect(job);
+					bWait = lock.ShouldWait();
+				}
+
+				e.mTask->EndSubTask();
+
+				for (auto job : jobs)
+					e.mQueue->Trigger(job);
+
+				if (bWait)
+					return TaskResult::WAITING;
+			}
+
+			ImportedMesh mesh;
+			MergeObjChunks(*state, &mesh);
+			state->mData = std::vector<uint8_t>();
+
+			FinishImport(mesh, params.mVertexLayout, this);
+
+			return TaskResult::FINISHED;
+		},
+		std::string("Load Raw Geometry ") + params.mSource + " (OBJ)",
+		TaskType::FILE_IO);
+
+		return task;
+	}
+
+	// -------------------------------------------------------------
+	// PLY
+	// -------------------------------------------------------------
+
+	enum class PlyType {
+		INT8,
+		UINT8,
+		INT16,
+		UINT16,
+		INT32,
+		UINT32,
+		FLOAT32,
+		FLOAT64
+	};
+
+	struct PlyProperty {
+		std::string mName;
+		PlyType mType;
+		bool bList = false;
+		PlyType mCountType;
+		// Offset within a record, only valid for elements without lists
+		size_t mOffset = 0;
+	};
+
+	struct PlyElement {
+		std::string mName;
+		size_t mCount = 0;
+		std::vector<PlyProperty> mProperties;
+		bool bFixedSize = true;
+		size_t mStride = 0;
+	};
+
+	struct PlyImportState {
+		std::vector<uint8_t> mData;
+		std::vector<PlyElement> mElements;
+		bool bSwapBytes = false;
+
+		const PlyElement* mVertexElement = nullptr;
+		const uint8_t* mVertexData = nullptr;
+		const PlyElement* mFaceElement = nullptr;
+		const uint8_t* mFaceData = nullptr;
+
+		int mPosition[3] = { -1, -1, -1 };
+		int mNormal[3] = { -1, -1, -1 };
+		int mUV[2] = { -1, -1 };
+		int mFaceIndices = -1;
+
+		ImportedMesh mMesh;
+	};
+
+	inline bool IsHostLittleEndian() {
+		uint16_t n = 1;
+		return *reinterpret_cast<uint8_t*>(&n) == 1;
+	}
+
+	size_t PlyTypeSize(PlyType type) {
+		switch (type) {
+			case PlyType::INT8:
+			case PlyType::UINT8:
+				return 1;
+			case PlyType::INT16:
+			case PlyType::UINT16:
+				return 2;
+			case PlyType::INT32:
+			case PlyType::UINT32:
+			case PlyType::FLOAT32:
+				return 4;
+			case PlyType::FLOAT64:
+				return 8;
+			default:
+				throw std::runtime_error("Invalid PLY type!");
+		}
+	}
+
+	PlyType ParsePlyType(const std::string& name) {
+		if (name == "char" || name == "int8")
+			return PlyType::INT8;
+		if (name == "uchar" || name == "uint8")
+			return PlyType::UINT8;
+		if (name == "short" || name == "int16")
+			return PlyType::INT16;
+		if (name == "ushort" || name == "uint16")
+			return PlyType::UINT16;
+		if (name == "int" || name == "int32")
+			return PlyType::INT32;
+		if (name == "uint" || name == "uint32")
+			return PlyType::UINT32;
+		if (name == "float" || name == "float32")
+			return PlyType::FLOAT32;
+		if (name == "double" || name == "float64")
+			return PlyType::FLOAT64;
+		throw std::runtime_error("Unknown PLY type " + name + "!");
+	}
+
+	template <typename T>
+	inline T ReadPlyRaw(const uint8_t* p, bool bSwapBytes) {
+		uint8_t bytes[sizeof(T)];
+		std::memcpy(bytes, p, sizeof(T));
+		if (bSwapBytes)
+			std::reverse(bytes, bytes + sizeof(T));
+		T value;
+		std::memcpy(&value, bytes, sizeof(T));
+		return value;
+	}
+
+	inline double ReadPlyScalar(const uint8_t* p, PlyType type, bool bSwapBytes) {
+		switch (type) {
+			case PlyType::INT8:
+				return ReadPlyRaw<int8_t>(p, bSwapBytes);
+			case PlyType::UINT8:
+				return ReadPlyRaw<uint8_t>(p, bSwapBytes);
+			case PlyType::INT16:
+				return ReadPlyRaw<int16_t>(p, bSwapBytes);
+			case PlyType::UINT16:
+				return ReadPlyRaw<uint16_t>(p, bSwapBytes);
+			case PlyType::INT32:
+				return ReadPlyRaw<int32_t>(p, bSwapBytes);
+			case PlyType::UINT32:
+				return ReadPlyRaw<uint32_t>(p, bSwapBytes);
+			case PlyType::FLOAT32:
+				return ReadPlyRaw<float>(p, bSwapBytes);
+			case PlyType::FLOAT64:
+				return ReadPlyRaw<double>(p, bSwapBytes);
+			default:
+				throw std::runtime_error("Invalid PLY type!");
+		}
+	}
+
+	// Returns false if the file is not a binary PLY the native importer can handle
+	bool ParsePlyHeader(PlyImportState& state) {
+		const char* data = reinterpret_cast<const char*>(state.mData.data());
+		const char* end = data + state.mData.size();
+		const char* p = data;
+
+		auto nextLine = [&](std::string* line) {
+			if (p >= end)
+				return false;
+			auto lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+			if (!lineEnd)
+				lineEnd = end;
+			const char* trimmed = lineEnd;
+			while (trimmed > p && IsSpace(trimmed[-1]))
+				--trimmed;
+			line->assign(p, trimmed);
+			p = lineEnd < end ? lineEnd + 1 : end;
+			return true;
+		};
+
+		std::string line;
+		if (!nextLine(&line) || line != "ply")
+			throw std::runtime_error("Not a PLY file!");
+
+		bool bBinary = false;
+		bool bEndHeader = false;
+
+		while (nextLine(&line)) {
+			std::stringstream ss(line);
+			std::string keyword;
+			ss >> keyword;
+
+			if (keyword == "format") {
+				std::string format;
+				ss >> format;
+				if (format == "binary_little_endian") {
+					bBinary = true;
+					state.bSwapBytes = !IsHostLittleEndian();
+				} else if (format == "binary_big_endian") {
+					bBinary = true;
+					state.bSwapBytes = IsHostLittleEndian();
+				}
+			} else if (keyword == "element") {
+				PlyElement element;
+				ss >> element.mName >> element.mCount;
+				state.mElements.emplace_back(std::move(element));
+			} else if (keyword == "property") {
+				if (state.mElements.empty())
+					throw std::runtime_error("PLY property outside of element!");
+
+				auto& element = state.mElements.back();
+				PlyProperty property;
+				std::string type;
+				ss >> type;
+
+				if (type == "list") {
+					std::string countType;
+					std::string itemType;
+					ss >> countType >> itemType;
+					property.bList = true;
+					property.mCountType = ParsePlyType(countType);
+					property.mType = ParsePlyType(itemType);
+					element.bFixedSize = false;
+				} else {
+					property.mType = ParsePlyType(type);
+					property.mOffset = element.mStride;
+					element.mStride += PlyTypeSize(property.mType);
+				}
+
+				ss >> property.mName;
+				element.mProperties.emplace_back(std::move(property));
+			} else if (keyword == "end_header") {
+				bEndHeader = true;
+				break;
+			}
+		}
+
+		if (!bEndHeader)
+			throw std::runtime_error("PLY header is not terminated!");
+
+		if (!bBinary)
+			return false;
+
+		// Locate the vertex and face data
+		const uint8_t* body = reinterpret_cast<const uint8_t*>(p);
+		const uint8_t* bodyEnd = state.mData.data() + state.mData.size();
+
+		for (auto& element : state.mElements) {
+			if (element.mName == "vertex") {
+				state.mVertexElement = &element;
+				state.mVertexData = body;
+			} else if (element.mName == "face") {
+				state.mFaceElement = &element;
+				state.mFaceData = body;
+			}
+
+			if (element.bFixedSize) {
+				body += element.mCount * element.mStride;
+			} else {
+				// Walk over every record to find where the element ends
+				for (size_t i = 0; i < element.mCount; ++i) {
+					for (auto& property : element.mProperties) {
+						if (property.bList) {
+							if (body + PlyTypeSize(property.mCountType) > bodyEnd)
+								throw std::runtime_error("PLY file is truncated!");
+							size_t count = static_cast<size_t>(
+								ReadPlyScalar(body, property.mCountType, state.bSwapBytes));
+							body += PlyTypeSize(property.mCountType) + count * PlyTypeSize(property.mType);
+						} else {
+							body += PlyTypeSize(property.mType);
+						}
+					}
+				}
+			}
+
+			if (body > bodyEnd)
+				throw std::runtime_error("PLY file is truncated!");
+		}
+
+		// Vertex records need a fixed size to be decoded in parallel
+		if (!state.mVertexElement || !state.mVertexElement->bFixedSize || !state.mFaceElement)
+			return false;
+
+		auto& vertexProps = state.mVertexElement->mProperties;
+		auto find = [&vertexProps](std::initializer_list<const char*> names) {
+			for (auto name : names)
+				for (size_t i = 0; i < vertexProps.size(); ++i)
+					if (vertexProps[i].mName == name)
+						return static_cast<int>(i);
+			return -1;
+		};
+
+		state.mPosition[0] = find({"x"});
+		state.mPosition[1] = find({"y"});
+		state.mPosition[2] = find({"z"});
+		state.mNormal[0] = find({"nx"});
+		state.mNormal[1] = find({"ny"});
+		state.mNormal[2] = find({"nz"});
+		state.mUV[0] = find({"u", "s", "texture_u", "texture_s"});
+		state.mUV[1] = find({"v", "t", "texture_v", "texture_t"});
+
+		if (state.mPosition[0] < 0 || state.mPosition[1] < 0 || state.mPosition[2] < 0)
+			throw std::runtime_error("PLY vertices have no position!");
+
+		auto& faceProps = state.mFaceElement->mProperties;
+		for (size_t i = 0; i < faceProps.size(); ++i) {
+			if (faceProps[i].bList &&
+				(faceProps[i].mName == "vertex_indices" || faceProps[i].mName == "vertex_index"))
+				state.mFaceIndices = static_cast<int>(i);
+		}
+
+		if (state.mFaceIndices < 0)
+			throw std::runtime_error("PLY faces have no vertex indices!");
+
+		return true;
+	}
+
+	void DecodePlyVertices(PlyImportState& state, size_t begin, size_t end) {
+		auto& element = *state.mVertexElement;
+		auto& props = element.mProperties;
+		auto& mesh = state.mMesh;
+		bool bSwap = state.bSwapBytes;
+
+		auto read = [&](const uint8_t* record, int prop) {
+			return static_cast<float>(ReadPlyScalar(
+				record + props[prop].mOffset, props[prop].mType, bSwap));
+		};
+
+		bool bNormals = !mesh.mNormals.empty();
+		bool bUVs = !mesh.mUVs.empty();
+
+		for (size_t i = begin; i < end; ++i) {
+			const uint8_t* record = state.mVertexData + i * element.mStride;
+
+			for (int c = 0; c < 3; ++c)
+				mesh.mPositions[3 * i + c] = read(record, state.mPosition[c]);
+
+			if (bNormals)
+				for (int c = 0; c < 3; ++c)
+					mesh.mNormals[3 * i + c] = read(record, state.mNormal[c]);
+
+			if (bUVs)
+				for (int c = 0; c < 2; ++c)
+					mesh.mUVs[2 * i + c] = read(record, state.mUV[c]);
+
+			mesh.mPositionIds[i] = static_cast<uint32_t>(i);
+		}
+	}
+
+	void DecodePlyFaces(PlyImportState& state) {
+		auto& element = *state.mFaceElement;
+		auto& props = element.mProperties;
+		auto& indices = state.mMesh.mIndices;
+		bool bSwap = state.bSwapBytes;
+		size_t vertexCount = state.mVertexElement->mCount;
+
+		indices.reserve(element.mCount * 3);
+
+		const uint8_t* p = state.mFaceData;
+		std::vector<uint32_t> face;
+
+		for (size_t i = 0; i < element.mCount; ++i) {
+			for (size_t j = 0; j < props.size(); ++j) {
+				auto& property = props[j];
+
+				if (!property.bList) {
+					p += PlyTypeSize(property.mType);
+					continue;
+				}
+
+				size_t count = static_cast<size_t>(ReadPlyScalar(p, property.mCountType, bSwap));
+				p += PlyTypeSize(property.mCountType);
+				size_t itemSize = PlyTypeSize(property.mType);
+
+				if (static_cast<int>(j) == state.mFaceIndices) {
+					face.resize(count);
+					for (size_t k = 0; k < count; ++k) {
+						double index = ReadPlyScalar(p + k * itemSize, property.mType, bSwap);
+						if (index < 0.0 || index >= static_cast<double>(vertexCount))
+							throw std::runtime_error("PLY index out of range!");
+						face[k] = static_cast<uint32_t>(index);
+					}
+
+					for (size_t k = 2; k < count; ++k) {
+						indices.emplace_back(face[0]);
+						indices.emplace_back(face[k - 1]);
+						indices.emplace_back(face[k]);
+					}
+				}
+
+				p += count * itemSize;
+			}
+		}
+	}
+
+	Task Geometry::ReadPlyTask(const LoadParams<Geometry>& params) {
+		auto state = std::make_shared<PlyImportState>();
+
+		Task task([this, params, state](const TaskParams& e) {
+			if (e.mTask->BeginSubTask()) {
+				ReadBinaryFile(params.mSource, state->mData);
+
+				if (!ParsePlyHeader(*state)) {
+					// ASCII and unusual layouts are left to Assimp
+					state->mData = std::vector<uint8_t>();
+					ReadAssimpRaw(params);
+					e.mTask->EndSubTask();
+					return TaskResult::FINISHED;
+				}
+
+				size_t vertexCount = state->mVertexElement->mCount;
+				auto& mesh = state->mMesh;
+				mesh.mPositions.resize(vertexCount * 3);
+				mesh.mPositionIds.resize(vertexCount);
+				if (state->mNormal[0] >= 0 && state->mNormal[1] >= 0 && state->mNormal[2] >= 0)
+					mesh.mNormals.resize(vertexCount * 3);
+				if (state->mUV[0] >= 0 && state->mUV[1] >= 0)
+					mesh.mUVs.resize(vertexCount * 2);
+
+				// Faces are variable length and decoded by one task, vertices in chunks
+				std::vector<ITask*> jobs;
+
+				Task faceJob([state](const TaskParams& e) {
+					DecodePlyFaces(*state);
+				}, "Decode PLY Faces");
+				jobs.emplace_back(e.mQueue->Adopt(std::move(faceJob)));
+
+				for (size_t begin = 0; begin < vertexCount; begin += PLY_DECODE_CHUNK_SIZE) {
+					size_t end = std::min<size_t>(vertexCount, begin + PLY_DECODE_CHUNK_SIZE);
+
+					Task job([state, begin, end](const TaskParams& e) {
+						DecodePlyVertices(*state, begin, end);
+					}, "Decode PLY Vertices");
+					jobs.emplace_back(e.mQueue->Adopt(std::move(job)));
+				}
+
+				bool bWait = false;
+				{
+					auto lock = e.mTask->In().Lock();
+					for (auto job : jobs)
+						lock.Connect(job);
+					bWait = lock.ShouldWait();
+				}
+
+				e.mTask->EndSubTask();
+
+				for (auto job : jobs)
+					e.mQueue->Trigger(job);
+
+				if (bWait)
+					return TaskResult::WAITING;
+			}
+
+			if (!state->mVertexElement)
+				return TaskResult::FINISHED;
+
+			state->mData = std::vector<uint8_t>();
+			FinishImport(state->mMesh, params.mVertexLayout, this);
+			state->mMesh = ImportedMesh();
+
+			return TaskResult::FINISHED;
+		},
+		std::string("Load Raw Geometry ") + params.mSource + " (PLY)",
+		TaskType::FILE_IO);
+
+		return task;
+	}
+}
@@ -0,0 +1,655 @@
+#include <Engine/Resources/GltfImport.hpp>
+#include <Engine/Resources/GeometryImport.hpp>
+#include <Engine/Resources/ResourceData.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstring>
+#include <iostream>
+
+namespace Morpheus {
+
+	constexpr uint32_t GLB_MAGIC = 0x46546C67;
+	constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A;
+	constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;
+
+	enum GltfComponentType {
+		GLTF_BYTE = 5120,
+		GLTF_UNSIGNED_BYTE = 5121,
+		GLTF_SHORT = 5122,
+		GLTF_UNSIGNED_SHORT = 5123,
+		GLTF_UNSIGNED_INT = 5125,
+		GLTF_FLOAT = 5126
+	};
+
+	constexpr int GLTF_MODE_TRIANGLES = 4;
+
+	struct GltfBuffer {
+		const uint8_t* mData = nullptr;
+		size_t mSize = 0;
+	};
+
+	struct GltfDocument {
+		nlohmann::json mJson;
+		// Buffers point into this storage, for GLB files the binary chunk
+		// is used in place
+		std::vector<std::vector<uint8_t>> mStorage;
+		std::vector<GltfBuffer> mBuffers;
+		std::string mDirectory;
+	};
+
+	struct GltfAccessor {
+		const uint8_t* mData = nullptr;
+		size_t mCount = 0;
+		size_t mStride = 0;
+		int mComponentType = GLTF_FLOAT;
+		int mComponents = 0;
+		bool bNormalized = false;
+	};
+
+	size_t GltfComponentSize(int componentType) {
+		switch (componentType) {
+			case GLTF_BYTE:
+			case GLTF_UNSIGNED_BYTE:
+				return 1;
+			case GLTF_SHORT:
+			case GLTF_UNSIGNED_SHORT:
+				return 2;
+			case GLTF_UNSIGNED_INT:
+			case GLTF_FLOAT:
+				return 4;
+			default:
+				throw std::runtime_error("Invalid glTF component type!");
+		}
+	}
+
+	int GltfComponentCount(const std::string& type) {
+		if (type == "SCALAR")
+			return 1;
+		if (type == "VEC2")
+			return 2;
+		if (type == "VEC3")
+			return 3;
+		if (type == "VEC4")
+			return 4;
+		throw std::runtime_error("Unsupported glTF accessor type " + type + "!");
+	}
+
+	std::string GltfDirectory(const std::string& source) {
+		auto pos = source.find_last_of("/\\");
+		return pos == std::string::npos ? std::string() : source.substr(0, pos + 1);
+	}
+
+	void DecodeBase64(const char* begin, const char* end, std::vector<uint8_t>* out) {
+		auto decode = [](char c) -> int {
+			if (c >= 'A' && c <= 'Z') return c - 'A';
+			if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+			if (c >= '0' && c <= '9') return c - '0' + 52;
+			if (c == '+' || c == '-') return 62;
+			if (c == '/' || c == '_') return 63;
+			return -1;
+		};
+
+		out->clear();
+		out->reserve((end - begin) / 4 * 3);
+
+		uint32_t bits = 0;
+		int bitCount = 0;
+		for (const char* p = begin; p < end && *p != '='; ++p) {
+			int value = decode(*p);
+			if (value < 0)
+				throw std::runtime_error("Invalid base64 data in glTF buffer!");
+			bits = (bits << 6) | static_cast<uint32_t>(value);
+			bitCount += 6;
+			if (bitCount >= 8) {
+				bitCount -= 8;
+				out->emplace_back(static_cast<uint8_t>((bits >> bitCount) & 0xFF));
+			}
+		}
+	}
+
+	void ReadGltfDocument(const std::string& source, GltfDocument* doc, bool bReadBuffers = true) {
+		doc->mDirectory = GltfDirectory(source);
+
+		doc->mStorage.emplace_back();
+		auto& file = doc->mStorage.back();
+		ReadBinaryFile(source, file);
+
+		GltfBuffer binChunk;
+
+		uint32_t magic = 0;
+		if (file.size() >= 4)
+			std::memcpy(&magic, file.data(), sizeof(uint32_t));
+
+		if (magic == GLB_MAGIC) {
+			if (file.size() < 20)
+				throw std::runtime_error("GLB file is truncated!");
+
+			uint32_t header[3];
+			std::memcpy(header, file.data(), sizeof(header));
+			if (header[1] != 2)
+				throw std::runtime_error("Only glTF 2.0 is supported!");
+
+			size_t length = std::min<size_t>(header[2], file.size());
+			size_t offset = sizeof(header);
+			bool bHasJson = false;
+
+			while (offset + 8 <= length) {
+				uint32_t chunk[2];
+				std::memcpy(chunk, &file[offset], sizeof(chunk));
+				offset += sizeof(chunk);
+
+				if (offset + chunk[0] > length)
+					throw std::runtime_error("GLB chunk is truncated!");
+
+				const uint8_t* data = &file[offset];
+				if (chunk[1] == GLB_CHUNK_JSON) {
+					doc->mJson = nlohmann::json::parse(data, data + chunk[0]);
+					bHasJson = true;
+				} else if (chunk[1] == GLB_CHUNK_BIN && !binChunk.mData) {
+					binChunk.mData = data;
+					binChunk.mSize = chunk[0];
+				}
+
+				offset += chunk[0];
+			}
+
+			if (!bHasJson)
+				throw std::runtime_error("GLB file has no JSON chunk!");
+		} else {
+			doc->mJson = nlohmann::json::parse(file.begin(), file.end());
+		}
+
+		auto asset = doc->mJson.find("asset");
+		if (asset == doc->mJson.end() || asset->value("version", std::string()).rfind("2.", 0) != 0)
+			throw std::runtime_error("Only glTF 2.0 is supported!");
+
+		auto buffers = doc->mJson.find("buffers");
+		if (!bReadBuffers || buffers == doc->mJson.end())
+			return;
+
+		for (auto& buffer : *buffers) {
+			size_t byteLength = buffer.at("byteLength").get<size_t>();
+			GltfBuffer result;
+
+			auto uri = buffer.find("uri");
+			if (uri == buffer.end()) {
+				// The first buffer of a GLB file without uri is the binary chunk
+				if (!binChunk.mData)
+					throw std::runtime_error("glTF buffer has no data!");
+				result = binChunk;
+			} else {
+				auto uriStr = uri->get<std::string>();
+
+				doc->mStorage.emplace_back();
+				auto& storage = doc->mStorage.back();
+
+				if (uriStr.rfind("data:", 0) == 0) {
+					auto comma = uriStr.find(',');
+					if (comma == std::string::npos)
+						throw std::runtime_error("Invalid glTF data uri!");
+					DecodeBase64(uriStr.data() + comma + 1, uriStr.data() + uriStr.size(), &storage);
+				} else {
+					ReadBinaryFile(doc->mDirectory + uriStr, storage);
+				}
+
+				result.mData = storage.data();
+				result.mSize = storage.size();
+			}
+
+			if (result.mSize < byteLength)
+				throw std::runtime_error("glTF buffer is smaller than its byteLength!");
+
+			doc->mBuffers.emplace_back(result);
+		}
+	}
+
+	GltfAccessor GetGltfAccessor(const GltfDocument& doc, size_t index) {
+		auto& accessor = doc.mJson.at("accessors").at(index);
+
+		if (accessor.contains("sparse"))
+			throw std::runtime_error("Sparse glTF accessors are not supported!");
+		if (!accessor.contains("bufferView"))
+			throw std::runtime_error("glTF accessor has no buffer view!");
+
+		GltfAccessor result;
+		result.mCount = accessor.at("count").get<size_t>();
+		result.mComponentType = accessor.at("componentType").get<int>();
+		result.mComponents = GltfComponentCount(accessor.at("type").get<std::string>());
+		result.bNormalized = accessor.value("normalized", false);
+
+		size_t elementSize = GltfComponentSize(result.mComponentType) * result.mComponents;
+
+		auto& view = doc.mJson.at("bufferViews").at(accessor.at("bufferView").get<size_t>());
+		auto& buffer = doc.mBuffers.at(view.at("buffer").get<size_t>());
+
+		size_t offset = view.value("byteOffset", static_cast<size_t>(0)) +
+			accessor.value("byteOffset", static_cast<size_t>(0));
+		result.mStride = view.value("byteStride", elementSize);
+
+		if (result.mCount > 0 &&
+			offset + (result.mCount - 1) * result.mStride + elementSize > buffer.mSize)
+			throw std::runtime_error("glTF accessor is out of buffer bounds!");
+
+		result.mData = buffer.mData + offset;
+		return result;
+	}
+
+	GltfAccessor MakeFloatAccessor(const std::vector<float>& data, int components) {
+		GltfAccessor result;
+		result.mData = reinterpret_cast<const uint8_t*>(data.data());
+		result.mCount = data.size() / components;
+		result.mStride = components * sizeof(float);
+		result.mComponentType = GLTF_FLOAT;
+		result.mComponents = components;
+		return result;
+	}
+
+	inline float ReadGltfComponent(const uint8_t* p, int componentType, bool bNormalized) {
+		switch (componentType) {
+			case GLTF_FLOAT: {
+				float value;
+				std::memcpy(&value, p, sizeof(float));
+				return value;
+			}
+			case GLTF_UNSIGNED_BYTE: {
+				float value = static_cast<float>(*p);
+				return bNormalized ? value / 255.0f : value;
+			}
+			case GLTF_BYTE: {
+				float value = static_cast<float>(static_cast<int8_t>(*p));
+				return bNormalized ? std::max(value / 127.0f, -1.0f) : value;
+			}
+			case GLTF_UNSIGNED_SHORT: {
+				uint16_t raw;
+				std::memcpy(&raw, p, sizeof(uint16_t));
+				return bNormalized ? raw / 65535.0f : static_cast<float>(raw);
+			}
+			case GLTF_SHORT: {
+				int16_t raw;
+				std::memcpy(&raw, p, sizeof(int16_t));
+				return bNormalized ? std::max(raw / 32767.0f, -1.0f) : static_cast<float>(raw);
+			}
+			case GLTF_UNSIGNED_INT: {
+				uint32_t raw;
+				std::memcpy(&raw, p, sizeof(uint32_t));
+				return static_cast<float>(raw);
+			}
+			default:
+				throw std::runtime_error("Invalid glTF component type!");
+		}
+	}
+
+	// Writes the first components of every element of an accessor into a strided float
+	// channel. Float data is copied as is, in one block if both sides are tightly packed.
+	// Everything else is converted element by element.
+	void WriteGltfAttribute(const GltfAccessor& src, int components, bool bNegateZ,
+		uint8_t* dest, size_t destStride) {
+		size_t rowSize = components * sizeof(float);
+
+		if (src.mComponentType == GLTF_FLOAT && src.mComponents >= components) {
+			if (src.mStride == rowSize && destStride == rowSize) {
+				std::memcpy(dest, src.mData, rowSize * src.mCount);
+			} else {
+				for (size_t i = 0; i < src.mCount; ++i)
+					std::memcpy(dest + i * destStride, src.mData + i * src.mStride, rowSize);
+			}
+		} else {
+			size_t componentSize = GltfComponentSize(src.mComponentType);
+			for (size_t i = 0; i < src.mCount; ++i) {
+				const uint8_t* element = src.mData + i * src.mStride;
+				float* out = reinterpret_cast<float*>(dest + i * destStride);
+				for (int c = 0; c < components; ++c)
+					out[c] = c < src.mComponents ? ReadGltfComponent(
+						element + c * componentSize, src.mComponentType, src.bNormalized) : 0.0f;
+			}
+		}
+
+		// glTF is right handed, the engine is left handed
+		if (bNegateZ && components >= 3) {
+			for (size_t i = 0; i < src.mCount; ++i) {
+				float* out = reinterpret_cast<float*>(dest + i * destStride);
+				out[2] = -out[2];
+			}
+		}
+	}
+
+	std::vector<float> ReadGltfFloats(const GltfAccessor& src, int components, bool bNegateZ) {
+		std::vector<float> result(src.mCount * components);
+		WriteGltfAttribute(src, components, bNegateZ,
+			reinterpret_cast<uint8_t*>(result.data()), components * sizeof(float));
+		return result;
+	}
+
+	void ReadGltfIndices(const GltfDocument& doc, const nlohmann::json& primitive,
+		size_t vertexCount, std::vector<uint8_t>* out) {
+		auto indicesIt = primitive.find("indices");
+
+		if (indicesIt == primitive.end()) {
+			out->resize(vertexCount * sizeof(uint32_t));
+			auto indices = reinterpret_cast<uint32_t*>(out->data());
+			for (size_t i = 0; i < vertexCount; ++i)
+				indices[i] = static_cast<uint32_t>(i);
+		} else {
+			auto accessor = GetGltfAccessor(doc, indicesIt->get<size_t>());
+			if (accessor.mComponents != 1)
+				throw std::runtime_error("glTF indices must be scalars!");
+
+			out->resize(accessor.mCount * sizeof(uint32_t));
+			auto indices = reinterpret_cast<uint32_t*>(out->data());
+
+			for (size_t i = 0; i < accessor.mCount; ++i) {
+				const uint8_t* p = accessor.mData + i * accessor.mStride;
+				uint32_t index;
+				switch (accessor.mComponentType) {
+					case GLTF_UNSIGNED_BYTE:
+						index = *p;
+						break;
+					case GLTF_UNSIGNED_SHORT: {
+						uint16_t raw;
+						std::memcpy(&raw, p, sizeof(uint16_t));
+						index = raw;
+						break;
+					}
+					case GLTF_UNSIGNED_INT:
+						std::memcpy(&index, p, sizeof(uint32_t));
+						break;
+					default:
+						throw std::runtime_error("Invalid glTF index type!");
+				}
+
+				if (index >= vertexCount)
+					throw std::runtime_error("glTF index out of range!");
+				indices[i] = index;
+			}
+		}
+
+		size_t indexCount = out->size() / sizeof(uint32_t);
+		if (indexCount % 3 != 0)
+			throw std::runtime_error("glTF triangle list has an incomplete triangle!");
+
+		// Clockwise winding, as in the Assimp import path
+		auto indices = reinterpret_cast<uint32_t*>(out->data());
+		for (size_t i = 0; i < indexCount; i += 3)
+			std::swap(indices[i], indices[i + 2]);
+	}
+
+	BoundingBox GltfPositionBounds(const nlohmann::json& accessor, const std::vector<float>& positions,
+		const GltfAccessor& positionAccessor) {
+		auto min = accessor.find("min");
+		auto max = accessor.find("max");
+
+		if (min != accessor.end() && max != accessor.end() &&
+			min->size() >= 3 && max->size() >= 3) {
+			// Negating z swaps the bounds along that axis
+			BoundingBox result;
+			result.mLower = DG::float3((*min)[0].get<float>(), (*min)[1].get<float>(), -(*max)[2].get<float>());
+			result.mUpper = DG::float3((*max)[0].get<float>(), (*max)[1].get<float>(), -(*min)[2].get<float>());
+			return result;
+		}
+
+		auto data = positions.empty() ? ReadGltfFloats(positionAccessor, 3, true) : positions;
+		BoundingBox result = BoundingBox::Empty();
+		for (size_t i = 0; i + 2 < data.size(); i += 3)
+			result.Grow(DG::float3(data[i], data[i + 1], data[i + 2]));
+		return result;
+	}
+
+	Task Geometry::ReadGltfTask(const LoadParams<Geometry>& params) {
+		Task task([this, params](const TaskParams& e) {
+			GltfDocument doc;
+			ReadGltfDocument(params.mSource, &doc);
+
+			auto& meshes = doc.mJson.at("meshes");
+			if (meshes.empty())
+				throw std::runtime_error("Geometry has no meshes!");
+
+			// Like the Assimp path, only the first primitive of the first mesh is used
+			auto& primitive = meshes.at(0).at("primitives").at(0);
+			if (primitive.value("mode", GLTF_MODE_TRIANGLES) != GLTF_MODE_TRIANGLES)
+				throw std::runtime_error("Only glTF triangle lists are supported!");
+
+			auto& attributes = primitive.at("attributes");
+			auto positionIt = attributes.find("POSITION");
+			if (positionIt == attributes.end())
+				throw std::runtime_error("glTF primitive has no positions!");
+
+			auto positionAccessor = GetGltfAccessor(doc, positionIt->get<size_t>());
+			size_t vertexCount = positionAccessor.mCount;
+
+			auto findAttribute = [&](const char* name, GltfAccessor* out) {
+				auto it = attributes.find(name);
+				if (it == attributes.end())
+					return false;
+				*out = GetGltfAccessor(doc, it->get<size_t>());
+				if (out->mCount != vertexCount)
+					throw std::runtime_error(std::string("glTF attribute ") + name + " has the wrong count!");
+				return true;
+			};
+
+			GltfAccessor normalAccessor;
+			GltfAccessor uvAccessor;
+			GltfAccessor tangentAccessor;
+			bool bHasNormals = findAttribute("NORMAL", &normalAccessor);
+			bool bHasUVs = findAttribute("TEXCOORD_0", &uvAccessor);
+			bool bHasTangents = findAttribute("TANGENT", &tangentAccessor) &&
+				tangentAccessor.mComponents == 4;
+
+			std::vector<uint8_t> indexData;
+			ReadGltfIndices(doc, primitive, vertexCount, &indexData);
+			size_t indexCount = indexData.size() / sizeof(uint32_t);
+			auto indices = reinterpret_cast<const uint32_t*>(indexData.data());
+
+			auto& layout = params.mVertexLayout;
+
+			bool bWantNormals = layout.mNormal >= 0;
+			bool bWantTangents = layout.mTangent >= 0;
+			bool bWantBitangents = layout.mBitangent >= 0;
+
+			bool bGenerateNormals = !bHasNormals && (bWantNormals || bWantTangents || bWantBitangents);
+			bool bGenerateTangents = !bHasTangents && (bWantTangents || bWantBitangents);
+
+			// Derived attributes are computed on float copies in engine space,
+			// everything else is written straight from the buffer views
+			std::vector<float> positions;
+			std::vector<float> normals;
+			std::vector<float> tangents;
+			std::vector<float> bitangents;
+
+			if (bGenerateNormals || bGenerateTangents)
+				positions = ReadGltfFloats(positionAccessor, 3, true);
+
+			if (bGenerateNormals) {
+				std::vector<uint32_t> positionIds(vertexCount);
+				for (size_t i = 0; i < vertexCount; ++i)
+					positionIds[i] = static_cast<uint32_t>(i);
+
+				normals.resize(vertexCount * 3);
+				GenerateSmoothNormals(vertexCount, indexCount, indices,
+					positions.data(), positionIds.data(), normals.data());
+			} else if (bGenerateTangents || bWantBitangents) {
+				normals = ReadGltfFloats(normalAccessor, 3, true);
+			}
+
+			if (bGenerateTangents) {
+				std::vector<float> uvs;
+				if (bHasUVs)
+					uvs = ReadGltfFloats(uvAccessor, 2, false);
+
+				tangents.resize(vertexCount * 3);
+				bitangents.resize(vertexCount * 3);
+				GenerateTangents(vertexCount, indexCount, indices,
+					positions.data(), normals.data(),
+					bHasUVs ? uvs.data() : nullptr,
+					tangents.data(), bitangents.data());
+			} else if (bWantBitangents) {
+				// Mirroring z flips the handedness of cross(normal, tangent)
+				auto tangent4 = ReadGltfFloats(tangentAccessor, 4, true);
+				bitangents.resize(vertexCount * 3);
+				for (size_t i = 0; i < vertexCount; ++i) {
+					DG::float3 n(normals[3 * i], normals[3 * i + 1], normals[3 * i + 2]);
+					DG::float3 t(tangent4[4 * i], tangent4[4 * i + 1], tangent4[4 * i + 2]);
+					DG::float3 b = DG::cross(n, t) * -tangent4[4 * i + 3];
+					bitangents[3 * i] = b.x;
+					bitangents[3 * i + 1] = b.y;
+					bitangents[3 * i + 2] = b.z;
+				}
+			}
+
+			std::vector<size_t> offsets;
+			std::vector<size_t> strides;
+			std::vector<size_t> channelSizes;
+			ComputeLayoutProperties(vertexCount, layout, offsets, strides, channelSizes);
+
+			std::vector<std::vector<uint8_t>> vertexBuffers(channelSizes.size());
+			for (size_t i = 0; i < channelSizes.size(); ++i)
+				vertexBuffers[i].resize(channelSizes[i]);
+
+			auto write = [&](int attrib, const char* name, int components, bool bNegateZ,
+				const GltfAccessor* source) {
+				if (attrib < 0)
+					return;
+
+				auto& element = layout.mElements[attrib];
+				if (element.ValueType != DG::VT_FLOAT32)
+					throw std::runtime_error("Attribute type must be VT_FLOAT32!");
+
+				if (!source) {
+					// Channels are zero initialized
+					std::cout << "Warning: Pipeline expects " << name << ", but model has none!" << std::endl;
+					return;
+				}
+
+				int count = std::min<int>(components, element.NumComponents);
+				WriteGltfAttribute(*source, count, bNegateZ,
+					&vertexBuffers[element.BufferSlot][offsets[attrib]], strides[attrib]);
+			};
+
+			// Attributes still in glTF space come straight from the buffer views
+			auto normalSource = normals.empty() ? normalAccessor : MakeFloatAccessor(normals, 3);
+			auto tangentSource = tangents.empty() ? tangentAccessor : MakeFloatAccessor(tangents, 3);
+			auto bitangentSource = MakeFloatAccessor(bitangents, 3);
+
+			write(layout.mPosition, "positions", 3, true, &positionAccessor);
+			write(layout.mUV, "UVs", 2, false, bHasUVs ? &uvAccessor : nullptr);
+			write(layout.mNormal, "normals", 3, normals.empty(), &normalSource);
+			write(layout.mTangent, "tangents", 3, tangents.empty(), &tangentSource);
+			write(layout.mBitangent, "bitangents", 3, false, &bitangentSource);
+
+			auto aabb = GltfPositionBounds(doc.mJson.at("accessors").at(positionIt->get<size_t>()),
+				positions, positionAccessor);
+
+			std::vector<DG::BufferDesc> bufferDescs;
+			for (auto& buffer : vertexBuffers) {
+				DG::BufferDesc vertexBufferDesc;
+				vertexBufferDesc.Usage         = DG::USAGE_IMMUTABLE;
+				vertexBufferDesc.BindFlags     = DG::BIND_VERTEX_BUFFER;
+				vertexBufferDesc.uiSizeInBytes = buffer.size();
+				bufferDescs.emplace_back(vertexBufferDesc);
+			}
+
+			DG::BufferDesc indexBufferDesc;
+			indexBufferDesc.Usage 			= DG::USAGE_IMMUTABLE;
+			indexBufferDesc.BindFlags 		= DG::BIND_INDEX_BUFFER;
+			indexBufferDesc.uiSizeInBytes 	= indexData.size();
+
+			DG::DrawIndexedAttribs indexedAttribs;
+			indexedAttribs.IndexType 	= DG::VT_UINT32;
+			indexedAttribs.NumIndices 	= indexCount;
+
+			Set(layout,
+				std::move(bufferDescs),
+				indexBufferDesc,
+				std::move(vertexBuffers),
+				std::move(indexData),
+				indexedAttribs, aabb);
+		},
+		std::string("Load Raw Geometry ") + params.mSource + " (glTF)",
+		TaskType::FILE_IO);
+
+		return task;
+	}
+
+	Future<Texture*> LoadGltfTexture(const GltfDocument& doc, const nlohmann::json& textureInfo,
+		bool bIsSRGB, IResourceCache<Texture>* cache, ITaskQueue* queue) {
+		auto& texture = doc.mJson.at("textures").at(textureInfo.at("index").get<size_t>());
+
+		auto sourceIt = texture.find("source");
+		if (sourceIt == texture.end())
+			return Future<Texture*>();
+
+		auto& image = doc.mJson.at("images").at(sourceIt->get<size_t>());
+		auto uriIt = image.find("uri");
+		if (uriIt == image.end())
+			return Future<Texture*>();
+
+		auto uri = uriIt->get<std::string>();
+		if (uri.rfind("data:", 0) == 0)
+			return Future<Texture*>();
+
+		return cache->Load(LoadParams<Texture>(doc.mDirectory + uri, bIsSRGB), queue);
+	}
+
+	MaterialDescFuture LoadGltfMaterial(const std::string& source,
+		IResourceCache<Texture>* cache,
+		ITaskQueue* queue) {
+		GltfDocument doc;
+		ReadGltfDocument(source, &doc, false);
+
+		MaterialDescFuture result;
+		result.mType = MaterialType::COOK_TORRENCE;
+
+		auto& primitive = doc.mJson.at("meshes").at(0).at("primitives").at(0);
+		auto materialIt = primitive.find("material");
+		if (materialIt == primitive.end())
+			return result;
+
+		auto& material = doc.mJson.at("materials").at(materialIt->get<size_t>());
+
+		auto pbrIt = material.find("pbrMetallicRoughness");
+		if (pbrIt != material.end()) {
+			auto& pbr = *pbrIt;
+
+			auto factorIt = pbr.find("baseColorFactor");
+			if (factorIt != pbr.end() && factorIt->size() == 4) {
+				result.mAlbedoFactor = DG::float4(
+					(*factorIt)[0].get<float>(),
+					(*factorIt)[1].get<float>(),
+					(*factorIt)[2].get<float>(),
+					(*factorIt)[3].get<float>());
+			}
+
+			result.mRoughnessFactor = pbr.value("roughnessFactor", 1.0f);
+			result.mMetallicFactor = pbr.value("metallicFactor", 1.0f);
+
+			auto albedoIt = pbr.find("baseColorTexture");
+			if (albedoIt != pbr.end())
+				result.mAlbedo = LoadGltfTexture(doc, *albedoIt, true, cache, queue);
+
+			// Roughness is in green and metallic in blue of the same texture.
+			// The factors above scale it, so it must not be left out.
+			auto metallicRoughnessIt = pbr.find("metallicRoughnessTexture");
+			if (metallicRoughnessIt != pbr.end()) {
+				auto texture = LoadGltfTexture(doc, *metallicRoughnessIt, false, cache, queue);
+
+				if (texture) {
+					result.mRoughness = texture;
+					result.mMetallic = texture;
+					result.mRoughnessChannel = 1;
+					result.mMetallicChannel = 2;
+				} else {
+					// Embedded images cannot be loaded. Scale the factors by a
+					// stand-in texel, rather than a fully rough, fully metallic one.
+					result.mRoughnessFactor *= GLTF_FALLBACK_ROUGHNESS;
+					result.mMetallicFactor *= GLTF_FALLBACK_METALLIC;
+				}
+			}
+		}
+
+		auto normalIt = material.find("normalTexture");
+		if (normalIt != material.end())
+			result.mNormal = LoadGltfTexture(doc, *normalIt, false, cache, queue);
+
+		return result;
+	}
+}
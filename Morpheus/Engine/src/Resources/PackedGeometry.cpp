@@ -0,0 +1,213 @@
+#include <Engine/Resources/PackedGeometry.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+
+#include <fstream>
+#include <cmath>
+
+namespace Morpheus {
+
+	inline uint16_t QuantizeUnorm16(float x, float lower, float upper) {
+		float range = upper - lower;
+		float t = range > 0.0f ? (x - lower) / range : 0.0f;
+		t = std::min(std::max(t, 0.0f), 1.0f);
+		return static_cast<uint16_t>(std::lround(t * 65535.0f));
+	}
+
+	inline float DequantizeUnorm16(uint16_t q, float lower, float upper) {
+		return lower + (upper - lower) * (static_cast<float>(q) / 65535.0f);
+	}
+
+	inline int16_t QuantizeSnorm16(float x) {
+		x = std::min(std::max(x, -1.0f), 1.0f);
+		return static_cast<int16_t>(std::lround(x * 32767.0f));
+	}
+
+	inline float SignNotZero(float x) {
+		return x >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	// Octahedral encoding of a direction, see Cigolle et al. 2014
+	void EncodeOctahedral(const float v[], int16_t out[]) {
+		float l1 = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+
+		float x = 0.0f;
+		float y = 0.0f;
+
+		if (l1 > 0.0f) {
+			x = v[0] / l1;
+			y = v[1] / l1;
+
+			if (v[2] < 0.0f) {
+				float ox = x;
+				x = (1.0f - std::abs(y)) * SignNotZero(ox);
+				y = (1.0f - std::abs(ox)) * SignNotZero(y);
+			}
+		}
+
+		out[0] = QuantizeSnorm16(x);
+		out[1] = QuantizeSnorm16(y);
+	}
+
+	void DecodeOctahedral(const int16_t in[], float out[]) {
+		float x = static_cast<float>(in[0]) / 32767.0f;
+		float y = static_cast<float>(in[1]) / 32767.0f;
+		float z = 1.0f - std::abs(x) - std::abs(y);
+
+		float t = std::max(-z, 0.0f);
+		x += x >= 0.0f ? -t : t;
+		y += y >= 0.0f ? -t : t;
+
+		float length = std::sqrt(x * x + y * y + z * z);
+		out[0] = x / length;
+		out[1] = y / length;
+		out[2] = z / length;
+	}
+
+	void PackOctahedral(size_t vertexCount, const float src[], std::vector<int16_t>* dest) {
+		dest->clear();
+		if (!src)
+			return;
+
+		dest->resize(vertexCount * 2);
+		for (size_t i = 0; i < vertexCount; ++i)
+			EncodeOctahedral(&src[3 * i], &(*dest)[2 * i]);
+	}
+
+	const float* UnpackOctahedral(size_t vertexCount, const std::vector<int16_t>& src,
+		std::vector<float>* dest) {
+		if (src.empty())
+			return nullptr;
+
+		dest->resize(vertexCount * 3);
+		for (size_t i = 0; i < vertexCount; ++i)
+			DecodeOctahedral(&src[2 * i], &(*dest)[3 * i]);
+		return dest->data();
+	}
+
+	void PackedGeometry::Pack(size_t vertexCount,
+		size_t indexCount,
+		const uint32_t indices[],
+		const float positions[],
+		const float uvs[],
+		const float normals[],
+		const float tangents[],
+		const float bitangents[]) {
+
+		mVertexCount = static_cast<uint32_t>(vertexCount);
+		mIndexCount = static_cast<uint32_t>(indexCount);
+
+		mPositionBounds = BoundingBox::Empty();
+		mPositions.clear();
+		if (positions) {
+			for (size_t i = 0; i < vertexCount; ++i)
+				mPositionBounds.Grow(DG::float3(
+					positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]));
+
+			auto& lo = mPositionBounds.mLower;
+			auto& hi = mPositionBounds.mUpper;
+
+			mPositions.resize(vertexCount * 3);
+			for (size_t i = 0; i < vertexCount; ++i) {
+				mPositions[3 * i] = QuantizeUnorm16(positions[3 * i], lo.x, hi.x);
+				mPositions[3 * i + 1] = QuantizeUnorm16(positions[3 * i + 1], lo.y, hi.y);
+				mPositions[3 * i + 2] = QuantizeUnorm16(positions[3 * i + 2], lo.z, hi.z);
+			}
+		} else {
+			mPositionBounds = BoundingBox{DG::float3(0.0f, 0.0f, 0.0f), DG::float3(0.0f, 0.0f, 0.0f)};
+		}
+
+		mUVLower = DG::float2(0.0f, 0.0f);
+		mUVUpper = DG::float2(0.0f, 0.0f);
+		mUVs.clear();
+		if (uvs && vertexCount > 0) {
+			mUVLower = DG::float2(uvs[0], uvs[1]);
+			mUVUpper = mUVLower;
+			for (size_t i = 0; i < vertexCount; ++i) {
+				mUVLower = DG::min(mUVLower, DG::float2(uvs[2 * i], uvs[2 * i + 1]));
+				mUVUpper = DG::max(mUVUpper, DG::float2(uvs[2 * i], uvs[2 * i + 1]));
+			}
+
+			mUVs.resize(vertexCount * 2);
+			for (size_t i = 0; i < vertexCount; ++i) {
+				mUVs[2 * i] = QuantizeUnorm16(uvs[2 * i], mUVLower.x, mUVUpper.x);
+				mUVs[2 * i + 1] = QuantizeUnorm16(uvs[2 * i + 1], mUVLower.y, mUVUpper.y);
+			}
+		}
+
+		PackOctahedral(vertexCount, normals, &mNormals);
+		PackOctahedral(vertexCount, tangents, &mTangents);
+		PackOctahedral(vertexCount, bitangents, &mBitangents);
+
+		if (indices)
+			mIndices.assign(indices, indices + indexCount);
+		else
+			mIndices.clear();
+	}
+
+	void PackedGeometry::Unpack(const VertexLayout& layout, Geometry* geometry) const {
+		std::vector<float> positions;
+		std::vector<float> uvs;
+		std::vector<float> normals;
+		std::vector<float> tangents;
+		std::vector<float> bitangents;
+
+		const float* positionsPtr = nullptr;
+		const float* uvsPtr = nullptr;
+
+		if (!mPositions.empty()) {
+			auto& lo = mPositionBounds.mLower;
+			auto& hi = mPositionBounds.mUpper;
+
+			positions.resize(mVertexCount * 3);
+			for (size_t i = 0; i < mVertexCount; ++i) {
+				positions[3 * i] = DequantizeUnorm16(mPositions[3 * i], lo.x, hi.x);
+				positions[3 * i + 1] = DequantizeUnorm16(mPositions[3 * i + 1], lo.y, hi.y);
+				positions[3 * i + 2] = DequantizeUnorm16(mPositions[3 * i + 2], lo.z, hi.z);
+			}
+			positionsPtr = positions.data();
+		}
+
+		if (!mUVs.empty()) {
+			uvs.resize(mVertexCount * 2);
+			for (size_t i = 0; i < mVertexCount; ++i) {
+				uvs[2 * i] = DequantizeUnorm16(mUVs[2 * i], mUVLower.x, mUVUpper.x);
+				uvs[2 * i + 1] = DequantizeUnorm16(mUVs[2 * i + 1], mUVLower.y, mUVUpper.y);
+			}
+			uvsPtr = uvs.data();
+		}
+
+		auto normalsPtr = UnpackOctahedral(mVertexCount, mNormals, &normals);
+		auto tangentsPtr = UnpackOctahedral(mVertexCount, mTangents, &tangents);
+		auto bitangentsPtr = UnpackOctahedral(mVertexCount, mBitangents, &bitangents);
+
+		geometry->FromMemory(layout,
+			mVertexCount,
+			mIndices.empty() ? 0 : mIndexCount,
+			mIndices.empty() ? nullptr : mIndices.data(),
+			positionsPtr,
+			uvsPtr,
+			normalsPtr,
+			tangentsPtr,
+			bitangentsPtr);
+	}
+
+	Task PackedGeometry::SaveTask(const std::string& path) const {
+		return Task([this, path](const TaskParams& e) {
+			std::ofstream f(path, std::ios::binary);
+
+			if (f.is_open()) {
+				cereal::PortableBinaryOutputArchive ar(f);
+				Morpheus::Save(ar, this);
+				f.close();
+			} else {
+				throw std::runtime_error("Could not open file for writing!");
+			}
+		}, std::string("Save Packed Geometry ") + path + " (Archive)", TaskType::FILE_IO);
+	}
+
+	void PackedGeometry::ReadArchive(const uint8_t* rawArchive, const size_t length) {
+		MemoryInputStream stream(rawArchive, length);
+		cereal::PortableBinaryInputArchive ar(stream);
+		Morpheus::Load(ar, this);
+	}
+}
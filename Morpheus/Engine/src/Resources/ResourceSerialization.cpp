@@ -2,6 +2,8 @@
 #include <Engine/Resources/Texture.hpp>
 #include <Engine/Resources/ResourceData.hpp>
 #include <Engine/Renderer.hpp>
+#include <Engine/GeometryBVH.hpp>
+#include <Engine/Resources/PackedGeometry.hpp>
 
 #include <cereal/types/vector.hpp>
 
@@ -130,6 +132,14 @@ namespace Morpheus {
 		archive(box.mUpper);
 	}
 
+	template<class Archive>
+	void serialize(Archive& archive,
+		BVHNode& node) {
+		archive(node.mBounds);
+		archive(node.mOffset);
+		archive(node.mCount);
+	}
+
 	bool IsLittleEndian() {
 		int n = 1;
 		// little endian if true
@@ -312,4 +322,95 @@ namespace Morpheus {
 
 		SaveBinaryData(ar, valueType, &texture->GetData());
 	}
+
+	void Load(cereal::PortableBinaryInputArchive& ar, GeometryBVH* bvh) {
+		std::vector<BVHNode> nodes;
+		std::vector<DG::float3> positions;
+		std::vector<uint32_t> indices;
+		std::vector<uint32_t> triangles;
+
+		uint version;
+
+		ar(version);
+
+		if (version != BVH_ARCHIVE_VERSION)
+			throw std::runtime_error("BVH archive version mismatch!");
+
+		ar(nodes);
+		ar(positions);
+		ar(indices);
+		ar(triangles);
+
+		bvh->Set(std::move(nodes), 
+			std::move(positions),
+			std::move(indices),
+			std::move(triangles));
+	}
+
+	void Save(cereal::PortableBinaryOutputArchive& ar, const GeometryBVH* bvh) {
+		uint version = BVH_ARCHIVE_VERSION;
+
+		ar(version);
+		ar(bvh->GetNodes());
+		ar(bvh->GetPositions());
+		ar(bvh->GetIndices());
+		ar(bvh->GetTriangles());
+	}
+
+	void Load(cereal::PortableBinaryInputArchive& ar, PackedGeometry* geometry) {
+		uint version;
+
+		ar(version);
+
+		if (version != PACKED_GEOMETRY_ARCHIVE_VERSION)
+			throw std::runtime_error("Packed geometry archive version mismatch!");
+
+		ar(geometry->mVertexCount);
+		ar(geometry->mIndexCount);
+		ar(geometry->mPositionBounds);
+		ar(geometry->mUVLower);
+		ar(geometry->mUVUpper);
+		ar(geometry->mPositions);
+		ar(geometry->mUVs);
+		ar(geometry->mNormals);
+		ar(geometry->mTangents);
+		ar(geometry->mBitangents);
+
+		bool bShortIndices;
+		ar(bShortIndices);
+
+		if (bShortIndices) {
+			std::vector<uint16_t> indices;
+			ar(indices);
+			geometry->mIndices.assign(indices.begin(), indices.end());
+		} else {
+			ar(geometry->mIndices);
+		}
+	}
+
+	void Save(cereal::PortableBinaryOutputArchive& ar, const PackedGeometry* geometry) {
+		uint version = PACKED_GEOMETRY_ARCHIVE_VERSION;
+
+		ar(version);
+		ar(geometry->mVertexCount);
+		ar(geometry->mIndexCount);
+		ar(geometry->mPositionBounds);
+		ar(geometry->mUVLower);
+		ar(geometry->mUVUpper);
+		ar(geometry->mPositions);
+		ar(geometry->mUVs);
+		ar(geometry->mNormals);
+		ar(geometry->mTangents);
+		ar(geometry->mBitangents);
+
+		bool bShortIndices = geometry->mVertexCount <= std::numeric_limits<uint16_t>::max() + 1;
+		ar(bShortIndices);
+
+		if (bShortIndices) {
+			std::vector<uint16_t> indices(geometry->mIndices.begin(), geometry->mIndices.end());
+			ar(indices);
+		} else {
+			ar(geometry->mIndices);
+		}
+	}
 }
\ No newline at end of file
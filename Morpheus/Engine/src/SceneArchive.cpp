@@ -0,0 +1,535 @@
+#include <Engine/SceneArchive.hpp>
+#include <Engine/RegistrySnapshot.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+#include <Engine/Components/Transform.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+
+#include <cereal/types/string.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+namespace Morpheus {
+	constexpr uint32_t NullSceneIndex = std::numeric_limits<uint32_t>::max();
+
+	// Maps the entities of a registry to their position in the archive
+	class SceneIndexMap {
+	private:
+		std::vector<uint32_t> mIndices;
+
+		static inline size_t Slot(entt::entity e) {
+			return entt::to_integral(entt::registry::entity(e));
+		}
+
+	public:
+		SceneIndexMap(const entt::entity* entities, size_t count) {
+			for (size_t i = 0; i < count; ++i) {
+				auto slot = Slot(entities[i]);
+				if (slot >= mIndices.size())
+					mIndices.resize(slot + 1, NullSceneIndex);
+				mIndices[slot] = (uint32_t)i;
+			}
+		}
+
+		inline uint32_t operator()(entt::entity e) const {
+			if (e == entt::null)
+				return NullSceneIndex;
+			auto slot = Slot(e);
+			return slot < mIndices.size() ? mIndices[slot] : NullSceneIndex;
+		}
+	};
+
+	template <typename T>
+	void WriteColumn(cereal::PortableBinaryOutputArchive& ar, const std::vector<T>& column) {
+		ar(cereal::binary_data(column.data(), column.size() * sizeof(T)));
+	}
+
+	template <typename T>
+	void ReadColumn(cereal::PortableBinaryInputArchive& ar, std::vector<T>* column, size_t count) {
+		column->resize(count);
+		ar(cereal::binary_data(column->data(), count * sizeof(T)));
+	}
+
+	// Writes the position of every entity that is part of the archive, and
+	// returns the rows of the pool they were found in
+	std::vector<size_t> WriteIndexColumn(cereal::PortableBinaryOutputArchive& ar,
+		const SceneIndexMap& indexMap,
+		const entt::entity* entities,
+		size_t count) {
+		std::vector<uint32_t> indices;
+		std::vector<size_t> rows;
+		indices.reserve(count);
+		rows.reserve(count);
+
+		for (size_t i = 0; i < count; ++i) {
+			auto index = indexMap(entities[i]);
+			if (index != NullSceneIndex) {
+				indices.emplace_back(index);
+				rows.emplace_back(i);
+			}
+		}
+
+		ar((uint64_t)indices.size());
+		WriteColumn(ar, indices);
+		return rows;
+	}
+
+	void SceneArchive::SaveEntities(const Frame& frame,
+		const entt::entity* entities,
+		size_t count,
+		entt::entity root,
+		std::ostream& stream,
+		const geometry_key_func_t& geometryKeys) {
+		auto& registry = frame.mRegistry;
+		cereal::PortableBinaryOutputArchive ar(stream);
+
+		auto hierarchyView = registry.view<const HierarchyData>();
+		auto transformView = registry.view<const Transform>();
+		auto meshView = registry.view<const StaticMeshComponent>();
+
+		// Links to anything outside of entities are stored as null
+		SceneIndexMap indexMap(entities, count);
+
+		if (indexMap(root) == NullSceneIndex)
+			throw std::runtime_error("Scene root is not part of the archive!");
+
+		uint version = SCENE_ARCHIVE_VERSION;
+		ar(version);
+		ar((uint64_t)count);
+		ar(indexMap(root));
+		ar(indexMap(frame.mCamera));
+
+		// Geometry keys go first, so the loader can start on them right away
+		std::unordered_map<const Geometry*, uint32_t> geometryIndices;
+		std::vector<LoadParams<Geometry>> keys;
+		for (auto e : meshView) {
+			if (indexMap(e) == NullSceneIndex)
+				continue;
+
+			auto geometry = meshView.get<const StaticMeshComponent>(e).mGeometry.Ptr();
+			if (!geometry || geometryIndices.find(geometry) != geometryIndices.end())
+				continue;
+
+			LoadParams<Geometry> params;
+			if (!geometryKeys || !geometryKeys(geometry, &params))
+				throw std::runtime_error("Static mesh geometry has no asset key!");
+
+			geometryIndices[geometry] = (uint32_t)keys.size();
+			keys.emplace_back(std::move(params));
+		}
+
+		ar(SceneBlockType::GEOMETRY_KEYS);
+		ar((uint64_t)keys.size());
+		for (auto& key : keys) {
+			ar(key.mSource);
+			ar((uint32_t)key.mType);
+		}
+
+		// Hierarchy links, one column per link
+		{
+			std::vector<uint32_t> columns[5];
+			for (auto& column : columns)
+				column.reserve(count);
+
+			for (size_t i = 0; i < count; ++i) {
+				auto& data = hierarchyView.get<const HierarchyData>(entities[i]);
+				columns[0].emplace_back(indexMap(data.mParent));
+				columns[1].emplace_back(indexMap(data.mPrevious));
+				columns[2].emplace_back(indexMap(data.mNext));
+				columns[3].emplace_back(indexMap(data.mFirstChild));
+				columns[4].emplace_back(indexMap(data.mLastChild));
+			}
+
+			ar(SceneBlockType::HIERARCHY);
+			for (auto& column : columns)
+				WriteColumn(ar, column);
+		}
+
+		{
+			ar(SceneBlockType::TRANSFORMS);
+			auto transformEntities = transformView.data();
+			auto rows = WriteIndexColumn(ar, indexMap, transformEntities, transformView.size());
+
+			std::vector<float> translations, rotations, scales;
+			translations.reserve(rows.size() * 3);
+			rotations.reserve(rows.size() * 4);
+			scales.reserve(rows.size() * 3);
+
+			for (auto row : rows) {
+				auto& transform = transformView.get<const Transform>(transformEntities[row]);
+				auto translation = transform.GetTranslation();
+				auto rotation = transform.GetRotation();
+				auto scale = transform.GetScale();
+
+				translations.insert(translations.end(), {translation.x, translation.y, translation.z});
+				rotations.insert(rotations.end(), {rotation.q.x, rotation.q.y, rotation.q.z, rotation.q.w});
+				scales.insert(scales.end(), {scale.x, scale.y, scale.z});
+			}
+
+			WriteColumn(ar, translations);
+			WriteColumn(ar, rotations);
+			WriteColumn(ar, scales);
+		}
+
+		// Every other registered component that can be copied as bytes
+		registry.visit([&](const entt::type_info info) {
+			if (info == entt::type_id<HierarchyData>() ||
+				info == entt::type_id<Transform>() ||
+				info == entt::type_id<StaticMeshComponent>() ||
+				info == entt::type_id<RendererTransformCache>())
+				return;
+
+			auto hooks = RegistrySnapshot::FindHooks(info.hash());
+			if (!hooks || !hooks->bTrivial)
+				return;
+
+			auto&& storage = registry.storage(info);
+			if (storage->size() == 0)
+				return;
+
+			ar(SceneBlockType::COMPONENT);
+			ar((uint32_t)info.hash());
+			ar((uint64_t)hooks->mSize);
+			auto rows = WriteIndexColumn(ar, indexMap, storage->data(), storage->size());
+
+			auto raw = static_cast<const uint8_t*>(storage->raw());
+			std::vector<uint8_t> bytes(rows.size() * hooks->mSize);
+			for (size_t i = 0; i < rows.size(); ++i)
+				std::memcpy(&bytes[i * hooks->mSize], &raw[rows[i] * hooks->mSize], hooks->mSize);
+			WriteColumn(ar, bytes);
+		});
+
+		// Static meshes go last, so their geometry has as long as possible to load
+		{
+			ar(SceneBlockType::STATIC_MESHES);
+			auto meshEntities = meshView.data();
+			auto rows = WriteIndexColumn(ar, indexMap, meshEntities, meshView.size());
+
+			std::vector<uint32_t> geometry;
+			geometry.reserve(rows.size());
+			for (auto row : rows) {
+				auto ptr = meshView.get<const StaticMeshComponent>(meshEntities[row]).mGeometry.Ptr();
+				geometry.emplace_back(ptr ? geometryIndices[ptr] : NullSceneIndex);
+			}
+			WriteColumn(ar, geometry);
+		}
+
+		ar(SceneBlockType::END);
+	}
+
+	void SceneArchive::Save(const Frame& frame,
+		std::ostream& stream,
+		const geometry_key_func_t& geometryKeys) {
+		auto hierarchyView = frame.mRegistry.view<const HierarchyData>();
+		SaveEntities(frame, hierarchyView.data(), hierarchyView.size(),
+			frame.mRoot, stream, geometryKeys);
+	}
+
+	void SceneArchive::Save(const Frame& frame,
+		entt::entity subtree,
+		std::ostream& stream,
+		const geometry_key_func_t& geometryKeys) {
+		auto& registry = frame.mRegistry;
+
+		std::vector<entt::entity> entities;
+		std::vector<entt::entity> stack;
+		stack.emplace_back(subtree);
+
+		while (!stack.empty()) {
+			auto e = stack.back();
+			stack.pop_back();
+			entities.emplace_back(e);
+
+			for (auto child = registry.get<HierarchyData>(e).mFirstChild;
+				child != entt::null;
+				child = registry.get<HierarchyData>(child).mNext)
+				stack.emplace_back(child);
+		}
+
+		SaveEntities(frame, entities.data(), entities.size(), subtree, stream, geometryKeys);
+	}
+
+	void SceneArchive::Save(const Frame& frame,
+		const std::string& path,
+		const geometry_key_func_t& geometryKeys) {
+		std::ofstream f(path, std::ios::binary);
+
+		if (!f.is_open())
+			throw std::runtime_error("Could not open file for writing!");
+
+		Save(frame, f, geometryKeys);
+		f.close();
+	}
+
+	void SceneArchive::Save(const Frame& frame,
+		entt::entity subtree,
+		const std::string& path,
+		const geometry_key_func_t& geometryKeys) {
+		std::ofstream f(path, std::ios::binary);
+
+		if (!f.is_open())
+			throw std::runtime_error("Could not open file for writing!");
+
+		Save(frame, subtree, f, geometryKeys);
+		f.close();
+	}
+
+	bool SceneData::IsGeometryAvailable() const {
+		for (auto& future : mGeometry) {
+			if (!future.IsAvailable())
+				return false;
+		}
+		return true;
+	}
+
+	void SceneArchive::Read(std::istream& stream,
+		IResourceCache<Geometry>* geometryCache,
+		ITaskQueue* queue,
+		SceneData* data) {
+		cereal::PortableBinaryInputArchive ar(stream);
+
+		uint version;
+		ar(version);
+
+		if (version != SCENE_ARCHIVE_VERSION)
+			throw std::runtime_error("Scene archive version mismatch!");
+
+		ar(data->mEntityCount);
+		ar(data->mRoot);
+		ar(data->mCamera);
+
+		auto readIndexColumn = [&ar, data](std::vector<uint32_t>* indices) {
+			uint64_t blockCount;
+			ar(blockCount);
+			ReadColumn(ar, indices, blockCount);
+
+			for (auto index : *indices) {
+				if (index >= data->mEntityCount)
+					throw std::runtime_error("Scene archive references an entity that does not exist!");
+			}
+			return blockCount;
+		};
+
+		bool bHierarchy = false;
+
+		SceneBlockType block;
+		ar(block);
+
+		// Each block is decoded as it is read, the file is never resident as a whole
+		for (; block != SceneBlockType::END; ar(block)) {
+			switch (block) {
+				case SceneBlockType::GEOMETRY_KEYS:
+				{
+					uint64_t keyCount;
+					ar(keyCount);
+
+					if (keyCount > 0 && !geometryCache)
+						throw std::runtime_error("Scene has static meshes, but no geometry cache was given!");
+
+					// Start every load now, they finish while the rest is read
+					data->mGeometry.reserve(keyCount);
+					for (uint64_t i = 0; i < keyCount; ++i) {
+						LoadParams<Geometry> params;
+						uint32_t type;
+						ar(params.mSource);
+						ar(type);
+						params.mType = (GeometryType)type;
+						data->mGeometry.emplace_back(geometryCache->Load(params, queue));
+					}
+					break;
+				}
+
+				case SceneBlockType::HIERARCHY:
+				{
+					for (auto& column : data->mHierarchy) {
+						ReadColumn(ar, &column, data->mEntityCount);
+
+						for (auto index : column) {
+							if (index != NullSceneIndex && index >= data->mEntityCount)
+								throw std::runtime_error("Scene archive references an entity that does not exist!");
+						}
+					}
+					bHierarchy = true;
+					break;
+				}
+
+				case SceneBlockType::TRANSFORMS:
+				{
+					auto blockCount = readIndexColumn(&data->mTransformIndices);
+
+					std::vector<float> translations, rotations, scales;
+					ReadColumn(ar, &translations, blockCount * 3);
+					ReadColumn(ar, &rotations, blockCount * 4);
+					ReadColumn(ar, &scales, blockCount * 3);
+
+					data->mTransforms.reserve(blockCount);
+					for (size_t i = 0; i < blockCount; ++i) {
+						auto t = &translations[i * 3];
+						auto r = &rotations[i * 4];
+						auto s = &scales[i * 3];
+						data->mTransforms.emplace_back(DG::float3(t[0], t[1], t[2]),
+							DG::Quaternion(r[0], r[1], r[2], r[3]),
+							DG::float3(s[0], s[1], s[2]));
+					}
+					break;
+				}
+
+				case SceneBlockType::STATIC_MESHES:
+				{
+					auto blockCount = readIndexColumn(&data->mMeshIndices);
+					ReadColumn(ar, &data->mMeshGeometry, blockCount);
+
+					for (auto index : data->mMeshGeometry) {
+						if (index != NullSceneIndex && index >= data->mGeometry.size())
+							throw std::runtime_error("Scene archive references geometry that does not exist!");
+					}
+					break;
+				}
+
+				case SceneBlockType::COMPONENT:
+				{
+					uint32_t type;
+					uint64_t size;
+					ar(type);
+					ar(size);
+
+					SceneComponentColumn column;
+					auto blockCount = readIndexColumn(&column.mIndices);
+					ReadColumn(ar, &column.mData,
+						(size * blockCount + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+
+					// Components that are no longer registered are dropped
+					column.mHooks = RegistrySnapshot::FindHooks(type);
+					if (!column.mHooks)
+						break;
+
+					if (!column.mHooks->bTrivial || column.mHooks->mSize != size)
+						throw std::runtime_error("Component " + std::string(column.mHooks->mType.name()) +
+							" does not match the scene archive!");
+
+					data->mComponents.emplace_back(std::move(column));
+					break;
+				}
+
+				default:
+					throw std::runtime_error("Unknown scene archive block!");
+			}
+		}
+
+		// Instantiate reads a parent, siblings and children for every entity
+		if (!bHierarchy)
+			throw std::runtime_error("Scene archive has no hierarchy!");
+
+		if (data->mRoot >= data->mEntityCount)
+			throw std::runtime_error("Scene archive has no root!");
+
+		if (data->mCamera != NullSceneIndex && data->mCamera >= data->mEntityCount)
+			throw std::runtime_error("Scene archive references an entity that does not exist!");
+	}
+
+	entt::entity SceneArchive::Instantiate(Frame* frame,
+		SceneData& data,
+		entt::entity parent,
+		ITaskQueue* queue,
+		entt::entity* cameraOut) {
+		CheckStructuralChange();
+
+		auto& registry = frame->mRegistry;
+
+		std::vector<entt::entity> entities(data.mEntityCount);
+		registry.create(entities.begin(), entities.end());
+
+		auto resolve = [&entities](uint32_t index) {
+			return index == NullSceneIndex ? (entt::entity)entt::null : entities[index];
+		};
+
+		std::vector<entt::entity> blockEntities;
+		auto resolveColumn = [&](const std::vector<uint32_t>& indices) {
+			blockEntities.resize(indices.size());
+			for (size_t i = 0; i < indices.size(); ++i)
+				blockEntities[i] = entities[indices[i]];
+		};
+
+		{
+			auto& columns = data.mHierarchy;
+			std::vector<HierarchyData> hierarchy;
+			hierarchy.reserve(entities.size());
+			for (size_t i = 0; i < entities.size(); ++i) {
+				hierarchy.emplace_back(resolve(columns[0][i]),
+					resolve(columns[1][i]),
+					resolve(columns[2][i]),
+					resolve(columns[3][i]),
+					resolve(columns[4][i]));
+			}
+
+			registry.insert<HierarchyData>(entities.begin(), entities.end(),
+				hierarchy.begin(), hierarchy.end());
+		}
+
+		resolveColumn(data.mTransformIndices);
+		registry.insert<Transform>(blockEntities.begin(), blockEntities.end(),
+			data.mTransforms.begin(), data.mTransforms.end());
+
+		for (auto& column : data.mComponents) {
+			resolveColumn(column.mIndices);
+			column.mHooks->mAssure(registry);
+			registry.storage(column.mHooks->mType)->insert(registry,
+				blockEntities.data(), column.mData.data(), blockEntities.size());
+		}
+
+		// Everything else is in, wait for the geometry
+		std::vector<Handle<Geometry>> geometry;
+		geometry.reserve(data.mGeometry.size());
+		for (auto& future : data.mGeometry) {
+			queue->YieldUntil(future);
+			geometry.emplace_back(future.Get());
+		}
+
+		std::vector<StaticMeshComponent> meshes(data.mMeshIndices.size());
+		for (size_t i = 0; i < meshes.size(); ++i) {
+			auto index = data.mMeshGeometry[i];
+			if (index != NullSceneIndex)
+				meshes[i].mGeometry = geometry[index];
+		}
+
+		resolveColumn(data.mMeshIndices);
+		registry.insert<StaticMeshComponent>(blockEntities.begin(), blockEntities.end(),
+			meshes.begin(), meshes.end());
+
+		auto root = entities[data.mRoot];
+		if (parent != entt::null)
+			HierarchyData::AddChild(registry, parent, root);
+
+		if (cameraOut)
+			*cameraOut = resolve(data.mCamera);
+
+		return root;
+	}
+
+	void SceneArchive::Load(Frame* frame,
+		std::istream& stream,
+		IResourceCache<Geometry>* geometryCache,
+		ITaskQueue* queue) {
+		SceneData data;
+		Read(stream, geometryCache, queue, &data);
+
+		frame->mRegistry.clear();
+		frame->mRoot = Instantiate(frame, data, entt::null, queue, &frame->mCamera);
+	}
+
+	void SceneArchive::Load(Frame* frame,
+		const std::string& path,
+		IResourceCache<Geometry>* geometryCache,
+		ITaskQueue* queue) {
+		std::ifstream f(path, std::ios::binary);
+
+		if (!f.is_open())
+			throw std::runtime_error("Could not open file for reading!");
+
+		Load(frame, f, geometryCache, queue);
+		f.close();
+	}
+}
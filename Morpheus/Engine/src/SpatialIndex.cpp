@@ -0,0 +1,465 @@
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+#include <Engine/Resources/Geometry.hpp>
+
+#include <algorithm>
+
+namespace Morpheus {
+
+	inline bool Encloses(const BoundingBox& outer, const BoundingBox& inner) {
+		return outer.mLower.x <= inner.mLower.x && outer.mUpper.x >= inner.mUpper.x &&
+			outer.mLower.y <= inner.mLower.y && outer.mUpper.y >= inner.mUpper.y &&
+			outer.mLower.z <= inner.mLower.z && outer.mUpper.z >= inner.mUpper.z;
+	}
+
+	inline BoundingBox Union(const BoundingBox& a, const BoundingBox& b) {
+		BoundingBox result = a;
+		result.Grow(b);
+		return result;
+	}
+
+	inline BoundingBox Loosen(const BoundingBox& box) {
+		float margin = SPATIAL_INDEX_MARGIN * DG::length(box.Extents());
+		DG::float3 grow(margin, margin, margin);
+		return BoundingBox{box.mLower - grow, box.mUpper + grow};
+	}
+
+	int32_t SpatialIndex::AllocateNode() {
+		int32_t node;
+		if (mFreeList != Null) {
+			node = mFreeList;
+			mFreeList = mNodes[node].mParent;
+		} else {
+			node = (int32_t)mNodes.size();
+			mNodes.emplace_back();
+		}
+
+		auto& result = mNodes[node];
+		result.mParent = Null;
+		result.mLeft = Null;
+		result.mRight = Null;
+		result.mEntity = entt::null;
+		return node;
+	}
+
+	void SpatialIndex::FreeNode(int32_t node) {
+		mNodes[node].mParent = mFreeList;
+		mNodes[node].mEntity = entt::null;
+		mFreeList = node;
+	}
+
+	void SpatialIndex::Refit(int32_t node) {
+		while (node != Null) {
+			auto& current = mNodes[node];
+			float oldArea = current.mBounds.SurfaceArea();
+			current.mBounds = Union(mNodes[current.mLeft].mBounds, mNodes[current.mRight].mBounds);
+			mInteriorArea += current.mBounds.SurfaceArea() - oldArea;
+			node = current.mParent;
+		}
+	}
+
+	void SpatialIndex::InsertLeaf(int32_t leaf) {
+		if (mRoot == Null) {
+			mRoot = leaf;
+			mNodes[leaf].mParent = Null;
+			return;
+		}
+
+		// Walk down to the sibling that adds the least surface area. Every
+		// node passed on the way grows to contain the leaf, which is the
+		// inherited cost of going deeper.
+		BoundingBox leafBounds = mNodes[leaf].mBounds;
+		int32_t sibling = mRoot;
+
+		while (!mNodes[sibling].IsLeaf()) {
+			auto& node = mNodes[sibling];
+
+			float area = node.mBounds.SurfaceArea();
+			float combinedArea = Union(node.mBounds, leafBounds).SurfaceArea();
+
+			float cost = 2.0f * combinedArea;
+			float inheritance = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](int32_t child) {
+				auto& childNode = mNodes[child];
+				float childCost = Union(childNode.mBounds, leafBounds).SurfaceArea() + inheritance;
+				if (!childNode.IsLeaf())
+					childCost -= childNode.mBounds.SurfaceArea();
+				return childCost;
+			};
+
+			float costLeft = descendCost(node.mLeft);
+			float costRight = descendCost(node.mRight);
+
+			if (cost < costLeft && cost < costRight)
+				break;
+
+			sibling = costLeft < costRight ? node.mLeft : node.mRight;
+		}
+
+		int32_t oldParent = mNodes[sibling].mParent;
+		int32_t newParent = AllocateNode();
+
+		auto& parent = mNodes[newParent];
+		parent.mParent = oldParent;
+		parent.mLeft = sibling;
+		parent.mRight = leaf;
+		parent.mBounds = Union(mNodes[sibling].mBounds, leafBounds);
+		mInteriorArea += parent.mBounds.SurfaceArea();
+
+		if (oldParent != Null) {
+			auto& grand = mNodes[oldParent];
+			if (grand.mLeft == sibling)
+				grand.mLeft = newParent;
+			else
+				grand.mRight = newParent;
+		} else {
+			mRoot = newParent;
+		}
+
+		mNodes[sibling].mParent = newParent;
+		mNodes[leaf].mParent = newParent;
+
+		Refit(oldParent);
+	}
+
+	void SpatialIndex::RemoveLeaf(int32_t leaf) {
+		if (leaf == mRoot) {
+			mRoot = Null;
+			return;
+		}
+
+		int32_t parent = mNodes[leaf].mParent;
+		int32_t grand = mNodes[parent].mParent;
+		int32_t sibling = mNodes[parent].mLeft == leaf ?
+			mNodes[parent].mRight : mNodes[parent].mLeft;
+
+		mInteriorArea -= mNodes[parent].mBounds.SurfaceArea();
+
+		if (grand != Null) {
+			auto& grandNode = mNodes[grand];
+			if (grandNode.mLeft == parent)
+				grandNode.mLeft = sibling;
+			else
+				grandNode.mRight = sibling;
+			mNodes[sibling].mParent = grand;
+		} else {
+			mRoot = sibling;
+			mNodes[sibling].mParent = Null;
+		}
+
+		FreeNode(parent);
+		Refit(grand);
+	}
+
+	void SpatialIndex::Insert(entt::entity entity, const BoundingBox& bounds) {
+		if (Contains(entity)) {
+			Move(entity, bounds);
+			return;
+		}
+
+		int32_t leaf = AllocateNode();
+		mNodes[leaf].mBounds = Loosen(bounds);
+		mNodes[leaf].mEntity = entity;
+		mLeaves[entity] = leaf;
+
+		InsertLeaf(leaf);
+	}
+
+	void SpatialIndex::Remove(entt::entity entity) {
+		auto it = mLeaves.find(entity);
+		if (it == mLeaves.end())
+			return;
+
+		RemoveLeaf(it->second);
+		FreeNode(it->second);
+		mLeaves.erase(it);
+	}
+
+	bool SpatialIndex::Move(entt::entity entity, const BoundingBox& bounds) {
+		auto it = mLeaves.find(entity);
+		if (it == mLeaves.end()) {
+			Insert(entity, bounds);
+			return true;
+		}
+
+		int32_t leaf = it->second;
+		if (Encloses(mNodes[leaf].mBounds, bounds))
+			return false;
+
+		RemoveLeaf(leaf);
+		mNodes[leaf].mBounds = Loosen(bounds);
+		InsertLeaf(leaf);
+
+		++mStats.mReinsertCount;
+		return true;
+	}
+
+	void SpatialIndex::Clear() {
+		mNodes.clear();
+		mLeaves.clear();
+		mRoot = Null;
+		mFreeList = Null;
+		mInteriorArea = 0.0f;
+		mBuildCost = 0.0f;
+	}
+
+	int32_t SpatialIndex::Build(std::vector<int32_t>& leaves, size_t begin, size_t end) {
+		if (end - begin == 1)
+			return leaves[begin];
+
+		BoundingBox centers = BoundingBox::Empty();
+		for (size_t i = begin; i < end; ++i)
+			centers.Grow(mNodes[leaves[i]].mBounds.Center());
+
+		// Median split along the axis the centers are most spread out on
+		DG::float3 extents = centers.Extents();
+		int axis = 0;
+		if (extents.y > extents[axis])
+			axis = 1;
+		if (extents.z > extents[axis])
+			axis = 2;
+
+		size_t mid = (begin + end) / 2;
+		std::nth_element(leaves.begin() + begin, leaves.begin() + mid, leaves.begin() + end,
+			[this, axis](int32_t a, int32_t b) {
+				return mNodes[a].mBounds.Center()[axis] < mNodes[b].mBounds.Center()[axis];
+			});
+
+		int32_t left = Build(leaves, begin, mid);
+		int32_t right = Build(leaves, mid, end);
+		int32_t node = AllocateNode();
+
+		auto& result = mNodes[node];
+		result.mLeft = left;
+		result.mRight = right;
+		result.mBounds = Union(mNodes[left].mBounds, mNodes[right].mBounds);
+		mInteriorArea += result.mBounds.SurfaceArea();
+
+		mNodes[left].mParent = node;
+		mNodes[right].mParent = node;
+		return node;
+	}
+
+	void SpatialIndex::Rebuild() {
+		std::vector<Node> leafNodes;
+		leafNodes.reserve(mLeaves.size());
+		for (auto& it : mLeaves)
+			leafNodes.emplace_back(mNodes[it.second]);
+
+		mNodes.clear();
+		mNodes.reserve(2 * leafNodes.size());
+		mFreeList = Null;
+		mRoot = Null;
+		mInteriorArea = 0.0f;
+
+		std::vector<int32_t> leaves;
+		leaves.reserve(leafNodes.size());
+		for (auto& leafNode : leafNodes) {
+			int32_t leaf = AllocateNode();
+			mNodes[leaf].mBounds = leafNode.mBounds;
+			mNodes[leaf].mEntity = leafNode.mEntity;
+			mLeaves[leafNode.mEntity] = leaf;
+			leaves.emplace_back(leaf);
+		}
+
+		if (!leaves.empty()) {
+			mRoot = Build(leaves, 0, leaves.size());
+			mNodes[mRoot].mParent = Null;
+		}
+
+		mBuildCost = GetCost();
+		++mStats.mRebuildCount;
+	}
+
+	bool SpatialIndex::Optimize() {
+		if (mLeaves.size() < SPATIAL_INDEX_MIN_REBUILD_SIZE)
+			return false;
+
+		if (GetCost() <= SPATIAL_INDEX_REBUILD_RATIO * mBuildCost)
+			return false;
+
+		Rebuild();
+		return true;
+	}
+
+	float SpatialIndex::GetCost() const {
+		if (mRoot == Null)
+			return 0.0f;
+
+		float rootArea = mNodes[mRoot].mBounds.SurfaceArea();
+		return rootArea > 0.0f ? mInteriorArea / rootArea : 0.0f;
+	}
+
+	uint SpatialIndex::GetHeight() const {
+		if (mRoot == Null)
+			return 0;
+
+		uint height = 0;
+		std::vector<std::pair<int32_t, uint>> stack;
+		stack.emplace_back(mRoot, 1);
+
+		while (!stack.empty()) {
+			auto [current, depth] = stack.back();
+			stack.pop_back();
+
+			height = std::max(height, depth);
+
+			auto& node = mNodes[current];
+			if (!node.IsLeaf()) {
+				stack.emplace_back(node.mLeft, depth + 1);
+				stack.emplace_back(node.mRight, depth + 1);
+			}
+		}
+
+		return height;
+	}
+
+	const BoundingBox& SpatialIndex::GetBounds(entt::entity entity) const {
+		auto it = mLeaves.find(entity);
+		if (it == mLeaves.end())
+			throw std::runtime_error("Entity is not in the spatial index!");
+		return mNodes[it->second].mBounds;
+	}
+
+	template <typename TestT>
+	void SpatialIndex::QueryTree(TestT test, std::vector<entt::entity>* result) const {
+		if (mRoot == Null)
+			return;
+
+		std::vector<int32_t> stack;
+		stack.reserve(64);
+		stack.emplace_back(mRoot);
+
+		while (!stack.empty()) {
+			auto& node = mNodes[stack.back()];
+			stack.pop_back();
+
+			if (!test(node.mBounds))
+				continue;
+
+			if (node.IsLeaf()) {
+				result->emplace_back(node.mEntity);
+			} else {
+				stack.emplace_back(node.mRight);
+				stack.emplace_back(node.mLeft);
+			}
+		}
+	}
+
+	void SpatialIndex::Query(const BoundingBox& box, std::vector<entt::entity>* result) const {
+		QueryTree([&box](const BoundingBox& bounds) {
+			return Intersects(bounds, box);
+		}, result);
+	}
+
+	void SpatialIndex::Query(const Frustum& frustum, std::vector<entt::entity>* result) const {
+		QueryTree([&frustum](const BoundingBox& bounds) {
+			return frustum.IsVisible(bounds);
+		}, result);
+	}
+
+	SpatialIndexUpdater::~SpatialIndexUpdater() {
+		Disconnect();
+	}
+
+	void SpatialIndexUpdater::Connect() {
+		auto& registry = mFrame->mRegistry;
+
+		mFrame->OnDestroy().connect<&SpatialIndexUpdater::OnFrameDestroyed>(*this);
+
+		registry.on_construct<StaticMeshComponent>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_update<StaticMeshComponent>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_destroy<StaticMeshComponent>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+
+		registry.on_construct<RendererTransformCache>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_update<RendererTransformCache>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_destroy<RendererTransformCache>().connect<&SpatialIndexUpdater::OnChanged>(*this);
+	}
+
+	void SpatialIndexUpdater::Disconnect() {
+		// A destroyed frame resets mFrame while its registry is still intact
+		if (!mFrame)
+			return;
+
+		auto& registry = mFrame->mRegistry;
+
+		mFrame->OnDestroy().disconnect<&SpatialIndexUpdater::OnFrameDestroyed>(*this);
+
+		registry.on_construct<StaticMeshComponent>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_update<StaticMeshComponent>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_destroy<StaticMeshComponent>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+
+		registry.on_construct<RendererTransformCache>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_update<RendererTransformCache>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+		registry.on_destroy<RendererTransformCache>().disconnect<&SpatialIndexUpdater::OnChanged>(*this);
+	}
+
+	void SpatialIndexUpdater::OnChanged(entt::registry& registry, entt::entity e) {
+		mChanged.emplace_back(e);
+	}
+
+	void SpatialIndexUpdater::OnFrameDestroyed(Frame& frame) {
+		SetFrame(nullptr);
+	}
+
+	bool SpatialIndexUpdater::GetWorldBounds(entt::registry& registry, entt::entity e, BoundingBox* bounds) {
+		auto mesh = registry.try_get<StaticMeshComponent>(e);
+		if (!mesh || !mesh->mGeometry)
+			return false;
+
+		auto cache = registry.try_get<RendererTransformCache>(e);
+		auto& local = mesh->mGeometry->GetBoundingBox();
+		*bounds = cache ? local.Transformed(cache->mCache) : local;
+		return true;
+	}
+
+	void SpatialIndexUpdater::SetFrame(Frame* frame) {
+		Disconnect();
+
+		mFrame = frame;
+		mIndex.Clear();
+		mChanged.clear();
+
+		if (!mFrame)
+			return;
+
+		Connect();
+
+		auto& registry = mFrame->mRegistry;
+		auto view = registry.view<StaticMeshComponent>();
+
+		BoundingBox bounds;
+		for (auto e : view) {
+			if (GetWorldBounds(registry, e, &bounds))
+				mIndex.Insert(e, bounds);
+		}
+
+		mIndex.Rebuild();
+	}
+
+	void SpatialIndexUpdater::Update() {
+		if (!mFrame || mChanged.empty())
+			return;
+
+		auto& registry = mFrame->mRegistry;
+
+		std::sort(mChanged.begin(), mChanged.end());
+		mChanged.erase(std::unique(mChanged.begin(), mChanged.end()), mChanged.end());
+
+		// Destroy signals fire before the component is gone, so removals are
+		// only visible now
+		BoundingBox bounds;
+		for (auto e : mChanged) {
+			if (registry.valid(e) && GetWorldBounds(registry, e, &bounds))
+				mIndex.Move(e, bounds);
+			else
+				mIndex.Remove(e);
+		}
+
+		mChanged.clear();
+		mIndex.Optimize();
+	}
+}
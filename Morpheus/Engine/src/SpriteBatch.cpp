@@ -11,7 +11,8 @@ namespace Morpheus {
 
 	ResourceTask<SpriteShaders> SpriteShaders::LoadDefaults(
 			DG::IRenderDevice* device, 
-			IVirtualFileSystem* system) {
+			IVirtualFileSystem* system,
+			uint textureSlots) {
 		Promise<SpriteShaders> shadersPromise;
 		Future<SpriteShaders> shadersFuture(shadersPromise);
 		
@@ -22,9 +23,13 @@ namespace Morpheus {
 		} data;
 
 		Task task([data, promise = std::move(shadersPromise), 
-			device, system](const TaskParams& e) mutable {
+			device, system, textureSlots](const TaskParams& e) mutable {
 
 			if (e.mTask->BeginSubTask()) {
+				ShaderPreprocessorConfig psConfig;
+				if (textureSlots > 1)
+					psConfig.mDefines["TEXTURE_SLOTS"] = std::to_string(textureSlots);
+
 				LoadParams<RawShader> vsParams("internal/SpriteBatch.vsh",
 					DG::SHADER_TYPE_VERTEX,
 					"Sprite Batch VS");
@@ -35,7 +40,8 @@ namespace Morpheus {
 
 				LoadParams<RawShader> psParams("internal/SpriteBatch.psh",
 					DG::SHADER_TYPE_PIXEL,
-					"Sprite Batch PS");
+					"Sprite Batch PS",
+					psConfig);
 
 				auto vsTask = LoadShader(device, vsParams, system);
 				auto gsTask = LoadShader(device, gsParams, system);
@@ -84,7 +90,8 @@ namespace Morpheus {
 		DG::TEXTURE_FORMAT depthbufferFormat,
 		uint samples,
 		DG::FILTER_TYPE filterType,
-		IVirtualFileSystem* fileSystem) {
+		IVirtualFileSystem* fileSystem,
+		uint textureSlots) {
 
 		Promise<SpriteBatchPipeline> pipelinePromise;
 		Future<SpriteBatchPipeline> pipelineFuture(pipelinePromise);
@@ -95,10 +102,10 @@ namespace Morpheus {
 
 		Task task([pipelinePromise = std::move(pipelinePromise), 
 			data, device, backbufferFormat, depthbufferFormat, 
-			samples, filterType, fileSystem, globals](const TaskParams& e) mutable {
+			samples, filterType, fileSystem, globals, textureSlots](const TaskParams& e) mutable {
 			if (e.mTask->BeginSubTask()) {
 
-				auto loadShaders = SpriteShaders::LoadDefaults(device, fileSystem);
+				auto loadShaders = SpriteShaders::LoadDefaults(device, fileSystem, textureSlots);
 				data.mShaders = e.mQueue->AdoptAndTrigger(std::move(loadShaders));
 
 				e.mTask->EndSubTask();
@@ -111,7 +118,7 @@ namespace Morpheus {
 
 			SpriteBatchPipeline pipeline(device, globals, 
 				backbufferFormat, depthbufferFormat, samples,
-				filterType, data.mShaders.Get());
+				filterType, data.mShaders.Get(), textureSlots);
 
 			pipelinePromise.Set(pipeline, e.mQueue);
 			return TaskResult::FINISHED;
@@ -131,7 +138,11 @@ namespace Morpheus {
 		DG::TEXTURE_FORMAT depthbufferFormat,
 		uint samples,
 		DG::FILTER_TYPE filterType,
-		const SpriteShaders& shaders) {
+		const SpriteShaders& shaders,
+		uint textureSlots) {
+
+		if (textureSlots == 0 || textureSlots > MAX_SPRITE_BATCH_TEXTURE_SLOTS)
+			throw std::runtime_error("Invalid number of sprite batch texture slots!");
 
 		DG::SamplerDesc SamDesc
 		{
@@ -185,6 +196,8 @@ namespace Morpheus {
 				DG::LAYOUT_ELEMENT_AUTO_OFFSET, stride, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX),
 			DG::LayoutElement(5, 0, 2, DG::VT_FLOAT32, false, 
 				DG::LAYOUT_ELEMENT_AUTO_OFFSET, stride, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX),
+			DG::LayoutElement(6, 0, 1, DG::VT_FLOAT32, false, 
+				DG::LAYOUT_ELEMENT_AUTO_OFFSET, stride, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX),
 		};
 
 		GraphicsPipeline.InputLayout.NumElements = layoutElements.size();
@@ -196,10 +209,14 @@ namespace Morpheus {
 
 		PSODesc.ResourceLayout.DefaultVariableType = DG::SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
 
+		// With more than one slot the shader samples a texture array instead
+		const char* textureName = textureSlots > 1 ? "mTextures" : "mTexture";
+		const char* samplerName = textureSlots > 1 ? "mTextures_sampler" : "mTexture_sampler";
+
 		// clang-format off
 		DG::ShaderResourceVariableDesc Vars[] = 
 		{
-			{DG::SHADER_TYPE_PIXEL, "mTexture", DG::SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+			{DG::SHADER_TYPE_PIXEL, textureName, DG::SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
 		};
 		// clang-format on
 		PSODesc.ResourceLayout.NumVariables = _countof(Vars);
@@ -208,7 +225,7 @@ namespace Morpheus {
 		// clang-format off
 		DG::ImmutableSamplerDesc ImtblSamplers[] =
 		{
-			{DG::SHADER_TYPE_PIXEL, "mTexture_sampler", SamDesc}
+			{DG::SHADER_TYPE_PIXEL, samplerName, SamDesc}
 		};
 		// clang-format on
 		PSODesc.ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
@@ -222,6 +239,7 @@ namespace Morpheus {
 		
 		mPipeline = result;
 		mShaders = shaders;
+		mTextureSlots = textureSlots;
 
 		result->GetStaticVariableByName(DG::SHADER_TYPE_VERTEX, "Globals")
 			->Set(globals->GetCameraBuffer());
@@ -234,14 +252,16 @@ namespace Morpheus {
 		mPipeline->CreateShaderResourceBinding(&binding, true);
 
 		DG::IShaderResourceVariable* textureVar = 
-			binding->GetVariableByName(DG::SHADER_TYPE_PIXEL, "mTexture");
+			binding->GetVariableByName(DG::SHADER_TYPE_PIXEL, 
+				mTextureSlots > 1 ? "mTextures" : "mTexture");
 
-		return SpriteBatchState(binding, textureVar, mPipeline.Ptr());
+		return SpriteBatchState(binding, textureVar, mPipeline.Ptr(), mTextureSlots);
 	}
 
 	SpriteBatch::SpriteBatch(DG::IRenderDevice* device,
 		SpriteBatchState&& defaultState, 
-		uint batchSize) : mDefaultState(std::move(defaultState)) {
+		uint batchSize) : mDefaultState(std::move(defaultState)),
+		mSlots(batchSize, mDefaultState.mTextureSlots) {
 
 		mBatchSize = batchSize;
 		mBatchSizeBytes = batchSize * sizeof(SpriteBatchVSInput);
@@ -277,28 +297,41 @@ namespace Morpheus {
 
 		mMapHelper.Map(context, mBuffer, DG::MAP_WRITE, DG::MAP_FLAG_DISCARD);
 
-		mWriteIndex = 0;
+		mSlots = SpriteBatchSlots(mBatchSize, mCurrentState.mTextureSlots);
 		mCurrentContext = context;
-		mLastTexture = nullptr;
+		mDrawCount = 0;
 	}
 
 	void SpriteBatch::Flush() {
-		if (mWriteIndex > 0) {
+		if (!mSlots.IsEmpty()) {
 			DG::DrawAttribs attribs;
 			attribs.Flags = DG::DRAW_FLAG_VERIFY_ALL;
 			attribs.StartVertexLocation = 0;
-			attribs.NumVertices = mWriteIndex;
+			attribs.NumVertices = mSlots.GetSpriteCount();
 			
 			mMapHelper.Unmap();
-			mCurrentState.mTextureVariable->Set(
-				mLastTexture->GetDefaultView(DG::TEXTURE_VIEW_SHADER_RESOURCE));
+
+			if (mSlots.GetSlotCount() > 1) {
+				// Every slot has to be bound, unused ones repeat the first texture
+				std::array<DG::IDeviceObject*, MAX_SPRITE_BATCH_TEXTURE_SLOTS> views;
+				for (uint i = 0; i < mSlots.GetSlotCount(); ++i) {
+					auto texture = mSlots.GetTexture(i < mSlots.GetUsedSlots() ? i : 0);
+					views[i] = texture->GetDefaultView(DG::TEXTURE_VIEW_SHADER_RESOURCE);
+				}
+				mCurrentState.mTextureVariable->SetArray(&views[0], 0, mSlots.GetSlotCount());
+			} else {
+				mCurrentState.mTextureVariable->Set(
+					mSlots.GetTexture(0)->GetDefaultView(DG::TEXTURE_VIEW_SHADER_RESOURCE));
+			}
+
 			mCurrentContext->CommitShaderResources(mCurrentState.mShaderBinding, 
 				RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 			mCurrentContext->Draw(attribs);
+			++mDrawCount;
 
 			mMapHelper.Map(mCurrentContext, mBuffer, DG::MAP_WRITE, DG::MAP_FLAG_DISCARD);
 			
-			mWriteIndex = 0;
+			mSlots.Reset();
 		}
 	}
 
@@ -308,19 +341,24 @@ namespace Morpheus {
 		mCurrentState = SpriteBatchState();
 	}
 
+	SpriteBatchVSInput* SpriteBatch::NextInstance(DG::ITexture* texture) {
+		int slot = mSlots.Add(texture);
+		if (slot < 0) {
+			Flush();
+			slot = mSlots.Add(texture);
+		}
+
+		auto instance = &mMapHelper[mSlots.GetSpriteCount() - 1];
+		instance->mSlot = (float)slot;
+		return instance;
+	}
+
 	void SpriteBatch::Draw(DG::ITexture* texture, const DG::float3& pos,
 		const DG::float2& size, const SpriteRect& rect, 
 		const DG::float2& origin, const float rotation, 
 		const DG::float4& color) {
 
-		if (!mLastTexture)
-			mLastTexture = texture;
-		if (mWriteIndex == mBatchSize || (mLastTexture && mLastTexture != texture)) {
-			Flush();
-			mLastTexture = texture;
-		}
-
-		SpriteBatchVSInput* instance = &mMapHelper[mWriteIndex];
+		SpriteBatchVSInput* instance = NextInstance(texture);
 		auto& desc = texture->GetDesc();
 		DG::float2 dim2d(desc.Width, desc.Height);
 		
@@ -337,8 +375,6 @@ namespace Morpheus {
 		instance->mSize = size;
 		instance->mUVTop = uvtop_unscaled / dim2d;
 		instance->mUVBottom = uvbottom_unscaled / dim2d;
-
-		++mWriteIndex;
 	}
 
 	void SpriteBatch::Draw(const SpriteBatchCall2D sprites[], size_t count) {
@@ -362,14 +398,7 @@ namespace Morpheus {
 		const DG::float2& origin, const float rotation, 
 		const DG::float4& color) {
 
-		if (!mLastTexture)
-			mLastTexture = texture;
-		if (mWriteIndex == mBatchSize || mLastTexture != texture) {
-			Flush();
-			mLastTexture = texture;
-		}
-
-		SpriteBatchVSInput* instance = &mMapHelper[mWriteIndex];
+		SpriteBatchVSInput* instance = NextInstance(texture);
 		auto& desc = texture->GetDesc();
 		DG::float2 dim2d(desc.Width, desc.Height);
 		
@@ -386,7 +415,5 @@ namespace Morpheus {
 		instance->mSize = size;
 		instance->mUVTop = uvtop_unscaled / dim2d;
 		instance->mUVBottom = uvbottom_unscaled / dim2d;
-
-		++mWriteIndex;
 	}
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <Engine/Components/SkyboxComponent.hpp>
 #include <Engine/Components/StaticMeshComponent.hpp>
 #include <Engine/RendererTransformCache.hpp>
+#include <Engine/RenderSnapshot.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/OcclusionCulling.hpp>
 
 namespace Morpheus {
 
@@ -144,16 +147,27 @@ namespace Morpheus {
 		}, "Initialize DefaultRenderer");
 
 
-		// Update all transform caches
-		ParameterizedTask<RenderParams> updateTransformCache([this](const TaskParams& e, const RenderParams& params) {
-			CacheUpdater().UpdateChanges();
-		});
+		// Update all transform caches once the update is finished
+		ParameterizedTask<ExtractParams> updateTransformCache([this](const TaskParams& e, const ExtractParams& params) {
+			CacheUpdater().UpdateChanges(e.mQueue);
+			mSpatialIndex.Update();
+		}, "Update Transform Cache", TaskType::UPDATE);
+
+		// Copy everything the render group needs out of the registry, skipping
+		// the meshes that are nowhere near the camera
+		ParameterizedTask<ExtractParams> extractSnapshot([this](const TaskParams& e, const ExtractParams& params) {
+			auto& scDesc = GetGraphics()->SwapChain()->GetDesc();
+			ExtractRenderSnapshot(params.mFrame, params.mSnapshot, mSpatialIndex.GetIndex(),
+				(float)scDesc.Width / (float)scDesc.Height, GetGraphics()->IsGL(), e.mQueue);
+		}, "Extract Render Snapshot", TaskType::UPDATE);
+
+		extractSnapshot->In().Lock().Connect(&updateTransformCache->Out());
 		
 		mRenderGroup.reset(CreateRenderGroup());
-		mRenderGroup->In().Lock().Connect(&updateTransformCache->Out());
 
-		// Give this task to the frame processor
-		collection.GetFrameProcessor().AddRenderTask(std::move(updateTransformCache));
+		// Give these tasks to the frame processor
+		collection.GetFrameProcessor().AddExtractTask(std::move(updateTransformCache));
+		collection.GetFrameProcessor().AddExtractTask(std::move(extractSnapshot));
 		collection.GetFrameProcessor().AddRenderGroup(mRenderGroup.get());
 		
 		return startupTask;
@@ -171,20 +185,23 @@ namespace Morpheus {
 			// Clear the back buffer (if necessary) and the depth buffer
 			context->SetRenderTargets(1, &rtv, dsv, DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 			
-			if (params.mFrame->mRegistry.view<SkyboxComponent>().size() == 0)
+			auto snapshot = params.mSnapshot;
+
+			// Materials nobody references anymore go away before anything is drawn.
+			// The snapshot holds references to the ones it draws.
+			mMaterials.Flush();
+
+			if (!snapshot->mSkybox)
 				context->ClearRenderTarget(rtv, color, DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 			
 			context->ClearDepthStencil(dsv, DG::CLEAR_DEPTH_FLAG, 1.0f, 0, 
 				DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 
 			// Write global camera data
-			if (params.mFrame->mCamera != entt::null) {
-				auto& cameraData = params.mFrame->CameraData();
-				
+			if (snapshot->bHasCamera) {
 				HLSL::ViewAttribs gpuViewData;
-				gpuViewData.mCamera = cameraData.GetTransformedAttribs(
-					params.mFrame->mCamera, 
-					&params.mFrame->mRegistry,
+				gpuViewData.mCamera = snapshot->mCamera.GetTransformedAttribs(
+					snapshot->bHasCameraTransform ? &snapshot->mCameraTransform : nullptr,
 					*graphics);
 
 				Resources().mViewData.Write(graphics->ImmediateContext(), gpuViewData);
@@ -203,87 +220,104 @@ namespace Morpheus {
 
 	ParameterizedTask<RenderParams> DefaultRenderer::DrawStaticMeshes() {
 		return ParameterizedTask<RenderParams>([this](const TaskParams& e, const RenderParams& params) {
-			auto skyboxes = params.mFrame->mRegistry.view<SkyboxComponent>();
-
-			auto ent = skyboxes.front();
-			if (ent != entt::null) {
-				auto& skybox = skyboxes.get<SkyboxComponent>(ent);
-				auto lightProbe = params.mFrame->TryGet<LightProbe>(ent);
+			auto snapshot = params.mSnapshot;
 
+			if (snapshot->mSkybox) {
 				MaterialApplyParams applyParams;
-				applyParams.mGlobalLightProbe = lightProbe;
+				applyParams.mGlobalLightProbe = snapshot->bHasLightProbe ? &snapshot->mLightProbe : nullptr;
 
 				MaterialId currentMaterial = NullMaterialId;
 
 				auto context = GetGraphics()->ImmediateContext();
-				auto meshView = params.mFrame->mRegistry.view<StaticMeshComponent>();
-
-				auto currentIt = meshView.begin();
-				auto endIt = meshView.end();
-
-				while (currentIt != endIt) {
-					auto instanceBuffer = Resources().mInstanceBuffer.Ptr();
-
-					// First upload transforms to GPU buffer
-					void* mappedData;
-					context->MapBuffer(instanceBuffer, DG::MAP_WRITE, 
-						DG::MAP_FLAG_DISCARD, mappedData);
-
-					DG::float4x4* ptr = reinterpret_cast<DG::float4x4*>(mappedData);
-					int maxInstances = instanceBuffer->GetDesc().uiSizeInBytes / sizeof(DG::float4x4);
-					int transformWriteIdx = 0;
-					int transformReadIdx = 0;
-
-					auto matrixCopyIt = currentIt;
-					for (; matrixCopyIt != endIt && transformWriteIdx < maxInstances;
-						++transformWriteIdx, ++matrixCopyIt) {
-						auto transformCache = params.mFrame->TryGet<RendererTransformCache>(*matrixCopyIt);
-						
-						if (transformCache)
-							ptr[transformWriteIdx] = transformCache->mCache.Transpose();
-						else 
-							ptr[transformWriteIdx] = DG::float4x4::Identity();
+				auto& meshes = snapshot->mStaticMeshes;
+				auto& visible = mVisibleStaticMeshes;
+
+				// Only pack and draw what the camera can see
+				if (snapshot->bHasCamera) {
+					auto projection = snapshot->mCamera.GetProjection(*GetGraphics());
+					auto frustum = Frustum::FromCamera(snapshot->mCamera,
+						snapshot->bHasCameraTransform ? &snapshot->mCameraTransform : nullptr,
+						projection,
+						GetGraphics()->IsGL());
+					CullStaticMeshes(frustum, meshes, &visible, e.mQueue);
+
+					// Then drop whatever is hidden behind the occluders
+					if (!snapshot->mOccluders.empty()) {
+						auto& scDesc = GetGraphics()->SwapChain()->GetDesc();
+						auto viewProj = GetCameraViewProjection(snapshot->mCamera,
+							snapshot->bHasCameraTransform ? &snapshot->mCameraTransform : nullptr,
+							snapshot->mCamera.GetProjection((float)scDesc.Width / (float)scDesc.Height, false));
+						mOcclusionBuffer.Render(viewProj, snapshot->mOccluders, e.mQueue);
+						OcclusionCullStaticMeshes(mOcclusionBuffer, meshes, &visible, e.mQueue);
 					}
 
-					context->UnmapBuffer(instanceBuffer, DG::MAP_WRITE);
-
-					while (currentIt != matrixCopyIt) {
-						auto& staticMesh = meshView.get<StaticMeshComponent>(*currentIt);
-
-						auto& material = staticMesh.mMaterial;
-						auto& geometry = staticMesh.mGeometry;
-
-						// Change pipeline
-						if (material != NullMaterialId) {
-							ApplyMaterial(context, material, applyParams);
-							currentMaterial = material;
-						}
-
-						// Count the number of instances of this specific mesh to render
-						int instanceCount = 1;
-						for (++currentIt; currentIt != matrixCopyIt
-							&& meshView.get<StaticMeshComponent>(*currentIt).mGeometry == geometry 
-							&& meshView.get<StaticMeshComponent>(*currentIt).mMaterial == material;
-							++instanceCount, ++currentIt);
-
-						if (material != NullMaterialId) {
-							// Render all of these static meshes in a batch
-							DG::Uint32  offsets[] = { 0, (DG::Uint32)(transformReadIdx * sizeof(DG::float4x4)) };
-							DG::IBuffer* pBuffs[] = { geometry->GetVertexBuffer(), instanceBuffer };
-							context->SetVertexBuffers(0, 2, pBuffs, offsets, 
-								DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION, 
-								DG::SET_VERTEX_BUFFERS_FLAG_RESET);
-							context->SetIndexBuffer( geometry->GetIndexBuffer(), 0, 
-								DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-
-							DG::DrawIndexedAttribs attribs = geometry->GetIndexedDrawAttribs();
-							attribs.Flags = DG::DRAW_FLAG_VERIFY_ALL;
-							attribs.NumInstances = instanceCount;
-							context->DrawIndexed(attribs);
-						}
-
-						transformReadIdx += instanceCount;
+					// Lists of the lights that reach each cluster of the view
+					if (!snapshot->mLights.empty())
+						mLightClusters.Build(*snapshot, projection, e.mQueue);
+				} else {
+					visible.resize(meshes.size());
+					for (size_t i = 0; i < visible.size(); ++i)
+						visible[i] = (uint32_t)i;
+				}
+
+				// Group every instance of the same geometry and material together
+				mStaticMeshQueue.Build(*snapshot, visible, [this](MaterialId id) -> const void* {
+					auto mat = mMaterials.TryGet(id);
+					return mat ? mat->mPipeline : nullptr;
+				});
+
+				auto& batches = mStaticMeshQueue.GetBatches();
+
+				// Room for the whole frame, so every batch is a single draw
+				if (mStaticMeshQueue.GetOrder().size() > mInstanceCapacity) {
+					size_t capacity = mInstanceCapacity;
+					while (capacity < mStaticMeshQueue.GetOrder().size())
+						capacity *= 2;
+					CreateInstanceBuffer(capacity);
+				}
+
+				// Transforms are packed in parallel, and only the slots that
+				// changed since the last frame are uploaded. Slots follow the
+				// queue order, so a change in the visible set uploads every
+				// slot after it.
+				mInstances.Pack(meshes, mStaticMeshQueue.GetOrder(), e.mQueue);
+
+				auto instanceBuffer = Resources().mInstanceBuffer.Ptr();
+				auto& instanceData = mInstances.GetData();
+
+				for (auto& range : mInstances.GetDirtyRanges()) {
+					context->UpdateBuffer(instanceBuffer,
+						(DG::Uint32)(range.mBegin * sizeof(DG::float4x4)),
+						(DG::Uint32)((range.mEnd - range.mBegin) * sizeof(DG::float4x4)),
+						&instanceData[range.mBegin],
+						DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+				}
+
+				for (auto& batch : batches) {
+					if (batch.mMaterial == NullMaterialId)
+						continue;
+
+					// Change pipeline
+					if (batch.mMaterial != currentMaterial) {
+						if (!ApplyMaterial(context, batch.mMaterial, applyParams))
+							continue;
+						currentMaterial = batch.mMaterial;
 					}
+
+					// Render all of these static meshes in a batch
+					auto geometry = batch.mGeometry;
+					DG::Uint32  offsets[] = { 0, (DG::Uint32)(batch.mFirstInstance * sizeof(DG::float4x4)) };
+					DG::IBuffer* pBuffs[] = { geometry->GetVertexBuffer(), instanceBuffer };
+					context->SetVertexBuffers(0, 2, pBuffs, offsets, 
+						DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION, 
+						DG::SET_VERTEX_BUFFERS_FLAG_RESET);
+					context->SetIndexBuffer( geometry->GetIndexBuffer(), 0, 
+						DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+					DG::DrawIndexedAttribs attribs = geometry->GetIndexedDrawAttribs();
+					attribs.Flags = DG::DRAW_FLAG_VERIFY_ALL;
+					attribs.NumInstances = batch.mInstanceCount;
+					context->DrawIndexed(attribs);
 				}
 			}
 		}, "Draw Static Meshes", TaskType::RENDER, ASSIGN_THREAD_MAIN);
@@ -291,15 +325,12 @@ namespace Morpheus {
 	
 	ParameterizedTask<RenderParams> DefaultRenderer::DrawBackground() {
 		return ParameterizedTask<RenderParams>([this](const TaskParams& e, const RenderParams& params) {
-			auto skyboxes = params.mFrame->mRegistry.view<SkyboxComponent>();
-
-			auto ent = skyboxes.front();
-			if (ent != entt::null) {
-				auto& skybox = skyboxes.get<SkyboxComponent>(ent);
+			auto& skybox = params.mSnapshot->mSkybox;
 
+			if (skybox) {
 				// Render skybox
 				auto context = GetGraphics()->ImmediateContext();
-				Resources().mSkybox.mTexture->Set(skybox.mCubemap->GetShaderView());
+				Resources().mSkybox.mTexture->Set(skybox->GetShaderView());
 
 				context->SetPipelineState(Resources().mSkybox.mPipeline.Ptr());
 				context->CommitShaderResources(Resources().mSkybox.mSkyboxBinding.Ptr(),
@@ -330,20 +361,27 @@ namespace Morpheus {
 		return group;
 	}
 
-	void DefaultRenderer::InitializeDefaultResources() {
-		auto device = mGraphics->Device();
-		auto context = mGraphics->ImmediateContext();
-
+	void DefaultRenderer::CreateInstanceBuffer(size_t capacity) {
 		DG::BufferDesc desc;
 		desc.Name = "Renderer Instance Buffer";
-		desc.Usage = DG::USAGE_DYNAMIC;
+		desc.Usage = DG::USAGE_DEFAULT;
 		desc.BindFlags = DG::BIND_VERTEX_BUFFER;
-		desc.CPUAccessFlags = DG::CPU_ACCESS_WRITE;
-		desc.uiSizeInBytes = sizeof(DG::float4x4) * mInstanceBatchSize;
+		desc.uiSizeInBytes = sizeof(DG::float4x4) * capacity;
 
 		DG::IBuffer* buffer = nullptr;
-		device->CreateBuffer(desc, nullptr, &buffer);
-		mResources.mInstanceBuffer = buffer;
+		mGraphics->Device()->CreateBuffer(desc, nullptr, &buffer);
+		mResources.mInstanceBuffer.Adopt(buffer);
+
+		// Nothing of the old contents made it over
+		mInstanceCapacity = capacity;
+		mInstances.Invalidate();
+	}
+
+	void DefaultRenderer::InitializeDefaultResources() {
+		auto device = mGraphics->Device();
+		auto context = mGraphics->ImmediateContext();
+
+		CreateInstanceBuffer(mInstanceBatchSize);
 
 		// Create default textures
 		static constexpr DG::Uint32 TexDim = 8;
@@ -418,42 +456,31 @@ namespace Morpheus {
 		mResources.mMaterialData.Initialize(mGraphics->Device());
 	}
 
-	MaterialId DefaultRenderer::CreateNewMaterialId() {
-		++mCurrentMaterialId;
-		mCurrentMaterialId = std::max(0, mCurrentMaterialId);
-		return mCurrentMaterialId;
-	}
-	
-	void DefaultRenderer::ApplyMaterial(DG::IDeviceContext* context, MaterialId id, 
+	bool DefaultRenderer::ApplyMaterial(DG::IDeviceContext* context, MaterialId id, 
 		const MaterialApplyParams& params) {
-		auto it = mMaterials.find(id);
-
-		if (it != mMaterials.end()) {
-			auto& mat = it->second;
-			switch (mat.mDesc.mType) {
-			case MaterialType::COOK_TORRENCE:
-				OnApplyCookTorrence(mat, params);
-				break;
-			case MaterialType::LAMBERT:
-				OnApplyLambert(mat, params);
-				break;
-			case MaterialType::CUSTOM:
-				break;
-			}
+		auto mat = mMaterials.TryGet(id);
 
-			HLSL::MaterialAttribs attribs;
-			attribs.mAlbedoFactor = mat.mDesc.mAlbedoFactor;
-			attribs.mDisplacementFactor = mat.mDesc.mDisplacementFactor;
-			attribs.mMetallicFactor = mat.mDesc.mMetallicFactor;
-			attribs.mRoughnessFactor = mat.mDesc.mRoughnessFactor;
-
-			mResources.mMaterialData.Write(context, attribs);
-
-			context->SetPipelineState(mat.mPipeline);
-			context->CommitShaderResources(mat.mBinding, DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-		} else {
+		if (!mat) {
 			std::cout << "WARNING: Material Id: " << id << " cannot be found!" << std::endl;
+			return false;
+		}
+
+		switch (mat->mDesc.mType) {
+		case MaterialType::COOK_TORRENCE:
+			OnApplyCookTorrence(*mat, params);
+			break;
+		case MaterialType::LAMBERT:
+			OnApplyLambert(*mat, params);
+			break;
+		case MaterialType::CUSTOM:
+			break;
 		}
+
+		mResources.mMaterialData.Write(context, mat->mAttribs);
+
+		context->SetPipelineState(mat->mPipeline);
+		context->CommitShaderResources(mat->mBinding, DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+		return true;
 	}
 
 	DefaultRenderer::Material DefaultRenderer::CreateCookTorrenceMaterial(const MaterialDesc& desc) {
@@ -511,15 +538,31 @@ namespace Morpheus {
 		DefaultRenderer::Material& mat, 
 		const DefaultRenderer::MaterialApplyParams& params) {
 		if (params.mGlobalLightProbe) {
-			mat.mIrradianceSHVariable->Set(params.mGlobalLightProbe->GetIrradianceSH());
-			mat.mEnvMapVariable->Set(params.mGlobalLightProbe->GetPrefilteredEnvView());
+			// The probe rarely changes, only rebind when it does
+			auto irradianceSH = params.mGlobalLightProbe->GetIrradianceSH();
+			auto envMap = params.mGlobalLightProbe->GetPrefilteredEnvView();
+
+			if (irradianceSH != mat.mBoundIrradianceSH) {
+				mat.mIrradianceSHVariable->Set(irradianceSH);
+				mat.mBoundIrradianceSH = irradianceSH;
+			}
+
+			if (envMap != mat.mBoundEnvMap) {
+				mat.mEnvMapVariable->Set(envMap);
+				mat.mBoundEnvMap = envMap;
+			}
 		}
 	}
 
 	void DefaultRenderer::OnApplyLambert(DefaultRenderer::Material& mat, 
 		const MaterialApplyParams& params) {
 		if (params.mGlobalLightProbe) {
-			mat.mIrradianceSHVariable->Set(params.mGlobalLightProbe->GetIrradianceSH());
+			auto irradianceSH = params.mGlobalLightProbe->GetIrradianceSH();
+
+			if (irradianceSH != mat.mBoundIrradianceSH) {
+				mat.mIrradianceSHVariable->Set(irradianceSH);
+				mat.mBoundIrradianceSH = irradianceSH;
+			}
 		}
 	}
 
@@ -860,6 +903,9 @@ namespace Morpheus {
 	void DefaultRenderer::Shutdown() {
 		bIsInitialized = false;	
 
+		// Materials hold bindings of the pipelines below
+		mMaterials.Clear();
+
 		// Clear resources
 		mResources = std::move(Resources());
 	}
@@ -867,6 +913,7 @@ namespace Morpheus {
 	void DefaultRenderer::NewFrame(Frame* frame) {
 		mUpdater.SetFrame(frame);
 		mUpdater.UpdateAll();
+		mSpatialIndex.SetFrame(frame);
 	}
 
 	const VertexLayout& DefaultRenderer::GetStaticMeshLayout() const {
@@ -894,33 +941,24 @@ namespace Morpheus {
 	}
 
 	MaterialId DefaultRenderer::CreateUnmanagedMaterial(const MaterialDesc& desc) {
-		Material mat;
-		
-		switch (desc.mType) {
-			case MaterialType::COOK_TORRENCE:
-				mat = CreateCookTorrenceMaterial(desc);
-				break;
-			case MaterialType::LAMBERT:
-				mat = CreateLambertMaterial(desc);
-				break;
-			case MaterialType::CUSTOM:
-				return NullMaterialId;
-		}
-
-		auto id = CreateNewMaterialId();
-		mMaterials.emplace(id, std::move(mat));
-
-		return id;
+		if (desc.mType == MaterialType::CUSTOM)
+			return NullMaterialId;
+
+		// Identical descriptions share a material, and with it a binding
+		return mMaterials.Create(desc, [this](const MaterialDesc& desc) {
+			if (desc.mType == MaterialType::LAMBERT)
+				return CreateLambertMaterial(desc);
+			else
+				return CreateCookTorrenceMaterial(desc);
+		});
 	}
 
 	void DefaultRenderer::AddMaterialRef(MaterialId id) {
-		std::lock_guard<std::mutex> lock(mMaterialAddRefMutex);
-		mMaterialsToAddRef.emplace_back(id);
+		mMaterials.AddRef(id);
 	}
 
 	void DefaultRenderer::ReleaseMaterial(MaterialId id) {
-		std::lock_guard<std::mutex> lock(mMaterialReleaseMutex);
-		mMaterialsToRelease.emplace_back(id);
+		mMaterials.Release(id);
 	}
 
 	void DefaultRenderer::OnAddedTo(SystemCollection& collection) {
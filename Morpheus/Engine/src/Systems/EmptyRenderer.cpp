@@ -1,12 +1,41 @@
 #include <Engine/Systems/EmptyRenderer.hpp>
+#include <Engine/RenderSnapshot.hpp>
+#include <Engine/Culling.hpp>
 
 namespace Morpheus {
 
 	Task EmptyRenderer::Startup(SystemCollection& collection) {
 
-		// Just clear the screen
-		ParameterizedTask<RenderParams> renderTask([graphics = mGraphics](const TaskParams& e, const RenderParams& params) {
-			
+		// Same extraction as DefaultRenderer, so headless frames cost the same on the CPU
+		ParameterizedTask<ExtractParams> updateTransformCache([this](const TaskParams& e, const ExtractParams& params) {
+			mUpdater.UpdateChanges(e.mQueue);
+			mSpatialIndex.Update();
+		}, "Update Transform Cache", TaskType::UPDATE);
+
+		ParameterizedTask<ExtractParams> extractSnapshot([this](const TaskParams& e, const ExtractParams& params) {
+			ExtractRenderSnapshot(params.mFrame, params.mSnapshot, mSpatialIndex.GetIndex(),
+				mAspectRatio, false, e.mQueue);
+		}, "Extract Render Snapshot", TaskType::UPDATE);
+
+		extractSnapshot->In().Lock().Connect(&updateTransformCache->Out());
+
+		// Give these tasks to the frame processor
+		auto& processor = collection.GetFrameProcessor();
+		processor.AddExtractTask(std::move(updateTransformCache));
+		processor.AddExtractTask(std::move(extractSnapshot));
+
+		if (mGraphics)
+			processor.AddRenderTask(ClearScreen());
+		else
+			processor.AddRenderTask(BuildDrawList());
+
+		return Task();
+	}
+
+	ParameterizedTask<RenderParams> EmptyRenderer::ClearScreen() {
+		return ParameterizedTask<RenderParams>([this, graphics = mGraphics](const TaskParams& e, const RenderParams& params) {
+			mMaterials.Flush();
+
 			auto context = graphics->ImmediateContext();
 			auto swapChain = graphics->SwapChain();
 			auto rtv = swapChain->GetCurrentBackBufferRTV();
@@ -18,11 +47,42 @@ namespace Morpheus {
 				DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 
 		}, "Clear Screen", TaskType::RENDER, ASSIGN_THREAD_MAIN);
+	}
 
-		// Give this task to the frame processor
-		collection.GetFrameProcessor().AddRenderTask(std::move(renderTask));
+	ParameterizedTask<RenderParams> EmptyRenderer::BuildDrawList() {
+		return ParameterizedTask<RenderParams>([this](const TaskParams& e, const RenderParams& params) {
+			auto snapshot = params.mSnapshot;
+			auto& meshes = snapshot->mStaticMeshes;
+			auto& visible = mVisibleStaticMeshes;
 
-		return Task();
+			// Materials are created on the main thread, so they are flushed there too
+			mMaterials.Flush();
+
+			if (snapshot->bHasCamera) {
+				auto projection = snapshot->mCamera.GetProjection(mAspectRatio, false);
+				auto viewProj = GetCameraViewProjection(snapshot->mCamera,
+					snapshot->bHasCameraTransform ? &snapshot->mCameraTransform : nullptr,
+					projection);
+
+				CullStaticMeshes(Frustum(viewProj, false), meshes, &visible, e.mQueue);
+
+				if (!snapshot->mOccluders.empty()) {
+					mOcclusionBuffer.Render(viewProj, snapshot->mOccluders, e.mQueue);
+					OcclusionCullStaticMeshes(mOcclusionBuffer, meshes, &visible, e.mQueue);
+				}
+
+				if (!snapshot->mLights.empty())
+					mLightClusters.Build(*snapshot, projection, e.mQueue);
+			} else {
+				visible.resize(meshes.size());
+				for (size_t i = 0; i < visible.size(); ++i)
+					visible[i] = (uint32_t)i;
+			}
+
+			// Sorted and batched the same way DefaultRenderer does, minus the device calls
+			mStaticMeshQueue.Build(*snapshot, visible);
+			mInstances.Pack(meshes, mStaticMeshQueue.GetOrder(), e.mQueue);
+		}, "Build Draw List", TaskType::RENDER, ASSIGN_THREAD_MAIN);
 	}
 	
 	bool EmptyRenderer::IsInitialized() const { 
@@ -30,9 +90,13 @@ namespace Morpheus {
 	}
 
 	void EmptyRenderer::Shutdown() { 
+		mMaterials.Clear();
 	}
 
 	void EmptyRenderer::NewFrame(Frame* frame) {
+		mUpdater.SetFrame(frame);
+		mUpdater.UpdateAll();
+		mSpatialIndex.SetFrame(frame);
 	}
 
 	void EmptyRenderer::OnAddedTo(SystemCollection& collection) {
@@ -45,12 +109,20 @@ namespace Morpheus {
 	}
 
 	MaterialId EmptyRenderer::CreateUnmanagedMaterial(const MaterialDesc& desc) {
-		return NullMaterialId;
+		if (desc.mType == MaterialType::CUSTOM)
+			return NullMaterialId;
+
+		return mMaterials.Create(desc, [](const MaterialDesc& desc) {
+			return desc.mType;
+		});
 	}
 
 	void EmptyRenderer::AddMaterialRef(MaterialId id) {
+		mMaterials.AddRef(id);
 	}
+
 	void EmptyRenderer::ReleaseMaterial(MaterialId id) {
+		mMaterials.Release(id);
 	}
 
 	GraphicsCapabilityConfig EmptyRenderer::GetCapabilityConfig() const { 
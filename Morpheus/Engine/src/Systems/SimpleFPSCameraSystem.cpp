@@ -116,11 +116,14 @@ namespace Morpheus {
 		auto& processor = systems.GetFrameProcessor();
 
 		// This task updates simple fps camera controllers
-		processor.AddUpdateTask(ParameterizedTask<UpdateParams>(
+		processor.AddUpdateTask(
 			[this](const TaskParams& e, const UpdateParams& params) {
 				Update(params.mFrame, params.mTime);
-			}, "Update FPS Camera", TaskType::UPDATE
-		));
+			}, 
+			ComponentAccess()
+				.Read<Camera, Transform>()
+				.Write<SimpleFPSCameraController>(),
+			"Update FPS Camera");
 
 		// This injects the changes to camera transform into the frame
 		InjectProc injectCameraTransform;
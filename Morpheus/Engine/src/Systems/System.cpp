@@ -1,4 +1,5 @@
 #include <Engine/Systems/System.hpp>
+#include <Engine/RenderSnapshot.hpp>
 
 namespace Morpheus {
 	void SystemCollection::Startup(ITaskQueue* queue) {
@@ -20,6 +21,11 @@ namespace Morpheus {
 	}
 
 	void SystemCollection::Shutdown() {
+		// Systems may destroy tasks that are part of the frame graph
+		mFrameProcessor.ReleaseGraph();
+		// Snapshots hold references to materials of the renderer
+		mFrameProcessor.SetFrame(nullptr);
+
 		mSystemInterfaces.clear();
 		mSystemsByType.clear();
 
@@ -38,66 +44,137 @@ namespace Morpheus {
 		}
 	}
 
+	void SystemCollection::RunFixedStep(ITaskQueue* queue,
+		double timeStep,
+		uint frameCount,
+		bool bRender,
+		const std::function<void(uint)>& onFrame) {
+		FrameTime time;
+
+		for (uint i = 0; i < frameCount; ++i) {
+			time.Advance(timeStep);
+
+			mFrameProcessor.Apply(time, queue, true, bRender);
+			mFrameProcessor.WaitUntilFinished(queue);
+
+			if (onFrame)
+				onFrame(i);
+		}
+	}
+
+	FrameProcessor::FrameProcessor(SystemCollection* systems) {
+		mSnapshots[0].reset(new RenderSnapshot());
+		mSnapshots[1].reset(new RenderSnapshot());
+
+		Initialize(systems, nullptr);
+	}
+
+	FrameProcessor::~FrameProcessor() {
+	}
+
 	void FrameProcessor::Apply(const FrameTime& time, 
 			ITaskQueue* queue,
 			bool bUpdate,
 			bool bRender) {
+		if (!mGraph.IsCompiled())
+			Compile();
+
 		UpdateParams updateParams;
 		updateParams.mFrame = mFrame;
 		updateParams.mTime = time;
 
+		// Render whatever was extracted after the last update
+		if (bSnapshotPending) {
+			mRenderSnapshot = 1 - mRenderSnapshot;
+			bSnapshotPending = false;
+		}
+
 		Reset();
 
 		if (bFirstFrame) {
 			mSavedRenderParams.mTime = time;
 			mSavedRenderParams.mFrame = mFrame;
-			bFirstFrame = false;
 		}
 
-		mInject.SetParameters(mFrame);
-		mRender.SetParameters(mSavedRenderParams);
-		mUpdate.SetParameters(updateParams);
+		// Nothing reads the other snapshot anymore, so it can be overwritten
+		auto extractTarget = mSnapshots[1 - mRenderSnapshot].get();
+		extractTarget->Clear();
 
-		mSavedRenderParams.mTime = time;
-		mSavedRenderParams.mFrame = mFrame;
+		ExtractParams extractParams;
+		extractParams.mFrame = mFrame;
+		extractParams.mTime = time;
+		extractParams.mSnapshot = extractTarget;
 
-		queue->Trigger(&mInject);
-		
-		if (bRender) {
-			queue->Trigger(&mRenderSwitch);
+		std::get<0>(mInjectArgs) = mFrame;
+		std::get<0>(mUpdateArgs) = updateParams;
+		std::get<0>(mExtractArgs) = extractParams;
+
+		mGraph.Trigger(queue, mInjectNode);
+
+		if (bUpdate) {
+			// Extraction starts as soon as the update is finished
+			mGraph.Trigger(queue, mUpdateSwitchNode);
+			bSnapshotPending = true;
 		} else {
-			mRender.Out().SetFinishedUnsafe(true);
+			mGraph.SetFinished(mUpdateFinishedNode);
+			mGraph.SetFinished(mExtractFinishedNode);
 		}
 
-		if (bUpdate) {
-			queue->Trigger(&mUpdateSwitch);
+		if (bRender) {
+			if (bFirstFrame && bUpdate) {
+				// There is no earlier snapshot of this frame to render
+				queue->YieldUntilCondition([this]() {
+					return mGraph.IsFinished(mExtractFinishedNode);
+				});
+				mRenderSnapshot = 1 - mRenderSnapshot;
+				bSnapshotPending = false;
+			}
+
+			mSavedRenderParams.mSnapshot = mSnapshots[mRenderSnapshot].get();
+			std::get<0>(mRenderArgs) = mSavedRenderParams;
+			mGraph.Trigger(queue, mRenderSwitchNode);
 		} else {
-			mUpdate.Out().SetFinishedUnsafe(true);
+			mGraph.SetFinished(mRenderFinishedNode);
 		}
+
+		mSavedRenderParams.mTime = time;
+		mSavedRenderParams.mFrame = mFrame;
+		bFirstFrame = false;
 	}
 
 	void FrameProcessor::Initialize(SystemCollection* systems, Frame* frame) {
+		mGraph.Release();
+
 		mInject.Clear();
+		mStructuralUpdate.Clear();
 		mUpdate.Clear();
 		mRender.Clear();
+		mExtract.Clear();
 		mRenderSwitch.Clear();
 		mUpdateSwitch.Clear();
 
-		Reset();
-
-		mUpdate.In().Lock()
+		mStructuralUpdate.In().Lock()
 			.Connect(&mInject.Out())
 			.Connect(&mUpdateSwitch.mOut);
+		mUpdate.In().Lock()
+			.Connect(&mStructuralUpdate.Out());
 		mRender.In().Lock()
 			.Connect(&mInject.Out())
 			.Connect(&mRenderSwitch.mOut);
+		mExtract.In().Lock()
+			.Connect(&mUpdate.Out());
 
 		mInjectByType.clear();
+		mDeclaredUpdates.clear();
+		mLastStructuralUpdate = nullptr;
+		mOrderEdges.clear();
 
 		// For consistency
 		mInject.Out().SetFinishedUnsafe(true);
+		mStructuralUpdate.Out().SetFinishedUnsafe(true);
 		mUpdate.Out().SetFinishedUnsafe(true);
 		mRender.Out().SetFinishedUnsafe(true);
+		mExtract.Out().SetFinishedUnsafe(true);
 
 		SetFrame(frame);
 	}
@@ -105,17 +182,69 @@ namespace Morpheus {
 	void FrameProcessor::SetFrame(Frame* frame) {
 		mFrame = frame;
 		bFirstFrame = true;
+
+		// Drop anything that still references the old frame
+		mSnapshots[0]->Clear();
+		mSnapshots[1]->Clear();
+		bSnapshotPending = false;
+	}
+
+	void FrameProcessor::Compile() {
+		mInject.BindParameters(&mInjectArgs);
+		mStructuralUpdate.BindParameters(&mUpdateArgs);
+		mUpdate.BindParameters(&mUpdateArgs);
+		mRender.BindParameters(&mRenderArgs);
+		mExtract.BindParameters(&mExtractArgs);
+
+		mGraph.Compile({&mInject.In(), &mUpdateSwitch.mIn, &mRenderSwitch.mIn}, mOrderEdges);
+
+		mInjectNode = mGraph.FindNode(&mInject.BarrierIn());
+		mUpdateSwitchNode = mGraph.FindNode(&mUpdateSwitch);
+		mRenderSwitchNode = mGraph.FindNode(&mRenderSwitch);
+		mUpdateStartedNode = mGraph.FindNode(&mStructuralUpdate.BarrierIn());
+		mRenderStartedNode = mGraph.FindNode(&mRender.BarrierIn());
+		mExtractStartedNode = mGraph.FindNode(&mExtract.BarrierIn());
+		mInjectFinishedNode = mGraph.FindNode(&mInject.BarrierOut());
+		mUpdateFinishedNode = mGraph.FindNode(&mUpdate.BarrierOut());
+		mRenderFinishedNode = mGraph.FindNode(&mRender.BarrierOut());
+		mExtractFinishedNode = mGraph.FindNode(&mExtract.BarrierOut());
+	}
+
+	double FrameProcessor::StageTime(uint started, uint finished) const {
+		auto start = mGraph.FinishTime(started);
+		auto end = mGraph.FinishTime(finished);
+
+		if (start == decltype(start)() || end == decltype(end)())
+			return 0.0;
+
+		return std::chrono::duration<double>(end - start).count();
+	}
+
+	FrameStageTimings FrameProcessor::GetStageTimings() const {
+		FrameStageTimings timings;
+
+		if (mGraph.IsCompiled()) {
+			timings.mUpdate = StageTime(mUpdateStartedNode, mUpdateFinishedNode);
+			timings.mExtract = StageTime(mExtractStartedNode, mExtractFinishedNode);
+			timings.mRender = StageTime(mRenderStartedNode, mRenderFinishedNode);
+		}
+
+		return timings;
+	}
+
+	void FrameProcessor::ReleaseGraph() {
+		mGraph.Release();
 	}
 
 	void FrameProcessor::Reset() {
-		mInject.Reset();
-		mRender.Reset();
-		mUpdate.Reset();
-		mRenderSwitch.Reset();
-		mUpdateSwitch.Reset();
+		// Frames only run through the compiled graph, so the groups themselves
+		// never need to be reset. Without a graph there is nothing to reset.
+		mGraph.Reset();
 	}
 
 	void FrameProcessor::AddInjector(const InjectProc& proc) {
+		mGraph.Release();
+
 		auto it = mInjectByType.find(proc.mTarget);
 
 		TypeInjector* injector;
@@ -144,24 +273,77 @@ namespace Morpheus {
 	}
 
 	void FrameProcessor::Flush(ITaskQueue* queue) {
+		if (!mGraph.IsCompiled())
+			Compile();
+
 		Reset();
-		mInject.SetParameters(mFrame);
-		queue->Trigger(&mInject);
-		queue->YieldUntilFinished(&mInject);
+		std::get<0>(mInjectArgs) = mFrame;
+		mGraph.Trigger(queue, mInjectNode);
+		queue->YieldUntilCondition([this]() {
+			return mGraph.IsFinished(mInjectFinishedNode);
+		});
+
+		// Nothing else runs until the next frame
+		mGraph.SetFinished(mUpdateFinishedNode);
+		mGraph.SetFinished(mRenderFinishedNode);
+		mGraph.SetFinished(mExtractFinishedNode);
+	}
+
+	void FrameProcessor::DeclareUpdate(TaskNodeIn* start, TaskNodeIn* finish, const ComponentAccess& access) {
+		// The pins are left alone, the graph orders the tasks when it is compiled
+		for (auto& other : mDeclaredUpdates) {
+			if (access.ConflictsWith(other.mAccess))
+				mOrderEdges.emplace_back(TaskGraphEdge{other.mFinish, start});
+		}
+
+		mDeclaredUpdates.emplace_back(DeclaredUpdate{start, finish, access});
 	}
 
 	void FrameProcessor::AddUpdateTask(ParameterizedTask<UpdateParams>&& task) {
+		AddUpdateTask(std::move(task), ComponentAccess().Exclusive());
+	}
+
+	void FrameProcessor::AddUpdateTask(ParameterizedTask<UpdateParams>&& task, const ComponentAccess& access) {
+		mGraph.Release();
+
+		auto in = &task->In();
+		DeclareUpdate(in, in, access);
 		mUpdate.Adopt(std::move(task));
 	}
 
+	void FrameProcessor::AddStructuralUpdateTask(ParameterizedTask<UpdateParams>&& task) {
+		mGraph.Release();
+
+		auto ptr = task.Ptr();
+
+		if (mLastStructuralUpdate)
+			mOrderEdges.emplace_back(TaskGraphEdge{&mLastStructuralUpdate->In(), &ptr->In()});
+
+		mLastStructuralUpdate = ptr;
+		mStructuralUpdate.Adopt(std::move(task));
+	}
+
 	void FrameProcessor::AddRenderTask(ParameterizedTask<RenderParams>&& task) {
+		mGraph.Release();
 		mRender.Adopt(std::move(task));
 	}
 
+	void FrameProcessor::AddExtractTask(ParameterizedTask<ExtractParams>&& task) {
+		mGraph.Release();
+		mExtract.Adopt(std::move(task));
+	}
+
 	void FrameProcessor::AddRenderGroup(ParameterizedTaskGroup<RenderParams>* group) {
+		mGraph.Release();
 		mRender.Add(group);
 	}
 	void FrameProcessor::AddUpdateGroup(ParameterizedTaskGroup<UpdateParams>* group) {
+		mGraph.Release();
+		DeclareUpdate(&group->BarrierIn().mIn, &group->BarrierOut().mIn, ComponentAccess().Exclusive());
 		mUpdate.Add(group);
 	}
+	void FrameProcessor::AddExtractGroup(ParameterizedTaskGroup<ExtractParams>* group) {
+		mGraph.Release();
+		mExtract.Add(group);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,295 @@
+#include <Engine/Systems/WorldPartition.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+namespace Morpheus {
+	std::vector<WorldCell> PartitionFrame(Frame* frame,
+		float cellSize,
+		const std::string& pathPrefix,
+		const geometry_key_func_t& geometryKeys) {
+		struct Bucket {
+			std::vector<entt::entity> mEntities;
+			BoundingBox mBounds = BoundingBox::Empty();
+		};
+
+		// Ordered, so the same frame always gives the same cells
+		std::map<std::pair<int, int>, Bucket> buckets;
+
+		for (auto child = frame->GetFirstChild(frame->mRoot);
+			child != entt::null;
+			child = frame->GetNext(child)) {
+			if (child == frame->mCamera)
+				continue;
+
+			auto transform = frame->mRegistry.try_get<Transform>(child);
+			if (!transform)
+				continue;
+
+			auto position = transform->GetTranslation();
+			auto& bucket = buckets[std::make_pair(
+				(int)std::floor(position.x / cellSize),
+				(int)std::floor(position.z / cellSize))];
+			bucket.mEntities.emplace_back(child);
+			bucket.mBounds.Grow(position);
+		}
+
+		std::vector<WorldCell> cells;
+		cells.reserve(buckets.size());
+
+		for (auto& [coords, bucket] : buckets) {
+			WorldCell cell;
+			cell.mSource = pathPrefix + std::to_string(coords.first) + "_" +
+				std::to_string(coords.second) + SCENE_ARCHIVE_EXTENSION;
+
+			// The whole square of the grid, and however high the entities go
+			cell.mBounds.mLower = DG::float3(coords.first * cellSize,
+				bucket.mBounds.mLower.y, coords.second * cellSize);
+			cell.mBounds.mUpper = DG::float3((coords.first + 1) * cellSize,
+				bucket.mBounds.mUpper.y, (coords.second + 1) * cellSize);
+
+			auto cellRoot = frame->CreateEntity();
+			for (auto e : bucket.mEntities)
+				frame->SetParent(e, cellRoot);
+
+			SceneArchive::Save(*frame, cellRoot, cell.mSource, geometryKeys);
+			frame->Destroy(cellRoot);
+
+			cells.emplace_back(std::move(cell));
+		}
+
+		return cells;
+	}
+
+	float DistanceToBox(const BoundingBox& box, const DG::float3& point) {
+		auto closest = DG::max(box.mLower, DG::min(point, box.mUpper));
+		return DG::length(point - closest);
+	}
+
+	bool GetCameraPosition(Frame* frame, DG::float3* position) {
+		if (frame->mCamera == entt::null)
+			return false;
+
+		auto& registry = frame->mRegistry;
+
+		if (auto cache = registry.try_get<RendererTransformCache>(frame->mCamera)) {
+			auto& m = cache->mCache;
+			*position = DG::float3(m.m30, m.m31, m.m32);
+			return true;
+		}
+
+		if (auto transform = registry.try_get<Transform>(frame->mCamera)) {
+			*position = transform->GetTranslation();
+			return true;
+		}
+
+		return false;
+	}
+
+	void WorldPartitionSystem::BeginRead(Cell& cell, ITaskQueue* queue) {
+		auto read = std::make_shared<PendingRead>();
+		cell.mRead = read;
+		cell.mState = CellState::READING;
+		++mPendingReads;
+
+		Task task([read, source = cell.mDesc.mSource, cache = mGeometryCache](const TaskParams& e) {
+			try {
+				std::ifstream f(source, std::ios::binary);
+
+				if (!f.is_open())
+					throw std::runtime_error("Could not open world cell " + source + "!");
+
+				SceneArchive::Read(f, cache, e.mQueue, &read->mData);
+				read->mPromise.set_value();
+			} catch (...) {
+				// Picked up by the next update, never thrown on the pool
+				read->mPromise.set_exception(std::current_exception());
+			}
+		}, std::string("Read World Cell ") + cell.mDesc.mSource, TaskType::FILE_IO);
+
+		queue->AdoptAndTrigger(std::move(task));
+	}
+
+	void WorldPartitionSystem::Activate(Frame* frame, Cell& cell, ITaskQueue* queue) {
+		cell.mRoot = SceneArchive::Instantiate(frame, cell.mRead->mData, frame->mRoot, queue);
+		cell.mRead.reset();
+		cell.mState = CellState::ACTIVE;
+	}
+
+	void WorldPartitionSystem::Deactivate(Frame* frame, Cell& cell) {
+		auto& registry = frame->mRegistry;
+
+		// Whatever was attached to the cell since it was added goes with it
+		if (registry.valid(cell.mRoot)) {
+			frame->Orphan(cell.mRoot);
+
+			std::vector<entt::entity> entities;
+			for (auto it = frame->GetIterator(cell.mRoot); it; ++it)
+				entities.emplace_back(it());
+
+			registry.destroy(entities.begin(), entities.end());
+		}
+
+		cell.mRoot = entt::null;
+		cell.mState = CellState::UNLOADED;
+	}
+
+	void WorldPartitionSystem::Update(Frame* frame, ITaskQueue* queue) {
+		DG::float3 camera;
+		if (!GetCameraPosition(frame, &camera))
+			return;
+
+		for (auto& cell : mCells) {
+			cell.mDistance = DistanceToBox(cell.mDesc.mBounds, camera);
+
+			if (cell.mState == CellState::READING &&
+				cell.mRead->mFinished.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+				--mPendingReads;
+				cell.mState = CellState::LOADED;
+
+				try {
+					cell.mRead->mFinished.get();
+				} catch (std::exception& e) {
+					std::cout << "Warning: could not stream world cell: " << e.what() << std::endl;
+					cell.mError = std::current_exception();
+				} catch (...) {
+					cell.mError = std::current_exception();
+				}
+
+				if (cell.mError) {
+					cell.mRead.reset();
+					cell.mState = CellState::FAILED;
+				}
+			}
+
+			// The camera moved away before the cell was added
+			if (cell.mState == CellState::LOADED && cell.mDistance > mParams.mUnloadDistance) {
+				cell.mRead.reset();
+				cell.mState = CellState::UNLOADED;
+			}
+		}
+
+		mOrder.resize(mCells.size());
+		for (size_t i = 0; i < mOrder.size(); ++i)
+			mOrder[i] = i;
+
+		std::sort(mOrder.begin(), mOrder.end(), [this](size_t a, size_t b) {
+			return mCells[a].mDistance < mCells[b].mDistance;
+		});
+
+		for (auto i : mOrder) {
+			if (mPendingReads >= mParams.mMaxPendingReads)
+				break;
+
+			auto& cell = mCells[i];
+			if (cell.mDistance > mParams.mLoadDistance)
+				break;
+
+			if (cell.mState == CellState::UNLOADED)
+				BeginRead(cell, queue);
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+		bool bFirst = true;
+
+		auto hasBudget = [&]() {
+			if (bFirst) {
+				bFirst = false;
+				return true;
+			}
+
+			auto elapsed = std::chrono::high_resolution_clock::now() - start;
+			return std::chrono::duration<double>(elapsed).count() < mParams.mFrameBudget;
+		};
+
+		// Removing cells first frees memory for the ones being added, furthest first
+		for (auto it = mOrder.rbegin(); it != mOrder.rend(); ++it) {
+			auto& cell = mCells[*it];
+			if (cell.mDistance <= mParams.mUnloadDistance)
+				break;
+
+			if (cell.mState == CellState::ACTIVE) {
+				if (!hasBudget())
+					return;
+				Deactivate(frame, cell);
+			}
+		}
+
+		for (auto i : mOrder) {
+			auto& cell = mCells[i];
+			if (cell.mDistance > mParams.mLoadDistance)
+				break;
+
+			// Only add cells whose geometry is in, so adding them never waits
+			if (cell.mState == CellState::LOADED && cell.mRead->mData.IsGeometryAvailable()) {
+				if (!hasBudget())
+					return;
+				Activate(frame, cell, queue);
+			}
+		}
+	}
+
+	void WorldPartitionSystem::Retry(size_t cell) {
+		if (mCells[cell].mState == CellState::FAILED) {
+			mCells[cell].mError = nullptr;
+			mCells[cell].mState = CellState::UNLOADED;
+		}
+	}
+
+	size_t WorldPartitionSystem::ActiveCellCount() const {
+		return std::count_if(mCells.begin(), mCells.end(), [](const Cell& cell) {
+			return cell.mState == CellState::ACTIVE;
+		});
+	}
+
+	Task WorldPartitionSystem::Startup(SystemCollection& systems) {
+		mGeometryCache = systems.GetCache<Geometry>();
+
+		// Cells are added and removed before any other update task starts,
+		// declared or not
+		systems.AddStructuralUpdateTask(ParameterizedTask<UpdateParams>(
+			[this](const TaskParams& e, const UpdateParams& params) {
+			Update(params.mFrame, e.mQueue);
+		}, "Stream World Cells", TaskType::UPDATE));
+
+		return Task();
+	}
+
+	bool WorldPartitionSystem::IsInitialized() const {
+		return true;
+	}
+
+	void WorldPartitionSystem::Shutdown() {
+		// Reads still in flight use the geometry cache
+		for (auto& cell : mCells) {
+			if (cell.mState == CellState::READING)
+				cell.mRead->mFinished.wait();
+
+			cell.mRead.reset();
+			cell.mError = nullptr;
+			cell.mRoot = entt::null;
+			cell.mState = CellState::UNLOADED;
+		}
+
+		mPendingReads = 0;
+	}
+
+	void WorldPartitionSystem::NewFrame(Frame* frame) {
+		// Cells that were added belong to the old frame
+		for (auto& cell : mCells) {
+			if (cell.mState == CellState::ACTIVE) {
+				cell.mRoot = entt::null;
+				cell.mState = CellState::UNLOADED;
+			}
+		}
+	}
+
+	void WorldPartitionSystem::OnAddedTo(SystemCollection& collection) {
+	}
+}
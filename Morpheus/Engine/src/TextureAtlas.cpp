@@ -0,0 +1,353 @@
+#include <Engine/TextureAtlas.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Morpheus {
+
+	static inline uint AlignUp(uint value, uint alignment) {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	SkylinePacker::SkylinePacker(uint width, uint height) :
+		mWidth(width), mHeight(height) {
+		Reset();
+	}
+
+	void SkylinePacker::Reset() {
+		mSkyline.clear();
+		mSkyline.emplace_back(Segment{0, 0, mWidth});
+		mUsedArea = 0;
+	}
+
+	bool SkylinePacker::Fits(size_t segment, uint width, uint height, uint* y) const {
+		uint x = mSkyline[segment].mX;
+		if (x + width > mWidth)
+			return false;
+
+		// The rectangle rests on the highest segment below it
+		uint top = 0;
+		uint remaining = width;
+		for (size_t i = segment; remaining > 0; ++i) {
+			top = std::max(top, mSkyline[i].mY);
+			if (top + height > mHeight)
+				return false;
+			remaining -= std::min(remaining, mSkyline[i].mWidth);
+		}
+
+		*y = top;
+		return true;
+	}
+
+	bool SkylinePacker::Insert(uint width, uint height, uint* x, uint* y) {
+		if (width == 0 || height == 0)
+			return false;
+
+		size_t best = mSkyline.size();
+		uint bestTop = 0;
+		uint bestY = 0;
+
+		for (size_t i = 0; i < mSkyline.size(); ++i) {
+			uint candidateY;
+			if (!Fits(i, width, height, &candidateY))
+				continue;
+
+			uint top = candidateY + height;
+			if (best == mSkyline.size() || top < bestTop) {
+				best = i;
+				bestTop = top;
+				bestY = candidateY;
+			}
+		}
+
+		if (best == mSkyline.size())
+			return false;
+
+		*x = mSkyline[best].mX;
+		*y = bestY;
+
+		// The new segment covers the ones the rectangle rests on
+		Segment added{*x, bestTop, width};
+		mSkyline.insert(mSkyline.begin() + best, added);
+
+		uint end = added.mX + added.mWidth;
+		size_t i = best + 1;
+		while (i < mSkyline.size() && mSkyline[i].mX < end) {
+			auto& segment = mSkyline[i];
+			uint segmentEnd = segment.mX + segment.mWidth;
+			if (segmentEnd <= end) {
+				mSkyline.erase(mSkyline.begin() + i);
+			} else {
+				segment.mWidth = segmentEnd - end;
+				segment.mX = end;
+				break;
+			}
+		}
+
+		// Neighbours at the same height become one segment
+		for (size_t j = 0; j + 1 < mSkyline.size();) {
+			if (mSkyline[j].mY == mSkyline[j + 1].mY) {
+				mSkyline[j].mWidth += mSkyline[j + 1].mWidth;
+				mSkyline.erase(mSkyline.begin() + j + 1);
+			} else {
+				++j;
+			}
+		}
+
+		mUsedArea += (size_t)width * height;
+		return true;
+	}
+
+	TextureAtlas::TextureAtlas(uint pageWidth, uint pageHeight, uint padding, bool bSRGB) :
+		mPageWidth(pageWidth),
+		mPageHeight(pageHeight),
+		mPadding(padding),
+		bSRGB(bSRGB) {
+		if (pageWidth == 0 || pageHeight == 0)
+			throw std::runtime_error("Texture atlas pages cannot be empty!");
+	}
+
+	uint8_t* TextureAtlas::GetPixels(uint page) {
+		return (uint8_t*)mPages[page].mTexture->GetSubresourcePtr(0, 0);
+	}
+
+	size_t TextureAtlas::GetRowPitch(uint page) const {
+		return mPages[page].mTexture->GetSubDataDescs()[0].mStride;
+	}
+
+	uint TextureAtlas::AddPage() {
+		DG::TextureDesc desc;
+		desc.Name = "Texture Atlas Page";
+		desc.Type = DG::RESOURCE_DIM_TEX_2D;
+		desc.Width = mPageWidth;
+		desc.Height = mPageHeight;
+		desc.MipLevels = 1;
+		desc.Format = bSRGB ? DG::TEX_FORMAT_RGBA8_UNORM_SRGB : DG::TEX_FORMAT_RGBA8_UNORM;
+		desc.BindFlags = DG::BIND_SHADER_RESOURCE;
+		desc.Usage = DG::USAGE_IMMUTABLE;
+
+		Page page(mPageWidth, mPageHeight);
+		page.mTexture.reset(new Texture(desc));
+		mPages.emplace_back(std::move(page));
+
+		auto index = (uint)mPages.size() - 1;
+		std::memset(GetPixels(index), 0, GetRowPitch(index) * mPageHeight);
+		return index;
+	}
+
+	bool TextureAtlas::Place(uint width, uint height, Entry* entry) {
+		entry->mWidth = width;
+		entry->mHeight = height;
+		entry->mCellWidth = AlignUp(width + 2 * mPadding, TEXTURE_ATLAS_ALIGNMENT);
+		entry->mCellHeight = AlignUp(height + 2 * mPadding, TEXTURE_ATLAS_ALIGNMENT);
+
+		if (entry->mCellWidth > mPageWidth || entry->mCellHeight > mPageHeight)
+			return false;
+
+		for (uint i = 0; i < mPages.size(); ++i) {
+			if (mPages[i].mPacker.Insert(entry->mCellWidth, entry->mCellHeight,
+				&entry->mCellX, &entry->mCellY)) {
+				entry->mPage = i;
+				mPages[i].mLiveArea += (size_t)entry->mCellWidth * entry->mCellHeight;
+				return true;
+			}
+		}
+
+		auto page = AddPage();
+		mPages[page].mPacker.Insert(entry->mCellWidth, entry->mCellHeight,
+			&entry->mCellX, &entry->mCellY);
+		entry->mPage = page;
+		mPages[page].mLiveArea += (size_t)entry->mCellWidth * entry->mCellHeight;
+		return true;
+	}
+
+	void TextureAtlas::WriteCell(const Entry& entry, const uint8_t* rgba, size_t rowPitch) {
+		auto pixels = GetPixels(entry.mPage);
+		auto pagePitch = GetRowPitch(entry.mPage);
+
+		int padding = (int)mPadding;
+		int width = (int)entry.mWidth;
+		int height = (int)entry.mHeight;
+
+		// The image, with its edge texels repeated out into the padding
+		for (int row = -padding; row < height + padding; ++row) {
+			int srcRow = std::min(std::max(row, 0), height - 1);
+			auto src = rgba + srcRow * rowPitch;
+			auto dest = pixels + (entry.mCellY + padding + row) * pagePitch +
+				(entry.mCellX + padding) * 4;
+
+			for (int col = -padding; col < width + padding; ++col) {
+				int srcCol = std::min(std::max(col, 0), width - 1);
+				std::memcpy(dest + col * 4, src + srcCol * 4, 4);
+			}
+		}
+
+		++mPages[entry.mPage].mVersion;
+	}
+
+	void TextureAtlas::ClearCell(const Entry& entry) {
+		auto pixels = GetPixels(entry.mPage);
+		auto pagePitch = GetRowPitch(entry.mPage);
+
+		for (uint row = 0; row < entry.mCellHeight; ++row)
+			std::memset(pixels + (entry.mCellY + row) * pagePitch + entry.mCellX * 4,
+				0, entry.mCellWidth * 4);
+
+		++mPages[entry.mPage].mVersion;
+	}
+
+	AtlasEntryId TextureAtlas::Insert(uint width, uint height,
+		const uint8_t* rgba, size_t rowPitch) {
+		if (width == 0 || height == 0)
+			throw std::runtime_error("Cannot add an empty image to a texture atlas!");
+
+		Entry entry;
+		if (!Place(width, height, &entry))
+			throw std::runtime_error("Image is too large for the texture atlas pages!");
+
+		WriteCell(entry, rgba, rowPitch);
+
+		auto id = mNextId++;
+		mEntries[id] = entry;
+		return id;
+	}
+
+	AtlasEntryId TextureAtlas::Insert(const Texture& texture) {
+		if (!texture.IsRaw())
+			throw std::runtime_error("Texture must have raw aspect to be added to an atlas!");
+
+		auto& desc = texture.GetDesc();
+		if (desc.Type != DG::RESOURCE_DIM_TEX_2D)
+			throw std::runtime_error("Only 2D textures can be added to an atlas!");
+		if (texture.GetComponentType() != DG::VT_UINT8)
+			throw std::runtime_error("Only 8 bit textures can be added to an atlas!");
+
+		int channels = texture.GetComponentCount();
+		if (channels < 1 || channels > 4)
+			throw std::runtime_error("Incorrect number of channels!");
+
+		auto& subDesc = texture.GetSubDataDescs()[0];
+		auto src = &texture.GetData()[subDesc.mSrcOffset];
+
+		std::vector<uint8_t> rgba((size_t)desc.Width * desc.Height * 4);
+		for (uint y = 0; y < desc.Height; ++y) {
+			auto srcRow = src + y * subDesc.mStride;
+			auto destRow = &rgba[(size_t)y * desc.Width * 4];
+
+			for (uint x = 0; x < desc.Width; ++x) {
+				auto texel = srcRow + x * channels;
+				auto dest = destRow + x * 4;
+				dest[0] = texel[0];
+				dest[1] = channels > 1 ? texel[1] : 0;
+				dest[2] = channels > 2 ? texel[2] : 0;
+				dest[3] = channels > 3 ? texel[3] : 255;
+			}
+		}
+
+		return Insert(desc.Width, desc.Height, &rgba[0], (size_t)desc.Width * 4);
+	}
+
+	void TextureAtlas::Remove(AtlasEntryId id) {
+		auto it = mEntries.find(id);
+		if (it == mEntries.end())
+			return;
+
+		auto& entry = it->second;
+		ClearCell(entry);
+		mPages[entry.mPage].mLiveArea -= (size_t)entry.mCellWidth * entry.mCellHeight;
+		mEntries.erase(it);
+	}
+
+	bool TextureAtlas::NeedsCompaction() const {
+		size_t used = 0;
+		size_t live = 0;
+		for (auto& page : mPages) {
+			used += page.mPacker.GetUsedArea();
+			live += page.mLiveArea;
+		}
+
+		return used > 0 && (float)live < (float)used * TEXTURE_ATLAS_COMPACT_RATIO;
+	}
+
+	uint TextureAtlas::Compact() {
+		std::vector<Page> oldPages;
+		std::swap(oldPages, mPages);
+
+		// Tallest first packs best with a skyline
+		std::vector<Entry*> entries;
+		entries.reserve(mEntries.size());
+		for (auto& it : mEntries)
+			entries.emplace_back(&it.second);
+
+		std::sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) {
+			if (a->mCellHeight != b->mCellHeight)
+				return a->mCellHeight > b->mCellHeight;
+			return a->mCellWidth > b->mCellWidth;
+		});
+
+		for (auto entry : entries) {
+			Entry moved;
+			Place(entry->mWidth, entry->mHeight, &moved);
+
+			// Cells are the same size wherever they go, padding included
+			auto& oldPage = oldPages[entry->mPage];
+			auto src = (const uint8_t*)oldPage.mTexture->GetSubresourcePtr(0, 0);
+			auto srcPitch = oldPage.mTexture->GetSubDataDescs()[0].mStride;
+			auto dest = GetPixels(moved.mPage);
+			auto destPitch = GetRowPitch(moved.mPage);
+
+			for (uint row = 0; row < moved.mCellHeight; ++row)
+				std::memcpy(dest + (moved.mCellY + row) * destPitch + moved.mCellX * 4,
+					src + (entry->mCellY + row) * srcPitch + entry->mCellX * 4,
+					moved.mCellWidth * 4);
+
+			*entry = moved;
+		}
+
+		// Pages that keep their index still need a new version
+		for (uint i = 0; i < mPages.size(); ++i)
+			mPages[i].mVersion = i < oldPages.size() ? oldPages[i].mVersion + 1 : 0;
+
+		++mCompactCount;
+		return (uint)(oldPages.size() - std::min(oldPages.size(), mPages.size()));
+	}
+
+	uint TextureAtlas::GetPage(AtlasEntryId id) const {
+		return mEntries.at(id).mPage;
+	}
+
+	SpriteRect TextureAtlas::GetRect(AtlasEntryId id) const {
+		auto& entry = mEntries.at(id);
+		return SpriteRect((float)(entry.mCellX + mPadding), (float)(entry.mCellY + mPadding),
+			(float)entry.mWidth, (float)entry.mHeight);
+	}
+
+	SpriteRect TextureAtlas::Remap(AtlasEntryId id, const SpriteRect& rect) const {
+		auto bounds = GetRect(id);
+		return SpriteRect(bounds.mPosition + rect.mPosition, rect.mSize);
+	}
+
+	DG::float4 TextureAtlas::GetUVs(AtlasEntryId id) const {
+		auto rect = GetRect(id);
+		return DG::float4(rect.mPosition.x / mPageWidth,
+			rect.mPosition.y / mPageHeight,
+			(rect.mPosition.x + rect.mSize.x) / mPageWidth,
+			(rect.mPosition.y + rect.mSize.y) / mPageHeight);
+	}
+
+	DG::float2 TextureAtlas::RemapUV(AtlasEntryId id, const DG::float2& uv) const {
+		auto uvs = GetUVs(id);
+		return DG::float2(uvs.x + uv.x * (uvs.z - uvs.x),
+			uvs.y + uv.y * (uvs.w - uvs.y));
+	}
+
+	uint TextureAtlas::GetSafeMipCount() const {
+		// Texels of mip m cover 2^m texels of the page. They stay inside a
+		// cell while cells are aligned to 2^m, and filtering stays out of
+		// the neighbours while the padding is at least 2^m wide.
+		uint count = 1;
+		while ((TEXTURE_ATLAS_ALIGNMENT % (1u << count)) == 0 && mPadding >= (1u << count))
+			++count;
+		return count;
+	}
+}
@@ -1,5 +1,8 @@
 #include <Engine/ThreadPool.hpp>
+#include <Engine/ComponentAccess.hpp>
+
 #include <iostream>
+#include <unordered_set>
 
 #ifdef THREAD_POOL_DEBUG
 std::mutex gPoolOutput;
@@ -134,6 +137,13 @@ namespace Morpheus {
 	}
 
 	void ITaskQueue::Trigger(TaskNodeIn* in, bool bFromNodeOut) {
+		// Compiled graphs count their inputs themselves
+		if (in->mOwnerType == TaskPinOwnerType::GRAPH) {
+			auto pin = in->mOwner.mGraphPin;
+			pin->mGraph->Finish(this, pin->mNode);
+			return;
+		}
+
 		bool bActuallyTrigger = false;
 		{
 			std::lock_guard<std::mutex> lock(in->mMutex);
@@ -390,4 +400,287 @@ namespace Morpheus {
 
 		return ptr;
 	}
+
+	struct ParallelForState {
+		std::function<void(size_t, size_t)> mKernel;
+		size_t mCount;
+		size_t mChunkSize;
+		size_t mChunkCount;
+		const ComponentAccess* mAccess;
+		std::atomic<size_t> mNextChunk;
+		std::atomic<size_t> mChunksFinished;
+
+		// Claims chunks until none are left
+		void Work() {
+			while (true) {
+				size_t chunk = mNextChunk.fetch_add(1, std::memory_order_relaxed);
+				if (chunk >= mChunkCount)
+					return;
+
+				size_t begin = chunk * mChunkSize;
+				mKernel(begin, std::min(begin + mChunkSize, mCount));
+				mChunksFinished.fetch_add(1, std::memory_order_release);
+			}
+		}
+	};
+
+	void ParallelFor(ITaskQueue* queue,
+		size_t count,
+		size_t chunkSize,
+		const std::function<void(size_t, size_t)>& kernel,
+		TaskType type) {
+		if (count == 0)
+			return;
+
+		chunkSize = std::max<size_t>(chunkSize, 1);
+		size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+		if (!queue || chunkCount == 1) {
+			for (size_t begin = 0; begin < count; begin += chunkSize)
+				kernel(begin, std::min(begin + chunkSize, count));
+			return;
+		}
+
+		// Helpers may outlive this call, but they will not find any chunks left by then
+		auto state = std::make_shared<ParallelForState>();
+		state->mKernel = kernel;
+		state->mCount = count;
+		state->mChunkSize = chunkSize;
+		state->mChunkCount = chunkCount;
+		state->mAccess = GetCurrentComponentAccess();
+		state->mNextChunk = 0;
+		state->mChunksFinished = 0;
+
+		// Helpers beyond the threads of the queue would never start in time
+		size_t helperCount = std::min<size_t>(chunkCount - 1,
+			std::max<uint>(queue->ThreadCount(), 1u) - 1);
+
+		for (size_t i = 0; i < helperCount; ++i) {
+			Task helper([state](const TaskParams& e) {
+				// Chunks are checked against the access of the caller, wherever they run
+				ComponentAccessScope scope(state->mAccess);
+				state->Work();
+			}, "Parallel For Helper", type);
+
+			queue->AdoptAndTrigger(std::move(helper));
+		}
+
+		state->Work();
+
+		while (state->mChunksFinished.load(std::memory_order_acquire) < chunkCount)
+			std::this_thread::yield();
+	}
+
+	void CompiledTaskGraph::Compile(const std::vector<TaskNodeIn*>& entries,
+		const std::vector<TaskGraphEdge>& edges) {
+		Release();
+
+		std::unordered_map<const TaskNodeIn*, uint> indices;
+		std::vector<TaskNodeIn*> found;
+		std::vector<std::vector<uint>> successors;
+
+		auto visit = [&](TaskNodeIn* in) -> uint {
+			auto it = indices.find(in);
+			if (it != indices.end())
+				return it->second;
+
+			uint index = found.size();
+			indices.emplace(in, index);
+			found.push_back(in);
+			successors.emplace_back();
+			return index;
+		};
+
+		auto getOut = [](TaskNodeIn* in) -> TaskNodeOut* {
+			if (in->mOwnerType == TaskPinOwnerType::TASK)
+				return &in->mOwner.mTask->Out();
+			else
+				return &in->mOwner.mBarrier->mOut;
+		};
+
+		for (auto entry : entries) {
+			if (entry->mOwnerType != TaskPinOwnerType::GRAPH)
+				visit(entry);
+		}
+
+		// Everything that is reachable from the entries
+		for (uint i = 0; i < found.size(); ++i) {
+			for (auto next : getOut(found[i])->mOutputs) {
+				if (next->mOwnerType == TaskPinOwnerType::GRAPH)
+					continue;
+
+				uint j = visit(next);
+				successors[i].push_back(j);
+			}
+		}
+
+		for (auto& edge : edges) {
+			auto from = indices.find(edge.mFrom);
+			auto to = indices.find(edge.mTo);
+			if (from == indices.end() || to == indices.end())
+				throw std::runtime_error("Task graph edge has a node outside of the graph!");
+			successors[from->second].push_back(to->second);
+		}
+
+		std::unordered_set<const TaskNodeOut*> outs;
+		for (auto in : found)
+			outs.emplace(getOut(in));
+
+		for (auto in : found) {
+			for (auto input : in->mInputs) {
+				if (!outs.count(input) && !input->bIsFinished)
+					throw std::runtime_error("Task graph has an unfinished input from outside of the graph!");
+			}
+		}
+
+		std::vector<uint> inputCounts(found.size(), 0);
+		for (auto& list : successors) {
+			for (auto j : list)
+				++inputCounts[j];
+		}
+
+		// Lay the nodes out in topological order
+		std::vector<uint> order;
+		std::vector<uint> inputsLeft = inputCounts;
+		order.reserve(found.size());
+
+		for (uint i = 0; i < found.size(); ++i) {
+			if (inputsLeft[i] == 0)
+				order.push_back(i);
+		}
+
+		for (uint k = 0; k < order.size(); ++k) {
+			for (auto j : successors[order[k]]) {
+				if (--inputsLeft[j] == 0)
+					order.push_back(j);
+			}
+		}
+
+		if (order.size() != found.size())
+			throw std::runtime_error("Task graph contains a cycle!");
+
+		std::vector<uint> position(found.size());
+		for (uint k = 0; k < order.size(); ++k)
+			position[order[k]] = k;
+
+		uint count = found.size();
+		mNodes.resize(count);
+		mInputsLeft.reset(new std::atomic<uint>[count]);
+		mFinished.reset(new std::atomic<bool>[count]);
+		mFinishTimes.reset(new std::chrono::high_resolution_clock::time_point[count]);
+		mPins.reset(new CompiledTaskGraphPin[count]);
+
+		for (uint k = 0; k < count; ++k) {
+			auto in = found[order[k]];
+			auto& node = mNodes[k];
+
+			node.mInputCount = inputCounts[order[k]];
+			node.mSuccessorBegin = mSuccessors.size();
+			for (auto j : successors[order[k]])
+				mSuccessors.push_back(position[j]);
+			node.mSuccessorEnd = mSuccessors.size();
+
+			mPins[k].mGraph = this;
+			mPins[k].mNode = k;
+			mNodeIndices.emplace(in, k);
+
+			if (in->mOwnerType == TaskPinOwnerType::TASK) {
+				node.mTask = in->mOwner.mTask;
+
+				// The task now reports to the graph instead of its successors
+				auto& out = node.mTask->Out();
+				node.mSavedInputs = std::move(in->mInputs);
+				node.mSavedOutputs = std::move(out.mOutputs);
+				in->mInputs.clear();
+				out.mOutputs.clear();
+				out.mOutputs.push_back(&mPins[k].mIn);
+			} else {
+				node.mBarrier = in->mOwner.mBarrier;
+			}
+		}
+
+		bCompiled = true;
+		Reset();
+	}
+
+	void CompiledTaskGraph::Release() {
+		if (!bCompiled)
+			return;
+
+		for (auto& node : mNodes) {
+			if (node.mTask) {
+				auto& in = node.mTask->In();
+				auto& out = node.mTask->Out();
+				in.mInputs = std::move(node.mSavedInputs);
+				out.mOutputs = std::move(node.mSavedOutputs);
+				// So that new connections to the task are not skipped
+				in.ResetUnsafe();
+				out.ResetUnsafe();
+			}
+		}
+
+		mNodes.clear();
+		mSuccessors.clear();
+		mInputsLeft.reset();
+		mFinished.reset();
+		mFinishTimes.reset();
+		mPins.reset();
+		mNodeIndices.clear();
+		bCompiled = false;
+	}
+
+	void CompiledTaskGraph::Reset() {
+		for (uint i = 0; i < mNodes.size(); ++i) {
+			auto& node = mNodes[i];
+			mInputsLeft[i].store(node.mInputCount, std::memory_order_relaxed);
+			mFinished[i].store(false, std::memory_order_relaxed);
+			mFinishTimes[i] = std::chrono::high_resolution_clock::time_point();
+
+			if (node.mTask) {
+				// Drop whatever the task waited on last time
+				node.mTask->In().mInputs.clear();
+				node.mTask->ResetUnsafe();
+			}
+		}
+	}
+
+	void CompiledTaskGraph::Trigger(ITaskQueue* queue, uint node) {
+		if (mNodes[node].mInputCount != 0)
+			throw std::runtime_error("Only nodes without inputs can be triggered!");
+
+		Start(queue, node);
+	}
+
+	void CompiledTaskGraph::SetFinished(uint node) {
+		mFinished[node].store(true, std::memory_order_release);
+	}
+
+	uint CompiledTaskGraph::FindNode(const TaskBarrier* barrier) const {
+		auto it = mNodeIndices.find(&barrier->mIn);
+		if (it == mNodeIndices.end())
+			throw std::runtime_error("Barrier is not part of the task graph!");
+		return it->second;
+	}
+
+	void CompiledTaskGraph::Start(ITaskQueue* queue, uint node) {
+		auto task = mNodes[node].mTask;
+
+		// Barriers do no work, so they finish right away
+		if (task)
+			queue->Trigger(task);
+		else
+			Finish(queue, node);
+	}
+
+	void CompiledTaskGraph::Finish(ITaskQueue* queue, uint node) {
+		mFinishTimes[node] = std::chrono::high_resolution_clock::now();
+		mFinished[node].store(true, std::memory_order_release);
+
+		auto& n = mNodes[node];
+		for (uint i = n.mSuccessorBegin; i < n.mSuccessorEnd; ++i) {
+			uint next = mSuccessors[i];
+			if (mInputsLeft[next].fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Start(queue, next);
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include <Engine/Core.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/Components/Transform.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+
+using namespace Morpheus;
+
+BoundingBox UnitBox(const DG::float3& center) {
+	return BoundingBox{center - DG::float3(0.5f, 0.5f, 0.5f), center + DG::float3(0.5f, 0.5f, 0.5f)};
+}
+
+// Largest signed distance of any corner of the transformed box to the plane
+float MaxCornerDistance(const DG::float4& plane, const BoundingBox& box, const DG::float4x4& transform) {
+	float result = -std::numeric_limits<float>::infinity();
+
+	for (int i = 0; i < 8; ++i) {
+		DG::float4 corner(
+			(i & 1) ? box.mUpper.x : box.mLower.x,
+			(i & 2) ? box.mUpper.y : box.mLower.y,
+			(i & 4) ? box.mUpper.z : box.mLower.z, 1.0f);
+		auto p = corner * transform;
+		result = std::max(result, plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w);
+	}
+
+	return result;
+}
+
+int main() {
+	Camera camera;
+	camera.SetEye(0.0f, 0.0f, 0.0f);
+	camera.LookAt(0.0f, 0.0f, 1.0f);
+	camera.SetClipPlanes(0.1f, 100.0f);
+
+	for (bool bIsGL : { false, true }) {
+		Frustum frustum = Frustum::FromCamera(camera, nullptr,
+			camera.GetProjection(1.0f, bIsGL), bIsGL);
+
+		assert(frustum.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, 10.0f))));
+		assert(!frustum.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, -10.0f))));
+		assert(!frustum.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, 200.0f))));
+		assert(!frustum.IsVisible(UnitBox(DG::float3(100.0f, 0.0f, 10.0f))));
+		assert(!frustum.IsVisible(UnitBox(DG::float3(0.0f, -100.0f, 10.0f))));
+
+		// Straddles the far plane
+		assert(frustum.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, 100.0f))));
+
+		// The near plane has to be in the same place for either convention
+		BoundingBox nearBox{DG::float3(-0.01f, -0.01f, 0.01f), DG::float3(0.01f, 0.01f, 0.05f)};
+		assert(!frustum.IsVisible(nearBox));
+		nearBox.mLower.z += 0.1f;
+		nearBox.mUpper.z += 0.1f;
+		assert(frustum.IsVisible(nearBox));
+
+		// Empty boxes are always kept
+		assert(frustum.IsVisible(BoundingBox::Empty()));
+	}
+
+	Frustum frustum = Frustum::FromCamera(camera, nullptr,
+		camera.GetProjection(1.0f, false), false);
+
+	// The box is tested with its transform, not as an axis aligned box of its bounds
+	auto box = UnitBox(DG::float3(0.0f, 0.0f, 0.0f));
+	auto rotation = DG::Quaternion::RotationFromAxisAngle(DG::float3(0.0f, 1.0f, 0.0f), DG::PI_F / 4.0f);
+
+	assert(frustum.IsVisible(box,
+		Transform(DG::float3(0.0f, 0.0f, 10.0f), rotation, DG::float3(1.0f, 1.0f, 1.0f)).ToMatrix()));
+	assert(!frustum.IsVisible(box,
+		Transform(DG::float3(50.0f, 0.0f, 10.0f), rotation, DG::float3(1.0f, 1.0f, 1.0f)).ToMatrix()));
+	assert(frustum.IsVisible(box,
+		Transform(DG::float3(50.0f, 0.0f, 10.0f), rotation, DG::float3(100.0f, 1.0f, 1.0f)).ToMatrix()));
+
+	// A camera node moves the frustum with it
+	auto cameraTransform = Transform(DG::float3(0.0f, 0.0f, 20.0f)).ToMatrix();
+	Frustum moved = Frustum::FromCamera(camera, &cameraTransform,
+		camera.GetProjection(1.0f, false), false);
+	assert(!moved.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, 10.0f))));
+	assert(moved.IsVisible(UnitBox(DG::float3(0.0f, 0.0f, 30.0f))));
+
+	// Against a brute force test of every corner
+	std::mt19937 gen(0);
+	std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> size(0.1f, 10.0f);
+	std::uniform_real_distribution<float> angle(-DG::PI_F, DG::PI_F);
+
+	int visibleCount = 0;
+	int testedCount = 0;
+
+	for (int i = 0; i < 100000; ++i) {
+		DG::float3 lower(position(gen), position(gen), position(gen));
+		BoundingBox randomBox{lower, lower + DG::float3(size(gen), size(gen), size(gen))};
+
+		auto transform = Transform(DG::float3(position(gen), position(gen), position(gen)),
+			DG::Quaternion::RotationFromAxisAngle(DG::normalize(DG::float3(
+				position(gen), position(gen), position(gen))), angle(gen)),
+			DG::float3(size(gen), size(gen), size(gen))).ToMatrix();
+
+		bool bExpected = true;
+		bool bBorderline = false;
+		for (int p = 0; p < 6; ++p) {
+			float d = MaxCornerDistance(frustum.GetPlane((FrustumPlane)p), randomBox, transform);
+			if (std::abs(d) < 1e-2f)
+				bBorderline = true;
+			if (d < 0.0f)
+				bExpected = false;
+		}
+
+		if (bBorderline)
+			continue;
+
+		bool bVisible = frustum.IsVisible(randomBox, transform);
+		assert(bVisible == bExpected);
+
+		visibleCount += bVisible;
+		++testedCount;
+	}
+
+	std::cout << visibleCount << " of " << testedCount << " random boxes visible" << std::endl;
+	assert(visibleCount > 0 && visibleCount < testedCount);
+
+	std::cout << "Culling test passed" << std::endl;
+}
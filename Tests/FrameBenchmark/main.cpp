@@ -0,0 +1,171 @@
+#include <Engine/Core.hpp>
+#include <Engine/Frame.hpp>
+#include <Engine/Systems/EmptyRenderer.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+using namespace Morpheus;
+
+struct BenchmarkParams {
+	uint mEntities = 100000;
+	uint mDepth = 4;
+	uint mMeshes = 64;
+	uint mFrames = 300;
+	uint mThreads = std::thread::hardware_concurrency();
+	// Fraction of the roots that move every frame
+	float mMovingFraction = 0.1f;
+	double mTimeStep = 1.0 / 60.0;
+};
+
+// Spreads the entities evenly over mDepth levels. Every entity below the
+// first level gets a random parent in the level above and one of the meshes.
+std::vector<entt::entity> BuildScene(Frame& frame,
+	const BenchmarkParams& params,
+	const std::vector<Handle<Geometry>>& meshes,
+	std::mt19937& gen) {
+	std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+	std::uniform_int_distribution<size_t> meshDist(0, meshes.size() - 1);
+
+	uint perLevel = std::max(params.mEntities / std::max(params.mDepth, 1u), 1u);
+	std::vector<entt::entity> roots;
+	std::vector<entt::entity> previous;
+	std::vector<entt::entity> current;
+
+	for (uint level = 0; level < params.mDepth; ++level) {
+		current.clear();
+
+		for (uint i = 0; i < perLevel; ++i) {
+			entt::entity parent = frame.mRoot;
+			if (level > 0) {
+				std::uniform_int_distribution<size_t> parentDist(0, previous.size() - 1);
+				parent = previous[parentDist(gen)];
+			}
+
+			auto e = frame.CreateEntity(parent);
+			frame.Emplace<Transform>(e, Transform(DG::float3(dist(gen), dist(gen), dist(gen))));
+
+			StaticMeshComponent mesh;
+			mesh.mGeometry = meshes[meshDist(gen)];
+			frame.Emplace<StaticMeshComponent>(e, std::move(mesh));
+
+			current.push_back(e);
+		}
+
+		if (level == 0)
+			roots = current;
+		std::swap(previous, current);
+	}
+
+	return roots;
+}
+
+struct StageStats {
+	std::vector<double> mSamples;
+
+	void Print(const char* name) {
+		if (mSamples.empty())
+			return;
+
+		std::sort(mSamples.begin(), mSamples.end());
+
+		double sum = 0.0;
+		for (auto sample : mSamples)
+			sum += sample;
+
+		auto percentile = [this](double p) {
+			return mSamples[std::min<size_t>(mSamples.size() * p, mSamples.size() - 1)];
+		};
+
+		std::cout << std::setw(12) << name << std::fixed << std::setprecision(3)
+			<< std::setw(10) << 1000.0 * sum / mSamples.size()
+			<< std::setw(10) << 1000.0 * percentile(0.5)
+			<< std::setw(10) << 1000.0 * percentile(0.95)
+			<< std::setw(10) << 1000.0 * mSamples.back() << std::endl;
+	}
+};
+
+// Usage: FrameBenchmark [entities] [depth] [meshes] [frames] [threads]
+int main(int argc, char** argv) {
+	BenchmarkParams params;
+	if (argc > 1) params.mEntities = std::stoul(argv[1]);
+	if (argc > 2) params.mDepth = std::stoul(argv[2]);
+	if (argc > 3) params.mMeshes = std::max<uint>(std::stoul(argv[3]), 1u);
+	if (argc > 4) params.mFrames = std::stoul(argv[4]);
+	if (argc > 5) params.mThreads = std::max<uint>(std::stoul(argv[5]), 1u);
+
+	ThreadPool pool;
+	pool.Startup(params.mThreads);
+
+	// Meshes only need distinct geometry to batch on, nothing is uploaded
+	std::vector<Handle<Geometry>> meshes;
+	for (uint i = 0; i < params.mMeshes; ++i)
+		meshes.emplace_back(Geometry());
+
+	std::mt19937 gen(0);
+	auto frame = std::make_unique<Frame>();
+	auto roots = BuildScene(*frame, params, meshes, gen);
+
+	size_t movingCount = roots.size() * params.mMovingFraction;
+
+	SystemCollection systems;
+	auto renderer = systems.Add<EmptyRenderer>();
+
+	// Spins a slice of the roots every frame, which dirties their subtrees
+	systems.AddUpdateTask([&roots, movingCount](const TaskParams& e, const UpdateParams& params) {
+		auto& registry = params.mFrame->mRegistry;
+		auto rotation = DG::Quaternion::RotationFromAxisAngle(
+			DG::float3(0.0f, 1.0f, 0.0f), (float)params.mTime.mCurrentTime);
+
+		for (size_t i = 0; i < movingCount; ++i) {
+			registry.patch<Transform>(roots[i], [&rotation](Transform& transform) {
+				transform.SetRotation(rotation);
+			});
+		}
+	}, ComponentAccess().Write<Transform>(), "Move Roots");
+
+	systems.Startup(&pool);
+	systems.SetFrame(frame.get());
+
+	StageStats update, extract, drawList, total;
+	auto frameStart = std::chrono::high_resolution_clock::now();
+
+	systems.RunFixedStep(&pool, params.mTimeStep, params.mFrames, true, [&](uint i) {
+		auto now = std::chrono::high_resolution_clock::now();
+		auto timings = systems.GetFrameProcessor().GetStageTimings();
+
+		// The first frame waits for its own extraction, skip it
+		if (i > 0) {
+			update.mSamples.push_back(timings.mUpdate);
+			extract.mSamples.push_back(timings.mExtract);
+			drawList.mSamples.push_back(timings.mRender);
+			total.mSamples.push_back(std::chrono::duration<double>(now - frameStart).count());
+		}
+
+		frameStart = now;
+	});
+
+	std::cout << params.mEntities << " entities, depth " << params.mDepth << ", "
+		<< params.mMeshes << " meshes, " << params.mFrames << " frames, "
+		<< pool.ThreadCount() << " threads" << std::endl;
+	std::cout << "Draw list: " << renderer->GetDrawList().size() << " batches, "
+		<< renderer->GetInstanceData().size() << " instances, "
+		<< renderer->GetDrawStats().mMaterialChanges << " material changes, "
+		<< renderer->GetInstanceBuffer().GetDirtyCount() << " instances uploaded" << std::endl;
+
+	std::cout << std::setw(12) << "stage (ms)" << std::setw(10) << "mean"
+		<< std::setw(10) << "median" << std::setw(10) << "p95"
+		<< std::setw(10) << "max" << std::endl;
+	update.Print("update");
+	extract.Print("extract");
+	drawList.Print("draw list");
+	total.Print("frame");
+
+	frame.reset();
+	systems.Shutdown();
+	pool.Shutdown();
+}
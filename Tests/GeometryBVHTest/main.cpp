@@ -0,0 +1,296 @@
+#include <Engine/Core.hpp>
+#include <Engine/GeometryBVH.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <stdexcept>
+
+using namespace Morpheus;
+
+// Vectors in double precision, so the reference does not share the rounding
+// of the float code it checks
+struct Vec3d {
+	double x, y, z;
+};
+
+Vec3d ToDouble(const DG::float3& v) {
+	return Vec3d{v.x, v.y, v.z};
+}
+
+Vec3d Sub(const Vec3d& a, const Vec3d& b) {
+	return Vec3d{a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+Vec3d Cross(const Vec3d& a, const Vec3d& b) {
+	return Vec3d{a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+double Dot(const Vec3d& a, const Vec3d& b) {
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// Written independently of IntersectTriangle: the ray meets the plane of the
+// triangle, then the point is weighed against the three edges. The margin is
+// the smallest barycentric coordinate of the point, negative outside.
+bool ReferenceIntersect(const Ray& ray,
+	const DG::float3& fa, const DG::float3& fb, const DG::float3& fc,
+	double* t, double* margin) {
+	auto a = ToDouble(fa);
+	auto b = ToDouble(fb);
+	auto c = ToDouble(fc);
+	auto start = ToDouble(ray.mStart);
+	auto direction = ToDouble(ray.mDirection);
+
+	auto normal = Cross(Sub(b, a), Sub(c, a));
+	double area = Dot(normal, normal);
+	double denom = Dot(normal, direction);
+	if (area == 0.0 || denom == 0.0)
+		return false;
+
+	*t = Dot(normal, Sub(a, start)) / denom;
+	if (*t < 0.0)
+		return false;
+
+	Vec3d p{start.x + *t * direction.x, start.y + *t * direction.y, start.z + *t * direction.z};
+	double wa = Dot(Cross(Sub(b, p), Sub(c, p)), normal) / area;
+	double wb = Dot(Cross(Sub(c, p), Sub(a, p)), normal) / area;
+	double wc = Dot(Cross(Sub(a, p), Sub(b, p)), normal) / area;
+	*margin = std::min(wa, std::min(wb, wc));
+	return true;
+}
+
+// Rays that graze an edge may go either way in float
+#define EDGE_TOLERANCE 1e-4
+#define DISTANCE_TOLERANCE 1e-4
+
+void CheckClosest(const GeometryBVH& bvh, const Ray& ray, bool bHit, const BVHHit& hit) {
+	auto& positions = bvh.GetPositions();
+	auto& indices = bvh.GetIndices();
+	auto& triangles = bvh.GetTriangles();
+
+	// Closest triangle the ray is clearly inside of
+	double closestInside = std::numeric_limits<double>::infinity();
+	bool bFoundHit = false;
+
+	for (size_t i = 0; i < triangles.size(); ++i) {
+		double t, margin;
+		if (!ReferenceIntersect(ray,
+			positions[indices[3 * i]],
+			positions[indices[3 * i + 1]],
+			positions[indices[3 * i + 2]],
+			&t, &margin))
+			continue;
+
+		if (margin > EDGE_TOLERANCE)
+			closestInside = std::min(closestInside, t);
+
+		// The hit that was reported is a real one
+		if (bHit && triangles[i] == hit.mTriangle) {
+			assert(margin >= -EDGE_TOLERANCE);
+			assert(std::abs(t - hit.mDistance) <= DISTANCE_TOLERANCE * std::max(1.0, t));
+			bFoundHit = true;
+		}
+	}
+
+	if (bHit) {
+		assert(bFoundHit);
+		assert(hit.mDistance <= closestInside + DISTANCE_TOLERANCE * std::max(1.0, closestInside));
+	} else {
+		assert(closestInside == std::numeric_limits<double>::infinity());
+	}
+}
+
+void TestRays(const GeometryBVH& bvh, std::mt19937& gen) {
+	auto box = bvh.GetBoundingBox();
+	std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+	auto randomPoint = [&]() {
+		return DG::float3(
+			box.mLower.x + dist(gen) * (box.mUpper.x - box.mLower.x),
+			box.mLower.y + dist(gen) * (box.mUpper.y - box.mLower.y),
+			box.mLower.z + dist(gen) * (box.mUpper.z - box.mLower.z));
+	};
+
+	for (int i = 0; i < 1000; ++i) {
+		Ray ray;
+		ray.mStart = box.mLower - box.Extents() + 3.0f * box.Extents() *
+			DG::float3(dist(gen), dist(gen), dist(gen));
+		ray.mDirection = randomPoint() - ray.mStart;
+
+		BVHHit hit;
+		bool bHit = bvh.IntersectClosest(ray, &hit);
+
+		CheckClosest(bvh, ray, bHit, hit);
+		assert(bvh.IntersectAny(ray) == bHit);
+	}
+
+	for (int i = 0; i < 100; ++i) {
+		BoundingBox query;
+		query.mLower = randomPoint();
+		query.mUpper = query.mLower + 0.1f * box.Extents();
+
+		std::vector<uint32_t> result;
+		bvh.Query(query, &result);
+
+		auto& positions = bvh.GetPositions();
+		auto& indices = bvh.GetIndices();
+		size_t expectedCount = 0;
+		for (size_t t = 0; t < bvh.GetTriangleCount(); ++t) {
+			if (IntersectTriangle(query,
+				positions[indices[3 * t]],
+				positions[indices[3 * t + 1]],
+				positions[indices[3 * t + 2]]))
+				++expectedCount;
+		}
+
+		assert(result.size() == expectedCount);
+	}
+}
+
+// The same hit, whatever the size of the triangle and the length of the ray
+void TestScale() {
+	for (float scale : { 1e-4f, 1.0f, 1e4f }) {
+		for (float length : { 1e-3f, 1.0f, 1e3f }) {
+			DG::float3 a(0.0f, 0.0f, 0.0f);
+			DG::float3 b(scale, 0.0f, 0.0f);
+			DG::float3 c(0.0f, scale, 0.0f);
+
+			Ray ray;
+			ray.mStart = DG::float3(0.25f * scale, 0.25f * scale, scale);
+			ray.mDirection = DG::float3(0.0f, 0.0f, -length);
+
+			float t;
+			DG::float2 bary;
+			assert(IntersectTriangle(ray, a, b, c, std::numeric_limits<float>::infinity(), &t, &bary));
+			assert(std::abs(t * length - scale) <= 1e-5f * scale);
+			assert(std::abs(bary.x - 0.25f) < 1e-5f && std::abs(bary.y - 0.25f) < 1e-5f);
+
+			// Parallel to the triangle
+			ray.mDirection = DG::float3(length, 0.0f, 0.0f);
+			assert(!IntersectTriangle(ray, a, b, c, std::numeric_limits<float>::infinity(), &t, &bary));
+		}
+	}
+}
+
+bool SetThrows(const std::function<void(std::vector<BVHNode>&, std::vector<uint32_t>&)>& corrupt,
+	uint32_t depth = 1) {
+	// A chain of interior nodes, each with a leaf on the left
+	std::vector<BVHNode> nodes;
+	for (uint32_t i = 0; i < depth; ++i) {
+		BVHNode interior{};
+		interior.mOffset = 2 * i + 2;
+		nodes.emplace_back(interior);
+
+		BVHNode leaf{};
+		leaf.mCount = 1;
+		nodes.emplace_back(leaf);
+	}
+
+	BVHNode last{};
+	last.mCount = 1;
+	nodes.emplace_back(last);
+
+	std::vector<uint32_t> indices = { 0, 1, 2 };
+	corrupt(nodes, indices);
+
+	GeometryBVH bvh;
+	try {
+		bvh.Set(std::move(nodes),
+			std::vector<DG::float3>(3, DG::float3(0.0f, 0.0f, 0.0f)),
+			std::move(indices),
+			std::vector<uint32_t>{ 0 });
+	} catch (std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+// Trees that did not come from the builder are checked before traversal uses them
+void TestValidation() {
+	auto keep = [](std::vector<BVHNode>&, std::vector<uint32_t>&) { };
+	assert(!SetThrows(keep));
+	assert(!SetThrows(keep, BVH_MAX_DEPTH));
+	assert(SetThrows(keep, BVH_MAX_DEPTH + 1));
+
+	assert(SetThrows([](std::vector<BVHNode>& nodes, std::vector<uint32_t>&) {
+		nodes[0].mOffset = (uint32_t)nodes.size();
+	}));
+	assert(SetThrows([](std::vector<BVHNode>& nodes, std::vector<uint32_t>&) {
+		nodes[0].mOffset = 0;
+	}));
+	assert(SetThrows([](std::vector<BVHNode>& nodes, std::vector<uint32_t>&) {
+		nodes[1].mOffset = 1;
+	}));
+	assert(SetThrows([](std::vector<BVHNode>& nodes, std::vector<uint32_t>&) {
+		nodes.emplace_back(nodes.back());
+	}));
+	assert(SetThrows([](std::vector<BVHNode>&, std::vector<uint32_t>& indices) {
+		indices[2] = 3;
+	}));
+	assert(SetThrows([](std::vector<BVHNode>&, std::vector<uint32_t>& indices) {
+		indices.pop_back();
+	}));
+
+	// Misses leave the hit as it was
+	GeometryBVH bvh;
+	bvh.Set({}, {}, {}, {});
+	Ray ray;
+	ray.mStart = DG::float3(0.0f, 0.0f, 0.0f);
+	ray.mDirection = DG::float3(0.0f, 0.0f, 1.0f);
+	BVHHit hit;
+	assert(!bvh.IntersectClosest(ray, &hit));
+	assert(hit.mBarycentrics.x == 0.0f && hit.mBarycentrics.y == 0.0f);
+}
+
+int main() {
+	TestScale();
+	TestValidation();
+
+	ThreadPool pool;
+	pool.Startup();
+
+	std::mt19937 gen(0);
+
+	auto geometry = Geometry::Prefabs::StanfordBunny(
+		VertexLayout::PositionUVNormalTangent());
+
+	GeometryBVH bvh;
+	{
+		auto task = bvh.BuildTask(&geometry);
+		auto ptr = pool.Adopt(std::move(task));
+		pool.Trigger(ptr);
+		pool.YieldUntilFinished(ptr);
+	}
+
+	assert(!bvh.IsEmpty());
+	assert(bvh.GetTriangleCount() ==
+		geometry.GetIndexedDrawAttribs().NumIndices / 3);
+
+	TestRays(bvh, gen);
+
+	// Deform the mesh and refit
+	{
+		std::vector<DG::float3> positions = bvh.GetPositions();
+		for (auto& p : positions)
+			p = DG::float3(2.0f * p.x, p.y + 0.1f * p.x, 0.5f * p.z);
+		bvh.Refit(&positions[0], positions.size());
+	}
+
+	TestRays(bvh, gen);
+
+	bvh.Save("bunny" BVH_ARCHIVE_EXTENSION);
+
+	GeometryBVH fromArchive;
+	fromArchive.ReadArchive("bunny" BVH_ARCHIVE_EXTENSION);
+
+	assert(fromArchive.GetNodes().size() == bvh.GetNodes().size());
+	assert(fromArchive.GetTriangles() == bvh.GetTriangles());
+
+	TestRays(fromArchive, gen);
+
+	pool.Shutdown();
+}
@@ -0,0 +1,409 @@
+#include <Engine/Core.hpp>
+#include <Engine/Resources/GeometryImport.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+
+using namespace Morpheus;
+
+float Parse(const char* str, size_t* length = nullptr) {
+	float value = -12345.0f;
+	auto end = ParseFloat(str, str + std::strlen(str), &value);
+	assert(end);
+	if (length)
+		*length = end - str;
+	return value;
+}
+
+bool Rejects(const char* str) {
+	float value = -12345.0f;
+	bool bRejected = ParseFloat(str, str + std::strlen(str), &value) == nullptr;
+	// Nothing is written when there is no number
+	return bRejected && value == -12345.0f;
+}
+
+// At most one unit in the last place away from the C library
+bool CloseToStrtof(const char* str, float value) {
+	float expected = std::strtof(str, nullptr);
+	return value == expected ||
+		value == std::nextafter(expected, std::numeric_limits<float>::infinity()) ||
+		value == std::nextafter(expected, -std::numeric_limits<float>::infinity());
+}
+
+void TestParseFloat() {
+	size_t length;
+
+	assert(Parse("1.5") == 1.5f);
+	assert(Parse("42") == 42.0f);
+	assert(Parse("-0.25") == -0.25f);
+	assert(Parse("+3") == 3.0f);
+	assert(Parse(".5") == 0.5f);
+	assert(Parse("5.") == 5.0f);
+	assert(Parse("-0") == 0.0f && std::signbit(Parse("-0")));
+
+	// Leading spaces are skipped, the number ends at anything else
+	assert(Parse(" \t 2.5 3.5", &length) == 2.5f && length == 6);
+	assert(Parse("7/8", &length) == 7.0f && length == 1);
+
+	// Exponents, with and without signs
+	assert(Parse("1e3") == 1000.0f);
+	assert(Parse("-2.25E2") == -225.0f);
+	assert(Parse("4e+2") == 400.0f);
+	assert(Parse("5e-1") == 0.5f);
+	assert(CloseToStrtof("1.17549435e-38", Parse("1.17549435e-38")));
+	assert(CloseToStrtof("3.40282347e+38", Parse("3.40282347e+38")));
+
+	// An e without digits is not part of the number
+	assert(Parse("1e", &length) == 1.0f && length == 1);
+	assert(Parse("2e+", &length) == 2.0f && length == 1);
+	assert(Parse("3e-x", &length) == 3.0f && length == 1);
+
+	// Out of the float range
+	assert(std::isinf(Parse("1e39")) && Parse("1e39") > 0.0f);
+	assert(std::isinf(Parse("-1e39")) && Parse("-1e39") < 0.0f);
+	assert(Parse("1e-50") == 0.0f);
+	assert(Parse("1e99999") == std::numeric_limits<float>::infinity());
+	assert(Parse("1e-99999") == 0.0f);
+	assert(Parse("0e99999") == 0.0f);
+
+	// More digits than fit into the mantissa
+	assert(CloseToStrtof("123456789012345678901234567890", Parse("123456789012345678901234567890")));
+	assert(CloseToStrtof("0.000000000000000000000000001234", Parse("0.000000000000000000000000001234")));
+	assert(CloseToStrtof("3.14159265358979323846264338327950288",
+		Parse("3.14159265358979323846264338327950288")));
+
+	// inf and nan go through the C library
+	assert(Parse("inf") == std::numeric_limits<float>::infinity());
+	assert(Parse("-inf", &length) == -std::numeric_limits<float>::infinity() && length == 4);
+	assert(Parse("Infinity") == std::numeric_limits<float>::infinity());
+	assert(std::isnan(Parse("nan")));
+	assert(std::isnan(Parse("-NaN")));
+
+	// Malformed
+	assert(Rejects(""));
+	assert(Rejects("   "));
+	assert(Rejects("-"));
+	assert(Rejects("+"));
+	assert(Rejects("."));
+	assert(Rejects("-.e5"));
+	assert(Rejects("e5"));
+	assert(Rejects("abc"));
+	assert(Rejects("none"));
+	assert(Rejects("/1"));
+
+	// Never reads past the end of the range
+	{
+		const char* str = "1.5e3";
+		float value;
+		auto end = ParseFloat(str, str + 3, &value);
+		assert(value == 1.5f && end == str + 3);
+
+		end = ParseFloat(str, str + 4, &value);
+		assert(value == 1.5f && end == str + 3);
+
+		assert(!ParseFloat(str, str, &value));
+	}
+
+	// Whatever printf writes comes back within an ulp
+	std::mt19937 gen(0);
+	std::uniform_real_distribution<float> mantissa(-10.0f, 10.0f);
+	std::uniform_int_distribution<int> exponent(-30, 30);
+	char buffer[64];
+	for (int i = 0; i < 100000; ++i) {
+		float value = std::ldexp(mantissa(gen), exponent(gen));
+		std::snprintf(buffer, sizeof(buffer), i % 2 ? "%.9g" : "%f", value);
+		assert(CloseToStrtof(buffer, Parse(buffer)));
+	}
+}
+
+void TestParseInt() {
+	const char* str = " -12/+7 x";
+	int64_t value;
+
+	auto p = ParseInt(str, str + std::strlen(str), &value);
+	assert(p == str + 4 && value == -12);
+
+	p = ParseInt(p + 1, str + std::strlen(str), &value);
+	assert(p == str + 7 && value == 7);
+
+	assert(!ParseInt(p, str + std::strlen(str), &value));
+	assert(!ParseInt(str, str + 2, &value));
+}
+
+void WriteFile(const std::string& path, const std::string& contents) {
+	std::ofstream file(path, std::ios::binary);
+	file << contents;
+}
+
+// Positions in slot 0 and texture coordinates in slot 1, both tightly packed
+VertexLayout PositionUV() {
+	VertexLayout layout;
+	layout.mPosition = 0;
+	layout.mUV = 1;
+	layout.mElements = {
+		DG::LayoutElement(0, 0, 3, DG::VT_FLOAT32, false, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX),
+		DG::LayoutElement(1, 1, 2, DG::VT_FLOAT32, false, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX)
+	};
+	return layout;
+}
+
+struct Mesh {
+	std::vector<uint32_t> mIndices;
+	std::vector<DG::float3> mPositions;
+	std::vector<DG::float2> mUVs;
+};
+
+Mesh GetMesh(Geometry& geometry) {
+	Mesh mesh;
+
+	auto& indexData = geometry.GetIndexData();
+	auto indices = reinterpret_cast<const uint32_t*>(indexData.data());
+	mesh.mIndices.assign(indices, indices + indexData.size() / sizeof(uint32_t));
+
+	auto& positionData = geometry.GetVertexData(0);
+	auto positions = reinterpret_cast<const DG::float3*>(positionData.data());
+	mesh.mPositions.assign(positions, positions + positionData.size() / sizeof(DG::float3));
+
+	auto& uvData = geometry.GetVertexData(1);
+	auto uvs = reinterpret_cast<const DG::float2*>(uvData.data());
+	mesh.mUVs.assign(uvs, uvs + uvData.size() / sizeof(DG::float2));
+
+	return mesh;
+}
+
+bool Same(const DG::float3& a, float x, float y, float z) {
+	return a.x == x && a.y == y && a.z == z;
+}
+
+Mesh ReadObj(const std::string& contents) {
+	WriteFile("geometry_import_test.obj", contents);
+	Geometry geometry;
+	geometry.ReadObj(LoadParams<Geometry>("geometry_import_test.obj", PositionUV()));
+	return GetMesh(geometry);
+}
+
+bool ObjThrows(const std::string& contents) {
+	try {
+		ReadObj(contents);
+	} catch (std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+void TestObj() {
+	// A quad through negative indices and a pentagon through positive ones
+	auto mesh = ReadObj(
+		"# comment\n"
+		"v 0 0 2\n"
+		"v 1 0 2\n"
+		"v 1 1 2\r\n"
+		"v 0 1 2\n"
+		"vt 0 0\n"
+		"vt 1 0\n"
+		"vt 1 1\n"
+		"vt 0 0.75\n"
+		"g quad\n"
+		"f -4/-4 -3/-3 -2/-2 -1/-1\n"
+		"v 0 0 0\n"
+		"v 2 0 0\n"
+		"v 3 1 0\n"
+		"v 1 2 0\n"
+		"v -1 1 0\n"
+		"o pentagon\n"
+		"f 5/1 6/2 7/3 8/4 9/1\n");
+
+	// Fanned out, with the winding flipped and z mirrored
+	assert(mesh.mIndices.size() == (2 + 3) * 3);
+	assert(mesh.mPositions.size() == 9);
+	assert(mesh.mIndices[0] == 2 && mesh.mIndices[1] == 1 && mesh.mIndices[2] == 0);
+	assert(mesh.mIndices[3] == 3 && mesh.mIndices[4] == 2 && mesh.mIndices[5] == 0);
+	assert(Same(mesh.mPositions[0], 0.0f, 0.0f, -2.0f));
+	assert(Same(mesh.mPositions[3], 0.0f, 1.0f, -2.0f));
+	assert(Same(mesh.mPositions[8], -1.0f, 1.0f, 0.0f));
+
+	// V is flipped
+	assert(mesh.mUVs.size() == 9);
+	assert(mesh.mUVs[3].x == 0.0f && mesh.mUVs[3].y == 0.25f);
+
+	for (size_t i = 6; i < mesh.mIndices.size(); i += 3)
+		assert(mesh.mIndices[i + 2] == 4);
+
+	// Corners with the same indices are one vertex
+	mesh = ReadObj(
+		"v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+		"f 1 2 3\n"
+		"f 3 2 4\n");
+	assert(mesh.mPositions.size() == 4);
+	assert(mesh.mIndices.size() == 6);
+
+	assert(ObjThrows("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 0 1 2\n"));
+	assert(ObjThrows("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n"));
+	assert(ObjThrows("v 0 0 0\nv 1 0 0\nv 0 1 0\nf -1 -2 -4\n"));
+	assert(ObjThrows("v 0 0 0\nv 1 x 0\nv 0 1 0\nf 1 2 3\n"));
+	assert(ObjThrows("v 0 0 0\nv 1 0 0\n"));
+}
+
+// The PLY fixture is a pentagon with a triangle on one of its edges
+const float gPlyVertices[][5] = {
+	{ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+	{ 2.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+	{ 3.0f, 1.0f, 0.0f, 1.0f, 0.5f },
+	{ 1.0f, 2.0f, 0.0f, 0.5f, 1.0f },
+	{ -1.0f, 1.0f, 0.0f, 0.0f, 0.5f },
+	{ 1.0f, -1.0f, 0.5f, 0.5f, 0.0f }
+};
+
+const std::vector<std::vector<int>> gPlyFaces = {
+	{ 0, 1, 2, 3, 4 },
+	{ 1, 0, 5 }
+};
+
+std::string PlyHeader(const std::string& format, size_t faceCount = gPlyFaces.size()) {
+	return "ply\n"
+		"format " + format + " 1.0\n"
+		"comment made by hand\n"
+		"element vertex 6\n"
+		"property float x\n"
+		"property float y\n"
+		"property float z\n"
+		"property float u\n"
+		"property float v\n"
+		"element face " + std::to_string(faceCount) + "\n"
+		"property list uchar int vertex_indices\n"
+		"end_header\n";
+}
+
+template <typename T>
+void Put(std::string* out, T value, bool bBigEndian) {
+	char bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+
+	uint16_t one = 1;
+	bool bHostLittle = *reinterpret_cast<uint8_t*>(&one) == 1;
+	if (bHostLittle == bBigEndian)
+		std::reverse(bytes, bytes + sizeof(T));
+
+	out->append(bytes, sizeof(T));
+}
+
+std::string BinaryPly(bool bBigEndian, int badIndex = -1) {
+	auto result = PlyHeader(bBigEndian ? "binary_big_endian" : "binary_little_endian");
+	for (auto& vertex : gPlyVertices)
+		for (float value : vertex)
+			Put(&result, value, bBigEndian);
+	for (auto& face : gPlyFaces) {
+		Put(&result, (uint8_t)face.size(), bBigEndian);
+		for (int index : face)
+			Put(&result, (int32_t)(badIndex >= 0 ? badIndex : index), bBigEndian);
+	}
+	return result;
+}
+
+std::string AsciiPly() {
+	std::string result = PlyHeader("ascii");
+	for (auto& vertex : gPlyVertices) {
+		for (float value : vertex)
+			result += std::to_string(value) + " ";
+		result += "\n";
+	}
+	for (auto& face : gPlyFaces) {
+		result += std::to_string(face.size());
+		for (int index : face)
+			result += " " + std::to_string(index);
+		result += "\n";
+	}
+	return result;
+}
+
+Mesh ReadPly(const std::string& contents) {
+	WriteFile("geometry_import_test.ply", contents);
+	Geometry geometry;
+	geometry.ReadPly(LoadParams<Geometry>("geometry_import_test.ply", PositionUV()));
+	return GetMesh(geometry);
+}
+
+bool PlyThrows(const std::string& contents) {
+	try {
+		ReadPly(contents);
+	} catch (std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+void CheckPly(const Mesh& mesh) {
+	// The pentagon is fanned out
+	assert(mesh.mIndices.size() == (3 + 1) * 3);
+	assert(mesh.mPositions.size() == 6);
+
+	for (size_t i = 0; i < 6; ++i) {
+		auto& v = gPlyVertices[i];
+		assert(Same(mesh.mPositions[i], v[0], v[1], -v[2]));
+		assert(mesh.mUVs[i].x == v[3] && mesh.mUVs[i].y == 1.0f - v[4]);
+	}
+
+	uint32_t expected[] = { 2, 1, 0, 3, 2, 0, 4, 3, 0, 5, 0, 1 };
+	for (size_t i = 0; i < mesh.mIndices.size(); ++i)
+		assert(mesh.mIndices[i] == expected[i]);
+}
+
+std::vector<DG::float3> SortedPositions(const Mesh& mesh) {
+	auto positions = mesh.mPositions;
+	std::sort(positions.begin(), positions.end(), [](const DG::float3& a, const DG::float3& b) {
+		return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+	});
+	positions.erase(std::unique(positions.begin(), positions.end(),
+		[](const DG::float3& a, const DG::float3& b) { return Same(a, b.x, b.y, b.z); }),
+		positions.end());
+	return positions;
+}
+
+void TestPly() {
+	auto little = ReadPly(BinaryPly(false));
+	CheckPly(little);
+
+	auto big = ReadPly(BinaryPly(true));
+	CheckPly(big);
+
+	// ASCII files go through Assimp, which may order vertices its own way
+	auto ascii = ReadPly(AsciiPly());
+	assert(ascii.mIndices.size() == little.mIndices.size());
+	auto a = SortedPositions(ascii);
+	auto b = SortedPositions(little);
+	assert(a.size() == b.size());
+	for (size_t i = 0; i < a.size(); ++i)
+		assert(Same(a[i], b[i].x, b[i].y, b[i].z));
+
+	// Indices past the last vertex
+	assert(PlyThrows(BinaryPly(false, 6)));
+
+	// Truncated in the middle of the faces
+	auto truncated = BinaryPly(false);
+	truncated.resize(truncated.size() - 30);
+	assert(PlyThrows(truncated));
+
+	assert(PlyThrows("not a ply\n"));
+	assert(PlyThrows("ply\nformat binary_little_endian 1.0\nelement vertex 1\n"));
+}
+
+int main() {
+	TestParseFloat();
+	TestParseInt();
+	TestObj();
+	TestPly();
+
+	std::remove("geometry_import_test.obj");
+	std::remove("geometry_import_test.ply");
+
+	std::cout << "Geometry import test passed" << std::endl;
+}
@@ -0,0 +1,222 @@
+#include <Engine/Core.hpp>
+#include <Engine/Resources/GltfImport.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace Morpheus;
+
+// Records what the importer asks for instead of loading anything
+class FakeTextureCache : public IResourceCache<Texture> {
+public:
+	std::vector<LoadParams<Texture>> mRequests;
+
+	Future<Texture*> Load(const LoadParams<Texture>& params, ITaskQueue* queue) override {
+		mRequests.emplace_back(params);
+		Promise<Texture*> promise;
+		return Future<Texture*>(promise);
+	}
+};
+
+std::string EncodeBase64(const std::vector<uint8_t>& data) {
+	const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	std::string result;
+	for (size_t i = 0; i < data.size(); i += 3) {
+		uint32_t bits = (uint32_t)data[i] << 16;
+		if (i + 1 < data.size())
+			bits |= (uint32_t)data[i + 1] << 8;
+		if (i + 2 < data.size())
+			bits |= data[i + 2];
+
+		result += alphabet[(bits >> 18) & 63];
+		result += alphabet[(bits >> 12) & 63];
+		result += i + 1 < data.size() ? alphabet[(bits >> 6) & 63] : '=';
+		result += i + 2 < data.size() ? alphabet[bits & 63] : '=';
+	}
+	return result;
+}
+
+// A single triangle in an embedded buffer: three float3 positions followed
+// by three uint16 indices
+std::string MakeTriangle(const std::string& material, uint16_t lastIndex = 2) {
+	float positions[] = {
+		0.0f, 0.0f, 1.0f,
+		1.0f, 0.0f, 2.0f,
+		0.0f, 1.0f, 3.0f
+	};
+	uint16_t indices[] = { 0, 1, lastIndex };
+
+	std::vector<uint8_t> buffer(sizeof(positions) + sizeof(indices));
+	std::memcpy(&buffer[0], positions, sizeof(positions));
+	std::memcpy(&buffer[sizeof(positions)], indices, sizeof(indices));
+
+	return R"({
+	"asset": { "version": "2.0" },
+	"buffers": [{
+		"byteLength": )" + std::to_string(buffer.size()) + R"(,
+		"uri": "data:application/octet-stream;base64,)" + EncodeBase64(buffer) + R"("
+	}],
+	"bufferViews": [
+		{ "buffer": 0, "byteOffset": 0, "byteLength": 36 },
+		{ "buffer": 0, "byteOffset": 36, "byteLength": 6 }
+	],
+	"accessors": [
+		{ "bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3",
+			"min": [0.0, 0.0, 1.0], "max": [1.0, 1.0, 3.0] },
+		{ "bufferView": 1, "componentType": 5123, "count": 3, "type": "SCALAR" }
+	],
+	"meshes": [{
+		"primitives": [{ "attributes": { "POSITION": 0 }, "indices": 1, "material": 0 }]
+	}],
+	"images": [
+		{ "uri": "albedo.png" },
+		{ "uri": "metallic_roughness.png" },
+		{ "uri": "data:image/png;base64,AAAA" }
+	],
+	"textures": [
+		{ "source": 0 },
+		{ "source": 1 },
+		{ "source": 2 }
+	],
+	"materials": [)" + material + R"(]
+})";
+}
+
+void WriteFile(const std::string& path, const std::string& contents) {
+	std::ofstream file(path, std::ios::binary);
+	file << contents;
+}
+
+VertexLayout PositionOnly() {
+	VertexLayout layout;
+	layout.mPosition = 0;
+	layout.mElements = {
+		DG::LayoutElement(0, 0, 3, DG::VT_FLOAT32, false, DG::INPUT_ELEMENT_FREQUENCY_PER_VERTEX)
+	};
+	return layout;
+}
+
+void TestGeometry() {
+	WriteFile("gltf_import_test.gltf", MakeTriangle("{}"));
+
+	Geometry geometry;
+	geometry.ReadGltf(LoadParams<Geometry>("gltf_import_test.gltf", PositionOnly()));
+
+	// Winding is flipped and z is mirrored, as in the Assimp import path
+	auto& indexData = geometry.GetIndexData();
+	assert(indexData.size() == 3 * sizeof(uint32_t));
+	auto indices = reinterpret_cast<const uint32_t*>(&indexData[0]);
+	assert(indices[0] == 2 && indices[1] == 1 && indices[2] == 0);
+
+	auto& vertexData = geometry.GetVertexData(0);
+	assert(vertexData.size() == 9 * sizeof(float));
+	auto positions = reinterpret_cast<const float*>(&vertexData[0]);
+	assert(positions[0] == 0.0f && positions[1] == 0.0f && positions[2] == -1.0f);
+	assert(positions[3] == 1.0f && positions[4] == 0.0f && positions[5] == -2.0f);
+	assert(positions[6] == 0.0f && positions[7] == 1.0f && positions[8] == -3.0f);
+
+	auto& bounds = geometry.GetBoundingBox();
+	assert(bounds.mLower.x == 0.0f && bounds.mLower.y == 0.0f && bounds.mLower.z == -3.0f);
+	assert(bounds.mUpper.x == 1.0f && bounds.mUpper.y == 1.0f && bounds.mUpper.z == -1.0f);
+
+	// Indices past the end of the vertices are rejected
+	WriteFile("gltf_import_test.gltf", MakeTriangle("{}", 3));
+	bool bThrew = false;
+	try {
+		Geometry broken;
+		broken.ReadGltf(LoadParams<Geometry>("gltf_import_test.gltf", PositionOnly()));
+	} catch (std::runtime_error&) {
+		bThrew = true;
+	}
+	assert(bThrew);
+}
+
+void TestMaterial() {
+	ImmediateTaskQueue queue;
+
+	// Roughness and metallic come from one packed texture
+	{
+		WriteFile("gltf_import_test.gltf", MakeTriangle(R"({
+			"pbrMetallicRoughness": {
+				"baseColorFactor": [0.5, 0.25, 1.0, 1.0],
+				"baseColorTexture": { "index": 0 },
+				"metallicRoughnessTexture": { "index": 1 },
+				"roughnessFactor": 0.8,
+				"metallicFactor": 0.6
+			}
+		})"));
+
+		FakeTextureCache cache;
+		auto desc = LoadGltfMaterial("gltf_import_test.gltf", &cache, &queue);
+
+		assert(cache.mRequests.size() == 2);
+		assert(cache.mRequests[0].mSource == "albedo.png" && cache.mRequests[0].bIsSRGB);
+		assert(cache.mRequests[1].mSource == "metallic_roughness.png" && !cache.mRequests[1].bIsSRGB);
+
+		assert(desc.mType == MaterialType::COOK_TORRENCE);
+		assert(desc.mAlbedo);
+		assert(desc.mRoughness && desc.mMetallic);
+		assert(desc.mRoughnessChannel == 1 && desc.mMetallicChannel == 2);
+		assert(desc.mRoughnessFactor == 0.8f && desc.mMetallicFactor == 0.6f);
+		assert(desc.mAlbedoFactor.x == 0.5f && desc.mAlbedoFactor.y == 0.25f);
+	}
+
+	// Factors alone, glTF defaults them to 1
+	{
+		WriteFile("gltf_import_test.gltf", MakeTriangle(R"({
+			"pbrMetallicRoughness": { "roughnessFactor": 0.3 }
+		})"));
+
+		FakeTextureCache cache;
+		auto desc = LoadGltfMaterial("gltf_import_test.gltf", &cache, &queue);
+
+		assert(cache.mRequests.empty());
+		assert(!desc.mRoughness && !desc.mMetallic);
+		assert(desc.mRoughnessChannel == 0 && desc.mMetallicChannel == 0);
+		assert(desc.mRoughnessFactor == 0.3f && desc.mMetallicFactor == 1.0f);
+	}
+
+	// Embedded images cannot be loaded, the factors are not taken as is
+	{
+		WriteFile("gltf_import_test.gltf", MakeTriangle(R"({
+			"pbrMetallicRoughness": {
+				"metallicRoughnessTexture": { "index": 2 }
+			},
+			"normalTexture": { "index": 0 }
+		})"));
+
+		FakeTextureCache cache;
+		auto desc = LoadGltfMaterial("gltf_import_test.gltf", &cache, &queue);
+
+		assert(cache.mRequests.size() == 1);
+		assert(cache.mRequests[0].mSource == "albedo.png" && !cache.mRequests[0].bIsSRGB);
+		assert(desc.mNormal);
+		assert(!desc.mRoughness && !desc.mMetallic);
+		assert(desc.mRoughnessFactor == GLTF_FALLBACK_ROUGHNESS);
+		assert(desc.mMetallicFactor == GLTF_FALLBACK_METALLIC);
+	}
+
+	// Channels tell materials apart
+	{
+		MaterialDesc a;
+		MaterialDesc b;
+		b.mRoughnessChannel = 1;
+		assert(!(a == b));
+		b.mRoughnessChannel = 0;
+		assert(a == b);
+		assert(MaterialDesc::Hasher()(a) == MaterialDesc::Hasher()(b));
+	}
+}
+
+int main() {
+	TestGeometry();
+	TestMaterial();
+
+	std::remove("gltf_import_test.gltf");
+
+	std::cout << "glTF import test passed" << std::endl;
+}
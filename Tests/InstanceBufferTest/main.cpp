@@ -0,0 +1,139 @@
+#include <Engine/Core.hpp>
+#include <Engine/InstanceBuffer.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+
+using namespace Morpheus;
+
+// Every entry of the buffer is the transposed transform of its instance
+void CheckData(const InstanceBuffer& buffer,
+	const ArenaArray<StaticMeshInstance>& instances,
+	const std::vector<uint32_t>& order) {
+	assert(buffer.Size() == order.size());
+
+	auto& data = buffer.GetData();
+	for (size_t i = 0; i < order.size(); ++i) {
+		auto expected = instances[order[i]].mTransform.Transpose();
+		for (int r = 0; r < 4; ++r)
+			for (int c = 0; c < 4; ++c)
+				assert(data[i][r][c] == expected[r][c]);
+	}
+}
+
+// The dirty ranges are sorted, apart and cover exactly the given instances
+void CheckDirty(const InstanceBuffer& buffer, const std::vector<size_t>& changed) {
+	auto& ranges = buffer.GetDirtyRanges();
+
+	size_t count = 0;
+	for (size_t i = 0; i < ranges.size(); ++i) {
+		assert(ranges[i].mBegin < ranges[i].mEnd);
+		if (i > 0)
+			assert(ranges[i - 1].mEnd < ranges[i].mBegin);
+		count += ranges[i].mEnd - ranges[i].mBegin;
+	}
+	assert(count == buffer.GetDirtyCount());
+
+	for (auto index : changed) {
+		bool bFound = false;
+		for (auto& range : ranges)
+			bFound |= index >= range.mBegin && index < range.mEnd;
+		assert(bFound);
+	}
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	constexpr size_t instanceCount = 50000;
+
+	std::mt19937 gen(0);
+	std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+	FrameArena arena;
+	ArenaArray<StaticMeshInstance> instances;
+	instances.Allocate(&arena, instanceCount);
+
+	for (size_t i = 0; i < instanceCount; ++i) {
+		auto& instance = instances[i];
+		instance.mTransform = DG::float4x4::Translation(dist(gen), dist(gen), dist(gen));
+		instance.mGeometry = nullptr;
+		instance.mMaterial = NullMaterialId;
+		instance.mEntity = entt::null;
+	}
+
+	// Packed in reverse, as a render queue might
+	std::vector<uint32_t> order(instanceCount);
+	for (size_t i = 0; i < instanceCount; ++i)
+		order[i] = (uint32_t)(instanceCount - i - 1);
+
+	InstanceBuffer buffer;
+
+	// Everything is new
+	buffer.Pack(instances, order, &pool);
+	CheckData(buffer, instances, order);
+	assert(buffer.GetDirtyRanges().size() == 1);
+	assert(buffer.GetDirtyCount() == instanceCount);
+
+	// Nothing moved
+	buffer.Pack(instances, order, &pool);
+	CheckData(buffer, instances, order);
+	assert(buffer.GetDirtyRanges().empty());
+	assert(buffer.GetDirtyCount() == 0);
+
+	// A few things moved
+	std::uniform_int_distribution<size_t> indexDist(0, instanceCount - 1);
+	std::vector<size_t> changed;
+	for (int i = 0; i < 20; ++i) {
+		auto index = indexDist(gen);
+		instances[order[index]].mTransform = DG::float4x4::Translation(dist(gen), dist(gen), dist(gen));
+		changed.emplace_back(index);
+	}
+
+	buffer.Pack(instances, order, &pool);
+	CheckData(buffer, instances, order);
+	CheckDirty(buffer, changed);
+	assert(buffer.GetDirtyCount() <= changed.size() * INSTANCE_PACK_CHUNK_SIZE);
+
+	std::cout << changed.size() << " moved, " << buffer.GetDirtyCount() << " of "
+		<< instanceCount << " uploaded in " << buffer.GetDirtyRanges().size() << " ranges" << std::endl;
+
+	// Fewer instances visible, then more again
+	std::vector<uint32_t> shorter(order.begin(), order.begin() + instanceCount / 2);
+	buffer.Pack(instances, shorter, &pool);
+	CheckData(buffer, instances, shorter);
+	assert(buffer.GetDirtyCount() == 0);
+
+	buffer.Pack(instances, order, &pool);
+	CheckData(buffer, instances, order);
+	CheckDirty(buffer, { instanceCount / 2, instanceCount - 1 });
+	assert(buffer.GetDirtyCount() == instanceCount - instanceCount / 2);
+
+	// Slots follow the order, one instance more at the front shifts and
+	// uploads every slot after it
+	std::vector<uint32_t> shifted(order.begin() + 1, order.end());
+	buffer.Pack(instances, shifted, &pool);
+	CheckData(buffer, instances, shifted);
+	assert(buffer.GetDirtyCount() == shifted.size());
+
+	buffer.Pack(instances, order, &pool);
+	CheckData(buffer, instances, order);
+	assert(buffer.GetDirtyCount() == instanceCount);
+
+	// Serially, after the GPU copy was lost
+	buffer.Invalidate();
+	buffer.Pack(instances, order);
+	CheckData(buffer, instances, order);
+	assert(buffer.GetDirtyCount() == instanceCount);
+
+	// Nothing at all
+	buffer.Pack(instances, std::vector<uint32_t>(), &pool);
+	assert(buffer.Size() == 0);
+	assert(buffer.GetDirtyRanges().empty());
+
+	pool.Shutdown();
+
+	std::cout << "Instance buffer test passed" << std::endl;
+}
@@ -0,0 +1,293 @@
+#include <Engine/Core.hpp>
+#include <Engine/LightClusters.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Components/LightComponents.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <set>
+
+using namespace Morpheus;
+
+bool SphereTouches(const BoundingBox& box, const DG::float3& center, float radius) {
+	DG::float3 closest = DG::max(box.mLower, DG::min(center, box.mUpper));
+	DG::float3 d = closest - center;
+	return DG::dot(d, d) <= radius * radius;
+}
+
+bool Contains(const BoundingBox& box, const DG::float3& p, float epsilon) {
+	return p.x >= box.mLower.x - epsilon && p.x <= box.mUpper.x + epsilon &&
+		p.y >= box.mLower.y - epsilon && p.y <= box.mUpper.y + epsilon &&
+		p.z >= box.mLower.z - epsilon && p.z <= box.mUpper.z + epsilon;
+}
+
+ArenaArray<LightInstance> RandomLights(FrameArena* arena, size_t count, std::mt19937& gen) {
+	std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> range(1.0f, 15.0f);
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> angle(0.1f, 1.2f);
+
+	ArenaArray<LightInstance> lights;
+	lights.Allocate(arena, count);
+
+	for (size_t i = 0; i < count; ++i) {
+		auto& light = lights[i];
+		light.mPosition = DG::float3(position(gen), position(gen), position(gen));
+		light.mRange = range(gen);
+		light.mColor = DG::float3(1.0f, 1.0f, 1.0f);
+
+		if (i % 2 == 0) {
+			light.mDirection = DG::float3(0.0f, 0.0f, 1.0f);
+			light.mCosOuterAngle = -1.0f;
+			light.mCosInnerAngle = -1.0f;
+		} else {
+			light.mDirection = DG::normalize(DG::float3(direction(gen), direction(gen), direction(gen)) +
+				DG::float3(0.0f, 0.0f, 0.01f));
+			float outer = angle(gen);
+			light.mCosOuterAngle = std::cos(outer);
+			light.mCosInnerAngle = std::cos(outer * 0.5f);
+		}
+	}
+
+	return lights;
+}
+
+void TestCamera(const Camera& camera, ThreadPool& pool, FrameArena* arena, std::mt19937& gen) {
+	constexpr float aspectRatio = 16.0f / 9.0f;
+
+	auto view = GetCameraView(camera, nullptr);
+	auto projection = camera.GetProjection(aspectRatio, false);
+	float nearZ = camera.GetNearZ();
+	float farZ = camera.GetFarZ();
+
+	auto lights = RandomLights(arena, 400, gen);
+
+	LightClusters clusters;
+	clusters.Build(view, projection, nearZ, farZ, lights, &pool);
+
+	// The same lists whether built in parallel or not
+	LightClusters serial;
+	serial.Build(view, projection, nearZ, farZ, lights, nullptr);
+	assert(serial.GetIndices() == clusters.GetIndices());
+	for (size_t i = 0; i < clusters.GetClusters().size(); ++i) {
+		assert(serial.GetClusters()[i].mOffset == clusters.GetClusters()[i].mOffset);
+		assert(serial.GetClusters()[i].mCount == clusters.GetClusters()[i].mCount);
+	}
+
+	// Lists are back to back and without duplicates
+	auto& indices = clusters.GetIndices();
+	uint32_t offset = 0;
+	for (auto& cluster : clusters.GetClusters()) {
+		assert(cluster.mOffset == offset);
+		offset += cluster.mCount;
+
+		std::set<uint32_t> distinct(indices.begin() + cluster.mOffset,
+			indices.begin() + cluster.mOffset + cluster.mCount);
+		assert(distinct.size() == cluster.mCount);
+		for (auto i : distinct)
+			assert(i < lights.size());
+	}
+	assert(offset == indices.size());
+
+	// Point lights are exactly the spheres that touch the cluster bounds, spot
+	// lights a subset of those
+	std::vector<DG::float3> viewPositions(lights.size());
+	std::vector<DG::float3> viewDirections(lights.size());
+	for (size_t i = 0; i < lights.size(); ++i) {
+		auto p = DG::float4(lights[i].mPosition, 1.0f) * view;
+		auto d = DG::float4(lights[i].mDirection, 0.0f) * view;
+		viewPositions[i] = DG::float3(p.x, p.y, p.z);
+		viewDirections[i] = DG::normalize(DG::float3(d.x, d.y, d.z));
+	}
+
+	size_t pointHits = 0;
+	size_t spotHits = 0;
+	size_t spotSpheres = 0;
+	for (uint z = 0; z < clusters.GetSizeZ(); ++z) {
+		for (uint y = 0; y < clusters.GetSizeY(); ++y) {
+			for (uint x = 0; x < clusters.GetSizeX(); ++x) {
+				auto& cluster = clusters.GetCluster(x, y, z);
+				auto& bounds = clusters.GetClusterBounds(x, y, z);
+				std::set<uint32_t> listed(indices.begin() + cluster.mOffset,
+					indices.begin() + cluster.mOffset + cluster.mCount);
+
+				for (uint32_t i = 0; i < lights.size(); ++i) {
+					bool bTouches = SphereTouches(bounds, viewPositions[i], lights[i].mRange);
+					bool bListed = listed.count(i) > 0;
+
+					if (lights[i].IsSpot()) {
+						assert(!bListed || bTouches);
+						spotHits += bListed;
+						spotSpheres += bTouches;
+					} else {
+						assert(bListed == bTouches);
+						pointHits += bListed;
+					}
+				}
+			}
+		}
+	}
+
+	// Cones rule out part of what their spheres touch
+	assert(spotHits < spotSpheres);
+
+	// Every lit point of the view lists the light in its cluster
+	std::uniform_real_distribution<float> coordinate(-farZ, farZ);
+	std::uniform_real_distribution<float> depth(nearZ, farZ);
+	size_t samples = 0;
+	size_t litSamples = 0;
+
+	for (int i = 0; i < 200000; ++i) {
+		DG::float3 p(coordinate(gen), coordinate(gen), depth(gen));
+		auto clip = DG::float4(p, 1.0f) * projection;
+		float ndcX = clip.x / clip.w;
+		float ndcY = clip.y / clip.w;
+		if (std::abs(ndcX) >= 1.0f || std::abs(ndcY) >= 1.0f)
+			continue;
+
+		uint x = std::min((uint)((ndcX + 1.0f) * 0.5f * clusters.GetSizeX()), clusters.GetSizeX() - 1);
+		uint y = std::min((uint)((1.0f - ndcY) * 0.5f * clusters.GetSizeY()), clusters.GetSizeY() - 1);
+		uint z = clusters.GetSlice(p.z);
+
+		// Points on the edge of a cluster may round into its neighbour
+		if (!Contains(clusters.GetClusterBounds(x, y, z), p, 1e-3f))
+			continue;
+
+		++samples;
+		auto& cluster = clusters.GetCluster(x, y, z);
+		auto begin = indices.begin() + cluster.mOffset;
+		auto end = begin + cluster.mCount;
+
+		for (uint32_t l = 0; l < lights.size(); ++l) {
+			DG::float3 toPoint = p - viewPositions[l];
+			float distance = DG::length(toPoint);
+			if (distance > lights[l].mRange)
+				continue;
+			if (lights[l].IsSpot() && distance > 0.0f &&
+				DG::dot(toPoint / distance, viewDirections[l]) < lights[l].mCosOuterAngle)
+				continue;
+
+			++litSamples;
+			assert(std::find(begin, end, l) != end);
+		}
+	}
+
+	assert(samples > 1000);
+	assert(litSamples > 0);
+
+	std::cout << indices.size() << " indices, " << pointHits << " point and "
+		<< spotHits << " of " << spotSpheres << " spot light hits, "
+		<< samples << " samples" << std::endl;
+}
+
+void TestEdgeCases(FrameArena* arena) {
+	Camera camera;
+	camera.SetEye(0.0f, 0.0f, 0.0f);
+	camera.LookAt(0.0f, 0.0f, 1.0f);
+	camera.SetClipPlanes(0.1f, 100.0f);
+
+	auto view = GetCameraView(camera, nullptr);
+	auto projection = camera.GetProjection(1.0f, false);
+
+	ArenaArray<LightInstance> lights;
+	lights.Allocate(arena, 3);
+
+	// Behind the camera, past the far plane, and a spot light pointing away
+	lights[0] = LightInstance{DG::float3(0.0f, 0.0f, -20.0f), 5.0f,
+		DG::float3(1.0f, 1.0f, 1.0f), -1.0f, DG::float3(0.0f, 0.0f, 1.0f), -1.0f};
+	lights[1] = LightInstance{DG::float3(0.0f, 0.0f, 200.0f), 50.0f,
+		DG::float3(1.0f, 1.0f, 1.0f), -1.0f, DG::float3(0.0f, 0.0f, 1.0f), -1.0f};
+	lights[2] = LightInstance{DG::float3(0.0f, 0.0f, -1.0f), 5.0f,
+		DG::float3(1.0f, 1.0f, 1.0f), std::cos(0.2f), DG::float3(0.0f, 0.0f, -1.0f), std::cos(0.1f)};
+
+	LightClusters clusters(8, 8, 16);
+	clusters.Build(view, projection, camera.GetNearZ(), camera.GetFarZ(), lights);
+	assert(clusters.GetIndices().empty());
+
+	// A point light right in front of the camera reaches the middle clusters
+	lights[2].mPosition = DG::float3(0.0f, 0.0f, 1.0f);
+	lights[2].mCosOuterAngle = -1.0f;
+	clusters.Build(view, projection, camera.GetNearZ(), camera.GetFarZ(), lights);
+	auto& middle = clusters.GetCluster(4, 4, clusters.GetSlice(1.0f));
+	assert(middle.mCount == 1);
+	assert(clusters.GetIndices()[middle.mOffset] == 2);
+
+	// Nothing to assign
+	ArenaArray<LightInstance> none;
+	clusters.Build(view, projection, camera.GetNearZ(), camera.GetFarZ(), none);
+	assert(clusters.GetIndices().empty());
+	for (auto& cluster : clusters.GetClusters())
+		assert(cluster.mCount == 0);
+
+	assert(clusters.GetSlice(0.0f) == 0);
+	assert(clusters.GetSlice(1000.0f) == clusters.GetSizeZ() - 1);
+}
+
+void TestExtraction() {
+	Frame frame;
+
+	auto point = frame.CreateEntity();
+	frame.Emplace<Transform>(point, Transform(DG::float3(1.0f, 2.0f, 3.0f),
+		DG::Quaternion(0.0f, 0.0f, 0.0f, 1.0f), DG::float3(1.0f, 1.0f, 1.0f)));
+	frame.Emplace<PointLightComponent>(point, DG::float3(1.0f, 0.5f, 0.25f), 2.0f, 7.0f);
+
+	auto spot = frame.CreateEntity();
+	frame.Emplace<Transform>(spot, Transform(DG::float3(-1.0f, 0.0f, 0.0f),
+		DG::Quaternion(0.0f, 0.0f, 0.0f, 1.0f), DG::float3(1.0f, 1.0f, 1.0f)));
+	frame.Emplace<SpotLightComponent>(spot);
+
+	TransformCacheUpdater transforms(&frame);
+	transforms.UpdateAll(nullptr);
+
+	RenderSnapshot snapshot;
+	ExtractLights(&frame, &snapshot);
+	assert(snapshot.mLights.size() == 2);
+
+	for (auto& light : snapshot.mLights) {
+		if (light.IsSpot()) {
+			assert(light.mPosition.x == -1.0f);
+			assert(light.mDirection.z == 1.0f);
+			assert(std::abs(light.mCosOuterAngle - std::cos(DG::PI_F / 6.0f)) < 1e-6f);
+			assert(light.mCosInnerAngle > light.mCosOuterAngle);
+		} else {
+			assert(light.mPosition.y == 2.0f);
+			assert(light.mRange == 7.0f);
+			assert(light.mColor.x == 2.0f && light.mColor.z == 0.5f);
+		}
+	}
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	std::mt19937 gen(0);
+	FrameArena arena;
+
+	{
+		Camera camera;
+		camera.SetEye(0.0f, 0.0f, -30.0f);
+		camera.LookAt(0.3f, 0.1f, 1.0f);
+		camera.SetClipPlanes(0.5f, 80.0f);
+		TestCamera(camera, pool, &arena, gen);
+	}
+
+	{
+		Camera camera(CameraType::ORTHOGRAPHIC);
+		camera.SetEye(0.0f, 0.0f, -30.0f);
+		camera.LookAt(0.0f, 0.0f, 1.0f);
+		camera.SetOrthoSize(60.0f, 40.0f);
+		camera.SetClipPlanes(0.5f, 80.0f);
+		TestCamera(camera, pool, &arena, gen);
+	}
+
+	TestEdgeCases(&arena);
+	TestExtraction();
+
+	pool.Shutdown();
+
+	std::cout << "Light clusters test passed" << std::endl;
+}
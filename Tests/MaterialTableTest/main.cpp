@@ -0,0 +1,154 @@
+#include <Engine/Core.hpp>
+#include <Engine/MaterialTable.hpp>
+#include <Engine/Systems/EmptyRenderer.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <set>
+
+using namespace Morpheus;
+
+MaterialDesc MakeDesc(int variant) {
+	MaterialDesc desc;
+	desc.mType = MaterialType::LAMBERT;
+	desc.mRoughnessFactor = (float)variant;
+	return desc;
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	MaterialTable<int> table;
+	int created = 0;
+	auto create = [&created](const MaterialDesc& desc) {
+		++created;
+		return (int)desc.mRoughnessFactor;
+	};
+
+	// Procedural content makes the same few materials over and over
+	std::vector<MaterialId> ids;
+	for (int i = 0; i < 1000; ++i)
+		ids.emplace_back(table.Create(MakeDesc(i % 10), create));
+
+	assert(created == 10);
+	assert(table.Size() == 10);
+	assert(table.GetDeduplicatedCount() == 990);
+
+	std::set<MaterialId> distinct(ids.begin(), ids.end());
+	assert(distinct.size() == 10);
+
+	for (int i = 0; i < 1000; ++i) {
+		assert(ids[i] != NullMaterialId);
+		assert(ids[i] == ids[i % 10]);
+		assert(*table.TryGet(ids[i]) == i % 10);
+		assert(table.TryGetDesc(ids[i])->mRoughnessFactor == (float)(i % 10));
+	}
+
+	// Other factors, types or textures make other materials
+	auto desc = MakeDesc(0);
+	desc.mType = MaterialType::COOK_TORRENCE;
+	assert(table.Create(desc, create) != ids[0]);
+	desc = MakeDesc(0);
+	desc.mAlbedoFactor.x = 0.5f;
+	assert(table.Create(desc, create) != ids[0]);
+	assert(table.Size() == 12);
+
+	// References come from many threads and only count once flushed
+	ParallelFor(&pool, 1000, 64, [&table, &ids](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			table.AddRef(ids[i]);
+	});
+	assert(table.Flush() == 0);
+
+	// Every Create handed out a reference too
+	ParallelFor(&pool, 1000, 64, [&table, &ids](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			table.Release(ids[i]);
+	});
+	assert(table.Flush() == 0);
+
+	ParallelFor(&pool, 999, 64, [&table, &ids](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			table.Release(ids[i]);
+	});
+
+	// Material 9 keeps the single reference of ids[999], the other two
+	// still have the reference of their creator
+	assert(table.Flush() == 9);
+	assert(table.Size() == 3);
+	assert(table.TryGet(ids[9]));
+
+	for (int i = 0; i < 9; ++i) {
+		assert(!table.Contains(ids[i]));
+		assert(!table.TryGet(ids[i]));
+	}
+
+	// A released slot is reused under a new id, old ids do not see it
+	auto reused = table.Create(MakeDesc(100), create);
+	assert(table.Capacity() == 12);
+	assert(reused != ids[0]);
+	assert(*table.TryGet(reused) == 100);
+	for (int i = 0; i < 9; ++i)
+		assert(!table.TryGet(ids[i]));
+
+	// Adding back a reference in the same flush keeps a material alive
+	table.Release(reused);
+	table.AddRef(reused);
+	assert(table.Flush() == 0);
+	assert(table.TryGet(reused));
+
+	// Gone once the last reference is released
+	table.Release(reused);
+	assert(table.Flush() == 1);
+	assert(!table.TryGet(reused));
+	reused = table.Create(MakeDesc(100), create);
+
+	// Stale and bogus ids are rejected
+	assert(!table.TryGet(NullMaterialId));
+	assert(!table.TryGet(MaterialTable<int>::MakeId(5000, 0)));
+	table.Release(NullMaterialId);
+	assert(table.Flush() == 0);
+
+	size_t count = 0;
+	table.ForEach([&count](MaterialId id, int& value) {
+		++count;
+	});
+	assert(count == table.Size());
+
+	table.Clear();
+	assert(table.Size() == 0);
+	assert(!table.TryGet(reused));
+
+	// Renderers hand out the same material for the same description
+	EmptyRenderer renderer;
+	{
+		Material a = renderer.CreateMaterial(MakeDesc(1));
+		Material b = renderer.CreateMaterial(MakeDesc(1));
+		Material c = renderer.CreateMaterial(MakeDesc(2));
+
+		assert(a.Id() == b.Id());
+		assert(a.Id() != c.Id());
+		assert(renderer.GetMaterials().Size() == 2);
+		assert(*renderer.GetMaterials().TryGet(a.Id()) == MaterialType::LAMBERT);
+
+		// Renderers flush every frame, materials stay while handles do
+		renderer.GetMaterials().Flush();
+		assert(renderer.GetMaterials().Size() == 2);
+		assert(renderer.GetMaterials().Contains(a.Id()));
+		assert(renderer.GetMaterials().Contains(c.Id()));
+
+		auto id = c.Id();
+		c = Material();
+		renderer.GetMaterials().Flush();
+		assert(!renderer.GetMaterials().Contains(id));
+		assert(renderer.GetMaterials().Contains(a.Id()));
+	}
+
+	renderer.GetMaterials().Flush();
+	assert(renderer.GetMaterials().Size() == 0);
+
+	pool.Shutdown();
+
+	std::cout << "Material table test passed" << std::endl;
+}
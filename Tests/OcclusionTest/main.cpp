@@ -0,0 +1,204 @@
+#include <Engine/Core.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/OcclusionCulling.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace Morpheus;
+
+// Three occluders drawn straight into clip space, 64 x 32 pixels. A is a
+// quad at depth 0.5, B a sloped triangle behind it and C a triangle in
+// front that crosses the near plane.
+const char* GoldenScene[] = {
+	"................................................................",
+	"................................................................",
+	"................................................................",
+	"................................................................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA........................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBB...................",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBB.........",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBBBB.....",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBBB......",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBB........",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBB.........",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBB...........",
+	"........AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBB............",
+	"............................BBBBBBBBBBBBBBBBBBBBBB..............",
+	".............................BBBBBBBBBBBBBBBBBBBB...............",
+	"..............................BBBBBBBBBBBBBBBBB.................",
+	"...............................BBBBBBBBBBBBBBB..................",
+	".........CCC....................BBBBBBBBBBBB....................",
+	"......CCCCCCC...................BBBBBBBBBBB.....................",
+	"....CCCCCCCCCCC..................BBBBBBBB.......................",
+	"....CCCCCCCCCCCC..................BBBBBB........................",
+	"....CCCCCCCCCCCCC..................BBB..........................",
+	".....CCCCCCCCCC.....................B...........................",
+	".....CCC........................................................",
+	"................................................................"
+};
+
+char DepthToGlyph(float depth) {
+	if (depth == 1.0f)
+		return '.';
+	if (std::abs(depth - 0.5f) < 1e-4f)
+		return 'A';
+	if (depth < 0.45f)
+		return 'C';
+	return 'B';
+}
+
+// Pixel coordinates to clip space, for an identity view projection
+DG::float3 Pixel(float x, float y, float depth) {
+	return DG::float3(x / 32.0f - 1.0f, 1.0f - y / 16.0f, depth);
+}
+
+void AddTriangle(OccluderMesh* mesh, const DG::float3& a, const DG::float3& b, const DG::float3& c) {
+	uint32_t base = (uint32_t)mesh->mVertices.size();
+	mesh->mVertices.insert(mesh->mVertices.end(), { a, b, c });
+	mesh->mIndices.insert(mesh->mIndices.end(), { base, base + 1, base + 2 });
+}
+
+void CheckGolden(const OcclusionBuffer& buffer, const char* golden[]) {
+	bool bMatch = true;
+
+	for (uint y = 0; y < buffer.GetHeight(); ++y) {
+		std::string row;
+		for (uint x = 0; x < buffer.GetWidth(); ++x)
+			row += DepthToGlyph(buffer.GetDepth(x, y));
+
+		if (row != golden[y]) {
+			std::cout << "Row " << y << " is " << row << std::endl;
+			std::cout << "Expected  " << golden[y] << std::endl;
+			bMatch = false;
+		}
+	}
+
+	assert(bMatch);
+}
+
+// Every texel of a level is the farthest of the 2x2 texels below it
+void CheckHierarchy(const OcclusionBuffer& buffer) {
+	for (uint level = 1; level < buffer.GetLevelCount(); ++level) {
+		auto src = buffer.GetLevelSize(level - 1);
+		auto dst = buffer.GetLevelSize(level);
+		auto& srcData = buffer.GetLevel(level - 1);
+		auto& dstData = buffer.GetLevel(level);
+
+		for (uint y = 0; y < dst.y; ++y) {
+			for (uint x = 0; x < dst.x; ++x) {
+				float farthest = 0.0f;
+				for (uint sy = 2 * y; sy < std::min(2 * y + 2, src.y); ++sy)
+					for (uint sx = 2 * x; sx < std::min(2 * x + 2, src.x); ++sx)
+						farthest = std::max(farthest, srcData[sx + sy * src.x]);
+				assert(dstData[x + y * dst.x] == farthest);
+			}
+		}
+	}
+
+	auto top = buffer.GetLevelSize(buffer.GetLevelCount() - 1);
+	assert(top.x == 1 && top.y == 1);
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	FrameArena arena;
+
+	{
+		OccluderMesh a;
+		AddTriangle(&a, Pixel(8, 4, 0.5f), Pixel(40, 4, 0.5f), Pixel(40, 20, 0.5f));
+		AddTriangle(&a, Pixel(8, 4, 0.5f), Pixel(40, 20, 0.5f), Pixel(8, 20, 0.5f));
+
+		OccluderMesh b;
+		AddTriangle(&b, Pixel(20, 10, 0.6f), Pixel(60, 14, 0.7f), Pixel(36, 30, 0.65f));
+
+		OccluderMesh c;
+		AddTriangle(&c, Pixel(2, 17, -0.4f), Pixel(18, 29, 0.3f), Pixel(5, 31, 0.2f));
+
+		ArenaArray<OccluderInstance> occluders;
+		occluders.Allocate(&arena, 3);
+		occluders[0] = OccluderInstance{ DG::float4x4::Identity(), &a };
+		occluders[1] = OccluderInstance{ DG::float4x4::Identity(), &b };
+		occluders[2] = OccluderInstance{ DG::float4x4::Identity(), &c };
+
+		// Two tiles wide, B is split between them
+		OcclusionBuffer buffer(64, 32);
+
+		buffer.Render(DG::float4x4::Identity(), occluders, &pool);
+		CheckGolden(buffer, GoldenScene);
+		CheckHierarchy(buffer);
+
+		// Drawing again from scratch, without the pool, gives the same result
+		auto threaded = buffer.GetLevel(0);
+		buffer.Render(DG::float4x4::Identity(), occluders);
+		assert(buffer.GetLevel(0) == threaded);
+
+		// Behind A, in front of A, and behind A but partly over empty pixels
+		BoundingBox behind{ Pixel(12, 6, 0.8f), Pixel(20, 12, 0.9f) };
+		BoundingBox inFront{ Pixel(12, 6, 0.2f), Pixel(20, 12, 0.3f) };
+		BoundingBox straddling{ Pixel(2, 6, 0.8f), Pixel(12, 12, 0.9f) };
+		std::swap(behind.mLower.y, behind.mUpper.y);
+		std::swap(inFront.mLower.y, inFront.mUpper.y);
+		std::swap(straddling.mLower.y, straddling.mUpper.y);
+
+		assert(!buffer.IsVisible(behind));
+		assert(buffer.IsVisible(inFront));
+		assert(buffer.IsVisible(straddling));
+	}
+
+	{
+		// A wall 10 units in front of a camera, through the real projection
+		Camera camera;
+		camera.SetEye(0.0f, 0.0f, 0.0f);
+		camera.LookAt(0.0f, 0.0f, 1.0f);
+		camera.SetClipPlanes(0.1f, 100.0f);
+
+		float aspect = (float)OCCLUSION_BUFFER_WIDTH / (float)OCCLUSION_BUFFER_HEIGHT;
+		auto viewProj = GetCameraViewProjection(camera, nullptr, camera.GetProjection(aspect, false));
+
+		auto wall = OccluderMesh::Box(BoundingBox{
+			DG::float3(-0.5f, -0.5f, -0.5f), DG::float3(0.5f, 0.5f, 0.5f) });
+
+		ArenaArray<OccluderInstance> occluders;
+		occluders.Allocate(&arena, 1);
+		occluders[0].mMesh = wall.get();
+		occluders[0].mTransform = DG::float4x4::Scale(10.0f, 10.0f, 1.0f) *
+			DG::float4x4::Translation(0.0f, 0.0f, 10.5f);
+
+		OcclusionBuffer buffer;
+		buffer.Render(viewProj, occluders, &pool);
+		CheckHierarchy(buffer);
+
+		auto unitBox = [](float x, float y, float z) {
+			return BoundingBox{ DG::float3(x - 0.5f, y - 0.5f, z - 0.5f),
+				DG::float3(x + 0.5f, y + 0.5f, z + 0.5f) };
+		};
+
+		assert(!buffer.IsVisible(unitBox(0.0f, 0.0f, 20.0f)));
+		assert(!buffer.IsVisible(unitBox(3.0f, -2.0f, 50.0f)));
+		assert(buffer.IsVisible(unitBox(0.0f, 0.0f, 5.0f)));
+		assert(buffer.IsVisible(unitBox(12.0f, 0.0f, 20.0f)));
+
+		// Crosses the near plane
+		assert(buffer.IsVisible(unitBox(0.0f, 0.0f, 0.0f)));
+
+		// Hidden, until it is moved out from behind the wall
+		auto box = unitBox(0.0f, 0.0f, 0.0f);
+		assert(!buffer.IsVisible(box, DG::float4x4::Translation(0.0f, 0.0f, 30.0f)));
+		assert(buffer.IsVisible(box, DG::float4x4::Translation(19.0f, 0.0f, 30.0f)));
+	}
+
+	pool.Shutdown();
+
+	std::cout << "Occlusion test passed" << std::endl;
+}
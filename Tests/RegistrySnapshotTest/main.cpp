@@ -0,0 +1,191 @@
+#include <Engine/Core.hpp>
+#include <Engine/RegistrySnapshot.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Morpheus;
+
+// Copied with memcpy
+struct Value {
+	int mValue;
+};
+
+// Copied through the registered hooks
+struct Label {
+	std::string mText;
+};
+
+// Only the entities of the pool are kept
+struct Selected {
+};
+
+struct Unregistered {
+	int mValue;
+};
+
+template <typename T>
+std::vector<entt::entity> PoolOrder(entt::registry& registry) {
+	auto view = registry.view<T>();
+	return std::vector<entt::entity>(view.begin(), view.end());
+}
+
+struct Expected {
+	std::vector<entt::entity> mValues;
+	std::vector<entt::entity> mLabels;
+	std::vector<entt::entity> mSelected;
+	std::vector<int> mValueData;
+	std::vector<std::string> mLabelData;
+	entt::entity mNext;
+};
+
+Expected Record(entt::registry& registry) {
+	Expected result;
+	result.mValues = PoolOrder<Value>(registry);
+	result.mLabels = PoolOrder<Label>(registry);
+	result.mSelected = PoolOrder<Selected>(registry);
+	for (auto e : result.mValues)
+		result.mValueData.emplace_back(registry.get<Value>(e).mValue);
+	for (auto e : result.mLabels)
+		result.mLabelData.emplace_back(registry.get<Label>(e).mText);
+	return result;
+}
+
+// Same ids, same pools in the same order, and the same id is handed out next
+void CheckRestored(entt::registry& registry, const Expected& expected) {
+	auto restored = Record(registry);
+	assert(restored.mValues == expected.mValues);
+	assert(restored.mLabels == expected.mLabels);
+	assert(restored.mSelected == expected.mSelected);
+	assert(restored.mValueData == expected.mValueData);
+	assert(restored.mLabelData == expected.mLabelData);
+	assert(registry.view<Unregistered>().size() == 0);
+	assert(registry.create() == expected.mNext);
+}
+
+int main() {
+	RegistrySnapshot::RegisterComponent<Value>();
+	RegistrySnapshot::RegisterComponent<Label>();
+	RegistrySnapshot::RegisterComponent<Selected>();
+	RegistrySnapshot::RegisterEngineComponents();
+
+	entt::registry registry;
+	std::vector<entt::entity> entities;
+	for (int i = 0; i < 32; ++i) {
+		auto e = registry.create();
+		entities.emplace_back(e);
+		registry.emplace<Value>(e, Value{i});
+		if (i % 3 == 0)
+			registry.emplace<Label>(e, Label{"Entity " + std::to_string(i) +
+				", long enough to live outside of the string"});
+		if (i % 4 == 0)
+			registry.emplace<Selected>(e);
+	}
+
+	// Some destroyed entities, their ids come back with a new version
+	for (int i = 5; i < 32; i += 7)
+		registry.destroy(entities[i]);
+
+	// The packed order differs from the order of creation
+	registry.sort<Value>([&registry](const entt::entity a, const entt::entity b) {
+		return registry.get<Value>(a).mValue > registry.get<Value>(b).mValue;
+	});
+
+	RegistrySnapshot snapshot;
+	snapshot.Capture(registry);
+	assert(snapshot.EntityCount() == entities.size());
+	assert(snapshot.PoolCount() == 3);
+
+	auto expected = Record(registry);
+	auto label = registry.get<Label>(entities[3]).mText;
+	expected.mNext = registry.create();
+	registry.destroy(expected.mNext);
+
+	// Into the registry it was taken from, after it changed
+	{
+		for (int i = 0; i < 32; i += 2)
+			if (registry.valid(entities[i]))
+				registry.destroy(entities[i]);
+		for (int i = 0; i < 8; ++i) {
+			auto e = registry.create();
+			registry.emplace<Value>(e, Value{-i});
+			registry.emplace<Selected>(e);
+			registry.emplace<Unregistered>(e, Unregistered{i});
+		}
+		registry.get<Label>(entities[3]).mText = "Changed";
+
+		snapshot.Restore(registry);
+		CheckRestored(registry, expected);
+	}
+
+	// Into a registry that already has its own entities
+	{
+		entt::registry other;
+		for (int i = 0; i < 50; ++i) {
+			auto e = other.create();
+			other.emplace<Label>(e, Label{"Other"});
+			other.emplace<Unregistered>(e, Unregistered{i});
+		}
+
+		snapshot.Restore(other);
+		CheckRestored(other, expected);
+	}
+
+	// The copied components do not share anything with the snapshot
+	{
+		registry.get<Label>(entities[3]).mText = "Changed again";
+		snapshot.Restore(registry);
+		assert(registry.get<Label>(entities[3]).mText == label);
+	}
+
+	// Captured again with fewer pools, the left over ones are not restored
+	{
+		registry.clear<Label>();
+		registry.clear<Selected>();
+		snapshot.Capture(registry);
+		assert(snapshot.PoolCount() == 1);
+
+		registry.emplace<Selected>(entities[0]);
+		snapshot.Restore(registry);
+		assert(registry.view<Label>().size() == 0);
+		assert(registry.view<Selected>().size() == 0);
+		assert(registry.view<Value>().size() == expected.mValues.size());
+	}
+
+	// Unregistered components cannot be captured
+	{
+		registry.emplace<Unregistered>(entities[0], Unregistered{1});
+		bool bThrew = false;
+		try {
+			snapshot.Capture(registry);
+		} catch (std::runtime_error&) {
+			bThrew = true;
+		}
+		assert(bThrew);
+	}
+
+	// Frames keep their root and camera
+	{
+		Frame frame;
+		frame.mCamera = frame.CreateEntity();
+		auto child = frame.CreateEntity(frame.mCamera);
+		frame.mRegistry.emplace<Value>(child, Value{7});
+
+		RegistrySnapshot frameSnapshot;
+		frameSnapshot.Capture(frame);
+
+		Frame copy;
+		copy.CreateEntity();
+		frameSnapshot.Restore(copy);
+
+		assert(copy.mRoot == frame.mRoot);
+		assert(copy.mCamera == frame.mCamera);
+		assert(copy.GetParent(child) == frame.mCamera);
+		assert(copy.mRegistry.get<Value>(child).mValue == 7);
+	}
+
+	std::cout << "Registry snapshot test passed" << std::endl;
+}
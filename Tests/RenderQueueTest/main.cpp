@@ -0,0 +1,121 @@
+#include <Engine/Core.hpp>
+#include <Engine/RenderQueue.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <set>
+
+using namespace Morpheus;
+
+int main() {
+	constexpr int geometryCount = 10;
+	constexpr int materialCount = 5;
+	constexpr int instanceCount = 20000;
+
+	// The queue never looks inside the geometry, only compares pointers
+	char geometryStorage[geometryCount];
+	auto geometryOf = [&](int i) {
+		return reinterpret_cast<Geometry*>(&geometryStorage[i]);
+	};
+
+	// Materials 0 and 1 share a pipeline, as do 2, 3 and 4
+	char pipelineStorage[2];
+	RenderQueue::pipeline_func_t pipelineOf = [&](MaterialId id) -> const void* {
+		return &pipelineStorage[id < 2 ? 0 : 1];
+	};
+
+	std::mt19937 gen(0);
+	std::uniform_int_distribution<int> geometryDist(0, geometryCount - 1);
+	std::uniform_int_distribution<int> materialDist(0, materialCount - 1);
+	std::uniform_real_distribution<float> positionDist(-50.0f, 50.0f);
+
+	FrameArena arena;
+	ArenaArray<StaticMeshInstance> instances;
+	instances.Allocate(&arena, instanceCount);
+
+	for (int i = 0; i < instanceCount; ++i) {
+		auto& instance = instances[i];
+		instance.mTransform = DG::float4x4::Translation(
+			positionDist(gen), positionDist(gen), positionDist(gen));
+		instance.mGeometry = geometryOf(geometryDist(gen));
+		instance.mMaterial = i % 100 == 0 ? NullMaterialId : materialDist(gen);
+		instance.mEntity = entt::null;
+	}
+
+	// Cull every other instance
+	std::vector<uint32_t> visible;
+	for (uint32_t i = 0; i < instanceCount; i += 2)
+		visible.emplace_back(i);
+
+	// What batching consecutive instances used to give
+	std::set<std::pair<Geometry*, MaterialId>> combinations;
+	uint consecutiveDraws = 0;
+	for (size_t i = 0; i < visible.size(); ++i) {
+		auto& instance = instances[visible[i]];
+		if (instance.mMaterial == NullMaterialId)
+			continue;
+		combinations.emplace(instance.mGeometry, instance.mMaterial);
+		if (i == 0 || instances[visible[i - 1]].mGeometry != instance.mGeometry
+			|| instances[visible[i - 1]].mMaterial != instance.mMaterial)
+			++consecutiveDraws;
+	}
+
+	DG::float3 eye(0.0f, 0.0f, 0.0f);
+	RenderQueue queue;
+	queue.Build(instances, visible, eye, 100.0f, pipelineOf);
+
+	auto& order = queue.GetOrder();
+	auto& batches = queue.GetBatches();
+	auto& stats = queue.GetStats();
+
+	// Every visible instance is packed exactly once
+	assert(order.size() == visible.size());
+	std::vector<uint32_t> sorted(order.begin(), order.end());
+	std::sort(sorted.begin(), sorted.end());
+	assert(sorted == visible);
+
+	// Batches cover the order without gaps, one per geometry and material
+	uint next = 0;
+	std::set<std::pair<Geometry*, MaterialId>> seen;
+	for (auto& batch : batches) {
+		assert(batch.mFirstInstance == next);
+		assert(batch.mInstanceCount > 0);
+		next += batch.mInstanceCount;
+
+		assert(seen.emplace(batch.mGeometry, batch.mMaterial).second);
+
+		float lastDepth = 0.0f;
+		for (uint i = batch.mFirstInstance; i < batch.mFirstInstance + batch.mInstanceCount; ++i) {
+			auto& instance = instances[order[i]];
+			assert(instance.mGeometry == batch.mGeometry);
+			assert(instance.mMaterial == batch.mMaterial);
+
+			// Front to back, give or take a depth bucket
+			auto& m = instance.mTransform;
+			float depth = DG::length(DG::float3(m.m30, m.m31, m.m32) - eye);
+			assert(depth >= lastDepth - 0.01f);
+			lastDepth = std::max(lastDepth, depth);
+		}
+	}
+	assert(next == order.size());
+
+	assert(stats.mDrawCalls == combinations.size());
+	assert(stats.mMaterialChanges == materialCount);
+	assert(stats.mPipelineChanges == 2);
+	assert(stats.mGeometryChanges <= stats.mDrawCalls);
+
+	std::cout << "Consecutive batching: " << consecutiveDraws << " draws" << std::endl;
+	std::cout << "Render queue: " << stats.mDrawCalls << " draws, "
+		<< stats.mMaterialChanges << " material changes, "
+		<< stats.mPipelineChanges << " pipeline changes" << std::endl;
+
+	// Rebuilding with nothing visible empties the queue
+	queue.Build(instances, std::vector<uint32_t>(), eye, 100.0f, pipelineOf);
+	assert(queue.GetOrder().empty());
+	assert(queue.GetBatches().empty());
+	assert(queue.GetStats().mDrawCalls == 0);
+
+	std::cout << "Render queue test passed" << std::endl;
+}
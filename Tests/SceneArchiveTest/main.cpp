@@ -0,0 +1,188 @@
+#include <Engine/Core.hpp>
+#include <Engine/SceneArchive.hpp>
+#include <Engine/Resources/ResourceSerialization.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+using namespace Morpheus;
+
+// Every entity of the test gets a different name, so the two frames can be
+// matched without relying on entity ids
+struct Name {
+	uint32_t mValue;
+};
+
+const uint32_t NoIndex = std::numeric_limits<uint32_t>::max();
+
+std::unordered_map<uint32_t, entt::entity> ByName(Frame& frame) {
+	std::unordered_map<uint32_t, entt::entity> result;
+	for (auto e : frame.mRegistry.view<Name>())
+		result[frame.mRegistry.get<Name>(e).mValue] = e;
+	return result;
+}
+
+uint32_t NameOf(Frame& frame, entt::entity e) {
+	if (e == entt::null)
+		return NoIndex;
+	auto name = frame.mRegistry.try_get<Name>(e);
+	return name ? name->mValue : NoIndex - 1;
+}
+
+// Links and components are the same, up to the names of the entities. The
+// root of the archive is linked to whatever it was instantiated under.
+void CheckSame(Frame& a, Frame& b, size_t expectedCount, uint32_t rootName) {
+	auto namesA = ByName(a);
+	auto namesB = ByName(b);
+	assert(namesB.size() == expectedCount);
+
+	for (auto& it : namesB) {
+		auto ea = namesA.at(it.first);
+		auto eb = it.second;
+
+		auto& ha = a.mRegistry.get<HierarchyData>(ea);
+		auto& hb = b.mRegistry.get<HierarchyData>(eb);
+		if (it.first != rootName) {
+			assert(NameOf(a, ha.mParent) == NameOf(b, hb.mParent));
+			assert(NameOf(a, ha.mPrevious) == NameOf(b, hb.mPrevious));
+			assert(NameOf(a, ha.mNext) == NameOf(b, hb.mNext));
+		}
+		assert(NameOf(a, ha.mFirstChild) == NameOf(b, hb.mFirstChild));
+		assert(NameOf(a, ha.mLastChild) == NameOf(b, hb.mLastChild));
+
+		auto ta = a.mRegistry.try_get<Transform>(ea);
+		auto tb = b.mRegistry.try_get<Transform>(eb);
+		assert(!ta == !tb);
+		if (ta) {
+			auto pa = ta->GetTranslation();
+			auto pb = tb->GetTranslation();
+			assert(pa.x == pb.x && pa.y == pb.y && pa.z == pb.z);
+		}
+	}
+}
+
+// A scene with a single entity and a hand written hierarchy block
+std::string MakeArchive(uint32_t parent, bool bHierarchy) {
+	std::stringstream stream;
+	{
+		cereal::PortableBinaryOutputArchive ar(stream);
+		uint version = SCENE_ARCHIVE_VERSION;
+		ar(version);
+		ar((uint64_t)1);
+		ar((uint32_t)0);
+		ar(NoIndex);
+
+		ar(SceneBlockType::GEOMETRY_KEYS);
+		ar((uint64_t)0);
+
+		if (bHierarchy) {
+			ar(SceneBlockType::HIERARCHY);
+			uint32_t columns[5] = { parent, NoIndex, NoIndex, NoIndex, NoIndex };
+			for (auto column : columns)
+				ar(cereal::binary_data(&column, sizeof(column)));
+		}
+
+		ar(SceneBlockType::END);
+	}
+	return stream.str();
+}
+
+bool ReadThrows(const std::string& archive) {
+	std::stringstream stream(archive);
+	ImmediateTaskQueue queue;
+	SceneData data;
+	try {
+		SceneArchive::Read(stream, nullptr, &queue, &data);
+	} catch (std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+int main() {
+	RegistrySnapshot::RegisterEngineComponents();
+	RegistrySnapshot::RegisterComponent<Name>();
+
+	auto noKeys = [](const Geometry*, LoadParams<Geometry>*) { return false; };
+
+	Frame frame;
+	frame.mRegistry.emplace<Name>(frame.mRoot, Name{0});
+
+	frame.mCamera = frame.CreateEntity();
+	frame.mRegistry.emplace<Name>(frame.mCamera, Name{1});
+	frame.mRegistry.emplace<Transform>(frame.mCamera).SetTranslation(0.0f, 2.0f, -5.0f);
+
+	// A small tree, some entities without a transform
+	auto parent = frame.CreateEntity();
+	frame.mRegistry.emplace<Name>(parent, Name{2});
+	frame.mRegistry.emplace<Transform>(parent).SetTranslation(1.0f, 0.0f, 0.0f);
+
+	uint32_t name = 3;
+	for (int i = 0; i < 3; ++i) {
+		auto child = frame.CreateEntity(parent);
+		frame.mRegistry.emplace<Name>(child, Name{name++});
+		if (i != 1)
+			frame.mRegistry.emplace<Transform>(child).SetTranslation((float)i, 1.0f, 0.0f);
+
+		auto grandChild = frame.CreateEntity(child);
+		frame.mRegistry.emplace<Name>(grandChild, Name{name++});
+	}
+
+	ImmediateTaskQueue queue;
+
+	// The whole frame
+	{
+		std::stringstream stream;
+		SceneArchive::Save(frame, stream, noKeys);
+
+		SceneData data;
+		SceneArchive::Read(stream, nullptr, &queue, &data);
+		assert(data.mEntityCount == name);
+
+		Frame copy;
+		entt::entity camera;
+		auto root = SceneArchive::Instantiate(&copy, data, copy.mRoot, &queue, &camera);
+
+		assert(copy.GetParent(root) == copy.mRoot);
+		assert(NameOf(copy, root) == 0);
+		assert(NameOf(copy, camera) == 1);
+		CheckSame(frame, copy, name, 0);
+	}
+
+	// A subtree, links outside of it are dropped
+	{
+		std::stringstream stream;
+		SceneArchive::Save(frame, parent, stream, noKeys);
+
+		SceneData data;
+		SceneArchive::Read(stream, nullptr, &queue, &data);
+		assert(data.mEntityCount == name - 2);
+
+		Frame copy;
+		entt::entity camera;
+		auto root = SceneArchive::Instantiate(&copy, data, entt::null, &queue, &camera);
+
+		assert(camera == entt::null);
+		assert(NameOf(copy, root) == 2);
+		assert(copy.GetParent(root) == entt::null);
+		assert(copy.mRegistry.get<HierarchyData>(root).mNext == entt::null);
+		CheckSame(frame, copy, name - 2, 2);
+
+		// Instantiated twice, the copies do not share entities
+		SceneArchive::Instantiate(&copy, data, copy.mRoot, &queue);
+		assert(copy.mRegistry.view<Name>().size() == 2 * (name - 2));
+	}
+
+	// Hand written archives, the reader rejects what Instantiate cannot use
+	{
+		assert(!ReadThrows(MakeArchive(NoIndex, true)));
+		assert(ReadThrows(MakeArchive(1, true)));
+		assert(ReadThrows(MakeArchive(NoIndex - 1, true)));
+		assert(ReadThrows(MakeArchive(NoIndex, false)));
+	}
+
+	std::cout << "Scene archive test passed" << std::endl;
+}
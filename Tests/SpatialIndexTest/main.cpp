@@ -0,0 +1,322 @@
+#include <Engine/Core.hpp>
+#include <Engine/SpatialIndex.hpp>
+#include <Engine/Culling.hpp>
+#include <Engine/Raycaster.hpp>
+#include <Engine/RendererTransformCache.hpp>
+#include <Engine/Components/StaticMeshComponent.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_map>
+
+using namespace Morpheus;
+
+bool Encloses(const BoundingBox& outer, const BoundingBox& inner) {
+	return outer.mLower.x <= inner.mLower.x && outer.mUpper.x >= inner.mUpper.x &&
+		outer.mLower.y <= inner.mLower.y && outer.mUpper.y >= inner.mUpper.y &&
+		outer.mLower.z <= inner.mLower.z && outer.mUpper.z >= inner.mUpper.z;
+}
+
+BoundingBox RandomBox(std::mt19937& gen) {
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+	DG::float3 lower(position(gen), position(gen), position(gen));
+	DG::float3 extents(size(gen), size(gen), size(gen));
+	return BoundingBox{lower, lower + extents};
+}
+
+std::set<entt::entity> ToSet(const std::vector<entt::entity>& entities) {
+	std::set<entt::entity> result(entities.begin(), entities.end());
+	// Every entity is only reported once
+	assert(result.size() == entities.size());
+	return result;
+}
+
+// Every query returns exactly the entities whose loose bounds pass the same test
+void CheckQueries(const SpatialIndex& index,
+	const std::unordered_map<entt::entity, BoundingBox>& boxes,
+	std::mt19937& gen) {
+	assert(index.Size() == boxes.size());
+
+	for (auto& it : boxes) {
+		assert(index.Contains(it.first));
+		assert(Encloses(index.GetBounds(it.first), it.second));
+	}
+
+	std::vector<entt::entity> result;
+
+	for (int i = 0; i < 20; ++i) {
+		auto query = RandomBox(gen);
+		query.mUpper = query.mUpper + DG::float3(20.0f, 20.0f, 20.0f);
+
+		result.clear();
+		index.Query(query, &result);
+
+		std::set<entt::entity> expected;
+		for (auto& it : boxes)
+			if (Intersects(index.GetBounds(it.first), query))
+				expected.insert(it.first);
+
+		assert(ToSet(result) == expected);
+	}
+
+	std::uniform_real_distribution<float> angle(0.0f, 2.0f * DG::PI_F);
+	for (int i = 0; i < 10; ++i) {
+		Camera camera;
+		camera.SetEye(0.0f, 0.0f, 0.0f);
+		float a = angle(gen);
+		camera.LookAt(std::cos(a), 0.0f, std::sin(a));
+		camera.SetClipPlanes(0.1f, 60.0f);
+
+		auto frustum = Frustum::FromCamera(camera, nullptr,
+			camera.GetProjection(1.0f, false), false);
+
+		result.clear();
+		index.Query(frustum, &result);
+
+		std::set<entt::entity> expected;
+		for (auto& it : boxes)
+			if (frustum.IsVisible(index.GetBounds(it.first)))
+				expected.insert(it.first);
+
+		assert(ToSet(result) == expected);
+	}
+
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	for (int i = 0; i < 20; ++i) {
+		Ray ray;
+		ray.mStart = DG::float3(0.0f, 0.0f, 0.0f);
+		ray.mDirection = DG::normalize(DG::float3(direction(gen), direction(gen), direction(gen)));
+		PrecomputedRay pre(ray);
+
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		std::vector<entt::entity> hits;
+		index.Raycast(ray, inf, [&hits](entt::entity e, float t) {
+			hits.emplace_back(e);
+			return inf;
+		});
+
+		std::set<entt::entity> expected;
+		for (auto& it : boxes)
+			if (pre.Intersect(index.GetBounds(it.first), inf) != inf)
+				expected.insert(it.first);
+
+		assert(ToSet(hits) == expected);
+	}
+}
+
+void TestIndex(std::mt19937& gen) {
+	SpatialIndex index;
+	std::unordered_map<entt::entity, BoundingBox> boxes;
+	uint32_t next = 0;
+
+	for (; next < 2000; ++next) {
+		auto box = RandomBox(gen);
+		index.Insert((entt::entity)next, box);
+		boxes[(entt::entity)next] = box;
+	}
+
+	CheckQueries(index, boxes, gen);
+
+	std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+	std::uniform_int_distribution<uint32_t> pick(0, 1999);
+
+	for (int round = 0; round < 20; ++round) {
+		// Most things barely move, some jump across the world
+		for (int i = 0; i < 200; ++i) {
+			auto e = (entt::entity)pick(gen);
+			auto it = boxes.find(e);
+			if (it == boxes.end())
+				continue;
+
+			if (i % 10 == 0) {
+				it->second = RandomBox(gen);
+			} else {
+				DG::float3 offset(jitter(gen), jitter(gen), jitter(gen));
+				it->second.mLower = it->second.mLower + offset;
+				it->second.mUpper = it->second.mUpper + offset;
+			}
+
+			index.Move(e, it->second);
+		}
+
+		for (int i = 0; i < 50; ++i) {
+			auto e = (entt::entity)pick(gen);
+			index.Remove(e);
+			boxes.erase(e);
+		}
+
+		for (int i = 0; i < 50; ++i, ++next) {
+			auto box = RandomBox(gen);
+			index.Insert((entt::entity)next, box);
+			boxes[(entt::entity)next] = box;
+		}
+
+		index.Optimize();
+		CheckQueries(index, boxes, gen);
+	}
+
+	auto& stats = index.GetStats();
+	std::cout << index.Size() << " entities, height " << index.GetHeight()
+		<< ", " << stats.mReinsertCount << " reinserts, "
+		<< stats.mRebuildCount << " rebuilds" << std::endl;
+
+	// Small moves stay inside the loose bounds
+	assert(stats.mReinsertCount < 20 * 200);
+
+	uint rebuilds = stats.mRebuildCount;
+	index.Rebuild();
+	assert(index.GetStats().mRebuildCount == rebuilds + 1);
+	assert(!index.Optimize());
+	CheckQueries(index, boxes, gen);
+
+	// Emptied out, then used again
+	for (auto& it : boxes)
+		index.Remove(it.first);
+	assert(index.Size() == 0);
+	assert(index.GetHeight() == 0);
+
+	std::vector<entt::entity> result;
+	index.Query(BoundingBox{DG::float3(-1000.0f, -1000.0f, -1000.0f),
+		DG::float3(1000.0f, 1000.0f, 1000.0f)}, &result);
+	assert(result.empty());
+
+	index.Insert((entt::entity)0, RandomBox(gen));
+	assert(index.GetHeight() == 1);
+}
+
+// The index follows the meshes and transforms of a frame
+void CheckFrame(Frame& frame, const SpatialIndex& index) {
+	auto& registry = frame.mRegistry;
+	auto view = registry.view<StaticMeshComponent>();
+
+	size_t count = 0;
+	BoundingBox bounds;
+	for (auto e : view) {
+		if (!SpatialIndexUpdater::GetWorldBounds(registry, e, &bounds))
+			continue;
+
+		assert(index.Contains(e));
+		assert(Encloses(index.GetBounds(e), bounds));
+		++count;
+	}
+
+	assert(index.Size() == count);
+}
+
+void TestFrame(ThreadPool& pool, std::mt19937& gen) {
+	auto box = Geometry::Prefabs::Get(Geometry::Prefab::BOX,
+		VertexLayout::PositionUVNormalTangent());
+
+	std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+	auto randomTransform = [&]() {
+		return Transform(DG::float3(position(gen), position(gen), position(gen)),
+			DG::Quaternion(0.0f, 0.0f, 0.0f, 1.0f), DG::float3(1.0f, 1.0f, 1.0f));
+	};
+
+	Frame frame;
+	std::vector<entt::entity> entities;
+	for (int i = 0; i < 500; ++i) {
+		auto e = frame.CreateEntity();
+		frame.Emplace<Transform>(e, randomTransform());
+
+		StaticMeshComponent mesh;
+		mesh.mGeometry = box;
+		frame.Emplace<StaticMeshComponent>(e, std::move(mesh));
+		entities.emplace_back(e);
+	}
+
+	TransformCacheUpdater transforms(&frame);
+	transforms.UpdateAll(&pool);
+
+	SpatialIndexUpdater updater(&frame);
+	Raycaster raycaster(&frame);
+	raycaster.Update();
+	CheckFrame(frame, updater.GetIndex());
+
+	// Move some, destroy some and add some
+	for (int i = 0; i < 100; ++i) {
+		auto t = randomTransform();
+		frame.mRegistry.patch<Transform>(entities[i], [&t](Transform& transform) {
+			transform = t;
+		});
+	}
+
+	for (int i = 100; i < 150; ++i)
+		frame.Destroy(entities[i]);
+
+	for (int i = 0; i < 50; ++i) {
+		auto e = frame.CreateEntity();
+		frame.Emplace<Transform>(e, randomTransform());
+
+		StaticMeshComponent mesh;
+		mesh.mGeometry = box;
+		frame.Emplace<StaticMeshComponent>(e, std::move(mesh));
+		entities.emplace_back(e);
+	}
+
+	// Loses its mesh, but keeps its transform
+	frame.mRegistry.remove<StaticMeshComponent>(entities[200]);
+
+	transforms.UpdateChanges(&pool);
+	updater.Update();
+	CheckFrame(frame, updater.GetIndex());
+
+	// The raycaster keeps its own index the same way
+	raycaster.Update();
+	assert(raycaster.GetInstanceCount() == updater.GetIndex().Size());
+	assert(raycaster.GetRebuildCount() >= 1);
+	assert(raycaster.GetRefitCount() == 1);
+
+	auto& target = frame.mRegistry.get<RendererTransformCache>(entities[0]).mCache;
+	Ray ray;
+	ray.mStart = DG::float3(target.m30, 1000.0f, target.m32);
+	ray.mDirection = DG::float3(0.0f, -1.0f, 0.0f);
+
+	RaycastHit hit;
+	assert(raycaster.CastClosest(ray, &hit));
+	assert(raycaster.CastAny(ray));
+	assert(hit.mDistance <= 1000.0f - target.m31);
+
+	// Either the frame or the updater may be destroyed first
+	{
+		auto other = std::make_unique<Frame>();
+		SpatialIndexUpdater outlived(other.get());
+		Raycaster outlivedRaycaster(other.get());
+		other.reset();
+		outlived.Update();
+		outlivedRaycaster.Update();
+	}
+
+	{
+		Frame other;
+		{
+			SpatialIndexUpdater destroyed(&other);
+			Raycaster destroyedRaycaster(&other);
+		}
+
+		auto e = other.CreateEntity();
+		StaticMeshComponent mesh;
+		mesh.mGeometry = box;
+		other.Emplace<StaticMeshComponent>(e, std::move(mesh));
+	}
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	std::mt19937 gen(0);
+
+	TestIndex(gen);
+	TestFrame(pool, gen);
+
+	pool.Shutdown();
+
+	std::cout << "Spatial index test passed" << std::endl;
+}
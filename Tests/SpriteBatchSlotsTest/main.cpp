@@ -0,0 +1,128 @@
+#include <Engine/SpriteBatch.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+
+using namespace Morpheus;
+
+// Slots only compare texture pointers, they are never dereferenced
+DG::ITexture* FakeTexture(size_t i) {
+	return reinterpret_cast<DG::ITexture*>((i + 1) * 64);
+}
+
+// Feeds a stream of sprites through the slots the way SpriteBatch does and
+// returns the number of draws it takes
+uint CountDraws(const std::vector<size_t>& textures, uint batchSize, uint slotCount) {
+	SpriteBatchSlots slots(batchSize, slotCount);
+	uint draws = 0;
+
+	for (auto texture : textures) {
+		int slot = slots.Add(FakeTexture(texture));
+		if (slot < 0) {
+			assert(!slots.IsEmpty());
+			++draws;
+			slots.Reset();
+			slot = slots.Add(FakeTexture(texture));
+		}
+
+		assert(slot >= 0 && (uint)slot < slots.GetUsedSlots());
+		assert(slots.GetTexture(slot) == FakeTexture(texture));
+		assert(slots.GetSpriteCount() <= batchSize);
+		assert(slots.GetUsedSlots() <= slotCount);
+	}
+
+	if (!slots.IsEmpty())
+		++draws;
+
+	return draws;
+}
+
+int main() {
+	// A single slot flushes on every texture change
+	{
+		SpriteBatchSlots slots(100, 1);
+		assert(slots.Add(FakeTexture(0)) == 0);
+		assert(slots.Add(FakeTexture(0)) == 0);
+		assert(slots.Add(FakeTexture(1)) == -1);
+		assert(slots.GetSpriteCount() == 2);
+
+		slots.Reset();
+		assert(slots.IsEmpty());
+		assert(slots.Add(FakeTexture(1)) == 0);
+	}
+
+	// Textures keep the slot they were given until the batch is reset
+	{
+		SpriteBatchSlots slots(100, 4);
+		for (size_t i = 0; i < 4; ++i)
+			assert(slots.Add(FakeTexture(i)) == (int)i);
+		for (size_t i = 0; i < 4; ++i)
+			assert(slots.Add(FakeTexture(3 - i)) == (int)(3 - i));
+
+		assert(slots.GetUsedSlots() == 4);
+		assert(slots.GetSpriteCount() == 8);
+
+		// A fifth texture does not fit, and a failed add changes nothing
+		assert(slots.Add(FakeTexture(4)) == -1);
+		assert(slots.GetSpriteCount() == 8);
+		assert(slots.Add(FakeTexture(2)) == 2);
+
+		slots.Reset();
+		assert(slots.GetUsedSlots() == 0);
+		assert(slots.Add(FakeTexture(4)) == 0);
+	}
+
+	// The batch is full after batchSize sprites, whatever their textures
+	{
+		SpriteBatchSlots slots(3, 8);
+		assert(slots.Add(FakeTexture(0)) == 0);
+		assert(slots.Add(FakeTexture(1)) == 1);
+		assert(slots.Add(FakeTexture(0)) == 0);
+		assert(slots.Add(FakeTexture(0)) == -1);
+	}
+
+	// Invalid configurations are rejected
+	{
+		bool bThrew = false;
+		try {
+			SpriteBatchSlots slots(100, MAX_SPRITE_BATCH_TEXTURE_SLOTS + 1);
+		} catch (std::runtime_error&) {
+			bThrew = true;
+		}
+		assert(bThrew);
+	}
+
+	// A UI-like stream: thousands of small sprites out of a few dozen textures
+	{
+		std::mt19937 gen(0);
+		std::uniform_int_distribution<size_t> texture(0, 5);
+		std::uniform_int_distribution<size_t> panel(0, 5);
+
+		// Panels of sprites mostly share their textures
+		std::vector<size_t> stream;
+		for (int i = 0; i < 5000; ++i)
+			stream.emplace_back(panel(gen) * 6 + texture(gen));
+
+		uint single = CountDraws(stream, DEFAULT_SPRITE_BATCH_SIZE, 1);
+		uint multi = CountDraws(stream, DEFAULT_SPRITE_BATCH_SIZE, DEFAULT_SPRITE_BATCH_TEXTURE_SLOTS);
+		uint wide = CountDraws(stream, DEFAULT_SPRITE_BATCH_SIZE, MAX_SPRITE_BATCH_TEXTURE_SLOTS);
+
+		std::cout << single << " draws with one slot, " << multi << " with "
+			<< DEFAULT_SPRITE_BATCH_TEXTURE_SLOTS << ", " << wide << " with "
+			<< MAX_SPRITE_BATCH_TEXTURE_SLOTS << std::endl;
+
+		assert(multi < single);
+		assert(wide <= multi);
+
+		// Few enough textures all fit, so only the batch size splits draws
+		std::vector<size_t> few;
+		for (int i = 0; i < 5000; ++i)
+			few.emplace_back(texture(gen));
+
+		uint expected = (5000 + DEFAULT_SPRITE_BATCH_SIZE - 1) / DEFAULT_SPRITE_BATCH_SIZE;
+		assert(CountDraws(few, DEFAULT_SPRITE_BATCH_SIZE, DEFAULT_SPRITE_BATCH_TEXTURE_SLOTS) == expected);
+	}
+
+	std::cout << "Sprite batch slots test passed" << std::endl;
+}
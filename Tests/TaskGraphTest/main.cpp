@@ -0,0 +1,246 @@
+#include <Engine/ThreadPool.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Morpheus;
+
+#define TASK_COUNT 5
+#define RUN_COUNT 64
+
+enum Node {
+	A, B, C, E, F
+};
+
+// Every run stamps the tasks in the order they finish
+struct Log {
+	std::atomic<uint> mClock;
+	std::atomic<uint> mRuns[TASK_COUNT];
+	std::atomic<uint> mStamps[TASK_COUNT];
+
+	void Clear() {
+		mClock = 0;
+		for (uint i = 0; i < TASK_COUNT; ++i) {
+			mRuns[i] = 0;
+			mStamps[i] = 0;
+		}
+	}
+
+	void Stamp(uint task) {
+		mStamps[task] = ++mClock;
+		++mRuns[task];
+	}
+};
+
+// start -> A -> (B, C) -> join -> E -> done, and E -> F -> done once F is added
+struct Graph {
+	Log mLog;
+	std::vector<Task> mTasks;
+	TaskBarrier mStart;
+	TaskBarrier mJoin;
+	TaskBarrier mDone;
+
+	Graph() {
+		mLog.Clear();
+
+		for (uint i = 0; i < TASK_COUNT; ++i) {
+			mTasks.emplace_back([this, i](const TaskParams& e) {
+				mLog.Stamp(i);
+			}, "Graph Task " + std::to_string(i));
+		}
+
+		mTasks[A]->In().Lock().Connect(&mStart.mOut);
+		mTasks[B]->In().Lock().Connect(mTasks[A]);
+		mTasks[C]->In().Lock().Connect(mTasks[A]);
+		mJoin.mIn.Lock()
+			.Connect(mTasks[B])
+			.Connect(mTasks[C]);
+		mTasks[E]->In().Lock().Connect(&mJoin.mOut);
+		mDone.mIn.Lock().Connect(mTasks[E]);
+	}
+
+	void Reset() {
+		mLog.Clear();
+		mStart.Reset();
+		mJoin.Reset();
+		mDone.Reset();
+		for (auto& task : mTasks)
+			task->Reset();
+	}
+
+	// The diamond ran once, in order, and F only if it is connected
+	void Check(bool bWithF) {
+		for (uint i = 0; i < TASK_COUNT; ++i)
+			assert(mLog.mRuns[i] == (i != F || bWithF ? 1u : 0u));
+
+		assert(mLog.mStamps[A] < mLog.mStamps[B]);
+		assert(mLog.mStamps[A] < mLog.mStamps[C]);
+		assert(mLog.mStamps[B] < mLog.mStamps[E]);
+		assert(mLog.mStamps[C] < mLog.mStamps[E]);
+		if (bWithF)
+			assert(mLog.mStamps[E] < mLog.mStamps[F]);
+	}
+};
+
+void RunCompiled(ITaskQueue* queue, Graph& graph, CompiledTaskGraph& compiled, bool bWithF) {
+	auto start = compiled.FindNode(&graph.mStart);
+	auto join = compiled.FindNode(&graph.mJoin);
+	auto done = compiled.FindNode(&graph.mDone);
+
+	for (uint run = 0; run < RUN_COUNT; ++run) {
+		compiled.Reset();
+		graph.mLog.Clear();
+		assert(!compiled.IsFinished(done));
+
+		compiled.Trigger(queue, start);
+		queue->YieldUntilCondition([&]() {
+			return compiled.IsFinished(done);
+		});
+
+		graph.Check(bWithF);
+		assert(compiled.IsFinished(join));
+		assert(compiled.FinishTime(start) <= compiled.FinishTime(join));
+		assert(compiled.FinishTime(join) <= compiled.FinishTime(done));
+
+		// Completion goes through the graph, the original pins are untouched
+		assert(!graph.mDone.mOut.Lock().IsFinished());
+		assert(!graph.mJoin.mOut.Lock().IsFinished());
+	}
+}
+
+void RunUncompiled(ITaskQueue* queue, Graph& graph) {
+	graph.Reset();
+	queue->Trigger(&graph.mStart);
+	queue->YieldUntilFinished(&graph.mDone.mOut);
+	graph.Check(false);
+}
+
+void Test(ITaskQueue* queue) {
+	Graph graph;
+	CompiledTaskGraph compiled;
+
+	compiled.Compile({&graph.mStart.mIn});
+	assert(compiled.IsCompiled());
+	// Three barriers and the tasks of the diamond
+	assert(compiled.NodeCount() == 3 + TASK_COUNT - 1);
+
+	RunCompiled(queue, graph, compiled, false);
+
+	// Skipped nodes count as finished, without running anything
+	compiled.Reset();
+	graph.mLog.Clear();
+	compiled.SetFinished(compiled.FindNode(&graph.mDone));
+	assert(compiled.IsFinished(compiled.FindNode(&graph.mDone)));
+	assert(graph.mLog.mClock == 0);
+
+	// Released, the tasks run through their own connections again
+	compiled.Release();
+	assert(!compiled.IsCompiled());
+	RunUncompiled(queue, graph);
+
+	// Connected after a release, then compiled again
+	graph.Reset();
+	graph.mTasks[F]->In().Lock().Connect(graph.mTasks[E]);
+	graph.mDone.mIn.Lock().Connect(graph.mTasks[F]);
+	compiled.Compile({&graph.mStart.mIn});
+	assert(compiled.NodeCount() == 3 + TASK_COUNT);
+	RunCompiled(queue, graph, compiled, true);
+	compiled.Release();
+
+	std::cout << "Passed graph test" << std::endl;
+}
+
+bool Throws(const std::function<void()>& func) {
+	try {
+		func();
+	} catch (std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+void TestErrors() {
+	ImmediateTaskQueue queue;
+
+	// Only the entries of the graph can be triggered
+	{
+		Graph graph;
+		CompiledTaskGraph compiled;
+		compiled.Compile({&graph.mStart.mIn});
+		assert(Throws([&]() { compiled.Trigger(&queue, compiled.FindNode(&graph.mJoin)); }));
+
+		TaskBarrier outside;
+		assert(Throws([&]() { compiled.FindNode(&outside); }));
+	}
+
+	// Cycles
+	{
+		Graph graph;
+		graph.mTasks[A]->In().Lock().Connect(graph.mTasks[E]);
+		CompiledTaskGraph compiled;
+		assert(Throws([&]() { compiled.Compile({&graph.mStart.mIn}); }));
+		assert(!compiled.IsCompiled());
+	}
+
+	// Extra edges only exist in the graph
+	{
+		Graph graph;
+		CompiledTaskGraph compiled;
+		compiled.Compile({&graph.mStart.mIn}, {TaskGraphEdge{&graph.mTasks[B]->In(), &graph.mTasks[C]->In()}});
+		assert(compiled.NodeCount() == 3 + TASK_COUNT - 1);
+
+		compiled.Trigger(&queue, compiled.FindNode(&graph.mStart));
+		queue.YieldUntilCondition([&]() {
+			return compiled.IsFinished(compiled.FindNode(&graph.mDone));
+		});
+		graph.Check(false);
+		assert(graph.mLog.mStamps[B] < graph.mLog.mStamps[C]);
+
+		// Released, B and C run in any order again
+		compiled.Release();
+		RunUncompiled(&queue, graph);
+
+		// Both ends must be part of the graph
+		assert(Throws([&]() {
+			compiled.Compile({&graph.mStart.mIn}, {TaskGraphEdge{&graph.mTasks[B]->In(), &graph.mTasks[F]->In()}});
+		}));
+
+		// Edges can close cycles too
+		assert(Throws([&]() {
+			compiled.Compile({&graph.mStart.mIn}, {TaskGraphEdge{&graph.mTasks[E]->In(), &graph.mTasks[A]->In()}});
+		}));
+	}
+
+	// Inputs that nothing in the graph will ever finish
+	{
+		Graph graph;
+		TaskBarrier outside;
+		graph.mTasks[C]->In().Lock().Connect(&outside.mOut);
+		CompiledTaskGraph compiled;
+		assert(Throws([&]() { compiled.Compile({&graph.mStart.mIn}); }));
+		assert(!compiled.IsCompiled());
+	}
+
+	std::cout << "Passed error test" << std::endl;
+}
+
+int main() {
+	{
+		ImmediateTaskQueue queue;
+		Test(&queue);
+	}
+
+	{
+		ThreadPool pool;
+		pool.Startup();
+		Test(&pool);
+		pool.Shutdown();
+	}
+
+	TestErrors();
+}
@@ -0,0 +1,297 @@
+#include <Engine/TextureAtlas.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+
+using namespace Morpheus;
+
+struct Image {
+	uint mWidth;
+	uint mHeight;
+	std::vector<uint8_t> mRGBA;
+};
+
+// Every texel is different, so misplaced copies are caught
+Image MakeImage(uint width, uint height, uint seed) {
+	Image image{width, height, std::vector<uint8_t>((size_t)width * height * 4)};
+	for (uint y = 0; y < height; ++y) {
+		for (uint x = 0; x < width; ++x) {
+			auto texel = &image.mRGBA[((size_t)y * width + x) * 4];
+			texel[0] = (uint8_t)(seed * 37 + x);
+			texel[1] = (uint8_t)(seed * 11 + y);
+			texel[2] = (uint8_t)(x * 7 + y * 13);
+			texel[3] = 255;
+		}
+	}
+	return image;
+}
+
+const uint8_t* PageTexel(TextureAtlas& atlas, uint page, uint x, uint y) {
+	auto& texture = atlas.GetPageTexture(page);
+	auto& subDesc = texture.GetSubDataDescs()[0];
+	return &texture.GetData()[subDesc.mSrcOffset + y * subDesc.mStride + x * 4];
+}
+
+bool SameTexel(const uint8_t* a, const uint8_t* b) {
+	return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
+}
+
+// The image is on its page, surrounded by copies of its edge
+void CheckEntry(TextureAtlas& atlas, AtlasEntryId id, const Image& image) {
+	auto page = atlas.GetPage(id);
+	auto rect = atlas.GetRect(id);
+	uint left = (uint)rect.mPosition.x;
+	uint top = (uint)rect.mPosition.y;
+	int padding = (int)atlas.GetPadding();
+
+	assert(rect.mSize.x == (float)image.mWidth);
+	assert(rect.mSize.y == (float)image.mHeight);
+	assert(left >= atlas.GetPadding() && top >= atlas.GetPadding());
+	assert(left + image.mWidth + atlas.GetPadding() <= atlas.GetPageWidth());
+	assert(top + image.mHeight + atlas.GetPadding() <= atlas.GetPageHeight());
+	assert((left - atlas.GetPadding()) % TEXTURE_ATLAS_ALIGNMENT == 0);
+	assert((top - atlas.GetPadding()) % TEXTURE_ATLAS_ALIGNMENT == 0);
+
+	for (int y = -padding; y < (int)image.mHeight + padding; ++y) {
+		for (int x = -padding; x < (int)image.mWidth + padding; ++x) {
+			int srcX = std::min(std::max(x, 0), (int)image.mWidth - 1);
+			int srcY = std::min(std::max(y, 0), (int)image.mHeight - 1);
+			auto expected = &image.mRGBA[((size_t)srcY * image.mWidth + srcX) * 4];
+			assert(SameTexel(PageTexel(atlas, page, left + x, top + y), expected));
+		}
+	}
+}
+
+void CheckNoOverlap(TextureAtlas& atlas, const std::unordered_map<AtlasEntryId, Image>& images) {
+	std::vector<std::pair<AtlasEntryId, SpriteRect>> rects;
+	for (auto& it : images)
+		rects.emplace_back(it.first, atlas.GetRect(it.first));
+
+	float padding = (float)atlas.GetPadding();
+	for (size_t i = 0; i < rects.size(); ++i) {
+		for (size_t j = i + 1; j < rects.size(); ++j) {
+			if (atlas.GetPage(rects[i].first) != atlas.GetPage(rects[j].first))
+				continue;
+
+			// Padding included, entries never touch
+			auto& a = rects[i].second;
+			auto& b = rects[j].second;
+			bool bOverlapX = a.mPosition.x - padding < b.mPosition.x + b.mSize.x + padding &&
+				b.mPosition.x - padding < a.mPosition.x + a.mSize.x + padding;
+			bool bOverlapY = a.mPosition.y - padding < b.mPosition.y + b.mSize.y + padding &&
+				b.mPosition.y - padding < a.mPosition.y + a.mSize.y + padding;
+			assert(!(bOverlapX && bOverlapY));
+		}
+	}
+}
+
+void TestPacker() {
+	std::mt19937 gen(0);
+	std::uniform_int_distribution<uint> size(1, 64);
+
+	SkylinePacker packer(512, 512);
+	struct Placed {
+		uint mX, mY, mWidth, mHeight;
+	};
+	std::vector<Placed> placed;
+
+	for (int i = 0; i < 2000; ++i) {
+		uint width = size(gen);
+		uint height = size(gen);
+		uint x, y;
+		if (packer.Insert(width, height, &x, &y))
+			placed.emplace_back(Placed{x, y, width, height});
+	}
+
+	size_t area = 0;
+	for (size_t i = 0; i < placed.size(); ++i) {
+		auto& a = placed[i];
+		assert(a.mX + a.mWidth <= 512 && a.mY + a.mHeight <= 512);
+		area += (size_t)a.mWidth * a.mHeight;
+
+		for (size_t j = i + 1; j < placed.size(); ++j) {
+			auto& b = placed[j];
+			bool bOverlap = a.mX < b.mX + b.mWidth && b.mX < a.mX + a.mWidth &&
+				a.mY < b.mY + b.mHeight && b.mY < a.mY + a.mHeight;
+			assert(!bOverlap);
+		}
+	}
+
+	assert(area == packer.GetUsedArea());
+
+	// A full page is mostly used
+	float occupancy = (float)area / (512.0f * 512.0f);
+	std::cout << placed.size() << " rectangles, " << occupancy * 100.0f << "% occupancy" << std::endl;
+	assert(occupancy > 0.75f);
+
+	uint x, y;
+	assert(!packer.Insert(513, 1, &x, &y));
+	packer.Reset();
+	assert(packer.GetUsedArea() == 0);
+	assert(packer.Insert(512, 512, &x, &y) && x == 0 && y == 0);
+}
+
+void TestAtlas() {
+	std::mt19937 gen(1);
+	std::uniform_int_distribution<uint> size(1, 48);
+
+	TextureAtlas atlas(256, 256);
+	assert(atlas.GetSafeMipCount() == 3);
+
+	std::unordered_map<AtlasEntryId, Image> images;
+	for (uint i = 0; i < 200; ++i) {
+		auto image = MakeImage(size(gen), size(gen), i);
+		auto id = atlas.Insert(image.mWidth, image.mHeight, &image.mRGBA[0], image.mWidth * 4);
+		assert(id != NullAtlasEntryId);
+		images[id] = std::move(image);
+	}
+
+	// Many small images share a few pages
+	std::cout << images.size() << " images on " << atlas.GetPageCount() << " pages" << std::endl;
+	assert(atlas.GetPageCount() < images.size() / 10);
+
+	for (auto& it : images)
+		CheckEntry(atlas, it.first, it.second);
+	CheckNoOverlap(atlas, images);
+
+	// Rects and UVs of the original image land on the page
+	{
+		auto& it = *images.begin();
+		auto rect = atlas.GetRect(it.first);
+		auto tile = atlas.Remap(it.first, SpriteRect(1.0f, 1.0f, 2.0f, 3.0f));
+		assert(tile.mPosition.x == rect.mPosition.x + 1.0f);
+		assert(tile.mPosition.y == rect.mPosition.y + 1.0f);
+		assert(tile.mSize.x == 2.0f && tile.mSize.y == 3.0f);
+
+		auto uvs = atlas.GetUVs(it.first);
+		assert(uvs.x == rect.mPosition.x / 256.0f);
+		assert(uvs.w == (rect.mPosition.y + rect.mSize.y) / 256.0f);
+
+		auto corner = atlas.RemapUV(it.first, DG::float2(1.0f, 1.0f));
+		assert(std::abs(corner.x - uvs.z) < 1e-6f && std::abs(corner.y - uvs.w) < 1e-6f);
+		corner = atlas.RemapUV(it.first, DG::float2(0.0f, 0.0f));
+		assert(corner.x == uvs.x && corner.y == uvs.y);
+	}
+
+	// Remove most of the images, their texels go away
+	uint version = atlas.GetPageVersion(0);
+	std::vector<AtlasEntryId> removed;
+	for (auto& it : images)
+		if (it.first % 4 != 0)
+			removed.emplace_back(it.first);
+
+	for (auto id : removed) {
+		auto rect = atlas.GetRect(id);
+		auto page = atlas.GetPage(id);
+		atlas.Remove(id);
+		images.erase(id);
+
+		assert(!atlas.Contains(id));
+		uint8_t zero[4] = {0, 0, 0, 0};
+		assert(SameTexel(PageTexel(atlas, page, (uint)rect.mPosition.x, (uint)rect.mPosition.y), zero));
+	}
+	assert(atlas.GetEntryCount() == images.size());
+	assert(atlas.NeedsCompaction());
+
+	// Removed twice or never there, nothing happens
+	atlas.Remove(removed[0]);
+	atlas.Remove(NullAtlasEntryId);
+
+	size_t pages = atlas.GetPageCount();
+	uint released = atlas.Compact();
+	std::cout << "Compaction released " << released << " of " << pages << " pages" << std::endl;
+
+	assert(released > 0);
+	assert(atlas.GetPageCount() == pages - released);
+	assert(atlas.GetCompactCount() == 1);
+	assert(atlas.GetPageVersion(0) != version);
+	assert(!atlas.NeedsCompaction());
+
+	for (auto& it : images)
+		CheckEntry(atlas, it.first, it.second);
+	CheckNoOverlap(atlas, images);
+
+	// Entries can be added again after compaction
+	for (uint i = 0; i < 20; ++i) {
+		auto image = MakeImage(size(gen), size(gen), 1000 + i);
+		auto id = atlas.Insert(image.mWidth, image.mHeight, &image.mRGBA[0], image.mWidth * 4);
+		images[id] = std::move(image);
+	}
+
+	for (auto& it : images)
+		CheckEntry(atlas, it.first, it.second);
+	CheckNoOverlap(atlas, images);
+
+	// Everything removed, compaction releases every page
+	for (auto& it : images)
+		atlas.Remove(it.first);
+	atlas.Compact();
+	assert(atlas.GetPageCount() == 0);
+
+	// Too large for a page
+	bool bThrew = false;
+	try {
+		auto image = MakeImage(256, 8, 0);
+		atlas.Insert(image.mWidth, image.mHeight, &image.mRGBA[0], image.mWidth * 4);
+	} catch (std::runtime_error&) {
+		bThrew = true;
+	}
+	assert(bThrew);
+}
+
+void TestTextures() {
+	TextureAtlas atlas(128, 128, 2);
+
+	// Two channel raw textures are expanded like ImageCopy does
+	DG::TextureDesc desc;
+	desc.Type = DG::RESOURCE_DIM_TEX_2D;
+	desc.Width = 5;
+	desc.Height = 3;
+	desc.MipLevels = 1;
+	desc.Format = DG::TEX_FORMAT_RG8_UNORM;
+
+	Texture texture(desc);
+	auto data = (uint8_t*)texture.GetSubresourcePtr(0, 0);
+	auto stride = texture.GetSubDataDescs()[0].mStride;
+	for (uint y = 0; y < desc.Height; ++y) {
+		for (uint x = 0; x < desc.Width; ++x) {
+			data[y * stride + x * 2] = (uint8_t)(x * 10);
+			data[y * stride + x * 2 + 1] = (uint8_t)(y * 10);
+		}
+	}
+
+	auto id = atlas.Insert(texture);
+	auto rect = atlas.GetRect(id);
+	assert(rect.mSize.x == 5.0f && rect.mSize.y == 3.0f);
+
+	for (uint y = 0; y < desc.Height; ++y) {
+		for (uint x = 0; x < desc.Width; ++x) {
+			auto texel = PageTexel(atlas, atlas.GetPage(id),
+				(uint)rect.mPosition.x + x, (uint)rect.mPosition.y + y);
+			assert(texel[0] == x * 10 && texel[1] == y * 10);
+			assert(texel[2] == 0 && texel[3] == 255);
+		}
+	}
+
+	// Only 8 bit textures
+	desc.Format = DG::TEX_FORMAT_RGBA32_FLOAT;
+	Texture floats(desc);
+	bool bThrew = false;
+	try {
+		atlas.Insert(floats);
+	} catch (std::runtime_error&) {
+		bThrew = true;
+	}
+	assert(bThrew);
+}
+
+int main() {
+	TestPacker();
+	TestAtlas();
+	TestTextures();
+
+	std::cout << "Texture atlas test passed" << std::endl;
+}
@@ -0,0 +1,181 @@
+#include <Engine/Core.hpp>
+#include <Engine/Frame.hpp>
+#include <Engine/RendererTransformCache.hpp>
+
+#include <memory>
+#include <random>
+
+using namespace Morpheus;
+
+void CheckCaches(Frame& frame, entt::entity node, const DG::float4x4& parent) {
+	DG::float4x4 world = parent;
+
+	auto transform = frame.mRegistry.try_get<Transform>(node);
+	if (transform) {
+		world = transform->ToMatrix() * parent;
+
+		auto& cache = frame.mRegistry.get<RendererTransformCache>(node);
+		for (int r = 0; r < 4; ++r)
+			for (int c = 0; c < 4; ++c)
+				assert(std::abs(cache.mCache[r][c] - world[r][c]) < 1e-3f);
+	}
+
+	for (auto child = frame.GetFirstChild(node); child != entt::null; child = frame.GetNext(child))
+		CheckCaches(frame, child, world);
+}
+
+size_t CountSubtree(Frame& frame, entt::entity node) {
+	size_t count = frame.mRegistry.has<Transform>(node) ? 1 : 0;
+	for (auto child = frame.GetFirstChild(node); child != entt::null; child = frame.GetNext(child))
+		count += CountSubtree(frame, child);
+	return count;
+}
+
+Transform RandomTransform(std::mt19937& gen) {
+	std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+	return Transform(DG::float3(dist(gen), dist(gen), dist(gen)),
+		DG::Quaternion::RotationFromAxisAngle(DG::float3(0.0f, 1.0f, 0.0f), dist(gen)),
+		DG::float3(1.0f + 0.1f * dist(gen)));
+}
+
+void Modify(Frame& frame, entt::entity e, std::mt19937& gen) {
+	auto t = RandomTransform(gen);
+	frame.mRegistry.patch<Transform>(e, [&t](Transform& transform) {
+		transform = t;
+	});
+}
+
+int main() {
+	ThreadPool pool;
+	pool.Startup();
+
+	std::mt19937 gen(0);
+	Frame frame;
+
+	// A wide level of props, large enough to be split across the pool
+	for (int i = 0; i < 5000; ++i) {
+		auto e = frame.CreateEntity();
+		frame.Emplace<Transform>(e, RandomTransform(gen));
+	}
+
+	// A character rig: a chain of bones, each with a few leaf children.
+	// The group node in between has no Transform of its own.
+	auto group = frame.CreateEntity();
+	auto rig = frame.CreateEntity(group);
+	frame.Emplace<Transform>(rig, RandomTransform(gen));
+
+	std::vector<entt::entity> bones;
+	auto parent = rig;
+	for (int i = 0; i < 20; ++i) {
+		auto bone = frame.CreateEntity(parent);
+		frame.Emplace<Transform>(bone, RandomTransform(gen));
+		bones.push_back(bone);
+
+		for (int j = 0; j < 3; ++j) {
+			auto leaf = frame.CreateEntity(bone);
+			frame.Emplace<Transform>(leaf, RandomTransform(gen));
+		}
+		parent = bone;
+	}
+
+	TransformCacheUpdater updater(&frame);
+	updater.UpdateAll(&pool);
+
+	assert(updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mNodesRecomputed == updater.Hierarchy().Size());
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Nothing changed
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mNodesRecomputed == 0);
+
+	// Animate the whole rig, every node in it must be recomputed exactly once
+	Modify(frame, rig, gen);
+	for (auto bone : bones)
+		Modify(frame, bone, gen);
+
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mDirtyRoots == 1);
+	assert(updater.LastStats().mNodesRecomputed == CountSubtree(frame, rig));
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Changes nested below another change are covered by it
+	Modify(frame, bones[15], gen);
+	Modify(frame, bones[17], gen);
+	Modify(frame, bones[5], gen);
+	updater.UpdateChanges(&pool);
+	assert(updater.LastStats().mDirtyRoots == 1);
+	assert(updater.LastStats().mNodesRecomputed == CountSubtree(frame, bones[5]));
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Reparenting only moves the subtree and recomputes it
+	size_t moved = CountSubtree(frame, bones[10]);
+	frame.SetParent(bones[10], frame.mRoot);
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mNodesRemoved == moved);
+	assert(updater.LastStats().mNodesInserted == moved);
+	assert(updater.LastStats().mNodesRecomputed == moved);
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// New nodes are inserted on their own
+	auto prop = frame.CreateEntity(bones[3]);
+	frame.Emplace<Transform>(prop, RandomTransform(gen));
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mNodesInserted == 1);
+	assert(updater.LastStats().mNodesRecomputed == 1);
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// A Transform on the group node puts the rig below it
+	frame.Emplace<Transform>(group, RandomTransform(gen));
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.LastStats().mNodesRecomputed == CountSubtree(frame, group));
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Removed nodes leave the hierarchy, their children move up a level
+	size_t size = updater.Hierarchy().Size();
+	size_t destroyed = CountSubtree(frame, bones[12]);
+	frame.mRegistry.remove<Transform>(bones[1]);
+	frame.Destroy(bones[12]);
+	updater.UpdateChanges(&pool);
+	assert(!updater.LastStats().bRebuiltHierarchy);
+	assert(updater.Hierarchy().Size() == size - 1 - destroyed);
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// The whole hierarchy is only rebuilt when asked for
+	updater.InvalidateHierarchy();
+	updater.UpdateChanges(&pool);
+	assert(updater.LastStats().bRebuiltHierarchy);
+	assert(updater.Hierarchy().Size() == size - 1 - destroyed);
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Changes not reported through the registry
+	frame.mRegistry.get<Transform>(bones[2]) = RandomTransform(gen);
+	updater.Update(bones[2]);
+	updater.UpdateChanges(&pool);
+	assert(updater.LastStats().mDirtyRoots == 1);
+	CheckCaches(frame, frame.mRoot, DG::float4x4::Identity());
+
+	// Either the frame or the updater may be destroyed first
+	{
+		auto other = std::make_unique<Frame>();
+		TransformCacheUpdater outlived(other.get());
+		other.reset();
+		outlived.SetFrame(nullptr);
+	}
+
+	{
+		Frame other;
+		{
+			TransformCacheUpdater destroyed(&other);
+		}
+		auto e = other.CreateEntity();
+		other.Emplace<Transform>(e, RandomTransform(gen));
+	}
+
+	pool.Shutdown();
+}
@@ -0,0 +1,119 @@
+#include <Engine/Core.hpp>
+#include <Engine/Systems/WorldPartition.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+
+using namespace Morpheus;
+
+#define GRID_SIZE 5
+#define CELL_SIZE 10.0f
+
+// Cells are sorted by their grid coordinates
+size_t CellIndex(int x, int z) {
+	return x * GRID_SIZE + z;
+}
+
+size_t CountEntities(Frame& frame) {
+	size_t count = 0;
+	for (auto e : frame.mRegistry.view<Transform>())
+		if (e != frame.mCamera)
+			++count;
+	return count;
+}
+
+// Reads are run by the queue between updates, like the pool does between frames
+void Stream(WorldPartitionSystem& system, Frame& frame, ImmediateTaskQueue& queue) {
+	for (int i = 0; i < 4; ++i) {
+		system.Update(&frame, &queue);
+		queue.YieldUntilEmpty();
+	}
+}
+
+int main() {
+	Frame frame;
+	ImmediateTaskQueue queue;
+
+	frame.mCamera = frame.CreateEntity();
+	frame.mRegistry.emplace<Transform>(frame.mCamera);
+
+	// One entity in the middle of every cell of the grid
+	for (int x = 0; x < GRID_SIZE; ++x) {
+		for (int z = 0; z < GRID_SIZE; ++z) {
+			auto e = frame.CreateEntity();
+			frame.mRegistry.emplace<Transform>(e).SetTranslation(
+				(x + 0.5f) * CELL_SIZE, 0.0f, (z + 0.5f) * CELL_SIZE);
+		}
+	}
+
+	auto cells = PartitionFrame(&frame, CELL_SIZE, "world_partition_test_",
+		[](const Geometry*, LoadParams<Geometry>*) { return false; });
+
+	assert(cells.size() == GRID_SIZE * GRID_SIZE);
+	assert(CountEntities(frame) == 0);
+
+	WorldPartitionParams params;
+	params.mLoadDistance = 15.0f;
+	params.mUnloadDistance = 25.0f;
+	params.mFrameBudget = 1.0;
+	params.mMaxPendingReads = GRID_SIZE * GRID_SIZE;
+
+	WorldPartitionSystem system(cells, params);
+	assert(system.CellCount() == cells.size());
+
+	// The corner cell, its two neighbours and the diagonal one are in range
+	Stream(system, frame, queue);
+	assert(system.ActiveCellCount() == 4);
+	assert(system.IsActive(CellIndex(0, 0)) && system.IsActive(CellIndex(1, 1)));
+	assert(!system.IsActive(CellIndex(2, 0)));
+	assert(CountEntities(frame) == 4);
+
+	// To the opposite corner, the first cells go away
+	frame.mRegistry.get<Transform>(frame.mCamera).SetTranslation(
+		GRID_SIZE * CELL_SIZE, 0.0f, GRID_SIZE * CELL_SIZE);
+	Stream(system, frame, queue);
+	assert(system.ActiveCellCount() == 4);
+	assert(system.IsActive(CellIndex(GRID_SIZE - 1, GRID_SIZE - 1)));
+	assert(!system.IsActive(CellIndex(0, 0)));
+	assert(CountEntities(frame) == 4);
+
+	for (auto e : frame.mRegistry.view<Transform>()) {
+		if (e == frame.mCamera)
+			continue;
+		auto position = frame.mRegistry.get<Transform>(e).GetTranslation();
+		assert(position.x > (GRID_SIZE - 2) * CELL_SIZE && position.z > (GRID_SIZE - 2) * CELL_SIZE);
+	}
+
+	// A cell that cannot be read is reported, the others still stream in
+	std::remove(cells[CellIndex(0, 0)].mSource.c_str());
+	frame.mRegistry.get<Transform>(frame.mCamera).SetTranslation(0.0f, 0.0f, 0.0f);
+	Stream(system, frame, queue);
+	assert(system.HasFailed(CellIndex(0, 0)));
+	assert(system.GetError(CellIndex(0, 0)));
+	assert(!system.HasFailed(CellIndex(1, 0)));
+	assert(system.ActiveCellCount() == 3);
+	assert(CountEntities(frame) == 3);
+
+	bool bThrew = false;
+	try {
+		std::rethrow_exception(system.GetError(CellIndex(0, 0)));
+	} catch (std::runtime_error&) {
+		bThrew = true;
+	}
+	assert(bThrew);
+
+	// Retried, it fails again without taking the frame down
+	system.Retry(CellIndex(0, 0));
+	assert(!system.HasFailed(CellIndex(0, 0)) && !system.GetError(CellIndex(0, 0)));
+	Stream(system, frame, queue);
+	assert(system.HasFailed(CellIndex(0, 0)));
+
+	system.Shutdown();
+	assert(system.ActiveCellCount() == 0);
+
+	for (auto& cell : cells)
+		std::remove(cell.mSource.c_str());
+
+	std::cout << "World partition test passed" << std::endl;
+}